@@ -522,6 +522,11 @@ EGLAPI EGLBoolean EGLAPIENTRY eglPresentationTimeANDROID (EGLDisplay dpy, EGLSur
 #define EGL_DISPLAY_ROBUST_RESOURCE_INITIALIZATION_ANGLE 0x3453
 #endif /* EGL_ANGLE_display_robust_resource_initialization */
 
+#ifndef EGL_ANGLE_display_trace_recorder
+#define EGL_ANGLE_display_trace_recorder 1
+#define EGL_DISPLAY_TRACE_RECORDER_ANGLE 0x3455
+#endif /* EGL_ANGLE_display_trace_recorder */
+
 #ifndef EGL_ANGLE_d3d_share_handle_client_buffer
 #define EGL_ANGLE_d3d_share_handle_client_buffer 1
 #define EGL_D3D_TEXTURE_2D_SHARE_HANDLE_ANGLE 0x3200
@@ -669,6 +674,16 @@ EGLAPI EGLBoolean EGLAPIENTRY eglStreamPostD3DTextureNV12ANGLE(EGLDisplay dpy, E
 #define EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE 0x3452
 #endif /* EGL_ANGLE_create_context_client_arrays */
 
+#ifndef EGL_ANGLE_create_context_memory_budget
+#define EGL_ANGLE_create_context_memory_budget 1
+#define EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE 0x3456
+#endif /* EGL_ANGLE_create_context_memory_budget */
+
+#ifndef EGL_ANGLE_create_context_multithreaded_share_group
+#define EGL_ANGLE_create_context_multithreaded_share_group 1
+#define EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE 0x3457
+#endif /* EGL_ANGLE_create_context_multithreaded_share_group */
+
 #ifndef EGL_ARM_implicit_external_sync
 #define EGL_ARM_implicit_external_sync 1
 #define EGL_SYNC_PRIOR_COMMANDS_IMPLICIT_EXTERNAL_ARM 0x328A
@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 175
+#define ANGLE_SH_VERSION 177
 
 enum ShShaderSpec
 {
@@ -222,6 +222,10 @@ const ShCompileOptions SH_TRANSLATE_VIEWID_OVR_TO_UNIFORM = UINT64_C(1) << 31;
 // output variables are initialized regardless of if this flag is set.
 const ShCompileOptions SH_INITIALIZE_UNINITIALIZED_LOCALS = UINT64_C(1) << 32;
 
+// Set to record the wall time and pool allocations of each compile stage and AST pass. The results
+// can be queried with sh::GetCompileStatistics().
+const ShCompileOptions SH_COLLECT_COMPILE_STATISTICS = UINT64_C(1) << 33;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -385,6 +389,50 @@ struct ShBuiltInResources
     int MaxUniformBufferBindings;
 };
 
+//
+// Statistics of the pool allocator backing a compiler handle, accumulated over the lifetime of the
+// handle. The translator allocates all AST and symbol memory from this pool and releases it in
+// bulk at the end of each compile.
+//
+struct ShPoolAllocatorStatistics
+{
+    size_t numAllocations;     // Number of allocations served by the pool.
+    size_t bytesAllocated;     // Bytes requested from the pool.
+    size_t bytesAbandoned;     // Bytes released by growing or destroyed containers. These can't be
+                               // reused until the end of the compile.
+    size_t highWaterMark;      // Largest number of bytes requested during a single compile.
+    size_t pageSize;           // Current page size of the pool.
+    size_t pagesInUse;         // Pages currently holding allocations.
+    size_t pagesFree;          // Pages retained for reuse by the next compile.
+    size_t systemAllocations;  // Number of allocations the pool made from the system.
+    size_t systemBytes;        // Bytes the pool allocated from the system.
+};
+
+//
+// Cost of a single compile stage or AST pass, recorded when SH_COLLECT_COMPILE_STATISTICS is set.
+//
+struct ShCompileStageStatistics
+{
+    const char *name;        // Name of the stage. Points to a string with static lifetime.
+    double startSeconds;     // Start of the stage, relative to the start of the compile.
+    double seconds;          // Wall time spent in the stage.
+    size_t poolBytes;        // Bytes requested from the pool allocator during the stage.
+    size_t poolAllocations;  // Number of pool allocations made during the stage.
+};
+
+//
+// Controls how a compiler handle recycles pool memory between compiles.
+//
+struct ShPoolAllocatorOptions
+{
+    // Grow the page size from observed compile footprints so that a compile fits in a few pages
+    // instead of falling back to individual system allocations for large requests.
+    bool adaptivePageSize = false;
+
+    // Maximum number of free pages kept between compiles. The rest is returned to the system.
+    size_t maxRetainedPages = static_cast<size_t>(-1);
+};
+
 //
 // ShHandle held by but opaque to the driver.  It is allocated,
 // managed, and de-allocated by the compiler. Its contents
@@ -532,6 +580,25 @@ bool GetInterfaceBlockRegister(const ShHandle handle,
 // Note that the map contains also registers of samplers that have been extracted from structs.
 const std::map<std::string, unsigned int> *GetUniformRegisterMap(const ShHandle handle);
 
+// Returns the cost of each stage of the last compile, in the order the stages finished. The
+// "Total" stage covers the whole compile and comes last. The list is empty unless the last compile
+// set SH_COLLECT_COMPILE_STATISTICS.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<ShCompileStageStatistics> &GetCompileStatistics(const ShHandle handle);
+
+// Returns the statistics of the pool allocator used by the compiler.
+// Parameters:
+// handle: Specifies the compiler
+ShPoolAllocatorStatistics GetPoolAllocatorStatistics(const ShHandle handle);
+
+// Sets how the compiler reuses pool allocator memory between compiles. Excess free pages are
+// released immediately, the page size adapts at the end of each compile.
+// Parameters:
+// handle: Specifies the compiler
+// options: Specifies the page sizing and retention policy
+void SetPoolAllocatorOptions(const ShHandle handle, const ShPoolAllocatorOptions &options);
+
 }  // namespace sh
 
 #endif // GLSLANG_SHADERLANG_H_
@@ -9,6 +9,7 @@
 #ifndef ANGLE_PLATFORM_H
 #define ANGLE_PLATFORM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(_WIN32)
@@ -289,6 +290,16 @@ ANGLE_PLATFORM_EXPORT bool ANGLE_APIENTRY ANGLEGetDisplayPlatform(angle::EGLDisp
 // If display is not valid, behaviour is undefined.
 ANGLE_PLATFORM_EXPORT void ANGLE_APIENTRY ANGLEResetDisplayPlatform(angle::EGLDisplayType display);
 
+// Writes the events of the built-in trace recorder to its output file, see
+// EGL_ANGLE_display_trace_recorder. Returns false if the recorder isn't running or the file can't
+// be written.
+ANGLE_PLATFORM_EXPORT bool ANGLE_APIENTRY ANGLEFlushTraceRecorder();
+
+// Copies the JSON dump of the histograms ANGLE recorded itself, because no histogram platform
+// methods were set, to |buffer| if it holds |bufferSize| bytes or more. Returns the size the buffer
+// needs, including the null terminator.
+ANGLE_PLATFORM_EXPORT size_t ANGLE_APIENTRY ANGLEGetHistogramsJSON(char *buffer, size_t bufferSize);
+
 }  // extern "C"
 
 namespace angle
@@ -299,6 +310,8 @@ typedef bool(ANGLE_APIENTRY *GetDisplayPlatformFunc)(angle::EGLDisplayType,
                                                      void *,
                                                      void *);
 typedef void(ANGLE_APIENTRY *ResetDisplayPlatformFunc)(angle::EGLDisplayType);
+typedef bool(ANGLE_APIENTRY *FlushTraceRecorderFunc)();
+typedef size_t(ANGLE_APIENTRY *GetHistogramsJSONFunc)(char *, size_t);
 }  // namespace angle
 
 // This function is not exported
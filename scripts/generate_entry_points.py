@@ -20,6 +20,25 @@ root = tree.getroot()
 gles2_xpath = ".//feature[@name='GL_ES_VERSION_2_0']//command"
 gles2_commands = [cmd.attrib['name'] for cmd in root.findall(gles2_xpath)]
 
+# The GLES 3.0 entry points that go through the dispatch tables. The others are still written by
+# hand in entry_points_gles_3_0.cpp.
+gles3_commands = [
+    "glReadBuffer",
+    "glCopyTexSubImage3D",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glBeginTransformFeedback",
+    "glBindBufferBase",
+    "glClearBufferfi",
+    "glCopyBufferSubData",
+    "glDrawArraysInstanced",
+    "glSamplerParameteri",
+    "glSamplerParameterf",
+    "glProgramParameteri",
+]
+
 template_entry_point_header = """// GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {data_source_name}.
 //
@@ -33,7 +52,7 @@ template_entry_point_header = """// GENERATED FILE - DO NOT EDIT.
 #ifndef LIBGLESV2_ENTRYPOINTSGLES{major_version}{minor_version}_AUTOGEN_H_
 #define LIBGLESV2_ENTRYPOINTSGLES{major_version}{minor_version}_AUTOGEN_H_
 
-#include <GLES2/gl{major_version}.h>
+#include <GLES{major_version}/gl{major_version}.h>
 #include <export.h>
 
 namespace gl
@@ -58,7 +77,7 @@ template_entry_point_source = """// GENERATED FILE - DO NOT EDIT.
 
 #include "common/debug.h"
 #include "libANGLE/Context.h"
-#include "libANGLE/validationES2.h"
+#include "libANGLE/dispatch_table_autogen.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -95,22 +114,122 @@ template_entry_point_def = """{return_type}GL_APIENTRY {name}({params})
 {{
     EVENT("({format_params})"{comma_if_needed}{pass_params});
 
-    Context *context = {context_getter}();
+    Context *context = GetCurrentContext();
     if (context)
     {{
-        context->gatherParams<EntryPoint::{name}>({pass_params});
+        {return_if_needed}context->getDispatchTable()->{name_lower}({dispatch_params});
+    }}
+{default_return_if_needed}}}
+"""
+
+template_dispatch_table_header = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// dispatch_table_autogen.h:
+//   Defines the tables of GLES entry point implementations a context dispatches calls through.
+
+#ifndef LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
+#define LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
+
+#include "angle_gl.h"
 
-        if (context->skipValidation() || Validate{name}({validate_params}))
-        {{
-            {return_if_needed}context->{name_lower}({pass_params});
-        }}
+namespace gl
+{{
+class Context;
+
+struct DispatchTable
+{{
+{members}
+}};
+
+// Validates the parameters of each call before executing it.
+extern const DispatchTable kValidatedDispatchTable;
+
+// Executes the calls without validating them, for contexts created with
+// EGL_CONTEXT_OPENGL_NO_ERROR_KHR.
+extern const DispatchTable kNoErrorDispatchTable;
+
+// Generates GL_OUT_OF_MEMORY for every call except GetError.
+extern const DispatchTable kContextLostDispatchTable;
+}}  // namespace gl
+
+#endif  // LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
+"""
+
+template_dispatch_table_source = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// dispatch_table_autogen.cpp:
+//   Defines the tables of GLES entry point implementations a context dispatches calls through.
+
+#include "libANGLE/dispatch_table_autogen.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
+#include "libANGLE/validationES.h"
+#include "libANGLE/validationES2.h"
+#include "libANGLE/validationES3.h"
+
+namespace gl
+{{
+namespace
+{{
+template <typename ReturnT, typename... ParamsT>
+ReturnT ContextLost(Context *context, ParamsT...)
+{{
+    context->handleError(Error(GL_OUT_OF_MEMORY, kErrorContextLost));
+    return ReturnT();
+}}
+
+{functions}}}  // anonymous namespace
+
+const DispatchTable kValidatedDispatchTable = {{
+{validated_entries}
+}};
+
+const DispatchTable kNoErrorDispatchTable = {{
+{no_error_entries}
+}};
+
+const DispatchTable kContextLostDispatchTable = {{
+{context_lost_entries}
+}};
+}}  // namespace gl
+"""
+
+template_dispatch_table_member = """    {return_type}(*{name_lower})({params});"""
+
+template_validated_def = """{return_type}{name}Validated({params})
+{{
+    context->gatherParams<EntryPoint::{name}>({pass_params});
+
+    if (Validate{name}({validate_params}))
+    {{
+        {return_if_needed}context->{name_lower}({pass_params});
     }}
 {default_return_if_needed}}}
 """
 
+template_no_error_def = """{return_type}{name}NoError({params})
+{{
+    context->gatherParams<EntryPoint::{name}>({pass_params});
+    {return_if_needed}context->{name_lower}({pass_params});
+}}
+"""
+
 commands = root.find(".//commands[@namespace='GL']")
 entry_point_decls_gles_2_0 = []
 entry_point_defs_gles_2_0 = []
+entry_point_decls_gles_3_0 = []
+entry_point_defs_gles_3_0 = []
 cmd_names = []
 
 def format_entry_point_decl(cmd_name, proto, params):
@@ -160,11 +279,8 @@ def default_return_value(return_type):
     else:
         print(return_type)
 
-def get_context_getter_function(cmd_name):
-    if cmd_name == "glGetError":
-        return "GetGlobalContext"
-    else:
-        return "GetValidGlobalContext"
+def param_type(param):
+    return param[:type_name_sep_index(param)+1].strip()
 
 def format_entry_point_def(cmd_name, proto, params):
     pass_params = [just_the_name(param) for param in params]
@@ -177,21 +293,78 @@ def format_entry_point_def(cmd_name, proto, params):
         return_type = return_type,
         params = ", ".join(params),
         pass_params = ", ".join(pass_params),
+        dispatch_params = ", ".join(["context"] + pass_params),
         comma_if_needed = ", " if len(params) > 0 else "",
-        validate_params = ", ".join(["context"] + pass_params),
         format_params = ", ".join(format_params),
         return_if_needed = "" if default_return == "" else "return ",
-        default_return_if_needed = "" if default_return == "" else "\n    return " + default_return + ";\n",
-        context_getter = get_context_getter_function(cmd_name))
+        default_return_if_needed = "" if default_return == "" else "\n    return " + default_return + ";\n")
 
-for cmd_name in gles2_commands:
+def format_dispatch_table_member(cmd_name, proto, params):
+    return template_dispatch_table_member.format(
+        name_lower = cmd_name[2:3].lower() + cmd_name[3:],
+        return_type = proto[:-len(cmd_name)],
+        params = ", ".join(["Context *context"] + params))
+
+def format_dispatch_functions(cmd_name, proto, params):
+    pass_params = [just_the_name(param) for param in params]
+    return_type = proto[:-len(cmd_name)]
+    default_return = default_return_value(return_type.strip())
+    format_args = dict(
+        name = cmd_name[2:],
+        name_lower = cmd_name[2:3].lower() + cmd_name[3:],
+        return_type = return_type,
+        params = ", ".join(["Context *context"] + params),
+        pass_params = ", ".join(pass_params),
+        dispatch_params = ", ".join(["context"] + pass_params),
+        validate_params = ", ".join(["context"] + pass_params),
+        comma_if_needed = ", " if len(params) > 0 else "",
+        return_if_needed = "" if default_return == "" else "return ",
+        default_return_if_needed = "" if default_return == "" else "\n    return " + default_return + ";\n")
+    return [template_validated_def.format(**format_args),
+            template_no_error_def.format(**format_args)]
+
+def format_context_lost_entry(cmd_name, proto, params):
+    # GetError still returns the errors, GL_OUT_OF_MEMORY among them.
+    if cmd_name == "glGetError":
+        return "    GetErrorValidated"
+    template_args = [proto[:-len(cmd_name)].strip()] + [param_type(param) for param in params]
+    return "    ContextLost<" + ", ".join(template_args) + ">"
+
+dispatch_table_members = []
+dispatch_functions = []
+validated_entries = []
+no_error_entries = []
+context_lost_entries = []
+
+def get_command(cmd_name):
     command_xpath = "command/proto[name='" + cmd_name + "']/.."
     command = commands.find(command_xpath)
     params = ["".join(param.itertext()) for param in command.findall("./param")]
     proto = "".join(command.find("./proto").itertext())
+    return proto, params
+
+def add_dispatch_entries(cmd_name, proto, params):
+    global dispatch_table_members, dispatch_functions, validated_entries, no_error_entries
+    global context_lost_entries
+    dispatch_table_members += [format_dispatch_table_member(cmd_name, proto, params)]
+    dispatch_functions += format_dispatch_functions(cmd_name, proto, params)
+    validated_entries += ["    " + cmd_name[2:] + "Validated"]
+    no_error_entries += ["    " + cmd_name[2:] + "NoError"]
+    context_lost_entries += [format_context_lost_entry(cmd_name, proto, params)]
+
+for cmd_name in gles2_commands:
+    proto, params = get_command(cmd_name)
     cmd_names += [cmd_name]
     entry_point_decls_gles_2_0 += [format_entry_point_decl(cmd_name, proto, params)]
     entry_point_defs_gles_2_0 += [format_entry_point_def(cmd_name, proto, params)]
+    add_dispatch_entries(cmd_name, proto, params)
+
+for cmd_name in gles3_commands:
+    proto, params = get_command(cmd_name)
+    cmd_names += [cmd_name]
+    entry_point_decls_gles_3_0 += [format_entry_point_decl(cmd_name, proto, params)]
+    entry_point_defs_gles_3_0 += [format_entry_point_def(cmd_name, proto, params)]
+    add_dispatch_entries(cmd_name, proto, params)
 
 gles_2_0_header = template_entry_point_header.format(
     script_name = os.path.basename(sys.argv[0]),
@@ -209,20 +382,57 @@ gles_2_0_source = template_entry_point_source.format(
     minor_version = 0,
     entry_points = "\n".join(entry_point_defs_gles_2_0))
 
+gles_3_0_header = template_entry_point_header.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = "gl.xml",
+    year = date.today().year,
+    major_version = 3,
+    minor_version = 0,
+    entry_points = "\n".join(entry_point_decls_gles_3_0))
+
+gles_3_0_source = template_entry_point_source.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = "gl.xml",
+    year = date.today().year,
+    major_version = 3,
+    minor_version = 0,
+    entry_points = "\n".join(entry_point_defs_gles_3_0))
+
 # TODO(jmadill): Remove manually added entry points.
-manual_cmd_names = ["Invalid"] + [cmd[2:] for cmd in cmd_names] + ["DrawElementsInstanced", "DrawRangeElements", "DrawElementsInstancedANGLE"]
+manual_cmd_names = ["Invalid"] + [cmd[2:] for cmd in cmd_names] + [
+    "DrawElementsInstanced", "DrawRangeElements", "DrawElementsInstancedANGLE",
+    "MultiDrawElementsANGLE", "MultiDrawElementsInstancedANGLE"]
 entry_points_enum = template_entry_points_enum_header.format(
     script_name = os.path.basename(sys.argv[0]),
     data_source_name = "gl.xml",
     year = date.today().year,
     entry_points_list = ",\n".join(["    " + cmd for cmd in manual_cmd_names]))
 
+dispatch_table_header = template_dispatch_table_header.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = "gl.xml",
+    year = date.today().year,
+    members = "\n".join(dispatch_table_members))
+
+dispatch_table_source = template_dispatch_table_source.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = "gl.xml",
+    year = date.today().year,
+    functions = "\n".join(dispatch_functions),
+    validated_entries = ",\n".join(validated_entries),
+    no_error_entries = ",\n".join(no_error_entries),
+    context_lost_entries = ",\n".join(context_lost_entries))
+
 def path_to(folder, file):
     return os.path.join(script_relative(".."), "src", folder, file)
 
 gles_2_0_header_path = path_to("libGLESv2", "entry_points_gles_2_0_autogen.h")
 gles_2_0_source_path = path_to("libGLESv2", "entry_points_gles_2_0_autogen.cpp")
+gles_3_0_header_path = path_to("libGLESv2", "entry_points_gles_3_0_autogen.h")
+gles_3_0_source_path = path_to("libGLESv2", "entry_points_gles_3_0_autogen.cpp")
 entry_points_enum_header_path = path_to("libANGLE", "entry_points_enum_autogen.h")
+dispatch_table_header_path = path_to("libANGLE", "dispatch_table_autogen.h")
+dispatch_table_source_path = path_to("libANGLE", "dispatch_table_autogen.cpp")
 
 with open(gles_2_0_header_path, "w") as out:
     out.write(gles_2_0_header)
@@ -232,6 +442,22 @@ with open(gles_2_0_source_path, "w") as out:
     out.write(gles_2_0_source)
     out.close()
 
+with open(gles_3_0_header_path, "w") as out:
+    out.write(gles_3_0_header)
+    out.close()
+
+with open(gles_3_0_source_path, "w") as out:
+    out.write(gles_3_0_source)
+    out.close()
+
 with open(entry_points_enum_header_path, "w") as out:
     out.write(entry_points_enum)
     out.close()
+
+with open(dispatch_table_header_path, "w") as out:
+    out.write(dispatch_table_header)
+    out.close()
+
+with open(dispatch_table_source_path, "w") as out:
+    out.write(dispatch_table_source)
+    out.close()
@@ -0,0 +1,126 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuddyAllocator.cpp:
+//   Implements the BuddyAllocator class.
+//
+
+#include "common/BuddyAllocator.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+
+BuddyAllocator::BuddyAllocator(uint64_t size, uint64_t minAllocationSize)
+    : mSize(size), mMinAllocationSize(minAllocationSize), mAllocatedSize(0)
+{
+    ASSERT(gl::isPow2(size) && gl::isPow2(minAllocationSize));
+    ASSERT(size >= minAllocationSize);
+
+    size_t orderCount = 1;
+    while (getRangeSize(orderCount - 1) < size)
+    {
+        orderCount++;
+    }
+
+    mFreeRanges.resize(orderCount);
+    mFreeRanges.back().insert(0);
+}
+
+BuddyAllocator::~BuddyAllocator()
+{
+}
+
+bool BuddyAllocator::allocate(uint64_t size, uint64_t alignment, uint64_t *offsetOut)
+{
+    uint64_t requiredSize = std::max(std::max(size, alignment), mMinAllocationSize);
+
+    size_t order = 0;
+    while (order < mFreeRanges.size() && getRangeSize(order) < requiredSize)
+    {
+        order++;
+    }
+
+    // Find the smallest free range that fits.
+    size_t splitOrder = order;
+    while (splitOrder < mFreeRanges.size() && mFreeRanges[splitOrder].empty())
+    {
+        splitOrder++;
+    }
+
+    if (splitOrder >= mFreeRanges.size())
+    {
+        return false;
+    }
+
+    // Take the lowest range so allocations pack towards the start of the block.
+    auto rangeIter  = mFreeRanges[splitOrder].begin();
+    uint64_t offset = *rangeIter;
+    mFreeRanges[splitOrder].erase(rangeIter);
+
+    // Split it until it has the requested order, freeing the upper halves.
+    while (splitOrder > order)
+    {
+        splitOrder--;
+        mFreeRanges[splitOrder].insert(offset + getRangeSize(splitOrder));
+    }
+
+    mAllocations[offset] = order;
+    mAllocatedSize += getRangeSize(order);
+
+    *offsetOut = offset;
+    return true;
+}
+
+void BuddyAllocator::free(uint64_t offset)
+{
+    auto allocationIter = mAllocations.find(offset);
+    ASSERT(allocationIter != mAllocations.end());
+
+    size_t order = allocationIter->second;
+    mAllocations.erase(allocationIter);
+    mAllocatedSize -= getRangeSize(order);
+
+    // Merge with the buddy range as long as it is free.
+    while (order + 1 < mFreeRanges.size())
+    {
+        uint64_t buddyOffset = offset ^ getRangeSize(order);
+        auto buddyIter       = mFreeRanges[order].find(buddyOffset);
+        if (buddyIter == mFreeRanges[order].end())
+        {
+            break;
+        }
+
+        mFreeRanges[order].erase(buddyIter);
+        offset = std::min(offset, buddyOffset);
+        order++;
+    }
+
+    mFreeRanges[order].insert(offset);
+}
+
+uint64_t BuddyAllocator::getAllocationSize(uint64_t offset) const
+{
+    auto allocationIter = mAllocations.find(offset);
+    ASSERT(allocationIter != mAllocations.end());
+    return getRangeSize(allocationIter->second);
+}
+
+uint64_t BuddyAllocator::getLargestFreeRangeSize() const
+{
+    for (size_t order = mFreeRanges.size(); order > 0; --order)
+    {
+        if (!mFreeRanges[order - 1].empty())
+        {
+            return getRangeSize(order - 1);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace angle
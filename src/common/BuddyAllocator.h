@@ -0,0 +1,64 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuddyAllocator.h:
+//   Hands out power-of-two sized, naturally aligned ranges of a larger memory block. Only offsets
+//   are tracked, so the same class serves any kind of memory.
+//
+
+#ifndef COMMON_BUDDYALLOCATOR_H_
+#define COMMON_BUDDYALLOCATOR_H_
+
+#include <stdint.h>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+class BuddyAllocator final : NonCopyable
+{
+  public:
+    // Both sizes must be powers of two, and size at least minAllocationSize.
+    BuddyAllocator(uint64_t size, uint64_t minAllocationSize);
+    ~BuddyAllocator();
+
+    // Ranges are rounded up to the next power of two of max(size, alignment, minAllocationSize),
+    // which also makes them aligned to that size. Returns false if no free range is large enough.
+    bool allocate(uint64_t size, uint64_t alignment, uint64_t *offsetOut);
+    void free(uint64_t offset);
+
+    // The size of the range allocated at offset, after rounding.
+    uint64_t getAllocationSize(uint64_t offset) const;
+
+    uint64_t getSize() const { return mSize; }
+    uint64_t getAllocatedSize() const { return mAllocatedSize; }
+    size_t getAllocationCount() const { return mAllocations.size(); }
+    bool empty() const { return mAllocations.empty(); }
+
+    // Allocations up to this size are guaranteed to succeed. With getAllocatedSize, tells how
+    // fragmented the block is.
+    uint64_t getLargestFreeRangeSize() const;
+
+  private:
+    uint64_t getRangeSize(size_t order) const { return mMinAllocationSize << order; }
+
+    uint64_t mSize;
+    uint64_t mMinAllocationSize;
+    uint64_t mAllocatedSize;
+
+    // Free ranges by order, where ranges of order N are mMinAllocationSize << N bytes large.
+    std::vector<std::set<uint64_t>> mFreeRanges;
+
+    // The order of every allocated range, by offset.
+    std::unordered_map<uint64_t, size_t> mAllocations;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_BUDDYALLOCATOR_H_
@@ -0,0 +1,95 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuddyAllocator_unittest:
+//   Tests of the buddy allocator the Vulkan back-end suballocates device memory with.
+//
+
+#include <gtest/gtest.h>
+
+#include "common/BuddyAllocator.h"
+
+using angle::BuddyAllocator;
+
+namespace
+{
+
+// Allocations are rounded up to powers of two and placed next to each other.
+TEST(BuddyAllocatorTest, RoundsAndPacks)
+{
+    BuddyAllocator allocator(1024, 64);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(allocator.allocate(10, 1, &offset));
+    EXPECT_EQ(0u, offset);
+    ASSERT_TRUE(allocator.allocate(100, 1, &offset));
+    EXPECT_EQ(128u, offset);
+    EXPECT_EQ(128u, allocator.getAllocationSize(offset));
+    ASSERT_TRUE(allocator.allocate(64, 1, &offset));
+    EXPECT_EQ(64u, offset);
+
+    EXPECT_EQ(3u, allocator.getAllocationCount());
+    EXPECT_EQ(256u, allocator.getAllocatedSize());
+    EXPECT_EQ(512u, allocator.getLargestFreeRangeSize());
+}
+
+// The alignment is honored by allocating a range at least as large.
+TEST(BuddyAllocatorTest, Alignment)
+{
+    BuddyAllocator allocator(1024, 64);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(allocator.allocate(64, 1, &offset));
+    ASSERT_TRUE(allocator.allocate(64, 256, &offset));
+    EXPECT_EQ(256u, offset);
+}
+
+// Freed ranges merge with their buddies until the whole block is free again.
+TEST(BuddyAllocatorTest, FreeMerges)
+{
+    BuddyAllocator allocator(1024, 64);
+
+    std::vector<uint64_t> offsets;
+    uint64_t offset = 0;
+    while (allocator.allocate(64, 1, &offset))
+    {
+        offsets.push_back(offset);
+    }
+    EXPECT_EQ(16u, offsets.size());
+    EXPECT_EQ(0u, allocator.getLargestFreeRangeSize());
+
+    // Free every other range: nothing can merge.
+    for (size_t index = 0; index < offsets.size(); index += 2)
+    {
+        allocator.free(offsets[index]);
+    }
+    EXPECT_EQ(64u, allocator.getLargestFreeRangeSize());
+    EXPECT_FALSE(allocator.allocate(128, 1, &offset));
+
+    for (size_t index = 1; index < offsets.size(); index += 2)
+    {
+        allocator.free(offsets[index]);
+    }
+    EXPECT_TRUE(allocator.empty());
+    EXPECT_EQ(0u, allocator.getAllocatedSize());
+    EXPECT_EQ(1024u, allocator.getLargestFreeRangeSize());
+
+    ASSERT_TRUE(allocator.allocate(1024, 1, &offset));
+    EXPECT_EQ(0u, offset);
+}
+
+// Requests larger than the block fail without changing it.
+TEST(BuddyAllocatorTest, TooLarge)
+{
+    BuddyAllocator allocator(1024, 64);
+
+    uint64_t offset = 0;
+    EXPECT_FALSE(allocator.allocate(2048, 1, &offset));
+    EXPECT_FALSE(allocator.allocate(16, 4096, &offset));
+    EXPECT_TRUE(allocator.empty());
+    EXPECT_EQ(1024u, allocator.getLargestFreeRangeSize());
+}
+
+}  // anonymous namespace
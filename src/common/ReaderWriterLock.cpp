@@ -0,0 +1,103 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReaderWriterLock.cpp:
+//   Implements the ReaderWriterLock class.
+//
+
+#include "common/ReaderWriterLock.h"
+
+#include "common/debug.h"
+
+namespace angle
+{
+
+namespace
+{
+constexpr uint32_t kWriterBit = 0x80000000u;
+}  // anonymous namespace
+
+ReaderWriterLock::ReaderWriterLock() : mState(0), mWaitingWriterCount(0)
+{
+}
+
+ReaderWriterLock::~ReaderWriterLock()
+{
+    ASSERT(mState.load() == 0 && mWaitingWriterCount.load() == 0);
+}
+
+void ReaderWriterLock::lockShared()
+{
+    while (true)
+    {
+        if (mWaitingWriterCount.load() == 0)
+        {
+            uint32_t previousState = mState.fetch_add(1);
+            if ((previousState & kWriterBit) == 0)
+            {
+                return;
+            }
+            releaseReader();
+        }
+
+        std::unique_lock<std::mutex> waitLock(mWaitMutex);
+        mWaitCondition.wait(waitLock, [this]() {
+            return mWaitingWriterCount.load() == 0 && (mState.load() & kWriterBit) == 0;
+        });
+    }
+}
+
+void ReaderWriterLock::unlockShared()
+{
+    ASSERT((mState.load() & ~kWriterBit) != 0);
+    releaseReader();
+}
+
+void ReaderWriterLock::lock()
+{
+    mWaitingWriterCount.fetch_add(1);
+
+    while (true)
+    {
+        uint32_t state = 0;
+        if (mState.compare_exchange_strong(state, kWriterBit))
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> waitLock(mWaitMutex);
+        mWaitCondition.wait(waitLock, [this]() { return mState.load() == 0; });
+    }
+
+    mWaitingWriterCount.fetch_sub(1);
+}
+
+void ReaderWriterLock::unlock()
+{
+    ASSERT((mState.load() & kWriterBit) != 0);
+    mState.fetch_and(~kWriterBit);
+    wakeWaiters();
+}
+
+void ReaderWriterLock::releaseReader()
+{
+    // The last reader out lets a waiting writer in.
+    uint32_t previousState = mState.fetch_sub(1);
+    if (previousState == 1 && mWaitingWriterCount.load() != 0)
+    {
+        wakeWaiters();
+    }
+}
+
+void ReaderWriterLock::wakeWaiters()
+{
+    // Taking the mutex makes sure a thread that just found the lock taken is already waiting.
+    {
+        std::lock_guard<std::mutex> waitLock(mWaitMutex);
+    }
+    mWaitCondition.notify_all();
+}
+
+}  // namespace angle
@@ -0,0 +1,101 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReaderWriterLock.h:
+//   A lock that any number of readers can hold at once, or a single writer. Taking it for reading
+//   is a single atomic add when no writer holds or waits for it, so lookups of shared objects
+//   don't serialize the threads doing them. Threads that have to wait sleep on a condition
+//   variable.
+//
+
+#ifndef COMMON_READERWRITERLOCK_H_
+#define COMMON_READERWRITERLOCK_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+class ReaderWriterLock final : NonCopyable
+{
+  public:
+    ReaderWriterLock();
+    ~ReaderWriterLock();
+
+    // Waiting writers keep new readers out, so writers don't starve.
+    void lockShared();
+    void unlockShared();
+
+    void lock();
+    void unlock();
+
+  private:
+    void releaseReader();
+    void wakeWaiters();
+
+    // The number of readers holding the lock, with kWriterBit set while a writer does. Readers
+    // that find the bit set undo their increment and wait.
+    std::atomic<uint32_t> mState;
+    std::atomic<uint32_t> mWaitingWriterCount;
+
+    std::mutex mWaitMutex;
+    std::condition_variable mWaitCondition;
+};
+
+// The scoped locks do nothing when given a null lock, so objects that only lock in some
+// configurations don't need a second code path.
+class ScopedReaderLock final : NonCopyable
+{
+  public:
+    explicit ScopedReaderLock(ReaderWriterLock *lock) : mLock(lock)
+    {
+        if (mLock)
+        {
+            mLock->lockShared();
+        }
+    }
+    ~ScopedReaderLock()
+    {
+        if (mLock)
+        {
+            mLock->unlockShared();
+        }
+    }
+
+  private:
+    ReaderWriterLock *mLock;
+};
+
+class ScopedWriterLock final : NonCopyable
+{
+  public:
+    explicit ScopedWriterLock(ReaderWriterLock *lock) : mLock(lock)
+    {
+        if (mLock)
+        {
+            mLock->lock();
+        }
+    }
+    ~ScopedWriterLock()
+    {
+        if (mLock)
+        {
+            mLock->unlock();
+        }
+    }
+
+  private:
+    ReaderWriterLock *mLock;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_READERWRITERLOCK_H_
@@ -0,0 +1,87 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReaderWriterLock_unittest:
+//   Tests of the lock guarding the resource managers of a share group.
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "common/ReaderWriterLock.h"
+
+using namespace angle;
+
+namespace
+{
+
+// Readers don't exclude each other.
+TEST(ReaderWriterLockTest, ReadersShare)
+{
+    ReaderWriterLock lock;
+
+    ScopedReaderLock firstReader(&lock);
+    bool secondReaderLocked = false;
+    std::thread reader([&lock, &secondReaderLocked]() {
+        ScopedReaderLock secondReader(&lock);
+        secondReaderLocked = true;
+    });
+    reader.join();
+
+    EXPECT_TRUE(secondReaderLocked);
+}
+
+// Writers exclude readers and each other: the counters are updated non-atomically under the
+// writer lock and checked for consistency under the reader lock.
+TEST(ReaderWriterLockTest, WritersExclude)
+{
+    constexpr size_t kThreadCount = 4;
+    constexpr size_t kIterations  = 10000;
+
+    ReaderWriterLock lock;
+    size_t firstCounter  = 0;
+    size_t secondCounter = 0;
+    std::vector<char> consistent(kThreadCount, 1);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]() {
+            for (size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                if (iteration % 4 == 0)
+                {
+                    ScopedWriterLock writer(&lock);
+                    firstCounter++;
+                    secondCounter++;
+                }
+                else
+                {
+                    ScopedReaderLock reader(&lock);
+                    if (firstCounter != secondCounter)
+                    {
+                        consistent[threadIndex] = 0;
+                    }
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (char threadConsistent : consistent)
+    {
+        EXPECT_TRUE(threadConsistent != 0);
+    }
+    EXPECT_EQ(kThreadCount * kIterations / 4, firstCounter);
+    EXPECT_EQ(firstCounter, secondCounter);
+}
+
+}  // anonymous namespace
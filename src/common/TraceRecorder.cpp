@@ -0,0 +1,524 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder.cpp:
+//   Implements the built-in trace event recorder.
+//
+
+#include "common/TraceRecorder.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <pthread.h>
+#endif
+
+namespace angle
+{
+
+namespace
+{
+
+// The argument types and flags of angle::PlatformMethods::addTraceEvent.
+constexpr unsigned char kArgTypeBool       = 1;
+constexpr unsigned char kArgTypeUInt       = 2;
+constexpr unsigned char kArgTypeInt        = 3;
+constexpr unsigned char kArgTypeDouble     = 4;
+constexpr unsigned char kArgTypePointer    = 5;
+constexpr unsigned char kArgTypeString     = 6;
+constexpr unsigned char kArgTypeCopyString = 7;
+constexpr unsigned char kFlagCopy          = 0x1;
+constexpr unsigned char kFlagHasID         = 0x2;
+
+// The TRACE_EVENT macros pass at most two arguments.
+constexpr int kMaxEventArgs = 2;
+
+constexpr char kDefaultOutputPath[] = "angle_trace.json";
+
+struct RecordedEvent
+{
+    double timestamp;  // Microseconds since the recorder was created.
+    double duration;   // Microseconds, for complete events.
+    const char *name;
+    unsigned long long id;
+    const char *argNames[kMaxEventArgs];
+    unsigned long long argValues[kMaxEventArgs];
+    unsigned char argTypes[kMaxEventArgs];
+    unsigned char numArgs;
+    bool hasID;
+    char phase;
+    uint32_t threadID;
+};
+
+// Events are stored as atomic words, so the flush can read a slot while its thread overwrites it.
+constexpr size_t kEventWords = (sizeof(RecordedEvent) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+// A slot is a seqlock. Its sequence is odd while event |sequence / 2| is written into it and even
+// once event |sequence / 2 - 1| is complete.
+struct EventSlot
+{
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> words[kEventWords];
+};
+
+// Only the thread that owns a buffer writes to it. The flush reads it concurrently, and skips the
+// events the writer overwrote while they were copied.
+struct ThreadEventBuffer : angle::NonCopyable
+{
+    ThreadEventBuffer()
+        : slots(new EventSlot[kTraceRecorderEventsPerThread]),
+          writeCount(0),
+          threadID(0),
+          firstIndex(0)
+    {
+        for (size_t slotIndex = 0; slotIndex < kTraceRecorderEventsPerThread; ++slotIndex)
+        {
+            slots[slotIndex].sequence.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void writeEvent(const RecordedEvent &event)
+    {
+        uint64_t words[kEventWords] = {};
+        memcpy(words, &event, sizeof(RecordedEvent));
+
+        uint64_t index  = writeCount.load(std::memory_order_relaxed);
+        EventSlot &slot = slots[index % kTraceRecorderEventsPerThread];
+        slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t wordIndex = 0; wordIndex < kEventWords; ++wordIndex)
+        {
+            slot.words[wordIndex].store(words[wordIndex], std::memory_order_relaxed);
+        }
+        slot.sequence.store(index * 2 + 2, std::memory_order_release);
+
+        writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    // Copies the events from |firstIndex| on that the buffer still holds.
+    void copyEvents(uint64_t firstIndex, std::vector<RecordedEvent> *eventsOut) const
+    {
+        constexpr uint64_t kCapacity = kTraceRecorderEventsPerThread;
+
+        uint64_t end   = writeCount.load(std::memory_order_acquire);
+        uint64_t begin = std::max(firstIndex, end > kCapacity ? end - kCapacity : 0);
+
+        eventsOut->clear();
+        for (uint64_t index = begin; index < end; ++index)
+        {
+            const EventSlot &slot = slots[index % kCapacity];
+            uint64_t sequence     = slot.sequence.load(std::memory_order_acquire);
+
+            uint64_t words[kEventWords];
+            for (size_t wordIndex = 0; wordIndex < kEventWords; ++wordIndex)
+            {
+                words[wordIndex] = slot.words[wordIndex].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Skip the event if a newer one was written into the slot in the meantime.
+            if (sequence != index * 2 + 2 ||
+                slot.sequence.load(std::memory_order_relaxed) != sequence)
+            {
+                continue;
+            }
+
+            RecordedEvent event;
+            memcpy(&event, words, sizeof(RecordedEvent));
+            eventsOut->push_back(event);
+        }
+    }
+
+    std::unique_ptr<EventSlot[]> slots;
+    std::atomic<uint64_t> writeCount;
+
+    // Guarded by the mutex of the recorder. The id of the thread that owns the buffer, which only
+    // that thread reads, and the index of the first event not dropped by StopTraceRecorder.
+    uint32_t threadID;
+    uint64_t firstIndex;
+};
+
+struct Recorder : angle::NonCopyable
+{
+    Recorder()
+        : startTime(std::chrono::steady_clock::now()), threadCount(0), exitHandlerRegistered(false)
+    {
+    }
+
+    const std::chrono::steady_clock::time_point startTime;
+
+    // Guards the members below. Recording only takes it for the first event of each thread, and
+    // when the thread exits.
+    std::mutex mutex;
+    std::string outputPath;
+    std::vector<std::unique_ptr<ThreadEventBuffer>> threadBuffers;
+
+    // The buffers of the threads that exited, which new threads record into, so threads that come
+    // and go don't each keep a buffer. Their events are kept until they are overwritten.
+    std::vector<ThreadEventBuffer *> freeBuffers;
+    uint32_t threadCount;
+    bool exitHandlerRegistered;
+};
+
+// Set while the recorder runs. The TRACE_EVENT macros read it through a plain pointer, so they only
+// take it as a hint: events recorded around a start or a stop may or may not be kept.
+std::atomic<unsigned char> gRecorderEnabled(0);
+static_assert(sizeof(gRecorderEnabled) == sizeof(unsigned char),
+              "The TRACE_EVENT macros read gRecorderEnabled as an unsigned char");
+
+ANGLE_THREAD_LOCAL ThreadEventBuffer *gCurrentThreadBuffer = nullptr;
+
+// Set once the thread gave its buffer back.
+ANGLE_THREAD_LOCAL bool gCurrentThreadExited = false;
+
+Recorder *GetRecorder()
+{
+    // Never destroyed, so threads still running at exit can keep recording.
+    static Recorder *recorder = new Recorder();
+    return recorder;
+}
+
+// Gives the buffer of the thread back to the recorder when the thread exits.
+#if defined(ANGLE_PLATFORM_WINDOWS)
+void NTAPI ReleaseThreadBuffer(void *buffer)
+#else
+void ReleaseThreadBuffer(void *buffer)
+#endif
+{
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    // Events recorded later in the exit of the thread are dropped.
+    gCurrentThreadExited = true;
+    gCurrentThreadBuffer = nullptr;
+
+    Recorder *recorder = GetRecorder();
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+    recorder->freeBuffers.push_back(static_cast<ThreadEventBuffer *>(buffer));
+}
+
+// Arranges for ReleaseThreadBuffer to be called when the current thread exits. The thread-local
+// variables can't have destructors, so this uses the platform's thread exit callbacks. Without
+// them, the buffers of exited threads aren't reused.
+void ReleaseBufferAtThreadExit(ThreadEventBuffer *buffer)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    static pthread_key_t key = []() {
+        pthread_key_t newKey;
+        int result = pthread_key_create(&newKey, ReleaseThreadBuffer);
+        ASSERT(result == 0);
+        return newKey;
+    }();
+    pthread_setspecific(key, buffer);
+#elif defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
+    static DWORD index = FlsAlloc(ReleaseThreadBuffer);
+    ASSERT(index != FLS_OUT_OF_INDEXES);
+    FlsSetValue(index, buffer);
+#endif
+}
+
+ThreadEventBuffer *GetCurrentThreadBuffer(Recorder *recorder)
+{
+    if (gCurrentThreadBuffer == nullptr && !gCurrentThreadExited)
+    {
+        ThreadEventBuffer *buffer = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(recorder->mutex);
+            if (!recorder->freeBuffers.empty())
+            {
+                buffer = recorder->freeBuffers.back();
+                recorder->freeBuffers.pop_back();
+            }
+            else
+            {
+                buffer = new ThreadEventBuffer();
+                recorder->threadBuffers.emplace_back(buffer);
+            }
+            buffer->threadID = ++recorder->threadCount;
+        }
+
+        ReleaseBufferAtThreadExit(buffer);
+        gCurrentThreadBuffer = buffer;
+    }
+    return gCurrentThreadBuffer;
+}
+
+void WriteJSONString(FILE *file, const char *string)
+{
+    fputc('"', file);
+    for (const char *c = string; *c != '\0'; ++c)
+    {
+        unsigned char character = static_cast<unsigned char>(*c);
+        if (character == '"' || character == '\\')
+        {
+            fputc('\\', file);
+            fputc(character, file);
+        }
+        else if (character < 0x20)
+        {
+            fprintf(file, "\\u%04x", character);
+        }
+        else
+        {
+            fputc(character, file);
+        }
+    }
+    fputc('"', file);
+}
+
+void WriteArgValue(FILE *file, unsigned char type, unsigned long long value)
+{
+    switch (type)
+    {
+        case kArgTypeBool:
+            fputs(value != 0 ? "true" : "false", file);
+            break;
+        case kArgTypeUInt:
+            fprintf(file, "%llu", value);
+            break;
+        case kArgTypeInt:
+            fprintf(file, "%lld", static_cast<long long>(value));
+            break;
+        case kArgTypeDouble:
+        {
+            double doubleValue = 0.0;
+            memcpy(&doubleValue, &value, sizeof(double));
+            if (std::isfinite(doubleValue))
+            {
+                fprintf(file, "%g", doubleValue);
+            }
+            else
+            {
+                fputs("null", file);
+            }
+            break;
+        }
+        case kArgTypePointer:
+            fprintf(file, "\"0x%llx\"", value);
+            break;
+        case kArgTypeString:
+            WriteJSONString(file, reinterpret_cast<const char *>(static_cast<uintptr_t>(value)));
+            break;
+        default:
+            fputs("null", file);
+            break;
+    }
+}
+
+void WriteEvent(FILE *file, const RecordedEvent &event)
+{
+    fputs("{\"name\":", file);
+    WriteJSONString(file, event.name != nullptr ? event.name : "(copied name)");
+    fprintf(file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u", event.phase, event.timestamp,
+            event.threadID);
+    if (event.phase == 'X')
+    {
+        fprintf(file, ",\"dur\":%.3f", event.duration);
+    }
+    if (event.hasID)
+    {
+        fprintf(file, ",\"id\":\"0x%llx\"", event.id);
+    }
+    if (event.phase == 'I')
+    {
+        // Instant events are scoped to their thread.
+        fputs(",\"s\":\"t\"", file);
+    }
+    if (event.numArgs > 0)
+    {
+        fputs(",\"args\":{", file);
+        for (unsigned char argIndex = 0; argIndex < event.numArgs; ++argIndex)
+        {
+            if (argIndex > 0)
+            {
+                fputc(',', file);
+            }
+            WriteJSONString(file, event.argNames[argIndex]);
+            fputc(':', file);
+            WriteArgValue(file, event.argTypes[argIndex], event.argValues[argIndex]);
+        }
+        fputc('}', file);
+    }
+    fputc('}', file);
+}
+
+// Times are in seconds since the recorder was created.
+void AppendEvent(char phase,
+                 const char *name,
+                 unsigned long long id,
+                 double timestamp,
+                 double duration,
+                 int numArgs,
+                 const char **argNames,
+                 const unsigned char *argTypes,
+                 const unsigned long long *argValues,
+                 unsigned char flags)
+{
+    ThreadEventBuffer *threadBuffer = GetCurrentThreadBuffer(GetRecorder());
+    if (threadBuffer == nullptr)
+    {
+        return;
+    }
+
+    RecordedEvent event = {};
+    event.timestamp = timestamp * 1000000.0;
+    event.duration  = duration * 1000000.0;
+    event.name      = (flags & kFlagCopy) != 0 ? nullptr : name;
+    event.id        = id;
+    event.hasID     = (flags & kFlagHasID) != 0;
+    event.phase     = phase;
+    event.threadID  = threadBuffer->threadID;
+    event.numArgs   = static_cast<unsigned char>(std::min(numArgs, kMaxEventArgs));
+    for (unsigned char argIndex = 0; argIndex < event.numArgs; ++argIndex)
+    {
+        event.argNames[argIndex]  = argNames[argIndex];
+        event.argTypes[argIndex]  = argTypes[argIndex];
+        event.argValues[argIndex] = argValues[argIndex];
+        if (argTypes[argIndex] == kArgTypeCopyString)
+        {
+            // The string is gone by the time the events are written.
+            event.argTypes[argIndex] = 0;
+        }
+    }
+
+    threadBuffer->writeEvent(event);
+}
+
+void FlushTraceRecorderAtExit()
+{
+    FlushTraceRecorder();
+}
+
+}  // anonymous namespace
+
+const unsigned char *GetTraceRecorderEnabledFlag()
+{
+    return reinterpret_cast<const unsigned char *>(&gRecorderEnabled);
+}
+
+void InitializeTraceRecorder(bool enable)
+{
+    Optional<std::string> outputPath = GetEnvironmentVar("ANGLE_TRACE_FILE");
+    if (outputPath.valid() && !outputPath.value().empty())
+    {
+        StartTraceRecorder(outputPath.value());
+    }
+    else if (enable)
+    {
+        StartTraceRecorder(kDefaultOutputPath);
+    }
+}
+
+void StartTraceRecorder(const std::string &outputPath)
+{
+    Recorder *recorder = GetRecorder();
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+
+    recorder->outputPath = outputPath;
+    if (!recorder->exitHandlerRegistered)
+    {
+        atexit(FlushTraceRecorderAtExit);
+        recorder->exitHandlerRegistered = true;
+    }
+    gRecorderEnabled.store(1, std::memory_order_relaxed);
+}
+
+void StopTraceRecorder()
+{
+    Recorder *recorder = GetRecorder();
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+
+    // The threads keep writing where they are, only the events before are dropped.
+    gRecorderEnabled.store(0, std::memory_order_relaxed);
+    for (auto &threadBuffer : recorder->threadBuffers)
+    {
+        threadBuffer->firstIndex = threadBuffer->writeCount.load(std::memory_order_acquire);
+    }
+}
+
+double GetTraceRecorderTime()
+{
+    Recorder *recorder                 = GetRecorder();
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - recorder->startTime;
+    return time.count();
+}
+
+void RecordTraceEvent(char phase,
+                      const char *name,
+                      unsigned long long id,
+                      int numArgs,
+                      const char **argNames,
+                      const unsigned char *argTypes,
+                      const unsigned long long *argValues,
+                      unsigned char flags)
+{
+    AppendEvent(phase, name, id, GetTraceRecorderTime(), 0.0, numArgs, argNames, argTypes,
+                argValues, flags);
+}
+
+void RecordCompleteTraceEvent(const char *name,
+                              double startTime,
+                              double duration,
+                              int numArgs,
+                              const char **argNames,
+                              const unsigned char *argTypes,
+                              const unsigned long long *argValues)
+{
+    AppendEvent('X', name, 0, startTime, duration, numArgs, argNames, argTypes, argValues, 0);
+}
+
+bool FlushTraceRecorder()
+{
+    Recorder *recorder = GetRecorder();
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+
+    if (gRecorderEnabled.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(recorder->outputPath.c_str(), "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    fputs("{\"traceEvents\":[", file);
+    bool firstEvent = true;
+    std::vector<RecordedEvent> events;
+    for (const auto &threadBuffer : recorder->threadBuffers)
+    {
+        threadBuffer->copyEvents(threadBuffer->firstIndex, &events);
+        for (const RecordedEvent &event : events)
+        {
+            fputs(firstEvent ? "\n" : ",\n", file);
+            WriteEvent(file, event);
+            firstEvent = false;
+        }
+    }
+    fputs("\n]}\n", file);
+
+    return fclose(file) == 0;
+}
+
+}  // namespace angle
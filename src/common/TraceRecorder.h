@@ -0,0 +1,71 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder.h:
+//   A built-in sink for the TRACE_EVENT macros, for builds where no embedder provides tracing
+//   through the platform methods. Each thread records into its own ring buffer without taking a
+//   lock, and the recorder writes the events out as Chrome about:tracing JSON.
+//
+
+#ifndef COMMON_TRACERECORDER_H_
+#define COMMON_TRACERECORDER_H_
+
+#include <stddef.h>
+
+#include <string>
+
+namespace angle
+{
+
+// The number of events each thread keeps. Older events are overwritten once it is full.
+constexpr size_t kTraceRecorderEventsPerThread = 32768;
+
+// Returns the flag the TRACE_EVENT macros test when the platform provides no trace categories.
+// It is set while the recorder runs. The macros read it without synchronization, only as a hint:
+// events recorded while the recorder starts or stops may or may not be kept.
+const unsigned char *GetTraceRecorderEnabledFlag();
+
+// Starts the recorder if |enable| is set or if the ANGLE_TRACE_FILE environment variable names
+// the output file, which otherwise defaults to angle_trace.json in the working directory.
+void InitializeTraceRecorder(bool enable);
+
+// Starts recording. If the recorder already runs, only the output file changes. The events are
+// written out when the process exits, or when FlushTraceRecorder is called.
+void StartTraceRecorder(const std::string &outputPath);
+
+// Stops recording and drops the events recorded so far.
+void StopTraceRecorder();
+
+// Records an event with the arguments of angle::PlatformMethods::addTraceEvent. Names and string
+// arguments must have static lifetime; copied strings are not kept.
+void RecordTraceEvent(char phase,
+                      const char *name,
+                      unsigned long long id,
+                      int numArgs,
+                      const char **argNames,
+                      const unsigned char *argTypes,
+                      const unsigned long long *argValues,
+                      unsigned char flags);
+
+// Returns the time the recorder stamps events with, in seconds since it was created.
+double GetTraceRecorderTime();
+
+// Records a complete event that started at |startTime|, a time returned by GetTraceRecorderTime,
+// and lasted |duration| seconds. Names follow the rules of RecordTraceEvent.
+void RecordCompleteTraceEvent(const char *name,
+                              double startTime,
+                              double duration,
+                              int numArgs,
+                              const char **argNames,
+                              const unsigned char *argTypes,
+                              const unsigned long long *argValues);
+
+// Writes the events every thread currently holds to the output file, replacing its contents. The
+// events stay recorded. Returns false if the recorder doesn't run or the file can't be written.
+bool FlushTraceRecorder();
+
+}  // namespace angle
+
+#endif  // COMMON_TRACERECORDER_H_
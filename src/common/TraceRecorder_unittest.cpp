@@ -0,0 +1,209 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder_unittest:
+//   Tests of the built-in trace event recorder.
+//
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "common/TraceRecorder.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr char kOutputPath[] = "angle_trace_recorder_unittest.json";
+
+class TraceRecorderTest : public testing::Test
+{
+  protected:
+    void SetUp() override { StartTraceRecorder(kOutputPath); }
+
+    void TearDown() override
+    {
+        StopTraceRecorder();
+        remove(kOutputPath);
+    }
+
+    static void RecordEvent(char phase, const char *name)
+    {
+        RecordTraceEvent(phase, name, 0, 0, nullptr, nullptr, nullptr, 0);
+    }
+
+    static std::string ReadOutput()
+    {
+        std::ifstream file(kOutputPath);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    static size_t CountOccurrences(const std::string &string, const std::string &pattern)
+    {
+        size_t count = 0;
+        for (size_t pos = string.find(pattern); pos != std::string::npos;
+             pos         = string.find(pattern, pos + pattern.size()))
+        {
+            ++count;
+        }
+        return count;
+    }
+};
+
+// The recorder enables the flag the TRACE_EVENT macros test, and disables it when stopped.
+TEST_F(TraceRecorderTest, EnabledFlag)
+{
+    EXPECT_NE(0u, *GetTraceRecorderEnabledFlag());
+    StopTraceRecorder();
+    EXPECT_EQ(0u, *GetTraceRecorderEnabledFlag());
+    EXPECT_FALSE(FlushTraceRecorder());
+}
+
+// Begin, end and instant events are written as about:tracing JSON, with their arguments.
+TEST_F(TraceRecorderTest, WritesEvents)
+{
+    const char *label                    = "a \"b\"";
+    const char *argNames[]               = {"count", "label"};
+    const unsigned char argTypes[]       = {2, 6};
+    const unsigned long long argValues[] = {42, reinterpret_cast<uintptr_t>(label)};
+
+    RecordEvent('B', "Outer");
+    RecordTraceEvent('I', "Instant", 0, 2, argNames, argTypes, argValues, 0);
+    RecordEvent('E', "Outer");
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    std::string output = ReadOutput();
+    EXPECT_EQ(0u, output.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, output.find("{\"name\":\"Outer\",\"ph\":\"B\""));
+    EXPECT_NE(std::string::npos, output.find("{\"name\":\"Outer\",\"ph\":\"E\""));
+    EXPECT_NE(std::string::npos, output.find("{\"name\":\"Instant\",\"ph\":\"I\""));
+    EXPECT_NE(std::string::npos, output.find("\"args\":{\"count\":42,\"label\":\"a \\\"b\\\"\"}"));
+    EXPECT_LT(output.find("\"ph\":\"B\""), output.find("\"ph\":\"E\""));
+
+    // Flushing keeps the events.
+    ASSERT_TRUE(FlushTraceRecorder());
+    EXPECT_EQ(output, ReadOutput());
+}
+
+// Complete events keep the start time and duration they were recorded with.
+TEST_F(TraceRecorderTest, WritesCompleteEvents)
+{
+    const char *argNames[]               = {"poolBytes"};
+    const unsigned char argTypes[]       = {2};
+    const unsigned long long argValues[] = {128};
+
+    double startTime = GetTraceRecorderTime();
+    RecordCompleteTraceEvent("Span", startTime, 0.0025, 1, argNames, argTypes, argValues);
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    std::string output = ReadOutput();
+    size_t spanPos     = output.find("{\"name\":\"Span\",\"ph\":\"X\"");
+    ASSERT_NE(std::string::npos, spanPos);
+    EXPECT_NE(std::string::npos, output.find("\"dur\":2500.000", spanPos));
+    EXPECT_NE(std::string::npos, output.find("\"args\":{\"poolBytes\":128}", spanPos));
+}
+
+// Each thread records into its own buffer and gets its own thread id.
+TEST_F(TraceRecorderTest, MultipleThreads)
+{
+    RecordEvent('I', "MainThread");
+    std::thread thread([]() { RecordEvent('I', "OtherThread"); });
+    thread.join();
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    std::string output = ReadOutput();
+    size_t mainPos     = output.find("\"MainThread\"");
+    size_t otherPos    = output.find("\"OtherThread\"");
+    ASSERT_NE(std::string::npos, mainPos);
+    ASSERT_NE(std::string::npos, otherPos);
+
+    std::string mainTID  = output.substr(output.find("\"tid\":", mainPos), 8);
+    std::string otherTID = output.substr(output.find("\"tid\":", otherPos), 8);
+    EXPECT_NE(mainTID, otherTID);
+}
+
+// Once a thread's buffer is full, its oldest events are overwritten.
+TEST_F(TraceRecorderTest, BufferWrapsAround)
+{
+    RecordEvent('I', "Oldest");
+    for (size_t eventIndex = 0; eventIndex < kTraceRecorderEventsPerThread; ++eventIndex)
+    {
+        RecordEvent('I', "Newer");
+    }
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    std::string output = ReadOutput();
+    EXPECT_EQ(std::string::npos, output.find("\"Oldest\""));
+    EXPECT_EQ(kTraceRecorderEventsPerThread, CountOccurrences(output, "\"Newer\""));
+}
+
+// Threads that exited give their buffer to the threads that come after them. The events of an
+// exited thread keep its thread id until they are overwritten.
+TEST_F(TraceRecorderTest, ExitedThreadBuffersAreReused)
+{
+    std::thread firstThread([]() { RecordEvent('I', "FirstThread"); });
+    firstThread.join();
+    std::thread secondThread([]() { RecordEvent('I', "SecondThread"); });
+    secondThread.join();
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    std::string output = ReadOutput();
+    size_t firstPos    = output.find("\"FirstThread\"");
+    size_t secondPos   = output.find("\"SecondThread\"");
+    ASSERT_NE(std::string::npos, firstPos);
+    ASSERT_NE(std::string::npos, secondPos);
+
+    std::string firstTID  = output.substr(output.find("\"tid\":", firstPos), 8);
+    std::string secondTID = output.substr(output.find("\"tid\":", secondPos), 8);
+    EXPECT_NE(firstTID, secondTID);
+}
+
+// Flushing and stopping while another thread records only loses the events being overwritten.
+TEST_F(TraceRecorderTest, FlushWhileRecording)
+{
+    std::atomic<bool> done(false);
+    std::thread thread([&done]() {
+        while (!done)
+        {
+            RecordEvent('I', "Concurrent");
+        }
+    });
+
+    for (int iteration = 0; iteration < 20; ++iteration)
+    {
+        EXPECT_TRUE(FlushTraceRecorder());
+        StopTraceRecorder();
+        StartTraceRecorder(kOutputPath);
+    }
+    done = true;
+    thread.join();
+
+    ASSERT_TRUE(FlushTraceRecorder());
+    EXPECT_EQ(0u, ReadOutput().find("{\"traceEvents\":["));
+}
+
+// Stopping drops the recorded events.
+TEST_F(TraceRecorderTest, StopDropsEvents)
+{
+    RecordEvent('I', "Dropped");
+    StopTraceRecorder();
+    StartTraceRecorder(kOutputPath);
+    ASSERT_TRUE(FlushTraceRecorder());
+
+    EXPECT_EQ(std::string::npos, ReadOutput().find("\"Dropped\""));
+}
+
+}  // anonymous namespace
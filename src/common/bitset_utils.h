@@ -13,6 +13,7 @@
 #include <stdint.h>
 
 #include <bitset>
+#include <limits>
 
 #include "common/angleutils.h"
 #include "common/debug.h"
@@ -440,6 +441,434 @@ template <size_t N>
 using BitSet64 = BitSetT<N, uint64_t>;
 #endif  // defined(ANGLE_X64_CPU)
 
+// A bitset of any size, stored as an array of words. Bitsets too wide for a single word use it
+// instead of IterableBitSet: the iterator scans each word with ScanForward instead of shifting the
+// whole std::bitset for every set bit, and the logical operations work a word at a time.
+template <size_t N>
+class BitSetArray final
+{
+  public:
+    // ScanForward for 64-bits requires a 64-bit implementation.
+#if defined(ANGLE_X64_CPU)
+    using WordT = uint64_t;
+#else
+    using WordT = uint32_t;
+#endif  // defined(ANGLE_X64_CPU)
+
+    class Reference final
+    {
+      public:
+        ~Reference() {}
+        Reference &operator=(bool x)
+        {
+            mParent->set(mBit, x);
+            return *this;
+        }
+        operator bool() const { return mParent->test(mBit); }
+
+      private:
+        friend class BitSetArray;
+
+        Reference(BitSetArray *parent, std::size_t bit) : mParent(parent), mBit(bit) {}
+
+        BitSetArray *mParent;
+        std::size_t mBit;
+    };
+
+    class Iterator final
+    {
+      public:
+        Iterator(const BitSetArray &bits, std::size_t wordIndex);
+        Iterator &operator++();
+
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+        std::size_t operator*() const { return mCurrentBit; }
+
+      private:
+        void scanForward();
+
+        BitSetArray mBitsCopy;
+        std::size_t mWordIndex;
+        WordT mCurrentWord;
+        std::size_t mCurrentBit;
+    };
+
+    BitSetArray();
+    ~BitSetArray();
+
+    BitSetArray(const BitSetArray &other);
+    BitSetArray &operator=(const BitSetArray &other);
+
+    bool operator==(const BitSetArray &other) const;
+    bool operator!=(const BitSetArray &other) const;
+
+    bool operator[](std::size_t pos) const { return test(pos); }
+    Reference operator[](std::size_t pos) { return Reference(this, pos); }
+
+    bool test(std::size_t pos) const;
+
+    bool all() const;
+    bool any() const;
+    bool none() const;
+    std::size_t count() const;
+
+    constexpr std::size_t size() const { return N; }
+
+    BitSetArray &operator&=(const BitSetArray &other);
+    BitSetArray &operator|=(const BitSetArray &other);
+    BitSetArray &operator^=(const BitSetArray &other);
+    BitSetArray operator~() const;
+
+    BitSetArray operator<<(std::size_t pos) const;
+    BitSetArray &operator<<=(std::size_t pos);
+    BitSetArray operator>>(std::size_t pos) const;
+    BitSetArray &operator>>=(std::size_t pos);
+
+    BitSetArray &set();
+    BitSetArray &set(std::size_t pos, bool value = true);
+
+    BitSetArray &reset();
+    BitSetArray &reset(std::size_t pos);
+
+    BitSetArray &flip();
+    BitSetArray &flip(std::size_t pos);
+
+    Iterator begin() const { return Iterator(*this, 0); }
+    Iterator end() const { return Iterator(*this, kWordCount); }
+
+  private:
+    static constexpr std::size_t kBitsPerWord = sizeof(WordT) * 8;
+    static constexpr std::size_t kWordCount   = (N + kBitsPerWord - 1) / kBitsPerWord;
+    static constexpr std::size_t kLastWordBitCount = N - (kWordCount - 1) * kBitsPerWord;
+
+    // The bits past N in the last word are always zero.
+    constexpr static WordT LastWordMask()
+    {
+        return (((static_cast<WordT>(1) << (kLastWordBitCount - 1)) - 1) << 1) | 1;
+    }
+    constexpr static WordT Bit(std::size_t x)
+    {
+        return (static_cast<WordT>(1) << (x % kBitsPerWord));
+    }
+
+    WordT mWords[kWordCount];
+};
+
+template <size_t N>
+BitSetArray<N>::BitSetArray()
+{
+    static_assert(N > 0, "Bitset type cannot support zero bits.");
+    reset();
+}
+
+template <size_t N>
+BitSetArray<N>::~BitSetArray()
+{
+}
+
+template <size_t N>
+BitSetArray<N>::BitSetArray(const BitSetArray &other)
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] = other.mWords[index];
+    }
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator=(const BitSetArray &other)
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] = other.mWords[index];
+    }
+    return *this;
+}
+
+template <size_t N>
+bool BitSetArray<N>::operator==(const BitSetArray &other) const
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        if (mWords[index] != other.mWords[index])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+bool BitSetArray<N>::operator!=(const BitSetArray &other) const
+{
+    return !(*this == other);
+}
+
+template <size_t N>
+bool BitSetArray<N>::test(std::size_t pos) const
+{
+    ASSERT(pos < N);
+    return (mWords[pos / kBitsPerWord] & Bit(pos)) != 0;
+}
+
+template <size_t N>
+bool BitSetArray<N>::all() const
+{
+    for (std::size_t index = 0; index + 1 < kWordCount; ++index)
+    {
+        if (mWords[index] != std::numeric_limits<WordT>::max())
+        {
+            return false;
+        }
+    }
+    return mWords[kWordCount - 1] == LastWordMask();
+}
+
+template <size_t N>
+bool BitSetArray<N>::any() const
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        if (mWords[index] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <size_t N>
+bool BitSetArray<N>::none() const
+{
+    return !any();
+}
+
+template <size_t N>
+std::size_t BitSetArray<N>::count() const
+{
+    std::size_t bitCount = 0;
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        bitCount += gl::BitCount(mWords[index]);
+    }
+    return bitCount;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator&=(const BitSetArray &other)
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] &= other.mWords[index];
+    }
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator|=(const BitSetArray &other)
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] |= other.mWords[index];
+    }
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator^=(const BitSetArray &other)
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] ^= other.mWords[index];
+    }
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> BitSetArray<N>::operator~() const
+{
+    BitSetArray<N> result(*this);
+    return result.flip();
+}
+
+template <size_t N>
+BitSetArray<N> BitSetArray<N>::operator<<(std::size_t pos) const
+{
+    BitSetArray<N> result(*this);
+    return (result <<= pos);
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator<<=(std::size_t pos)
+{
+    std::size_t wordShift = pos / kBitsPerWord;
+    std::size_t bitShift  = pos % kBitsPerWord;
+
+    for (std::size_t index = kWordCount; index > 0; --index)
+    {
+        std::size_t dest = index - 1;
+        WordT word       = 0;
+        if (dest >= wordShift)
+        {
+            std::size_t source = dest - wordShift;
+            word               = mWords[source] << bitShift;
+            if (bitShift > 0 && source > 0)
+            {
+                word |= mWords[source - 1] >> (kBitsPerWord - bitShift);
+            }
+        }
+        mWords[dest] = word;
+    }
+
+    mWords[kWordCount - 1] &= LastWordMask();
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> BitSetArray<N>::operator>>(std::size_t pos) const
+{
+    BitSetArray<N> result(*this);
+    return (result >>= pos);
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::operator>>=(std::size_t pos)
+{
+    std::size_t wordShift = pos / kBitsPerWord;
+    std::size_t bitShift  = pos % kBitsPerWord;
+
+    for (std::size_t dest = 0; dest < kWordCount; ++dest)
+    {
+        std::size_t source = dest + wordShift;
+        WordT word         = 0;
+        if (source < kWordCount)
+        {
+            word = mWords[source] >> bitShift;
+            if (bitShift > 0 && source + 1 < kWordCount)
+            {
+                word |= mWords[source + 1] << (kBitsPerWord - bitShift);
+            }
+        }
+        mWords[dest] = word;
+    }
+
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::set()
+{
+    for (std::size_t index = 0; index + 1 < kWordCount; ++index)
+    {
+        mWords[index] = std::numeric_limits<WordT>::max();
+    }
+    mWords[kWordCount - 1] = LastWordMask();
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::set(std::size_t pos, bool value)
+{
+    if (value)
+    {
+        ASSERT(pos < N);
+        mWords[pos / kBitsPerWord] |= Bit(pos);
+    }
+    else
+    {
+        reset(pos);
+    }
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::reset()
+{
+    for (std::size_t index = 0; index < kWordCount; ++index)
+    {
+        mWords[index] = 0;
+    }
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::reset(std::size_t pos)
+{
+    ASSERT(pos < N);
+    mWords[pos / kBitsPerWord] &= ~Bit(pos);
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::flip()
+{
+    for (std::size_t index = 0; index + 1 < kWordCount; ++index)
+    {
+        mWords[index] = ~mWords[index];
+    }
+    mWords[kWordCount - 1] ^= LastWordMask();
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N> &BitSetArray<N>::flip(std::size_t pos)
+{
+    ASSERT(pos < N);
+    mWords[pos / kBitsPerWord] ^= Bit(pos);
+    return *this;
+}
+
+template <size_t N>
+BitSetArray<N>::Iterator::Iterator(const BitSetArray &bits, std::size_t wordIndex)
+    : mBitsCopy(bits), mWordIndex(wordIndex), mCurrentWord(0), mCurrentBit(0)
+{
+    if (mWordIndex < kWordCount)
+    {
+        mCurrentWord = mBitsCopy.mWords[mWordIndex];
+        scanForward();
+    }
+}
+
+template <size_t N>
+typename BitSetArray<N>::Iterator &BitSetArray<N>::Iterator::operator++()
+{
+    ASSERT(mCurrentWord != 0);
+    // Clear the lowest set bit.
+    mCurrentWord &= mCurrentWord - 1;
+    scanForward();
+    return *this;
+}
+
+template <size_t N>
+bool BitSetArray<N>::Iterator::operator==(const Iterator &other) const
+{
+    return mWordIndex == other.mWordIndex && mCurrentWord == other.mCurrentWord;
+}
+
+template <size_t N>
+bool BitSetArray<N>::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+template <size_t N>
+void BitSetArray<N>::Iterator::scanForward()
+{
+    // Skip the empty words. The end iterator is past the last word, with no bits left.
+    while (mCurrentWord == 0)
+    {
+        if (++mWordIndex >= kWordCount)
+        {
+            mWordIndex = kWordCount;
+            return;
+        }
+        mCurrentWord = mBitsCopy.mWords[mWordIndex];
+    }
+
+    mCurrentBit = mWordIndex * kBitsPerWord + gl::ScanForward(mCurrentWord);
+}
+
 namespace priv
 {
 
@@ -449,7 +878,7 @@ using EnableIfBitsFit = typename std::enable_if<N <= sizeof(T) * 8>::type;
 template <size_t N, typename Enable = void>
 struct GetBitSet
 {
-    using Type = IterableBitSet<N>;
+    using Type = BitSetArray<N>;
 };
 
 // Prefer 64-bit bitsets on 64-bit CPUs. They seem faster than 32-bit.
@@ -495,4 +924,28 @@ inline angle::BitSetT<N, BitsT> operator^(const angle::BitSetT<N, BitsT> &lhs,
     return angle::BitSetT<N, BitsT>(lhs.bits() ^ rhs.bits());
 }
 
+template <size_t N>
+inline angle::BitSetArray<N> operator&(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return (result &= rhs);
+}
+
+template <size_t N>
+inline angle::BitSetArray<N> operator|(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return (result |= rhs);
+}
+
+template <size_t N>
+inline angle::BitSetArray<N> operator^(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return (result ^= rhs);
+}
+
 #endif  // COMMON_BITSETITERATOR_H_
@@ -9,6 +9,9 @@
 
 #include <gtest/gtest.h>
 
+#include <type_traits>
+#include <vector>
+
 #include "common/bitset_utils.h"
 
 using namespace angle;
@@ -109,4 +112,80 @@ TEST_F(BitSetIteratorTest, BitAssignment)
     }
 }
 
+// Bitsets wider than a word are stored as an array of words.
+TEST(BitSetArrayTest, WideBitSetType)
+{
+    static_assert(std::is_same<BitSet<100>, BitSetArray<100>>::value,
+                  "Wide bitsets should use BitSetArray");
+}
+
+// Test iterating set bits spread over several words.
+TEST(BitSetArrayTest, Iterator)
+{
+    BitSetArray<150> bits;
+    std::vector<size_t> originalValues = {0, 31, 32, 63, 64, 65, 100, 127, 128, 149};
+
+    for (size_t value : originalValues)
+    {
+        bits.set(value);
+    }
+    EXPECT_EQ(originalValues.size(), bits.count());
+
+    std::vector<size_t> readValues;
+    for (size_t bit : bits)
+    {
+        readValues.push_back(bit);
+    }
+    EXPECT_EQ(originalValues, readValues);
+
+    bits.reset();
+    for (size_t bit : bits)
+    {
+        ADD_FAILURE() << "Unexpected bit " << bit;
+    }
+}
+
+// Test the whole-set operations, which must not touch the bits past the size.
+TEST(BitSetArrayTest, WholeSetOperations)
+{
+    BitSetArray<100> bits;
+    EXPECT_TRUE(bits.none());
+    EXPECT_FALSE(bits.any());
+
+    bits.set();
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(100u, bits.count());
+
+    bits.reset(99);
+    EXPECT_FALSE(bits.all());
+    EXPECT_EQ(BitSetArray<100>().set(99), ~bits);
+
+    bits.flip();
+    EXPECT_EQ(1u, bits.count());
+    EXPECT_TRUE(bits[99]);
+
+    BitSetArray<100> otherBits;
+    otherBits.set(3);
+    otherBits.set(99);
+    EXPECT_EQ(bits, bits & otherBits);
+    EXPECT_EQ(otherBits, bits | otherBits);
+    EXPECT_EQ(BitSetArray<100>().set(3), bits ^ otherBits);
+}
+
+// Test shifting bits across word boundaries and out of the set.
+TEST(BitSetArrayTest, Shifts)
+{
+    BitSetArray<100> bits;
+    bits.set(1);
+    bits.set(60);
+
+    BitSetArray<100> shifted = bits << 10;
+    EXPECT_EQ(BitSetArray<100>().set(11).set(70), shifted);
+    EXPECT_EQ(bits, shifted >> 10);
+
+    EXPECT_EQ(BitSetArray<100>().set(61), bits << 60);
+    EXPECT_EQ(BitSetArray<100>().set(0), bits >> 60);
+    EXPECT_TRUE((bits << 99).none());
+}
+
 }  // anonymous namespace
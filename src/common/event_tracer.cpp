@@ -4,6 +4,7 @@
 
 #include "common/event_tracer.h"
 
+#include "common/TraceRecorder.h"
 #include "common/debug.h"
 
 namespace angle
@@ -21,8 +22,8 @@ const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
         return categoryEnabledFlag;
     }
 
-    static unsigned char disabled = 0;
-    return &disabled;
+    // Without embedder tracing, the events go to the built-in recorder while it runs.
+    return GetTraceRecorderEnabledFlag();
 }
 
 angle::TraceEventHandle AddTraceEvent(char phase,
@@ -35,6 +36,12 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+    if (categoryGroupEnabled == GetTraceRecorderEnabledFlag())
+    {
+        RecordTraceEvent(phase, name, id, numArgs, argNames, argTypes, argValues, flags);
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -52,4 +59,52 @@ angle::TraceEventHandle AddTraceEvent(char phase,
     return static_cast<angle::TraceEventHandle>(0);
 }
 
+double GetTraceTimestamp(const unsigned char *categoryGroupEnabled)
+{
+    if (categoryGroupEnabled == GetTraceRecorderEnabledFlag())
+    {
+        return GetTraceRecorderTime();
+    }
+
+    auto *platform = ANGLEPlatformCurrent();
+    ASSERT(platform);
+
+    return platform->monotonicallyIncreasingTime(platform);
+}
+
+void AddTraceSpan(const unsigned char *categoryGroupEnabled,
+                  const char *name,
+                  double startTime,
+                  double duration,
+                  int numArgs,
+                  const char **argNames,
+                  const unsigned char *argTypes,
+                  const unsigned long long *argValues)
+{
+    if (categoryGroupEnabled == GetTraceRecorderEnabledFlag())
+    {
+        RecordCompleteTraceEvent(name, startTime, duration, numArgs, argNames, argTypes,
+                                 argValues);
+        return;
+    }
+
+    auto *platform = ANGLEPlatformCurrent();
+    ASSERT(platform);
+
+    // Without a clock, the platform's time is always 0 and AddTraceEvent drops its events. The
+    // spans are dropped the same way. |startTime| can't tell: it usually adds an offset to a time
+    // read earlier, so it is not 0 even without a clock.
+    if (platform->monotonicallyIncreasingTime(platform) == 0)
+    {
+        return;
+    }
+
+    // Embedders can't be handed a duration, so the span is a begin/end pair with explicit
+    // timestamps.
+    platform->addTraceEvent(platform, 'B', categoryGroupEnabled, name, 0, startTime, numArgs,
+                            argNames, argTypes, argValues, 0);
+    platform->addTraceEvent(platform, 'E', categoryGroupEnabled, name, 0, startTime + duration, 0,
+                            nullptr, nullptr, nullptr, 0);
+}
+
 }  // namespace angle
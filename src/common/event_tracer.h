@@ -21,6 +21,22 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned char *argTypes,
                                       const unsigned long long *argValues,
                                       unsigned char flags);
+
+// Returns the current time of the clock that events of |categoryGroupEnabled| are stamped with, in
+// seconds.
+double GetTraceTimestamp(const unsigned char *categoryGroupEnabled);
+
+// Adds an event for work that was timed before it could be traced. It spans |duration| seconds
+// from |startTime|, which is a time of the GetTraceTimestamp clock. Like AddTraceEvent, it adds
+// nothing for an embedder whose platform has no clock, i.e. one that reads 0.
+void AddTraceSpan(const unsigned char *categoryGroupEnabled,
+                  const char *name,
+                  double startTime,
+                  double duration,
+                  int numArgs,
+                  const char **argNames,
+                  const unsigned char *argTypes,
+                  const unsigned long long *argValues);
 }
 
 #endif  // COMMON_EVENT_TRACER_H_
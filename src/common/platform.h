@@ -89,6 +89,17 @@
 #define ANGLE_USE_SSE
 #endif
 
+// Thread-local variables the code reads directly, without calling the platform TLS functions. The
+// initial-exec model needs the module to be loaded at startup or to fit in the static TLS space the
+// loader keeps for modules opened later, which a few pointers do.
+#if defined(_MSC_VER)
+#define ANGLE_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define ANGLE_THREAD_LOCAL __thread __attribute__((tls_model("initial-exec")))
+#else
+#define ANGLE_THREAD_LOCAL thread_local
+#endif
+
 // The MemoryBarrier function name collides with a macro under Windows
 // We will undef the macro so that the function name does not get replaced
 #undef MemoryBarrier
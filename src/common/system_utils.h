@@ -20,6 +20,7 @@ const char *GetExecutableDirectory();
 const char *GetSharedLibraryExtension();
 Optional<std::string> GetCWD();
 bool SetCWD(const char *dirName);
+Optional<std::string> GetEnvironmentVar(const char *variableName);
 
 }  // namespace angle
 
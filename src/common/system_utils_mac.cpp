@@ -86,4 +86,14 @@ bool SetCWD(const char *dirName)
     return (chdir(dirName) == 0);
 }
 
+Optional<std::string> GetEnvironmentVar(const char *variableName)
+{
+    const char *value = getenv(variableName);
+    if (value == nullptr)
+    {
+        return Optional<std::string>::Invalid();
+    }
+    return std::string(value);
+}
+
 }  // namespace angle
@@ -71,4 +71,21 @@ bool SetCWD(const char *dirName)
     return (SetCurrentDirectoryA(dirName) == TRUE);
 }
 
+Optional<std::string> GetEnvironmentVar(const char *variableName)
+{
+    DWORD valueSize = GetEnvironmentVariableA(variableName, nullptr, 0);
+    if (valueSize == 0)
+    {
+        return Optional<std::string>::Invalid();
+    }
+
+    std::vector<char> valueBuf(valueSize);
+    DWORD valueLen = GetEnvironmentVariableA(variableName, valueBuf.data(), valueSize);
+    if (valueLen == 0 || valueLen >= valueSize)
+    {
+        return Optional<std::string>::Invalid();
+    }
+    return std::string(valueBuf.data(), valueLen);
+}
+
 }  // namespace angle
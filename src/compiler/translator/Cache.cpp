@@ -31,6 +31,43 @@ class TScopedAllocator : angle::NonCopyable
     TPoolAllocator *mPreviousAllocator;
 };
 
+// Index of a basic type among the ones kept in TCache::mCommonTypes, or -1.
+int GetCommonBasicTypeIndex(TBasicType basicType)
+{
+    switch (basicType)
+    {
+        case EbtFloat:
+            return 0;
+        case EbtInt:
+            return 1;
+        case EbtUInt:
+            return 2;
+        case EbtBool:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+// Index of a qualifier among the ones kept in TCache::mCommonTypes, or -1.
+int GetCommonQualifierIndex(TQualifier qualifier)
+{
+    switch (qualifier)
+    {
+        case EvqTemporary:
+            return 0;
+        case EvqGlobal:
+            return 1;
+        case EvqConst:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
+const TBasicType kCommonBasicTypes[] = {EbtFloat, EbtInt, EbtUInt, EbtBool};
+const TQualifier kCommonQualifiers[] = {EvqTemporary, EvqGlobal, EvqConst};
+
 }  // namespace
 
 TCache::TypeKey::TypeKey(TBasicType basicType,
@@ -57,11 +94,51 @@ TCache::TypeKey::TypeKey(TBasicType basicType,
 
 TCache *TCache::sCache = nullptr;
 
+TCache::TCache() : mCommonTypes()
+{
+}
+
 void TCache::initialize()
 {
     if (sCache == nullptr)
     {
         sCache = new TCache();
+        sCache->initializeCommonTypes();
+    }
+}
+
+void TCache::initializeCommonTypes()
+{
+    static_assert(ArraySize(kCommonBasicTypes) == kCommonBasicTypeCount,
+                  "kCommonBasicTypes doesn't match mCommonTypes");
+    static_assert(ArraySize(kCommonQualifiers) == kCommonQualifierCount,
+                  "kCommonQualifiers doesn't match mCommonTypes");
+
+    for (TBasicType basicType : kCommonBasicTypes)
+    {
+        int basicTypeIndex = GetCommonBasicTypeIndex(basicType);
+        for (int precision = EbpUndefined; precision < EbpLast; ++precision)
+        {
+            for (TQualifier qualifier : kCommonQualifiers)
+            {
+                int qualifierIndex = GetCommonQualifierIndex(qualifier);
+                for (unsigned char primarySize = 1; primarySize <= 4; ++primarySize)
+                {
+                    // Only float has matrix types.
+                    unsigned char maxSecondarySize =
+                        (basicType == EbtFloat && primarySize > 1) ? 4 : 1;
+                    for (unsigned char secondarySize = 1; secondarySize <= maxSecondarySize;
+                         ++secondarySize)
+                    {
+                        const TType *&commonType =
+                            mCommonTypes[basicTypeIndex][precision][qualifierIndex]
+                                        [primarySize - 1][secondarySize - 1];
+                        commonType = getType(basicType, static_cast<TPrecision>(precision),
+                                             qualifier, primarySize, secondarySize);
+                    }
+                }
+            }
+        }
     }
 }
 
@@ -92,4 +169,27 @@ const TType *TCache::getType(TBasicType basicType,
     return type;
 }
 
+const TType *TCache::findType(const TType &type)
+{
+    if (sCache == nullptr || type.isArray() || type.getStruct() != nullptr ||
+        type.getInterfaceBlock() != nullptr || type.isInvariant() ||
+        !type.getLayoutQualifier().isEmpty() || !type.getMemoryQualifier().isEmpty())
+    {
+        return nullptr;
+    }
+
+    int basicTypeIndex = GetCommonBasicTypeIndex(type.getBasicType());
+    int qualifierIndex = GetCommonQualifierIndex(type.getQualifier());
+    int primarySize    = type.getNominalSize();
+    int secondarySize  = type.getSecondarySize();
+    if (basicTypeIndex < 0 || qualifierIndex < 0 || primarySize < 1 || primarySize > 4 ||
+        secondarySize < 1 || secondarySize > 4)
+    {
+        return nullptr;
+    }
+
+    return sCache->mCommonTypes[basicTypeIndex][type.getPrecision()][qualifierIndex]
+                               [primarySize - 1][secondarySize - 1];
+}
+
 }  // namespace sh
@@ -48,8 +48,16 @@ class TCache
                                 unsigned char primarySize,
                                 unsigned char secondarySize);
 
+    // Returns the shared instance of a scalar, vector or matrix type that carries nothing but a
+    // precision and a temporary, global or const qualifier, or nullptr for any other type. These
+    // are all created by initialize(), so this doesn't modify the cache and is safe to call from
+    // any thread.
+    static const TType *findType(const TType &type);
+
   private:
-    TCache() {}
+    TCache();
+
+    void initializeCommonTypes();
 
     union TypeKey {
         TypeKey(TBasicType basicType,
@@ -76,6 +84,11 @@ class TCache
     TypeMap mTypes;
     TPoolAllocator mAllocator;
 
+    // Indexed by basic type, precision, qualifier, primary and secondary size.
+    static constexpr size_t kCommonBasicTypeCount = 4;
+    static constexpr size_t kCommonQualifierCount = 3;
+    const TType *mCommonTypes[kCommonBasicTypeCount][EbpLast][kCommonQualifierCount][4][4];
+
     static TCache *sCache;
 };
 
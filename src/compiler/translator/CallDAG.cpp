@@ -16,111 +16,155 @@
 namespace sh
 {
 
-// The CallDAGCreator does all the processing required to create the CallDAG
-// structure so that the latter contains only the necessary variables.
-class CallDAG::CallDAGCreator : public TIntermTraverser
+namespace
 {
-  public:
-    CallDAGCreator(TDiagnostics *diagnostics)
-        : TIntermTraverser(true, false, true),
-          mDiagnostics(diagnostics),
-          mCurrentFunction(nullptr),
-          mCurrentIndex(0)
+
+// Per-function data used while sorting the call graph.
+struct SortedFunction
+{
+    SortedFunction()
+        : node(nullptr), name(nullptr), index(0), indexAssigned(false), visiting(false)
+    {
+    }
+
+    TIntermFunctionDefinition *node;
+    const TString *name;
+    std::vector<SortedFunction *> callees;
+    size_t index;
+    bool indexAssigned;
+    bool visiting;
+};
+
+// Recursively assigns indices to a sub DAG
+CallDAG::InitResult AssignIndices(SortedFunction *root,
+                                  size_t *currentIndex,
+                                  TDiagnostics *diagnostics)
+{
+    // Iterative implementation of the index assignment algorithm. A recursive version
+    // would be prettier but since the CallDAG creation runs before the limiting of the
+    // call depth, we might get stack overflows (computation of the call depth uses the
+    // CallDAG).
+
+    ASSERT(root);
+
+    if (root->indexAssigned)
     {
+        return CallDAG::INITDAG_SUCCESS;
     }
 
-    InitResult assignIndices()
+    // If we didn't have to detect recursion, functionsToProcess could be a simple queue
+    // in which we add the function being processed's callees. However in order to detect
+    // recursion we need to know which functions we are currently visiting. For that reason
+    // functionsToProcess will look like a concatenation of segments of the form
+    // [F visiting = true, subset of F callees with visiting = false] and the following
+    // segment (if any) will be start with a callee of F.
+    // This way we can remember when we started visiting a function, to put visiting back
+    // to false.
+    TVector<SortedFunction *> functionsToProcess;
+    functionsToProcess.push_back(root);
+
+    CallDAG::InitResult result = CallDAG::INITDAG_SUCCESS;
+
+    std::stringstream errorStream;
+
+    while (!functionsToProcess.empty())
     {
-        int skipped = 0;
-        for (auto &it : mFunctions)
+        SortedFunction *function = functionsToProcess.back();
+
+        if (function->visiting)
         {
-            // Skip unimplemented functions
-            if (it.second.node)
-            {
-                InitResult result = assignIndicesInternal(&it.second);
-                if (result != INITDAG_SUCCESS)
-                {
-                    return result;
-                }
-            }
-            else
-            {
-                skipped++;
-            }
+            function->visiting      = false;
+            function->index         = (*currentIndex)++;
+            function->indexAssigned = true;
+
+            functionsToProcess.pop_back();
+            continue;
         }
 
-        ASSERT(mFunctions.size() == mCurrentIndex + skipped);
-        return INITDAG_SUCCESS;
-    }
+        if (!function->node)
+        {
+            errorStream << "Undefined function '" << *function->name
+                        << ")' used in the following call chain:";
+            result = CallDAG::INITDAG_UNDEFINED;
+            break;
+        }
 
-    void fillDataStructures(std::vector<Record> *records, std::map<int, int> *idToIndex)
-    {
-        ASSERT(records->empty());
-        ASSERT(idToIndex->empty());
+        if (function->indexAssigned)
+        {
+            functionsToProcess.pop_back();
+            continue;
+        }
 
-        records->resize(mCurrentIndex);
+        function->visiting = true;
 
-        for (auto &it : mFunctions)
+        for (auto callee : function->callees)
         {
-            CreatorFunctionData &data = it.second;
-            // Skip unimplemented functions
-            if (!data.node)
+            functionsToProcess.push_back(callee);
+
+            // Check if the callee is already being visited after pushing it so that it appears
+            // in the chain printed in the info log.
+            if (callee->visiting)
             {
-                continue;
+                errorStream << "Recursive function call in the following call chain:";
+                result = CallDAG::INITDAG_RECURSION;
+                break;
             }
-            ASSERT(data.index < records->size());
-            Record &record = (*records)[data.index];
+        }
 
-            record.name = data.name.data();
-            record.node = data.node;
+        if (result != CallDAG::INITDAG_SUCCESS)
+        {
+            break;
+        }
+    }
 
-            record.callees.reserve(data.callees.size());
-            for (auto &callee : data.callees)
+    // The call chain is made of the function we were visiting when the error was detected.
+    if (result != CallDAG::INITDAG_SUCCESS)
+    {
+        bool first = true;
+        for (auto function : functionsToProcess)
+        {
+            if (function->visiting)
             {
-                record.callees.push_back(static_cast<int>(callee->index));
+                if (!first)
+                {
+                    errorStream << " -> ";
+                }
+                errorStream << *function->name << ")";
+                first = false;
             }
-
-            (*idToIndex)[data.node->getFunctionSymbolInfo()->getId().get()] =
-                static_cast<int>(data.index);
+        }
+        if (diagnostics)
+        {
+            std::string errorStr = errorStream.str();
+            diagnostics->globalError(errorStr.c_str());
         }
     }
 
-  private:
-    struct CreatorFunctionData
-    {
-        CreatorFunctionData() : node(nullptr), index(0), indexAssigned(false), visiting(false) {}
+    return result;
+}
+
+}  // anonymous namespace
 
-        std::set<CreatorFunctionData *> callees;
-        TIntermFunctionDefinition *node;
-        TString name;
-        size_t index;
-        bool indexAssigned;
-        bool visiting;
-    };
+// The CallGraphTraverser records the functions and calls found in a subtree into a CallGraph.
+class CallGraph::CallGraphTraverser : public TIntermTraverser
+{
+  public:
+    CallGraphTraverser(CallGraph *callGraph, int callDelta)
+        : TIntermTraverser(true, false, true), mCallGraph(callGraph), mCallDelta(callDelta)
+    {
+    }
 
+  private:
     bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
     {
-        // Create the record if need be and remember the node.
+        ASSERT(mCallDelta > 0);
         if (visit == PreVisit)
         {
-            auto it = mFunctions.find(node->getFunctionSymbolInfo()->getId().get());
-
-            if (it == mFunctions.end())
-            {
-                mCurrentFunction       = &mFunctions[node->getFunctionSymbolInfo()->getId().get()];
-                mCurrentFunction->name = node->getFunctionSymbolInfo()->getName();
-            }
-            else
-            {
-                mCurrentFunction = &it->second;
-                ASSERT(mCurrentFunction->name == node->getFunctionSymbolInfo()->getName());
-            }
-
-            mCurrentFunction->node = node;
+            mCallGraph->beginFunctionDefinition(*node->getFunctionSymbolInfo());
         }
         else if (visit == PostVisit)
         {
-            mCurrentFunction = nullptr;
+            mCallGraph->endFunctionDefinition(node);
         }
         return true;
     }
@@ -128,151 +172,136 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
     bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
     {
         ASSERT(visit == PreVisit);
-        if (mCurrentFunction != nullptr)
+        if (mCallGraph->mCurrentFunction == nullptr && mCallDelta > 0)
         {
-            return false;
+            mCallGraph->declareFunction(*node->getFunctionSymbolInfo());
         }
 
-        // Function declaration, create an empty record.
-        auto &record = mFunctions[node->getFunctionSymbolInfo()->getId().get()];
-        record.name  = node->getFunctionSymbolInfo()->getName();
-
         // No need to traverse the parameters.
         return false;
     }
 
-    // Aggregates the AST node for each function as well as the name of the functions called by it
     bool visitAggregate(Visit visit, TIntermAggregate *node) override
     {
         if (visit == PreVisit && node->getOp() == EOpCallFunctionInAST)
         {
-            // Function call, add the callees
-            auto it = mFunctions.find(node->getFunctionSymbolInfo()->getId().get());
-            ASSERT(it != mFunctions.end());
-
-            // We might be traversing the initializer of a global variable. Even though function
-            // calls in global scope are forbidden by the parser, some subsequent AST
-            // transformations can add them to emulate particular features.
-            if (mCurrentFunction)
+            if (mCallDelta > 0)
             {
-                mCurrentFunction->callees.insert(&it->second);
+                mCallGraph->addCall(*node->getFunctionSymbolInfo());
+            }
+            else
+            {
+                mCallGraph->removeCall(*node->getFunctionSymbolInfo());
             }
         }
         return true;
     }
 
-    // Recursively assigns indices to a sub DAG
-    InitResult assignIndicesInternal(CreatorFunctionData *root)
-    {
-        // Iterative implementation of the index assignment algorithm. A recursive version
-        // would be prettier but since the CallDAG creation runs before the limiting of the
-        // call depth, we might get stack overflows (computation of the call depth uses the
-        // CallDAG).
-
-        ASSERT(root);
-
-        if (root->indexAssigned)
-        {
-            return INITDAG_SUCCESS;
-        }
-
-        // If we didn't have to detect recursion, functionsToProcess could be a simple queue
-        // in which we add the function being processed's callees. However in order to detect
-        // recursion we need to know which functions we are currently visiting. For that reason
-        // functionsToProcess will look like a concatenation of segments of the form
-        // [F visiting = true, subset of F callees with visiting = false] and the following
-        // segment (if any) will be start with a callee of F.
-        // This way we can remember when we started visiting a function, to put visiting back
-        // to false.
-        TVector<CreatorFunctionData *> functionsToProcess;
-        functionsToProcess.push_back(root);
+    CallGraph *mCallGraph;
+    int mCallDelta;
+};
 
-        InitResult result = INITDAG_SUCCESS;
+// CallGraph
 
-        std::stringstream errorStream;
+CallGraph::CallGraph() : mCurrentFunction(nullptr)
+{
+}
 
-        while (!functionsToProcess.empty())
-        {
-            CreatorFunctionData *function = functionsToProcess.back();
+CallGraph::~CallGraph()
+{
+}
 
-            if (function->visiting)
-            {
-                function->visiting      = false;
-                function->index         = mCurrentIndex++;
-                function->indexAssigned = true;
+void CallGraph::declareFunction(const TFunctionSymbolInfo &function)
+{
+    FunctionData &data = mFunctions[function.getId().get()];
+    data.name          = function.getName();
+}
 
-                functionsToProcess.pop_back();
-                continue;
-            }
+void CallGraph::beginFunctionDefinition(const TFunctionSymbolInfo &function)
+{
+    ASSERT(mCurrentFunction == nullptr);
+    mCurrentFunction       = &mFunctions[function.getId().get()];
+    mCurrentFunction->name = function.getName();
+}
 
-            if (!function->node)
-            {
-                errorStream << "Undefined function '" << function->name
-                            << ")' used in the following call chain:";
-                result = INITDAG_UNDEFINED;
-                break;
-            }
+void CallGraph::endFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    ASSERT(mCurrentFunction != nullptr);
+    ASSERT(mCurrentFunction == &mFunctions[node->getFunctionSymbolInfo()->getId().get()]);
+    mCurrentFunction->node = node;
+    mCurrentFunction       = nullptr;
+}
 
-            if (function->indexAssigned)
-            {
-                functionsToProcess.pop_back();
-                continue;
-            }
+void CallGraph::addCall(const TFunctionSymbolInfo &callee)
+{
+    // We might be looking at the initializer of a global variable. Even though function calls in
+    // global scope are forbidden by the parser, some subsequent AST transformations can add them
+    // to emulate particular features.
+    if (mCurrentFunction)
+    {
+        ASSERT(mFunctions.count(callee.getId().get()) > 0);
+        ++mCurrentFunction->callees[callee.getId().get()];
+    }
+}
 
-            function->visiting = true;
+void CallGraph::removeCall(const TFunctionSymbolInfo &callee)
+{
+    if (mCurrentFunction)
+    {
+        auto it = mCurrentFunction->callees.find(callee.getId().get());
+        ASSERT(it != mCurrentFunction->callees.end() && it->second > 0);
+        if (--it->second == 0)
+        {
+            mCurrentFunction->callees.erase(it);
+        }
+    }
+}
 
-            for (auto callee : function->callees)
-            {
-                functionsToProcess.push_back(callee);
+void CallGraph::removeCalls(TIntermNode *subtree)
+{
+    if (subtree != nullptr)
+    {
+        CallGraphTraverser traverser(this, -1);
+        subtree->traverse(&traverser);
+    }
+}
 
-                // Check if the callee is already being visited after pushing it so that it appears
-                // in the chain printed in the info log.
-                if (callee->visiting)
-                {
-                    errorStream << "Recursive function call in the following call chain:";
-                    result = INITDAG_RECURSION;
-                    break;
-                }
-            }
+void CallGraph::addFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    CallGraphTraverser traverser(this, 1);
+    node->traverse(&traverser);
+}
 
-            if (result != INITDAG_SUCCESS)
-            {
-                break;
-            }
-        }
+void CallGraph::addFunctions(TIntermNode *root)
+{
+    CallGraphTraverser traverser(this, 1);
+    root->traverse(&traverser);
+}
 
-        // The call chain is made of the function we were visiting when the error was detected.
-        if (result != INITDAG_SUCCESS)
-        {
-            bool first = true;
-            for (auto function : functionsToProcess)
-            {
-                if (function->visiting)
-                {
-                    if (!first)
-                    {
-                        errorStream << " -> ";
-                    }
-                    errorStream << function->name << ")";
-                    first = false;
-                }
-            }
-            if (mDiagnostics)
-            {
-                std::string errorStr = errorStream.str();
-                mDiagnostics->globalError(errorStr.c_str());
-            }
-        }
+void CallGraph::addCall(const TFunctionSymbolInfo &caller, const TFunctionSymbolInfo &callee)
+{
+    ASSERT(mCurrentFunction == nullptr);
+    ASSERT(mFunctions.count(caller.getId().get()) > 0);
+    declareFunction(callee);
+    ++mFunctions[caller.getId().get()].callees[callee.getId().get()];
+}
 
-        return result;
+void CallGraph::removeFunction(const TFunctionSymbolInfo &function)
+{
+    int id = function.getId().get();
+    ASSERT(mCurrentFunction == nullptr);
+    mFunctions.erase(id);
+    for (auto &it : mFunctions)
+    {
+        it.second.callees.erase(id);
     }
+}
 
-    TDiagnostics *mDiagnostics;
-
-    std::map<int, CreatorFunctionData> mFunctions;
-    CreatorFunctionData *mCurrentFunction;
-    size_t mCurrentIndex;
-};
+void CallGraph::clear()
+{
+    mFunctions.clear();
+    mCurrentFunction = nullptr;
+}
 
 // CallDAG
 
@@ -324,21 +353,72 @@ void CallDAG::clear()
     mFunctionIdToIndex.clear();
 }
 
-CallDAG::InitResult CallDAG::init(TIntermNode *root, TDiagnostics *diagnostics)
+CallDAG::InitResult CallDAG::init(const CallGraph &callGraph, TDiagnostics *diagnostics)
 {
-    CallDAGCreator creator(diagnostics);
+    ASSERT(mRecords.empty());
+    ASSERT(mFunctionIdToIndex.empty());
 
-    // Creates the mapping of functions to callees
-    root->traverse(&creator);
+    std::vector<SortedFunction> functions(callGraph.mFunctions.size());
+    std::map<int, SortedFunction *> functionsById;
+    {
+        size_t position = 0;
+        for (const auto &it : callGraph.mFunctions)
+        {
+            functions[position].node = it.second.node;
+            functions[position].name = &it.second.name;
+            functionsById[it.first]  = &functions[position];
+            ++position;
+        }
+    }
+    for (const auto &it : callGraph.mFunctions)
+    {
+        SortedFunction *function = functionsById[it.first];
+        function->callees.reserve(it.second.callees.size());
+        for (const auto &callee : it.second.callees)
+        {
+            ASSERT(functionsById.count(callee.first) > 0);
+            function->callees.push_back(functionsById[callee.first]);
+        }
+    }
 
     // Does the topological sort and detects recursions
-    InitResult result = creator.assignIndices();
-    if (result != INITDAG_SUCCESS)
+    size_t currentIndex = 0;
+    for (SortedFunction &function : functions)
     {
-        return result;
+        // Skip unimplemented functions
+        if (function.node)
+        {
+            InitResult result = AssignIndices(&function, &currentIndex, diagnostics);
+            if (result != INITDAG_SUCCESS)
+            {
+                return result;
+            }
+        }
     }
 
-    creator.fillDataStructures(&mRecords, &mFunctionIdToIndex);
+    mRecords.resize(currentIndex);
+    for (const SortedFunction &function : functions)
+    {
+        // Skip unimplemented functions
+        if (!function.node)
+        {
+            continue;
+        }
+        ASSERT(function.index < mRecords.size());
+        Record &record = mRecords[function.index];
+
+        record.name = function.name->data();
+        record.node = function.node;
+
+        record.callees.reserve(function.callees.size());
+        for (const SortedFunction *callee : function.callees)
+        {
+            record.callees.push_back(static_cast<int>(callee->index));
+        }
+
+        mFunctionIdToIndex[function.node->getFunctionSymbolInfo()->getId().get()] =
+            static_cast<int>(function.index);
+    }
     return INITDAG_SUCCESS;
 }
 
@@ -19,6 +19,61 @@
 namespace sh
 {
 
+// Gathers the functions of a shader and the calls between them so that the CallDAG can be created
+// without traversing the AST. TParseContext records into it as function calls are resolved, and
+// AST transformations that add or remove functions keep it up to date the same way.
+class CallGraph : angle::NonCopyable
+{
+  public:
+    CallGraph();
+    ~CallGraph();
+
+    // Registers a function that is declared by a prototype.
+    void declareFunction(const TFunctionSymbolInfo &function);
+
+    // Calls recorded between these two belong to the body of the function being defined. Calls
+    // recorded outside of a function definition, for example in global initializers, are ignored.
+    void beginFunctionDefinition(const TFunctionSymbolInfo &function);
+    void endFunctionDefinition(TIntermFunctionDefinition *node);
+    void addCall(const TFunctionSymbolInfo &callee);
+
+    // Forgets the calls made in a subtree of the function being defined that was dropped from the
+    // AST, like the untaken branch of an if statement with a constant condition.
+    void removeCalls(TIntermNode *subtree);
+
+    // Adds a whole function definition, recording the calls in its body.
+    void addFunctionDefinition(TIntermFunctionDefinition *node);
+    // Adds every function declared or defined in a tree.
+    void addFunctions(TIntermNode *root);
+    // Records a call that a transformation added to the body of an already defined function. The
+    // callee may be defined later.
+    void addCall(const TFunctionSymbolInfo &caller, const TFunctionSymbolInfo &callee);
+    // Removes a function along with all the calls to it.
+    void removeFunction(const TFunctionSymbolInfo &function);
+
+    void clear();
+
+  private:
+    friend class CallDAG;
+
+    struct FunctionData
+    {
+        FunctionData() : node(nullptr) {}
+
+        TIntermFunctionDefinition *node;
+        TString name;
+        // Maps the id of each callee to the number of call sites.
+        std::map<int, unsigned int> callees;
+    };
+
+    void removeCall(const TFunctionSymbolInfo &callee);
+
+    std::map<int, FunctionData> mFunctions;
+    FunctionData *mCurrentFunction;
+
+    class CallGraphTraverser;
+};
+
 // The translator needs to analyze the the graph of the function calls
 // to run checks and analyses; since in GLSL recursion is not allowed
 // that graph is a DAG.
@@ -54,9 +109,9 @@ class CallDAG : angle::NonCopyable
         INITDAG_UNDEFINED,
     };
 
-    // Returns INITDAG_SUCCESS if it was able to create the DAG, otherwise prints
-    // the initialization error in diagnostics, if present.
-    InitResult init(TIntermNode *root, TDiagnostics *diagnostics);
+    // Returns INITDAG_SUCCESS if it was able to create the DAG from the call graph, otherwise
+    // prints the initialization error in diagnostics, if present.
+    InitResult init(const CallGraph &callGraph, TDiagnostics *diagnostics);
 
     // Returns InvalidIndex if the function wasn't found
     size_t findIndex(const TFunctionSymbolInfo *functionInfo) const;
@@ -71,8 +126,6 @@ class CallDAG : angle::NonCopyable
   private:
     std::vector<Record> mRecords;
     std::map<int, int> mFunctionIdToIndex;
-
-    class CallDAGCreator;
 };
 
 }  // namespace sh
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <chrono>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -155,6 +156,47 @@ class TScopedPoolAllocator
     TPoolAllocator *mAllocator;
 };
 
+// Records the wall time and pool allocations of a compile stage when statistics are collected.
+class TScopedCompileStage
+{
+  public:
+    TScopedCompileStage(std::vector<ShCompileStageStatistics> *statistics,
+                        const std::chrono::steady_clock::time_point &compileStart,
+                        const char *name)
+        : mStatistics(statistics), mCompileStart(compileStart), mName(name)
+    {
+        if (mStatistics)
+        {
+            mPoolStart = GetGlobalPoolAllocator()->getStatistics();
+            mStart     = std::chrono::steady_clock::now();
+        }
+    }
+    ~TScopedCompileStage()
+    {
+        if (mStatistics)
+        {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStart;
+            std::chrono::duration<double> start   = mStart - mCompileStart;
+            TPoolAllocator::Statistics poolEnd    = GetGlobalPoolAllocator()->getStatistics();
+
+            ShCompileStageStatistics stage;
+            stage.name            = mName;
+            stage.startSeconds    = start.count();
+            stage.seconds         = elapsed.count();
+            stage.poolBytes       = poolEnd.bytesAllocated - mPoolStart.bytesAllocated;
+            stage.poolAllocations = poolEnd.numAllocations - mPoolStart.numAllocations;
+            mStatistics->push_back(stage);
+        }
+    }
+
+  private:
+    std::vector<ShCompileStageStatistics> *mStatistics;
+    const std::chrono::steady_clock::time_point &mCompileStart;
+    const char *mName;
+    std::chrono::steady_clock::time_point mStart;
+    TPoolAllocator::Statistics mPoolStart;
+};
+
 class TScopedSymbolTableLevel
 {
   public:
@@ -173,6 +215,21 @@ class TScopedSymbolTableLevel
     TSymbolTable *mTable;
 };
 
+// Estimates the length of the translated code from the length of the source. Output keeps most of
+// the source tokens and adds declarations and emulated built-ins on top, so reserving this much
+// up front avoids repeatedly growing the object code sink while emitting.
+size_t EstimateObjectCodeLength(const char *const shaderStrings[], size_t numStrings)
+{
+    constexpr size_t kObjectCodeOverhead = 4096;
+
+    size_t sourceLength = 0;
+    for (size_t i = 0; i < numStrings; ++i)
+    {
+        sourceLength += strlen(shaderStrings[i]);
+    }
+    return sourceLength + sourceLength / 2 + kObjectCodeOverhead;
+}
+
 int MapSpecToShaderVersion(ShShaderSpec spec)
 {
     switch (spec)
@@ -268,6 +325,7 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
                                                size_t numStrings,
                                                ShCompileOptions compileOptions)
 {
+    mCompileStartTime = std::chrono::steady_clock::now();
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
@@ -280,6 +338,9 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
 
+    std::vector<ShCompileStageStatistics> *statistics =
+        (compileOptions & SH_COLLECT_COMPILE_STATISTICS) ? &mCompileStatistics : nullptr;
+
     // Reset the extension behavior for each compilation unit.
     ResetExtensionBehavior(extensionBehavior);
 
@@ -291,8 +352,9 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         ++firstSource;
     }
 
+    mCallGraph.clear();
     TParseContext parseContext(symbolTable, extensionBehavior, shaderType, shaderSpec,
-                               compileOptions, true, &mDiagnostics, getResources());
+                               compileOptions, true, &mDiagnostics, &mCallGraph, getResources());
 
     parseContext.setFragmentPrecisionHighOnESSL1(fragmentPrecisionHigh);
 
@@ -300,10 +362,14 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     // Start pushing the user-defined symbols at global level.
     TScopedSymbolTableLevel scopedSymbolLevel(&symbolTable);
 
-    // Parse shader.
-    bool success = (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                                   &parseContext) == 0) &&
-                   (parseContext.getTreeRoot() != nullptr);
+    // Parse shader. Preprocessing is done on demand by the lexer, so it is accounted here too.
+    bool success = false;
+    {
+        TScopedCompileStage stage(statistics, mCompileStartTime, "Parse");
+        success = (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
+                                  &parseContext) == 0) &&
+                  (parseContext.getTreeRoot() != nullptr);
+    }
 
     shaderVersion = parseContext.getShaderVersion();
     if (success && MapSpecToShaderVersion(shaderSpec) < shaderVersion)
@@ -340,43 +406,69 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         // Disallow expressions deemed too complex.
         if (success && (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "LimitExpressionComplexity");
             success = limitExpressionComplexity(root);
+        }
 
-        // Create the function DAG and check there is no recursion
+        // Create the function DAG from the calls recorded during parsing and check there is no
+        // recursion
         if (success)
-            success = initCallDag(root);
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "InitCallDag");
+            success = initCallDag();
+        }
 
         if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "CheckCallDepth");
             success = checkCallDepth();
+        }
 
         // Checks which functions are used and if "main" exists
         if (success)
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "TagUsedFunctions");
             functionMetadata.clear();
             functionMetadata.resize(mCallDag.size());
             success = tagUsedFunctions();
         }
 
         if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "PruneUnusedFunctions");
             success = pruneUnusedFunctions(root);
+        }
 
         // Prune empty declarations to work around driver bugs and to keep declaration output
         // simple.
         if (success)
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "PruneEmptyDeclarations");
             PruneEmptyDeclarations(root);
+        }
 
         if (success && shaderVersion >= 300 && shaderType == GL_FRAGMENT_SHADER)
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "ValidateOutputs");
             success = validateOutputs(root);
+        }
 
         if (success && shouldRunLoopAndIndexingValidation(compileOptions))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "ValidateLimitations");
             success =
                 ValidateLimitations(root, shaderType, symbolTable, shaderVersion, &mDiagnostics);
+        }
 
         bool multiview2 = IsExtensionEnabled(extensionBehavior, "GL_OVR_multiview2");
         if (success && compileResources.OVR_multiview && IsWebGLBasedSpec(shaderSpec) &&
             (IsExtensionEnabled(extensionBehavior, "GL_OVR_multiview") || multiview2))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "ValidateMultiviewWebGL");
             success = ValidateMultiviewWebGL(root, shaderType, symbolTable, shaderVersion,
                                              multiview2, &mDiagnostics);
+        }
 
         // Fail compilation if precision emulation not supported.
         if (success && getResources().WEBGL_debug_shader_precision &&
@@ -392,6 +484,7 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         // Built-in function emulation needs to happen after validateLimitations pass.
         if (success)
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "BuiltInFunctionEmulator");
             // TODO(jmadill): Remove global pool allocator.
             GetGlobalPoolAllocator()->lock();
             initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
@@ -401,23 +494,36 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         // Clamping uniform array bounds needs to happen after validateLimitations pass.
         if (success && (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "ArrayBoundsClamper");
             arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
+        }
 
         // gl_Position is always written in compatibility output mode
         if (success && shaderType == GL_VERTEX_SHADER &&
             ((compileOptions & SH_INIT_GL_POSITION) ||
              (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "InitializeGLPosition");
             initializeGLPosition(root);
+        }
 
         // This pass might emit short circuits so keep it before the short circuit unfolding
         if (success && (compileOptions & SH_REWRITE_DO_WHILE_LOOPS))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "RewriteDoWhile");
             RewriteDoWhile(root, getTemporaryIndex());
+        }
 
         if (success && (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "AddAndTrueToLoopCondition");
             sh::AddAndTrueToLoopCondition(root);
+        }
 
         if (success && (compileOptions & SH_UNFOLD_SHORT_CIRCUIT))
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "UnfoldShortCircuitAST");
             UnfoldShortCircuitAST unfoldShortCircuit;
             root->traverse(&unfoldShortCircuit);
             unfoldShortCircuit.updateTree();
@@ -425,18 +531,25 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         if (success && (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT))
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "RemovePow");
             RemovePow(root);
         }
 
         if (success && shouldCollectVariables(compileOptions))
         {
-            collectVariables(root);
+            {
+                TScopedCompileStage stage(statistics, mCompileStartTime, "CollectVariables");
+                collectVariables(root);
+            }
             if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
             {
+                TScopedCompileStage stage(statistics, mCompileStartTime, "UseInterfaceBlockFields");
                 useAllMembersInUnusedStandardAndSharedBlocks(root);
             }
             if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
             {
+                TScopedCompileStage stage(statistics, mCompileStartTime,
+                                          "EnforcePackingRestrictions");
                 success = enforcePackingRestrictions();
                 if (!success)
                 {
@@ -445,6 +558,8 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             }
             if (success && (compileOptions & SH_INIT_OUTPUT_VARIABLES))
             {
+                TScopedCompileStage stage(statistics, mCompileStartTime,
+                                          "InitializeOutputVariables");
                 initializeOutputVariables(root);
             }
         }
@@ -452,16 +567,22 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         // Removing invariant declarations must be done after collecting variables.
         // Otherwise, built-in invariant declarations don't apply.
         if (success && RemoveInvariant(shaderType, shaderVersion, outputType, compileOptions))
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "RemoveInvariantDeclaration");
             sh::RemoveInvariantDeclaration(root);
+        }
 
         if (success && (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS))
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime,
+                                      "ScalarizeVecAndMatConstructorArgs");
             ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh,
                                               &mTemporaryIndex);
         }
 
         if (success && (compileOptions & SH_REGENERATE_STRUCT_NAMES))
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "RegenerateStructNames");
             RegenerateStructNames gen(symbolTable, shaderVersion);
             root->traverse(&gen);
         }
@@ -470,16 +591,20 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
             IsExtensionEnabled(extensionBehavior, "GL_EXT_draw_buffers"))
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "EmulateGLFragColorBroadcast");
             EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables);
         }
 
         if (success)
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "DeferGlobalInitializers");
             DeferGlobalInitializers(root, needToInitializeGlobalsInAST());
         }
 
         if (success && (compileOptions & SH_INITIALIZE_UNINITIALIZED_LOCALS) && getOutputType())
         {
+            TScopedCompileStage stage(statistics, mCompileStartTime,
+                                      "InitializeUninitializedLocals");
             // Initialize uninitialized local variables.
             // In some cases initializing can generate extra statements in the parent block, such as
             // when initializing nameless structs or initializing arrays in ESSL 1.00. In that case
@@ -528,16 +653,29 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
 
+    mCompileStatistics.clear();
+    std::vector<ShCompileStageStatistics> *statistics =
+        (compileOptions & SH_COLLECT_COMPILE_STATISTICS) ? &mCompileStatistics : nullptr;
+
     TScopedPoolAllocator scopedAlloc(&allocator);
+    mCompileStartTime = std::chrono::steady_clock::now();
+    TScopedCompileStage totalStage(statistics, mCompileStartTime, "Total");
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
     {
         if (compileOptions & SH_INTERMEDIATE_TREE)
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "OutputTree");
             TIntermediate::outputTree(root, infoSink.info);
+        }
 
         if (compileOptions & SH_OBJECT_CODE)
+        {
+            TScopedCompileStage stage(statistics, mCompileStartTime, "Translate");
+            infoSink.obj.reserve(EstimateObjectCodeLength(shaderStrings, numStrings));
             translate(root, compileOptions);
+        }
 
         // The IntermNode tree doesn't need to be deleted here, since the
         // memory will be freed in a big chunk by the PoolAllocator.
@@ -707,11 +845,11 @@ void TCompiler::clearResults()
     mTemporaryIndex = 0;
 }
 
-bool TCompiler::initCallDag(TIntermNode *root)
+bool TCompiler::initCallDag()
 {
     mCallDag.clear();
 
-    switch (mCallDag.init(root, &mDiagnostics))
+    switch (mCallDag.init(mCallGraph, &mDiagnostics))
     {
         case CallDAG::INITDAG_SUCCESS:
             return true;
@@ -782,32 +920,37 @@ bool TCompiler::checkCallDepth()
 bool TCompiler::tagUsedFunctions()
 {
     // Search from main, starting from the end of the DAG as it usually is the root.
+    size_t mainIndex = CallDAG::InvalidIndex;
     for (size_t i = mCallDag.size(); i-- > 0;)
     {
         if (mCallDag.getRecordFromIndex(i).name == "main")
         {
-            internalTagUsedFunction(i);
-            return true;
+            mainIndex = i;
+            break;
         }
     }
 
-    mDiagnostics.globalError("Missing main()");
-    return false;
-}
-
-void TCompiler::internalTagUsedFunction(size_t index)
-{
-    if (functionMetadata[index].used)
+    if (mainIndex == CallDAG::InvalidIndex)
     {
-        return;
+        mDiagnostics.globalError("Missing main()");
+        return false;
     }
 
-    functionMetadata[index].used = true;
-
-    for (int calleeIndex : mCallDag.getRecordFromIndex(index).callees)
+    // Callees always have a smaller index than their callers, so a single sweep down from main
+    // reaches every function that is used.
+    functionMetadata[mainIndex].used = true;
+    for (size_t i = mainIndex + 1; i-- > 0;)
     {
-        internalTagUsedFunction(calleeIndex);
+        if (functionMetadata[i].used)
+        {
+            for (int calleeIndex : mCallDag.getRecordFromIndex(i).callees)
+            {
+                functionMetadata[calleeIndex].used = true;
+            }
+        }
     }
+
+    return true;
 }
 
 // A predicate for the stl that returns if a top-level node is unused
@@ -867,6 +1010,17 @@ bool TCompiler::pruneUnusedFunctions(TIntermBlock *root)
                         sequence->end());
     }
 
+    // Callers of an unused function are unused themselves, so dropping the pruned functions leaves
+    // the call graph consistent with the tree.
+    for (size_t i = 0; i < mCallDag.size(); ++i)
+    {
+        if (!functionMetadata[i].used)
+        {
+            const CallDAG::Record &record = mCallDag.getRecordFromIndex(i);
+            mCallGraph.removeFunction(*record.node->getFunctionSymbolInfo());
+        }
+    }
+
     return true;
 }
 
@@ -14,6 +14,8 @@
 // This should not be included by driver code.
 //
 
+#include <chrono>
+
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/Diagnostics.h"
@@ -66,6 +68,8 @@ class TShHandleBase
     virtual TranslatorHLSL *getAsTranslatorHLSL() { return 0; }
 #endif  // ANGLE_ENABLE_HLSL
 
+    TPoolAllocator &getPoolAllocator() { return allocator; }
+
   protected:
     // Memory allocator. Allocates and tracks memory required by the compiler.
     // Deallocates all memory when compiler is destructed.
@@ -103,6 +107,10 @@ class TCompiler : public TShHandleBase
     bool isComputeShaderLocalSizeDeclared() const { return mComputeShaderLocalSizeDeclared; }
     const sh::WorkGroupSize &getComputeShaderLocalSize() const { return mComputeShaderLocalSize; }
     int getNumViews() const { return mNumViews; }
+    const std::vector<ShCompileStageStatistics> &getCompileStatistics() const
+    {
+        return mCompileStatistics;
+    }
 
     // Clears the results from the previous compilation.
     void clearResults();
@@ -163,6 +171,9 @@ class TCompiler : public TShHandleBase
     const TPragma &getPragma() const { return mPragma; }
     void writePragma(ShCompileOptions compileOptions);
     unsigned int *getTemporaryIndex() { return &mTemporaryIndex; }
+    // The functions of the shader being compiled and the calls between them. Transformations that
+    // add or remove functions must keep it up to date.
+    CallGraph *getCallGraph() { return &mCallGraph; }
     // Relies on collectVariables having been called.
     bool isVaryingDefined(const char *varyingName);
 
@@ -184,10 +195,9 @@ class TCompiler : public TShHandleBase
 
   private:
     // Creates the function call DAG for further analysis, returning false if there is a recursion
-    bool initCallDag(TIntermNode *root);
+    bool initCallDag();
     // Return false if "main" doesn't exist
     bool tagUsedFunctions();
-    void internalTagUsedFunction(size_t index);
 
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
@@ -214,6 +224,7 @@ class TCompiler : public TShHandleBase
         bool used;
     };
 
+    CallGraph mCallGraph;
     CallDAG mCallDag;
     std::vector<FunctionMetadata> functionMetadata;
 
@@ -256,6 +267,11 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     unsigned int mTemporaryIndex;
+
+    // Per-stage statistics of the last compile, if SH_COLLECT_COMPILE_STATISTICS was set. Stage
+    // start times are relative to mCompileStartTime.
+    std::vector<ShCompileStageStatistics> mCompileStatistics;
+    std::chrono::steady_clock::time_point mCompileStartTime;
 };
 
 //
@@ -6,9 +6,39 @@
 
 #include "compiler/translator/InfoSink.h"
 
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+
 namespace sh
 {
 
+namespace
+{
+
+// Enough for the digits of a 64-bit integer and a sign.
+constexpr size_t kMaxIntegerChars = 21;
+
+// Float formatting goes through snprintf, which honors the C locale. GLSL and HLSL need a period as
+// the decimal separator whatever the locale is.
+void FixDecimalPoint(char *str)
+{
+    const char *decimalPoint = localeconv()->decimal_point;
+    if (decimalPoint[0] == '.' || decimalPoint[0] == '\0' || decimalPoint[1] != '\0')
+    {
+        return;
+    }
+    for (char *c = str; *c != '\0'; ++c)
+    {
+        if (*c == decimalPoint[0])
+        {
+            *c = '.';
+        }
+    }
+}
+
+}  // anonymous namespace
+
 void TInfoSinkBase::prefix(Severity severity)
 {
     switch (severity)
@@ -27,14 +57,63 @@ void TInfoSinkBase::prefix(Severity severity)
 
 void TInfoSinkBase::location(int file, int line)
 {
-    TPersistStringStream stream;
+    *this << file << ":";
     if (line)
-        stream << file << ":" << line;
+        *this << line;
     else
-        stream << file << ":? ";
-    stream << ": ";
+        sink.append("? ");
+    sink.append(": ");
+}
 
-    sink.append(stream.str());
+void TInfoSinkBase::appendSigned(long long i)
+{
+    if (i >= 0)
+    {
+        appendUnsigned(static_cast<unsigned long long>(i));
+        return;
+    }
+    sink.append(1, '-');
+    // Negate in unsigned arithmetic so that the most negative value doesn't overflow.
+    appendUnsigned(0ull - static_cast<unsigned long long>(i));
+}
+
+void TInfoSinkBase::appendUnsigned(unsigned long long u)
+{
+    char buffer[kMaxIntegerChars];
+    char *end   = buffer + kMaxIntegerChars;
+    char *begin = end;
+    do
+    {
+        *--begin = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    sink.append(begin, end - begin);
+}
+
+void TInfoSinkBase::appendFloat(float f)
+{
+    char buffer[64];
+
+    // Make sure that at least one decimal point is written. If a number does not have a
+    // fractional part, the %g format does not write the decimal portion which gets
+    // interpreted as integer by the compiler.
+    if (fractionalPart(f) == 0.0f)
+    {
+        snprintf(buffer, sizeof(buffer), "%.1f", f);
+    }
+    else
+    {
+        // Eight significant digits match what the translator has always written. The few values
+        // that don't read back from that need a ninth digit, which always round-trips a single
+        // precision float.
+        snprintf(buffer, sizeof(buffer), "%.8g", f);
+        if (strtof(buffer, nullptr) != f)
+        {
+            snprintf(buffer, sizeof(buffer), "%.9g", f);
+        }
+    }
+    FixDecimalPoint(buffer);
+    sink.append(buffer);
 }
 
 }  // namespace sh
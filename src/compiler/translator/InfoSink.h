@@ -60,30 +60,45 @@ class TInfoSinkBase
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        sink.append(str.c_str(), str.size());
+        return *this;
+    }
+    // Integers are formatted in place rather than through a temporary stream, since constant
+    // output inserts a lot of them.
+    TInfoSinkBase &operator<<(int i)
+    {
+        appendSigned(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(long i)
+    {
+        appendSigned(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(long long i)
+    {
+        appendSigned(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned int u)
+    {
+        appendUnsigned(u);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned long u)
+    {
+        appendUnsigned(u);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned long long u)
+    {
+        appendUnsigned(u);
         return *this;
     }
     // Make sure floats are written with correct precision.
     TInfoSinkBase &operator<<(float f)
     {
-        // Make sure that at least one decimal point is written. If a number
-        // does not have a fractional part, the default precision format does
-        // not write the decimal portion which gets interpreted as integer by
-        // the compiler.
-        TPersistStringStream stream;
-        if (fractionalPart(f) == 0.0f)
-        {
-            stream.precision(1);
-            stream << std::showpoint << std::fixed << f;
-        }
-        else
-        {
-            stream.unsetf(std::ios::fixed);
-            stream.unsetf(std::ios::scientific);
-            stream.precision(8);
-            stream << f;
-        }
-        sink.append(stream.str());
+        appendFloat(f);
         return *this;
     }
     // Write boolean values as their names instead of integral value.
@@ -94,8 +109,12 @@ class TInfoSinkBase
         return *this;
     }
 
+    void append(const char *str, size_t length) { sink.append(str, length); }
+
     void erase() { sink.clear(); }
     int size() { return static_cast<int>(sink.size()); }
+    // Preallocates room for the expected output so that appending doesn't keep reallocating.
+    void reserve(size_t capacity) { sink.reserve(capacity); }
 
     const TPersistString &str() const { return sink; }
     const char *c_str() const { return sink.c_str(); }
@@ -104,6 +123,10 @@ class TInfoSinkBase
     void location(int file, int line);
 
   private:
+    void appendSigned(long long i);
+    void appendUnsigned(unsigned long long u);
+    void appendFloat(float f);
+
     TPersistString sink;
 };
 
@@ -17,6 +17,7 @@
 
 #include "common/mathutil.h"
 #include "common/matrix_utils.h"
+#include "compiler/translator/Cache.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermNode.h"
@@ -105,7 +106,7 @@ TIntermTyped *CreateFoldedNode(const TConstantUnion *constArray,
         return nullptr;
     }
     TIntermTyped *folded = new TIntermConstantUnion(constArray, originalNode->getType());
-    folded->getTypePointer()->setQualifier(qualifier);
+    folded->setQualifier(qualifier);
     folded->setLine(originalNode->getLine());
     return folded;
 }
@@ -154,9 +155,37 @@ void SetUnionArrayFromMatrix(const angle::Matrix<float> &m, TConstantUnion *resu
 void TIntermTyped::setTypePreservePrecision(const TType &t)
 {
     TPrecision precision = getPrecision();
-    mType                = t;
-    ASSERT(mType.getBasicType() != EbtBool || precision == EbpUndefined);
-    mType.setPrecision(precision);
+    TType type(t);
+    ASSERT(type.getBasicType() != EbtBool || precision == EbpUndefined);
+    type.setPrecision(precision);
+    setType(type);
+}
+
+void TIntermTyped::setQualifier(TQualifier qualifier)
+{
+    if (mType->getQualifier() != qualifier)
+    {
+        TType type(*mType);
+        type.setQualifier(qualifier);
+        setType(type);
+    }
+}
+
+void TIntermTyped::setPrecision(TPrecision precision)
+{
+    if (mType->getPrecision() != precision)
+    {
+        TType type(*mType);
+        type.setPrecision(precision);
+        setType(type);
+    }
+}
+
+// Types that TCache prepopulated are shared between nodes; anything else gets its own copy.
+const TType *TIntermTyped::GetSharedType(const TType &type)
+{
+    const TType *commonType = TCache::findType(type);
+    return commonType ? commonType : new TType(type);
 }
 
 #define REPLACE_IF_IS(node, type, original, replacement) \
@@ -321,7 +350,9 @@ TIntermAggregate *TIntermAggregate::Create(const TType &type,
 }
 
 TIntermAggregate::TIntermAggregate(const TType &type, TOperator op, TIntermSequence *arguments)
-    : TIntermOperator(op), mUseEmulatedFunction(false), mGotPrecisionFromChildren(false)
+    : TIntermOperator(EIntermAggregate, op),
+      mUseEmulatedFunction(false),
+      mGotPrecisionFromChildren(false)
 {
     if (arguments != nullptr)
     {
@@ -333,7 +364,7 @@ TIntermAggregate::TIntermAggregate(const TType &type, TOperator op, TIntermSeque
 void TIntermAggregate::setTypePrecisionAndQualifier(const TType &type)
 {
     setType(type);
-    mType.setQualifier(EvqTemporary);
+    setQualifier(EvqTemporary);
     if (!isFunctionCall())
     {
         if (isConstructor())
@@ -351,7 +382,7 @@ void TIntermAggregate::setTypePrecisionAndQualifier(const TType &type)
         }
         if (areChildrenConstQualified())
         {
-            mType.setQualifier(EvqConst);
+            setQualifier(EvqConst);
         }
     }
 }
@@ -374,7 +405,7 @@ void TIntermAggregate::setPrecisionFromChildren()
     mGotPrecisionFromChildren = true;
     if (getBasicType() == EbtBool)
     {
-        mType.setPrecision(EbpUndefined);
+        setPrecision(EbpUndefined);
         return;
     }
 
@@ -387,7 +418,7 @@ void TIntermAggregate::setPrecisionFromChildren()
             precision = GetHigherPrecision(typed->getPrecision(), precision);
         ++childIter;
     }
-    mType.setPrecision(precision);
+    setPrecision(precision);
 }
 
 void TIntermAggregate::setPrecisionForBuiltInOp()
@@ -405,17 +436,17 @@ bool TIntermAggregate::setPrecisionForSpecialBuiltInOp()
     switch (mOp)
     {
         case EOpBitfieldExtract:
-            mType.setPrecision(mArguments[0]->getAsTyped()->getPrecision());
+            setPrecision(mArguments[0]->getAsTyped()->getPrecision());
             mGotPrecisionFromChildren = true;
             return true;
         case EOpBitfieldInsert:
-            mType.setPrecision(GetHigherPrecision(mArguments[0]->getAsTyped()->getPrecision(),
+            setPrecision(GetHigherPrecision(mArguments[0]->getAsTyped()->getPrecision(),
                                                   mArguments[1]->getAsTyped()->getPrecision()));
             mGotPrecisionFromChildren = true;
             return true;
         case EOpUaddCarry:
         case EOpUsubBorrow:
-            mType.setPrecision(EbpHigh);
+            setPrecision(EbpHigh);
             return true;
         default:
             return false;
@@ -442,9 +473,9 @@ void TIntermAggregate::setBuiltInFunctionPrecision()
     // ESSL 3.0 spec section 8: textureSize always gets highp precision.
     // All other functions that take a sampler are assumed to be texture functions.
     if (mFunctionInfo.getName().find("textureSize") == 0)
-        mType.setPrecision(EbpHigh);
+        setPrecision(EbpHigh);
     else
-        mType.setPrecision(precision);
+        setPrecision(precision);
 }
 
 TString TIntermAggregate::getSymbolTableMangledName() const
@@ -536,7 +567,8 @@ bool TIntermCase::replaceChildNode(TIntermNode *original, TIntermNode *replaceme
     return false;
 }
 
-TIntermTyped::TIntermTyped(const TIntermTyped &node) : TIntermNode(), mType(node.mType)
+TIntermTyped::TIntermTyped(const TIntermTyped &node)
+    : TIntermNode(node.getKind()), mType(node.mType)
 {
     // Copy constructor is disallowed for TIntermNode in order to disallow it for subclasses that
     // don't explicitly allow it, so normal TIntermNode constructor is used to construct the copy.
@@ -727,7 +759,7 @@ TIntermAggregate *TIntermAggregate::shallowCopy() const
 {
     TIntermSequence *copySeq = new TIntermSequence();
     copySeq->insert(copySeq->begin(), getSequence()->begin(), getSequence()->end());
-    TIntermAggregate *copyNode         = new TIntermAggregate(mType, mOp, copySeq);
+    TIntermAggregate *copyNode         = new TIntermAggregate(*mType, mOp, copySeq);
     *copyNode->getFunctionSymbolInfo() = mFunctionInfo;
     copyNode->setLine(mLine);
     return copyNode;
@@ -970,13 +1002,13 @@ void TIntermUnary::promote()
             break;
         default:
             setType(mOperand->getType());
-            mType.setQualifier(resultQualifier);
+            setQualifier(resultQualifier);
             break;
     }
 }
 
 TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<int> &swizzleOffsets)
-    : TIntermTyped(TType(EbtFloat, EbpUndefined)),
+    : TIntermTyped(EIntermSwizzle, TType(EbtFloat, EbpUndefined)),
       mOperand(operand),
       mSwizzleOffsets(swizzleOffsets)
 {
@@ -985,19 +1017,19 @@ TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<int> &swizzl
 }
 
 TIntermUnary::TIntermUnary(TOperator op, TIntermTyped *operand)
-    : TIntermOperator(op), mOperand(operand), mUseEmulatedFunction(false)
+    : TIntermOperator(EIntermUnary, op), mOperand(operand), mUseEmulatedFunction(false)
 {
     promote();
 }
 
 TIntermBinary::TIntermBinary(TOperator op, TIntermTyped *left, TIntermTyped *right)
-    : TIntermOperator(op), mLeft(left), mRight(right), mAddIndexClamp(false)
+    : TIntermOperator(EIntermBinary, op), mLeft(left), mRight(right), mAddIndexClamp(false)
 {
     promote();
 }
 
 TIntermInvariantDeclaration::TIntermInvariantDeclaration(TIntermSymbol *symbol, const TSourceLoc &line)
-    : TIntermNode(), mSymbol(symbol)
+    : TIntermNode(EIntermInvariantDeclaration), mSymbol(symbol)
 {
     ASSERT(symbol);
     setLine(line);
@@ -1006,12 +1038,12 @@ TIntermInvariantDeclaration::TIntermInvariantDeclaration(TIntermSymbol *symbol,
 TIntermTernary::TIntermTernary(TIntermTyped *cond,
                                TIntermTyped *trueExpression,
                                TIntermTyped *falseExpression)
-    : TIntermTyped(trueExpression->getType()),
+    : TIntermTyped(EIntermTernary, trueExpression->getType()),
       mCondition(cond),
       mTrueExpression(trueExpression),
       mFalseExpression(falseExpression)
 {
-    getTypePointer()->setQualifier(
+    setQualifier(
         TIntermTernary::DetermineQualifier(cond, trueExpression, falseExpression));
 }
 
@@ -1020,7 +1052,7 @@ TIntermLoop::TIntermLoop(TLoopType type,
                          TIntermTyped *cond,
                          TIntermTyped *expr,
                          TIntermBlock *body)
-    : mType(type), mInit(init), mCond(cond), mExpr(expr), mBody(body)
+    : TIntermNode(EIntermLoop), mType(type), mInit(init), mCond(cond), mExpr(expr), mBody(body)
 {
     // Declaration nodes with no children can appear if all the declarators just added constants to
     // the symbol table instead of generating code. They're no-ops so don't add them to the tree.
@@ -1134,7 +1166,7 @@ void TIntermBinary::promote()
     if (mLeft->getQualifier() != EvqConst || mRight->getQualifier() != EvqConst)
     {
         resultQualifier = EvqTemporary;
-        getTypePointer()->setQualifier(EvqTemporary);
+        setQualifier(EvqTemporary);
     }
 
     // Handle indexing ops.
@@ -1144,7 +1176,9 @@ void TIntermBinary::promote()
         case EOpIndexIndirect:
             if (mLeft->isArray())
             {
-                mType.clearArrayness();
+                TType elementType(*mType);
+                elementType.clearArrayness();
+                setType(elementType);
             }
             else if (mLeft->isMatrix())
             {
@@ -1165,7 +1199,7 @@ void TIntermBinary::promote()
             const TFieldList &fields = mLeft->getType().getStruct()->fields();
             const int i              = mRight->getAsConstantUnion()->getIConst(0);
             setType(*fields[i]->type());
-            getTypePointer()->setQualifier(resultQualifier);
+            setQualifier(resultQualifier);
             return;
         }
         case EOpIndexDirectInterfaceBlock:
@@ -1173,7 +1207,7 @@ void TIntermBinary::promote()
             const TFieldList &fields = mLeft->getType().getInterfaceBlock()->fields();
             const int i              = mRight->getAsConstantUnion()->getIConst(0);
             setType(*fields[i]->type());
-            getTypePointer()->setQualifier(resultQualifier);
+            setQualifier(resultQualifier);
             return;
         }
         default:
@@ -1184,7 +1218,7 @@ void TIntermBinary::promote()
 
     // The result gets promoted to the highest precision.
     TPrecision higherPrecision = GetHigherPrecision(mLeft->getPrecision(), mRight->getPrecision());
-    getTypePointer()->setPrecision(higherPrecision);
+    setPrecision(higherPrecision);
 
     const int nominalSize = std::max(mLeft->getNominalSize(), mRight->getNominalSize());
 
@@ -1360,7 +1394,7 @@ TIntermTyped *TIntermSwizzle::fold()
     {
         constArray[i] = *operandConstant->foldIndexing(mSwizzleOffsets.at(i));
     }
-    return CreateFoldedNode(constArray, this, mType.getQualifier());
+    return CreateFoldedNode(constArray, this, getQualifier());
 }
 
 TIntermTyped *TIntermBinary::fold(TDiagnostics *diagnostics)
@@ -1378,7 +1412,7 @@ TIntermTyped *TIntermBinary::fold(TDiagnostics *diagnostics)
             int index = rightConstant->getIConst(0);
 
             const TConstantUnion *constArray = leftConstant->foldIndexing(index);
-            return CreateFoldedNode(constArray, this, mType.getQualifier());
+            return CreateFoldedNode(constArray, this, getQualifier());
         }
         case EOpIndexDirectStruct:
         {
@@ -1396,7 +1430,7 @@ TIntermTyped *TIntermBinary::fold(TDiagnostics *diagnostics)
             }
 
             const TConstantUnion *constArray = leftConstant->getUnionArrayPointer();
-            return CreateFoldedNode(constArray + previousFieldsSize, this, mType.getQualifier());
+            return CreateFoldedNode(constArray + previousFieldsSize, this, getQualifier());
         }
         case EOpIndexIndirect:
         case EOpIndexDirectInterfaceBlock:
@@ -1412,7 +1446,7 @@ TIntermTyped *TIntermBinary::fold(TDiagnostics *diagnostics)
                 leftConstant->foldBinary(mOp, rightConstant, diagnostics, mLeft->getLine());
 
             // Nodes may be constant folded without being qualified as constant.
-            return CreateFoldedNode(constArray, this, mType.getQualifier());
+            return CreateFoldedNode(constArray, this, getQualifier());
         }
     }
 }
@@ -1452,7 +1486,7 @@ TIntermTyped *TIntermUnary::fold(TDiagnostics *diagnostics)
     }
 
     // Nodes may be constant folded without being qualified as constant.
-    return CreateFoldedNode(constArray, this, mType.getQualifier());
+    return CreateFoldedNode(constArray, this, getQualifier());
 }
 
 TIntermTyped *TIntermAggregate::fold(TDiagnostics *diagnostics)
@@ -80,6 +80,32 @@ class TName
     bool mIsInternal;
 };
 
+//
+// The concrete class of a tree node. Traversal dispatches on it instead of making a virtual call
+// per node.
+//
+enum TIntermNodeKind
+{
+    EIntermSymbol,
+    EIntermRaw,
+    EIntermConstantUnion,
+    EIntermSwizzle,
+    EIntermBinary,
+    EIntermUnary,
+    EIntermTernary,
+    EIntermIfElse,
+    EIntermSwitch,
+    EIntermCase,
+    EIntermFunctionPrototype,
+    EIntermFunctionDefinition,
+    EIntermAggregate,
+    EIntermBlock,
+    EIntermInvariantDeclaration,
+    EIntermDeclaration,
+    EIntermLoop,
+    EIntermBranch
+};
+
 //
 // Base class for the tree nodes
 //
@@ -87,7 +113,7 @@ class TIntermNode : angle::NonCopyable
 {
   public:
     POOL_ALLOCATOR_NEW_DELETE();
-    TIntermNode()
+    explicit TIntermNode(TIntermNodeKind kind) : mKind(kind)
     {
         // TODO: Move this to TSourceLoc constructor
         // after getting rid of TPublicType.
@@ -99,6 +125,8 @@ class TIntermNode : angle::NonCopyable
     const TSourceLoc &getLine() const { return mLine; }
     void setLine(const TSourceLoc &l) { mLine = l; }
 
+    TIntermNodeKind getKind() const { return mKind; }
+
     virtual void traverse(TIntermTraverser *) = 0;
     virtual TIntermTyped *getAsTyped() { return 0; }
     virtual TIntermConstantUnion *getAsConstantUnion() { return 0; }
@@ -125,6 +153,9 @@ class TIntermNode : angle::NonCopyable
 
   protected:
     TSourceLoc mLine;
+
+  private:
+    TIntermNodeKind mKind;
 };
 
 //
@@ -142,7 +173,10 @@ struct TIntermNodePair
 class TIntermTyped : public TIntermNode
 {
   public:
-    TIntermTyped(const TType &t) : mType(t) {}
+    TIntermTyped(TIntermNodeKind kind, const TType &t)
+        : TIntermNode(kind), mType(GetSharedType(t))
+    {
+    }
 
     virtual TIntermTyped *deepCopy() const = 0;
 
@@ -153,30 +187,33 @@ class TIntermTyped : public TIntermNode
     // affecting state. May return true conservatively.
     virtual bool hasSideEffects() const = 0;
 
-    void setType(const TType &t) { mType = t; }
+    void setType(const TType &t) { mType = GetSharedType(t); }
     void setTypePreservePrecision(const TType &t);
-    const TType &getType() const { return mType; }
-    TType *getTypePointer() { return &mType; }
-
-    TBasicType getBasicType() const { return mType.getBasicType(); }
-    TQualifier getQualifier() const { return mType.getQualifier(); }
-    TPrecision getPrecision() const { return mType.getPrecision(); }
-    TMemoryQualifier getMemoryQualifier() const { return mType.getMemoryQualifier(); }
-    int getCols() const { return mType.getCols(); }
-    int getRows() const { return mType.getRows(); }
-    int getNominalSize() const { return mType.getNominalSize(); }
-    int getSecondarySize() const { return mType.getSecondarySize(); }
-
-    bool isInterfaceBlock() const { return mType.isInterfaceBlock(); }
-    bool isMatrix() const { return mType.isMatrix(); }
-    bool isArray() const { return mType.isArray(); }
-    bool isVector() const { return mType.isVector(); }
-    bool isScalar() const { return mType.isScalar(); }
-    bool isScalarInt() const { return mType.isScalarInt(); }
-    const char *getBasicString() const { return mType.getBasicString(); }
-    TString getCompleteString() const { return mType.getCompleteString(); }
-
-    unsigned int getArraySize() const { return mType.getArraySize(); }
+    const TType &getType() const { return *mType; }
+
+    // Types are shared between nodes, so these replace the type instead of changing it.
+    void setQualifier(TQualifier qualifier);
+    void setPrecision(TPrecision precision);
+
+    TBasicType getBasicType() const { return mType->getBasicType(); }
+    TQualifier getQualifier() const { return mType->getQualifier(); }
+    TPrecision getPrecision() const { return mType->getPrecision(); }
+    TMemoryQualifier getMemoryQualifier() const { return mType->getMemoryQualifier(); }
+    int getCols() const { return mType->getCols(); }
+    int getRows() const { return mType->getRows(); }
+    int getNominalSize() const { return mType->getNominalSize(); }
+    int getSecondarySize() const { return mType->getSecondarySize(); }
+
+    bool isInterfaceBlock() const { return mType->isInterfaceBlock(); }
+    bool isMatrix() const { return mType->isMatrix(); }
+    bool isArray() const { return mType->isArray(); }
+    bool isVector() const { return mType->isVector(); }
+    bool isScalar() const { return mType->isScalar(); }
+    bool isScalarInt() const { return mType->isScalarInt(); }
+    const char *getBasicString() const { return mType->getBasicString(); }
+    TString getCompleteString() const { return mType->getCompleteString(); }
+
+    unsigned int getArraySize() const { return mType->getArraySize(); }
 
     bool isConstructorWithOnlyConstantUnionParameters();
 
@@ -185,9 +222,14 @@ class TIntermTyped : public TIntermNode
     static TIntermTyped *CreateBool(bool value);
 
   protected:
-    TType mType;
+    // Immutable. Common scalar, vector and matrix types point to the instances interned in TCache,
+    // other types to a copy in the pool that copies of the node share.
+    const TType *mType;
 
     TIntermTyped(const TIntermTyped &node);
+
+  private:
+    static const TType *GetSharedType(const TType &type);
 };
 
 //
@@ -237,7 +279,10 @@ class TIntermLoop : public TIntermNode
 class TIntermBranch : public TIntermNode
 {
   public:
-    TIntermBranch(TOperator op, TIntermTyped *e) : mFlowOp(op), mExpression(e) {}
+    TIntermBranch(TOperator op, TIntermTyped *e)
+        : TIntermNode(EIntermBranch), mFlowOp(op), mExpression(e)
+    {
+    }
 
     void traverse(TIntermTraverser *it) override;
     TIntermBranch *getAsBranchNode() override { return this; }
@@ -261,7 +306,7 @@ class TIntermSymbol : public TIntermTyped
     // If sym comes from per process globalpoolallocator, then it causes increased memory usage
     // per compile it is essential to use "symbol = sym" to assign to symbol
     TIntermSymbol(int id, const TString &symbol, const TType &type)
-        : TIntermTyped(type), mId(id), mSymbol(symbol)
+        : TIntermTyped(EIntermSymbol, type), mId(id), mSymbol(symbol)
     {
     }
 
@@ -295,7 +340,10 @@ class TIntermSymbol : public TIntermTyped
 class TIntermRaw : public TIntermTyped
 {
   public:
-    TIntermRaw(const TType &type, const TString &rawText) : TIntermTyped(type), mRawText(rawText) {}
+    TIntermRaw(const TType &type, const TString &rawText)
+        : TIntermTyped(EIntermRaw, type), mRawText(rawText)
+    {
+    }
     TIntermRaw(const TIntermRaw &) = delete;
 
     TIntermTyped *deepCopy() const override
@@ -327,7 +375,7 @@ class TIntermConstantUnion : public TIntermTyped
 {
   public:
     TIntermConstantUnion(const TConstantUnion *unionPointer, const TType &type)
-        : TIntermTyped(type), mUnionArrayPointer(unionPointer)
+        : TIntermTyped(EIntermConstantUnion, type), mUnionArrayPointer(unionPointer)
     {
         ASSERT(unionPointer);
     }
@@ -410,8 +458,14 @@ class TIntermOperator : public TIntermTyped
     bool hasSideEffects() const override { return isAssignment(); }
 
   protected:
-    TIntermOperator(TOperator op) : TIntermTyped(TType(EbtFloat, EbpUndefined)), mOp(op) {}
-    TIntermOperator(TOperator op, const TType &type) : TIntermTyped(type), mOp(op) {}
+    TIntermOperator(TIntermNodeKind kind, TOperator op)
+        : TIntermTyped(kind, TType(EbtFloat, EbpUndefined)), mOp(op)
+    {
+    }
+    TIntermOperator(TIntermNodeKind kind, TOperator op, const TType &type)
+        : TIntermTyped(kind, type), mOp(op)
+    {
+    }
 
     TIntermOperator(const TIntermOperator &) = default;
 
@@ -682,7 +736,7 @@ class TIntermAggregate : public TIntermOperator, public TIntermAggregateBase
 class TIntermBlock : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermBlock() : TIntermNode() {}
+    TIntermBlock() : TIntermNode(EIntermBlock) {}
     ~TIntermBlock() {}
 
     TIntermBlock *getAsBlock() override { return this; }
@@ -707,7 +761,7 @@ class TIntermFunctionPrototype : public TIntermTyped, public TIntermAggregateBas
     // TODO(oetuaho@nvidia.com): See if TFunctionSymbolInfo could be added to constructor
     // parameters.
     TIntermFunctionPrototype(const TType &type, const TSymbolUniqueId &id)
-        : TIntermTyped(type), mFunctionInfo(id)
+        : TIntermTyped(EIntermFunctionPrototype, type), mFunctionInfo(id)
     {
     }
     ~TIntermFunctionPrototype() {}
@@ -748,7 +802,7 @@ class TIntermFunctionDefinition : public TIntermNode
 {
   public:
     TIntermFunctionDefinition(TIntermFunctionPrototype *prototype, TIntermBlock *body)
-        : TIntermNode(), mPrototype(prototype), mBody(body)
+        : TIntermNode(EIntermFunctionDefinition), mPrototype(prototype), mBody(body)
     {
         ASSERT(prototype != nullptr);
         ASSERT(body != nullptr);
@@ -775,7 +829,7 @@ class TIntermFunctionDefinition : public TIntermNode
 class TIntermDeclaration : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermDeclaration() : TIntermNode() {}
+    TIntermDeclaration() : TIntermNode(EIntermDeclaration) {}
     ~TIntermDeclaration() {}
 
     TIntermDeclaration *getAsDeclarationNode() override { return this; }
@@ -846,7 +900,7 @@ class TIntermIfElse : public TIntermNode
 {
   public:
     TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB)
-        : TIntermNode(), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
+        : TIntermNode(EIntermIfElse), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
     {
     }
 
@@ -871,7 +925,7 @@ class TIntermSwitch : public TIntermNode
 {
   public:
     TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList)
-        : TIntermNode(), mInit(init), mStatementList(statementList)
+        : TIntermNode(EIntermSwitch), mInit(init), mStatementList(statementList)
     {
     }
 
@@ -895,7 +949,7 @@ class TIntermSwitch : public TIntermNode
 class TIntermCase : public TIntermNode
 {
   public:
-    TIntermCase(TIntermTyped *condition) : TIntermNode(), mCondition(condition) {}
+    TIntermCase(TIntermTyped *condition) : TIntermNode(EIntermCase), mCondition(condition) {}
 
     void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
@@ -962,6 +1016,10 @@ class TIntermTraverser : angle::NonCopyable
     virtual bool visitLoop(Visit visit, TIntermLoop *node) { return true; }
     virtual bool visitBranch(Visit visit, TIntermBranch *node) { return true; }
 
+    // Calls the traverse function matching the node's kind. Equivalent to node->traverse(this)
+    // without the virtual call on the node.
+    void traverseNode(TIntermNode *node);
+
     // The traverse functions contain logic for iterating over the children of the node
     // and calling the visit functions in the appropriate places. They also track some
     // context that may be used by the visit functions.
@@ -101,6 +101,70 @@ void TIntermBranch::traverse(TIntermTraverser *it)
     it->traverseBranch(this);
 }
 
+void TIntermTraverser::traverseNode(TIntermNode *node)
+{
+    switch (node->getKind())
+    {
+        case EIntermSymbol:
+            traverseSymbol(static_cast<TIntermSymbol *>(node));
+            break;
+        case EIntermRaw:
+            traverseRaw(static_cast<TIntermRaw *>(node));
+            break;
+        case EIntermConstantUnion:
+            traverseConstantUnion(static_cast<TIntermConstantUnion *>(node));
+            break;
+        case EIntermSwizzle:
+            traverseSwizzle(static_cast<TIntermSwizzle *>(node));
+            break;
+        case EIntermBinary:
+            traverseBinary(static_cast<TIntermBinary *>(node));
+            break;
+        case EIntermUnary:
+            traverseUnary(static_cast<TIntermUnary *>(node));
+            break;
+        case EIntermTernary:
+            traverseTernary(static_cast<TIntermTernary *>(node));
+            break;
+        case EIntermIfElse:
+            traverseIfElse(static_cast<TIntermIfElse *>(node));
+            break;
+        case EIntermSwitch:
+            traverseSwitch(static_cast<TIntermSwitch *>(node));
+            break;
+        case EIntermCase:
+            traverseCase(static_cast<TIntermCase *>(node));
+            break;
+        case EIntermFunctionPrototype:
+            traverseFunctionPrototype(static_cast<TIntermFunctionPrototype *>(node));
+            break;
+        case EIntermFunctionDefinition:
+            traverseFunctionDefinition(static_cast<TIntermFunctionDefinition *>(node));
+            break;
+        case EIntermAggregate:
+            traverseAggregate(static_cast<TIntermAggregate *>(node));
+            break;
+        case EIntermBlock:
+            traverseBlock(static_cast<TIntermBlock *>(node));
+            break;
+        case EIntermInvariantDeclaration:
+            traverseInvariantDeclaration(static_cast<TIntermInvariantDeclaration *>(node));
+            break;
+        case EIntermDeclaration:
+            traverseDeclaration(static_cast<TIntermDeclaration *>(node));
+            break;
+        case EIntermLoop:
+            traverseLoop(static_cast<TIntermLoop *>(node));
+            break;
+        case EIntermBranch:
+            traverseBranch(static_cast<TIntermBranch *>(node));
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
 TIntermTraverser::TIntermTraverser(bool preVisit, bool inVisit, bool postVisit)
     : preVisit(preVisit),
       inVisit(inVisit),
@@ -175,7 +239,7 @@ TIntermSymbol *TIntermTraverser::createTempSymbol(const TType &type, TQualifier
     node->setInternal(true);
 
     ASSERT(qualifier == EvqTemporary || qualifier == EvqConst || qualifier == EvqGlobal);
-    node->getTypePointer()->setQualifier(qualifier);
+    node->setQualifier(qualifier);
     // TODO(oetuaho): Might be useful to sanitize layout qualifier etc. on the type of the created
     // symbol. This might need to be done in other places as well.
     return node;
@@ -294,7 +358,7 @@ void TIntermTraverser::traverseSwizzle(TIntermSwizzle *node)
 
     if (visit)
     {
-        node->getOperand()->traverse(this);
+        traverseNode(node->getOperand());
     }
 
     if (visit && postVisit)
@@ -322,13 +386,13 @@ void TIntermTraverser::traverseBinary(TIntermBinary *node)
     if (visit)
     {
         if (node->getLeft())
-            node->getLeft()->traverse(this);
+            traverseNode(node->getLeft());
 
         if (inVisit)
             visit = visitBinary(InVisit, node);
 
         if (visit && node->getRight())
-            node->getRight()->traverse(this);
+            traverseNode(node->getRight());
     }
 
     //
@@ -367,7 +431,7 @@ void TLValueTrackingTraverser::traverseBinary(TIntermBinary *node)
         }
 
         if (node->getLeft())
-            node->getLeft()->traverse(this);
+            traverseNode(node->getLeft());
 
         if (inVisit)
             visit = visitBinary(InVisit, node);
@@ -386,7 +450,7 @@ void TLValueTrackingTraverser::traverseBinary(TIntermBinary *node)
         }
 
         if (visit && node->getRight())
-            node->getRight()->traverse(this);
+            traverseNode(node->getRight());
 
         setOperatorRequiresLValue(parentOperatorRequiresLValue);
         setInFunctionCallOutParameter(parentInFunctionCallOutParameter);
@@ -414,7 +478,7 @@ void TIntermTraverser::traverseUnary(TIntermUnary *node)
 
     if (visit)
     {
-        node->getOperand()->traverse(this);
+        traverseNode(node->getOperand());
     }
 
     if (visit && postVisit)
@@ -445,7 +509,7 @@ void TLValueTrackingTraverser::traverseUnary(TIntermUnary *node)
                 break;
         }
 
-        node->getOperand()->traverse(this);
+        traverseNode(node->getOperand());
 
         setOperatorRequiresLValue(false);
     }
@@ -468,10 +532,10 @@ void TIntermTraverser::traverseFunctionDefinition(TIntermFunctionDefinition *nod
     {
         mInGlobalScope = false;
 
-        node->getFunctionPrototype()->traverse(this);
+        traverseNode(node->getFunctionPrototype());
         if (inVisit)
             visit = visitFunctionDefinition(InVisit, node);
-        node->getBody()->traverse(this);
+        traverseNode(node->getBody());
 
         mInGlobalScope = true;
     }
@@ -497,7 +561,7 @@ void TIntermTraverser::traverseBlock(TIntermBlock *node)
     {
         for (auto *child : *sequence)
         {
-            child->traverse(this);
+            traverseNode(child);
             if (visit && inVisit)
             {
                 if (child != sequence->back())
@@ -527,7 +591,7 @@ void TIntermTraverser::traverseInvariantDeclaration(TIntermInvariantDeclaration
 
     if (visit)
     {
-        node->getSymbol()->traverse(this);
+        traverseNode(node->getSymbol());
         if (postVisit)
         {
             visitInvariantDeclaration(PostVisit, node);
@@ -551,7 +615,7 @@ void TIntermTraverser::traverseDeclaration(TIntermDeclaration *node)
     {
         for (auto *child : *sequence)
         {
-            child->traverse(this);
+            traverseNode(child);
             if (visit && inVisit)
             {
                 if (child != sequence->back())
@@ -579,7 +643,7 @@ void TIntermTraverser::traverseFunctionPrototype(TIntermFunctionPrototype *node)
     {
         for (auto *child : *sequence)
         {
-            child->traverse(this);
+            traverseNode(child);
             if (visit && inVisit)
             {
                 if (child != sequence->back())
@@ -608,7 +672,7 @@ void TIntermTraverser::traverseAggregate(TIntermAggregate *node)
     {
         for (auto *child : *sequence)
         {
-            child->traverse(this);
+            traverseNode(child);
             if (visit && inVisit)
             {
                 if (child != sequence->back())
@@ -654,7 +718,7 @@ void TLValueTrackingTraverser::traverseAggregate(TIntermAggregate *node)
                     TQualifier qualifier = (*paramIter)->getAsTyped()->getQualifier();
                     setInFunctionCallOutParameter(qualifier == EvqOut || qualifier == EvqInOut);
 
-                    child->traverse(this);
+                    traverseNode(child);
                     if (visit && inVisit)
                     {
                         if (child != sequence->back())
@@ -672,7 +736,7 @@ void TLValueTrackingTraverser::traverseAggregate(TIntermAggregate *node)
                 setInFunctionCallOutParameter(false);
                 for (auto *child : *sequence)
                 {
-                    child->traverse(this);
+                    traverseNode(child);
                     if (visit && inVisit)
                     {
                         if (child != sequence->back())
@@ -704,7 +768,7 @@ void TLValueTrackingTraverser::traverseAggregate(TIntermAggregate *node)
                 if (builtInFunc != nullptr)
                     qualifier = builtInFunc->getParam(paramIndex).type->getQualifier();
                 setInFunctionCallOutParameter(qualifier == EvqOut || qualifier == EvqInOut);
-                child->traverse(this);
+                traverseNode(child);
 
                 if (visit && inVisit)
                 {
@@ -737,11 +801,11 @@ void TIntermTraverser::traverseTernary(TIntermTernary *node)
 
     if (visit)
     {
-        node->getCondition()->traverse(this);
+        traverseNode(node->getCondition());
         if (node->getTrueExpression())
-            node->getTrueExpression()->traverse(this);
+            traverseNode(node->getTrueExpression());
         if (node->getFalseExpression())
-            node->getFalseExpression()->traverse(this);
+            traverseNode(node->getFalseExpression());
     }
 
     if (visit && postVisit)
@@ -760,11 +824,11 @@ void TIntermTraverser::traverseIfElse(TIntermIfElse *node)
 
     if (visit)
     {
-        node->getCondition()->traverse(this);
+        traverseNode(node->getCondition());
         if (node->getTrueBlock())
-            node->getTrueBlock()->traverse(this);
+            traverseNode(node->getTrueBlock());
         if (node->getFalseBlock())
-            node->getFalseBlock()->traverse(this);
+            traverseNode(node->getFalseBlock());
     }
 
     if (visit && postVisit)
@@ -785,11 +849,11 @@ void TIntermTraverser::traverseSwitch(TIntermSwitch *node)
 
     if (visit)
     {
-        node->getInit()->traverse(this);
+        traverseNode(node->getInit());
         if (inVisit)
             visit = visitSwitch(InVisit, node);
         if (visit && node->getStatementList())
-            node->getStatementList()->traverse(this);
+            traverseNode(node->getStatementList());
     }
 
     if (visit && postVisit)
@@ -810,7 +874,7 @@ void TIntermTraverser::traverseCase(TIntermCase *node)
 
     if (visit && node->getCondition())
     {
-        node->getCondition()->traverse(this);
+        traverseNode(node->getCondition());
     }
 
     if (visit && postVisit)
@@ -832,16 +896,16 @@ void TIntermTraverser::traverseLoop(TIntermLoop *node)
     if (visit)
     {
         if (node->getInit())
-            node->getInit()->traverse(this);
+            traverseNode(node->getInit());
 
         if (node->getCondition())
-            node->getCondition()->traverse(this);
+            traverseNode(node->getCondition());
 
         if (node->getBody())
-            node->getBody()->traverse(this);
+            traverseNode(node->getBody());
 
         if (node->getExpression())
-            node->getExpression()->traverse(this);
+            traverseNode(node->getExpression());
     }
 
     if (visit && postVisit)
@@ -862,7 +926,7 @@ void TIntermTraverser::traverseBranch(TIntermBranch *node)
 
     if (visit && node->getExpression())
     {
-        node->getExpression()->traverse(this);
+        traverseNode(node->getExpression());
     }
 
     if (visit && postVisit)
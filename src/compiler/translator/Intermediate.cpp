@@ -130,7 +130,7 @@ TIntermTyped *TIntermediate::AddComma(TIntermTyped *left,
         commaNode->setLine(line);
     }
     TQualifier resultQualifier = TIntermBinary::GetCommaQualifier(shaderVersion, left, right);
-    commaNode->getTypePointer()->setQualifier(resultQualifier);
+    commaNode->setQualifier(resultQualifier);
     return commaNode;
 }
 
@@ -153,12 +153,12 @@ TIntermTyped *TIntermediate::AddTernarySelection(TIntermTyped *cond,
             TIntermTernary::DetermineQualifier(cond, trueExpression, falseExpression);
         if (cond->getAsConstantUnion()->getBConst(0))
         {
-            trueExpression->getTypePointer()->setQualifier(resultQualifier);
+            trueExpression->setQualifier(resultQualifier);
             return trueExpression;
         }
         else
         {
-            falseExpression->getTypePointer()->setQualifier(resultQualifier);
+            falseExpression->setQualifier(resultQualifier);
             return falseExpression;
         }
     }
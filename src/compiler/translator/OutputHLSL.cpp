@@ -165,7 +165,7 @@ OutputHLSL::~OutputHLSL()
     }
 }
 
-void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
+void OutputHLSL::output(TIntermNode *treeRoot, const CallGraph &callGraph, TInfoSinkBase &objSink)
 {
     const std::vector<TIntermTyped *> &flaggedStructs = FlagStd140ValueStructs(treeRoot);
     makeFlaggedStructMaps(flaggedStructs);
@@ -180,9 +180,18 @@ void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
 
     builtInFunctionEmulator.markBuiltInFunctionsForEmulation(treeRoot);
 
-    // Now that we are done changing the AST, do the analyses need for HLSL generation
-    CallDAG::InitResult success = mCallDag.init(treeRoot, nullptr);
+    // Now that we are done changing the AST, do the analyses need for HLSL generation. The call
+    // graph has been kept up to date by the transformations, so the tree isn't traversed again.
+    CallDAG::InitResult success = mCallDag.init(callGraph, nullptr);
     ASSERT(success == CallDAG::INITDAG_SUCCESS);
+    if (success != CallDAG::INITDAG_SUCCESS)
+    {
+        // A transformation left the graph stale. Gather the calls from the final tree instead.
+        CallGraph treeCallGraph;
+        treeCallGraph.addFunctions(treeRoot);
+        success = mCallDag.init(treeCallGraph, nullptr);
+        ASSERT(success == CallDAG::INITDAG_SUCCESS);
+    }
     mASTMetadataList = CreateASTMetadataHLSL(treeRoot, mCallDag);
 
     // Output the body and footer first to determine what has to go in the header
@@ -197,9 +206,10 @@ void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
     header(mHeader, &builtInFunctionEmulator);
     mInfoSinkStack.pop();
 
-    objSink << mHeader.c_str();
-    objSink << mBody.c_str();
-    objSink << mFooter.c_str();
+    objSink.reserve(objSink.size() + mHeader.size() + mBody.size() + mFooter.size());
+    objSink << mHeader.str();
+    objSink << mBody.str();
+    objSink << mFooter.str();
 
     builtInFunctionEmulator.cleanup();
 }
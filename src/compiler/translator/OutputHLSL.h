@@ -41,7 +41,7 @@ class OutputHLSL : public TIntermTraverser
 
     ~OutputHLSL();
 
-    void output(TIntermNode *treeRoot, TInfoSinkBase &objSink);
+    void output(TIntermNode *treeRoot, const CallGraph &callGraph, TInfoSinkBase &objSink);
 
     const std::map<std::string, unsigned int> &getInterfaceBlockRegisterMap() const;
     const std::map<std::string, unsigned int> &getUniformRegisterMap() const;
@@ -75,6 +75,7 @@ TParseContext::TParseContext(TSymbolTable &symt,
                              ShCompileOptions options,
                              bool checksPrecErrors,
                              TDiagnostics *diagnostics,
+                             CallGraph *callGraph,
                              const ShBuiltInResources &resources)
     : intermediate(),
       symbolTable(symt),
@@ -84,6 +85,7 @@ TParseContext::TParseContext(TSymbolTable &symt,
       mCompileOptions(options),
       mShaderVersion(100),
       mTreeRoot(nullptr),
+      mCallGraph(callGraph),
       mLoopNestingLevel(0),
       mStructNestingLevel(0),
       mSwitchNestingLevel(0),
@@ -2492,6 +2494,7 @@ TIntermFunctionPrototype *TParseContext::addFunctionPrototypeDeclaration(
 
     TIntermFunctionPrototype *prototype =
         createPrototypeNodeFromFunction(*function, location, false);
+    mCallGraph->declareFunction(*prototype->getFunctionSymbolInfo());
 
     symbolTable.pop();
 
@@ -2524,6 +2527,7 @@ TIntermFunctionDefinition *TParseContext::addFunctionDefinition(
     TIntermFunctionDefinition *functionNode =
         new TIntermFunctionDefinition(functionPrototype, functionBody);
     functionNode->setLine(location);
+    mCallGraph->endFunctionDefinition(functionNode);
 
     symbolTable.pop();
     return functionNode;
@@ -2573,6 +2577,7 @@ void TParseContext::parseFunctionDefinitionHeader(const TSourceLoc &location,
     mFunctionReturnsValue = false;
 
     *prototypeOut = createPrototypeNodeFromFunction(**function, location, true);
+    mCallGraph->beginFunctionDefinition(*(*prototypeOut)->getFunctionSymbolInfo());
     setLoopNestingLevel(0);
 }
 
@@ -4528,6 +4533,7 @@ TIntermTyped *TParseContext::addNonConstructorFunctionCall(TFunction *fnCall,
                 {
                     callNode = TIntermAggregate::CreateFunctionCall(*fnCandidate, arguments);
                     checkImageMemoryAccessForUserDefinedFunctions(fnCandidate, callNode);
+                    mCallGraph->addCall(*callNode->getFunctionSymbolInfo());
                 }
 
                 functionCallLValueErrorCheck(fnCandidate, callNode);
@@ -4592,9 +4598,30 @@ TIntermTyped *TParseContext::addTernarySelection(TIntermTyped *cond,
         return falseExpression;
     }
 
+    // A constant condition folds the expression, so the calls in the other branch are gone.
+    if (cond->getAsConstantUnion())
+    {
+        mCallGraph->removeCalls(cond->getAsConstantUnion()->getBConst(0) ? falseExpression
+                                                                        : trueExpression);
+    }
+
     return TIntermediate::AddTernarySelection(cond, trueExpression, falseExpression, loc);
 }
 
+TIntermNode *TParseContext::addIfElse(TIntermTyped *cond,
+                                      TIntermNodePair code,
+                                      const TSourceLoc &loc)
+{
+    // A constant condition prunes the statement, so the calls in the other branch are gone.
+    if (cond->getAsConstantUnion())
+    {
+        mCallGraph->removeCalls(cond->getAsConstantUnion()->getBConst(0) ? code.node2
+                                                                        : code.node1);
+    }
+
+    return intermediate.addIfElse(cond, code, loc);
+}
+
 //
 // Parse an array of strings using yyparse.
 //
@@ -6,6 +6,7 @@
 #ifndef COMPILER_TRANSLATOR_PARSECONTEXT_H_
 #define COMPILER_TRANSLATOR_PARSECONTEXT_H_
 
+#include "compiler/translator/CallDAG.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/DirectiveHandler.h"
@@ -39,6 +40,7 @@ class TParseContext : angle::NonCopyable
                   ShCompileOptions options,
                   bool checksPrecErrors,
                   TDiagnostics *diagnostics,
+                  CallGraph *callGraph,
                   const ShBuiltInResources &resources);
 
     const pp::Preprocessor &getPreprocessor() const { return mPreprocessor; }
@@ -357,6 +359,7 @@ class TParseContext : angle::NonCopyable
                                       TIntermTyped *trueExpression,
                                       TIntermTyped *falseExpression,
                                       const TSourceLoc &line);
+    TIntermNode *addIfElse(TIntermTyped *cond, TIntermNodePair code, const TSourceLoc &loc);
 
     // TODO(jmadill): make these private
     TIntermediate intermediate;  // to build a parse tree
@@ -446,6 +449,7 @@ class TParseContext : angle::NonCopyable
     ShCompileOptions mCompileOptions;  // Options passed to TCompiler
     int mShaderVersion;
     TIntermBlock *mTreeRoot;  // root of parse tree being created
+    CallGraph *mCallGraph;    // functions and calls of the parse tree being created
     int mLoopNestingLevel;    // 0 if outside all loops
     int mStructNestingLevel;  // incremented while parsing a struct declaration
     int mSwitchNestingLevel;  // 0 if outside all switch statements
@@ -10,6 +10,9 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <algorithm>
+#include <limits>
+
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/platform.h"
@@ -18,6 +21,15 @@
 
 TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
+namespace
+{
+
+// Adaptive page sizing aims to fit the largest push/pop scope seen in this many pages.
+constexpr size_t kAdaptiveTargetPagesPerScope = 8;
+constexpr size_t kMaxAdaptivePageSize         = 1024 * 1024;
+
+}  // anonymous namespace
+
 bool InitializePoolIndex()
 {
     assert(PoolIndex == TLS_INVALID_INDEX);
@@ -56,9 +68,17 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
       pageSize(growthIncrement),
       freeList(0),
       inUseList(0),
+      mFreePageCount(0),
+      mInUsePageCount(0),
+      mRetainedPageLimit(std::numeric_limits<size_t>::max()),
+#endif
       numCalls(0),
       totalBytes(0),
-#endif
+      mAbandonedBytes(0),
+      mHighWaterMark(0),
+      mSystemAllocations(0),
+      mSystemBytes(0),
+      mAdaptivePageSize(false),
       mLocked(false)
 {
     //
@@ -82,12 +102,14 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
     //
     if (pageSize < 4 * 1024)
         pageSize = 4 * 1024;
+    minPageSize = pageSize;
 
     //
     // A large currentPageOffset indicates a new page needs to
     // be obtained to allocate memory.
     //
     currentPageOffset = pageSize;
+    currentPageSize   = pageSize;
 
     //
     // Align header skip
@@ -177,14 +199,14 @@ void TAllocation::checkGuardBlock(unsigned char *blockMem,
 void TPoolAllocator::push()
 {
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
-    tAllocState state = {currentPageOffset, inUseList};
+    tAllocState state = {currentPageOffset, currentPageSize, inUseList, totalBytes};
 
     mStack.push_back(state);
 
     //
     // Indicate there is no current page to allocate from.
     //
-    currentPageOffset = pageSize;
+    currentPageOffset = currentPageSize;
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     mStack.push_back({});
 #endif
@@ -205,6 +227,10 @@ void TPoolAllocator::pop()
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     tHeader *page     = mStack.back().page;
     currentPageOffset = mStack.back().offset;
+    currentPageSize   = mStack.back().currentPageSize;
+
+    size_t scopeBytes = totalBytes - mStack.back().totalBytes;
+    mHighWaterMark    = std::max(mHighWaterMark, scopeBytes);
 
     while (inUseList != page)
     {
@@ -212,17 +238,27 @@ void TPoolAllocator::pop()
         inUseList->~tHeader();
 
         tHeader *nextInUse = inUseList->nextPage;
-        if (inUseList->pageCount > 1)
-            delete[] reinterpret_cast<char *>(inUseList);
+        --mInUsePageCount;
+        if (inUseList->pageCount > 1 || inUseList->pageBytes != pageSize ||
+            mFreePageCount >= mRetainedPageLimit)
+        {
+            freePage(inUseList);
+        }
         else
         {
             inUseList->nextPage = freeList;
             freeList            = inUseList;
+            ++mFreePageCount;
         }
         inUseList = nextInUse;
     }
 
     mStack.pop_back();
+
+    if (mAdaptivePageSize)
+    {
+        adaptPageSize(mHighWaterMark);
+    }
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     for (auto &alloc : mStack.back())
     {
@@ -246,13 +282,13 @@ void *TPoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
 
-#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     //
     // Just keep some interesting statistics.
     //
     ++numCalls;
     totalBytes += numBytes;
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
     // much memory the caller asked for.  allocationSize is the total
@@ -267,7 +303,7 @@ void *TPoolAllocator::allocate(size_t numBytes)
     // Do the allocation, most likely case first, for efficiency.
     // This step could be moved to be inline sometime.
     //
-    if (allocationSize <= pageSize - currentPageOffset)
+    if (allocationSize <= currentPageSize - currentPageOffset)
     {
         //
         // Safe to allocate from currentPageOffset.
@@ -290,15 +326,16 @@ void *TPoolAllocator::allocate(size_t numBytes)
         if (numBytesToAlloc < allocationSize)
             return 0;
 
-        tHeader *memory = reinterpret_cast<tHeader *>(::new char[numBytesToAlloc]);
+        tHeader *memory = allocatePage(numBytesToAlloc);
         if (memory == 0)
             return 0;
 
         // Use placement-new to initialize header
-        new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
+        new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize, pageSize);
         inUseList = memory;
+        ++mInUsePageCount;
 
-        currentPageOffset = pageSize;  // make next allocation come from a new page
+        currentPageOffset = currentPageSize;  // make next allocation come from a new page
 
         // No guard blocks for multi-page allocations (yet)
         return reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(memory) + headerSkip);
@@ -312,25 +349,30 @@ void *TPoolAllocator::allocate(size_t numBytes)
     {
         memory   = freeList;
         freeList = freeList->nextPage;
+        --mFreePageCount;
     }
     else
     {
-        memory = reinterpret_cast<tHeader *>(::new char[pageSize]);
+        memory = allocatePage(pageSize);
         if (memory == 0)
             return 0;
     }
 
     // Use placement-new to initialize header
-    new (memory) tHeader(inUseList, 1);
+    new (memory) tHeader(inUseList, 1, pageSize);
     inUseList = memory;
+    ++mInUsePageCount;
 
     unsigned char *ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset  = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
+    currentPageSize    = pageSize;
 
     return initializeAllocation(inUseList, ret, numBytes);
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     void *alloc = malloc(numBytes + alignmentMask);
     mStack.back().push_back(alloc);
+    ++mSystemAllocations;
+    mSystemBytes += numBytes + alignmentMask;
 
     intptr_t intAlloc = reinterpret_cast<intptr_t>(alloc);
     intAlloc          = (intAlloc + alignmentMask) & ~alignmentMask;
@@ -338,6 +380,88 @@ void *TPoolAllocator::allocate(size_t numBytes)
 #endif
 }
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+TPoolAllocator::tHeader *TPoolAllocator::allocatePage(size_t numBytes)
+{
+    ++mSystemAllocations;
+    mSystemBytes += numBytes;
+    return reinterpret_cast<tHeader *>(::new char[numBytes]);
+}
+
+void TPoolAllocator::freePage(tHeader *page)
+{
+    delete[] reinterpret_cast<char *>(page);
+}
+
+//
+// Grow the page size so that a scope of scopeBytes fits in a few pages. The page size only
+// grows, so that alternating small and large compiles don't keep flushing the free list.
+//
+void TPoolAllocator::adaptPageSize(size_t scopeBytes)
+{
+    size_t targetPageSize = minPageSize;
+    while (targetPageSize < kMaxAdaptivePageSize &&
+           targetPageSize * kAdaptiveTargetPagesPerScope < scopeBytes)
+    {
+        targetPageSize <<= 1;
+    }
+
+    if (targetPageSize <= pageSize)
+        return;
+
+    pageSize = targetPageSize;
+
+    // Retained pages have the old size and can't satisfy the new granularity. Pages still in use
+    // by outer scopes are released when those scopes are popped.
+    while (freeList)
+    {
+        tHeader *next = freeList->nextPage;
+        freePage(freeList);
+        freeList = next;
+    }
+    mFreePageCount = 0;
+}
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
+void TPoolAllocator::setRetainedPageLimit(size_t maxPages)
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    mRetainedPageLimit = maxPages;
+    while (mFreePageCount > mRetainedPageLimit)
+    {
+        tHeader *next = freeList->nextPage;
+        freePage(freeList);
+        freeList = next;
+        --mFreePageCount;
+    }
+#endif
+}
+
+TPoolAllocator::Statistics TPoolAllocator::getStatistics() const
+{
+    Statistics stats;
+    stats.numAllocations    = numCalls;
+    stats.bytesAllocated    = totalBytes;
+    stats.bytesAbandoned    = mAbandonedBytes;
+    stats.highWaterMark     = mHighWaterMark;
+    stats.systemAllocations = mSystemAllocations;
+    stats.systemBytes       = mSystemBytes;
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    stats.pageSize   = pageSize;
+    stats.pagesInUse = mInUsePageCount;
+    stats.pagesFree  = mFreePageCount;
+#else
+    stats.pageSize   = 0;
+    stats.pagesInUse = 0;
+    stats.pagesFree  = 0;
+    for (const auto &allocs : mStack)
+    {
+        stats.pagesInUse += allocs.size();
+    }
+#endif
+    return stats;
+}
+
 void TPoolAllocator::lock()
 {
     ASSERT(!mLocked);
@@ -33,6 +33,7 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <type_traits>
 #include <vector>
 
 // If we are using guard blocks, we must track each indivual
@@ -163,6 +164,39 @@ class TPoolAllocator
     void lock();
     void unlock();
 
+    //
+    // Called by pool_allocator when an STL container hands back a buffer this pool served,
+    // typically because the container grew. The memory can't be reused until the enclosing pop(),
+    // so it is only accounted as abandoned.
+    //
+    void release(size_t numBytes) { mAbandonedBytes += numBytes; }
+
+    //
+    // When enabled, the page size grows after each pop() so that the largest push/pop scope seen
+    // so far fits in a handful of pages. Pages of the old size are returned to the OS.
+    //
+    void setAdaptivePageSize(bool enabled) { mAdaptivePageSize = enabled; }
+
+    //
+    // Caps the number of free pages kept for reuse after a pop(). Pages beyond the cap are
+    // returned to the OS. By default every popped page is retained.
+    //
+    void setRetainedPageLimit(size_t maxPages);
+
+    struct Statistics
+    {
+        size_t numAllocations;     // calls to allocate()
+        size_t bytesAllocated;     // bytes requested through allocate()
+        size_t bytesAbandoned;     // bytes handed back through release()
+        size_t highWaterMark;      // most bytes requested within a single push/pop scope
+        size_t pageSize;           // current granularity of allocation from the OS
+        size_t pagesInUse;         // single and multi-page blocks currently holding allocations
+        size_t pagesFree;          // single pages retained for reuse
+        size_t systemAllocations;  // blocks obtained from the OS
+        size_t systemBytes;        // bytes obtained from the OS
+    };
+    Statistics getStatistics() const;
+
   private:
     size_t alignment;  // all returned allocations will be aligned at
                        // this granularity, which will be a power of 2
@@ -173,9 +207,10 @@ class TPoolAllocator
 
     struct tHeader
     {
-        tHeader(tHeader *nextPage, size_t pageCount)
+        tHeader(tHeader *nextPage, size_t pageCount, size_t pageBytes)
             : nextPage(nextPage),
-              pageCount(pageCount)
+              pageCount(pageCount),
+              pageBytes(pageBytes)
 #ifdef GUARD_BLOCKS
               ,
               lastAllocation(0)
@@ -193,6 +228,7 @@ class TPoolAllocator
 
         tHeader *nextPage;
         size_t pageCount;
+        size_t pageBytes;  // page size at the time the block was obtained
 #ifdef GUARD_BLOCKS
         TAllocation *lastAllocation;
 #endif
@@ -201,7 +237,9 @@ class TPoolAllocator
     struct tAllocState
     {
         size_t offset;
+        size_t currentPageSize;
         tHeader *page;
+        size_t totalBytes;
     };
     typedef std::vector<tAllocState> tAllocStack;
 
@@ -216,22 +254,37 @@ class TPoolAllocator
         return TAllocation::offsetAllocation(memory);
     }
 
+    tHeader *allocatePage(size_t numBytes);
+    void freePage(tHeader *page);
+    void adaptPageSize(size_t scopeBytes);
+
     size_t pageSize;           // granularity of allocation from the OS
+    size_t minPageSize;        // page size requested at construction
     size_t headerSkip;         // amount of memory to skip to make room for the
                                //      header (basically, size of header, rounded
                                //      up to make it aligned
     size_t currentPageOffset;  // next offset in top of inUseList to allocate from
+    size_t currentPageSize;    // size of the page at the top of inUseList
     tHeader *freeList;         // list of popped memory
     tHeader *inUseList;        // list of all memory currently being used
     tAllocStack mStack;        // stack of where to allocate from, to partition pool
 
-    int numCalls;       // just an interesting statistic
-    size_t totalBytes;  // just an interesting statistic
+    size_t mFreePageCount;
+    size_t mInUsePageCount;
+    size_t mRetainedPageLimit;
 
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
 
+    size_t numCalls;
+    size_t totalBytes;
+    size_t mAbandonedBytes;
+    size_t mHighWaterMark;
+    size_t mSystemAllocations;
+    size_t mSystemBytes;
+    bool mAdaptivePageSize;
+
     TPoolAllocator &operator=(const TPoolAllocator &);  // dont allow assignment operator
     TPoolAllocator(const TPoolAllocator &);             // dont allow default copy constructor
     bool mLocked;
@@ -252,6 +305,10 @@ extern void SetGlobalPoolAllocator(TPoolAllocator *poolAllocator);
 // It will use the pools for allocation, and not
 // do any deallocation, but will still do destruction.
 //
+// The allocator binds to the global pool current at its first allocation, so
+// that a container keeps allocating from, and handing buffers back to, the
+// pool that served it. Copies of a container start unbound.
+//
 template <class T>
 class pool_allocator
 {
@@ -264,6 +321,11 @@ class pool_allocator
     typedef const T &const_reference;
     typedef T value_type;
 
+    // Buffers stay with the pool that served them when they change hands.
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
     template <class Other>
     struct rebind
     {
@@ -272,26 +334,30 @@ class pool_allocator
     pointer address(reference x) const { return &x; }
     const_pointer address(const_reference x) const { return &x; }
 
-    pool_allocator() {}
+    pool_allocator() : mAllocator(nullptr) {}
 
     template <class Other>
-    pool_allocator(const pool_allocator<Other> &p)
+    pool_allocator(const pool_allocator<Other> &p) : mAllocator(p.mAllocator)
     {
     }
 
     template <class Other>
     pool_allocator<T> &operator=(const pool_allocator<Other> &p)
     {
+        mAllocator = p.mAllocator;
         return *this;
     }
 
+    // A copied container allocates from the pool current at the copy, not from the source's.
+    pool_allocator select_on_container_copy_construction() const { return pool_allocator(); }
+
 #if defined(__SUNPRO_CC) && !defined(_RWSTD_ALLOCATOR)
     // libCStd on some platforms have a different allocate/deallocate interface.
     // Caller pre-bakes sizeof(T) into 'n' which is the number of bytes to be
     // allocated, not the number of elements.
     void *allocate(size_type n) { return getAllocator().allocate(n); }
     void *allocate(size_type n, const void *) { return getAllocator().allocate(n); }
-    void deallocate(void *, size_type) {}
+    void deallocate(void *, size_type n) { release(n); }
 #else
     pointer allocate(size_type n)
     {
@@ -301,19 +367,44 @@ class pool_allocator
     {
         return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T)));
     }
-    void deallocate(pointer, size_type) {}
+    void deallocate(pointer, size_type n) { release(n * sizeof(T)); }
 #endif  // _RWSTD_ALLOCATOR
 
     void construct(pointer p, const T &val) { new ((void *)p) T(val); }
     void destroy(pointer p) { p->T::~T(); }
 
+    // Pool memory is never handed back to the pool individually, so any allocator can release a
+    // buffer served by any other, even an unbound one.
     bool operator==(const pool_allocator &rhs) const { return true; }
     bool operator!=(const pool_allocator &rhs) const { return false; }
 
     size_type max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
     size_type max_size(int size) const { return static_cast<size_type>(-1) / size; }
 
-    TPoolAllocator &getAllocator() const { return *GetGlobalPoolAllocator(); }
+    TPoolAllocator &getAllocator()
+    {
+        if (mAllocator == nullptr)
+        {
+            mAllocator = GetGlobalPoolAllocator();
+        }
+        return *mAllocator;
+    }
+
+  private:
+    template <class Other>
+    friend class pool_allocator;
+
+    // An unbound allocator can be handed buffers of another one, for example by std::list::splice.
+    // The pool that served them isn't known then, so they aren't accounted.
+    void release(size_t numBytes)
+    {
+        if (mAllocator != nullptr)
+        {
+            mAllocator->release(numBytes);
+        }
+    }
+
+    TPoolAllocator *mAllocator;
 };
 
 #endif  // COMPILER_TRANSLATOR_POOLALLOC_H_
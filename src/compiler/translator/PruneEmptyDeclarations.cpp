@@ -93,11 +93,11 @@ bool PruneEmptyDeclarationsTraverser::visitDeclaration(Visit, TIntermDeclaration
 
                 if (mInGlobalScope)
                 {
-                    sym->getTypePointer()->setQualifier(EvqGlobal);
+                    sym->setQualifier(EvqGlobal);
                 }
                 else
                 {
-                    sym->getTypePointer()->setQualifier(EvqTemporary);
+                    sym->setQualifier(EvqTemporary);
                 }
             }
         }
@@ -13,9 +13,7 @@ namespace sh
 void RegenerateStructNames::visitSymbol(TIntermSymbol *symbol)
 {
     ASSERT(symbol);
-    TType *type = symbol->getTypePointer();
-    ASSERT(type);
-    TStructure *userType = type->getStruct();
+    TStructure *userType = symbol->getType().getStruct();
     if (!userType)
         return;
 
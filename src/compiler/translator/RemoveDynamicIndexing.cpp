@@ -9,6 +9,7 @@
 
 #include "compiler/translator/RemoveDynamicIndexing.h"
 
+#include "compiler/translator/CallDAG.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/IntermNodePatternMatcher.h"
@@ -60,7 +61,7 @@ TIntermSymbol *CreateBaseSymbol(const TType &type, TQualifier qualifier)
 {
     TIntermSymbol *symbol = new TIntermSymbol(0, "base", type);
     symbol->setInternal(true);
-    symbol->getTypePointer()->setQualifier(qualifier);
+    symbol->setQualifier(qualifier);
     return symbol;
 }
 
@@ -68,7 +69,7 @@ TIntermSymbol *CreateIndexSymbol()
 {
     TIntermSymbol *symbol = new TIntermSymbol(0, "index", TType(EbtInt, EbpHigh));
     symbol->setInternal(true);
-    symbol->getTypePointer()->setQualifier(EvqIn);
+    symbol->setQualifier(EvqIn);
     return symbol;
 }
 
@@ -76,7 +77,7 @@ TIntermSymbol *CreateValueSymbol(const TType &type)
 {
     TIntermSymbol *symbol = new TIntermSymbol(0, "value", type);
     symbol->setInternal(true);
-    symbol->getTypePointer()->setQualifier(EvqIn);
+    symbol->setQualifier(EvqIn);
     return symbol;
 }
 
@@ -290,8 +291,11 @@ TIntermFunctionDefinition *GetIndexFunctionDefinition(TType type,
 class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
 {
   public:
-    RemoveDynamicIndexingTraverser(const TSymbolTable &symbolTable, int shaderVersion);
+    RemoveDynamicIndexingTraverser(const TSymbolTable &symbolTable,
+                                   int shaderVersion,
+                                   CallGraph *callGraph);
 
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
     bool visitBinary(Visit visit, TIntermBinary *node) override;
 
     void insertHelperDefinitions(TIntermNode *root);
@@ -301,6 +305,8 @@ class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
     bool usedTreeInsertion() const { return mUsedTreeInsertion; }
 
   protected:
+    void addCall(TIntermAggregate *call);
+
     // Maps of types that are indexed to the indexing function ids used for them. Note that these
     // can not store multiple variants of the same type with different precisions - only one
     // precision gets stored.
@@ -309,6 +315,9 @@ class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
 
     bool mUsedTreeInsertion;
 
+    CallGraph *mCallGraph;
+    const TFunctionSymbolInfo *mCurrentFunction;
+
     // When true, the traverser will remove side effects from any indexing expression.
     // This is done so that in code like
     //   V[j++][i]++.
@@ -317,13 +326,23 @@ class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
 };
 
 RemoveDynamicIndexingTraverser::RemoveDynamicIndexingTraverser(const TSymbolTable &symbolTable,
-                                                               int shaderVersion)
+                                                               int shaderVersion,
+                                                               CallGraph *callGraph)
     : TLValueTrackingTraverser(true, false, false, symbolTable, shaderVersion),
       mUsedTreeInsertion(false),
+      mCallGraph(callGraph),
+      mCurrentFunction(nullptr),
       mRemoveIndexSideEffectsInSubtree(false)
 {
 }
 
+bool RemoveDynamicIndexingTraverser::visitFunctionDefinition(Visit visit,
+                                                             TIntermFunctionDefinition *node)
+{
+    mCurrentFunction = node->getFunctionSymbolInfo();
+    return true;
+}
+
 void RemoveDynamicIndexingTraverser::insertHelperDefinitions(TIntermNode *root)
 {
     TIntermBlock *rootBlock = root->getAsBlock();
@@ -337,9 +356,22 @@ void RemoveDynamicIndexingTraverser::insertHelperDefinitions(TIntermNode *root)
     {
         insertions.push_back(GetIndexFunctionDefinition(type.first, true, type.second));
     }
+    for (TIntermNode *definition : insertions)
+    {
+        mCallGraph->addFunctionDefinition(definition->getAsFunctionDefinition());
+    }
     mInsertions.push_back(NodeInsertMultipleEntry(rootBlock, 0, insertions, TIntermSequence()));
 }
 
+void RemoveDynamicIndexingTraverser::addCall(TIntermAggregate *call)
+{
+    // Calls in global initializers aren't part of the call graph.
+    if (!mInGlobalScope)
+    {
+        mCallGraph->addCall(*mCurrentFunction, *call->getFunctionSymbolInfo());
+    }
+}
+
 // Create a call to dyn_index_*() based on an indirect indexing op node
 TIntermAggregate *CreateIndexFunctionCall(TIntermBinary *node,
                                           TIntermTyped *index,
@@ -484,6 +516,7 @@ bool RemoveDynamicIndexingTraverser::visitBinary(Visit visit, TIntermBinary *nod
 
                 TIntermAggregate *indexingCall =
                     CreateIndexFunctionCall(node, tempIndex, indexingFunctionId);
+                addCall(indexingCall);
 
                 nextTemporaryIndex();  // From now on, creating temporary symbols that refer to the
                                        // field value.
@@ -491,6 +524,7 @@ bool RemoveDynamicIndexingTraverser::visitBinary(Visit visit, TIntermBinary *nod
 
                 TIntermAggregate *indexedWriteCall = CreateIndexedWriteFunctionCall(
                     node, tempIndex, createTempSymbol(fieldType), indexedWriteFunctionId);
+                addCall(indexedWriteCall);
                 insertionsAfter.push_back(indexedWriteCall);
                 insertStatementsInParentBlock(insertionsBefore, insertionsAfter);
                 queueReplacement(node, createTempSymbol(fieldType), OriginalNode::IS_DROPPED);
@@ -506,6 +540,7 @@ bool RemoveDynamicIndexingTraverser::visitBinary(Visit visit, TIntermBinary *nod
                 ASSERT(!mRemoveIndexSideEffectsInSubtree);
                 TIntermAggregate *indexingCall = CreateIndexFunctionCall(
                     node, EnsureSignedInt(node->getRight()), indexingFunctionId);
+                addCall(indexingCall);
                 queueReplacement(node, indexingCall, OriginalNode::IS_DROPPED);
             }
         }
@@ -525,9 +560,10 @@ void RemoveDynamicIndexingTraverser::nextIteration()
 void RemoveDynamicIndexing(TIntermNode *root,
                            unsigned int *temporaryIndex,
                            const TSymbolTable &symbolTable,
-                           int shaderVersion)
+                           int shaderVersion,
+                           CallGraph *callGraph)
 {
-    RemoveDynamicIndexingTraverser traverser(symbolTable, shaderVersion);
+    RemoveDynamicIndexingTraverser traverser(symbolTable, shaderVersion, callGraph);
     ASSERT(temporaryIndex != nullptr);
     traverser.useTemporaryIndex(temporaryIndex);
     do
@@ -13,13 +13,16 @@
 namespace sh
 {
 
+class CallGraph;
 class TIntermNode;
 class TSymbolTable;
 
+// The helper functions and the calls to them are recorded in callGraph.
 void RemoveDynamicIndexing(TIntermNode *root,
                            unsigned int *temporaryIndex,
                            const TSymbolTable &symbolTable,
-                           int shaderVersion);
+                           int shaderVersion,
+                           CallGraph *callGraph);
 
 }  // namespace sh
 
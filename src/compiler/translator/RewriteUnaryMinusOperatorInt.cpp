@@ -89,7 +89,7 @@ bool Traverser::visitUnary(Visit visit, TIntermUnary *node)
         one->setUConst(1u);
     }
     TIntermConstantUnion *oneNode = new TIntermConstantUnion(one, opr->getType());
-    oneNode->getTypePointer()->setQualifier(EvqConst);
+    oneNode->setQualifier(EvqConst);
     oneNode->setLine(opr->getLine());
 
     // ~(int) + 1
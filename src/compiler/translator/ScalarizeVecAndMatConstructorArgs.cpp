@@ -215,8 +215,8 @@ void ScalarizeArgsTraverser::createTempVariable(TIntermTyped *original)
         // to avoid computing the actual precision using the rules defined
         // in GLSL ES 1.0 Section 4.5.2.
         TIntermBinary *init = decl->getSequence()->at(0)->getAsBinaryNode();
-        init->getTypePointer()->setPrecision(mFragmentPrecisionHigh ? EbpHigh : EbpMedium);
-        init->getLeft()->getTypePointer()->setPrecision(mFragmentPrecisionHigh ? EbpHigh
+        init->setPrecision(mFragmentPrecisionHigh ? EbpHigh : EbpMedium);
+        init->getLeft()->setPrecision(mFragmentPrecisionHigh ? EbpHigh
                                                                                : EbpMedium);
     }
 
@@ -430,4 +430,41 @@ const std::map<std::string, unsigned int> *GetUniformRegisterMap(const ShHandle
 #endif  // ANGLE_ENABLE_HLSL
 }
 
+const std::vector<ShCompileStageStatistics> &GetCompileStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    return compiler->getCompileStatistics();
+}
+
+ShPoolAllocatorStatistics GetPoolAllocatorStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    TPoolAllocator::Statistics poolStats = compiler->getPoolAllocator().getStatistics();
+
+    ShPoolAllocatorStatistics stats;
+    stats.numAllocations    = poolStats.numAllocations;
+    stats.bytesAllocated    = poolStats.bytesAllocated;
+    stats.bytesAbandoned    = poolStats.bytesAbandoned;
+    stats.highWaterMark     = poolStats.highWaterMark;
+    stats.pageSize          = poolStats.pageSize;
+    stats.pagesInUse        = poolStats.pagesInUse;
+    stats.pagesFree         = poolStats.pagesFree;
+    stats.systemAllocations = poolStats.systemAllocations;
+    stats.systemBytes       = poolStats.systemBytes;
+    return stats;
+}
+
+void SetPoolAllocatorOptions(const ShHandle handle, const ShPoolAllocatorOptions &options)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    TPoolAllocator &allocator = compiler->getPoolAllocator();
+    allocator.setAdaptivePageSize(options.adaptivePageSize);
+    allocator.setRetainedPageLimit(options.maxRetainedPages);
+}
+
 }  // namespace sh
@@ -82,7 +82,7 @@ const TString *TFunction::buildMangledName() const
 
     for (const auto &p : parameters)
     {
-        newName += p.type->getMangledName().c_str();
+        newName += p.type->getMangledName();
     }
     return NewPoolTString(newName.c_str());
 }
@@ -95,7 +95,7 @@ const TString &TFunction::GetMangledNameFromCall(const TString &functionName,
 
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName().c_str();
+        newName += argument->getAsTyped()->getType().getMangledName();
     }
     return *NewPoolTString(newName.c_str());
 }
@@ -321,11 +321,16 @@ class TSymbolTable : angle::NonCopyable
 
     bool declare(TSymbol *symbol) { return insert(currentLevel(), symbol); }
 
-    bool insert(ESymbolLevel level, TSymbol *symbol) { return table[level]->insert(symbol); }
+    bool insert(ESymbolLevel level, TSymbol *symbol)
+    {
+        realizeBuiltInType(level, symbol);
+        return table[level]->insert(symbol);
+    }
 
     bool insert(ESymbolLevel level, const char *ext, TSymbol *symbol)
     {
         symbol->relateToExtension(ext);
+        realizeBuiltInType(level, symbol);
         return table[level]->insert(symbol);
     }
 
@@ -495,6 +500,17 @@ class TSymbolTable : angle::NonCopyable
   private:
     ESymbolLevel currentLevel() const { return static_cast<ESymbolLevel>(table.size() - 1); }
 
+    // Built-in symbols outlive every compile, while the mangled name of a type is allocated from
+    // whichever pool is current when it is first needed. Build it while the built-in pool is
+    // current so that it doesn't point into the pool of a compile that has since been popped.
+    static void realizeBuiltInType(ESymbolLevel level, TSymbol *symbol)
+    {
+        if (level <= LAST_BUILTIN_LEVEL && symbol->isVariable())
+        {
+            static_cast<TVariable *>(symbol)->getType().realize();
+        }
+    }
+
     // Used to insert unmangled functions to check redeclaration of built-ins in ESSL 3.00 and
     // above.
     void insertUnmangledBuiltInName(const char *name, ESymbolLevel level);
@@ -73,7 +73,8 @@ void TranslatorHLSL::translate(TIntermBlock *root, ShCompileOptions compileOptio
     if (!shouldRunLoopAndIndexingValidation(compileOptions))
     {
         // HLSL doesn't support dynamic indexing of vectors and matrices.
-        RemoveDynamicIndexing(root, getTemporaryIndex(), getSymbolTable(), getShaderVersion());
+        RemoveDynamicIndexing(root, getTemporaryIndex(), getSymbolTable(), getShaderVersion(),
+                              getCallGraph());
     }
 
     // Work around D3D9 bug that would manifest in vertex shaders with selection blocks which
@@ -121,7 +122,7 @@ void TranslatorHLSL::translate(TIntermBlock *root, ShCompileOptions compileOptio
                               getSourcePath(), getOutputType(), numRenderTargets, getUniforms(),
                               compileOptions);
 
-    outputHLSL.output(root, getInfoSink().obj);
+    outputHLSL.output(root, *getCallGraph(), getInfoSink().obj);
 
     mInterfaceBlockRegisterMap = outputHLSL.getInterfaceBlockRegisterMap();
     mUniformRegisterMap        = outputHLSL.getUniformRegisterMap();
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 
 namespace sh
 {
@@ -123,7 +124,8 @@ TType::TType(const TPublicType &p)
       array(p.array),
       arraySize(p.arraySize),
       interfaceBlock(0),
-      structure(0)
+      structure(0),
+      mangled(nullptr)
 {
     ASSERT(primarySize <= 4);
     ASSERT(secondarySize <= 4);
@@ -291,7 +293,7 @@ TString TType::getCompleteString() const
 //
 // Recursively generate mangled names.
 //
-TString TType::buildMangledName() const
+const char *TType::buildMangledName() const
 {
     TString mangledName;
     if (isMatrix())
@@ -445,7 +447,13 @@ TString TType::buildMangledName() const
         mangledName += buf;
         mangledName += ']';
     }
-    return mangledName;
+    mangledName += ';';
+
+    // Keep only a pointer in the type so that copying it doesn't copy the string.
+    char *mangledChars =
+        static_cast<char *>(GetGlobalPoolAllocator()->allocate(mangledName.size() + 1));
+    memcpy(mangledChars, mangledName.c_str(), mangledName.size() + 1);
+    return mangledChars;
 }
 
 size_t TType::getObjectSize() const
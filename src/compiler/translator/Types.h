@@ -203,7 +203,8 @@ class TType
           array(false),
           arraySize(0),
           interfaceBlock(nullptr),
-          structure(nullptr)
+          structure(nullptr),
+          mangled(nullptr)
     {
     }
     explicit TType(TBasicType t, unsigned char ps = 1, unsigned char ss = 1)
@@ -218,7 +219,8 @@ class TType
           array(false),
           arraySize(0),
           interfaceBlock(0),
-          structure(0)
+          structure(0),
+          mangled(nullptr)
     {
     }
     TType(TBasicType t,
@@ -238,7 +240,8 @@ class TType
           array(a),
           arraySize(0),
           interfaceBlock(0),
-          structure(0)
+          structure(0),
+          mangled(nullptr)
     {
     }
     explicit TType(const TPublicType &p);
@@ -254,7 +257,8 @@ class TType
           array(false),
           arraySize(0),
           interfaceBlock(0),
-          structure(userDef)
+          structure(userDef),
+          mangled(nullptr)
     {
     }
     TType(TInterfaceBlock *interfaceBlockIn,
@@ -272,7 +276,8 @@ class TType
           array(arraySizeIn > 0),
           arraySize(arraySizeIn),
           interfaceBlock(interfaceBlockIn),
-          structure(0)
+          structure(0),
+          mangled(nullptr)
     {
     }
 
@@ -394,12 +399,11 @@ class TType
         }
     }
 
-    const TString &getMangledName() const
+    const char *getMangledName() const
     {
-        if (mangled.empty())
+        if (mangled == nullptr)
         {
             mangled = buildMangledName();
-            mangled += ';';
         }
 
         return mangled;
@@ -489,8 +493,8 @@ class TType
     void realize() { getMangledName(); }
 
   private:
-    void invalidateMangledName() { mangled = ""; }
-    TString buildMangledName() const;
+    void invalidateMangledName() { mangled = nullptr; }
+    const char *buildMangledName() const;
 
     TBasicType type;
     TPrecision precision;
@@ -509,7 +513,8 @@ class TType
     // 0 unless this is a struct
     TStructure *structure;
 
-    mutable TString mangled;
+    // Built on demand in the pool and shared by copies of the type.
+    mutable const char *mangled;
 };
 
 // TTypeSpecifierNonArray stores all of the necessary fields for type_specifier_nonarray from the
@@ -1409,7 +1409,7 @@ expression_statement
 selection_statement
     : IF LEFT_PAREN expression RIGHT_PAREN selection_rest_statement {
         context->checkIsScalarBool(@1, $3);
-        $$ = context->intermediate.addIfElse($3, $5, @1);
+        $$ = context->addIfElse($3, $5, @1);
     }
     ;
 
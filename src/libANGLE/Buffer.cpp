@@ -35,7 +35,9 @@ BufferState::~BufferState()
 }
 
 Buffer::Buffer(rx::GLImplFactory *factory, GLuint id)
-    : RefCountObject(id), mImpl(factory->createBuffer(mState))
+    : RefCountObject(id),
+      mImpl(factory->createBuffer(mState)),
+      mMemoryCharge(MemoryCategory::Buffer)
 {
 }
 
@@ -85,6 +87,7 @@ Error Buffer::bufferData(const Context *context,
     mIndexRangeCache.clear();
     mState.mUsage = usage;
     mState.mSize  = size;
+    mMemoryCharge.update(context, static_cast<uint64_t>(size));
 
     return NoError();
 }
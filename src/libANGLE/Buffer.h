@@ -15,6 +15,7 @@
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/MemoryTracker.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace rx
@@ -114,6 +115,8 @@ class Buffer final : public RefCountObject, public LabeledObject
     rx::BufferImpl *mImpl;
 
     mutable IndexRangeCache mIndexRangeCache;
+
+    MemoryCharge mMemoryCharge;
 };
 
 }  // namespace gl
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <tuple>
 
 static void InsertExtensionString(const std::string &extension, bool supported, std::vector<std::string> *extensionVector)
 {
@@ -217,7 +218,9 @@ Extensions::Extensions()
       pathRendering(false),
       surfacelessContext(false),
       clientArrays(false),
-      robustResourceInitialization(false)
+      robustResourceInitialization(false),
+      multiDraw(false),
+      memoryAccounting(false)
 {
 }
 
@@ -685,6 +688,8 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_OES_surfaceless_context"] = esOnlyExtension(&Extensions::surfacelessContext);
         map["GL_ANGLE_client_arrays"] = esOnlyExtension(&Extensions::clientArrays);
         map["GL_ANGLE_robust_resource_initialization"] = esOnlyExtension(&Extensions::robustResourceInitialization);
+        map["GL_ANGLE_multi_draw"] = enableableExtension(&Extensions::multiDraw);
+        map["GL_ANGLE_memory_accounting"] = esOnlyExtension(&Extensions::memoryAccounting);
         // clang-format on
 
         return map;
@@ -1031,6 +1036,46 @@ Caps GenerateMinimumCaps(const Version &clientVersion)
 
     return caps;
 }
+
+CapsSnapshot::CapsSnapshot() : extensionString(""), requestableExtensionString("")
+{
+}
+
+CapsSnapshotKey::CapsSnapshotKey(const Version &clientVersionIn, bool webGLIn, bool noErrorIn)
+    : clientVersion(clientVersionIn), webGL(webGLIn), noError(noErrorIn)
+{
+}
+
+bool operator<(const CapsSnapshotKey &a, const CapsSnapshotKey &b)
+{
+    return std::tie(a.clientVersion, a.webGL, a.noError) <
+           std::tie(b.clientVersion, b.webGL, b.noError);
+}
+
+CapsSnapshotCache::CapsSnapshotCache()
+{
+}
+
+CapsSnapshotCache::~CapsSnapshotCache()
+{
+}
+
+std::shared_ptr<const CapsSnapshot> CapsSnapshotCache::get(const CapsSnapshotKey &key) const
+{
+    auto iter = mSnapshots.find(key);
+    return (iter != mSnapshots.end()) ? iter->second : nullptr;
+}
+
+void CapsSnapshotCache::insert(const CapsSnapshotKey &key,
+                               std::shared_ptr<const CapsSnapshot> snapshot)
+{
+    mSnapshots[key] = std::move(snapshot);
+}
+
+void CapsSnapshotCache::clear()
+{
+    mSnapshots.clear();
+}
 }
 
 namespace egl
@@ -1075,7 +1120,9 @@ DisplayExtensions::DisplayExtensions()
       pixelFormatFloat(false),
       surfacelessContext(false),
       displayTextureShareGroup(false),
-      createContextClientArrays(false)
+      createContextClientArrays(false),
+      createContextMemoryBudget(false),
+      createContextMultithreadedShareGroup(false)
 {
 }
 
@@ -1118,6 +1165,8 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_KHR_surfaceless_context",                         surfacelessContext,                 &extensionStrings);
     InsertExtensionString("EGL_ANGLE_display_texture_share_group",               displayTextureShareGroup,           &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_client_arrays",              createContextClientArrays,          &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_create_context_memory_budget",              createContextMemoryBudget,          &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_create_context_multithreaded_share_group",  createContextMultithreadedShareGroup, &extensionStrings);
     // TODO(jmadill): Enable this when complete.
     //InsertExtensionString("KHR_create_context_no_error",                       createContextNoError,               &extensionStrings);
     // clang-format on
@@ -1153,7 +1202,8 @@ ClientExtensions::ClientExtensions()
       x11Visual(false),
       experimentalPresentPath(false),
       clientGetAllProcAddresses(false),
-      displayRobustResourceInitialization(false)
+      displayRobustResourceInitialization(false),
+      displayTraceRecorder(false)
 {
 }
 
@@ -1177,6 +1227,7 @@ std::vector<std::string> ClientExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_experimental_present_path",   experimentalPresentPath,   &extensionStrings);
     InsertExtensionString("EGL_KHR_client_get_all_proc_addresses", clientGetAllProcAddresses, &extensionStrings);
     InsertExtensionString("EGL_ANGLE_display_robust_resource_initialization", displayRobustResourceInitialization, &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_display_trace_recorder",      displayTraceRecorder,      &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -12,6 +12,7 @@
 #include "libANGLE/Version.h"
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -363,6 +364,12 @@ struct Extensions
 
     // GL_ANGLE_robust_resource_initialization
     bool robustResourceInitialization;
+
+    // GL_ANGLE_multi_draw
+    bool multiDraw;
+
+    // GL_ANGLE_memory_accounting
+    bool memoryAccounting;
 };
 
 struct ExtensionInfo
@@ -546,6 +553,50 @@ struct Caps
 };
 
 Caps GenerateMinimumCaps(const Version &clientVersion);
+
+// The caps, texture caps, extensions and limitations of a context together with the extension
+// strings generated from them. Immutable once built, so contexts of a display that were created
+// with the same attributes share one instead of each computing their own.
+struct CapsSnapshot
+{
+    CapsSnapshot();
+
+    Caps caps;
+    TextureCapsMap textureCaps;
+    Extensions extensions;
+    Limitations limitations;
+
+    std::vector<const char *> extensionStrings;
+    const char *extensionString;
+    std::vector<const char *> requestableExtensionStrings;
+    const char *requestableExtensionString;
+};
+
+// The context attributes a CapsSnapshot depends on.
+struct CapsSnapshotKey
+{
+    CapsSnapshotKey(const Version &clientVersion, bool webGL, bool noError);
+
+    Version clientVersion;
+    bool webGL;
+    bool noError;
+};
+
+bool operator<(const CapsSnapshotKey &a, const CapsSnapshotKey &b);
+
+class CapsSnapshotCache final : angle::NonCopyable
+{
+  public:
+    CapsSnapshotCache();
+    ~CapsSnapshotCache();
+
+    std::shared_ptr<const CapsSnapshot> get(const CapsSnapshotKey &key) const;
+    void insert(const CapsSnapshotKey &key, std::shared_ptr<const CapsSnapshot> snapshot);
+    void clear();
+
+  private:
+    std::map<CapsSnapshotKey, std::shared_ptr<const CapsSnapshot>> mSnapshots;
+};
 }
 
 namespace egl
@@ -667,6 +718,12 @@ struct DisplayExtensions
 
     // EGL_ANGLE_create_context_client_arrays
     bool createContextClientArrays;
+
+    // EGL_ANGLE_create_context_memory_budget
+    bool createContextMemoryBudget;
+
+    // EGL_ANGLE_create_context_multithreaded_share_group
+    bool createContextMultithreadedShareGroup;
 };
 
 struct DeviceExtensions
@@ -728,6 +785,9 @@ struct ClientExtensions
 
     // EGL_ANGLE_display_robust_resource_initialization
     bool displayRobustResourceInitialization;
+
+    // EGL_ANGLE_display_trace_recorder
+    bool displayTraceRecorder;
 };
 
 }  // namespace egl
@@ -0,0 +1,106 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CapsSnapshot_unittest.cpp:
+//   Tests that contexts created with the same attributes share their caps through a
+//   CapsSnapshotCache, and that requesting an extension does not affect the other contexts.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/null/ContextNULL.h"
+#include "tests/test_utils/TestContextFactory.h"
+
+namespace
+{
+
+// A NULL context that can also enable a requestable extension.
+class RequestableContextNULL : public rx::ContextNULL
+{
+  public:
+    RequestableContextNULL(const gl::ContextState &state,
+                           rx::AllocationTrackerNULL *allocationTracker)
+        : rx::ContextNULL(state, allocationTracker),
+          mNativeExtensions(rx::ContextNULL::getNativeExtensions())
+    {
+        mNativeExtensions.textureFloat = true;
+    }
+
+    const gl::Extensions &getNativeExtensions() const override { return mNativeExtensions; }
+
+  private:
+    gl::Extensions mNativeExtensions;
+};
+
+class CapsSnapshotTest : public testing::Test
+{
+  protected:
+    CapsSnapshotTest()
+        : mAllocationTracker(1 << 28),
+          mContextFactory([this](const gl::ContextState &state) {
+              return new RequestableContextNULL(state, &mAllocationTracker);
+          })
+    {
+    }
+
+    gl::Context *createContext(EGLint clientVersion, bool webGL)
+    {
+        egl::AttributeMap attribs;
+        attribs.insert(EGL_CONTEXT_CLIENT_VERSION, clientVersion);
+        attribs.insert(EGL_CONTEXT_WEBGL_COMPATIBILITY_ANGLE, webGL ? EGL_TRUE : EGL_FALSE);
+        return mContextFactory.createContext(attribs, &mCache, false);
+    }
+
+    rx::AllocationTrackerNULL mAllocationTracker;
+    gl::CapsSnapshotCache mCache;
+    angle::TestContextFactory mContextFactory;
+};
+
+// Contexts created with the same attributes use the same caps.
+TEST_F(CapsSnapshotTest, SameAttributesShareCaps)
+{
+    gl::Context *first  = createContext(3, false);
+    gl::Context *second = createContext(3, false);
+
+    EXPECT_EQ(&first->getCaps(), &second->getCaps());
+    EXPECT_EQ(&first->getTextureCaps(), &second->getTextureCaps());
+    EXPECT_EQ(&first->getExtensions(), &second->getExtensions());
+    EXPECT_EQ(first->getString(GL_EXTENSIONS), second->getString(GL_EXTENSIONS));
+}
+
+// Contexts that differ in an attribute the caps depend on get their own caps.
+TEST_F(CapsSnapshotTest, DifferentAttributesDoNotShareCaps)
+{
+    gl::Context *es2   = createContext(2, false);
+    gl::Context *es3   = createContext(3, false);
+    gl::Context *webGL = createContext(2, true);
+
+    EXPECT_NE(&es2->getCaps(), &es3->getCaps());
+    EXPECT_NE(&es2->getCaps(), &webGL->getCaps());
+    EXPECT_FALSE(es2->getExtensions().webglCompatibility);
+    EXPECT_TRUE(webGL->getExtensions().webglCompatibility);
+}
+
+// Requesting an extension only changes the caps of the requesting context.
+TEST_F(CapsSnapshotTest, RequestExtensionIsPrivate)
+{
+    gl::Context *first  = createContext(2, true);
+    gl::Context *second = createContext(2, true);
+    ASSERT_FALSE(first->getExtensions().textureFloat);
+    ASSERT_EQ(1u, first->getRequestableExtensionStringCount());
+
+    first->requestExtension("GL_OES_texture_float");
+
+    EXPECT_TRUE(first->getExtensions().textureFloat);
+    EXPECT_EQ(0u, first->getRequestableExtensionStringCount());
+    EXPECT_FALSE(second->getExtensions().textureFloat);
+    EXPECT_EQ(1u, second->getRequestableExtensionStringCount());
+
+    // New contexts still get the shared caps.
+    gl::Context *third = createContext(2, true);
+    EXPECT_EQ(&second->getCaps(), &third->getCaps());
+}
+
+}  // anonymous namespace
@@ -29,8 +29,12 @@ enum
         IMPLEMENTATION_MAX_VERTEX_SHADER_UNIFORM_BUFFERS +
         IMPLEMENTATION_MAX_FRAGMENT_SHADER_UNIFORM_BUFFERS,
 
+    IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS = 64,
+
     IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS = 4,
 
+    IMPLEMENTATION_MAX_ACTIVE_TEXTURES = 64,
+
     // These are the maximums the implementation can support
     // The actual GL caps are limited by the device caps
     // and should be queried from the Context
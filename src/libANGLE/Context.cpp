@@ -35,12 +35,27 @@
 #include "libANGLE/TransformFeedback.h"
 #include "libANGLE/VertexArray.h"
 #include "libANGLE/Workarounds.h"
+#include "libANGLE/dispatch_table_autogen.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/queryconversions.h"
 #include "libANGLE/queryutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
 #include "libANGLE/validationES.h"
+#include "third_party/trace_event/trace_event.h"
+
+// Reports a failed Error on the context and returns from the calling entry point.
+#define ANGLE_CONTEXT_TRY(EXPR)      \
+    {                                \
+        auto localError = EXPR;      \
+        if (localError.isError())    \
+        {                            \
+            handleError(localError); \
+            return;                  \
+        }                            \
+    }                                \
+    ANGLE_EMPTY_STATEMENT
 
 namespace
 {
@@ -199,11 +214,21 @@ bool GetBindGeneratesResource(const egl::AttributeMap &attribs)
     return (attribs.get(EGL_CONTEXT_BIND_GENERATES_RESOURCE_CHROMIUM, EGL_TRUE) == EGL_TRUE);
 }
 
+bool GetMultithreadedShareGroup(const egl::AttributeMap &attribs)
+{
+    return (attribs.get(EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, EGL_FALSE) == EGL_TRUE);
+}
+
 bool GetClientArraysEnabled(const egl::AttributeMap &attribs)
 {
     return (attribs.get(EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE, EGL_TRUE) == EGL_TRUE);
 }
 
+uint64_t GetMemoryBudget(const egl::AttributeMap &attribs)
+{
+    return static_cast<uint64_t>(attribs.get(EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE, 0)) * 1024u;
+}
+
 std::string GetObjectLabelFromPointer(GLsizei length, const GLchar *label)
 {
     std::string labelName;
@@ -234,6 +259,14 @@ void GetObjectLabelBase(const std::string &objectLabel,
     }
 }
 
+// The context state is built before the implementation that provides the real caps, so it starts
+// out pointing at these.
+const gl::CapsSnapshot &GetEmptyCapsSnapshot()
+{
+    static const gl::CapsSnapshot *emptySnapshot = new gl::CapsSnapshot();
+    return *emptySnapshot;
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -243,6 +276,7 @@ Context::Context(rx::EGLImplFactory *implFactory,
                  const egl::Config *config,
                  const Context *shareContext,
                  TextureManager *shareTextures,
+                 CapsSnapshotCache *capsCache,
                  const egl::AttributeMap &attribs,
                  const egl::DisplayExtensions &displayExtensions,
                  bool robustResourceInit)
@@ -251,10 +285,10 @@ Context::Context(rx::EGLImplFactory *implFactory,
                         shareTextures,
                         GetClientVersion(attribs),
                         &mGLState,
-                        mCaps,
-                        mTextureCaps,
-                        mExtensions,
-                        mLimitations,
+                        GetEmptyCapsSnapshot().caps,
+                        GetEmptyCapsSnapshot().textureCaps,
+                        GetEmptyCapsSnapshot().extensions,
+                        GetEmptyCapsSnapshot().limitations,
                         GetNoError(attribs)),
       mImplementation(implFactory->createContext(mState)),
       mCompiler(nullptr),
@@ -269,6 +303,8 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mCurrentSurface(nullptr),
       mSurfacelessFramebuffer(nullptr),
       mWebGLContext(GetWebGLContext(attribs)),
+      mMultithreadedShareGroup(GetMultithreadedShareGroup(attribs)),
+      mDispatchTable(GetNoError(attribs) ? &kNoErrorDispatchTable : &kValidatedDispatchTable),
       mScratchBuffer(1000u)
 {
     if (mRobustAccess)
@@ -276,64 +312,59 @@ Context::Context(rx::EGLImplFactory *implFactory,
         UNIMPLEMENTED();
     }
 
-    initCaps(displayExtensions);
+    // The managers are new and not used by another thread yet. The contexts that share them were
+    // validated to be created with the same attribute.
+    if (mMultithreadedShareGroup && shareContext == nullptr)
+    {
+        mState.mBuffers->enableLocking();
+        mState.mShaderPrograms->enableLocking();
+        mState.mTextures->enableLocking();
+        mState.mRenderbuffers->enableLocking();
+        mState.mSamplers->enableLocking();
+        mState.mFenceSyncs->enableLocking();
+        mState.mPaths->enableLocking();
+    }
+
+    // Contexts share their objects with their share context, and so their share group tracker.
+    mMemoryTracker = std::make_shared<MemoryTracker>(
+        shareContext ? shareContext->getMemoryTracker()->getShareGroup()
+                     : std::make_shared<MemoryTracker>(nullptr));
+    uint64_t memoryBudget = GetMemoryBudget(attribs);
+    if (memoryBudget != 0)
+    {
+        mMemoryTracker->setBudget(memoryBudget, [this](uint64_t total, uint64_t budget) {
+            onMemoryBudgetExceeded(total, budget);
+        });
+    }
+
+    initCaps(displayExtensions, capsCache);
     initWorkarounds();
 
-    mGLState.initialize(mCaps, mExtensions, getClientVersion(), GetDebug(attribs),
+    mGLState.initialize(getCaps(), getExtensions(), getClientVersion(), GetDebug(attribs),
                         GetBindGeneratesResource(attribs), GetClientArraysEnabled(attribs),
                         robustResourceInit);
 
     mFenceNVHandleAllocator.setBaseHandle(0);
 
-    // [OpenGL ES 2.0.24] section 3.7 page 83:
-    // In the initial state, TEXTURE_2D and TEXTURE_CUBE_MAP have twodimensional
-    // and cube map texture state vectors respectively associated with them.
-    // In order that access to these initial textures not be lost, they are treated as texture
-    // objects all of whose names are 0.
-
-    Texture *zeroTexture2D = new Texture(mImplementation.get(), 0, GL_TEXTURE_2D);
-    mZeroTextures[GL_TEXTURE_2D].set(zeroTexture2D);
-
-    Texture *zeroTextureCube = new Texture(mImplementation.get(), 0, GL_TEXTURE_CUBE_MAP);
-    mZeroTextures[GL_TEXTURE_CUBE_MAP].set(zeroTextureCube);
+    // The zero textures are created by the state when they are first used. Most contexts never
+    // touch most texture targets.
+    mGLState.setZeroTextureFactory(mImplementation.get());
 
-    if (getClientVersion() >= Version(3, 0))
-    {
-        // TODO: These could also be enabled via extension
-        Texture *zeroTexture3D = new Texture(mImplementation.get(), 0, GL_TEXTURE_3D);
-        mZeroTextures[GL_TEXTURE_3D].set(zeroTexture3D);
-
-        Texture *zeroTexture2DArray = new Texture(mImplementation.get(), 0, GL_TEXTURE_2D_ARRAY);
-        mZeroTextures[GL_TEXTURE_2D_ARRAY].set(zeroTexture2DArray);
-    }
     if (getClientVersion() >= Version(3, 1))
     {
-        Texture *zeroTexture2DMultisample =
-            new Texture(mImplementation.get(), 0, GL_TEXTURE_2D_MULTISAMPLE);
-        mZeroTextures[GL_TEXTURE_2D_MULTISAMPLE].set(zeroTexture2DMultisample);
-
         bindGenericAtomicCounterBuffer(0);
-        for (unsigned int i = 0; i < mCaps.maxAtomicCounterBufferBindings; i++)
+        for (unsigned int i = 0; i < getCaps().maxAtomicCounterBufferBindings; i++)
         {
             bindIndexedAtomicCounterBuffer(0, i, 0, 0);
         }
 
         bindGenericShaderStorageBuffer(0);
-        for (unsigned int i = 0; i < mCaps.maxShaderStorageBufferBindings; i++)
+        for (unsigned int i = 0; i < getCaps().maxShaderStorageBufferBindings; i++)
         {
             bindIndexedShaderStorageBuffer(0, i, 0, 0);
         }
     }
 
-    if (mExtensions.eglImageExternal || mExtensions.eglStreamConsumerExternal)
-    {
-        Texture *zeroTextureExternal =
-            new Texture(mImplementation.get(), 0, GL_TEXTURE_EXTERNAL_OES);
-        mZeroTextures[GL_TEXTURE_EXTERNAL_OES].set(zeroTextureExternal);
-    }
-
-    mGLState.initializeZeroTextures(mZeroTextures);
-
     bindVertexArray(0);
     bindArrayBuffer(0);
     bindDrawIndirectBuffer(0);
@@ -342,7 +373,7 @@ Context::Context(rx::EGLImplFactory *implFactory,
     bindRenderbuffer(GL_RENDERBUFFER, 0);
 
     bindGenericUniformBuffer(0);
-    for (unsigned int i = 0; i < mCaps.maxUniformBufferBindings; i++)
+    for (unsigned int i = 0; i < getCaps().maxUniformBufferBindings; i++)
     {
         bindIndexedUniformBuffer(0, i, 0, -1);
     }
@@ -407,6 +438,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
 
 void Context::destroy(egl::Display *display)
 {
+    // Objects may outlive the context and still release their memory to its tracker.
+    mMemoryTracker->setBudget(0, nullptr);
+
     mGLState.reset(this);
 
     for (auto fence : mFenceNVMap)
@@ -435,12 +469,6 @@ void Context::destroy(egl::Display *display)
         }
     }
 
-    for (auto &zeroTexture : mZeroTextures)
-    {
-        zeroTexture.second.set(nullptr);
-    }
-    mZeroTextures.clear();
-
     SafeDelete(mSurfacelessFramebuffer);
 
     releaseSurface(display);
@@ -467,7 +495,6 @@ void Context::makeCurrent(egl::Display *display, egl::Surface *surface)
     {
         initRendererString();
         initVersionStrings();
-        initExtensionStrings();
 
         int width  = 0;
         int height = 0;
@@ -565,7 +592,7 @@ GLuint Context::createProgram()
 
 GLuint Context::createShader(GLenum type)
 {
-    return mState.mShaderPrograms->createShader(mImplementation.get(), mLimitations, type);
+    return mState.mShaderPrograms->createShader(mImplementation.get(), getLimitations(), type);
 }
 
 GLuint Context::createTexture()
@@ -1008,30 +1035,27 @@ void Context::bindTexture(GLenum target, GLuint handle)
 {
     Texture *texture = nullptr;
 
-    if (handle == 0)
-    {
-        texture = mZeroTextures[target].get();
-    }
-    else
+    // Binding zero clears the binding so that the unit falls back to the zero texture.
+    if (handle != 0)
     {
         texture = mState.mTextures->checkTextureAllocation(mImplementation.get(), handle, target);
+        ASSERT(texture);
     }
 
-    ASSERT(texture);
     mGLState.setSamplerTexture(target, texture);
 }
 
 void Context::bindReadFramebuffer(GLuint framebufferHandle)
 {
     Framebuffer *framebuffer = mState.mFramebuffers->checkFramebufferAllocation(
-        mImplementation.get(), mCaps, framebufferHandle);
+        mImplementation.get(), getCaps(), framebufferHandle);
     mGLState.setReadFramebufferBinding(framebuffer);
 }
 
 void Context::bindDrawFramebuffer(GLuint framebufferHandle)
 {
     Framebuffer *framebuffer = mState.mFramebuffers->checkFramebufferAllocation(
-        mImplementation.get(), mCaps, framebufferHandle);
+        mImplementation.get(), getCaps(), framebufferHandle);
     mGLState.setDrawFramebufferBinding(framebuffer);
 }
 
@@ -1052,7 +1076,7 @@ void Context::bindVertexBuffer(GLuint bindingIndex,
 
 void Context::bindSampler(GLuint textureUnit, GLuint samplerHandle)
 {
-    ASSERT(textureUnit < mCaps.maxCombinedTextureImageUnits);
+    ASSERT(textureUnit < getCaps().maxCombinedTextureImageUnits);
     Sampler *sampler =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), samplerHandle);
     mGLState.setSamplerBinding(textureUnit, sampler);
@@ -1326,25 +1350,25 @@ void Context::getFloatvImpl(GLenum pname, GLfloat *params)
     switch (pname)
     {
         case GL_ALIASED_LINE_WIDTH_RANGE:
-            params[0] = mCaps.minAliasedLineWidth;
-            params[1] = mCaps.maxAliasedLineWidth;
+            params[0] = getCaps().minAliasedLineWidth;
+            params[1] = getCaps().maxAliasedLineWidth;
             break;
         case GL_ALIASED_POINT_SIZE_RANGE:
-            params[0] = mCaps.minAliasedPointSize;
-            params[1] = mCaps.maxAliasedPointSize;
+            params[0] = getCaps().minAliasedPointSize;
+            params[1] = getCaps().maxAliasedPointSize;
             break;
         case GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT:
-            ASSERT(mExtensions.textureFilterAnisotropic);
-            *params = mExtensions.maxTextureAnisotropy;
+            ASSERT(getExtensions().textureFilterAnisotropic);
+            *params = getExtensions().maxTextureAnisotropy;
             break;
         case GL_MAX_TEXTURE_LOD_BIAS:
-            *params = mCaps.maxLODBias;
+            *params = getCaps().maxLODBias;
             break;
 
         case GL_PATH_MODELVIEW_MATRIX_CHROMIUM:
         case GL_PATH_PROJECTION_MATRIX_CHROMIUM:
         {
-            ASSERT(mExtensions.pathRendering);
+            ASSERT(getExtensions().pathRendering);
             const GLfloat *m = mGLState.getPathRenderingMatrix(pname);
             memcpy(params, m, 16 * sizeof(GLfloat));
         }
@@ -1364,43 +1388,43 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
     switch (pname)
     {
         case GL_MAX_VERTEX_ATTRIBS:
-            *params = mCaps.maxVertexAttributes;
+            *params = getCaps().maxVertexAttributes;
             break;
         case GL_MAX_VERTEX_UNIFORM_VECTORS:
-            *params = mCaps.maxVertexUniformVectors;
+            *params = getCaps().maxVertexUniformVectors;
             break;
         case GL_MAX_VERTEX_UNIFORM_COMPONENTS:
-            *params = mCaps.maxVertexUniformComponents;
+            *params = getCaps().maxVertexUniformComponents;
             break;
         case GL_MAX_VARYING_VECTORS:
-            *params = mCaps.maxVaryingVectors;
+            *params = getCaps().maxVaryingVectors;
             break;
         case GL_MAX_VARYING_COMPONENTS:
-            *params = mCaps.maxVertexOutputComponents;
+            *params = getCaps().maxVertexOutputComponents;
             break;
         case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
-            *params = mCaps.maxCombinedTextureImageUnits;
+            *params = getCaps().maxCombinedTextureImageUnits;
             break;
         case GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS:
-            *params = mCaps.maxVertexTextureImageUnits;
+            *params = getCaps().maxVertexTextureImageUnits;
             break;
         case GL_MAX_TEXTURE_IMAGE_UNITS:
-            *params = mCaps.maxTextureImageUnits;
+            *params = getCaps().maxTextureImageUnits;
             break;
         case GL_MAX_FRAGMENT_UNIFORM_VECTORS:
-            *params = mCaps.maxFragmentUniformVectors;
+            *params = getCaps().maxFragmentUniformVectors;
             break;
         case GL_MAX_FRAGMENT_UNIFORM_COMPONENTS:
-            *params = mCaps.maxFragmentUniformComponents;
+            *params = getCaps().maxFragmentUniformComponents;
             break;
         case GL_MAX_RENDERBUFFER_SIZE:
-            *params = mCaps.maxRenderbufferSize;
+            *params = getCaps().maxRenderbufferSize;
             break;
         case GL_MAX_COLOR_ATTACHMENTS_EXT:
-            *params = mCaps.maxColorAttachments;
+            *params = getCaps().maxColorAttachments;
             break;
         case GL_MAX_DRAW_BUFFERS_EXT:
-            *params = mCaps.maxDrawBuffers;
+            *params = getCaps().maxDrawBuffers;
             break;
         // case GL_FRAMEBUFFER_BINDING:                    // now equivalent to
         // GL_DRAW_FRAMEBUFFER_BINDING_ANGLE
@@ -1408,43 +1432,43 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = 4;
             break;
         case GL_MAX_TEXTURE_SIZE:
-            *params = mCaps.max2DTextureSize;
+            *params = getCaps().max2DTextureSize;
             break;
         case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
-            *params = mCaps.maxCubeMapTextureSize;
+            *params = getCaps().maxCubeMapTextureSize;
             break;
         case GL_MAX_3D_TEXTURE_SIZE:
-            *params = mCaps.max3DTextureSize;
+            *params = getCaps().max3DTextureSize;
             break;
         case GL_MAX_ARRAY_TEXTURE_LAYERS:
-            *params = mCaps.maxArrayTextureLayers;
+            *params = getCaps().maxArrayTextureLayers;
             break;
         case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
-            *params = mCaps.uniformBufferOffsetAlignment;
+            *params = getCaps().uniformBufferOffsetAlignment;
             break;
         case GL_MAX_UNIFORM_BUFFER_BINDINGS:
-            *params = mCaps.maxUniformBufferBindings;
+            *params = getCaps().maxUniformBufferBindings;
             break;
         case GL_MAX_VERTEX_UNIFORM_BLOCKS:
-            *params = mCaps.maxVertexUniformBlocks;
+            *params = getCaps().maxVertexUniformBlocks;
             break;
         case GL_MAX_FRAGMENT_UNIFORM_BLOCKS:
-            *params = mCaps.maxFragmentUniformBlocks;
+            *params = getCaps().maxFragmentUniformBlocks;
             break;
         case GL_MAX_COMBINED_UNIFORM_BLOCKS:
-            *params = mCaps.maxCombinedTextureImageUnits;
+            *params = getCaps().maxCombinedTextureImageUnits;
             break;
         case GL_MAX_VERTEX_OUTPUT_COMPONENTS:
-            *params = mCaps.maxVertexOutputComponents;
+            *params = getCaps().maxVertexOutputComponents;
             break;
         case GL_MAX_FRAGMENT_INPUT_COMPONENTS:
-            *params = mCaps.maxFragmentInputComponents;
+            *params = getCaps().maxFragmentInputComponents;
             break;
         case GL_MIN_PROGRAM_TEXEL_OFFSET:
-            *params = mCaps.minProgramTexelOffset;
+            *params = getCaps().minProgramTexelOffset;
             break;
         case GL_MAX_PROGRAM_TEXEL_OFFSET:
-            *params = mCaps.maxProgramTexelOffset;
+            *params = getCaps().maxProgramTexelOffset;
             break;
         case GL_MAJOR_VERSION:
             *params = getClientVersion().major;
@@ -1453,67 +1477,69 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = getClientVersion().minor;
             break;
         case GL_MAX_ELEMENTS_INDICES:
-            *params = mCaps.maxElementsIndices;
+            *params = getCaps().maxElementsIndices;
             break;
         case GL_MAX_ELEMENTS_VERTICES:
-            *params = mCaps.maxElementsVertices;
+            *params = getCaps().maxElementsVertices;
             break;
         case GL_MAX_TRANSFORM_FEEDBACK_INTERLEAVED_COMPONENTS:
-            *params = mCaps.maxTransformFeedbackInterleavedComponents;
+            *params = getCaps().maxTransformFeedbackInterleavedComponents;
             break;
         case GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS:
-            *params = mCaps.maxTransformFeedbackSeparateAttributes;
+            *params = getCaps().maxTransformFeedbackSeparateAttributes;
             break;
         case GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_COMPONENTS:
-            *params = mCaps.maxTransformFeedbackSeparateComponents;
+            *params = getCaps().maxTransformFeedbackSeparateComponents;
             break;
         case GL_NUM_COMPRESSED_TEXTURE_FORMATS:
-            *params = static_cast<GLint>(mCaps.compressedTextureFormats.size());
+            *params = static_cast<GLint>(getCaps().compressedTextureFormats.size());
             break;
         case GL_MAX_SAMPLES_ANGLE:
-            *params = mCaps.maxSamples;
+            *params = getCaps().maxSamples;
             break;
         case GL_MAX_VIEWPORT_DIMS:
         {
-            params[0] = mCaps.maxViewportWidth;
-            params[1] = mCaps.maxViewportHeight;
+            params[0] = getCaps().maxViewportWidth;
+            params[1] = getCaps().maxViewportHeight;
         }
         break;
         case GL_COMPRESSED_TEXTURE_FORMATS:
-            std::copy(mCaps.compressedTextureFormats.begin(), mCaps.compressedTextureFormats.end(),
-                      params);
+            std::copy(getCaps().compressedTextureFormats.begin(),
+                      getCaps().compressedTextureFormats.end(), params);
             break;
         case GL_RESET_NOTIFICATION_STRATEGY_EXT:
             *params = mResetStrategy;
             break;
         case GL_NUM_SHADER_BINARY_FORMATS:
-            *params = static_cast<GLint>(mCaps.shaderBinaryFormats.size());
+            *params = static_cast<GLint>(getCaps().shaderBinaryFormats.size());
             break;
         case GL_SHADER_BINARY_FORMATS:
-            std::copy(mCaps.shaderBinaryFormats.begin(), mCaps.shaderBinaryFormats.end(), params);
+            std::copy(getCaps().shaderBinaryFormats.begin(), getCaps().shaderBinaryFormats.end(),
+                      params);
             break;
         case GL_NUM_PROGRAM_BINARY_FORMATS:
-            *params = static_cast<GLint>(mCaps.programBinaryFormats.size());
+            *params = static_cast<GLint>(getCaps().programBinaryFormats.size());
             break;
         case GL_PROGRAM_BINARY_FORMATS:
-            std::copy(mCaps.programBinaryFormats.begin(), mCaps.programBinaryFormats.end(), params);
+            std::copy(getCaps().programBinaryFormats.begin(), getCaps().programBinaryFormats.end(),
+                      params);
             break;
         case GL_NUM_EXTENSIONS:
-            *params = static_cast<GLint>(mExtensionStrings.size());
+            *params = static_cast<GLint>(mCapsSnapshot->extensionStrings.size());
             break;
 
         // GL_KHR_debug
         case GL_MAX_DEBUG_MESSAGE_LENGTH:
-            *params = mExtensions.maxDebugMessageLength;
+            *params = getExtensions().maxDebugMessageLength;
             break;
         case GL_MAX_DEBUG_LOGGED_MESSAGES:
-            *params = mExtensions.maxDebugLoggedMessages;
+            *params = getExtensions().maxDebugLoggedMessages;
             break;
         case GL_MAX_DEBUG_GROUP_STACK_DEPTH:
-            *params = mExtensions.maxDebugGroupStackDepth;
+            *params = getExtensions().maxDebugGroupStackDepth;
             break;
         case GL_MAX_LABEL_LENGTH:
-            *params = mExtensions.maxLabelLength;
+            *params = getExtensions().maxLabelLength;
             break;
 
         // GL_EXT_disjoint_timer_query
@@ -1521,127 +1547,127 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = mImplementation->getGPUDisjoint();
             break;
         case GL_MAX_FRAMEBUFFER_WIDTH:
-            *params = mCaps.maxFramebufferWidth;
+            *params = getCaps().maxFramebufferWidth;
             break;
         case GL_MAX_FRAMEBUFFER_HEIGHT:
-            *params = mCaps.maxFramebufferHeight;
+            *params = getCaps().maxFramebufferHeight;
             break;
         case GL_MAX_FRAMEBUFFER_SAMPLES:
-            *params = mCaps.maxFramebufferSamples;
+            *params = getCaps().maxFramebufferSamples;
             break;
         case GL_MAX_SAMPLE_MASK_WORDS:
-            *params = mCaps.maxSampleMaskWords;
+            *params = getCaps().maxSampleMaskWords;
             break;
         case GL_MAX_COLOR_TEXTURE_SAMPLES:
-            *params = mCaps.maxColorTextureSamples;
+            *params = getCaps().maxColorTextureSamples;
             break;
         case GL_MAX_DEPTH_TEXTURE_SAMPLES:
-            *params = mCaps.maxDepthTextureSamples;
+            *params = getCaps().maxDepthTextureSamples;
             break;
         case GL_MAX_INTEGER_SAMPLES:
-            *params = mCaps.maxIntegerSamples;
+            *params = getCaps().maxIntegerSamples;
             break;
         case GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET:
-            *params = mCaps.maxVertexAttribRelativeOffset;
+            *params = getCaps().maxVertexAttribRelativeOffset;
             break;
         case GL_MAX_VERTEX_ATTRIB_BINDINGS:
-            *params = mCaps.maxVertexAttribBindings;
+            *params = getCaps().maxVertexAttribBindings;
             break;
         case GL_MAX_VERTEX_ATTRIB_STRIDE:
-            *params = mCaps.maxVertexAttribStride;
+            *params = getCaps().maxVertexAttribStride;
             break;
         case GL_MAX_VERTEX_ATOMIC_COUNTER_BUFFERS:
-            *params = mCaps.maxVertexAtomicCounterBuffers;
+            *params = getCaps().maxVertexAtomicCounterBuffers;
             break;
         case GL_MAX_VERTEX_ATOMIC_COUNTERS:
-            *params = mCaps.maxVertexAtomicCounters;
+            *params = getCaps().maxVertexAtomicCounters;
             break;
         case GL_MAX_VERTEX_IMAGE_UNIFORMS:
-            *params = mCaps.maxVertexImageUniforms;
+            *params = getCaps().maxVertexImageUniforms;
             break;
         case GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS:
-            *params = mCaps.maxVertexShaderStorageBlocks;
+            *params = getCaps().maxVertexShaderStorageBlocks;
             break;
         case GL_MAX_FRAGMENT_ATOMIC_COUNTER_BUFFERS:
-            *params = mCaps.maxFragmentAtomicCounterBuffers;
+            *params = getCaps().maxFragmentAtomicCounterBuffers;
             break;
         case GL_MAX_FRAGMENT_ATOMIC_COUNTERS:
-            *params = mCaps.maxFragmentAtomicCounters;
+            *params = getCaps().maxFragmentAtomicCounters;
             break;
         case GL_MAX_FRAGMENT_IMAGE_UNIFORMS:
-            *params = mCaps.maxFragmentImageUniforms;
+            *params = getCaps().maxFragmentImageUniforms;
             break;
         case GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS:
-            *params = mCaps.maxFragmentShaderStorageBlocks;
+            *params = getCaps().maxFragmentShaderStorageBlocks;
             break;
         case GL_MIN_PROGRAM_TEXTURE_GATHER_OFFSET:
-            *params = mCaps.minProgramTextureGatherOffset;
+            *params = getCaps().minProgramTextureGatherOffset;
             break;
         case GL_MAX_PROGRAM_TEXTURE_GATHER_OFFSET:
-            *params = mCaps.maxProgramTextureGatherOffset;
+            *params = getCaps().maxProgramTextureGatherOffset;
             break;
         case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS:
-            *params = mCaps.maxComputeWorkGroupInvocations;
+            *params = getCaps().maxComputeWorkGroupInvocations;
             break;
         case GL_MAX_COMPUTE_UNIFORM_BLOCKS:
-            *params = mCaps.maxComputeUniformBlocks;
+            *params = getCaps().maxComputeUniformBlocks;
             break;
         case GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS:
-            *params = mCaps.maxComputeTextureImageUnits;
+            *params = getCaps().maxComputeTextureImageUnits;
             break;
         case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE:
-            *params = mCaps.maxComputeSharedMemorySize;
+            *params = getCaps().maxComputeSharedMemorySize;
             break;
         case GL_MAX_COMPUTE_UNIFORM_COMPONENTS:
-            *params = mCaps.maxComputeUniformComponents;
+            *params = getCaps().maxComputeUniformComponents;
             break;
         case GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS:
-            *params = mCaps.maxComputeAtomicCounterBuffers;
+            *params = getCaps().maxComputeAtomicCounterBuffers;
             break;
         case GL_MAX_COMPUTE_ATOMIC_COUNTERS:
-            *params = mCaps.maxComputeAtomicCounters;
+            *params = getCaps().maxComputeAtomicCounters;
             break;
         case GL_MAX_COMPUTE_IMAGE_UNIFORMS:
-            *params = mCaps.maxComputeImageUniforms;
+            *params = getCaps().maxComputeImageUniforms;
             break;
         case GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS:
-            *params = mCaps.maxCombinedComputeUniformComponents;
+            *params = getCaps().maxCombinedComputeUniformComponents;
             break;
         case GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS:
-            *params = mCaps.maxComputeShaderStorageBlocks;
+            *params = getCaps().maxComputeShaderStorageBlocks;
             break;
         case GL_MAX_COMBINED_SHADER_OUTPUT_RESOURCES:
-            *params = mCaps.maxCombinedShaderOutputResources;
+            *params = getCaps().maxCombinedShaderOutputResources;
             break;
         case GL_MAX_UNIFORM_LOCATIONS:
-            *params = mCaps.maxUniformLocations;
+            *params = getCaps().maxUniformLocations;
             break;
         case GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS:
-            *params = mCaps.maxAtomicCounterBufferBindings;
+            *params = getCaps().maxAtomicCounterBufferBindings;
             break;
         case GL_MAX_ATOMIC_COUNTER_BUFFER_SIZE:
-            *params = mCaps.maxAtomicCounterBufferSize;
+            *params = getCaps().maxAtomicCounterBufferSize;
             break;
         case GL_MAX_COMBINED_ATOMIC_COUNTER_BUFFERS:
-            *params = mCaps.maxCombinedAtomicCounterBuffers;
+            *params = getCaps().maxCombinedAtomicCounterBuffers;
             break;
         case GL_MAX_COMBINED_ATOMIC_COUNTERS:
-            *params = mCaps.maxCombinedAtomicCounters;
+            *params = getCaps().maxCombinedAtomicCounters;
             break;
         case GL_MAX_IMAGE_UNITS:
-            *params = mCaps.maxImageUnits;
+            *params = getCaps().maxImageUnits;
             break;
         case GL_MAX_COMBINED_IMAGE_UNIFORMS:
-            *params = mCaps.maxCombinedImageUniforms;
+            *params = getCaps().maxCombinedImageUniforms;
             break;
         case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS:
-            *params = mCaps.maxShaderStorageBufferBindings;
+            *params = getCaps().maxShaderStorageBufferBindings;
             break;
         case GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS:
-            *params = mCaps.maxCombinedShaderStorageBlocks;
+            *params = getCaps().maxCombinedShaderStorageBlocks;
             break;
         case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT:
-            *params = mCaps.shaderStorageBufferOffsetAlignment;
+            *params = getCaps().shaderStorageBufferOffsetAlignment;
             break;
         default:
             mGLState.getIntegerv(this, pname, params);
@@ -1656,19 +1682,19 @@ void Context::getInteger64v(GLenum pname, GLint64 *params)
     switch (pname)
     {
         case GL_MAX_ELEMENT_INDEX:
-            *params = mCaps.maxElementIndex;
+            *params = getCaps().maxElementIndex;
             break;
         case GL_MAX_UNIFORM_BLOCK_SIZE:
-            *params = mCaps.maxUniformBlockSize;
+            *params = getCaps().maxUniformBlockSize;
             break;
         case GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS:
-            *params = mCaps.maxCombinedVertexUniformComponents;
+            *params = getCaps().maxCombinedVertexUniformComponents;
             break;
         case GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS:
-            *params = mCaps.maxCombinedFragmentUniformComponents;
+            *params = getCaps().maxCombinedFragmentUniformComponents;
             break;
         case GL_MAX_SERVER_WAIT_TIMEOUT:
-            *params = mCaps.maxServerWaitTimeout;
+            *params = getCaps().maxServerWaitTimeout;
             break;
 
         // GL_EXT_disjoint_timer_query
@@ -1677,7 +1703,30 @@ void Context::getInteger64v(GLenum pname, GLint64 *params)
             break;
 
         case GL_MAX_SHADER_STORAGE_BLOCK_SIZE:
-            *params = mCaps.maxShaderStorageBlockSize;
+            *params = getCaps().maxShaderStorageBlockSize;
+            break;
+
+        // GL_ANGLE_memory_accounting
+        case GL_CONTEXT_BUFFER_MEMORY_ANGLE:
+            *params = mMemoryTracker->getSize(MemoryCategory::Buffer);
+            break;
+        case GL_CONTEXT_TEXTURE_MEMORY_ANGLE:
+            *params = mMemoryTracker->getSize(MemoryCategory::Texture);
+            break;
+        case GL_CONTEXT_RENDERBUFFER_MEMORY_ANGLE:
+            *params = mMemoryTracker->getSize(MemoryCategory::Renderbuffer);
+            break;
+        case GL_SHARE_GROUP_BUFFER_MEMORY_ANGLE:
+            *params = mMemoryTracker->getShareGroup()->getSize(MemoryCategory::Buffer);
+            break;
+        case GL_SHARE_GROUP_TEXTURE_MEMORY_ANGLE:
+            *params = mMemoryTracker->getShareGroup()->getSize(MemoryCategory::Texture);
+            break;
+        case GL_SHARE_GROUP_RENDERBUFFER_MEMORY_ANGLE:
+            *params = mMemoryTracker->getShareGroup()->getSize(MemoryCategory::Renderbuffer);
+            break;
+        case GL_CONTEXT_MEMORY_BUDGET_ANGLE:
+            *params = mMemoryTracker->getBudget();
             break;
         default:
             UNREACHABLE();
@@ -1706,11 +1755,11 @@ void Context::getIntegeri_v(GLenum target, GLuint index, GLint *data)
         {
             case GL_MAX_COMPUTE_WORK_GROUP_COUNT:
                 ASSERT(index < 3u);
-                *data = mCaps.maxComputeWorkGroupCount[index];
+                *data = getCaps().maxComputeWorkGroupCount[index];
                 break;
             case GL_MAX_COMPUTE_WORK_GROUP_SIZE:
                 ASSERT(index < 3u);
-                *data = mCaps.maxComputeWorkGroupSize[index];
+                *data = getCaps().maxComputeWorkGroupSize[index];
                 break;
             default:
                 mGLState.getIntegeri_v(target, index, data);
@@ -1820,7 +1869,7 @@ void Context::texParameteriv(GLenum target, GLenum pname, const GLint *params)
 
 void Context::drawArrays(GLenum mode, GLint first, GLsizei count)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     auto error = mImplementation->drawArrays(this, mode, first, count);
     handleError(error);
     if (!error.isError())
@@ -1831,7 +1880,7 @@ void Context::drawArrays(GLenum mode, GLint first, GLsizei count)
 
 void Context::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     auto error = mImplementation->drawArraysInstanced(this, mode, first, count, instanceCount);
     handleError(error);
     if (!error.isError())
@@ -1842,7 +1891,7 @@ void Context::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsiz
 
 void Context::drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     const IndexRange &indexRange = getParams<HasIndexRange>().getIndexRange().value();
     handleError(mImplementation->drawElements(this, mode, count, type, indices, indexRange));
 }
@@ -1853,7 +1902,7 @@ void Context::drawElementsInstanced(GLenum mode,
                                     const void *indices,
                                     GLsizei instances)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     const IndexRange &indexRange = getParams<HasIndexRange>().getIndexRange().value();
     handleError(mImplementation->drawElementsInstanced(this, mode, count, type, indices, instances,
                                                        indexRange));
@@ -1866,7 +1915,7 @@ void Context::drawRangeElements(GLenum mode,
                                 GLenum type,
                                 const void *indices)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     const IndexRange &indexRange = getParams<HasIndexRange>().getIndexRange().value();
     handleError(mImplementation->drawRangeElements(this, mode, start, end, count, type, indices,
                                                    indexRange));
@@ -1874,16 +1923,108 @@ void Context::drawRangeElements(GLenum mode,
 
 void Context::drawArraysIndirect(GLenum mode, const void *indirect)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     handleError(mImplementation->drawArraysIndirect(this, mode, indirect));
 }
 
 void Context::drawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
-    syncRendererState();
+    ANGLE_CONTEXT_TRY(prepareForDraw());
     handleError(mImplementation->drawElementsIndirect(this, mode, type, indirect));
 }
 
+void Context::multiDrawArrays(GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              GLsizei drawcount)
+{
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+    handleError(mImplementation->multiDrawArrays(this, mode, firsts, counts, drawcount));
+}
+
+void Context::multiDrawArraysInstanced(GLenum mode,
+                                       const GLint *firsts,
+                                       const GLsizei *counts,
+                                       const GLsizei *instanceCounts,
+                                       GLsizei drawcount)
+{
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+    handleError(mImplementation->multiDrawArraysInstanced(this, mode, firsts, counts,
+                                                          instanceCounts, drawcount));
+}
+
+void Context::multiDrawElements(GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const void *const *indices,
+                                GLsizei drawcount)
+{
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+
+    const auto &indexRanges = getParams<HasMultiDrawIndexRanges>().getIndexRanges();
+    if (!indexRanges.valid())
+    {
+        return;
+    }
+
+    handleError(mImplementation->multiDrawElements(this, mode, counts, type, indices, drawcount,
+                                                   indexRanges.value()));
+}
+
+void Context::multiDrawElementsInstanced(GLenum mode,
+                                         const GLsizei *counts,
+                                         GLenum type,
+                                         const void *const *indices,
+                                         const GLsizei *instanceCounts,
+                                         GLsizei drawcount)
+{
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+
+    const auto &indexRanges = getParams<HasMultiDrawIndexRanges>().getIndexRanges();
+    if (!indexRanges.valid())
+    {
+        return;
+    }
+
+    handleError(mImplementation->multiDrawElementsInstanced(this, mode, counts, type, indices,
+                                                            instanceCounts, drawcount,
+                                                            indexRanges.value()));
+}
+
+Error Context::getDrawIndexRange(GLenum type,
+                                 GLsizei count,
+                                 const void *indices,
+                                 IndexRange *indexRangeOut) const
+{
+    Buffer *elementArrayBuffer = mGLState.getVertexArray()->getElementArrayBuffer().get();
+    if (elementArrayBuffer)
+    {
+        uintptr_t offset = reinterpret_cast<uintptr_t>(indices);
+        return elementArrayBuffer->getIndexRange(type, static_cast<size_t>(offset), count,
+                                                 mGLState.isPrimitiveRestartEnabled(),
+                                                 indexRangeOut);
+    }
+
+    *indexRangeOut = ComputeIndexRange(type, indices, count, mGLState.isPrimitiveRestartEnabled());
+    return NoError();
+}
+
+Error Context::getMultiDrawIndexRanges(const GLsizei *counts,
+                                       GLenum type,
+                                       const void *const *indices,
+                                       GLsizei drawcount,
+                                       const IndexRange **indexRangesOut)
+{
+    mMultiDrawIndexRanges.resize(static_cast<size_t>(drawcount));
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        ANGLE_TRY(getDrawIndexRange(type, counts[drawID], indices[drawID],
+                                    &mMultiDrawIndexRanges[drawID]));
+    }
+    *indexRangesOut = mMultiDrawIndexRanges.data();
+    return NoError();
+}
+
 void Context::flush()
 {
     handleError(mImplementation->flush());
@@ -2159,35 +2300,58 @@ void Context::handleError(const Error &error)
 {
     if (error.isError())
     {
+        static_assert(GL_OUT_OF_MEMORY - GL_INVALID_ENUM < kErrorCodeCount &&
+                          GL_INVALID_FRAMEBUFFER_OPERATION - GL_INVALID_ENUM < kErrorCodeCount,
+                      "Every GL error code needs a bit in the error set.");
+
         GLenum code = error.getCode();
-        mErrors.insert(code);
+        if (code < GL_INVALID_ENUM || code > GL_CONTEXT_LOST_KHR)
+        {
+            UNREACHABLE();
+            code = GL_INVALID_OPERATION;
+        }
+        mErrors.set(code - GL_INVALID_ENUM);
         if (code == GL_OUT_OF_MEMORY && getWorkarounds().loseContextOnOutOfMemory)
         {
             markContextLost();
         }
 
-        if (!error.getMessage().empty())
+        // Only build the message string when something can receive it.
+        auto *debug = &mGLState.getDebug();
+        if (debug->isOutputEnabled() && !error.getMessage().empty())
         {
-            auto *debug = &mGLState.getDebug();
             debug->insertMessage(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, error.getID(),
                                  GL_DEBUG_SEVERITY_HIGH, error.getMessage());
         }
     }
 }
 
+void Context::onMemoryBudgetExceeded(uint64_t total, uint64_t budget)
+{
+    auto *debug = &mGLState.getDebug();
+    if (debug->isOutputEnabled())
+    {
+        std::ostringstream stream;
+        stream << "Context memory of " << total << " bytes exceeds its budget of " << budget
+               << " bytes.";
+        debug->insertMessage(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_PERFORMANCE, 0,
+                             GL_DEBUG_SEVERITY_HIGH, stream.str());
+    }
+}
+
 // Get one of the recorded errors and clear its flag, if any.
 // [OpenGL ES 2.0.24] section 2.5 page 13.
 GLenum Context::getError()
 {
-    if (mErrors.empty())
+    if (mErrors.none())
     {
         return GL_NO_ERROR;
     }
     else
     {
-        GLenum error = *mErrors.begin();
-        mErrors.erase(mErrors.begin());
-        return error;
+        size_t errorIndex = *mErrors.begin();
+        mErrors.reset(errorIndex);
+        return static_cast<GLenum>(GL_INVALID_ENUM + errorIndex);
     }
 }
 
@@ -2199,7 +2363,7 @@ void Context::markContextLost()
         mResetStatus       = GL_UNKNOWN_CONTEXT_RESET_EXT;
         mContextLostForced = true;
     }
-    mContextLost = true;
+    setContextLost();
 }
 
 bool Context::isContextLost()
@@ -2207,6 +2371,12 @@ bool Context::isContextLost()
     return mContextLost;
 }
 
+void Context::setContextLost()
+{
+    mContextLost   = true;
+    mDispatchTable = &kContextLostDispatchTable;
+}
+
 GLenum Context::getResetStatus()
 {
     // Even if the application doesn't want to know about resets, we want to know
@@ -2215,7 +2385,7 @@ GLenum Context::getResetStatus()
     {
         if (!mContextLost && mImplementation->getResetStatus() != GL_NO_ERROR)
         {
-            mContextLost = true;
+            setContextLost();
         }
 
         // EXT_robustness, section 2.6: If the reset notification behavior is
@@ -2234,7 +2404,7 @@ GLenum Context::getResetStatus()
 
         if (mResetStatus != GL_NO_ERROR)
         {
-            mContextLost = true;
+            setContextLost();
         }
     }
     else if (!mContextLostForced && mResetStatus != GL_NO_ERROR)
@@ -2282,8 +2452,9 @@ VertexArray *Context::checkVertexArrayAllocation(GLuint vertexArrayHandle)
     VertexArray *vertexArray = getVertexArray(vertexArrayHandle);
     if (!vertexArray)
     {
-        vertexArray = new VertexArray(mImplementation.get(), vertexArrayHandle,
-                                      mCaps.maxVertexAttributes, mCaps.maxVertexAttribBindings);
+        vertexArray =
+            new VertexArray(mImplementation.get(), vertexArrayHandle,
+                            getCaps().maxVertexAttributes, getCaps().maxVertexAttribBindings);
 
         mVertexArrayMap[vertexArrayHandle] = vertexArray;
     }
@@ -2298,7 +2469,7 @@ TransformFeedback *Context::checkTransformFeedbackAllocation(GLuint transformFee
     if (!transformFeedback)
     {
         transformFeedback =
-            new TransformFeedback(mImplementation.get(), transformFeedbackHandle, mCaps);
+            new TransformFeedback(mImplementation.get(), transformFeedbackHandle, getCaps());
         transformFeedback->addRef();
         mTransformFeedbackMap[transformFeedbackHandle] = transformFeedback;
     }
@@ -2322,9 +2493,9 @@ void Context::detachTexture(GLuint texture)
 {
     // Simple pass-through to State's detachTexture method, as textures do not require
     // allocation map management either here or in the resource manager at detach time.
-    // Zero textures are held by the Context, and we don't attempt to request them from
-    // the State.
-    mGLState.detachTexture(this, mZeroTextures, texture);
+    // Zero textures are created and held by the State, which also takes care of rebinding the
+    // units that sampled the deleted texture.
+    mGLState.detachTexture(this, texture);
 }
 
 void Context::detachBuffer(GLuint buffer)
@@ -2412,6 +2583,7 @@ void Context::samplerParameteri(GLuint sampler, GLenum pname, GLint param)
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameteri(samplerObject, pname, param);
+    mGLState.setSamplerDirty(sampler);
 }
 
 void Context::samplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
@@ -2419,6 +2591,7 @@ void Context::samplerParameteriv(GLuint sampler, GLenum pname, const GLint *para
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameteriv(samplerObject, pname, param);
+    mGLState.setSamplerDirty(sampler);
 }
 
 void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
@@ -2426,6 +2599,7 @@ void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameterf(samplerObject, pname, param);
+    mGLState.setSamplerDirty(sampler);
 }
 
 void Context::samplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
@@ -2433,6 +2607,7 @@ void Context::samplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *pa
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameterfv(samplerObject, pname, param);
+    mGLState.setSamplerDirty(sampler);
 }
 
 void Context::getSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
@@ -2482,7 +2657,7 @@ void Context::initVersionStrings()
     mShadingLanguageString = MakeStaticString(shadingLanguageVersionString.str());
 }
 
-void Context::initExtensionStrings()
+void Context::initExtensionStrings(CapsSnapshot *snapshot) const
 {
     auto mergeExtensionStrings = [](const std::vector<const char *> &strings) {
         std::ostringstream combinedStringStream;
@@ -2491,26 +2666,27 @@ void Context::initExtensionStrings()
         return MakeStaticString(combinedStringStream.str());
     };
 
-    mExtensionStrings.clear();
-    for (const auto &extensionString : mExtensions.getStrings())
+    snapshot->extensionStrings.clear();
+    for (const auto &extensionString : snapshot->extensions.getStrings())
     {
-        mExtensionStrings.push_back(MakeStaticString(extensionString));
+        snapshot->extensionStrings.push_back(MakeStaticString(extensionString));
     }
-    mExtensionString = mergeExtensionStrings(mExtensionStrings);
+    snapshot->extensionString = mergeExtensionStrings(snapshot->extensionStrings);
 
     const gl::Extensions &nativeExtensions = mImplementation->getNativeExtensions();
 
-    mRequestableExtensionStrings.clear();
+    snapshot->requestableExtensionStrings.clear();
     for (const auto &extensionInfo : GetExtensionInfoMap())
     {
         if (extensionInfo.second.Requestable &&
-            !(mExtensions.*(extensionInfo.second.ExtensionsMember)) &&
+            !(snapshot->extensions.*(extensionInfo.second.ExtensionsMember)) &&
             nativeExtensions.*(extensionInfo.second.ExtensionsMember))
         {
-            mRequestableExtensionStrings.push_back(MakeStaticString(extensionInfo.first));
+            snapshot->requestableExtensionStrings.push_back(MakeStaticString(extensionInfo.first));
         }
     }
-    mRequestableExtensionString = mergeExtensionStrings(mRequestableExtensionStrings);
+    snapshot->requestableExtensionString =
+        mergeExtensionStrings(snapshot->requestableExtensionStrings);
 }
 
 const GLubyte *Context::getString(GLenum name) const
@@ -2530,10 +2706,10 @@ const GLubyte *Context::getString(GLenum name) const
             return reinterpret_cast<const GLubyte *>(mShadingLanguageString);
 
         case GL_EXTENSIONS:
-            return reinterpret_cast<const GLubyte *>(mExtensionString);
+            return reinterpret_cast<const GLubyte *>(mCapsSnapshot->extensionString);
 
         case GL_REQUESTABLE_EXTENSIONS_ANGLE:
-            return reinterpret_cast<const GLubyte *>(mRequestableExtensionString);
+            return reinterpret_cast<const GLubyte *>(mCapsSnapshot->requestableExtensionString);
 
         default:
             UNREACHABLE();
@@ -2546,10 +2722,11 @@ const GLubyte *Context::getStringi(GLenum name, GLuint index) const
     switch (name)
     {
         case GL_EXTENSIONS:
-            return reinterpret_cast<const GLubyte *>(mExtensionStrings[index]);
+            return reinterpret_cast<const GLubyte *>(mCapsSnapshot->extensionStrings[index]);
 
         case GL_REQUESTABLE_EXTENSIONS_ANGLE:
-            return reinterpret_cast<const GLubyte *>(mRequestableExtensionStrings[index]);
+            return reinterpret_cast<const GLubyte *>(
+                mCapsSnapshot->requestableExtensionStrings[index]);
 
         default:
             UNREACHABLE();
@@ -2559,7 +2736,7 @@ const GLubyte *Context::getStringi(GLenum name, GLuint index) const
 
 size_t Context::getExtensionStringCount() const
 {
-    return mExtensionStrings.size();
+    return mCapsSnapshot->extensionStrings.size();
 }
 
 void Context::requestExtension(const char *name)
@@ -2569,15 +2746,18 @@ void Context::requestExtension(const char *name)
     const auto &extension = extensionInfos.at(name);
     ASSERT(extension.Requestable);
 
-    if (mExtensions.*(extension.ExtensionsMember))
+    if (getExtensions().*(extension.ExtensionsMember))
     {
         // Extension already enabled
         return;
     }
 
-    mExtensions.*(extension.ExtensionsMember) = true;
-    updateCaps();
-    initExtensionStrings();
+    // The snapshot may be shared with other contexts, so enable the extension on a private copy.
+    auto snapshot = std::make_shared<CapsSnapshot>(*mCapsSnapshot);
+    snapshot->extensions.*(extension.ExtensionsMember) = true;
+    updateCaps(snapshot.get());
+    initExtensionStrings(snapshot.get());
+    setCapsSnapshot(std::move(snapshot));
 
     // Re-create the compiler with the requested extensions enabled.
     SafeDelete(mCompiler);
@@ -2586,17 +2766,14 @@ void Context::requestExtension(const char *name)
     // Invalidate all cached completenesses for textures and framebuffer. Some extensions make new
     // formats renderable or sampleable.
     mState.mTextures->invalidateTextureComplenessCache();
-    for (auto &zeroTexture : mZeroTextures)
-    {
-        zeroTexture.second->invalidateCompletenessCache();
-    }
+    mGLState.invalidateZeroTextureCompletenessCaches();
 
     mState.mFramebuffers->invalidateFramebufferComplenessCache();
 }
 
 size_t Context::getRequestableExtensionStringCount() const
 {
-    return mRequestableExtensionStrings.size();
+    return mCapsSnapshot->requestableExtensionStrings.size();
 }
 
 void Context::beginTransformFeedback(GLenum primitiveMode)
@@ -2620,89 +2797,133 @@ bool Context::hasActiveTransformFeedback(GLuint program) const
     return false;
 }
 
-void Context::initCaps(const egl::DisplayExtensions &displayExtensions)
+void Context::initCaps(const egl::DisplayExtensions &displayExtensions,
+                       CapsSnapshotCache *capsCache)
 {
-    mCaps = mImplementation->getNativeCaps();
+    CapsSnapshotKey key(getClientVersion(), mWebGLContext, mSkipValidation);
+    std::shared_ptr<const CapsSnapshot> snapshot = capsCache ? capsCache->get(key) : nullptr;
+
+    if (!snapshot)
+    {
+        auto newSnapshot = std::make_shared<CapsSnapshot>();
+        generateCaps(displayExtensions, newSnapshot.get());
+        initExtensionStrings(newSnapshot.get());
+
+        snapshot = std::move(newSnapshot);
+        if (capsCache)
+        {
+            capsCache->insert(key, snapshot);
+        }
+    }
+
+    setCapsSnapshot(std::move(snapshot));
+}
+
+void Context::setCapsSnapshot(std::shared_ptr<const CapsSnapshot> snapshot)
+{
+    mCapsSnapshot       = std::move(snapshot);
+    mState.mCaps        = &mCapsSnapshot->caps;
+    mState.mTextureCaps = &mCapsSnapshot->textureCaps;
+    mState.mExtensions  = &mCapsSnapshot->extensions;
+    mState.mLimitations = &mCapsSnapshot->limitations;
+}
+
+void Context::generateCaps(const egl::DisplayExtensions &displayExtensions,
+                           CapsSnapshot *snapshot) const
+{
+    Caps &caps             = snapshot->caps;
+    Extensions &extensions = snapshot->extensions;
+
+    caps = mImplementation->getNativeCaps();
 
-    mExtensions = mImplementation->getNativeExtensions();
+    extensions = mImplementation->getNativeExtensions();
 
-    mLimitations = mImplementation->getNativeLimitations();
+    snapshot->limitations = mImplementation->getNativeLimitations();
 
     if (getClientVersion() < Version(3, 0))
     {
         // Disable ES3+ extensions
-        mExtensions.colorBufferFloat      = false;
-        mExtensions.eglImageExternalEssl3 = false;
-        mExtensions.textureNorm16         = false;
+        extensions.colorBufferFloat      = false;
+        extensions.eglImageExternalEssl3 = false;
+        extensions.textureNorm16         = false;
     }
 
     if (getClientVersion() > Version(2, 0))
     {
         // FIXME(geofflang): Don't support EXT_sRGB in non-ES2 contexts
-        // mExtensions.sRGB = false;
+        // extensions.sRGB = false;
     }
 
     // Some extensions are always available because they are implemented in the GL layer.
-    mExtensions.bindUniformLocation   = true;
-    mExtensions.vertexArrayObject     = true;
-    mExtensions.bindGeneratesResource = true;
-    mExtensions.clientArrays          = true;
-    mExtensions.requestExtension      = true;
+    extensions.bindUniformLocation   = true;
+    extensions.vertexArrayObject     = true;
+    extensions.bindGeneratesResource = true;
+    extensions.clientArrays          = true;
+    extensions.requestExtension      = true;
+    extensions.multiDraw             = true;
+    extensions.memoryAccounting      = true;
 
     // Enable the no error extension if the context was created with the flag.
-    mExtensions.noError = mSkipValidation;
+    extensions.noError = mSkipValidation;
 
     // Enable surfaceless to advertise we'll have the correct behavior when there is no default FBO
-    mExtensions.surfacelessContext = displayExtensions.surfacelessContext;
+    extensions.surfacelessContext = displayExtensions.surfacelessContext;
 
     // Explicitly enable GL_KHR_debug
-    mExtensions.debug                   = true;
-    mExtensions.maxDebugMessageLength   = 1024;
-    mExtensions.maxDebugLoggedMessages  = 1024;
-    mExtensions.maxDebugGroupStackDepth = 1024;
-    mExtensions.maxLabelLength          = 1024;
+    extensions.debug                   = true;
+    extensions.maxDebugMessageLength   = 1024;
+    extensions.maxDebugLoggedMessages  = 1024;
+    extensions.maxDebugGroupStackDepth = 1024;
+    extensions.maxLabelLength          = 1024;
 
     // Explicitly enable GL_ANGLE_robust_client_memory
-    mExtensions.robustClientMemory = true;
+    extensions.robustClientMemory = true;
 
     // Determine robust resource init availability from EGL.
-    mExtensions.robustResourceInitialization =
+    extensions.robustResourceInitialization =
         egl::Display::GetClientExtensions().displayRobustResourceInitialization;
 
     // Apply implementation limits
-    mCaps.maxVertexAttributes = std::min<GLuint>(mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
-    mCaps.maxVertexAttribBindings =
+    caps.maxVertexAttributes = std::min<GLuint>(caps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
+    caps.maxVertexAttribBindings =
         getClientVersion() < ES_3_1
-            ? mCaps.maxVertexAttributes
-            : std::min<GLuint>(mCaps.maxVertexAttribBindings, MAX_VERTEX_ATTRIB_BINDINGS);
+            ? caps.maxVertexAttributes
+            : std::min<GLuint>(caps.maxVertexAttribBindings, MAX_VERTEX_ATTRIB_BINDINGS);
 
-    mCaps.maxVertexUniformBlocks = std::min<GLuint>(
-        mCaps.maxVertexUniformBlocks, IMPLEMENTATION_MAX_VERTEX_SHADER_UNIFORM_BUFFERS);
-    mCaps.maxVertexOutputComponents =
-        std::min<GLuint>(mCaps.maxVertexOutputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
+    caps.maxVertexUniformBlocks = std::min<GLuint>(
+        caps.maxVertexUniformBlocks, IMPLEMENTATION_MAX_VERTEX_SHADER_UNIFORM_BUFFERS);
+    caps.maxVertexOutputComponents =
+        std::min<GLuint>(caps.maxVertexOutputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
 
-    mCaps.maxFragmentInputComponents =
-        std::min<GLuint>(mCaps.maxFragmentInputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
+    caps.maxFragmentInputComponents =
+        std::min<GLuint>(caps.maxFragmentInputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
+
+    caps.maxCombinedTextureImageUnits = std::min<GLuint>(caps.maxCombinedTextureImageUnits,
+                                                         IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
 
     // WebGL compatibility
-    mExtensions.webglCompatibility = mWebGLContext;
+    extensions.webglCompatibility = mWebGLContext;
     for (const auto &extensionInfo : GetExtensionInfoMap())
     {
         // If this context is for WebGL, disable all enableable extensions
         if (mWebGLContext && extensionInfo.second.Requestable)
         {
-            mExtensions.*(extensionInfo.second.ExtensionsMember) = false;
+            extensions.*(extensionInfo.second.ExtensionsMember) = false;
         }
     }
 
     // Generate texture caps
-    updateCaps();
+    updateCaps(snapshot);
 }
 
-void Context::updateCaps()
+void Context::updateCaps(CapsSnapshot *snapshot) const
 {
-    mCaps.compressedTextureFormats.clear();
-    mTextureCaps.clear();
+    Caps &caps                   = snapshot->caps;
+    TextureCapsMap &textureCaps  = snapshot->textureCaps;
+    const Extensions &extensions = snapshot->extensions;
+
+    caps.compressedTextureFormats.clear();
+    textureCaps.clear();
 
     for (auto capsIt : mImplementation->getNativeTextureCaps())
     {
@@ -2715,11 +2936,11 @@ void Context::updateCaps()
         // Caps are AND'd with the renderer caps because some core formats are still unsupported in
         // ES3.
         formatCaps.texturable =
-            formatCaps.texturable && formatInfo.textureSupport(getClientVersion(), mExtensions);
+            formatCaps.texturable && formatInfo.textureSupport(getClientVersion(), extensions);
         formatCaps.renderable =
-            formatCaps.renderable && formatInfo.renderSupport(getClientVersion(), mExtensions);
+            formatCaps.renderable && formatInfo.renderSupport(getClientVersion(), extensions);
         formatCaps.filterable =
-            formatCaps.filterable && formatInfo.filterSupport(getClientVersion(), mExtensions);
+            formatCaps.filterable && formatInfo.filterSupport(getClientVersion(), extensions);
 
         // OpenGL ES does not support multisampling with non-rendererable formats
         // OpenGL ES 3.0 or prior does not support multisampling with integer formats
@@ -2732,10 +2953,10 @@ void Context::updateCaps()
 
         if (formatCaps.texturable && formatInfo.compressed)
         {
-            mCaps.compressedTextureFormats.push_back(sizedInternalFormat);
+            caps.compressedTextureFormats.push_back(sizedInternalFormat);
         }
 
-        mTextureCaps.insert(sizedInternalFormat, formatCaps);
+        textureCaps.insert(sizedInternalFormat, formatCaps);
     }
 }
 
@@ -2746,8 +2967,23 @@ void Context::initWorkarounds()
     mWorkarounds.loseContextOnOutOfMemory = (mResetStrategy == GL_LOSE_CONTEXT_ON_RESET_EXT);
 }
 
+Error Context::prepareForDraw()
+{
+    if (mGLState.isRobustResourceInitEnabled())
+    {
+        ANGLE_TRY(mGLState.clearUnclearedActiveTextures(this));
+        ANGLE_TRY(mGLState.getDrawFramebuffer()->ensureDrawAttachmentsInitialized(this));
+    }
+
+    syncRendererState();
+    return NoError();
+}
+
 void Context::syncRendererState()
 {
+    TRACE_EVENT0("gpu.angle", "Context::syncRendererState");
+    mGLState.syncActiveTextureCompleteness(this);
+
     const State::DirtyBits &dirtyBits = mGLState.getDirtyBits();
     mImplementation->syncState(dirtyBits);
     mGLState.clearDirtyBits();
@@ -2844,7 +3080,16 @@ void Context::readPixels(GLint x,
     ASSERT(framebufferObject);
 
     Rectangle area(x, y, width, height);
-    handleError(framebufferObject->readPixels(this, area, format, type, pixels));
+    double startTime = angle::HistogramCurrentTime();
+    auto error       = framebufferObject->readPixels(this, area, format, type, pixels);
+    handleError(error);
+    if (!error.isError())
+    {
+        const InternalFormat &formatInfo = GetInternalFormatInfo(format, type);
+        uint64_t bytes = static_cast<uint64_t>(formatInfo.pixelBytes) * width * height;
+        ANGLE_HISTOGRAM_THROUGHPUT("GPU.ANGLE.ReadPixelsKBPerSecond", bytes,
+                                   angle::HistogramCurrentTime() - startTime);
+    }
 }
 
 void Context::copyTexImage2D(GLenum target,
@@ -4060,7 +4305,7 @@ void Context::renderbufferStorage(GLenum target,
     GLenum convertedInternalFormat = getConvertedRenderbufferFormat(internalformat);
 
     Renderbuffer *renderbuffer = mGLState.getCurrentRenderbuffer();
-    handleError(renderbuffer->setStorage(convertedInternalFormat, width, height));
+    handleError(renderbuffer->setStorage(this, convertedInternalFormat, width, height));
 }
 
 void Context::renderbufferStorageMultisample(GLenum target,
@@ -4073,8 +4318,8 @@ void Context::renderbufferStorageMultisample(GLenum target,
     GLenum convertedInternalFormat = getConvertedRenderbufferFormat(internalformat);
 
     Renderbuffer *renderbuffer = mGLState.getCurrentRenderbuffer();
-    handleError(
-        renderbuffer->setStorageMultisample(samples, convertedInternalFormat, width, height));
+    handleError(renderbuffer->setStorageMultisample(this, samples, convertedInternalFormat, width,
+                                                    height));
 }
 
 void Context::getSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
@@ -4111,6 +4356,7 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
         return;
     }
 
+    syncRendererState();
     mImplementation->dispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
 }
 
@@ -4342,23 +4588,23 @@ void Context::getShaderPrecisionFormat(GLenum shadertype,
             switch (precisiontype)
             {
                 case GL_LOW_FLOAT:
-                    mCaps.vertexLowpFloat.get(range, precision);
+                    getCaps().vertexLowpFloat.get(range, precision);
                     break;
                 case GL_MEDIUM_FLOAT:
-                    mCaps.vertexMediumpFloat.get(range, precision);
+                    getCaps().vertexMediumpFloat.get(range, precision);
                     break;
                 case GL_HIGH_FLOAT:
-                    mCaps.vertexHighpFloat.get(range, precision);
+                    getCaps().vertexHighpFloat.get(range, precision);
                     break;
 
                 case GL_LOW_INT:
-                    mCaps.vertexLowpInt.get(range, precision);
+                    getCaps().vertexLowpInt.get(range, precision);
                     break;
                 case GL_MEDIUM_INT:
-                    mCaps.vertexMediumpInt.get(range, precision);
+                    getCaps().vertexMediumpInt.get(range, precision);
                     break;
                 case GL_HIGH_INT:
-                    mCaps.vertexHighpInt.get(range, precision);
+                    getCaps().vertexHighpInt.get(range, precision);
                     break;
 
                 default:
@@ -4371,23 +4617,23 @@ void Context::getShaderPrecisionFormat(GLenum shadertype,
             switch (precisiontype)
             {
                 case GL_LOW_FLOAT:
-                    mCaps.fragmentLowpFloat.get(range, precision);
+                    getCaps().fragmentLowpFloat.get(range, precision);
                     break;
                 case GL_MEDIUM_FLOAT:
-                    mCaps.fragmentMediumpFloat.get(range, precision);
+                    getCaps().fragmentMediumpFloat.get(range, precision);
                     break;
                 case GL_HIGH_FLOAT:
-                    mCaps.fragmentHighpFloat.get(range, precision);
+                    getCaps().fragmentHighpFloat.get(range, precision);
                     break;
 
                 case GL_LOW_INT:
-                    mCaps.fragmentLowpInt.get(range, precision);
+                    getCaps().fragmentLowpInt.get(range, precision);
                     break;
                 case GL_MEDIUM_INT:
-                    mCaps.fragmentMediumpInt.get(range, precision);
+                    getCaps().fragmentMediumpInt.get(range, precision);
                     break;
                 case GL_HIGH_INT:
-                    mCaps.fragmentHighpInt.get(range, precision);
+                    getCaps().fragmentHighpInt.get(range, precision);
                     break;
 
                 default:
@@ -4675,7 +4921,7 @@ void Context::validateProgram(GLuint program)
 {
     Program *programObject = getProgram(program);
     ASSERT(programObject);
-    programObject->validate(mCaps);
+    programObject->validate(getCaps());
 }
 
 }  // namespace gl
@@ -12,6 +12,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "angle_gl.h"
 #include "common/MemoryBuffer.h"
@@ -21,6 +22,7 @@
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
+#include "libANGLE/MemoryTracker.h"
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/Workarounds.h"
@@ -42,6 +44,7 @@ struct Config;
 namespace gl
 {
 class Compiler;
+struct DispatchTable;
 class Shader;
 class Program;
 class Texture;
@@ -63,6 +66,7 @@ class Context final : public ValidationContext
             const egl::Config *config,
             const Context *shareContext,
             TextureManager *shareTextures,
+            CapsSnapshotCache *capsCache,
             const egl::AttributeMap &attribs,
             const egl::DisplayExtensions &displayExtensions,
             bool robustResourceInit);
@@ -363,6 +367,42 @@ class Context final : public ValidationContext
     void drawArraysIndirect(GLenum mode, const void *indirect);
     void drawElementsIndirect(GLenum mode, GLenum type, const void *indirect);
 
+    void multiDrawArrays(GLenum mode,
+                         const GLint *firsts,
+                         const GLsizei *counts,
+                         GLsizei drawcount);
+    void multiDrawArraysInstanced(GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  const GLsizei *instanceCounts,
+                                  GLsizei drawcount);
+    void multiDrawElements(GLenum mode,
+                           const GLsizei *counts,
+                           GLenum type,
+                           const void *const *indices,
+                           GLsizei drawcount);
+    void multiDrawElementsInstanced(GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const void *const *indices,
+                                    const GLsizei *instanceCounts,
+                                    GLsizei drawcount);
+
+    // Computes the range of the indices an element draw reads, from the bound element array
+    // buffer or from client memory.
+    Error getDrawIndexRange(GLenum type,
+                            GLsizei count,
+                            const void *indices,
+                            IndexRange *indexRangeOut) const;
+
+    // Computes the index ranges of all the draws of a multi-draw call into a buffer the context
+    // keeps, to avoid allocating them for every call. They stay valid until the next call of this.
+    Error getMultiDrawIndexRanges(const GLsizei *counts,
+                                  GLenum type,
+                                  const void *const *indices,
+                                  GLsizei drawcount,
+                                  const IndexRange **indexRangesOut);
+
     void blitFramebuffer(GLint srcX0,
                          GLint srcY0,
                          GLint srcX1,
@@ -749,6 +789,7 @@ class Context final : public ValidationContext
     void validateProgram(GLuint program);
 
     void handleError(const Error &error) override;
+    void onMemoryBudgetExceeded(uint64_t total, uint64_t budget);
 
     GLenum getError();
     void markContextLost();
@@ -781,8 +822,22 @@ class Context final : public ValidationContext
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
 
+    // Set for the contexts of a share group created with
+    // EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, whose shared resource managers lock.
+    bool usingMultithreadedShareGroup() const { return mMultithreadedShareGroup; }
+
+    // Buffers, textures and renderbuffers charge their storage to the tracker of the context that
+    // allocates it, see GL_ANGLE_memory_accounting.
+    const std::shared_ptr<MemoryTracker> &getMemoryTracker() const { return mMemoryTracker; }
+
+    // The generated entry points call the functions of the dispatch table, which validate, skip
+    // validation or generate context lost errors depending on the context.
+    const DispatchTable *getDispatchTable() const { return mDispatchTable; }
+
   private:
+    Error prepareForDraw();
     void syncRendererState();
+    void setContextLost();
     void syncRendererState(const State::DirtyBits &bitMask, const State::DirtyObjects &objectMask);
     void syncStateForReadPixels();
     void syncStateForTexImage();
@@ -801,10 +856,13 @@ class Context final : public ValidationContext
 
     void initRendererString();
     void initVersionStrings();
-    void initExtensionStrings();
+    void initExtensionStrings(CapsSnapshot *snapshot) const;
 
-    void initCaps(const egl::DisplayExtensions &displayExtensions);
-    void updateCaps();
+    void initCaps(const egl::DisplayExtensions &displayExtensions, CapsSnapshotCache *capsCache);
+    void setCapsSnapshot(std::shared_ptr<const CapsSnapshot> snapshot);
+    void generateCaps(const egl::DisplayExtensions &displayExtensions,
+                      CapsSnapshot *snapshot) const;
+    void updateCaps(CapsSnapshot *snapshot) const;
     void initWorkarounds();
 
     LabeledObject *getLabeledObject(GLenum identifier, GLuint name) const;
@@ -812,11 +870,9 @@ class Context final : public ValidationContext
 
     std::unique_ptr<rx::ContextImpl> mImplementation;
 
-    // Caps to use for validation
-    Caps mCaps;
-    TextureCapsMap mTextureCaps;
-    Extensions mExtensions;
-    Limitations mLimitations;
+    // Caps to use for validation. Shared with the contexts of the display that were created with
+    // the same attributes.
+    std::shared_ptr<const CapsSnapshot> mCapsSnapshot;
 
     // Shader compiler
     Compiler *mCompiler;
@@ -826,8 +882,6 @@ class Context final : public ValidationContext
     const egl::Config *mConfig;
     EGLenum mClientType;
 
-    TextureMap mZeroTextures;
-
     ResourceMap<FenceNV> mFenceNVMap;
     HandleAllocator mFenceNVHandleAllocator;
 
@@ -843,13 +897,11 @@ class Context final : public ValidationContext
     const char *mVersionString;
     const char *mShadingLanguageString;
     const char *mRendererString;
-    const char *mExtensionString;
-    std::vector<const char *> mExtensionStrings;
-    const char *mRequestableExtensionString;
-    std::vector<const char *> mRequestableExtensionStrings;
 
-    // Recorded errors
-    typedef std::set<GLenum> ErrorSet;
+    // Recorded errors, one bit per error code from GL_INVALID_ENUM to GL_CONTEXT_LOST. getError
+    // returns the lowest pending code first.
+    static constexpr size_t kErrorCodeCount = GL_CONTEXT_LOST_KHR - GL_INVALID_ENUM + 1;
+    using ErrorSet                          = angle::BitSet32<kErrorCodeCount>;
     ErrorSet mErrors;
 
     // Current/lost context flags
@@ -862,6 +914,9 @@ class Context final : public ValidationContext
     egl::Surface *mCurrentSurface;
     Framebuffer *mSurfacelessFramebuffer;
     bool mWebGLContext;
+    bool mMultithreadedShareGroup;
+
+    const DispatchTable *mDispatchTable;
 
     State::DirtyBits mTexImageDirtyBits;
     State::DirtyObjects mTexImageDirtyObjects;
@@ -876,6 +931,11 @@ class Context final : public ValidationContext
 
     // Not really a property of context state. The size and contexts change per-api-call.
     mutable angle::ScratchBuffer mScratchBuffer;
+
+    // Index ranges of the draws of the current multi-draw call, see getMultiDrawIndexRanges.
+    std::vector<IndexRange> mMultiDrawIndexRanges;
+
+    std::shared_ptr<MemoryTracker> mMemoryTracker;
 };
 
 template <EntryPoint EP, typename... ArgsT>
@@ -73,10 +73,10 @@ ContextState::ContextState(ContextID contextIn,
     : mClientVersion(clientVersion),
       mContext(contextIn),
       mState(stateIn),
-      mCaps(capsIn),
-      mTextureCaps(textureCapsIn),
-      mExtensions(extensionsIn),
-      mLimitations(limitationsIn),
+      mCaps(&capsIn),
+      mTextureCaps(&textureCapsIn),
+      mExtensions(&extensionsIn),
+      mLimitations(&limitationsIn),
       mBuffers(AllocateOrGetSharedResourceManager(shareContextState, &ContextState::mBuffers)),
       mShaderPrograms(
           AllocateOrGetSharedResourceManager(shareContextState, &ContextState::mShaderPrograms)),
@@ -100,12 +100,12 @@ ContextState::~ContextState()
 
 bool ContextState::isWebGL1() const
 {
-    return (mExtensions.webglCompatibility && mClientVersion.major == 2);
+    return (mExtensions->webglCompatibility && mClientVersion.major == 2);
 }
 
 const TextureCaps &ContextState::getTextureCap(GLenum internalFormat) const
 {
-    return mTextureCaps.get(internalFormat);
+    return mTextureCaps->get(internalFormat);
 }
 
 ValidationContext::ValidationContext(const ValidationContext *shareContext,
@@ -328,6 +328,20 @@ bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsign
             *type      = GL_INT;
             *numParams = 1;
             return true;
+        case GL_CONTEXT_BUFFER_MEMORY_ANGLE:
+        case GL_CONTEXT_TEXTURE_MEMORY_ANGLE:
+        case GL_CONTEXT_RENDERBUFFER_MEMORY_ANGLE:
+        case GL_SHARE_GROUP_BUFFER_MEMORY_ANGLE:
+        case GL_SHARE_GROUP_TEXTURE_MEMORY_ANGLE:
+        case GL_SHARE_GROUP_RENDERBUFFER_MEMORY_ANGLE:
+        case GL_CONTEXT_MEMORY_BUDGET_ANGLE:
+            if (!getExtensions().memoryAccounting)
+            {
+                return false;
+            }
+            *type      = GL_INT_64_ANGLEX;
+            *numParams = 1;
+            return true;
         case GL_COVERAGE_MODULATION_CHROMIUM:
             if (!getExtensions().framebufferMixedSamples)
             {
@@ -749,7 +763,7 @@ bool ValidationContext::usingDisplayTextureShareGroup() const
 
 GLenum ValidationContext::getConvertedRenderbufferFormat(GLenum internalformat) const
 {
-    return mState.mExtensions.webglCompatibility && mState.mClientVersion.major == 2 &&
+    return mState.mExtensions->webglCompatibility && mState.mClientVersion.major == 2 &&
                    internalformat == GL_DEPTH_STENCIL
                ? GL_DEPTH24_STENCIL8
                : internalformat;
@@ -53,10 +53,10 @@ class ContextState final : angle::NonCopyable
     GLint getClientMinorVersion() const { return mClientVersion.minor; }
     const Version &getClientVersion() const { return mClientVersion; }
     const State &getState() const { return *mState; }
-    const Caps &getCaps() const { return mCaps; }
-    const TextureCapsMap &getTextureCaps() const { return mTextureCaps; }
-    const Extensions &getExtensions() const { return mExtensions; }
-    const Limitations &getLimitations() const { return mLimitations; }
+    const Caps &getCaps() const { return *mCaps; }
+    const TextureCapsMap &getTextureCaps() const { return *mTextureCaps; }
+    const Extensions &getExtensions() const { return *mExtensions; }
+    const Limitations &getLimitations() const { return *mLimitations; }
 
     const TextureCaps &getTextureCap(GLenum internalFormat) const;
 
@@ -71,10 +71,10 @@ class ContextState final : angle::NonCopyable
     Version mClientVersion;
     ContextID mContext;
     State *mState;
-    const Caps &mCaps;
-    const TextureCapsMap &mTextureCaps;
-    const Extensions &mExtensions;
-    const Limitations &mLimitations;
+    const Caps *mCaps;
+    const TextureCapsMap *mTextureCaps;
+    const Extensions *mExtensions;
+    const Limitations *mLimitations;
 
     BufferManager *mBuffers;
     ShaderProgramManager *mShaderPrograms;
@@ -19,6 +19,7 @@
 #include <platform/Platform.h>
 #include <EGL/eglext.h>
 
+#include "common/TraceRecorder.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
@@ -435,6 +436,9 @@ Error Display::initialize()
 
     gl::InitializeDebugAnnotations(&mAnnotator);
 
+    angle::InitializeTraceRecorder(mAttributeMap.get(EGL_DISPLAY_TRACE_RECORDER_ANGLE, EGL_FALSE) ==
+                                   EGL_TRUE);
+
     SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayInitializeMS");
     TRACE_EVENT0("gpu.angle", "egl::Display::initialize");
 
@@ -519,6 +523,7 @@ void Display::terminate()
     }
 
     mConfigSet.clear();
+    mCapsSnapshots.clear();
 
     if (mDevice != nullptr && mDevice->getOwningDisplay() != nullptr)
     {
@@ -535,6 +540,9 @@ void Display::terminate()
 
     gl::UninitializeDebugAnnotations();
 
+    // Keep what was recorded so far, in case the process never exits cleanly.
+    angle::FlushTraceRecorder();
+
     // TODO(jmadill): Store Platform in Display and deinit here.
     ANGLEResetDisplayPlatform(this);
 }
@@ -692,6 +700,7 @@ Error Display::createStream(const AttributeMap &attribs, Stream **outStream)
 Error Display::createContext(const Config *configuration, gl::Context *shareContext, const AttributeMap &attribs,
                              gl::Context **outContext)
 {
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.ContextCreationMS");
     ASSERT(isInitialized());
 
     if (mImplementation->testDeviceLost())
@@ -717,8 +726,8 @@ Error Display::createContext(const Config *configuration, gl::Context *shareCont
     }
 
     gl::Context *context =
-        new gl::Context(mImplementation, configuration, shareContext, shareTextures, attribs,
-                        mDisplayExtensions, isRobustResourceInitEnabled());
+        new gl::Context(mImplementation, configuration, shareContext, shareTextures,
+                        &mCapsSnapshots, attribs, mDisplayExtensions, isRobustResourceInitEnabled());
 
     ASSERT(context != nullptr);
     mContextSet.insert(context);
@@ -940,6 +949,8 @@ static ClientExtensions GenerateClientExtensions()
     // TODO(jmadill): Not fully implemented yet, but exposed everywhere.
     extensions.displayRobustResourceInitialization = true;
 
+    extensions.displayTraceRecorder = true;
+
     return extensions;
 }
 
@@ -978,6 +989,7 @@ void Display::initDisplayExtensions()
     mDisplayExtensions.createContextWebGLCompatibility = true;
     mDisplayExtensions.createContextBindGeneratesResource = true;
     mDisplayExtensions.createContextClientArrays          = true;
+    mDisplayExtensions.createContextMemoryBudget          = true;
     mDisplayExtensions.pixelFormatFloat                   = true;
 
     // Force EGL_KHR_get_all_proc_addresses on.
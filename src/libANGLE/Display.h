@@ -178,6 +178,9 @@ class Display final : angle::NonCopyable
 
     gl::TextureManager *mTextureManager;
     size_t mGlobalTextureShareGroupUsers;
+
+    // Caps shared between the contexts of this display, rebuilt after the display is terminated.
+    gl::CapsSnapshotCache mCapsSnapshots;
 };
 
 }  // namespace egl
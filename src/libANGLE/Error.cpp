@@ -18,11 +18,15 @@ namespace gl
 {
 
 Error::Error(GLenum errorCode, std::string &&message)
-    : mCode(errorCode), mID(errorCode), mMessage(new std::string(std::move(message)))
+    : mCode(errorCode),
+      mID(errorCode),
+      mStaticMessage(nullptr),
+      mMessage(new std::string(std::move(message)))
 {
 }
 
-Error::Error(GLenum errorCode, const char *msg, ...) : mCode(errorCode), mID(errorCode)
+Error::Error(GLenum errorCode, const char *msg, ...)
+    : mCode(errorCode), mID(errorCode), mStaticMessage(nullptr)
 {
     va_list vararg;
     va_start(vararg, msg);
@@ -31,7 +35,8 @@ Error::Error(GLenum errorCode, const char *msg, ...) : mCode(errorCode), mID(err
     va_end(vararg);
 }
 
-Error::Error(GLenum errorCode, GLuint id, const char *msg, ...) : mCode(errorCode), mID(id)
+Error::Error(GLenum errorCode, GLuint id, const char *msg, ...)
+    : mCode(errorCode), mID(id), mStaticMessage(nullptr)
 {
     va_list vararg;
     va_start(vararg, msg);
@@ -44,7 +49,8 @@ void Error::createMessageString() const
 {
     if (!mMessage)
     {
-        mMessage.reset(new std::string);
+        // Static messages are only copied into a string the first time they are read.
+        mMessage.reset(mStaticMessage ? new std::string(mStaticMessage) : new std::string);
     }
 }
 
@@ -60,10 +66,10 @@ bool Error::operator==(const Error &other) const
         return false;
 
     // TODO(jmadill): Compare extended error codes instead of strings.
-    if ((!mMessage || !other.mMessage) && (!mMessage != !other.mMessage))
+    if (hasMessage() != other.hasMessage())
         return false;
 
-    return (*mMessage == *other.mMessage);
+    return (!hasMessage() || getMessage() == other.getMessage());
 }
 
 bool Error::operator!=(const Error &other) const
@@ -45,10 +45,18 @@ class ErrorOrResultBase
 namespace gl
 {
 
+// A static error message. Errors created from one only keep the pointer, so reporting them does
+// not allocate until the message is actually read. See ErrorStrings.h.
+struct ErrorMessage
+{
+    const char *text;
+};
+
 class Error final
 {
   public:
     explicit inline Error(GLenum errorCode);
+    inline Error(GLenum errorCode, const ErrorMessage &msg);
     Error(GLenum errorCode, std::string &&msg);
     Error(GLenum errorCode, const char *msg, ...);
     Error(GLenum errorCode, GLuint id, const char *msg, ...);
@@ -70,11 +78,13 @@ class Error final
 
   private:
     void createMessageString() const;
+    bool hasMessage() const { return mMessage || mStaticMessage; }
 
     friend std::ostream &operator<<(std::ostream &os, const Error &err);
 
     GLenum mCode;
     GLuint mID;
+    const char *mStaticMessage;
     mutable std::unique_ptr<std::string> mMessage;
 };
 
@@ -15,13 +15,22 @@ namespace gl
 
 Error::Error(GLenum errorCode)
     : mCode(errorCode),
-      mID(errorCode)
+      mID(errorCode),
+      mStaticMessage(nullptr)
+{
+}
+
+Error::Error(GLenum errorCode, const ErrorMessage &msg)
+    : mCode(errorCode),
+      mID(errorCode),
+      mStaticMessage(msg.text)
 {
 }
 
 Error::Error(const Error &other)
     : mCode(other.mCode),
-      mID(other.mID)
+      mID(other.mID),
+      mStaticMessage(other.mStaticMessage)
 {
     if (other.mMessage)
     {
@@ -33,6 +42,7 @@ Error::Error(const Error &other)
 Error::Error(Error &&other)
     : mCode(other.mCode),
       mID(other.mID),
+      mStaticMessage(other.mStaticMessage),
       mMessage(std::move(other.mMessage))
 {
 }
@@ -41,6 +51,7 @@ Error &Error::operator=(const Error &other)
 {
     mCode = other.mCode;
     mID = other.mID;
+    mStaticMessage = other.mStaticMessage;
 
     if (other.mMessage)
     {
@@ -61,6 +72,7 @@ Error &Error::operator=(Error &&other)
     {
         mCode = other.mCode;
         mID = other.mID;
+        mStaticMessage = other.mStaticMessage;
         mMessage = std::move(other.mMessage);
     }
 
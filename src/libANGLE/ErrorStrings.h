@@ -0,0 +1,531 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ErrorStrings.h: Interned messages for the GL errors generated by validation. An Error built
+// from one of these only stores a pointer; the message string is created on demand when it is
+// forwarded to the debug output.
+//
+
+#ifndef LIBANGLE_ERRORSTRINGS_H_
+#define LIBANGLE_ERRORSTRINGS_H_
+
+#include "libANGLE/Error.h"
+
+#define ERRMSG(name, message) constexpr gl::ErrorMessage kError##name = {message};
+
+namespace gl
+{
+
+ERRMSG(AtomicCounterBufferBindingOutOfRange,
+       "index is outside the valid range for GL_ATOMIC_COUNTER_BUFFER_BINDING")
+ERRMSG(AtomicCounterBufferRequiresES31, "ATOMIC_COUNTER_BUFFER is not supported before GLES 3.1")
+ERRMSG(AtomicCounterBuffersNotSupported,
+       "Atomic Counter buffers are not supported in this version of GL")
+ERRMSG(AttribArrayIndexOutOfRange, "Attrib array index out of range")
+ERRMSG(AttribBindingIndexOutOfRange, "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS")
+ERRMSG(AttribIndexExceedsMaxVertexAttribs, "attribindex must be smaller than MAX_VERTEX_ATTRIBS.")
+ERRMSG(AttribLocationProgramNotLinked, "program not linked.")
+ERRMSG(BindBufferNotGenerated, "Buffer was not generated")
+ERRMSG(BindBuiltInAttribute, "Cannot Bind built-in attributes")
+ERRMSG(BindBuiltInVariable, "Cannot bind a built-in variable.")
+ERRMSG(BindUniformLocationNotAvailable, "GL_CHROMIUM_bind_uniform_location is not available.")
+ERRMSG(BindingIndexExceedsMaxBindings,
+       "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS.")
+ERRMSG(BlitExtensionNotAvailable, "Blit extension not available.")
+ERRMSG(BlitMixedFixedAndFloat,
+       "If the read buffer contains fixed-point or floating-point values, the draw buffer must as "
+       "well.")
+ERRMSG(BlitMixedFixedPoint,
+       "If the read buffer contains fixed-point values, the draw buffer must as well.")
+ERRMSG(BlitSameColorImage, "Read and write color attachments cannot be the same image.")
+ERRMSG(BlitSameDepthStencilImage,
+       "Read and write depth stencil attachments cannot be the same image.")
+ERRMSG(BlitScaleOrFlip,
+       "Scaling and flipping in BlitFramebufferANGLE not supported by this implementation.")
+ERRMSG(BufferAlreadyMapped, "Buffer is already mapped.")
+ERRMSG(BufferMapPointerQuery, "GL_BUFFER_MAP_POINTER can only be queried with GetBufferPointerv.")
+ERRMSG(BufferMappingLengthIsZero, "Buffer mapping length is zero.")
+ERRMSG(BufferNotGenerated, "Buffer was not generated.")
+ERRMSG(BufferNotMapped, "Buffer not mapped.")
+ERRMSG(BufferZeroPointer, "Can not get pointer for reserved buffer name zero.")
+ERRMSG(ClearTypeMismatch, "No defined conversion between clear value and attachment format.")
+ERRMSG(ClientDataWithVertexArrayObject,
+       "Client data cannot be used with a non-default vertex array object.")
+ERRMSG(ColorAttachmentIndexTooLarge,
+       "Requested color attachment is greater than the maximum supported color attachments")
+ERRMSG(ComputeShaderPrecision, "compute shader precision not yet implemented.")
+ERRMSG(ComputeShaderRequiresES31, "GL_COMPUTE_SHADER requires OpenGL ES 3.1.")
+ERRMSG(ContextLost, "Context has been lost.")
+ERRMSG(CoordSizeOverflow, "Coord size overflow.")
+ERRMSG(CopyBufferMapped, "Cannot call CopyBufferSubData on a mapped buffer")
+ERRMSG(CopyBufferOffsetOverflow, "Buffer offset overflow in CopyBufferSubData")
+ERRMSG(CopyBufferSubDataRequiresES3, "CopyBufferSubData requires ES 3 or greater")
+ERRMSG(CopyCompressedTextureNotAvailable,
+       "GL_CHROMIUM_copy_compressed_texture extension not available.")
+ERRMSG(CopyFeedbackLoop,
+       "Texture copying feedback loop formed between Framebuffer and specified Texture level.")
+ERRMSG(CopyOffsetOverflow, "Integer overflow when validating copy offsets.")
+ERRMSG(CopyTextureNotAvailable, "GL_CHROMIUM_copy_texture extension not available.")
+ERRMSG(CubeMapDestinationNotSquare,
+       "Destination width and height must be equal for cube map textures.")
+ERRMSG(DebugGroupStackOverflow,
+       "Cannot push more than GL_MAX_DEBUG_GROUP_STACK_DEPTH debug groups.")
+ERRMSG(DebugMessageControlSeverity, "If count is greater than zero, severity must be GL_DONT_CARE.")
+ERRMSG(DebugMessageControlSourceAndType,
+       "If count is greater than zero, source and severity cannot be GL_DONT_CARE.")
+ERRMSG(DebugMessageTooLong, "Message length is larger than GL_MAX_DEBUG_MESSAGE_LENGTH.")
+ERRMSG(DefaultFramebufferAttachment, "Cannot change default FBO's attachments")
+ERRMSG(DefaultFramebufferBound, "Default framebuffer is bound to target.")
+ERRMSG(DefaultFramebufferDrawBufferCount, "n must be 1 when GL is bound to the default framebuffer")
+ERRMSG(DefaultVertexArrayBound, "Default vertex array object is bound.")
+ERRMSG(DefaultVertexArrayBufferBound, "Default vertex array buffer is bound.")
+ERRMSG(DeleteActiveTransformFeedback, "Attempt to delete active transform feedback.")
+ERRMSG(DeleteProgramWithShader, "Shader handle passed to DeleteProgram")
+ERRMSG(DeleteShaderWithProgram, "Program handle passed to DeleteShader")
+ERRMSG(DepthFormat3DTexture,
+       "Format cannot be GL_DEPTH_COMPONENT or GL_DEPTH_STENCIL if target is GL_TEXTURE_3D")
+ERRMSG(DepthRangeInverted, "Depth near > far.")
+ERRMSG(DestinationImmutable, "Destination cannot be immutable.")
+ERRMSG(DestinationLevelUndefined,
+       "The destination level of the destination texture must be defined.")
+ERRMSG(DestinationTextureImmutable, "Destination texture is immutable.")
+ERRMSG(DestinationTextureNot2D, "Destination texture must be of type GL_TEXTURE_2D.")
+ERRMSG(DestinationTextureTooSmall, "Destination texture not large enough to copy to.")
+ERRMSG(DetachNonAttachedShader, "Cannot detach non-attached shader.")
+ERRMSG(DisjointTimerQueryNotEnabled, "Disjoint timer query not enabled")
+ERRMSG(DrawBufferCountOutOfRange, "n must be non-negative and no greater than MAX_DRAW_BUFFERS")
+ERRMSG(DrawBufferIndexExceedsMax, "Buffer value is greater than MAX_DRAW_BUFFERS")
+ERRMSG(EGLImage2DTargetNotEnabled, "GL_TEXTURE_2D texture target requires GL_OES_EGL_image.")
+ERRMSG(EGLImageExternalTargetNotEnabled,
+       "GL_TEXTURE_EXTERNAL_OES texture target requires GL_OES_EGL_image_external.")
+ERRMSG(EGLImageMultisampledTexture, "cannot create a 2D texture from a multisampled EGL image.")
+ERRMSG(EGLImageNotRenderable, "EGL image internal format is not supported as a renderbuffer.")
+ERRMSG(EGLImageNotTexturable, "EGL image internal format is not supported as a texture.")
+ERRMSG(ES30Required, "Context does not support GLES3.0")
+ERRMSG(ES31NotSupported, "Context does not support GLES3.1")
+ERRMSG(ES31Required, "Context does not support GLES3.1.")
+ERRMSG(ES3Disabled, "GLES 3.0 disabled")
+ERRMSG(ES3Required, "Context does not support GLES3.")
+ERRMSG(EntryPointRequiresES3, "Entry point requires at least OpenGL ES 3.0.")
+ERRMSG(ExceedsMaxElement, "Element value exceeds maximum element index.")
+ERRMSG(ExpectedProgramName, "Expected a program name, but found a shader name")
+ERRMSG(ExpectedShaderName, "Expected a shader name, but found a program name")
+ERRMSG(ExplicitFlushWithoutWrite,
+       "The explicit flushing bit may only be set if the buffer is mapped for writing.")
+ERRMSG(ExtensionNotEnabled, "Extension not enabled")
+ERRMSG(ExtensionNotSupported, "Extension not supported.")
+ERRMSG(ExtensionStringIndexOutOfRange, "index must be less than the number of extension strings.")
+ERRMSG(ExternalTextureBaseLevel, "Base level must be 0 for external textures.")
+ERRMSG(ExternalTextureES3Parameters,
+       "ES3 texture parameters are not available without GL_OES_EGL_image_external_essl3.")
+ERRMSG(ExternalTextureExtensionNotEnabled, "External texture extension not enabled")
+ERRMSG(ExternalTextureFilter, "external textures only support NEAREST and LINEAR filtering")
+ERRMSG(ExternalTextureNotEnabled,
+       "Neither NV_EGL_stream_consumer_external nor GL_OES_EGL_image_external extensions enabled")
+ERRMSG(ExternalTextureWrapMode, "external textures only support CLAMP_TO_EDGE wrap mode")
+ERRMSG(FeedbackLoop, "Rendering feedback loop formed between Framebuffer and active Texture.")
+ERRMSG(FixedNotSupportedInWebGL, "GL_FIXED is not supported in WebGL.")
+ERRMSG(FlushBufferZero, "Attempted to flush buffer object zero.")
+ERRMSG(FlushNotExplicitlyMapped, "Attempted to flush a buffer not mapped for explicit flushing.")
+ERRMSG(FlushRangeOutsideMapping, "Flushed range does not fit into buffer mapping dimensions.")
+ERRMSG(FormatMismatch, "Format must match the internal format of the texture.")
+ERRMSG(FragmentInputTypeNotFloat, "Fragment input type is not a floating point scalar or vector.")
+ERRMSG(FragmentOutputTypeMismatch,
+       "Fragment shader output type does not match the bound framebuffer attachment type.")
+ERRMSG(FramebufferHeightOutOfRange, "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_HEIGHT.")
+ERRMSG(FramebufferMixedSamplesNotAvailable,
+       "GL_CHROMIUM_framebuffer_mixed_samples is not available.")
+ERRMSG(FramebufferMultisampleNotAvailable, "GL_ANGLE_framebuffer_multisample not available")
+ERRMSG(FramebufferMultisampleNotEnabled, "GL_ANGLE_framebuffer_multisample is not enabled.")
+ERRMSG(FramebufferNotGenerated, "Framebuffer was not generated")
+ERRMSG(FramebufferSamplesOutOfRange,
+       "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_SAMPLES.")
+ERRMSG(FramebufferWidthOutOfRange, "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_WIDTH.")
+ERRMSG(GenerateMipmapSRGB, "Mipmap generation of sRGB textures is not allowed.")
+ERRMSG(GetStringiRequiresES3, "glGetStringi requires OpenGL ES 3.0 or higher.")
+ERRMSG(GetSyncivRequiresES3, "GetSynciv requires OpenGL ES 3.0 or higher.")
+ERRMSG(HintRequiresStandardDerivatives, "hint requires OES_standard_derivatives.")
+ERRMSG(IndexBufferMapped, "Index buffer is mapped.")
+ERRMSG(IndexBufferTooSmall, "Index buffer is not big enough for the draw.")
+ERRMSG(IndexExceedsActiveAttributeCount, "index exeeds program active attribute count.")
+ERRMSG(IndexExceedsActiveUniformBlockCount, "uniformBlockIndex exceeds active uniform block count.")
+ERRMSG(IndexExceedsActiveUniformCount, "index exceeds program active uniform count.")
+ERRMSG(IndexExceedsMaxAtomicCounterBufferBindings,
+       "index is greater than or equal to the number of ATOMIC_COUNTER_BUFFER indexed binding "
+       "points.")
+ERRMSG(IndexExceedsMaxShaderStorageBufferBindings,
+       "index is greater than or equal to the number of SHADER_STORAGE_BUFFER indexed binding "
+       "points.")
+ERRMSG(IndexExceedsMaxTransformFeedbackBufferBindings,
+       "index is greater than or equal to the number of TRANSFORM_FEEDBACK_BUFFER indexed binding "
+       "points.")
+ERRMSG(IndexExceedsMaxUniformBufferBindings,
+       "index is greater than or equal to the number of UNIFORM_BUFFER indexed binding points.")
+ERRMSG(IndexExceedsMaxVertexAttribs, "Index exceeds MAX_VERTEX_ATTRIBS")
+ERRMSG(IndexExceedsMaxVertexAttributes,
+       "index must be less than the value of GL_MAX_VERTEX_ATTRIBUTES.")
+ERRMSG(IndicesOutsideElementRange, "Indices are out of the start, end range.")
+ERRMSG(IndirectBufferTooSmall,
+       "the  command  would source data beyond the end of the buffer object.")
+ERRMSG(IntegerOverflow, "Integer overflow.")
+ERRMSG(InternalFormatNotRenderable, "Internal format is not renderable.")
+ERRMSG(Invalid3DTextureTarget, "Must specify a valid 3D texture destination target")
+ERRMSG(InvalidAlphaBlendEquation, "Invalid alpha blend equation")
+ERRMSG(InvalidAttachment, "Invalid attachment")
+ERRMSG(InvalidAttribSize, "size must be between one and four.")
+ERRMSG(InvalidAttributeNameCharacters, "Attribute name contains invalid characters")
+ERRMSG(InvalidBindBufferTarget, "Invalid Buffer target")
+ERRMSG(InvalidBindFramebufferTarget, "Invalid Framebuffer target")
+ERRMSG(InvalidBindTextureTarget, "Invalid target")
+ERRMSG(InvalidBlendEquation, "Invalid blend equation")
+ERRMSG(InvalidBlendFunction, "Invalid blend function")
+ERRMSG(InvalidBufferName, "name is not a valid buffer.")
+ERRMSG(InvalidBufferTarget, "Invalid buffer target.")
+ERRMSG(InvalidBufferValue, "Invalid buffer value")
+ERRMSG(InvalidCap, "Invalid cap.")
+ERRMSG(InvalidCommand, "Invalid command.")
+ERRMSG(InvalidComponents, "Invalid components.")
+ERRMSG(InvalidCompressedFormat, "Not a valid compressed texture format")
+ERRMSG(InvalidCompressedFormatDimension, "Invalid compressed format dimension.")
+ERRMSG(InvalidCoordinateType, "Invalid coordinate type.")
+ERRMSG(InvalidCopyBufferTarget, "Invalid buffer target")
+ERRMSG(InvalidCoverMode, "Invalid cover mode.")
+ERRMSG(InvalidCullFaceParameter, "Invalid cull face parameter")
+ERRMSG(InvalidDebugSeverity, "Invalid debug severity.")
+ERRMSG(InvalidDebugSource, "Invalid debug source.")
+ERRMSG(InvalidDebugType, "Invalid debug type.")
+ERRMSG(InvalidDefaultFramebufferAttachment,
+       "Invalid attachment when the default framebuffer is bound")
+ERRMSG(InvalidDefaultFramebufferDrawBuffer,
+       "Only NONE or BACK are valid values when drawing to the default framebuffer")
+ERRMSG(InvalidDepthFunction, "Invalid depth function")
+ERRMSG(InvalidDestinationFormatAndType,
+       "Destination internal format and type combination is not valid.")
+ERRMSG(InvalidDestinationTexture, "Destination texture is not a valid texture object.")
+ERRMSG(InvalidDestinationTextureLevel, "Destination texture level is not valid.")
+ERRMSG(InvalidDestinationTextureType, "Destination texture a valid texture type.")
+ERRMSG(InvalidDiscardFramebufferTarget, "Invalid framebuffer target")
+ERRMSG(InvalidDrawBuffer, "Ith value does not match COLOR_ATTACHMENTi or NONE")
+ERRMSG(InvalidEGLImage, "EGL image is not valid.")
+ERRMSG(InvalidEGLImageRenderbufferTarget, "invalid renderbuffer target.")
+ERRMSG(InvalidEGLImageTextureTarget, "invalid texture target.")
+ERRMSG(InvalidEndCaps, "Invalid end caps.")
+ERRMSG(InvalidFillMode, "Invalid fill mode.")
+ERRMSG(InvalidFlushRange, "Invalid offset/length parameters.")
+ERRMSG(InvalidFormat, "Invalid format.")
+ERRMSG(InvalidFormatCombination, "Invalid combination of format, type and internalFormat.")
+ERRMSG(InvalidFramebufferName, "name is not a valid framebuffer.")
+ERRMSG(InvalidFramebufferTarget, "Invalid framebuffer target.")
+ERRMSG(InvalidFrontFaceMode, "Invalid mode for FrontFace")
+ERRMSG(InvalidGenMode, "Invalid gen mode.")
+ERRMSG(InvalidHintMode, "invalid hint mode.")
+ERRMSG(InvalidHintTarget, "invalid hint target.")
+ERRMSG(InvalidIdentifier, "Invalid identifier.")
+ERRMSG(InvalidInternalFormat, "Invalid internalFormat.")
+ERRMSG(InvalidJoinStyle, "Invalid join style.")
+ERRMSG(InvalidMapRange, "Invalid offset or length.")
+ERRMSG(InvalidMatrix, "Invalid matrix.")
+ERRMSG(InvalidMatrixMode, "Invalid matrix mode.")
+ERRMSG(InvalidMiterLimit, "Invalid miter limit.")
+ERRMSG(InvalidMultisamplePname, "Pname must be SAMPLE_POSITION.")
+ERRMSG(InvalidMultisampleTextureTarget, "Target must be TEXTURE_2D_MULTISAMPLE.")
+ERRMSG(InvalidName, "Invalid name.")
+ERRMSG(InvalidNumberOfCommands, "Invalid number of commands.")
+ERRMSG(InvalidNumberOfCoordinates, "Invalid number of coordinates.")
+ERRMSG(InvalidPackedAttribSize,
+       "Type is INT_2_10_10_10_REV or UNSIGNED_INT_2_10_10_10_REV and size is not 4.")
+ERRMSG(InvalidPathFragmentInputComponents,
+       "GLenum components is not one of GL_RGB, GL_RGBA, GL_ALPHA or GL_NONE.")
+ERRMSG(InvalidPathNameType, "Invalid path name type.")
+ERRMSG(InvalidPathParameter, "Invalid path parameter.")
+ERRMSG(InvalidPname, "Invalid pname.")
+ERRMSG(InvalidPnameEnum, "Invalid pname enum")
+ERRMSG(InvalidPrecisionType, "invalid precision type.")
+ERRMSG(InvalidPrimitiveMode, "Invalid primitive mode.")
+ERRMSG(InvalidProgramBinaryFormat, "Program binary format is not valid.")
+ERRMSG(InvalidProgramHandle, "Invalid program handle")
+ERRMSG(InvalidProgramName, "name is not a valid program.")
+ERRMSG(InvalidQueryId, "Invalid query id")
+ERRMSG(InvalidQueryName, "name is not a valid query.")
+ERRMSG(InvalidQueryPname, "Invalid pname")
+ERRMSG(InvalidQueryTarget, "Invalid query target")
+ERRMSG(InvalidQueryType, "Invalid query type")
+ERRMSG(InvalidRGBBlendEquation, "Invalid RGB blend equation")
+ERRMSG(InvalidRange, "Invalid range.")
+ERRMSG(InvalidReadBufferSource, "Unknown enum for 'src' in ReadBuffer")
+ERRMSG(InvalidRenderbufferName, "name is not a valid renderbuffer.")
+ERRMSG(InvalidRenderbufferTarget, "Invalid Renderbuffer target")
+ERRMSG(InvalidSampler, "Sampler is not valid.")
+ERRMSG(InvalidSamplerName, "name is not a valid sampler.")
+ERRMSG(InvalidShaderBinaryFormat, "Invalid shader binary format.")
+ERRMSG(InvalidShaderHandle, "Invalid shader handle")
+ERRMSG(InvalidShaderName, "name is not a valid shader.")
+ERRMSG(InvalidShaderSourceCharacters, "Shader source contains invalid characters")
+ERRMSG(InvalidShaderType, "invalid shader type.")
+ERRMSG(InvalidSourceTexture, "Source texture is not a valid texture object.")
+ERRMSG(InvalidSourceTextureFormat, "Source texture internal format is invalid.")
+ERRMSG(InvalidSourceTextureLevel, "Source texture level is not valid.")
+ERRMSG(InvalidSourceTextureType, "Source texture a valid texture type.")
+ERRMSG(InvalidStencilBitMask, "Invalid stencil bit mask.")
+ERRMSG(InvalidStencilFace, "Invalid stencil face.")
+ERRMSG(InvalidStencilFailOp, "Invalid stencil fail op.")
+ERRMSG(InvalidStencilFunction, "Invalid stencil function.")
+ERRMSG(InvalidStencilZFailOp, "Invalid stencil z fail op.")
+ERRMSG(InvalidStencilZPassOp, "Invalid stencil z pass op.")
+ERRMSG(InvalidStrokeWidth, "Invalid stroke width.")
+ERRMSG(InvalidSyncName, "name is not a valid sync.")
+ERRMSG(InvalidSyncObject, "Invalid sync object.")
+ERRMSG(InvalidTarget, "Invalid target.")
+ERRMSG(InvalidTexture, "Invalid texture")
+ERRMSG(InvalidTextureDimensions, "Invalid texture dimensions.")
+ERRMSG(InvalidTextureName, "name is not a valid texture.")
+ERRMSG(InvalidTextureTarget, "Invalid texture target")
+ERRMSG(InvalidTransformFeedbackName, "name is not a valid transform feedback.")
+ERRMSG(InvalidTransformation, "Invalid transformation.")
+ERRMSG(InvalidType, "Invalid type.")
+ERRMSG(InvalidUniformLocation, "Invalid uniform location")
+ERRMSG(InvalidUniformNameCharacters, "Uniform name contains invalid characters")
+ERRMSG(InvalidUserFramebufferAttachment,
+       "Invalid attachment when the default framebuffer is not bound")
+ERRMSG(InvalidVertexArrayName, "name is not a valid vertex array.")
+ERRMSG(InvalidVertexType, "Invalid vertex type.")
+ERRMSG(InvalidWidthValue, "Invalid width value.")
+ERRMSG(InvertedElementRange, "end < start")
+ERRMSG(LabelTooLong, "Label length is larger than GL_MAX_LABEL_LENGTH.")
+ERRMSG(LinearBlitNotSupported, "Linear blit not supported in this extension")
+ERRMSG(LinkProgramDuringTransformFeedback,
+       "Cannot link program while program is associated with an active transform feedback object.")
+ERRMSG(LocationExceedsMaxUniforms,
+       "Location must be less than (MAX_VERTEX_UNIFORM_VECTORS + MAX_FRAGMENT_UNIFORM_VECTORS) * 4")
+ERRMSG(LocationExceedsMaxVarying, "Location exceeds max varying.")
+ERRMSG(LossyETCDecodeCompressedNotSupported, "ANGLE_lossy_etc_decode extension is not supported")
+ERRMSG(LossyETCDecodeCopyDestination, "ETC lossy decode formats can't be copied to.")
+ERRMSG(LossyETCDecodeNotSupported, "ANGLE_lossy_etc_decode extension is not supported.")
+ERRMSG(LossyETCDecodeType, "ETC lossy decode formats can't work with this type.")
+ERRMSG(MapBufferAccessUnspecified, "Need to map buffer for either reading or writing.")
+ERRMSG(MapBufferNotAvailable, "Map buffer extension not available.")
+ERRMSG(MapBufferRangeNotAvailable, "Map buffer range extension not available.")
+ERRMSG(MapBufferRequiresES3OrOES,
+       "Context does not support OpenGL ES 3.0 or GL_OES_mapbuffer is not enabled.")
+ERRMSG(MapBufferZero, "Attempted to map buffer object zero.")
+ERRMSG(MapRangeOutsideBuffer, "Mapped range does not fit into buffer dimensions.")
+ERRMSG(MaxAnisotropyTooSmall, "Max anisotropy must be at least 1.")
+ERRMSG(MisalignedAtomicCounterBufferOffset, "offset must be a multiple of 4.")
+ERRMSG(MisalignedAtomicCounterBufferRange, "offset and size must be multiple of 4.")
+ERRMSG(MisalignedIndices, "indices must be a multiple of the element type size.")
+ERRMSG(MisalignedIndirect,
+       "indirect is not a multiple of the size, in basic machine units, of uint")
+ERRMSG(MisalignedOffset, "Offset is not a multiple of the type size.")
+ERRMSG(MisalignedShaderStorageBufferOffset,
+       "offset must be multiple of value of SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT.")
+ERRMSG(MisalignedStride, "Stride is not a multiple of the type size.")
+ERRMSG(MisalignedUniformBufferOffset,
+       "offset must be multiple of value of UNIFORM_BUFFER_OFFSET_ALIGNMENT.")
+ERRMSG(MissingReadAttachment, "Missing read attachment")
+ERRMSG(MissingReadColorAttachment,
+       "Attempt to read from a missing color attachment of a complete framebuffer.")
+ERRMSG(MissingReadDepthStencilAttachment,
+       "Attempt to read from a missing depth/stencil attachment of a complete framebuffer.")
+ERRMSG(MultiDrawDuringTransformFeedback,
+       "Multi-draw commands cannot be used while transform feedback is active.")
+ERRMSG(MultisampleTextureLevel, "Level must be 0 for TEXTURE_2D_MULTISAMPLE.")
+ERRMSG(NegativeBaseLevel, "Base level must be at least 0.")
+ERRMSG(NegativeBindBufferOffset, "buffer is non-zero and offset is negative.")
+ERRMSG(NegativeBufSize, "bufSize cannot be negative.")
+ERRMSG(NegativeBufsize, "bufsize must be non-negative.")
+ERRMSG(NegativeCopyBufferRange, "readOffset, writeOffset and size must all be non-negative")
+ERRMSG(NegativeCount, "n < 0")
+ERRMSG(NegativeDrawCount, "drawcount cannot be negative.")
+ERRMSG(NegativeGenOrDeleteCount, "count < 0")
+ERRMSG(NegativeIndicesOffset, "Offset < 0.")
+ERRMSG(NegativeLocation, "Location cannot be less than 0.")
+ERRMSG(NegativeMaxCount, "max count must be non-negative.")
+ERRMSG(NegativeMaxLevel, "Max level must be at least 0.")
+ERRMSG(NegativeNumAttachments, "numAttachments must not be less than zero")
+ERRMSG(NegativeNumPaths, "Invalid (negative) numPaths.")
+ERRMSG(NegativePixelStoreValue, "Cannot use negative values in PixelStorei")
+ERRMSG(NegativePrimcount, "primcount cannot be negative.")
+ERRMSG(NegativeReadPixelsSize, "width and height must be positive")
+ERRMSG(NegativeScissorSize, "Scissor width and height must be non-negative.")
+ERRMSG(NegativeShaderSourceCount, "Count must be non-negative.")
+ERRMSG(NegativeSize, "width and height cannot be negative.")
+ERRMSG(NegativeStride, "stride cannot be negative.")
+ERRMSG(NegativeVertexBufferOffset, "offset cannot be negative.")
+ERRMSG(NegativeViewportSize, "Viewport width and height must be non-negative.")
+ERRMSG(NegativeXY, "x and y cannot be negative.")
+ERRMSG(NegativeXYOffset, "xoffset and yoffset cannot be negative.")
+ERRMSG(NoActiveComputeProgram, "No active program object for the compute shader stage.")
+ERRMSG(NoBufferBound, "No buffer bound.")
+ERRMSG(NoBufferBoundToTarget, "No buffer bound to target")
+ERRMSG(NoCoefficientsArrayGiven, "No coefficients array given.")
+ERRMSG(NoCommandsArrayGiven, "No commands array given.")
+ERRMSG(NoComputeShaderInProgram,
+       "Program has not been successfully linked, or program contains no compute shaders.")
+ERRMSG(NoCoordinateArrayGiven, "No coordinate array given.")
+ERRMSG(NoDrawIndirectBuffer, "zero is bound to DRAW_INDIRECT_BUFFER")
+ERRMSG(NoElementArrayBuffer, "There is no element array buffer bound and count > 0.")
+ERRMSG(NoElementArrayBufferForIndirect, "zero is bound to ELEMENT_ARRAY_BUFFER")
+ERRMSG(NoElementArrayBufferOrPointer, "No element array buffer and no pointer.")
+ERRMSG(NoNameGiven, "No name given.")
+ERRMSG(NoPathNameArray, "No path name array.")
+ERRMSG(NoPathOrPathData, "No such path or path has no data.")
+ERRMSG(NoProgramBinaryFormats, "No program binary formats supported.")
+ERRMSG(NoReadFramebuffer, "No active read framebuffer.")
+ERRMSG(NoRenderbufferBound, "No renderbuffer bound.")
+ERRMSG(NoSuchBinding, "No such binding.")
+ERRMSG(NoSuchPathObject, "No such path object.")
+ERRMSG(NoSuchProgram, "No such program.")
+ERRMSG(NoTextureBound, "No texture bound.")
+ERRMSG(NoTextureBoundToTarget, "Zero is bound to target.")
+ERRMSG(NoTransformArrayGiven, "No transform array given.")
+ERRMSG(NoValueArray, "No value array.")
+ERRMSG(NoVertexArrayForIndirect, "zero is bound to VERTEX_ARRAY_BINDING")
+ERRMSG(NoZeroDivisor, "At least one attribute must have a divisor of zero.")
+ERRMSG(NonPositiveBindBufferSize, "buffer is non-zero and size is less than or equal to zero.")
+ERRMSG(NonPositiveBufSize, "bufSize must be a positive number")
+ERRMSG(NonPositiveMessageLogBufSize, "bufSize must be positive if messageLog is not null.")
+ERRMSG(NonPositiveSize, "Width and height must be positive.")
+ERRMSG(NonWriteMapNotSupported, "Non-write buffer mapping not supported.")
+ERRMSG(NonZeroImageSizeWithoutData, "imageSize must be 0 if no texture data is provided.")
+ERRMSG(NumPathsOverflow, "Overflow in numPaths.")
+ERRMSG(OpenGLES30Required, "Context does not support OpenGL ES 3.0.")
+ERRMSG(OperationRequiresES3, "Operation only supported on ES 3.0 and above")
+ERRMSG(OtherQueryIsActive, "Other query is active")
+ERRMSG(PartialDepthStencilBlit,
+       "Only whole-buffer depth and stencil blits are supported by this extension.")
+ERRMSG(PathDataSizeOverflow, "Overflow in num paths.")
+ERRMSG(PathRenderingNotAvailable, "GL_CHROMIUM_path_rendering is not available.")
+ERRMSG(PixelPackBufferMapped, "Pixel pack buffer is mapped.")
+ERRMSG(PixelPackBufferOverflow, "Writes would overflow the pixel pack buffer.")
+ERRMSG(PixelUnpackBufferMapped, "Pixel unpack buffer is mapped.")
+ERRMSG(PixelUnpackBufferOverflow, "Reads would overflow the pixel unpack buffer.")
+ERRMSG(PnameRequiresES3, "pname requires OpenGL ES 3.0.")
+ERRMSG(PnameRequiresES31, "pname requires OpenGL ES 3.1.")
+ERRMSG(PnameRequiresES3OrMapBuffer,
+       "pname requires OpenGL ES 3.0, GL_OES_mapbuffer or GL_EXT_map_buffer_range.")
+ERRMSG(PnameRequiresES3OrMapBufferOES, "pname requires OpenGL ES 3.0 or GL_OES_mapbuffer.")
+ERRMSG(PnameRequiresES3OrMapBufferRange, "pname requires OpenGL ES 3.0 or GL_EXT_map_buffer_range.")
+ERRMSG(PopDefaultDebugGroup, "Cannot pop the default debug group.")
+ERRMSG(ProgramBinaryDuringTransformFeedback,
+       "Cannot change program binary while program is associated with an active transform feedback "
+       "object.")
+ERRMSG(ProgramBinaryLengthQuery,
+       "Querying GL_PROGRAM_BINARY_LENGTH requires GL_OES_get_program_binary or ES 3.0.")
+ERRMSG(ProgramDoesNotExist, "Program name is not valid")
+ERRMSG(ProgramInvalid, "Program invalid.")
+ERRMSG(ProgramIsNotLinked, "Program is not linked.")
+ERRMSG(ProgramNotLinked, "Program not linked.")
+ERRMSG(ProgramResourceRequiresES31, "Context does not support GLES 3.1.")
+ERRMSG(ProgramSeparableRequiresES31, "PROGRAM_SEPARABLE is not supported before GLES 3.1")
+ERRMSG(QueryActive, "Query is active")
+ERRMSG(QueryDoesNotExist, "Query does not exist")
+ERRMSG(QueryExtensionNotEnabled, "Query extension not enabled")
+ERRMSG(QueryIdZero, "Query id is 0")
+ERRMSG(QueryObjectActive, "Query currently active")
+ERRMSG(QueryRequiresES3, "GLES version < 3.0")
+ERRMSG(QueryTargetNotActive, "Query target not active")
+ERRMSG(QueryTypeMismatch, "Query type does not match target")
+ERRMSG(QueryingRequiresES3, "Querying requires at least ES 3.0.")
+ERRMSG(QueryingRequiresES31, "Querying requires at least ES 3.1.")
+ERRMSG(RangeOverflow, "Range overflow.")
+ERRMSG(ReadBufferNone, "Read buffer is GL_NONE")
+ERRMSG(RelativeOffsetTooLarge,
+       "relativeOffset cannot be greater than MAX_VERTEX_ATTRIB_RELATIVE_OFFSET.")
+ERRMSG(RenderbufferNotGenerated, "Renderbuffer was not generated")
+ERRMSG(RequestExtensionNotAvailable, "GL_ANGLE_request_extension is not available.")
+ERRMSG(RequestableExtensionStringIndexOutOfRange,
+       "index must be less than the number of requestable extension strings.")
+ERRMSG(RequiresES3, "Requires a GLES 3.0 or higher context.")
+ERRMSG(ReservedGLPrefix, "Name cannot start with the reserved \"gl_\" prefix.")
+ERRMSG(RobustClientMemoryNotAvailable, "GL_ANGLE_robust_client_memory is not available.")
+ERRMSG(SameBufferCopyOverflow, "Integer overflow when validating same buffer copy.")
+ERRMSG(SampleIndexOutOfRange, "Index must be less than the value of SAMPLES.")
+ERRMSG(SamplerUniformValueOutOfRange, "sampler uniform value out of range")
+ERRMSG(SamplesOutOfRange,
+       "Samples must not be greater than maximum supported value for the format.")
+ERRMSG(ShaderDoesNotExist, "Shader name is invalid")
+ERRMSG(ShaderInsteadOfProgram, "Attempted to use a single shader instead of a shader program.")
+ERRMSG(ShaderStorageBufferBindingOutOfRange,
+       "index is outside the valid range for GL_SHADER_STORAGE_BUFFER_BINDING")
+ERRMSG(ShaderStorageBufferRequiresES31, "SHADER_STORAGE_BUFFER is not supported in GLES3.")
+ERRMSG(ShaderStorageBuffersNotSupported,
+       "Shader storage buffers are not supported in this version of GL")
+ERRMSG(SizeExceedsMaxTextureSize,
+       "Width and height must be less than or equal to GL_MAX_TEXTURE_SIZE.")
+ERRMSG(SizedFormatNotRenderable,
+       "SizedInternalformat must be color-renderable, depth-renderable, or stencil-renderable.")
+ERRMSG(SourceLevelUndefined, "The source level of the source texture must be defined.")
+ERRMSG(SourceTextureLevelZeroUndefined, "Source texture must level 0 defined.")
+ERRMSG(SourceTextureNot2D, "Source texture must be of type GL_TEXTURE_2D.")
+ERRMSG(SourceTextureNotCompressed, "Source texture must have a compressed internal format.")
+ERRMSG(SourceTextureTooSmall, "Source texture not large enough to copy from.")
+ERRMSG(StrideExceedsMaxVertexAttribStride,
+       "stride cannot be greater than MAX_VERTEX_ATTRIB_STRIDE.")
+ERRMSG(StrideExceedsWebGLLimit, "Stride is over the maximum stride allowed by WebGL.")
+ERRMSG(StrideOutOfRange, "stride must be between 0 and MAX_VERTEX_ATTRIB_STRIDE.")
+ERRMSG(TargetNotSupported, "the target is not supported.")
+ERRMSG(TextargetMismatch, "Textarget must match the texture target type.")
+ERRMSG(TextureAnisotropicNotEnabled, "GL_EXT_texture_anisotropic is not enabled.")
+ERRMSG(TextureFilterAnisotropicNotEnabled, "GL_EXT_texture_filter_anisotropic is not enabled.")
+ERRMSG(TextureImmutable,
+       "The value of TEXTURE_IMMUTABLE_FORMAT for the texture currently bound to target on the "
+       "active texture unit is true.")
+ERRMSG(TextureLevelUndefined, "Texture level does not exist.")
+ERRMSG(TextureNotGenerated, "Texture was not generated")
+ERRMSG(TextureSRGBDecodeNotEnabled, "GL_EXT_texture_sRGB_decode is not enabled.")
+ERRMSG(TextureStorageNotEnabled, "GL_EXT_texture_storage is not enabled.")
+ERRMSG(TextureTargetRequiresES31, "Texture target requires at least OpenGL ES 3.1.")
+ERRMSG(TextureUsageNotEnabled, "GL_ANGLE_texture_usage is not enabled.")
+ERRMSG(TimerQueryNotEnabled, "Timer query extension not enabled")
+ERRMSG(TimestampQueryCurrent, "Cannot use current query for timestamp")
+ERRMSG(TransformFeedbackAlreadyActive, "Transform feedback is already active.")
+ERRMSG(TransformFeedbackBufferActive,
+       "target is TRANSFORM_FEEDBACK_BUFFER and transform feedback is currently active.")
+ERRMSG(TransformFeedbackNotPaused, "transform feedback is active and not paused.")
+ERRMSG(TranslatedShaderSourceNotEnabled, "GL_ANGLE_translated_shader_source is not enabled.")
+ERRMSG(TypeNotInteger, "Type is not integer.")
+ERRMSG(UnexpectedNumberOfComponents, "Unexpected number of components")
+ERRMSG(UniformBufferTooSmall,
+       "It is undefined behaviour to use a uniform buffer that is too small.")
+ERRMSG(UniformBufferUnbound, "It is undefined behaviour to have a used but unbound uniform buffer.")
+ERRMSG(UniformLocationProgramNotLinked, "program is not linked.")
+ERRMSG(UniformTypeMismatch, "wrong type of value for uniform")
+ERRMSG(UnknownParamValue, "Unknown param value.")
+ERRMSG(UnknownParameterName, "Unknown parameter name.")
+ERRMSG(UnknownPname, "Unknown pname.")
+ERRMSG(UnknownShaderType, "Unknown shader type.")
+ERRMSG(UnsizedInternalFormatUnsupported,
+       "Internalformat is one of the unsupported unsized base internalformats.")
+ERRMSG(UnsupportedCompressedFormat, "internalformat is not a supported compressed internal format.")
+ERRMSG(UnsupportedES2CompressedFormat,
+       "internalformat is not a supported compressed internal format")
+ERRMSG(UnsupportedInternalFormat, "Unsupported internal format.")
+ERRMSG(UseProgramDuringTransformFeedback,
+       "Cannot change active program while transform feedback is unpaused.")
+ERRMSG(VertexArrayNoBuffer, "An enabled vertex array has no buffer.")
+ERRMSG(VertexArrayNoBufferPointer, "An enabled vertex array has no buffer and no pointer.")
+ERRMSG(VertexAttribBindingsNotSupported,
+       "Vertex Attrib Bindings are not supported in this version of GL")
+ERRMSG(VertexAttribBindingsRequireES31, "Vertex Attrib Bindings require OpenGL ES 3.1.")
+ERRMSG(VertexAttribDivisorQueryNotSupported,
+       "GL_VERTEX_ATTRIB_ARRAY_DIVISOR requires OpenGL ES 3.0 or GL_ANGLE_instanced_arrays.")
+ERRMSG(VertexAttribIPointerRequiresES3, "VertexAttribIPointer requires OpenGL ES 3.0 or higher.")
+ERRMSG(VertexAttribIndexExceedsMaxBindings,
+       "index must be smaller than MAX_VERTEX_ATTRIB_BINDINGS.")
+ERRMSG(VertexAttribIndexOutOfRange, "Vertex attrib index out of range.")
+ERRMSG(VertexAttribIntegerQueryRequiresES3,
+       "GL_VERTEX_ATTRIB_ARRAY_INTEGER requires OpenGL ES 3.0.")
+ERRMSG(VertexBufferNotGenerated, "Buffer is not generated.")
+ERRMSG(VertexBufferTooSmall, "Vertex buffer is not big enough for the draw call")
+ERRMSG(VertexInputTypeMismatch,
+       "Vertex shader input type does not match the type of the bound vertex attribute.")
+ERRMSG(VertexTypeRequiresES3, "Vertex type not supported before OpenGL ES 3.0.")
+ERRMSG(ZeroSamples, "Samples may not be zero.")
+
+}  // namespace gl
+
+#undef ERRMSG
+
+#endif  // LIBANGLE_ERRORSTRINGS_H_
@@ -170,6 +170,76 @@ bool CheckAttachmentSampleCompleteness(const Context *context,
     return true;
 }
 
+Error InitAttachment(const Context *context, const FramebufferAttachment *attachment)
+{
+    ASSERT(attachment->isAttached());
+    if (attachment->initState() == InitState::MayNeedInit)
+    {
+        ANGLE_TRY(attachment->initializeContents(context));
+    }
+    return NoError();
+}
+
+// Init state is tracked per level, so an attachment to one layer of a 2D array or 3D texture only
+// covers its level if the level has a single layer.
+bool CoversWholeLevel(const FramebufferAttachment &attachment)
+{
+    return attachment.type() != GL_TEXTURE || attachment.getSize().depth <= 1;
+}
+
+// A clear that overwrites every texel of an attachment's level makes its initialization redundant,
+// so the attachment is only marked as initialized. Partial clears need the rest of the level zeroed.
+Error InitAttachmentForClear(const Context *context,
+                             const FramebufferAttachment *attachment,
+                             bool fullClear)
+{
+    ASSERT(attachment->isAttached());
+    if (attachment->initState() == InitState::Initialized)
+    {
+        return NoError();
+    }
+
+    if (fullClear && CoversWholeLevel(*attachment))
+    {
+        attachment->setInitState(InitState::Initialized);
+        return NoError();
+    }
+
+    return attachment->initializeContents(context);
+}
+
+bool IsClearScissored(const State &glState, const FramebufferAttachment &attachment)
+{
+    if (!glState.isScissorTestEnabled())
+    {
+        return false;
+    }
+
+    const Rectangle &scissor = glState.getScissor();
+    const Extents &size      = attachment.getSize();
+    return scissor.x > 0 || scissor.y > 0 || scissor.x + scissor.width < size.width ||
+           scissor.y + scissor.height < size.height;
+}
+
+bool IsFullColorClear(const State &glState, const FramebufferAttachment &attachment)
+{
+    const BlendState &blendState = glState.getBlendState();
+    return blendState.colorMaskRed && blendState.colorMaskGreen && blendState.colorMaskBlue &&
+           blendState.colorMaskAlpha && !IsClearScissored(glState, attachment);
+}
+
+bool IsFullDepthClear(const State &glState, const FramebufferAttachment &attachment)
+{
+    return glState.getDepthStencilState().depthMask && !IsClearScissored(glState, attachment);
+}
+
+bool IsFullStencilClear(const State &glState, const FramebufferAttachment &attachment)
+{
+    GLuint stencilBits = (1u << attachment.getStencilSize()) - 1u;
+    GLuint writeMask   = glState.getDepthStencilState().stencilWritemask;
+    return (writeMask & stencilBits) == stencilBits && !IsClearScissored(glState, attachment);
+}
+
 }  // anonymous namespace
 
 // This constructor is only used for default framebuffers.
@@ -941,6 +1011,8 @@ Error Framebuffer::clear(const gl::Context *context, GLbitfield mask)
         return gl::NoError();
     }
 
+    ANGLE_TRY(ensureClearAttachmentsInitialized(context, mask));
+
     return mImpl->clear(context, mask);
 }
 
@@ -954,6 +1026,8 @@ Error Framebuffer::clearBufferfv(const gl::Context *context,
         return gl::NoError();
     }
 
+    ANGLE_TRY(ensureClearBufferAttachmentsInitialized(context, buffer, drawbuffer));
+
     return mImpl->clearBufferfv(context, buffer, drawbuffer, values);
 }
 
@@ -967,6 +1041,8 @@ Error Framebuffer::clearBufferuiv(const gl::Context *context,
         return gl::NoError();
     }
 
+    ANGLE_TRY(ensureClearBufferAttachmentsInitialized(context, buffer, drawbuffer));
+
     return mImpl->clearBufferuiv(context, buffer, drawbuffer, values);
 }
 
@@ -980,6 +1056,8 @@ Error Framebuffer::clearBufferiv(const gl::Context *context,
         return gl::NoError();
     }
 
+    ANGLE_TRY(ensureClearBufferAttachmentsInitialized(context, buffer, drawbuffer));
+
     return mImpl->clearBufferiv(context, buffer, drawbuffer, values);
 }
 
@@ -994,6 +1072,8 @@ Error Framebuffer::clearBufferfi(const gl::Context *context,
         return gl::NoError();
     }
 
+    ANGLE_TRY(ensureClearBufferAttachmentsInitialized(context, buffer, drawbuffer));
+
     return mImpl->clearBufferfi(context, buffer, drawbuffer, depth, stencil);
 }
 
@@ -1013,6 +1093,7 @@ Error Framebuffer::readPixels(const gl::Context *context,
                               GLenum type,
                               void *pixels) const
 {
+    ANGLE_TRY(ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
     ANGLE_TRY(mImpl->readPixels(context, area, format, type, pixels));
 
     Buffer *unpackBuffer = context->getGLState().getUnpackState().pixelBuffer.get();
@@ -1054,9 +1135,168 @@ Error Framebuffer::blit(const gl::Context *context,
         return NoError();
     }
 
+    const Framebuffer *sourceFramebuffer = context->getGLState().getReadFramebuffer();
+    ANGLE_TRY(sourceFramebuffer->ensureReadAttachmentInitialized(context, blitMask));
+
+    // The blit may only cover part of the destination.
+    ANGLE_TRY(ensureDrawAttachmentsInitialized(context));
+
     return mImpl->blit(context, sourceArea, destArea, blitMask, filter);
 }
 
+Error Framebuffer::ensureDrawAttachmentsInitialized(const Context *context)
+{
+    if (!context->getGLState().isRobustResourceInitEnabled())
+    {
+        return NoError();
+    }
+
+    for (size_t drawBuffer = 0; drawBuffer < mState.mDrawBufferStates.size(); ++drawBuffer)
+    {
+        const FramebufferAttachment *color = mState.getDrawBuffer(drawBuffer);
+        if (color)
+        {
+            ANGLE_TRY(InitAttachment(context, color));
+        }
+    }
+
+    if (mState.mDepthAttachment.isAttached())
+    {
+        ANGLE_TRY(InitAttachment(context, &mState.mDepthAttachment));
+    }
+
+    if (mState.mStencilAttachment.isAttached())
+    {
+        ANGLE_TRY(InitAttachment(context, &mState.mStencilAttachment));
+    }
+
+    return NoError();
+}
+
+Error Framebuffer::ensureReadAttachmentInitialized(const Context *context,
+                                                   GLbitfield blitMask) const
+{
+    if (!context->getGLState().isRobustResourceInitEnabled())
+    {
+        return NoError();
+    }
+
+    if ((blitMask & GL_COLOR_BUFFER_BIT) != 0)
+    {
+        const FramebufferAttachment *readAttachment = mState.getReadAttachment();
+        if (readAttachment)
+        {
+            ANGLE_TRY(InitAttachment(context, readAttachment));
+        }
+    }
+
+    if ((blitMask & GL_DEPTH_BUFFER_BIT) != 0 && mState.mDepthAttachment.isAttached())
+    {
+        ANGLE_TRY(InitAttachment(context, &mState.mDepthAttachment));
+    }
+
+    if ((blitMask & GL_STENCIL_BUFFER_BIT) != 0 && mState.mStencilAttachment.isAttached())
+    {
+        ANGLE_TRY(InitAttachment(context, &mState.mStencilAttachment));
+    }
+
+    return NoError();
+}
+
+Error Framebuffer::ensureClearAttachmentsInitialized(const Context *context, GLbitfield mask)
+{
+    const State &glState = context->getGLState();
+    if (!glState.isRobustResourceInitEnabled())
+    {
+        return NoError();
+    }
+
+    if ((mask & GL_COLOR_BUFFER_BIT) != 0)
+    {
+        for (size_t drawBuffer = 0; drawBuffer < mState.mDrawBufferStates.size(); ++drawBuffer)
+        {
+            const FramebufferAttachment *color = mState.getDrawBuffer(drawBuffer);
+            if (color)
+            {
+                ANGLE_TRY(
+                    InitAttachmentForClear(context, color, IsFullColorClear(glState, *color)));
+            }
+        }
+    }
+
+    return ensureDepthStencilClearInitialized(context, (mask & GL_DEPTH_BUFFER_BIT) != 0,
+                                              (mask & GL_STENCIL_BUFFER_BIT) != 0);
+}
+
+Error Framebuffer::ensureClearBufferAttachmentsInitialized(const Context *context,
+                                                           GLenum buffer,
+                                                           GLint drawbuffer)
+{
+    const State &glState = context->getGLState();
+    if (!glState.isRobustResourceInitEnabled())
+    {
+        return NoError();
+    }
+
+    switch (buffer)
+    {
+        case GL_COLOR:
+        {
+            const FramebufferAttachment *color =
+                mState.getDrawBuffer(static_cast<size_t>(drawbuffer));
+            if (color)
+            {
+                return InitAttachmentForClear(context, color, IsFullColorClear(glState, *color));
+            }
+            return NoError();
+        }
+        case GL_DEPTH:
+            return ensureDepthStencilClearInitialized(context, true, false);
+        case GL_STENCIL:
+            return ensureDepthStencilClearInitialized(context, false, true);
+        case GL_DEPTH_STENCIL:
+            return ensureDepthStencilClearInitialized(context, true, true);
+        default:
+            UNREACHABLE();
+            return NoError();
+    }
+}
+
+Error Framebuffer::ensureDepthStencilClearInitialized(const Context *context,
+                                                      bool depth,
+                                                      bool stencil)
+{
+    const State &glState                       = context->getGLState();
+    const FramebufferAttachment &depthAttach   = mState.mDepthAttachment;
+    const FramebufferAttachment &stencilAttach = mState.mStencilAttachment;
+
+    bool fullDepth   = depth && depthAttach.isAttached() && IsFullDepthClear(glState, depthAttach);
+    bool fullStencil =
+        stencil && stencilAttach.isAttached() && IsFullStencilClear(glState, stencilAttach);
+
+    // A packed depth/stencil image is only fully overwritten when both aspects are cleared.
+    if (depthAttach.isAttached() && depthAttach == stencilAttach)
+    {
+        if (depth || stencil)
+        {
+            ANGLE_TRY(InitAttachmentForClear(context, &depthAttach, fullDepth && fullStencil));
+        }
+        return NoError();
+    }
+
+    if (depth && depthAttach.isAttached())
+    {
+        ANGLE_TRY(InitAttachmentForClear(context, &depthAttach, fullDepth));
+    }
+
+    if (stencil && stencilAttach.isAttached())
+    {
+        ANGLE_TRY(InitAttachmentForClear(context, &stencilAttach, fullStencil));
+    }
+
+    return NoError();
+}
+
 int Framebuffer::getSamples(const Context *context)
 {
     if (complete(context))
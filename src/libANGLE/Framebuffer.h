@@ -243,6 +243,11 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
                GLbitfield mask,
                GLenum filter);
 
+    // Robust resource initialization: zero any attachment that may be read or partially drawn to
+    // before its contents were defined.
+    Error ensureDrawAttachmentsInitialized(const Context *context);
+    Error ensureReadAttachmentInitialized(const Context *context, GLbitfield blitMask) const;
+
     enum DirtyBitType : uint32_t
     {
         DIRTY_BIT_COLOR_ATTACHMENT_0,
@@ -282,6 +287,12 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
     GLenum checkStatusImpl(const Context *context);
     void commitWebGL1DepthStencilIfConsistent();
 
+    Error ensureClearAttachmentsInitialized(const Context *context, GLbitfield mask);
+    Error ensureClearBufferAttachmentsInitialized(const Context *context,
+                                                  GLenum buffer,
+                                                  GLint drawbuffer);
+    Error ensureDepthStencilClearInitialized(const Context *context, bool depth, bool stencil);
+
     void setAttachmentImpl(GLenum type,
                            GLenum binding,
                            const ImageIndex &textureIndex,
@@ -11,6 +11,7 @@
 
 #include "common/utilities.h"
 #include "libANGLE/Config.h"
+#include "libANGLE/Context.h"
 #include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/Texture.h"
@@ -21,6 +22,14 @@
 namespace gl
 {
 
+InitState DetermineInitState(const Context *context)
+{
+    // Note: the Context is checked for nullptr because of some testing code.
+    return (context && context->getGLState().isRobustResourceInitEnabled())
+               ? InitState::MayNeedInit
+               : InitState::Initialized;
+}
+
 ////// FramebufferAttachment::Target Implementation //////
 
 FramebufferAttachment::Target::Target()
@@ -243,6 +252,21 @@ Error FramebufferAttachmentObject::getAttachmentRenderTarget(
     return getAttachmentImpl()->getAttachmentRenderTarget(binding, imageIndex, rtOut);
 }
 
+Error FramebufferAttachmentObject::initializeContents(const Context *context,
+                                                      const ImageIndex &imageIndex)
+{
+    ASSERT(context->getGLState().isRobustResourceInitEnabled());
+
+    // Init state is tracked per level, so a layer attachment initializes its entire level.
+    ImageIndex fullLevelIndex = imageIndex;
+    fullLevelIndex.layerIndex = ImageIndex::ENTIRE_LEVEL;
+
+    ANGLE_TRY(getAttachmentImpl()->initializeContents(context, fullLevelIndex));
+    setInitState(imageIndex, InitState::Initialized);
+
+    return NoError();
+}
+
 angle::BroadcastChannel<> *FramebufferAttachmentObject::getDirtyChannel()
 {
     return &mDirtyChannel;
@@ -38,11 +38,24 @@ class FramebufferAttachmentObjectImpl;
 
 namespace gl
 {
+class Context;
 class FramebufferAttachmentObject;
 struct Format;
 class Renderbuffer;
 class Texture;
 
+// Tracks whether a subresource has defined contents. With robust resource initialization enabled,
+// newly allocated images start out as MayNeedInit and are only cleared once they are first read,
+// sampled or partially written. Images that are fully overwritten skip the clear entirely.
+enum class InitState
+{
+    MayNeedInit,
+    Initialized,
+};
+
+// The state of newly allocated storage that has no contents specified for it.
+InitState DetermineInitState(const Context *context);
+
 // FramebufferAttachment implements a GL framebuffer attachment.
 // Attachments are "light" containers, which store pointers to ref-counted GL objects.
 // We support GL texture (2D/3D/Cube/2D array) and renderbuffer object attachments.
@@ -101,6 +114,10 @@ class FramebufferAttachment final
     GLenum type() const { return mType; }
     bool isAttached() const { return mType != GL_NONE; }
 
+    InitState initState() const;
+    void setInitState(InitState initState) const;
+    Error initializeContents(const Context *context) const;
+
     Renderbuffer *getRenderbuffer() const;
     Texture *getTexture() const;
     const egl::Surface *getSurface() const;
@@ -165,6 +182,12 @@ class FramebufferAttachmentObject
     virtual void onDetach() = 0;
     virtual GLuint getId() const = 0;
 
+    virtual InitState initState(const ImageIndex &imageIndex) const = 0;
+    virtual void setInitState(const ImageIndex &imageIndex, InitState initState) = 0;
+
+    // Clears the image to zero and marks it as initialized.
+    Error initializeContents(const Context *context, const ImageIndex &imageIndex);
+
     Error getAttachmentRenderTarget(GLenum binding,
                                     const ImageIndex &imageIndex,
                                     rx::FramebufferAttachmentRenderTarget **rtOut) const;
@@ -195,6 +218,24 @@ inline GLsizei FramebufferAttachment::getSamples() const
     return mResource->getAttachmentSamples(mTarget.textureIndex());
 }
 
+inline InitState FramebufferAttachment::initState() const
+{
+    ASSERT(mResource);
+    return mResource->initState(mTarget.textureIndex());
+}
+
+inline void FramebufferAttachment::setInitState(InitState initState) const
+{
+    ASSERT(mResource);
+    mResource->setInitState(mTarget.textureIndex(), initState);
+}
+
+inline Error FramebufferAttachment::initializeContents(const Context *context) const
+{
+    ASSERT(mResource);
+    return mResource->initializeContents(context, mTarget.textureIndex());
+}
+
 inline gl::Error FramebufferAttachment::getRenderTargetImpl(
     rx::FramebufferAttachmentRenderTarget **rtOut) const
 {
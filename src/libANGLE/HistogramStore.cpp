@@ -0,0 +1,429 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HistogramStore.cpp:
+//   Implements the in-process histogram store.
+//
+
+#include "libANGLE/HistogramStore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/system_utils.h"
+#include "platform/Platform.h"
+
+namespace angle
+{
+
+namespace
+{
+
+// The range of the throughput histograms, in KB per second.
+constexpr int kThroughputMin         = 1;
+constexpr int kThroughputMax         = 10000000;
+constexpr int kThroughputBucketCount = 50;
+
+bool IsStoreRequested()
+{
+    Optional<std::string> value = GetEnvironmentVar("ANGLE_HISTOGRAM_STORE");
+    return value.valid() && !value.value().empty() && value.value() != "0";
+}
+
+}  // anonymous namespace
+
+// Samples are counted with relaxed atomics, so a snapshot taken while samples are recorded may mix
+// older and newer counts.
+struct Histogram : angle::NonCopyable
+{
+    // The lower bounds of the buckets, in increasing order. Empty for sparse histograms.
+    explicit Histogram(std::vector<int> &&bucketRanges)
+        : ranges(std::move(bucketRanges)),
+          bucketCounts(new std::atomic<uint64_t>[ranges.size()]),
+          count(0),
+          sum(0),
+          min(std::numeric_limits<int>::max()),
+          max(std::numeric_limits<int>::min())
+    {
+        reset();
+    }
+
+    void addSample(size_t bucketIndex, int sample)
+    {
+        bucketCounts[bucketIndex].fetch_add(1, std::memory_order_relaxed);
+        addStatistics(sample);
+    }
+
+    void addSparseSample(int sample)
+    {
+        {
+            std::lock_guard<std::mutex> lock(sparseMutex);
+            sparseBuckets[sample]++;
+        }
+        addStatistics(sample);
+    }
+
+    void addStatistics(int sample)
+    {
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(sample, std::memory_order_relaxed);
+
+        int currentMin = min.load(std::memory_order_relaxed);
+        while (sample < currentMin &&
+               !min.compare_exchange_weak(currentMin, sample, std::memory_order_relaxed))
+        {
+        }
+        int currentMax = max.load(std::memory_order_relaxed);
+        while (sample > currentMax &&
+               !max.compare_exchange_weak(currentMax, sample, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void getSnapshot(HistogramSnapshot *snapshotOut)
+    {
+        *snapshotOut       = HistogramSnapshot();
+        snapshotOut->count = count.load(std::memory_order_relaxed);
+        snapshotOut->sum   = sum.load(std::memory_order_relaxed);
+        snapshotOut->min   = min.load(std::memory_order_relaxed);
+        snapshotOut->max   = max.load(std::memory_order_relaxed);
+
+        for (size_t bucketIndex = 0; bucketIndex < ranges.size(); ++bucketIndex)
+        {
+            uint64_t bucketCount = bucketCounts[bucketIndex].load(std::memory_order_relaxed);
+            if (bucketCount != 0)
+            {
+                snapshotOut->buckets[ranges[bucketIndex]] = bucketCount;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(sparseMutex);
+        snapshotOut->buckets.insert(sparseBuckets.begin(), sparseBuckets.end());
+    }
+
+    void reset()
+    {
+        for (size_t bucketIndex = 0; bucketIndex < ranges.size(); ++bucketIndex)
+        {
+            bucketCounts[bucketIndex].store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        min.store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+        max.store(std::numeric_limits<int>::min(), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(sparseMutex);
+        sparseBuckets.clear();
+    }
+
+    const std::vector<int> ranges;
+    std::unique_ptr<std::atomic<uint64_t>[]> bucketCounts;
+
+    std::atomic<uint64_t> count;
+    std::atomic<int64_t> sum;
+    std::atomic<int> min;
+    std::atomic<int> max;
+
+    std::mutex sparseMutex;
+    std::map<int, uint64_t> sparseBuckets;
+};
+
+namespace
+{
+
+struct Store : angle::NonCopyable
+{
+    Store() : enabled(IsStoreRequested()) {}
+
+    std::atomic<bool> enabled;
+
+    // Guards the map, which is only used for the first sample of each call site. The histograms
+    // are never destroyed, since the call sites keep pointers to them.
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+};
+
+Store *GetStore()
+{
+    // Never destroyed, so samples can still be recorded at exit.
+    static Store *store = new Store();
+    return store;
+}
+
+// The bucket layout of Chromium's custom counts histograms: an underflow bucket, buckets which
+// grow exponentially from |min| to |max|, and an overflow bucket.
+std::vector<int> ComputeExponentialRanges(int min, int max, int bucketCount)
+{
+    min         = std::max(min, 1);
+    max         = std::max(max, min + 1);
+    bucketCount = std::max(bucketCount, 3);
+
+    std::vector<int> ranges(bucketCount, 0);
+    ranges[1] = min;
+
+    double logMax = std::log(static_cast<double>(max));
+    int current   = min;
+    for (int bucketIndex = 2; bucketIndex < bucketCount - 1; ++bucketIndex)
+    {
+        double logCurrent = std::log(static_cast<double>(current));
+        double logRatio   = (logMax - logCurrent) / (bucketCount - bucketIndex);
+        int next          = static_cast<int>(std::round(std::exp(logCurrent + logRatio)));
+
+        current             = next > current ? next : current + 1;
+        ranges[bucketIndex] = current;
+    }
+    ranges[bucketCount - 1] = max;
+    return ranges;
+}
+
+// A bucket for each value below |boundaryValue|, and one for the values out of range.
+std::vector<int> ComputeLinearRanges(int boundaryValue)
+{
+    std::vector<int> ranges(std::max(boundaryValue, 0) + 1);
+    for (size_t bucketIndex = 0; bucketIndex < ranges.size(); ++bucketIndex)
+    {
+        ranges[bucketIndex] = static_cast<int>(bucketIndex);
+    }
+    return ranges;
+}
+
+// Returns the histogram the call site records into, or null if the store is off. The ranges only
+// matter for the first sample of a histogram.
+template <typename ComputeRangesFunc>
+Histogram *GetHistogram(HistogramHandle *handle, ComputeRangesFunc computeRanges)
+{
+    Store *store = GetStore();
+    if (!store->enabled.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    Histogram *histogram = handle->getHistogram();
+    if (histogram == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        std::unique_ptr<Histogram> &storedHistogram = store->histograms[handle->getName()];
+        if (!storedHistogram)
+        {
+            storedHistogram.reset(new Histogram(computeRanges()));
+        }
+        histogram = storedHistogram.get();
+        handle->setHistogram(histogram);
+    }
+    return histogram;
+}
+
+void StoreCustomCounts(HistogramHandle *handle, int sample, int min, int max, int bucketCount)
+{
+    Histogram *histogram = GetHistogram(handle, [min, max, bucketCount]() {
+        return ComputeExponentialRanges(min, max, bucketCount);
+    });
+    if (histogram == nullptr)
+    {
+        return;
+    }
+
+    // The first range is 0, so every non-negative sample has a bucket.
+    auto bucketIter = std::upper_bound(histogram->ranges.begin(), histogram->ranges.end(),
+                                       std::max(sample, 0));
+    histogram->addSample(bucketIter - histogram->ranges.begin() - 1, sample);
+}
+
+void StoreLinear(HistogramHandle *handle, int sample, int boundaryValue)
+{
+    Histogram *histogram =
+        GetHistogram(handle, [boundaryValue]() { return ComputeLinearRanges(boundaryValue); });
+    if (histogram == nullptr)
+    {
+        return;
+    }
+
+    int overflowBucket = static_cast<int>(histogram->ranges.size()) - 1;
+    int bucket         = (sample >= 0 && sample < overflowBucket) ? sample : overflowBucket;
+    histogram->addSample(bucket, sample);
+}
+
+void StoreSparse(HistogramHandle *handle, int sample)
+{
+    Histogram *histogram = GetHistogram(handle, []() { return std::vector<int>(); });
+    if (histogram == nullptr)
+    {
+        return;
+    }
+
+    histogram->addSparseSample(sample);
+}
+
+}  // anonymous namespace
+
+HistogramSnapshot::HistogramSnapshot() : count(0), sum(0), min(0), max(0)
+{
+}
+
+int HistogramSnapshot::percentile(double fraction) const
+{
+    uint64_t rank       = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count)));
+    uint64_t cumulative = 0;
+    for (const auto &bucket : buckets)
+    {
+        cumulative += bucket.second;
+        if (cumulative >= std::max<uint64_t>(rank, 1))
+        {
+            return bucket.first;
+        }
+    }
+    return 0;
+}
+
+double HistogramCurrentTime()
+{
+    PlatformMethods *platform = ANGLEPlatformCurrent();
+    if (platform->currentTime != DefaultCurrentTime)
+    {
+        return platform->currentTime(platform);
+    }
+
+    std::chrono::duration<double> now = std::chrono::steady_clock::now().time_since_epoch();
+    return now.count();
+}
+
+void RecordHistogramCustomCounts(HistogramHandle *handle,
+                                 int sample,
+                                 int min,
+                                 int max,
+                                 int bucketCount)
+{
+    PlatformMethods *platform = ANGLEPlatformCurrent();
+    if (platform->histogramCustomCounts != DefaultHistogramCustomCounts)
+    {
+        platform->histogramCustomCounts(platform, handle->getName(), sample, min, max,
+                                        bucketCount);
+        return;
+    }
+    StoreCustomCounts(handle, sample, min, max, bucketCount);
+}
+
+void RecordHistogramEnumeration(HistogramHandle *handle, int sample, int boundaryValue)
+{
+    PlatformMethods *platform = ANGLEPlatformCurrent();
+    if (platform->histogramEnumeration != DefaultHistogramEnumeration)
+    {
+        platform->histogramEnumeration(platform, handle->getName(), sample, boundaryValue);
+        return;
+    }
+    StoreLinear(handle, sample, boundaryValue);
+}
+
+void RecordHistogramSparse(HistogramHandle *handle, int sample)
+{
+    PlatformMethods *platform = ANGLEPlatformCurrent();
+    if (platform->histogramSparse != DefaultHistogramSparse)
+    {
+        platform->histogramSparse(platform, handle->getName(), sample);
+        return;
+    }
+    StoreSparse(handle, sample);
+}
+
+void RecordHistogramBoolean(HistogramHandle *handle, bool sample)
+{
+    PlatformMethods *platform = ANGLEPlatformCurrent();
+    if (platform->histogramBoolean != DefaultHistogramBoolean)
+    {
+        platform->histogramBoolean(platform, handle->getName(), sample);
+        return;
+    }
+    StoreLinear(handle, sample ? 1 : 0, 2);
+}
+
+void RecordHistogramThroughput(HistogramHandle *handle, uint64_t bytes, double seconds)
+{
+    // Transfers faster than the clock's resolution can't be measured.
+    if (seconds <= 0.0)
+    {
+        return;
+    }
+
+    double kilobytesPerSecond = static_cast<double>(bytes) / 1024.0 / seconds;
+    kilobytesPerSecond        = std::min(kilobytesPerSecond, static_cast<double>(kThroughputMax));
+
+    int sample = static_cast<int>(kilobytesPerSecond);
+    RecordHistogramCustomCounts(handle, sample, kThroughputMin, kThroughputMax,
+                                kThroughputBucketCount);
+}
+
+void SetHistogramStoreEnabled(bool enabled)
+{
+    GetStore()->enabled.store(enabled);
+}
+
+bool GetHistogramSnapshot(const std::string &name, HistogramSnapshot *snapshotOut)
+{
+    Store *store = GetStore();
+    std::lock_guard<std::mutex> lock(store->mutex);
+
+    auto histogramIter = store->histograms.find(name);
+    if (histogramIter == store->histograms.end())
+    {
+        return false;
+    }
+    histogramIter->second->getSnapshot(snapshotOut);
+    return snapshotOut->count != 0;
+}
+
+std::string GetHistogramsJSON()
+{
+    Store *store = GetStore();
+    std::lock_guard<std::mutex> lock(store->mutex);
+
+    std::ostringstream stream;
+    stream << "{\"histograms\":[";
+    bool firstHistogram = true;
+    HistogramSnapshot snapshot;
+    for (const auto &histogram : store->histograms)
+    {
+        histogram.second->getSnapshot(&snapshot);
+        if (snapshot.count == 0)
+        {
+            continue;
+        }
+
+        stream << (firstHistogram ? "\n" : ",\n");
+        stream << "{\"name\":\"" << histogram.first << "\",\"count\":" << snapshot.count
+               << ",\"sum\":" << snapshot.sum << ",\"min\":" << snapshot.min
+               << ",\"max\":" << snapshot.max << ",\"p50\":" << snapshot.percentile(0.5)
+               << ",\"p99\":" << snapshot.percentile(0.99) << ",\"buckets\":[";
+        bool firstBucket = true;
+        for (const auto &bucket : snapshot.buckets)
+        {
+            stream << (firstBucket ? "" : ",") << "[" << bucket.first << "," << bucket.second
+                   << "]";
+            firstBucket = false;
+        }
+        stream << "]}";
+        firstHistogram = false;
+    }
+    stream << "\n]}\n";
+    return stream.str();
+}
+
+void ResetHistograms()
+{
+    Store *store = GetStore();
+    std::lock_guard<std::mutex> lock(store->mutex);
+    for (auto &histogram : store->histograms)
+    {
+        histogram.second->reset();
+    }
+}
+
+}  // namespace angle
@@ -0,0 +1,99 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HistogramStore.h:
+//   Records the samples of the ANGLE_HISTOGRAM macros. They go to the platform methods when the
+//   embedder implements them, and otherwise to an in-process store, which can be queried and
+//   dumped as JSON. The store is off unless the ANGLE_HISTOGRAM_STORE environment variable is set
+//   or SetHistogramStoreEnabled turns it on.
+//
+
+#ifndef LIBANGLE_HISTOGRAMSTORE_H_
+#define LIBANGLE_HISTOGRAMSTORE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+// The samples of a histogram of the in-process store.
+struct HistogramSnapshot
+{
+    HistogramSnapshot();
+
+    // Estimates the sample below which |fraction| of the samples are, as the lower bound of the
+    // bucket that holds it. Returns 0 if the histogram is empty.
+    int percentile(double fraction) const;
+
+    uint64_t count;
+    int64_t sum;
+    int min;
+    int max;
+
+    // The number of samples in each non-empty bucket, by the bucket's lower bound.
+    std::map<int, uint64_t> buckets;
+};
+
+struct Histogram;
+
+// The ANGLE_HISTOGRAM macros keep one of these in a static at each call site, so the store only
+// looks histograms up by name for the first sample of a call site. Samples are counted without
+// taking a lock, except for sparse histograms.
+class HistogramHandle final : angle::NonCopyable
+{
+  public:
+    constexpr explicit HistogramHandle(const char *name) : mName(name), mHistogram(nullptr) {}
+
+    const char *getName() const { return mName; }
+
+    // The histogram of the store the call site records into, once it recorded a sample.
+    Histogram *getHistogram() const { return mHistogram.load(std::memory_order_acquire); }
+    void setHistogram(Histogram *histogram)
+    {
+        mHistogram.store(histogram, std::memory_order_release);
+    }
+
+  private:
+    const char *mName;
+    std::atomic<Histogram *> mHistogram;
+};
+
+// The time in seconds the scoped histogram timers measure. Uses the platform's clock if the
+// embedder provides one, and a monotonic clock otherwise.
+double HistogramCurrentTime();
+
+void RecordHistogramCustomCounts(HistogramHandle *handle,
+                                 int sample,
+                                 int min,
+                                 int max,
+                                 int bucketCount);
+void RecordHistogramEnumeration(HistogramHandle *handle, int sample, int boundaryValue);
+void RecordHistogramSparse(HistogramHandle *handle, int sample);
+void RecordHistogramBoolean(HistogramHandle *handle, bool sample);
+
+// Records |bytes| transferred in |seconds| as a KB per second sample.
+void RecordHistogramThroughput(HistogramHandle *handle, uint64_t bytes, double seconds);
+
+// Turns the in-process store on or off. Samples recorded while it is off are dropped.
+void SetHistogramStoreEnabled(bool enabled);
+
+// Queries the in-process store. Returns false if |name| has no samples.
+bool GetHistogramSnapshot(const std::string &name, HistogramSnapshot *snapshotOut);
+
+// Dumps every histogram of the in-process store, with its median and 99th percentile.
+std::string GetHistogramsJSON();
+
+// Drops the samples of the in-process store. The histograms stay registered, without samples.
+void ResetHistograms();
+
+}  // namespace angle
+
+#endif  // LIBANGLE_HISTOGRAMSTORE_H_
@@ -0,0 +1,197 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HistogramStore_unittest:
+//   Tests of the in-process histogram store.
+//
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+
+#include "libANGLE/HistogramStore.h"
+#include "libANGLE/histogram_macros.h"
+#include "platform/Platform.h"
+
+using namespace angle;
+
+namespace
+{
+
+class HistogramStoreTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ResetHistograms();
+        SetHistogramStoreEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        *ANGLEPlatformCurrent() = PlatformMethods();
+        SetHistogramStoreEnabled(false);
+        ResetHistograms();
+    }
+};
+
+// Custom counts samples fall into exponentially growing buckets between min and max.
+TEST_F(HistogramStoreTest, CustomCounts)
+{
+    ANGLE_HISTOGRAM_CUSTOM_COUNTS("Test.Counts", 0, 1, 1000, 10);
+    ANGLE_HISTOGRAM_CUSTOM_COUNTS("Test.Counts", 1, 1, 1000, 10);
+    ANGLE_HISTOGRAM_CUSTOM_COUNTS("Test.Counts", 500, 1, 1000, 10);
+    ANGLE_HISTOGRAM_CUSTOM_COUNTS("Test.Counts", 5000, 1, 1000, 10);
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Counts", &snapshot));
+    EXPECT_EQ(4u, snapshot.count);
+    EXPECT_EQ(5501, snapshot.sum);
+    EXPECT_EQ(0, snapshot.min);
+    EXPECT_EQ(5000, snapshot.max);
+
+    // Underflow, first, some middle, and overflow bucket.
+    ASSERT_EQ(4u, snapshot.buckets.size());
+    EXPECT_EQ(1u, snapshot.buckets[0]);
+    EXPECT_EQ(1u, snapshot.buckets[1]);
+    EXPECT_EQ(1u, snapshot.buckets[1000]);
+
+    int middleBucket = std::next(snapshot.buckets.begin(), 2)->first;
+    EXPECT_GT(middleBucket, 1);
+    EXPECT_LE(middleBucket, 500);
+}
+
+// Enumeration and boolean samples have a bucket each, and out of range samples share one.
+TEST_F(HistogramStoreTest, EnumerationAndBoolean)
+{
+    ANGLE_HISTOGRAM_ENUMERATION("Test.Enum", 2, 4);
+    ANGLE_HISTOGRAM_ENUMERATION("Test.Enum", 2, 4);
+    ANGLE_HISTOGRAM_ENUMERATION("Test.Enum", 7, 4);
+    ANGLE_HISTOGRAM_BOOLEAN("Test.Bool", true);
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Enum", &snapshot));
+    EXPECT_EQ(2u, snapshot.buckets[2]);
+    EXPECT_EQ(1u, snapshot.buckets[4]);
+
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Bool", &snapshot));
+    EXPECT_EQ(1u, snapshot.count);
+    EXPECT_EQ(1u, snapshot.buckets[1]);
+
+    EXPECT_FALSE(GetHistogramSnapshot("Test.Missing", &snapshot));
+}
+
+// Percentiles are the lower bounds of the buckets holding them.
+TEST_F(HistogramStoreTest, Percentiles)
+{
+    for (int sample = 0; sample < 100; ++sample)
+    {
+        ANGLE_HISTOGRAM_SPARSE_SLOWLY("Test.Sparse", sample);
+    }
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Sparse", &snapshot));
+    EXPECT_EQ(49, snapshot.percentile(0.5));
+    EXPECT_EQ(98, snapshot.percentile(0.99));
+    EXPECT_EQ(0, HistogramSnapshot().percentile(0.5));
+}
+
+// The scoped timers record without a platform clock.
+TEST_F(HistogramStoreTest, ScopedTimer)
+{
+    {
+        SCOPED_ANGLE_HISTOGRAM_TIMER("Test.TimerMS");
+    }
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.TimerMS", &snapshot));
+    EXPECT_EQ(1u, snapshot.count);
+}
+
+// The throughput samples are in KB per second, and immeasurably fast transfers are skipped.
+TEST_F(HistogramStoreTest, Throughput)
+{
+    ANGLE_HISTOGRAM_THROUGHPUT("Test.Throughput", 2048 * 1024, 2.0);
+    ANGLE_HISTOGRAM_THROUGHPUT("Test.Throughput", 1024, 0.0);
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Throughput", &snapshot));
+    EXPECT_EQ(1u, snapshot.count);
+    EXPECT_EQ(1024, snapshot.sum);
+}
+
+// Samples go to the platform methods instead of the store when the embedder sets them.
+TEST_F(HistogramStoreTest, PlatformMethodsTakePrecedence)
+{
+    static int platformSamples = 0;
+    ANGLEPlatformCurrent()->histogramSparse = [](PlatformMethods *platform, const char *name,
+                                                 int sample) { platformSamples++; };
+
+    ANGLE_HISTOGRAM_SPARSE_SLOWLY("Test.Platform", 1);
+    ANGLE_HISTOGRAM_BOOLEAN("Test.Local", true);
+
+    HistogramSnapshot snapshot;
+    EXPECT_EQ(1, platformSamples);
+    EXPECT_FALSE(GetHistogramSnapshot("Test.Platform", &snapshot));
+    EXPECT_TRUE(GetHistogramSnapshot("Test.Local", &snapshot));
+}
+
+// The store drops the samples recorded while it is off, and keeps counting once it is turned on.
+TEST_F(HistogramStoreTest, Disabled)
+{
+    SetHistogramStoreEnabled(false);
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        ANGLE_HISTOGRAM_BOOLEAN("Test.Disabled", true);
+        SetHistogramStoreEnabled(true);
+    }
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Disabled", &snapshot));
+    EXPECT_EQ(1u, snapshot.count);
+}
+
+// Resetting drops the samples of the histograms call sites already record into.
+TEST_F(HistogramStoreTest, Reset)
+{
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        ANGLE_HISTOGRAM_ENUMERATION("Test.Reset", iteration, 2);
+        if (iteration == 0)
+        {
+            ResetHistograms();
+        }
+    }
+
+    HistogramSnapshot snapshot;
+    ASSERT_TRUE(GetHistogramSnapshot("Test.Reset", &snapshot));
+    EXPECT_EQ(1u, snapshot.count);
+    EXPECT_EQ(0u, snapshot.buckets.count(0));
+    EXPECT_EQ(1u, snapshot.buckets[1]);
+    EXPECT_EQ(1, snapshot.min);
+}
+
+// The JSON dump lists every histogram with its statistics and buckets.
+TEST_F(HistogramStoreTest, JSON)
+{
+    ANGLE_HISTOGRAM_SPARSE_SLOWLY("Test.First", 3);
+    ANGLE_HISTOGRAM_SPARSE_SLOWLY("Test.Second", 5);
+    ANGLE_HISTOGRAM_SPARSE_SLOWLY("Test.Second", 5);
+
+    std::string json = GetHistogramsJSON();
+    EXPECT_EQ(0u, json.find("{\"histograms\":["));
+    EXPECT_NE(std::string::npos,
+              json.find("{\"name\":\"Test.First\",\"count\":1,\"sum\":3,\"min\":3,\"max\":3,"
+                        "\"p50\":3,\"p99\":3,\"buckets\":[[3,1]]}"));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Test.Second\",\"count\":2,\"sum\":10"));
+
+    size_t size = ANGLEGetHistogramsJSON(nullptr, 0);
+    EXPECT_EQ(json.size() + 1, size);
+    std::string copy(size, '\0');
+    EXPECT_EQ(size, ANGLEGetHistogramsJSON(&copy[0], size));
+    EXPECT_EQ(json, copy.c_str());
+}
+
+}  // anonymous namespace
@@ -0,0 +1,131 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTracker.cpp:
+//   Implements the GPU memory accounting of contexts and share groups.
+//
+
+#include "libANGLE/MemoryTracker.h"
+
+#include <algorithm>
+
+#include "libANGLE/Context.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/formatutils.h"
+
+namespace gl
+{
+
+uint64_t ComputeImageMemorySize(const InternalFormat &format, const Extents &size, GLsizei samples)
+{
+    if (size.width <= 0 || size.height <= 0 || size.depth <= 0)
+    {
+        return 0;
+    }
+
+    uint64_t width  = static_cast<uint64_t>(size.width);
+    uint64_t height = static_cast<uint64_t>(size.height);
+    if (format.compressed)
+    {
+        width  = (width + format.compressedBlockWidth - 1) / format.compressedBlockWidth;
+        height = (height + format.compressedBlockHeight - 1) / format.compressedBlockHeight;
+    }
+
+    return width * height * static_cast<uint64_t>(size.depth) * format.pixelBytes *
+           static_cast<uint64_t>(std::max(samples, 1));
+}
+
+MemoryTracker::MemoryTracker(std::shared_ptr<MemoryTracker> shareGroup)
+    : mShareGroup(std::move(shareGroup)), mTotalSize(0), mBudget(0)
+{
+    for (std::atomic<uint64_t> &size : mSizes)
+    {
+        size.store(0);
+    }
+}
+
+MemoryTracker::~MemoryTracker()
+{
+}
+
+void MemoryTracker::setBudget(uint64_t budget, BudgetExceededCallback callback)
+{
+    mBudget                 = budget;
+    mBudgetExceededCallback = std::move(callback);
+}
+
+void MemoryTracker::onSizeChange(MemoryCategory category, uint64_t oldSize, uint64_t newSize)
+{
+    if (mShareGroup)
+    {
+        mShareGroup->onSizeChange(category, oldSize, newSize);
+    }
+
+    std::atomic<uint64_t> &size = mSizes[static_cast<size_t>(category)];
+    if (newSize <= oldSize)
+    {
+        size -= oldSize - newSize;
+        mTotalSize -= oldSize - newSize;
+        return;
+    }
+
+    size += newSize - oldSize;
+    uint64_t total = (mTotalSize += newSize - oldSize);
+
+    // Only report crossing the budget, not every allocation made above it.
+    uint64_t previousTotal = total - (newSize - oldSize);
+    if (mBudget != 0 && total > mBudget && previousTotal <= mBudget && mBudgetExceededCallback)
+    {
+        mBudgetExceededCallback(total, mBudget);
+    }
+}
+
+uint64_t MemoryTracker::getSize(MemoryCategory category) const
+{
+    return mSizes[static_cast<size_t>(category)].load();
+}
+
+uint64_t MemoryTracker::getTotalSize() const
+{
+    return mTotalSize.load();
+}
+
+MemoryCharge::MemoryCharge(MemoryCategory category) : mCategory(category), mSize(0)
+{
+}
+
+MemoryCharge::~MemoryCharge()
+{
+    release();
+}
+
+void MemoryCharge::update(const Context *context, uint64_t size)
+{
+    std::shared_ptr<MemoryTracker> tracker =
+        context ? context->getMemoryTracker() : std::shared_ptr<MemoryTracker>();
+    if (tracker != mTracker)
+    {
+        release();
+        mTracker = std::move(tracker);
+    }
+
+    if (mTracker)
+    {
+        mTracker->onSizeChange(mCategory, mSize, size);
+        mSize = size;
+    }
+}
+
+void MemoryCharge::release()
+{
+    if (mTracker)
+    {
+        mTracker->onSizeChange(mCategory, mSize, 0);
+        mTracker.reset();
+    }
+    mSize = 0;
+}
+
+}  // namespace gl
@@ -0,0 +1,98 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTracker.h:
+//   Accounts the estimated GPU memory of buffers, textures and renderbuffers to the context that
+//   allocated it and to that context's share group, see GL_ANGLE_memory_accounting.
+//
+
+#ifndef LIBANGLE_MEMORYTRACKER_H_
+#define LIBANGLE_MEMORYTRACKER_H_
+
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+
+namespace gl
+{
+class Context;
+struct Extents;
+struct InternalFormat;
+
+enum class MemoryCategory
+{
+    Buffer,
+    Texture,
+    Renderbuffer,
+
+    Count,
+};
+
+// The estimated size of an image of |size| texels in |format|, with |samples| samples per texel.
+uint64_t ComputeImageMemorySize(const InternalFormat &format, const Extents &size, GLsizei samples);
+
+// The totals of a context, or of a share group. Objects are shared between the contexts of a share
+// group and outlive them, so they hold their tracker through a shared_ptr.
+class MemoryTracker final : angle::NonCopyable
+{
+  public:
+    // Called with the new total when an allocation takes it above the budget.
+    using BudgetExceededCallback = std::function<void(uint64_t total, uint64_t budget)>;
+
+    // A context's tracker adds everything it is charged to its share group's tracker as well.
+    explicit MemoryTracker(std::shared_ptr<MemoryTracker> shareGroup);
+    ~MemoryTracker();
+
+    const std::shared_ptr<MemoryTracker> &getShareGroup() const { return mShareGroup; }
+
+    // A budget of 0 disables it. The callback is only called by the thread of the context.
+    void setBudget(uint64_t budget, BudgetExceededCallback callback);
+    uint64_t getBudget() const { return mBudget; }
+
+    void onSizeChange(MemoryCategory category, uint64_t oldSize, uint64_t newSize);
+
+    uint64_t getSize(MemoryCategory category) const;
+    uint64_t getTotalSize() const;
+
+  private:
+    std::shared_ptr<MemoryTracker> mShareGroup;
+
+    // Objects of a share group are released from any of its contexts' threads.
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(MemoryCategory::Count)> mSizes;
+    std::atomic<uint64_t> mTotalSize;
+
+    uint64_t mBudget;
+    BudgetExceededCallback mBudgetExceededCallback;
+};
+
+// The footprint of one object, charged to the tracker of the context that last allocated its
+// storage. The footprint is given back when the object is destroyed.
+class MemoryCharge final : angle::NonCopyable
+{
+  public:
+    explicit MemoryCharge(MemoryCategory category);
+    ~MemoryCharge();
+
+    // |context| may be null in tests, which leaves the object unaccounted.
+    void update(const Context *context, uint64_t size);
+    void release();
+
+    uint64_t getSize() const { return mSize; }
+
+  private:
+    const MemoryCategory mCategory;
+    std::shared_ptr<MemoryTracker> mTracker;
+    uint64_t mSize;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORYTRACKER_H_
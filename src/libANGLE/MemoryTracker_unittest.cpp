@@ -0,0 +1,112 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTracker_unittest:
+//   Tests of the GPU memory accounting of contexts and share groups.
+//
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/MemoryTracker.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/formatutils.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Each category has its own total, and the total of the tracker is their sum.
+TEST(MemoryTrackerTest, Categories)
+{
+    MemoryTracker tracker(nullptr);
+    tracker.onSizeChange(MemoryCategory::Buffer, 0, 100);
+    tracker.onSizeChange(MemoryCategory::Texture, 0, 1000);
+    tracker.onSizeChange(MemoryCategory::Buffer, 100, 40);
+
+    EXPECT_EQ(40u, tracker.getSize(MemoryCategory::Buffer));
+    EXPECT_EQ(1000u, tracker.getSize(MemoryCategory::Texture));
+    EXPECT_EQ(0u, tracker.getSize(MemoryCategory::Renderbuffer));
+    EXPECT_EQ(1040u, tracker.getTotalSize());
+}
+
+// The share group tracker sums the charges of all the contexts of the group.
+TEST(MemoryTrackerTest, ShareGroup)
+{
+    auto shareGroup = std::make_shared<MemoryTracker>(nullptr);
+    MemoryTracker first(shareGroup);
+    MemoryTracker second(shareGroup);
+
+    first.onSizeChange(MemoryCategory::Renderbuffer, 0, 64);
+    second.onSizeChange(MemoryCategory::Renderbuffer, 0, 32);
+
+    EXPECT_EQ(64u, first.getTotalSize());
+    EXPECT_EQ(32u, second.getTotalSize());
+    EXPECT_EQ(96u, shareGroup->getSize(MemoryCategory::Renderbuffer));
+
+    first.onSizeChange(MemoryCategory::Renderbuffer, 64, 0);
+    EXPECT_EQ(32u, shareGroup->getTotalSize());
+}
+
+// The callback is called when the budget is crossed, not for every allocation above it.
+TEST(MemoryTrackerTest, Budget)
+{
+    MemoryTracker tracker(nullptr);
+
+    int calls          = 0;
+    uint64_t lastTotal = 0;
+    tracker.setBudget(100, [&](uint64_t total, uint64_t budget) {
+        EXPECT_EQ(100u, budget);
+        calls++;
+        lastTotal = total;
+    });
+    EXPECT_EQ(100u, tracker.getBudget());
+
+    tracker.onSizeChange(MemoryCategory::Buffer, 0, 100);
+    EXPECT_EQ(0, calls);
+
+    tracker.onSizeChange(MemoryCategory::Texture, 0, 10);
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(110u, lastTotal);
+
+    tracker.onSizeChange(MemoryCategory::Texture, 10, 20);
+    EXPECT_EQ(1, calls);
+
+    // Going back under the budget and over it again is reported again.
+    tracker.onSizeChange(MemoryCategory::Buffer, 100, 0);
+    tracker.onSizeChange(MemoryCategory::Buffer, 0, 200);
+    EXPECT_EQ(2, calls);
+
+    // A budget of 0 disables the callback.
+    tracker.setBudget(0, nullptr);
+    tracker.onSizeChange(MemoryCategory::Buffer, 200, 1000);
+    EXPECT_EQ(2, calls);
+}
+
+// Without a context there is no tracker to charge.
+TEST(MemoryTrackerTest, ChargeWithoutContext)
+{
+    MemoryCharge charge(MemoryCategory::Buffer);
+    charge.update(nullptr, 100);
+    EXPECT_EQ(0u, charge.getSize());
+    charge.release();
+    EXPECT_EQ(0u, charge.getSize());
+}
+
+// Image sizes account for every texel, sample and compressed block.
+TEST(MemoryTrackerTest, ImageSizes)
+{
+    const InternalFormat &rgba8 = GetSizedInternalFormatInfo(GL_RGBA8);
+    EXPECT_EQ(4u * 4u * 4u, ComputeImageMemorySize(rgba8, Extents(4, 4, 1), 0));
+    EXPECT_EQ(4u * 4u * 4u * 6u, ComputeImageMemorySize(rgba8, Extents(4, 4, 6), 0));
+    EXPECT_EQ(4u * 4u * 4u * 4u, ComputeImageMemorySize(rgba8, Extents(4, 4, 1), 4));
+    EXPECT_EQ(0u, ComputeImageMemorySize(rgba8, Extents(0, 4, 1), 0));
+
+    // DXT1 stores 4x4 blocks in 8 bytes, so a 5x5 image takes 4 blocks.
+    const InternalFormat &dxt1 = GetSizedInternalFormatInfo(GL_COMPRESSED_RGB_S3TC_DXT1_EXT);
+    EXPECT_EQ(4u * 8u, ComputeImageMemorySize(dxt1, Extents(5, 5, 1), 0));
+}
+
+}  // anonymous namespace
@@ -10,7 +10,9 @@
 
 #include <cstring>
 
+#include "common/TraceRecorder.h"
 #include "common/debug.h"
+#include "libANGLE/HistogramStore.h"
 
 namespace
 {
@@ -63,3 +65,18 @@ void ANGLE_APIENTRY ANGLEResetDisplayPlatform(angle::EGLDisplayType display)
     // TODO(jmadill): Store platform methods in display.
     g_platformMethods = angle::PlatformMethods();
 }
+
+bool ANGLE_APIENTRY ANGLEFlushTraceRecorder()
+{
+    return angle::FlushTraceRecorder();
+}
+
+size_t ANGLE_APIENTRY ANGLEGetHistogramsJSON(char *buffer, size_t bufferSize)
+{
+    std::string json = angle::GetHistogramsJSON();
+    if (buffer != nullptr && bufferSize > json.size())
+    {
+        memcpy(buffer, json.c_str(), json.size() + 1);
+    }
+    return json.size() + 1;
+}
@@ -20,12 +20,14 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/features.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "libANGLE/VaryingPacking.h"
 #include "libANGLE/queryconversions.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/UniformLinker.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace gl
 {
@@ -214,6 +216,46 @@ bool IncludeSameArrayElement(const std::set<std::string> &nameSet, const std::st
     return false;
 }
 
+// The value types of the glUniform* calls, in the order of their UniformValueTypeBit.
+constexpr GLenum kUniformValueTypes[] = {
+    GL_FLOAT,             GL_FLOAT_VEC2,        GL_FLOAT_VEC3,        GL_FLOAT_VEC4,
+    GL_INT,               GL_INT_VEC2,          GL_INT_VEC3,          GL_INT_VEC4,
+    GL_UNSIGNED_INT,      GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4,
+    GL_FLOAT_MAT2,        GL_FLOAT_MAT3,        GL_FLOAT_MAT4,
+    GL_FLOAT_MAT2x3,      GL_FLOAT_MAT2x4,      GL_FLOAT_MAT3x2,      GL_FLOAT_MAT3x4,
+    GL_FLOAT_MAT4x2,      GL_FLOAT_MAT4x3,
+};
+
+bool IsUniformValueTypeCompatible(GLenum valueType, GLenum uniformType)
+{
+    if (valueType == uniformType)
+    {
+        return true;
+    }
+
+    // Matrices must match exactly. The other values can also set booleans of the same size, and
+    // glUniform1i{v} sets samplers.
+    if (VariableRowCount(valueType) > 1)
+    {
+        return false;
+    }
+    return VariableBoolVectorType(valueType) == uniformType ||
+           (valueType == GL_INT && IsSamplerType(uniformType));
+}
+
+uint32_t GetUniformValueTypeMask(GLenum uniformType)
+{
+    uint32_t mask = 0;
+    for (GLenum valueType : kUniformValueTypes)
+    {
+        if (IsUniformValueTypeCompatible(valueType, uniformType))
+        {
+            mask |= UniformValueTypeBit(valueType);
+        }
+    }
+    return mask;
+}
+
 }  // anonymous namespace
 
 const char *const g_fakepath = "C:\\fakepath";
@@ -291,6 +333,72 @@ VariableLocation::VariableLocation(const std::string &name,
 {
 }
 
+uint32_t UniformValueTypeBit(GLenum valueType)
+{
+    switch (valueType)
+    {
+        case GL_FLOAT:
+            return 1u << 0;
+        case GL_FLOAT_VEC2:
+            return 1u << 1;
+        case GL_FLOAT_VEC3:
+            return 1u << 2;
+        case GL_FLOAT_VEC4:
+            return 1u << 3;
+        case GL_INT:
+            return 1u << 4;
+        case GL_INT_VEC2:
+            return 1u << 5;
+        case GL_INT_VEC3:
+            return 1u << 6;
+        case GL_INT_VEC4:
+            return 1u << 7;
+        case GL_UNSIGNED_INT:
+            return 1u << 8;
+        case GL_UNSIGNED_INT_VEC2:
+            return 1u << 9;
+        case GL_UNSIGNED_INT_VEC3:
+            return 1u << 10;
+        case GL_UNSIGNED_INT_VEC4:
+            return 1u << 11;
+        case GL_FLOAT_MAT2:
+            return 1u << 12;
+        case GL_FLOAT_MAT3:
+            return 1u << 13;
+        case GL_FLOAT_MAT4:
+            return 1u << 14;
+        case GL_FLOAT_MAT2x3:
+            return 1u << 15;
+        case GL_FLOAT_MAT2x4:
+            return 1u << 16;
+        case GL_FLOAT_MAT3x2:
+            return 1u << 17;
+        case GL_FLOAT_MAT3x4:
+            return 1u << 18;
+        case GL_FLOAT_MAT4x2:
+            return 1u << 19;
+        case GL_FLOAT_MAT4x3:
+            return 1u << 20;
+        default:
+            return 0;
+    }
+}
+
+UniformLocationRecord::UniformLocationRecord()
+    : uniformIndex(0),
+      element(0),
+      dataOffset(0),
+      remainingElements(0),
+      remainingComponents(0),
+      valueTypeMask(0),
+      used(false),
+      ignored(false),
+      isArray(false),
+      isSampler(false),
+      isBool(false)
+{
+}
+
 void Program::Bindings::bindLocation(GLuint index, const std::string &name)
 {
     mBindings[name] = index;
@@ -618,6 +726,8 @@ void Program::pathFragmentInputGen(GLint index,
 // The code gets compiled into binaries.
 Error Program::link(const gl::Context *context)
 {
+    TRACE_EVENT0("gpu.angle", "Program::link");
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.ProgramLinkMS");
     const auto &data = context->getContextState();
 
     unlink();
@@ -765,6 +875,7 @@ void Program::unlink()
     mState.mLinkedTransformFeedbackVaryings.clear();
     mState.mUniforms.clear();
     mState.mUniformLocations.clear();
+    mState.mUniformLocationRecords.clear();
     mState.mUniformBlocks.clear();
     mState.mOutputVariables.clear();
     mState.mOutputLocations.clear();
@@ -787,6 +898,8 @@ Error Program::loadBinary(const Context *context,
                           const void *binary,
                           GLsizei length)
 {
+    // Loading a binary is the fast path of linking, so it is measured apart from link().
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.ProgramBinaryLoadMS");
     unlink();
 
 #if ANGLE_PROGRAM_BINARY_LOAD != ANGLE_ENABLED
@@ -955,6 +1068,8 @@ Error Program::loadBinary(const Context *context,
         mState.mSamplerBindings.emplace_back(SamplerBinding(textureType, bindingCount));
     }
 
+    updateUniformLocationRecords();
+
     ANGLE_TRY_RESULT(mProgram->load(context, mInfoLog, &stream), mLinked);
 
     return NoError();
@@ -1518,6 +1633,11 @@ const std::vector<VariableLocation> &Program::getUniformLocations() const
     return mState.mUniformLocations;
 }
 
+const std::vector<UniformLocationRecord> &Program::getUniformLocationRecords() const
+{
+    return mState.mUniformLocationRecords;
+}
+
 const LinkedUniform &Program::getUniformByIndex(GLuint index) const
 {
     ASSERT(index < static_cast<size_t>(mState.mUniforms.size()));
@@ -2034,6 +2154,7 @@ bool Program::linkUniforms(InfoLog &infoLog,
     linker.getResults(&mState.mUniforms, &mState.mUniformLocations);
 
     linkSamplerBindings();
+    updateUniformLocationRecords();
 
     return true;
 }
@@ -2059,6 +2180,40 @@ void Program::linkSamplerBindings()
     }
 }
 
+void Program::updateUniformLocationRecords()
+{
+    ASSERT(mState.mUniformLocationRecords.empty());
+    mState.mUniformLocationRecords.resize(mState.mUniformLocations.size());
+
+    for (size_t location = 0; location < mState.mUniformLocations.size(); ++location)
+    {
+        const VariableLocation &locationInfo = mState.mUniformLocations[location];
+        UniformLocationRecord *record        = &mState.mUniformLocationRecords[location];
+
+        record->used    = locationInfo.used;
+        record->ignored = locationInfo.ignored;
+        if (!locationInfo.used)
+        {
+            continue;
+        }
+
+        const LinkedUniform &uniform   = mState.mUniforms[locationInfo.index];
+        unsigned int elementSize       = static_cast<unsigned int>(uniform.getElementSize());
+        unsigned int elementComponents = static_cast<unsigned int>(uniform.getElementComponents());
+        ASSERT(locationInfo.element < uniform.elementCount());
+
+        record->uniformIndex        = locationInfo.index;
+        record->element             = locationInfo.element;
+        record->dataOffset          = elementSize * locationInfo.element;
+        record->remainingElements   = uniform.elementCount() - locationInfo.element;
+        record->remainingComponents = elementComponents * record->remainingElements;
+        record->valueTypeMask       = GetUniformValueTypeMask(uniform.type);
+        record->isArray             = uniform.isArray();
+        record->isSampler           = mState.isSamplerUniformIndex(locationInfo.index);
+        record->isBool              = VariableComponentType(uniform.type) == GL_BOOL;
+    }
+}
+
 bool Program::linkValidateInterfaceBlockFields(InfoLog &infoLog,
                                                const std::string &uniformName,
                                                const sh::InterfaceBlockField &vertexUniform,
@@ -2968,26 +3123,25 @@ void Program::defineUniformBlock(const sh::InterfaceBlock &interfaceBlock, GLenu
 }
 
 template <>
-void Program::updateSamplerUniform(const VariableLocation &locationInfo,
+void Program::updateSamplerUniform(const UniformLocationRecord &record,
                                    const uint8_t *destPointer,
                                    GLsizei clampedCount,
                                    const GLint *v)
 {
     // Invalidate the validation cache only if we modify the sampler data.
-    if (mState.isSamplerUniformIndex(locationInfo.index) &&
-        memcmp(destPointer, v, sizeof(GLint) * clampedCount) != 0)
+    if (record.isSampler && memcmp(destPointer, v, sizeof(GLint) * clampedCount) != 0)
     {
-        GLuint samplerIndex = mState.getSamplerIndexFromUniformIndex(locationInfo.index);
+        GLuint samplerIndex = mState.getSamplerIndexFromUniformIndex(record.uniformIndex);
         std::vector<GLuint> *boundTextureUnits =
             &mState.mSamplerBindings[samplerIndex].boundTextureUnits;
 
-        std::copy(v, v + clampedCount, boundTextureUnits->begin() + locationInfo.element);
+        std::copy(v, v + clampedCount, boundTextureUnits->begin() + record.element);
         mCachedValidateSamplersResult.reset();
     }
 }
 
 template <typename T>
-void Program::updateSamplerUniform(const VariableLocation &locationInfo,
+void Program::updateSamplerUniform(const UniformLocationRecord &record,
                                    const uint8_t *destPointer,
                                    GLsizei clampedCount,
                                    const T *v)
@@ -2997,15 +3151,12 @@ void Program::updateSamplerUniform(const VariableLocation &locationInfo,
 template <typename T>
 GLsizei Program::setUniformInternal(GLint location, GLsizei countIn, int vectorSize, const T *v)
 {
-    const VariableLocation &locationInfo = mState.mUniformLocations[location];
-    LinkedUniform *linkedUniform         = &mState.mUniforms[locationInfo.index];
-    uint8_t *destPointer                 = linkedUniform->getDataPtrToElement(locationInfo.element);
+    const UniformLocationRecord &record = mState.mUniformLocationRecords[location];
+    uint8_t *destPointer = mState.mUniforms[record.uniformIndex].data() + record.dataOffset;
 
     // OpenGL ES 3.0.4 spec pg 67: "Values for any array element that exceeds the highest array
     // element index used, as reported by GetActiveUniform, will be ignored by the GL."
-    unsigned int remainingElements = linkedUniform->elementCount() - locationInfo.element;
-    GLsizei maxElementCount =
-        static_cast<GLsizei>(remainingElements * linkedUniform->getElementComponents());
+    GLsizei maxElementCount = static_cast<GLsizei>(record.remainingComponents);
 
     GLsizei count        = countIn;
     GLsizei clampedCount = count * vectorSize;
@@ -3015,7 +3166,7 @@ GLsizei Program::setUniformInternal(GLint location, GLsizei countIn, int vectorS
         count        = maxElementCount / vectorSize;
     }
 
-    if (VariableComponentType(linkedUniform->type) == GL_BOOL)
+    if (record.isBool)
     {
         // Do a cast conversion for boolean types. From the spec:
         // "The uniform is set to FALSE if the input value is 0 or 0.0f, and set to TRUE otherwise."
@@ -3027,7 +3178,7 @@ GLsizei Program::setUniformInternal(GLint location, GLsizei countIn, int vectorS
     }
     else
     {
-        updateSamplerUniform(locationInfo, destPointer, clampedCount, v);
+        updateSamplerUniform(record, destPointer, clampedCount, v);
         memcpy(destPointer, v, sizeof(T) * clampedCount);
     }
 
@@ -3046,14 +3197,13 @@ GLsizei Program::setMatrixUniformInternal(GLint location,
     }
 
     // Perform a transposing copy.
-    const VariableLocation &locationInfo = mState.mUniformLocations[location];
-    LinkedUniform *linkedUniform         = &mState.mUniforms[locationInfo.index];
-    T *destPtr = reinterpret_cast<T *>(linkedUniform->getDataPtrToElement(locationInfo.element));
+    const UniformLocationRecord &record = mState.mUniformLocationRecords[location];
+    T *destPtr =
+        reinterpret_cast<T *>(mState.mUniforms[record.uniformIndex].data() + record.dataOffset);
 
     // OpenGL ES 3.0.4 spec pg 67: "Values for any array element that exceeds the highest array
     // element index used, as reported by GetActiveUniform, will be ignored by the GL."
-    unsigned int remainingElements = linkedUniform->elementCount() - locationInfo.element;
-    GLsizei clampedCount           = std::min(count, static_cast<GLsizei>(remainingElements));
+    GLsizei clampedCount = std::min(count, static_cast<GLsizei>(record.remainingElements));
 
     for (GLsizei element = 0; element < clampedCount; ++element)
     {
@@ -142,6 +142,38 @@ struct VariableLocation
     bool ignored;
 };
 
+// Returns the bit of UniformLocationRecord::valueTypeMask that stands for a glUniform* value type,
+// for example GL_FLOAT_VEC3 for glUniform3f. Returns 0 for types no glUniform* call takes.
+uint32_t UniformValueTypeBit(GLenum valueType);
+
+// Everything the glUniform* calls need to know about a uniform location, computed at link time so
+// that validating and setting a uniform doesn't have to look at the LinkedUniform.
+struct UniformLocationRecord
+{
+    UniformLocationRecord();
+
+    // Index of the uniform in the program's uniform list, and the array element of the location.
+    unsigned int uniformIndex;
+    unsigned int element;
+
+    // Offset in bytes of the element in the uniform's data.
+    unsigned int dataOffset;
+
+    // Elements and components left in the uniform from this location on. Data past them is
+    // ignored.
+    unsigned int remainingElements;
+    unsigned int remainingComponents;
+
+    // UniformValueTypeBit of each value type the uniform can be set with.
+    uint32_t valueTypeMask;
+
+    bool used;
+    bool ignored;
+    bool isArray;
+    bool isSampler;
+    bool isBool;
+};
+
 // Information about a variable binding.
 // Currently used by CHROMIUM_path_rendering
 struct BindingInfo
@@ -231,6 +263,10 @@ class ProgramState final : angle::NonCopyable
     const std::map<int, VariableLocation> &getOutputLocations() const { return mOutputLocations; }
     const std::vector<LinkedUniform> &getUniforms() const { return mUniforms; }
     const std::vector<VariableLocation> &getUniformLocations() const { return mUniformLocations; }
+    const std::vector<UniformLocationRecord> &getUniformLocationRecords() const
+    {
+        return mUniformLocationRecords;
+    }
     const std::vector<UniformBlock> &getUniformBlocks() const { return mUniformBlocks; }
     const std::vector<SamplerBinding> &getSamplerBindings() const { return mSamplerBindings; }
 
@@ -269,6 +305,8 @@ class ProgramState final : angle::NonCopyable
     // This makes sampler validation easier, since we don't need a separate list.
     std::vector<LinkedUniform> mUniforms;
     std::vector<VariableLocation> mUniformLocations;
+    // Parallel to mUniformLocations.
+    std::vector<UniformLocationRecord> mUniformLocationRecords;
     std::vector<UniformBlock> mUniformBlocks;
     RangeUI mSamplerUniformRange;
 
@@ -375,6 +413,7 @@ class Program final : angle::NonCopyable, public LabeledObject
     const LinkedUniform &getUniformByLocation(GLint location) const;
     const VariableLocation &getUniformLocation(GLint location) const;
     const std::vector<VariableLocation> &getUniformLocations() const;
+    const std::vector<UniformLocationRecord> &getUniformLocationRecords() const;
     const LinkedUniform &getUniformByIndex(GLuint index) const;
 
     GLint getUniformLocation(const std::string &name) const;
@@ -499,6 +538,7 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     bool linkUniforms(InfoLog &infoLog, const Caps &caps, const Bindings &uniformLocationBindings);
     void linkSamplerBindings();
+    void updateUniformLocationRecords();
 
     bool areMatchingInterfaceBlocks(InfoLog &infoLog,
                                     const sh::InterfaceBlock &vertexInterfaceBlock,
@@ -541,7 +581,7 @@ class Program final : angle::NonCopyable, public LabeledObject
                                      GLboolean transpose,
                                      const T *v);
     template <typename T>
-    void updateSamplerUniform(const VariableLocation &locationInfo,
+    void updateSamplerUniform(const UniformLocationRecord &record,
                               const uint8_t *destPointer,
                               GLsizei clampedCount,
                               const T *v);
@@ -16,6 +16,7 @@
 
 #include "angle_gl.h"
 
+#include <atomic>
 #include <cstddef>
 
 namespace gl
@@ -51,14 +52,15 @@ class RefCountObjectNoID : angle::NonCopyable
         }
     }
 
-    size_t getRefCount() const { return mRefCount; }
+    size_t getRefCount() const { return mRefCount.load(); }
 
   protected:
     virtual ~RefCountObjectNoID() { ASSERT(mRefCount == 0); }
     virtual void destroy(const gl::Context *context) {}
 
   private:
-    mutable std::size_t mRefCount;
+    // Shared objects are bound by the contexts of a share group from any thread.
+    mutable std::atomic<std::size_t> mRefCount;
 };
 
 class RefCountObject : public RefCountObjectNoID
@@ -11,6 +11,7 @@
 #include "libANGLE/Renderbuffer.h"
 
 #include "common/utilities.h"
+#include "libANGLE/Context.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/Texture.h"
@@ -26,7 +27,9 @@ Renderbuffer::Renderbuffer(rx::RenderbufferImpl *impl, GLuint id)
       mWidth(0),
       mHeight(0),
       mFormat(GL_RGBA4),
-      mSamples(0)
+      mSamples(0),
+      mInitState(InitState::Initialized),
+      mMemoryCharge(MemoryCategory::Renderbuffer)
 {
 }
 
@@ -45,7 +48,10 @@ const std::string &Renderbuffer::getLabel() const
     return mLabel;
 }
 
-Error Renderbuffer::setStorage(GLenum internalformat, size_t width, size_t height)
+Error Renderbuffer::setStorage(const Context *context,
+                               GLenum internalformat,
+                               size_t width,
+                               size_t height)
 {
     orphanImages();
 
@@ -55,13 +61,21 @@ Error Renderbuffer::setStorage(GLenum internalformat, size_t width, size_t heigh
     mHeight         = static_cast<GLsizei>(height);
     mFormat         = Format(internalformat);
     mSamples = 0;
+    mInitState      = DetermineInitState(context);
+
+    mMemoryCharge.update(context,
+                         ComputeImageMemorySize(*mFormat.info, Extents(mWidth, mHeight, 1), 0));
 
     mDirtyChannel.signal();
 
     return NoError();
 }
 
-Error Renderbuffer::setStorageMultisample(size_t samples, GLenum internalformat, size_t width, size_t height)
+Error Renderbuffer::setStorageMultisample(const Context *context,
+                                          size_t samples,
+                                          GLenum internalformat,
+                                          size_t width,
+                                          size_t height)
 {
     orphanImages();
 
@@ -71,6 +85,10 @@ Error Renderbuffer::setStorageMultisample(size_t samples, GLenum internalformat,
     mHeight         = static_cast<GLsizei>(height);
     mFormat         = Format(internalformat);
     mSamples        = static_cast<GLsizei>(samples);
+    mInitState      = DetermineInitState(context);
+
+    mMemoryCharge.update(
+        context, ComputeImageMemorySize(*mFormat.info, Extents(mWidth, mHeight, 1), mSamples));
 
     mDirtyChannel.signal();
 
@@ -89,6 +107,10 @@ Error Renderbuffer::setStorageEGLImageTarget(egl::Image *image)
     mHeight         = static_cast<GLsizei>(image->getHeight());
     mFormat         = Format(image->getFormat());
     mSamples        = 0;
+    mInitState      = InitState::Initialized;
+
+    // The image's storage belongs to its source, which accounts for it.
+    mMemoryCharge.release();
 
     mDirtyChannel.signal();
 
@@ -166,6 +188,16 @@ GLuint Renderbuffer::getId() const
     return id();
 }
 
+InitState Renderbuffer::initState(const ImageIndex & /*imageIndex*/) const
+{
+    return mInitState;
+}
+
+void Renderbuffer::setInitState(const ImageIndex & /*imageIndex*/, InitState initState)
+{
+    mInitState = initState;
+}
+
 Extents Renderbuffer::getAttachmentSize(const gl::ImageIndex & /*imageIndex*/) const
 {
     return Extents(mWidth, mHeight, 1);
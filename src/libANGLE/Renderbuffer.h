@@ -17,6 +17,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/MemoryTracker.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/RenderbufferImpl.h"
 
@@ -39,8 +40,12 @@ class Renderbuffer final : public egl::ImageSibling,
     void setLabel(const std::string &label) override;
     const std::string &getLabel() const override;
 
-    Error setStorage(GLenum internalformat, size_t width, size_t height);
-    Error setStorageMultisample(size_t samples, GLenum internalformat, size_t width, size_t height);
+    Error setStorage(const Context *context, GLenum internalformat, size_t width, size_t height);
+    Error setStorageMultisample(const Context *context,
+                                size_t samples,
+                                GLenum internalformat,
+                                size_t width,
+                                size_t height);
     Error setStorageEGLImageTarget(egl::Image *imageTarget);
 
     rx::RenderbufferImpl *getImplementation() const;
@@ -72,6 +77,9 @@ class Renderbuffer final : public egl::ImageSibling,
     void onDetach() override;
     GLuint getId() const override;
 
+    InitState initState(const ImageIndex &imageIndex) const override;
+    void setInitState(const ImageIndex &imageIndex, InitState initState) override;
+
   private:
     rx::FramebufferAttachmentObjectImpl *getAttachmentImpl() const override { return mRenderbuffer; }
 
@@ -83,6 +91,9 @@ class Renderbuffer final : public egl::ImageSibling,
     GLsizei mHeight;
     Format mFormat;
     GLsizei mSamples;
+    InitState mInitState;
+
+    MemoryCharge mMemoryCharge;
 };
 
 }
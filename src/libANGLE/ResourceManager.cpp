@@ -26,24 +26,40 @@ namespace
 {
 
 template <typename ResourceType>
-GLuint AllocateEmptyObject(HandleAllocator *handleAllocator, ResourceMap<ResourceType> *objectMap)
+GLuint AllocateEmptyObject(angle::ReaderWriterLock *lock,
+                           HandleAllocator *handleAllocator,
+                           ResourceMap<ResourceType> *objectMap)
 {
+    angle::ScopedWriterLock writerLock(lock);
     GLuint handle        = handleAllocator->allocate();
     (*objectMap)[handle] = nullptr;
     return handle;
 }
 
 template <typename ResourceType>
-ResourceType *GetObject(const ResourceMap<ResourceType> &objectMap, GLuint handle)
+ResourceType *GetObject(angle::ReaderWriterLock *lock,
+                        const ResourceMap<ResourceType> &objectMap,
+                        GLuint handle)
 {
+    angle::ScopedReaderLock readerLock(lock);
     auto iter = objectMap.find(handle);
     return iter != objectMap.end() ? iter->second : nullptr;
 }
 
+template <typename ResourceType>
+bool IsObjectGenerated(angle::ReaderWriterLock *lock,
+                       const ResourceMap<ResourceType> &objectMap,
+                       GLuint handle)
+{
+    angle::ScopedReaderLock readerLock(lock);
+    return objectMap.find(handle) != objectMap.end();
+}
+
 }  // anonymous namespace
 
 template <typename HandleAllocatorType>
-ResourceManagerBase<HandleAllocatorType>::ResourceManagerBase() : mRefCount(1)
+ResourceManagerBase<HandleAllocatorType>::ResourceManagerBase()
+    : mLockingEnabled(false), mRefCount(1)
 {
 }
 
@@ -84,31 +100,46 @@ void TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::deleteObjec
     const Context *context,
     GLuint handle)
 {
-    auto objectIter = mObjectMap.find(handle);
-    if (objectIter == mObjectMap.end())
+    ResourceType *object = nullptr;
+
     {
-        return;
+        // Requires an explicit this-> because of C++ template rules.
+        angle::ScopedWriterLock writerLock(this->getLock());
+
+        auto objectIter = mObjectMap.find(handle);
+        if (objectIter == mObjectMap.end())
+        {
+            return;
+        }
+
+        object = objectIter->second;
+        this->mHandleAllocator.release(objectIter->first);
+        mObjectMap.erase(objectIter);
     }
 
-    if (objectIter->second != nullptr)
+    if (object != nullptr)
     {
-        objectIter->second->destroy(context);
-        ImplT::DeleteObject(objectIter->second);
+        object->destroy(context);
+        ImplT::DeleteObject(object);
     }
-
-    // Requires an explicit this-> because of C++ template rules.
-    this->mHandleAllocator.release(objectIter->first);
-    mObjectMap.erase(objectIter);
 }
 
 template <typename ResourceType, typename HandleAllocatorType, typename ImplT>
 template <typename... ArgTypes>
 ResourceType *TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::allocateObject(
-    typename ResourceMap<ResourceType>::iterator &objectMapIter,
     rx::GLImplFactory *factory,
     GLuint handle,
     ArgTypes... args)
 {
+    angle::ScopedWriterLock writerLock(this->getLock());
+
+    // Another context of the share group may have allocated the object since the lookup.
+    auto objectMapIter = mObjectMap.find(handle);
+    if (objectMapIter != mObjectMap.end() && objectMapIter->second != nullptr)
+    {
+        return objectMapIter->second;
+    }
+
     ResourceType *object = ImplT::AllocateNewObject(factory, handle, args...);
 
     if (objectMapIter != mObjectMap.end())
@@ -128,31 +159,26 @@ template class ResourceManagerBase<HandleAllocator>;
 template class ResourceManagerBase<HandleRangeAllocator>;
 template class TypedResourceManager<Buffer, HandleAllocator, BufferManager>;
 template Buffer *TypedResourceManager<Buffer, HandleAllocator, BufferManager>::allocateObject(
-    ResourceMap<Buffer>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<Texture, HandleAllocator, TextureManager>;
 template Texture *TypedResourceManager<Texture, HandleAllocator, TextureManager>::allocateObject(
-    ResourceMap<Texture>::iterator &,
     rx::GLImplFactory *,
     GLuint,
     GLenum);
 template class TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>;
 template Renderbuffer *
 TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>::allocateObject(
-    ResourceMap<Renderbuffer>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<Sampler, HandleAllocator, SamplerManager>;
 template Sampler *TypedResourceManager<Sampler, HandleAllocator, SamplerManager>::allocateObject(
-    ResourceMap<Sampler>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<FenceSync, HandleAllocator, FenceSyncManager>;
 template class TypedResourceManager<Framebuffer, HandleAllocator, FramebufferManager>;
 template Framebuffer *
 TypedResourceManager<Framebuffer, HandleAllocator, FramebufferManager>::allocateObject(
-    ResourceMap<Framebuffer>::iterator &,
     rx::GLImplFactory *,
     GLuint,
     const Caps &);
@@ -175,17 +201,17 @@ void BufferManager::DeleteObject(Buffer *buffer)
 
 GLuint BufferManager::createBuffer()
 {
-    return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
+    return AllocateEmptyObject(getLock(), &mHandleAllocator, &mObjectMap);
 }
 
 Buffer *BufferManager::getBuffer(GLuint handle) const
 {
-    return GetObject(mObjectMap, handle);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 bool BufferManager::isBufferGenerated(GLuint buffer) const
 {
-    return buffer == 0 || mObjectMap.find(buffer) != mObjectMap.end();
+    return buffer == 0 || IsObjectGenerated(getLock(), mObjectMap, buffer);
 }
 
 // ShaderProgramManager Implementation.
@@ -215,6 +241,7 @@ GLuint ShaderProgramManager::createShader(rx::GLImplFactory *factory,
                                           GLenum type)
 {
     ASSERT(type == GL_VERTEX_SHADER || type == GL_FRAGMENT_SHADER || type == GL_COMPUTE_SHADER);
+    angle::ScopedWriterLock writerLock(getLock());
     GLuint handle    = mHandleAllocator.allocate();
     mShaders[handle] = new Shader(this, factory, rendererLimitations, type, handle);
     return handle;
@@ -227,11 +254,12 @@ void ShaderProgramManager::deleteShader(const Context *context, GLuint shader)
 
 Shader *ShaderProgramManager::getShader(GLuint handle) const
 {
-    return GetObject(mShaders, handle);
+    return GetObject(getLock(), mShaders, handle);
 }
 
 GLuint ShaderProgramManager::createProgram(rx::GLImplFactory *factory)
 {
+    angle::ScopedWriterLock writerLock(getLock());
     GLuint handle     = mHandleAllocator.allocate();
     mPrograms[handle] = new Program(factory, this, handle);
     return handle;
@@ -244,7 +272,7 @@ void ShaderProgramManager::deleteProgram(const gl::Context *context, GLuint prog
 
 Program *ShaderProgramManager::getProgram(GLuint handle) const
 {
-    return GetObject(mPrograms, handle);
+    return GetObject(getLock(), mPrograms, handle);
 }
 
 template <typename ObjectType>
@@ -252,24 +280,30 @@ void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType> *objectMap,
                                         GLuint id)
 {
-    auto iter = objectMap->find(id);
-    if (iter == objectMap->end())
-    {
-        return;
-    }
+    ObjectType *object = nullptr;
 
-    auto object = iter->second;
-    if (object->getRefCount() == 0)
     {
+        angle::ScopedWriterLock writerLock(getLock());
+
+        auto iter = objectMap->find(id);
+        if (iter == objectMap->end())
+        {
+            return;
+        }
+
+        object = iter->second;
+        if (object->getRefCount() != 0)
+        {
+            object->flagForDeletion();
+            return;
+        }
+
         mHandleAllocator.release(id);
-        object->destroy(context);
-        SafeDelete(object);
         objectMap->erase(iter);
     }
-    else
-    {
-        object->flagForDeletion();
-    }
+
+    object->destroy(context);
+    SafeDelete(object);
 }
 
 // TextureManager Implementation.
@@ -290,22 +324,24 @@ void TextureManager::DeleteObject(Texture *texture)
 
 GLuint TextureManager::createTexture()
 {
-    return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
+    return AllocateEmptyObject(getLock(), &mHandleAllocator, &mObjectMap);
 }
 
 Texture *TextureManager::getTexture(GLuint handle) const
 {
-    ASSERT(GetObject(mObjectMap, 0) == nullptr);
-    return GetObject(mObjectMap, handle);
+    ASSERT(GetObject(getLock(), mObjectMap, 0) == nullptr);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 bool TextureManager::isTextureGenerated(GLuint texture) const
 {
-    return texture == 0 || mObjectMap.find(texture) != mObjectMap.end();
+    return texture == 0 || IsObjectGenerated(getLock(), mObjectMap, texture);
 }
 
 void TextureManager::invalidateTextureComplenessCache()
 {
+    // The caches of every texture are written, so no other thread may be looking one up.
+    angle::ScopedWriterLock writerLock(getLock());
     for (auto &texture : mObjectMap)
     {
         if (texture.second)
@@ -333,17 +369,17 @@ void RenderbufferManager::DeleteObject(Renderbuffer *renderbuffer)
 
 GLuint RenderbufferManager::createRenderbuffer()
 {
-    return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
+    return AllocateEmptyObject(getLock(), &mHandleAllocator, &mObjectMap);
 }
 
 Renderbuffer *RenderbufferManager::getRenderbuffer(GLuint handle)
 {
-    return GetObject(mObjectMap, handle);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 bool RenderbufferManager::isRenderbufferGenerated(GLuint renderbuffer) const
 {
-    return renderbuffer == 0 || mObjectMap.find(renderbuffer) != mObjectMap.end();
+    return renderbuffer == 0 || IsObjectGenerated(getLock(), mObjectMap, renderbuffer);
 }
 
 // SamplerManager Implementation.
@@ -364,17 +400,17 @@ void SamplerManager::DeleteObject(Sampler *sampler)
 
 GLuint SamplerManager::createSampler()
 {
-    return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
+    return AllocateEmptyObject(getLock(), &mHandleAllocator, &mObjectMap);
 }
 
 Sampler *SamplerManager::getSampler(GLuint handle)
 {
-    return GetObject(mObjectMap, handle);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 bool SamplerManager::isSampler(GLuint sampler)
 {
-    return mObjectMap.find(sampler) != mObjectMap.end();
+    return IsObjectGenerated(getLock(), mObjectMap, sampler);
 }
 
 // FenceSyncManager Implementation.
@@ -387,6 +423,7 @@ void FenceSyncManager::DeleteObject(FenceSync *fenceSync)
 
 GLuint FenceSyncManager::createFenceSync(rx::GLImplFactory *factory)
 {
+    angle::ScopedWriterLock writerLock(getLock());
     GLuint handle        = mHandleAllocator.allocate();
     FenceSync *fenceSync = new FenceSync(factory->createFenceSync(), handle);
     fenceSync->addRef();
@@ -396,13 +433,15 @@ GLuint FenceSyncManager::createFenceSync(rx::GLImplFactory *factory)
 
 FenceSync *FenceSyncManager::getFenceSync(GLuint handle)
 {
-    return GetObject(mObjectMap, handle);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 // PathManager Implementation.
 
 ErrorOrResult<GLuint> PathManager::createPaths(rx::GLImplFactory *factory, GLsizei range)
 {
+    angle::ScopedWriterLock writerLock(getLock());
+
     // Allocate client side handles.
     const GLuint client = mHandleAllocator.allocateRange(static_cast<GLuint>(range));
     if (client == HandleRangeAllocator::kInvalidHandle)
@@ -428,6 +467,7 @@ ErrorOrResult<GLuint> PathManager::createPaths(rx::GLImplFactory *factory, GLsiz
 
 void PathManager::deletePaths(GLuint first, GLsizei range)
 {
+    angle::ScopedWriterLock writerLock(getLock());
     for (GLsizei i = 0; i < range; ++i)
     {
         const auto id = first + i;
@@ -443,12 +483,14 @@ void PathManager::deletePaths(GLuint first, GLsizei range)
 
 Path *PathManager::getPath(GLuint handle) const
 {
+    angle::ScopedReaderLock readerLock(getLock());
     auto iter = mPaths.find(handle);
     return iter != mPaths.end() ? iter->second : nullptr;
 }
 
 bool PathManager::hasPath(GLuint handle) const
 {
+    angle::ScopedReaderLock readerLock(getLock());
     return mHandleAllocator.isUsed(handle);
 }
 
@@ -488,28 +530,30 @@ void FramebufferManager::DeleteObject(Framebuffer *framebuffer)
 
 GLuint FramebufferManager::createFramebuffer()
 {
-    return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
+    return AllocateEmptyObject(getLock(), &mHandleAllocator, &mObjectMap);
 }
 
 Framebuffer *FramebufferManager::getFramebuffer(GLuint handle) const
 {
-    return GetObject(mObjectMap, handle);
+    return GetObject(getLock(), mObjectMap, handle);
 }
 
 void FramebufferManager::setDefaultFramebuffer(Framebuffer *framebuffer)
 {
     ASSERT(framebuffer == nullptr || framebuffer->id() == 0);
+    angle::ScopedWriterLock writerLock(getLock());
     mObjectMap[0] = framebuffer;
 }
 
 bool FramebufferManager::isFramebufferGenerated(GLuint framebuffer)
 {
-    ASSERT(mObjectMap.find(0) != mObjectMap.end());
-    return mObjectMap.find(framebuffer) != mObjectMap.end();
+    ASSERT(IsObjectGenerated(getLock(), mObjectMap, 0));
+    return IsObjectGenerated(getLock(), mObjectMap, framebuffer);
 }
 
 void FramebufferManager::invalidateFramebufferComplenessCache()
 {
+    angle::ScopedReaderLock readerLock(getLock());
     for (auto &framebuffer : mObjectMap)
     {
         if (framebuffer.second)
@@ -11,6 +11,7 @@
 #define LIBANGLE_RESOURCEMANAGER_H_
 
 #include "angle_gl.h"
+#include "common/ReaderWriterLock.h"
 #include "common/angleutils.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/Error.h"
@@ -46,13 +47,33 @@ class ResourceManagerBase : angle::NonCopyable
     void addRef();
     void release(const Context *context);
 
+    // Only the managers of share groups created with EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE
+    // lock. Has to be called before the manager is used.
+    void enableLocking() { mLockingEnabled = true; }
+
   protected:
     virtual void reset(const Context *context) = 0;
     virtual ~ResourceManagerBase() {}
 
     HandleAllocatorType mHandleAllocator;
 
+    // With locking enabled, the contexts of a share group can be current on different threads.
+    // Lookups take the lock shared; creating and deleting objects takes it exclusively. Objects
+    // are destroyed after the lock is released, since that can release other objects of the same
+    // manager.
+    //
+    // The lock only covers the handle maps. The objects themselves aren't synchronized: their
+    // state, contents, completeness caches and observer lists may only be changed by one thread
+    // at a time, and only while no other thread uses them. As the GL spec requires, a context
+    // that modifies a shared object has to finish or fence the change, and the other contexts
+    // have to wait for that and rebind the object, before they use it.
+    //
+    // The scoped locks do nothing with the null lock returned when locking isn't enabled.
+    angle::ReaderWriterLock *getLock() const { return mLockingEnabled ? &mLock : nullptr; }
+
   private:
+    mutable angle::ReaderWriterLock mLock;
+    bool mLockingEnabled;
     size_t mRefCount;
 };
 
@@ -71,11 +92,14 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
     template <typename... ArgTypes>
     ResourceType *checkObjectAllocation(rx::GLImplFactory *factory, GLuint handle, ArgTypes... args)
     {
-        auto objectMapIter = mObjectMap.find(handle);
-
-        if (objectMapIter != mObjectMap.end() && objectMapIter->second != nullptr)
         {
-            return objectMapIter->second;
+            angle::ScopedReaderLock readerLock(this->getLock());
+            auto objectMapIter = mObjectMap.find(handle);
+
+            if (objectMapIter != mObjectMap.end() && objectMapIter->second != nullptr)
+            {
+                return objectMapIter->second;
+            }
         }
 
         if (handle == 0)
@@ -83,14 +107,11 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
             return nullptr;
         }
 
-        return allocateObject<ArgTypes...>(objectMapIter, factory, handle, args...);
+        return allocateObject<ArgTypes...>(factory, handle, args...);
     }
 
     template <typename... ArgTypes>
-    ResourceType *allocateObject(typename ResourceMap<ResourceType>::iterator &objectMapIter,
-                                 rx::GLImplFactory *factory,
-                                 GLuint handle,
-                                 ArgTypes... args);
+    ResourceType *allocateObject(rx::GLImplFactory *factory, GLuint handle, ArgTypes... args);
 
     void reset(const Context *context) override;
 
@@ -0,0 +1,298 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RobustResourceInit_unittest.cpp:
+//   Tests of the lazy robust resource initialization tracking of textures, renderbuffers and
+//   framebuffers. Runs a Context on the NULL back-end and counts the image clears it requests.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/null/ContextNULL.h"
+#include "libANGLE/renderer/null/RenderbufferNULL.h"
+#include "libANGLE/renderer/null/TextureNULL.h"
+#include "tests/test_utils/TestContextFactory.h"
+
+namespace
+{
+
+class CountingTextureNULL : public rx::TextureNULL
+{
+  public:
+    CountingTextureNULL(const gl::TextureState &state, size_t *initCount)
+        : rx::TextureNULL(state), mInitCount(initCount)
+    {
+    }
+
+    gl::Error initializeContents(const gl::Context *context,
+                                 const gl::ImageIndex &imageIndex) override
+    {
+        (*mInitCount)++;
+        return gl::NoError();
+    }
+
+  private:
+    size_t *mInitCount;
+};
+
+class CountingRenderbufferNULL : public rx::RenderbufferNULL
+{
+  public:
+    CountingRenderbufferNULL(size_t *initCount) : mInitCount(initCount) {}
+
+    gl::Error initializeContents(const gl::Context *context,
+                                 const gl::ImageIndex &imageIndex) override
+    {
+        (*mInitCount)++;
+        return gl::NoError();
+    }
+
+  private:
+    size_t *mInitCount;
+};
+
+class CountingContextNULL : public rx::ContextNULL
+{
+  public:
+    CountingContextNULL(const gl::ContextState &state,
+                        rx::AllocationTrackerNULL *allocationTracker,
+                        size_t *initCount)
+        : rx::ContextNULL(state, allocationTracker), mInitCount(initCount)
+    {
+    }
+
+    rx::TextureImpl *createTexture(const gl::TextureState &state) override
+    {
+        return new CountingTextureNULL(state, mInitCount);
+    }
+
+    rx::RenderbufferImpl *createRenderbuffer() override
+    {
+        return new CountingRenderbufferNULL(mInitCount);
+    }
+
+  private:
+    size_t *mInitCount;
+};
+
+class RobustResourceInitTest : public testing::Test
+{
+  protected:
+    RobustResourceInitTest()
+        : mAllocationTracker(1 << 28),
+          mInitCount(0),
+          mContextFactory([this](const gl::ContextState &state) {
+              return new CountingContextNULL(state, &mAllocationTracker, &mInitCount);
+          }),
+          mContext(nullptr)
+    {
+    }
+
+    void createContext(bool robustResourceInit)
+    {
+        egl::AttributeMap attribs;
+        attribs.insert(EGL_CONTEXT_CLIENT_VERSION, 3);
+        mContext = mContextFactory.createContext(attribs, nullptr, robustResourceInit);
+    }
+
+    GLuint createTexture2D(GLsizei size, const void *data)
+    {
+        GLuint texture = mContext->createTexture();
+        mContext->bindTexture(GL_TEXTURE_2D, texture);
+        mContext->texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA,
+                             GL_UNSIGNED_BYTE, data);
+        return texture;
+    }
+
+    void createFramebufferWithRenderbuffer(GLenum attachment, GLenum internalFormat, GLsizei size)
+    {
+        GLuint renderbuffer = mContext->createRenderbuffer();
+        mContext->bindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        mContext->renderbufferStorage(GL_RENDERBUFFER, internalFormat, size, size);
+
+        GLuint framebuffer = mContext->createFramebuffer();
+        mContext->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        mContext->framebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER,
+                                          renderbuffer);
+    }
+
+    rx::AllocationTrackerNULL mAllocationTracker;
+    size_t mInitCount;
+    angle::TestContextFactory mContextFactory;
+    gl::Context *mContext;
+};
+
+// Uploading to a texture overwrites the whole image, so no clear is needed.
+TEST_F(RobustResourceInitTest, TexImageWithDataSkipsClear)
+{
+    createContext(true);
+
+    std::vector<GLubyte> pixels(4 * 4 * 4, 0xFF);
+    createTexture2D(4, pixels.data());
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 1, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+
+    EXPECT_EQ(0u, mInitCount);
+    EXPECT_EQ(static_cast<GLenum>(GL_NO_ERROR), mContext->getError());
+}
+
+// A full-size sub-image update of an undefined image skips the clear.
+TEST_F(RobustResourceInitTest, FullTexSubImageSkipsClear)
+{
+    createContext(true);
+
+    std::vector<GLubyte> pixels(4 * 4 * 4, 0xFF);
+    createTexture2D(4, nullptr);
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 1, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+
+    EXPECT_EQ(0u, mInitCount);
+}
+
+// A partial sub-image update of an undefined image clears it once.
+TEST_F(RobustResourceInitTest, PartialTexSubImageClearsOnce)
+{
+    createContext(true);
+
+    std::vector<GLubyte> pixels(4 * 4 * 4, 0xFF);
+    createTexture2D(4, nullptr);
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 1, 1, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+
+    EXPECT_EQ(1u, mInitCount);
+}
+
+// Without robust resource initialization nothing is tracked or cleared.
+TEST_F(RobustResourceInitTest, DisabledNeverClears)
+{
+    createContext(false);
+
+    std::vector<GLubyte> pixels(4, 0xFF);
+    createTexture2D(4, nullptr);
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 1, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+
+    createFramebufferWithRenderbuffer(GL_COLOR_ATTACHMENT0, GL_RGBA8, 4);
+    mContext->drawArrays(GL_TRIANGLES, 0, 3);
+
+    EXPECT_EQ(0u, mInitCount);
+}
+
+// A full clear of a new renderbuffer replaces its initialization, so drawing afterwards does not
+// clear it again.
+TEST_F(RobustResourceInitTest, FullClearSkipsRenderbufferInit)
+{
+    createContext(true);
+    createFramebufferWithRenderbuffer(GL_COLOR_ATTACHMENT0, GL_RGBA8, 4);
+
+    mContext->clear(GL_COLOR_BUFFER_BIT);
+    mContext->drawArrays(GL_TRIANGLES, 0, 3);
+
+    EXPECT_EQ(0u, mInitCount);
+}
+
+// A scissored clear only writes part of the renderbuffer, so it has to be initialized first.
+TEST_F(RobustResourceInitTest, ScissoredClearInitializesRenderbuffer)
+{
+    createContext(true);
+    createFramebufferWithRenderbuffer(GL_COLOR_ATTACHMENT0, GL_RGBA8, 4);
+
+    mContext->enable(GL_SCISSOR_TEST);
+    mContext->scissor(0, 0, 2, 2);
+    mContext->clear(GL_COLOR_BUFFER_BIT);
+    mContext->clear(GL_COLOR_BUFFER_BIT);
+
+    EXPECT_EQ(1u, mInitCount);
+}
+
+// Clearing only the depth of a packed depth/stencil buffer leaves the stencil undefined.
+TEST_F(RobustResourceInitTest, DepthOnlyClearInitializesDepthStencil)
+{
+    createContext(true);
+    createFramebufferWithRenderbuffer(GL_DEPTH_STENCIL_ATTACHMENT, GL_DEPTH24_STENCIL8, 4);
+
+    mContext->clear(GL_DEPTH_BUFFER_BIT);
+    EXPECT_EQ(1u, mInitCount);
+
+    mContext->clear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    EXPECT_EQ(1u, mInitCount);
+}
+
+// Drawing to or reading from an undefined attachment initializes it the first time only.
+TEST_F(RobustResourceInitTest, DrawAndReadInitializeOnce)
+{
+    createContext(true);
+
+    GLuint texture = createTexture2D(4, nullptr);
+    GLuint framebuffer = mContext->createFramebuffer();
+    mContext->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    mContext->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture,
+                                   0);
+
+    mContext->drawArrays(GL_TRIANGLES, 0, 3);
+    mContext->drawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_EQ(1u, mInitCount);
+
+    createFramebufferWithRenderbuffer(GL_COLOR_ATTACHMENT0, GL_RGBA8, 4);
+    std::vector<GLubyte> pixels(4 * 4 * 4);
+    mContext->readPixels(0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    mContext->readPixels(0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    EXPECT_EQ(2u, mInitCount);
+}
+
+// Clearing one layer of a 2D array texture leaves the other layers undefined, so the clear
+// initializes the whole level and reading another layer doesn't clear it again.
+TEST_F(RobustResourceInitTest, LayerClearInitializesArrayLevel)
+{
+    createContext(true);
+
+    GLuint texture = mContext->createTexture();
+    mContext->bindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    mContext->texImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, 4, 4, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         nullptr);
+
+    GLuint framebuffer = mContext->createFramebuffer();
+    mContext->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    mContext->framebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 0);
+    mContext->clear(GL_COLOR_BUFFER_BIT);
+    EXPECT_EQ(1u, mInitCount);
+
+    mContext->framebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 1);
+    std::vector<GLubyte> pixels(4 * 4 * 4);
+    mContext->readPixels(0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    EXPECT_EQ(1u, mInitCount);
+}
+
+// Storage-allocated levels are tracked individually.
+TEST_F(RobustResourceInitTest, TexStoragePerLevelTracking)
+{
+    createContext(true);
+
+    GLuint texture = mContext->createTexture();
+    mContext->bindTexture(GL_TEXTURE_2D, texture);
+    gl::Texture *textureObject = mContext->getTexture(texture);
+    ASSERT_FALSE(
+        textureObject->setStorage(mContext, GL_TEXTURE_2D, 3, GL_RGBA8, gl::Extents(4, 4, 1))
+            .isError());
+
+    std::vector<GLubyte> pixels(4 * 4 * 4, 0xFF);
+    mContext->texSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+    mContext->texSubImage2D(GL_TEXTURE_2D, 1, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            pixels.data());
+    EXPECT_EQ(1u, mInitCount);
+
+    // Sampling the whole texture only clears the level that is still undefined.
+    ASSERT_FALSE(textureObject->ensureInitialized(mContext).isError());
+    EXPECT_EQ(2u, mInitCount);
+    ASSERT_FALSE(textureObject->ensureInitialized(mContext).isError());
+    EXPECT_EQ(2u, mInitCount);
+}
+
+}  // anonymous namespace
@@ -68,6 +68,7 @@ class Sampler final : public RefCountObject, public LabeledObject
     GLenum getSRGBDecode() const;
 
     const SamplerState &getSamplerState() const;
+    SamplerStateSerial getSamplerStateSerial() const;
 
     rx::SamplerImpl *getImplementation() const;
 
@@ -77,6 +78,7 @@ class Sampler final : public RefCountObject, public LabeledObject
     std::string mLabel;
 
     SamplerState mSamplerState;
+    SamplerStateSerial mSamplerStateSerial;
 };
 
 }
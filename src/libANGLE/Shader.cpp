@@ -12,21 +12,42 @@
 
 #include <sstream>
 
+#include "common/event_tracer.h"
 #include "common/utilities.h"
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Context.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace gl
 {
 
 namespace
 {
+
+// Reports the translator stages of the last compile as trace events spanning the time each stage
+// ran. |compileStartTime| is the time of the trace clock at which the compile started.
+void TraceCompileStatistics(ShHandle compilerHandle,
+                            const unsigned char *categoryEnabled,
+                            double compileStartTime)
+{
+    const char *argNames[]         = {"poolBytes", "poolAllocations"};
+    const unsigned char argTypes[] = {TRACE_VALUE_TYPE_UINT, TRACE_VALUE_TYPE_UINT};
+
+    for (const ShCompileStageStatistics &stage : sh::GetCompileStatistics(compilerHandle))
+    {
+        const unsigned long long argValues[] = {stage.poolBytes, stage.poolAllocations};
+        angle::AddTraceSpan(categoryEnabled, stage.name, compileStartTime + stage.startSeconds,
+                            stage.seconds, 2, argNames, argTypes, argValues);
+    }
+}
+
 template <typename VarT>
 std::vector<VarT> GetActiveShaderVariables(const std::vector<VarT> *variableList)
 {
@@ -230,6 +251,8 @@ void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length,
 
 void Shader::compile(const Context *context)
 {
+    TRACE_EVENT0("gpu.angle", "Shader::compile");
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.ShaderCompileMS");
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
@@ -266,6 +289,14 @@ void Shader::compile(const Context *context)
         compileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
 
+    // Break down the translation cost per stage whenever ANGLE is being traced.
+    const unsigned char *traceCategoryEnabled = TRACE_EVENT_API_GET_CATEGORY_ENABLED("gpu.angle");
+    bool traceCompileStages                   = *traceCategoryEnabled != 0;
+    if (traceCompileStages)
+    {
+        compileOptions |= SH_COLLECT_COMPILE_STATISTICS;
+    }
+
     std::string sourceString  = sourceStream.str();
     std::vector<const char *> sourceCStrings;
 
@@ -276,9 +307,16 @@ void Shader::compile(const Context *context)
 
     sourceCStrings.push_back(sourceString.c_str());
 
+    double compileStartTime =
+        traceCompileStages ? angle::GetTraceTimestamp(traceCategoryEnabled) : 0.0;
     bool result =
         sh::Compile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(), compileOptions);
 
+    if (traceCompileStages)
+    {
+        TraceCompileStatistics(compilerHandle, traceCategoryEnabled, compileStartTime);
+    }
+
     if (!result)
     {
         mInfoLog = sh::GetInfoLog(compilerHandle);
@@ -59,6 +59,7 @@ State::State()
       mProgram(nullptr),
       mVertexArray(nullptr),
       mActiveSampler(0),
+      mZeroTextureFactory(nullptr),
       mPrimitiveRestart(false),
       mMultiSampling(false),
       mSampleAlphaToOne(false),
@@ -79,6 +80,9 @@ void State::initialize(const Caps &caps,
                        bool clientArraysEnabled,
                        bool robustResourceInit)
 {
+    ASSERT(caps.maxCombinedTextureImageUnits <= IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
+    ASSERT(caps.maxUniformBufferBindings <= IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS);
+
     mMaxDrawBuffers = caps.maxDrawBuffers;
     mMaxCombinedTextureImageUnits = caps.maxCombinedTextureImageUnits;
 
@@ -152,6 +156,14 @@ void State::initialize(const Caps &caps,
 
     mSamplers.resize(caps.maxCombinedTextureImageUnits);
 
+    mCompletenessTextureTypes.resize(caps.maxCombinedTextureImageUnits, GL_NONE);
+    mCompletenessTextureBindings.reserve(caps.maxCombinedTextureImageUnits);
+    for (uint32_t textureUnit = 0; textureUnit < caps.maxCombinedTextureImageUnits; ++textureUnit)
+    {
+        mCompletenessTextureBindings.emplace_back(this, textureUnit);
+    }
+    mDirtyTextureCompleteness.set();
+
     mActiveQueries[GL_ANY_SAMPLES_PASSED].set(nullptr);
     mActiveQueries[GL_ANY_SAMPLES_PASSED_CONSERVATIVE].set(nullptr);
     mActiveQueries[GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN].set(nullptr);
@@ -187,6 +199,12 @@ void State::initialize(const Caps &caps,
 
 void State::reset(const Context *context)
 {
+    for (auto &binding : mCompletenessTextureBindings)
+    {
+        binding.reset();
+    }
+    mDirtyTextureCompleteness.set();
+
     for (TextureBindingMap::iterator bindingVec = mSamplerTextures.begin(); bindingVec != mSamplerTextures.end(); bindingVec++)
     {
         TextureBindingVector &textureVector = bindingVec->second;
@@ -195,6 +213,11 @@ void State::reset(const Context *context)
             textureVector[textureIdx].set(nullptr);
         }
     }
+    for (auto &zeroTexture : mZeroTextures)
+    {
+        zeroTexture.second.set(nullptr);
+    }
+    mZeroTextures.clear();
     for (size_t samplerIdx = 0; samplerIdx < mSamplers.size(); samplerIdx++)
     {
         mSamplers[samplerIdx].set(nullptr);
@@ -741,6 +764,9 @@ unsigned int State::getActiveSampler() const
 void State::setSamplerTexture(GLenum type, Texture *texture)
 {
     mSamplerTextures[type][mActiveSampler].set(texture);
+    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mDirtyTextureBindings.set(mActiveSampler);
+    mDirtyTextureCompleteness.set(mActiveSampler);
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -753,7 +779,8 @@ Texture *State::getSamplerTexture(unsigned int sampler, GLenum type) const
     const auto it = mSamplerTextures.find(type);
     ASSERT(it != mSamplerTextures.end());
     ASSERT(sampler < it->second.size());
-    return it->second[sampler].get();
+    Texture *texture = it->second[sampler].get();
+    return texture ? texture : getZeroTexture(type);
 }
 
 GLuint State::getSamplerTextureId(unsigned int sampler, GLenum type) const
@@ -764,7 +791,7 @@ GLuint State::getSamplerTextureId(unsigned int sampler, GLenum type) const
     return it->second[sampler].id();
 }
 
-void State::detachTexture(const Context *context, const TextureMap &zeroTextures, GLuint texture)
+void State::detachTexture(const Context *context, GLuint texture)
 {
     // Textures have a detach method on State rather than a simple
     // removeBinding, because the zero/null texture objects are managed
@@ -777,17 +804,17 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
 
     for (auto &bindingVec : mSamplerTextures)
     {
-        GLenum textureType = bindingVec.first;
         TextureBindingVector &textureVector = bindingVec.second;
         for (size_t textureIdx = 0; textureIdx < textureVector.size(); textureIdx++)
         {
             BindingPointer<Texture> &binding = textureVector[textureIdx];
             if (binding.id() == texture)
             {
-                auto it = zeroTextures.find(textureType);
-                ASSERT(it != zeroTextures.end());
-                // Zero textures are the "default" textures instead of NULL
-                binding.set(it->second.get());
+                // An empty binding samples the zero texture
+                binding.set(nullptr);
+                mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+                mDirtyTextureBindings.set(textureIdx);
+                mDirtyTextureCompleteness.set(textureIdx);
             }
         }
     }
@@ -808,22 +835,54 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
     }
 }
 
-void State::initializeZeroTextures(const TextureMap &zeroTextures)
+void State::setZeroTextureFactory(rx::GLImplFactory *factory)
 {
-    for (const auto &zeroTexture : zeroTextures)
+    mZeroTextureFactory = factory;
+}
+
+void State::invalidateZeroTextureCompletenessCaches()
+{
+    for (auto &zeroTexture : mZeroTextures)
     {
-        auto &samplerTextureArray = mSamplerTextures[zeroTexture.first];
+        zeroTexture.second->invalidateCompletenessCache();
+    }
+}
 
-        for (size_t textureUnit = 0; textureUnit < samplerTextureArray.size(); ++textureUnit)
-        {
-            samplerTextureArray[textureUnit].set(zeroTexture.second.get());
-        }
+Texture *State::getZeroTexture(GLenum type) const
+{
+    // [OpenGL ES 2.0.24] section 3.7 page 83:
+    // In the initial state, TEXTURE_2D and TEXTURE_CUBE_MAP have twodimensional
+    // and cube map texture state vectors respectively associated with them.
+    // In order that access to these initial textures not be lost, they are treated as texture
+    // objects all of whose names are 0.
+    BindingPointer<Texture> &zeroTexture = mZeroTextures[type];
+    if (zeroTexture.get() == nullptr)
+    {
+        ASSERT(mZeroTextureFactory != nullptr);
+        zeroTexture.set(new Texture(mZeroTextureFactory, 0, type));
     }
+    return zeroTexture.get();
 }
 
 void State::setSamplerBinding(GLuint textureUnit, Sampler *sampler)
 {
     mSamplers[textureUnit].set(sampler);
+    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+    mDirtySamplerBindings.set(textureUnit);
+    mDirtyTextureCompleteness.set(textureUnit);
+}
+
+void State::setSamplerDirty(GLuint sampler)
+{
+    for (size_t textureUnit = 0; textureUnit < mSamplers.size(); textureUnit++)
+    {
+        if (mSamplers[textureUnit].id() == sampler)
+        {
+            mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+            mDirtySamplerBindings.set(textureUnit);
+            mDirtyTextureCompleteness.set(textureUnit);
+        }
+    }
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -849,6 +908,9 @@ void State::detachSampler(GLuint sampler)
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(nullptr);
+            mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+            mDirtySamplerBindings.set(textureUnit);
+            mDirtyTextureCompleteness.set(textureUnit);
         }
     }
 }
@@ -1173,6 +1235,8 @@ void State::setGenericUniformBufferBinding(Buffer *buffer)
 void State::setIndexedUniformBufferBinding(GLuint index, Buffer *buffer, GLintptr offset, GLsizeiptr size)
 {
     mUniformBuffers[index].set(buffer, offset, size);
+    mDirtyBits.set(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
+    mDirtyUniformBufferBindings.set(index);
 }
 
 const OffsetBindingPointer<Buffer> &State::getIndexedUniformBuffer(size_t index) const
@@ -2070,6 +2134,66 @@ bool State::hasMappedBuffer(GLenum target) const
     }
 }
 
+Error State::clearUnclearedActiveTextures(const Context *context)
+{
+    ASSERT(mRobustResourceInit);
+
+    if (!mProgram)
+    {
+        return NoError();
+    }
+
+    for (const SamplerBinding &samplerBinding : mProgram->getSamplerBindings())
+    {
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
+        {
+            Texture *texture = getSamplerTexture(textureUnit, samplerBinding.textureType);
+            if (texture)
+            {
+                ANGLE_TRY(texture->ensureInitialized(context));
+            }
+        }
+    }
+
+    return NoError();
+}
+
+void State::syncActiveTextureCompleteness(const Context *context)
+{
+    if (!mProgram)
+    {
+        return;
+    }
+
+    for (const SamplerBinding &samplerBinding : mProgram->getSamplerBindings())
+    {
+        GLenum textureType = samplerBinding.textureType;
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
+        {
+            if (!mDirtyTextureCompleteness[textureUnit] &&
+                mCompletenessTextureTypes[textureUnit] == textureType)
+            {
+                continue;
+            }
+
+            Texture *texture = getSamplerTexture(textureUnit, textureType);
+            ASSERT(texture);
+
+            mCompleteTextureUnits[textureUnit] = texture->getTextureState().isSamplerComplete(
+                mSamplers[textureUnit].get(), context->getContextState());
+            mCompletenessTextureBindings[textureUnit].bind(texture->getDirtyChannel());
+            mCompletenessTextureTypes[textureUnit] = textureType;
+            mDirtyTextureCompleteness.reset(textureUnit);
+        }
+    }
+}
+
+void State::signal(uint32_t textureUnit)
+{
+    // The texture's images or parameters changed, which may change its completeness.
+    mDirtyTextureCompleteness.set(textureUnit);
+}
+
 void State::syncDirtyObjects(const Context *context)
 {
     if (!mDirtyObjects.any())
@@ -2135,6 +2259,39 @@ void State::syncDirtyObject(const Context *context, GLenum target)
     syncDirtyObjects(context, localSet);
 }
 
+void State::clearDirtyBits()
+{
+    mDirtyBits.reset();
+    mDirtyTextureBindings.reset();
+    mDirtySamplerBindings.reset();
+    mDirtyUniformBufferBindings.reset();
+}
+
+void State::clearDirtyBits(const DirtyBits &bitset)
+{
+    mDirtyBits &= ~bitset;
+    if (bitset[DIRTY_BIT_TEXTURE_BINDINGS])
+    {
+        mDirtyTextureBindings.reset();
+    }
+    if (bitset[DIRTY_BIT_SAMPLER_BINDINGS])
+    {
+        mDirtySamplerBindings.reset();
+    }
+    if (bitset[DIRTY_BIT_UNIFORM_BUFFER_BINDINGS])
+    {
+        mDirtyUniformBufferBindings.reset();
+    }
+}
+
+void State::setAllDirtyBits()
+{
+    mDirtyBits.set();
+    mDirtyTextureBindings.set();
+    mDirtySamplerBindings.set();
+    mDirtyUniformBufferBindings.set();
+}
+
 void State::setObjectDirty(GLenum target)
 {
     switch (target)
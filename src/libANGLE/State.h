@@ -25,6 +25,7 @@
 #include "libANGLE/Version.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/angletypes.h"
+#include "libANGLE/signal_utils.h"
 
 namespace gl
 {
@@ -35,11 +36,11 @@ struct Caps;
 
 typedef std::map<GLenum, BindingPointer<Texture>> TextureMap;
 
-class State : angle::NonCopyable
+class State : public angle::SignalReceiver<>, angle::NonCopyable
 {
   public:
     State();
-    ~State();
+    ~State() override;
 
     void initialize(const Caps &caps,
                     const Extensions &extensions,
@@ -173,8 +174,9 @@ class State : angle::NonCopyable
     Texture *getTargetTexture(GLenum target) const;
     Texture *getSamplerTexture(unsigned int sampler, GLenum type) const;
     GLuint getSamplerTextureId(unsigned int sampler, GLenum type) const;
-    void detachTexture(const Context *context, const TextureMap &zeroTextures, GLuint texture);
-    void initializeZeroTextures(const TextureMap &zeroTextures);
+    void detachTexture(const Context *context, GLuint texture);
+    void setZeroTextureFactory(rx::GLImplFactory *factory);
+    void invalidateZeroTextureCompletenessCaches();
 
     // Sampler object binding manipulation
     void setSamplerBinding(GLuint textureUnit, Sampler *sampler);
@@ -415,6 +417,9 @@ class State : angle::NonCopyable
         DIRTY_BIT_VERTEX_ARRAY_BINDING,
         DIRTY_BIT_DRAW_INDIRECT_BUFFER_BINDING,
         DIRTY_BIT_PROGRAM_BINDING,
+        DIRTY_BIT_TEXTURE_BINDINGS,
+        DIRTY_BIT_SAMPLER_BINDINGS,
+        DIRTY_BIT_UNIFORM_BUFFER_BINDINGS,
         DIRTY_BIT_MULTISAMPLING,
         DIRTY_BIT_SAMPLE_ALPHA_TO_ONE,
         DIRTY_BIT_COVERAGE_MODULATION,         // CHROMIUM_framebuffer_mixed_samples
@@ -441,9 +446,20 @@ class State : angle::NonCopyable
 
     typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
-    void clearDirtyBits() { mDirtyBits.reset(); }
-    void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
-    void setAllDirtyBits() { mDirtyBits.set(); }
+    void clearDirtyBits();
+    void clearDirtyBits(const DirtyBits &bitset);
+    void setAllDirtyBits();
+
+    // The texture units and uniform buffer binding points behind the binding dirty bits above.
+    const ActiveTextureMask &getDirtyTextureBindings() const { return mDirtyTextureBindings; }
+    const ActiveTextureMask &getDirtySamplerBindings() const { return mDirtySamplerBindings; }
+    const UniformBufferBindingMask &getDirtyUniformBufferBindings() const
+    {
+        return mDirtyUniformBufferBindings;
+    }
+
+    // Marks the texture units the sampler is bound to as dirty after its parameters changed.
+    void setSamplerDirty(GLuint sampler);
 
     typedef angle::BitSet<DIRTY_OBJECT_MAX> DirtyObjects;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
@@ -453,6 +469,20 @@ class State : angle::NonCopyable
     void syncDirtyObject(const Context *context, GLenum target);
     void setObjectDirty(GLenum target);
 
+    // Robust resource initialization: zero the images of textures the current program samples.
+    Error clearUnclearedActiveTextures(const Context *context);
+
+    // Brings the completeness of the texture units the current program samples up to date. Only
+    // the units whose texture, sampler or binding changed since the last call are checked again.
+    void syncActiveTextureCompleteness(const Context *context);
+    const ActiveTextureMask &getCompleteActiveTextureUnits() const
+    {
+        return mCompleteTextureUnits;
+    }
+
+    // angle::SignalReceiver implementation, for the textures sampled by the program.
+    void signal(uint32_t textureUnit) override;
+
   private:
     // Cached values from Context's caps
     GLuint mMaxDrawBuffers;
@@ -506,9 +536,23 @@ class State : angle::NonCopyable
     typedef std::map<GLenum, TextureBindingVector> TextureBindingMap;
     TextureBindingMap mSamplerTextures;
 
+    // The texture objects named zero. A unit without a binding samples the zero texture of the
+    // target, which is only created once it is first needed.
+    Texture *getZeroTexture(GLenum type) const;
+    rx::GLImplFactory *mZeroTextureFactory;
+    mutable TextureMap mZeroTextures;
+
     typedef std::vector<BindingPointer<Sampler>> SamplerBindingVector;
     SamplerBindingVector mSamplers;
 
+    // Sampler completeness of the texture units, valid for the units that are not dirty and
+    // whose texture type matches the one the program samples them with. Each unit listens to the
+    // dirty channel of the texture last checked on it.
+    ActiveTextureMask mCompleteTextureUnits;
+    ActiveTextureMask mDirtyTextureCompleteness;
+    std::vector<GLenum> mCompletenessTextureTypes;
+    std::vector<angle::ChannelBinding<>> mCompletenessTextureBindings;
+
     typedef std::map<GLenum, BindingPointer<Query>> ActiveQueryMap;
     ActiveQueryMap mActiveQueries;
 
@@ -553,6 +597,9 @@ class State : angle::NonCopyable
     bool mRobustResourceInit;
 
     DirtyBits mDirtyBits;
+    ActiveTextureMask mDirtyTextureBindings;
+    ActiveTextureMask mDirtySamplerBindings;
+    UniformBufferBindingMask mDirtyUniformBufferBindings;
     DirtyObjects mDirtyObjects;
 };
 
@@ -20,6 +20,7 @@
 #include "libANGLE/Texture.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace egl
 {
@@ -149,6 +150,7 @@ EGLint Surface::getType() const
 
 Error Surface::swap(const Display &display)
 {
+    TRACE_EVENT0("gpu.angle", "egl::Surface::swap");
     return mImplementation->swap(&display);
 }
 
@@ -96,6 +96,15 @@ class Surface : public gl::FramebufferAttachmentObject
     void onDetach() override {}
     GLuint getId() const override;
 
+    // Surfaces are initialized by the back-end when they are created.
+    gl::InitState initState(const gl::ImageIndex & /*imageIndex*/) const override
+    {
+        return gl::InitState::Initialized;
+    }
+    void setInitState(const gl::ImageIndex & /*imageIndex*/, gl::InitState /*initState*/) override
+    {
+    }
+
     bool flexibleSurfaceCompatibilityRequested() const
     {
         return mFlexibleSurfaceCompatibilityRequested;
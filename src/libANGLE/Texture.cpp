@@ -14,8 +14,10 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/Sampler.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/TextureImpl.h"
 
@@ -36,6 +38,47 @@ size_t GetImageDescIndex(GLenum target, size_t level)
     return IsCubeMapTextureTarget(target) ? ((level * 6) + CubeMapTextureTargetToLayerIndex(target))
                                           : level;
 }
+
+ImageIndex GetImageIndexFromDescIndex(GLenum target, size_t descIndex)
+{
+    if (target == GL_TEXTURE_CUBE_MAP)
+    {
+        GLenum faceTarget = static_cast<GLenum>(FirstCubeMapTextureTarget + (descIndex % 6));
+        return ImageIndex::MakeCube(faceTarget, static_cast<GLint>(descIndex / 6));
+    }
+    return ImageIndex::MakeGeneric(target, static_cast<GLint>(descIndex));
+}
+
+InitState DetermineImageInitState(const Context *context, const uint8_t *pixels)
+{
+    // An upload from a pixel unpack buffer defines the whole image, even at offset zero.
+    if (pixels || (context && context->getGLState().getUnpackState().pixelBuffer.get()))
+    {
+        return InitState::Initialized;
+    }
+    return DetermineInitState(context);
+}
+
+// Records the throughput of an upload of client data, from the size the data has without any row
+// or image padding.
+void RecordUploadThroughput(const PixelUnpackState &unpackState,
+                            const uint8_t *pixels,
+                            GLenum format,
+                            GLenum type,
+                            const Extents &size,
+                            double startTime)
+{
+    if (pixels == nullptr && unpackState.pixelBuffer.get() == nullptr)
+    {
+        return;
+    }
+
+    const InternalFormat &formatInfo = GetInternalFormatInfo(format, type);
+    uint64_t bytes = static_cast<uint64_t>(formatInfo.pixelBytes) * size.width * size.height *
+                     size.depth;
+    ANGLE_HISTOGRAM_THROUGHPUT("GPU.ANGLE.TexImageUploadKBPerSecond", bytes,
+                               angle::HistogramCurrentTime() - startTime);
+}
 }  // namespace
 
 bool IsMipmapFiltered(const SamplerState &samplerState)
@@ -90,6 +133,7 @@ TextureState::TextureState(GLenum target)
     : mTarget(target),
       mSwizzleState(GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA),
       mSamplerState(SamplerState::CreateDefaultForTarget(target)),
+      mSamplerStateSerial(GenerateSamplerStateSerial()),
       mBaseLevel(0),
       mMaxLevel(1000),
       mDepthStencilTextureMode(GL_DEPTH_COMPONENT),
@@ -98,7 +142,10 @@ TextureState::TextureState(GLenum target)
       mUsage(GL_NONE),
       mImageDescs((IMPLEMENTATION_MAX_TEXTURE_LEVELS + 1) *
                   (target == GL_TEXTURE_CUBE_MAP ? 6 : 1)),
-      mCompletenessCache()
+      mInitState(InitState::Initialized),
+      mCompletenessCache(),
+      mNextCompletenessCacheEntry(0),
+      mCompletenessSerial(0)
 {
 }
 
@@ -197,33 +244,36 @@ bool TextureState::isCubeComplete() const
     return true;
 }
 
-bool TextureState::isSamplerComplete(const SamplerState &samplerState,
-                                     const ContextState &data) const
+bool TextureState::isSamplerComplete(const Sampler *sampler, const ContextState &data) const
 {
-    bool newEntry  = false;
-    auto cacheIter = mCompletenessCache.find(data.getContextID());
-    if (cacheIter == mCompletenessCache.end())
-    {
-        // Add a new cache entry
-        cacheIter = mCompletenessCache
-                        .insert(std::make_pair(data.getContextID(), SamplerCompletenessCache()))
-                        .first;
-        newEntry = true;
-    }
+    const SamplerState &samplerState = sampler ? sampler->getSamplerState() : mSamplerState;
+    SamplerStateSerial samplerStateSerial =
+        sampler ? sampler->getSamplerStateSerial() : mSamplerStateSerial;
 
-    SamplerCompletenessCache *cacheEntry = &cacheIter->second;
-    if (newEntry || cacheEntry->samplerState != samplerState)
+    for (const SamplerCompletenessCache &cacheEntry : mCompletenessCache)
     {
-        cacheEntry->samplerState    = samplerState;
-        cacheEntry->samplerComplete = computeSamplerCompleteness(samplerState, data);
+        if (cacheEntry.samplerStateSerial == samplerStateSerial &&
+            cacheEntry.context == data.getContextID() &&
+            cacheEntry.completenessSerial == mCompletenessSerial)
+        {
+            return cacheEntry.samplerComplete;
+        }
     }
 
-    return cacheEntry->samplerComplete;
+    SamplerCompletenessCache &cacheEntry = mCompletenessCache[mNextCompletenessCacheEntry];
+    mNextCompletenessCacheEntry = (mNextCompletenessCacheEntry + 1) % kCompletenessCacheSize;
+
+    cacheEntry.context            = data.getContextID();
+    cacheEntry.samplerStateSerial = samplerStateSerial;
+    cacheEntry.completenessSerial = mCompletenessSerial;
+    cacheEntry.samplerComplete    = computeSamplerCompleteness(samplerState, data);
+    return cacheEntry.samplerComplete;
 }
 
 void TextureState::invalidateCompletenessCache()
 {
-    mCompletenessCache.clear();
+    // Entries stamped with an older serial are never matched again.
+    mCompletenessSerial++;
 }
 
 bool TextureState::computeSamplerCompleteness(const SamplerState &samplerState,
@@ -423,20 +473,26 @@ GLenum TextureState::getBaseImageTarget() const
     return mTarget == GL_TEXTURE_CUBE_MAP ? FirstCubeMapTextureTarget : mTarget;
 }
 
-ImageDesc::ImageDesc() : ImageDesc(Extents(0, 0, 0), Format::Invalid(), 0, GL_TRUE)
+ImageDesc::ImageDesc()
+    : ImageDesc(Extents(0, 0, 0), Format::Invalid(), 0, GL_TRUE, InitState::Initialized)
 {
 }
 
-ImageDesc::ImageDesc(const Extents &size, const Format &format)
-    : size(size), format(format), samples(0), fixedSampleLocations(GL_TRUE)
+ImageDesc::ImageDesc(const Extents &size, const Format &format, const InitState initState)
+    : size(size), format(format), samples(0), fixedSampleLocations(GL_TRUE), initState(initState)
 {
 }
 
 ImageDesc::ImageDesc(const Extents &size,
                      const Format &format,
                      const GLsizei samples,
-                     const GLboolean fixedSampleLocations)
-    : size(size), format(format), samples(samples), fixedSampleLocations(fixedSampleLocations)
+                     const GLboolean fixedSampleLocations,
+                     const InitState initState)
+    : size(size),
+      format(format),
+      samples(samples),
+      fixedSampleLocations(fixedSampleLocations),
+      initState(initState)
 {
 }
 
@@ -452,6 +508,10 @@ void TextureState::setImageDesc(GLenum target, size_t level, const ImageDesc &de
     size_t descIndex = GetImageDescIndex(target, level);
     ASSERT(descIndex < mImageDescs.size());
     mImageDescs[descIndex] = desc;
+    if (desc.initState == InitState::MayNeedInit)
+    {
+        mInitState = InitState::MayNeedInit;
+    }
     invalidateCompletenessCache();
 }
 
@@ -463,7 +523,8 @@ const ImageDesc &TextureState::getImageDesc(const ImageIndex &imageIndex) const
 void TextureState::setImageDescChain(GLuint baseLevel,
                                      GLuint maxLevel,
                                      Extents baseSize,
-                                     const Format &format)
+                                     const Format &format,
+                                     InitState initState)
 {
     for (GLuint level = baseLevel; level <= maxLevel; level++)
     {
@@ -473,7 +534,7 @@ void TextureState::setImageDescChain(GLuint baseLevel,
                           (mTarget == GL_TEXTURE_2D_ARRAY)
                               ? baseSize.depth
                               : std::max<int>(baseSize.depth >> relativeLevel, 1));
-        ImageDesc levelInfo(levelSize, format);
+        ImageDesc levelInfo(levelSize, format, initState);
 
         if (mTarget == GL_TEXTURE_CUBE_MAP)
         {
@@ -492,10 +553,11 @@ void TextureState::setImageDescChain(GLuint baseLevel,
 void TextureState::setImageDescChainMultisample(Extents baseSize,
                                                 const Format &format,
                                                 GLsizei samples,
-                                                GLboolean fixedSampleLocations)
+                                                GLboolean fixedSampleLocations,
+                                                InitState initState)
 {
     ASSERT(mTarget == GL_TEXTURE_2D_MULTISAMPLE);
-    ImageDesc levelInfo(baseSize, format, samples, fixedSampleLocations);
+    ImageDesc levelInfo(baseSize, format, samples, fixedSampleLocations, initState);
     setImageDesc(mTarget, 0, levelInfo);
 }
 
@@ -510,11 +572,12 @@ void TextureState::clearImageDescs()
     {
         mImageDescs[descIndex] = ImageDesc();
     }
+    mInitState = InitState::Initialized;
     invalidateCompletenessCache();
 }
 
 TextureState::SamplerCompletenessCache::SamplerCompletenessCache()
-    : samplerState(), samplerComplete(false)
+    : context(0), samplerStateSerial(0), completenessSerial(0), samplerComplete(false)
 {
 }
 
@@ -524,7 +587,8 @@ Texture::Texture(rx::GLImplFactory *factory, GLuint id, GLenum target)
       mTexture(factory->createTexture(mState)),
       mLabel(),
       mBoundSurface(nullptr),
-      mBoundStream(nullptr)
+      mBoundStream(nullptr),
+      mMemoryCharge(MemoryCategory::Texture)
 {
 }
 
@@ -607,6 +671,7 @@ void Texture::setMinFilter(GLenum minFilter)
 {
     mState.mSamplerState.minFilter = minFilter;
     mDirtyBits.set(DIRTY_BIT_MIN_FILTER);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getMinFilter() const
@@ -618,6 +683,7 @@ void Texture::setMagFilter(GLenum magFilter)
 {
     mState.mSamplerState.magFilter = magFilter;
     mDirtyBits.set(DIRTY_BIT_MAG_FILTER);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getMagFilter() const
@@ -629,6 +695,7 @@ void Texture::setWrapS(GLenum wrapS)
 {
     mState.mSamplerState.wrapS = wrapS;
     mDirtyBits.set(DIRTY_BIT_WRAP_S);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getWrapS() const
@@ -640,6 +707,7 @@ void Texture::setWrapT(GLenum wrapT)
 {
     mState.mSamplerState.wrapT = wrapT;
     mDirtyBits.set(DIRTY_BIT_WRAP_T);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getWrapT() const
@@ -651,6 +719,7 @@ void Texture::setWrapR(GLenum wrapR)
 {
     mState.mSamplerState.wrapR = wrapR;
     mDirtyBits.set(DIRTY_BIT_WRAP_R);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getWrapR() const
@@ -662,6 +731,7 @@ void Texture::setMaxAnisotropy(float maxAnisotropy)
 {
     mState.mSamplerState.maxAnisotropy = maxAnisotropy;
     mDirtyBits.set(DIRTY_BIT_MAX_ANISOTROPY);
+    onSamplerStateChange();
 }
 
 float Texture::getMaxAnisotropy() const
@@ -673,6 +743,7 @@ void Texture::setMinLod(GLfloat minLod)
 {
     mState.mSamplerState.minLod = minLod;
     mDirtyBits.set(DIRTY_BIT_MIN_LOD);
+    onSamplerStateChange();
 }
 
 GLfloat Texture::getMinLod() const
@@ -684,6 +755,7 @@ void Texture::setMaxLod(GLfloat maxLod)
 {
     mState.mSamplerState.maxLod = maxLod;
     mDirtyBits.set(DIRTY_BIT_MAX_LOD);
+    onSamplerStateChange();
 }
 
 GLfloat Texture::getMaxLod() const
@@ -695,6 +767,7 @@ void Texture::setCompareMode(GLenum compareMode)
 {
     mState.mSamplerState.compareMode = compareMode;
     mDirtyBits.set(DIRTY_BIT_COMPARE_MODE);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getCompareMode() const
@@ -706,6 +779,7 @@ void Texture::setCompareFunc(GLenum compareFunc)
 {
     mState.mSamplerState.compareFunc = compareFunc;
     mDirtyBits.set(DIRTY_BIT_COMPARE_FUNC);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getCompareFunc() const
@@ -717,6 +791,7 @@ void Texture::setSRGBDecode(GLenum sRGBDecode)
 {
     mState.mSamplerState.sRGBDecode = sRGBDecode;
     mDirtyBits.set(DIRTY_BIT_SRGB_DECODE);
+    onSamplerStateChange();
 }
 
 GLenum Texture::getSRGBDecode() const
@@ -735,6 +810,7 @@ void Texture::setBaseLevel(GLuint baseLevel)
     {
         mTexture->setBaseLevel(mState.getEffectiveBaseLevel());
         mDirtyBits.set(DIRTY_BIT_BASE_LEVEL);
+        mDirtyChannel.signal();
     }
 }
 
@@ -747,6 +823,7 @@ void Texture::setMaxLevel(GLuint maxLevel)
 {
     mState.setMaxLevel(maxLevel);
     mDirtyBits.set(DIRTY_BIT_MAX_LEVEL);
+    mDirtyChannel.signal();
 }
 
 GLuint Texture::getMaxLevel() const
@@ -859,6 +936,12 @@ egl::Stream *Texture::getBoundStream() const
     return mBoundStream;
 }
 
+void Texture::onSamplerStateChange()
+{
+    mState.mSamplerStateSerial = GenerateSamplerStateSerial();
+    mDirtyChannel.signal();
+}
+
 void Texture::invalidateCompletenessCache()
 {
     mState.invalidateCompletenessCache();
@@ -882,10 +965,14 @@ Error Texture::setImage(const Context *context,
     releaseTexImageInternal();
     orphanImages();
 
+    double startTime = angle::HistogramCurrentTime();
     ANGLE_TRY(mTexture->setImage(context, target, level, internalFormat, size, format, type,
                                  unpackState, pixels));
+    RecordUploadThroughput(unpackState, pixels, format, type, size, startTime);
 
-    mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormat, type)));
+    InitState initState = DetermineImageInitState(context, pixels);
+    mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormat, type), initState));
+    updateMemoryCharge(context);
     mDirtyChannel.signal();
 
     return NoError();
@@ -902,7 +989,16 @@ Error Texture::setSubImage(const Context *context,
 {
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
-    return mTexture->setSubImage(context, target, level, area, format, type, unpackState, pixels);
+
+    ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
+
+    double startTime = angle::HistogramCurrentTime();
+    ANGLE_TRY(
+        mTexture->setSubImage(context, target, level, area, format, type, unpackState, pixels));
+    RecordUploadThroughput(unpackState, pixels, format, type,
+                           Extents(area.width, area.height, area.depth), startTime);
+
+    return NoError();
 }
 
 Error Texture::setCompressedImage(const Context *context,
@@ -924,7 +1020,9 @@ Error Texture::setCompressedImage(const Context *context,
     ANGLE_TRY(mTexture->setCompressedImage(context, target, level, internalFormat, size,
                                            unpackState, imageSize, pixels));
 
-    mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormat)));
+    InitState initState = DetermineImageInitState(context, pixels);
+    mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormat), initState));
+    updateMemoryCharge(context);
     mDirtyChannel.signal();
 
     return NoError();
@@ -942,6 +1040,8 @@ Error Texture::setCompressedSubImage(const Context *context,
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
 
+    ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
+
     return mTexture->setCompressedSubImage(context, target, level, area, format, unpackState,
                                            imageSize, pixels);
 }
@@ -960,12 +1060,34 @@ Error Texture::copyImage(const Context *context,
     releaseTexImageInternal();
     orphanImages();
 
+    ANGLE_TRY(source->ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
+
     ANGLE_TRY(mTexture->copyImage(context, target, level, sourceArea, internalFormat, source));
 
     const InternalFormat &internalFormatInfo =
         GetInternalFormatInfo(internalFormat, GL_UNSIGNED_BYTE);
     mState.setImageDesc(target, level, ImageDesc(Extents(sourceArea.width, sourceArea.height, 1),
-                                                 Format(internalFormatInfo)));
+                                                 Format(internalFormatInfo),
+                                                 InitState::Initialized));
+    updateMemoryCharge(context);
+
+    // Texels copied from outside the read framebuffer are undefined. Under robust resource
+    // initialization, zero the image and copy the in-bounds region again.
+    if (context && context->getGLState().isRobustResourceInitEnabled())
+    {
+        const FramebufferAttachment *readAttachment = source->getReadColorbuffer();
+        ASSERT(readAttachment);
+        const Extents &readSize = readAttachment->getSize();
+        Rectangle clippedArea;
+        ClipRectangle(sourceArea, Rectangle(0, 0, readSize.width, readSize.height), &clippedArea);
+        if (clippedArea != sourceArea)
+        {
+            ImageIndex imageIndex = ImageIndex::MakeGeneric(target, static_cast<GLint>(level));
+            ANGLE_TRY(initializeContents(context, imageIndex));
+            ANGLE_TRY(mTexture->copySubImage(context, target, level, Offset(), sourceArea, source));
+        }
+    }
+
     mDirtyChannel.signal();
 
     return NoError();
@@ -981,6 +1103,29 @@ Error Texture::copySubImage(const Context *context,
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
 
+    if (context && context->getGLState().isRobustResourceInitEnabled())
+    {
+        ANGLE_TRY(source->ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
+
+        // Only the part of the source inside the read framebuffer is written.
+        const FramebufferAttachment *readAttachment = source->getReadColorbuffer();
+        ASSERT(readAttachment);
+        const Extents &readSize = readAttachment->getSize();
+        Rectangle clippedArea;
+        if (ClipRectangle(sourceArea, Rectangle(0, 0, readSize.width, readSize.height),
+                          &clippedArea))
+        {
+            const Box destArea(destOffset.x + (clippedArea.x - sourceArea.x),
+                               destOffset.y + (clippedArea.y - sourceArea.y), destOffset.z,
+                               clippedArea.width, clippedArea.height, 1);
+            ANGLE_TRY(ensureSubImageInitialized(context, target, level, destArea));
+        }
+        else
+        {
+            ANGLE_TRY(ensureSubImageInitialized(context, target, level, Box()));
+        }
+    }
+
     return mTexture->copySubImage(context, target, level, destOffset, sourceArea, source);
 }
 
@@ -993,7 +1138,7 @@ Error Texture::copyTexture(const Context *context,
                            bool unpackFlipY,
                            bool unpackPremultiplyAlpha,
                            bool unpackUnmultiplyAlpha,
-                           const Texture *source)
+                           Texture *source)
 {
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
@@ -1002,13 +1147,18 @@ Error Texture::copyTexture(const Context *context,
     releaseTexImageInternal();
     orphanImages();
 
+    ANGLE_TRY(source->ensureInitialized(context));
+
     ANGLE_TRY(mTexture->copyTexture(context, target, level, internalFormat, type, sourceLevel,
                                     unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha,
                                     source));
 
     const auto &sourceDesc   = source->mState.getImageDesc(source->getTarget(), 0);
     const InternalFormat &internalFormatInfo = GetInternalFormatInfo(internalFormat, type);
-    mState.setImageDesc(target, level, ImageDesc(sourceDesc.size, Format(internalFormatInfo)));
+    mState.setImageDesc(
+        target, level,
+        ImageDesc(sourceDesc.size, Format(internalFormatInfo), InitState::Initialized));
+    updateMemoryCharge(context);
     mDirtyChannel.signal();
 
     return NoError();
@@ -1023,27 +1173,36 @@ Error Texture::copySubTexture(const Context *context,
                               bool unpackFlipY,
                               bool unpackPremultiplyAlpha,
                               bool unpackUnmultiplyAlpha,
-                              const Texture *source)
+                              Texture *source)
 {
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
 
+    ANGLE_TRY(source->ensureInitialized(context));
+
+    Box destArea(destOffset.x, destOffset.y, destOffset.z, sourceArea.width, sourceArea.height, 1);
+    ANGLE_TRY(ensureSubImageInitialized(context, target, level, destArea));
+
     return mTexture->copySubTexture(context, target, level, destOffset, sourceLevel, sourceArea,
                                     unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha,
                                     source);
 }
 
-Error Texture::copyCompressedTexture(const Context *context, const Texture *source)
+Error Texture::copyCompressedTexture(const Context *context, Texture *source)
 {
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
     releaseTexImageInternal();
     orphanImages();
 
+    ANGLE_TRY(source->ensureInitialized(context));
+
     ANGLE_TRY(mTexture->copyCompressedTexture(context, source));
 
     ASSERT(source->getTarget() != GL_TEXTURE_CUBE_MAP && getTarget() != GL_TEXTURE_CUBE_MAP);
     const auto &sourceDesc = source->mState.getImageDesc(source->getTarget(), 0);
     mState.setImageDesc(getTarget(), 0, sourceDesc);
+    updateMemoryCharge(context);
+    mDirtyChannel.signal();
 
     return NoError();
 }
@@ -1065,7 +1224,9 @@ Error Texture::setStorage(const Context *context,
     mState.mImmutableFormat = true;
     mState.mImmutableLevels = static_cast<GLuint>(levels);
     mState.clearImageDescs();
-    mState.setImageDescChain(0, static_cast<GLuint>(levels - 1), size, Format(internalFormat));
+    mState.setImageDescChain(0, static_cast<GLuint>(levels - 1), size, Format(internalFormat),
+                             DetermineInitState(context));
+    updateMemoryCharge(context);
 
     // Changing the texture to immutable can trigger a change in the base and max levels:
     // GLES 3.0.4 section 3.8.10 pg 158:
@@ -1099,7 +1260,8 @@ Error Texture::setStorageMultisample(const Context *context,
     mState.mImmutableLevels = static_cast<GLuint>(1);
     mState.clearImageDescs();
     mState.setImageDescChainMultisample(size, Format(internalFormat), samples,
-                                        fixedSampleLocations);
+                                        fixedSampleLocations, DetermineInitState(context));
+    updateMemoryCharge(context);
 
     mDirtyChannel.signal();
 
@@ -1123,12 +1285,30 @@ Error Texture::generateMipmap(const Context *context)
 
     if (maxLevel > baseLevel)
     {
+        // The generated levels are fully overwritten, only the base level needs initializing.
+        if (context && context->getGLState().isRobustResourceInitEnabled())
+        {
+            const GLenum firstTarget = mState.getBaseImageTarget();
+            const GLenum lastTarget =
+                (mState.mTarget == GL_TEXTURE_CUBE_MAP) ? LastCubeMapTextureTarget : firstTarget;
+            for (GLenum target = firstTarget; target <= lastTarget; ++target)
+            {
+                ImageIndex imageIndex = ImageIndex::MakeGeneric(target, baseLevel);
+                if (initState(imageIndex) == InitState::MayNeedInit)
+                {
+                    ANGLE_TRY(initializeContents(context, imageIndex));
+                }
+            }
+        }
+
         syncImplState();
         ANGLE_TRY(mTexture->generateMipmap(context));
 
         const ImageDesc &baseImageInfo =
             mState.getImageDesc(mState.getBaseImageTarget(), baseLevel);
-        mState.setImageDescChain(baseLevel, maxLevel, baseImageInfo.size, baseImageInfo.format);
+        mState.setImageDescChain(baseLevel, maxLevel, baseImageInfo.size, baseImageInfo.format,
+                                 InitState::Initialized);
+        updateMemoryCharge(context);
     }
 
     mDirtyChannel.signal();
@@ -1151,8 +1331,11 @@ void Texture::bindTexImageFromSurface(egl::Surface *surface)
     // Set the image info to the size and format of the surface
     ASSERT(mState.mTarget == GL_TEXTURE_2D);
     Extents size(surface->getWidth(), surface->getHeight(), 1);
-    ImageDesc desc(size, Format(surface->getConfig()->renderTargetFormat));
+    ImageDesc desc(size, Format(surface->getConfig()->renderTargetFormat), InitState::Initialized);
     mState.setImageDesc(mState.mTarget, 0, desc);
+
+    // The surface accounts for its own storage.
+    mMemoryCharge.release();
     mDirtyChannel.signal();
 }
 
@@ -1192,7 +1375,9 @@ void Texture::acquireImageFromStream(const egl::Stream::GLTextureDescription &de
     mTexture->setImageExternal(mState.mTarget, mBoundStream, desc);
 
     Extents size(desc.width, desc.height, 1);
-    mState.setImageDesc(mState.mTarget, 0, ImageDesc(size, Format(desc.internalFormat)));
+    mState.setImageDesc(mState.mTarget, 0,
+                        ImageDesc(size, Format(desc.internalFormat), InitState::Initialized));
+    mMemoryCharge.release();
     mDirtyChannel.signal();
 }
 
@@ -1235,7 +1420,11 @@ Error Texture::setEGLImageTarget(GLenum target, egl::Image *imageTarget)
                  static_cast<int>(imageTarget->getHeight()), 1);
 
     mState.clearImageDescs();
-    mState.setImageDesc(target, 0, ImageDesc(size, imageTarget->getFormat()));
+    mState.setImageDesc(target, 0,
+                        ImageDesc(size, imageTarget->getFormat(), InitState::Initialized));
+
+    // The image's storage belongs to its source, which accounts for it.
+    mMemoryCharge.release();
     mDirtyChannel.signal();
 
     return NoError();
@@ -1271,6 +1460,79 @@ GLuint Texture::getId() const
     return id();
 }
 
+InitState Texture::initState(const ImageIndex &imageIndex) const
+{
+    return mState.getImageDesc(imageIndex).initState;
+}
+
+void Texture::setInitState(const ImageIndex &imageIndex, InitState initState)
+{
+    ImageDesc newDesc = mState.getImageDesc(imageIndex);
+    newDesc.initState = initState;
+    mState.setImageDesc(imageIndex.type, imageIndex.mipIndex, newDesc);
+}
+
+Error Texture::ensureInitialized(const Context *context)
+{
+    // Note: the Context is checked for nullptr because of some testing code.
+    if (!context || !context->getGLState().isRobustResourceInitEnabled() ||
+        mState.mInitState == InitState::Initialized)
+    {
+        return NoError();
+    }
+
+    for (size_t descIndex = 0; descIndex < mState.mImageDescs.size(); ++descIndex)
+    {
+        const ImageDesc &desc = mState.mImageDescs[descIndex];
+        if (desc.initState == InitState::MayNeedInit && !desc.size.empty())
+        {
+            ANGLE_TRY(
+                initializeContents(context, GetImageIndexFromDescIndex(mState.mTarget, descIndex)));
+        }
+    }
+    mState.mInitState = InitState::Initialized;
+
+    return NoError();
+}
+
+Error Texture::ensureSubImageInitialized(const Context *context,
+                                         GLenum target,
+                                         size_t level,
+                                         const Box &area)
+{
+    if (!context || !context->getGLState().isRobustResourceInitEnabled() ||
+        mState.mInitState == InitState::Initialized)
+    {
+        return NoError();
+    }
+
+    ImageIndex imageIndex = ImageIndex::MakeGeneric(target, static_cast<GLint>(level));
+    const ImageDesc &desc = mState.getImageDesc(imageIndex);
+    if (desc.initState == InitState::Initialized)
+    {
+        return NoError();
+    }
+
+    // An update that covers the whole image makes the clear redundant.
+    if (area == Box(Offset(), desc.size))
+    {
+        setInitState(imageIndex, InitState::Initialized);
+        return NoError();
+    }
+
+    return initializeContents(context, imageIndex);
+}
+
+void Texture::updateMemoryCharge(const Context *context)
+{
+    uint64_t size = 0;
+    for (const ImageDesc &desc : mState.mImageDescs)
+    {
+        size += ComputeImageMemorySize(*desc.format.info, desc.size, desc.samples);
+    }
+    mMemoryCharge.update(context, size);
+}
+
 void Texture::syncImplState()
 {
     mTexture->syncState(mDirtyBits);
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_TEXTURE_H_
 #define LIBANGLE_TEXTURE_H_
 
+#include <array>
 #include <vector>
 #include <map>
 
@@ -20,6 +21,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/MemoryTracker.h"
 #include "libANGLE/Stream.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/formatutils.h"
@@ -41,6 +43,7 @@ namespace gl
 {
 class ContextState;
 class Framebuffer;
+class Sampler;
 class Texture;
 
 bool IsMipmapFiltered(const SamplerState &samplerState);
@@ -48,11 +51,12 @@ bool IsMipmapFiltered(const SamplerState &samplerState);
 struct ImageDesc final
 {
     ImageDesc();
-    ImageDesc(const Extents &size, const Format &format);
+    ImageDesc(const Extents &size, const Format &format, const InitState initState);
     ImageDesc(const Extents &size,
               const Format &format,
               const GLsizei samples,
-              const GLboolean fixedSampleLocations);
+              const GLboolean fixedSampleLocations,
+              const InitState initState);
 
     ImageDesc(const ImageDesc &other) = default;
     ImageDesc &operator=(const ImageDesc &other) = default;
@@ -61,6 +65,9 @@ struct ImageDesc final
     Format format;
     GLsizei samples;
     GLboolean fixedSampleLocations;
+
+    // Needed for robust resource initialization.
+    InitState initState;
 };
 
 struct SwizzleState final
@@ -98,10 +105,17 @@ struct TextureState final : private angle::NonCopyable
     void setMaxLevel(GLuint maxLevel);
 
     bool isCubeComplete() const;
-    bool isSamplerComplete(const SamplerState &samplerState, const ContextState &data) const;
+
+    // Checks completeness when sampled through |sampler|, or through the texture's own sampler
+    // state if |sampler| is null.
+    bool isSamplerComplete(const Sampler *sampler, const ContextState &data) const;
 
     void invalidateCompletenessCache();
 
+    // Changes every time the completeness cache is invalidated, so that a back-end can tell when
+    // a texture it bound earlier may have changed completeness.
+    unsigned int getCompletenessSerial() const { return mCompletenessSerial; }
+
     const ImageDesc &getImageDesc(GLenum target, size_t level) const;
     const ImageDesc &getImageDesc(const ImageIndex &imageIndex) const;
 
@@ -128,11 +142,13 @@ struct TextureState final : private angle::NonCopyable
     void setImageDescChain(GLuint baselevel,
                            GLuint maxLevel,
                            Extents baseSize,
-                           const Format &format);
+                           const Format &format,
+                           InitState initState);
     void setImageDescChainMultisample(Extents baseSize,
                                       const Format &format,
                                       GLsizei samples,
-                                      GLboolean fixedSampleLocations);
+                                      GLboolean fixedSampleLocations,
+                                      InitState initState);
 
     void clearImageDesc(GLenum target, size_t level);
     void clearImageDescs();
@@ -142,6 +158,7 @@ struct TextureState final : private angle::NonCopyable
     SwizzleState mSwizzleState;
 
     SamplerState mSamplerState;
+    SamplerStateSerial mSamplerStateSerial;
 
     GLuint mBaseLevel;
     GLuint mMaxLevel;
@@ -156,19 +173,30 @@ struct TextureState final : private angle::NonCopyable
 
     std::vector<ImageDesc> mImageDescs;
 
+    // MayNeedInit if any image desc may need initialization. Lets the per-draw check skip
+    // textures that are known to be fully initialized.
+    InitState mInitState;
+
     struct SamplerCompletenessCache
     {
         SamplerCompletenessCache();
 
-        // All values that affect sampler completeness that are not stored within
-        // the texture itself
-        SamplerState samplerState;
+        // All values that affect sampler completeness that are not stored within the texture
+        // itself. The entry is only valid while completenessSerial matches the texture's.
+        ContextID context;
+        SamplerStateSerial samplerStateSerial;
+        unsigned int completenessSerial;
 
         // Result of the sampler completeness with the above parameters
         bool samplerComplete;
     };
 
-    mutable std::unordered_map<ContextID, SamplerCompletenessCache> mCompletenessCache;
+    // A texture is rarely sampled from more than a couple of contexts or samplers at a time, so a
+    // few entries replaced in turn are enough, and cheaper to search than a map.
+    static constexpr size_t kCompletenessCacheSize = 4;
+    mutable std::array<SamplerCompletenessCache, kCompletenessCacheSize> mCompletenessCache;
+    mutable size_t mNextCompletenessCacheEntry;
+    unsigned int mCompletenessSerial;
 };
 
 bool operator==(const TextureState &a, const TextureState &b);
@@ -322,7 +350,7 @@ class Texture final : public egl::ImageSibling,
                       bool unpackFlipY,
                       bool unpackPremultiplyAlpha,
                       bool unpackUnmultiplyAlpha,
-                      const Texture *source);
+                      Texture *source);
     Error copySubTexture(const Context *context,
                          GLenum target,
                          size_t level,
@@ -332,8 +360,8 @@ class Texture final : public egl::ImageSibling,
                          bool unpackFlipY,
                          bool unpackPremultiplyAlpha,
                          bool unpackUnmultiplyAlpha,
-                         const Texture *source);
-    Error copyCompressedTexture(const Context *context, const Texture *source);
+                         Texture *source);
+    Error copyCompressedTexture(const Context *context, Texture *source);
 
     Error setStorage(const Context *context,
                      GLenum target,
@@ -368,6 +396,12 @@ class Texture final : public egl::ImageSibling,
     void onDetach() override;
     GLuint getId() const override;
 
+    InitState initState(const ImageIndex &imageIndex) const override;
+    void setInitState(const ImageIndex &imageIndex, InitState initState) override;
+
+    // Clears every image that may still need initialization. Called before the texture is sampled.
+    Error ensureInitialized(const Context *context);
+
     enum DirtyBitType
     {
         // Sampler state
@@ -417,6 +451,14 @@ class Texture final : public egl::ImageSibling,
     void acquireImageFromStream(const egl::Stream::GLTextureDescription &desc);
     void releaseImageFromStream();
 
+    Error ensureSubImageInitialized(const Context *context,
+                                    GLenum target,
+                                    size_t level,
+                                    const Box &area);
+
+    // Charges the size of every image to the tracker of |context|.
+    void updateMemoryCharge(const Context *context);
+
     TextureState mState;
     DirtyBits mDirtyBits;
     rx::TextureImpl *mTexture;
@@ -425,8 +467,12 @@ class Texture final : public egl::ImageSibling,
 
     void releaseTexImageInternal();
 
+    void onSamplerStateChange();
+
     egl::Surface *mBoundSurface;
     egl::Stream *mBoundStream;
+
+    MemoryCharge mMemoryCharge;
 };
 
 inline bool operator==(const TextureState &a, const TextureState &b)
@@ -10,6 +10,12 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/ErrorStrings.h"
+
+namespace gl
+{
+ANGLE_THREAD_LOCAL Context *gCurrentContext = nullptr;
+}  // namespace gl
 
 namespace egl
 {
@@ -52,6 +58,8 @@ void Thread::setCurrent(Display *display,
     mDrawSurface = drawSurface;
     mReadSurface = readSurface;
     mContext     = context;
+
+    gl::gCurrentContext = context;
 }
 
 Display *Thread::getDisplay() const
@@ -78,7 +86,7 @@ gl::Context *Thread::getValidContext() const
 {
     if (mContext && mContext->isContextLost())
     {
-        mContext->handleError(gl::Error(GL_OUT_OF_MEMORY, "Context has been lost."));
+        mContext->handleError(gl::Error(GL_OUT_OF_MEMORY, gl::kErrorContextLost));
         return nullptr;
     }
 
@@ -11,9 +11,15 @@
 
 #include <EGL/egl.h>
 
+#include "common/platform.h"
+
 namespace gl
 {
 class Context;
+
+// The context current on the calling thread, which egl::Thread::setCurrent keeps in sync. The entry
+// points read it on every call, so it doesn't go through the TLS index of egl::Thread.
+extern ANGLE_THREAD_LOCAL Context *gCurrentContext;
 }  // namespace gl
 
 namespace egl
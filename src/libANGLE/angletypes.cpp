@@ -12,6 +12,8 @@
 #include "libANGLE/State.h"
 #include "libANGLE/VertexArray.h"
 
+#include <atomic>
+
 namespace gl
 {
 
@@ -155,6 +157,13 @@ SamplerState SamplerState::CreateDefaultForTarget(GLenum target)
     return state;
 }
 
+SamplerStateSerial GenerateSamplerStateSerial()
+{
+    // Zero is never generated, so it can mark a cache entry that holds no state.
+    static std::atomic<SamplerStateSerial> sLastSerial(0);
+    return ++sLastSerial;
+}
+
 static void MinMax(int a, int b, int *minimum, int *maximum)
 {
     if (a < b)
@@ -216,6 +216,12 @@ struct SamplerState final
 bool operator==(const SamplerState &a, const SamplerState &b);
 bool operator!=(const SamplerState &a, const SamplerState &b);
 
+// Identifies a value of the sampler state of a texture or sampler object. The owner takes a new
+// serial each time its sampler state changes, and serials are unique across the process, so two
+// equal serials always stand for the same state.
+using SamplerStateSerial = uint64_t;
+SamplerStateSerial GenerateSamplerStateSerial();
+
 struct DrawArraysIndirectCommand
 {
     GLuint count;
@@ -278,6 +284,10 @@ using AttributesMask = angle::BitSet<MAX_VERTEX_ATTRIBS>;
 // Use in Program
 using UniformBlockBindingMask = angle::BitSet<IMPLEMENTATION_MAX_COMBINED_SHADER_UNIFORM_BUFFERS>;
 
+// Used in State to track changed bindings, indexed by texture unit or buffer binding point.
+using ActiveTextureMask        = angle::BitSet<IMPLEMENTATION_MAX_ACTIVE_TEXTURES>;
+using UniformBufferBindingMask = angle::BitSet<IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS>;
+
 // A map of GL objects indexed by object ID. The specific map implementation may change.
 // Client code should treat it as a std::map.
 template <class ResourceT>
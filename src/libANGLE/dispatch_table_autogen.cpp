@@ -0,0 +1,3514 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml.
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// dispatch_table_autogen.cpp:
+//   Defines the tables of GLES entry point implementations a context dispatches calls through.
+
+#include "libANGLE/dispatch_table_autogen.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
+#include "libANGLE/validationES.h"
+#include "libANGLE/validationES2.h"
+#include "libANGLE/validationES3.h"
+
+namespace gl
+{
+namespace
+{
+template <typename ReturnT, typename... ParamsT>
+ReturnT ContextLost(Context *context, ParamsT...)
+{
+    context->handleError(Error(GL_OUT_OF_MEMORY, kErrorContextLost));
+    return ReturnT();
+}
+
+void ActiveTextureValidated(Context *context, GLenum texture)
+{
+    context->gatherParams<EntryPoint::ActiveTexture>(texture);
+
+    if (ValidateActiveTexture(context, texture))
+    {
+        context->activeTexture(texture);
+    }
+}
+
+void ActiveTextureNoError(Context *context, GLenum texture)
+{
+    context->gatherParams<EntryPoint::ActiveTexture>(texture);
+    context->activeTexture(texture);
+}
+
+void AttachShaderValidated(Context *context, GLuint program, GLuint shader)
+{
+    context->gatherParams<EntryPoint::AttachShader>(program, shader);
+
+    if (ValidateAttachShader(context, program, shader))
+    {
+        context->attachShader(program, shader);
+    }
+}
+
+void AttachShaderNoError(Context *context, GLuint program, GLuint shader)
+{
+    context->gatherParams<EntryPoint::AttachShader>(program, shader);
+    context->attachShader(program, shader);
+}
+
+void BindAttribLocationValidated(Context *context, GLuint program, GLuint index, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::BindAttribLocation>(program, index, name);
+
+    if (ValidateBindAttribLocation(context, program, index, name))
+    {
+        context->bindAttribLocation(program, index, name);
+    }
+}
+
+void BindAttribLocationNoError(Context *context, GLuint program, GLuint index, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::BindAttribLocation>(program, index, name);
+    context->bindAttribLocation(program, index, name);
+}
+
+void BindBufferValidated(Context *context, GLenum target, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::BindBuffer>(target, buffer);
+
+    if (ValidateBindBuffer(context, target, buffer))
+    {
+        context->bindBuffer(target, buffer);
+    }
+}
+
+void BindBufferNoError(Context *context, GLenum target, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::BindBuffer>(target, buffer);
+    context->bindBuffer(target, buffer);
+}
+
+void BindFramebufferValidated(Context *context, GLenum target, GLuint framebuffer)
+{
+    context->gatherParams<EntryPoint::BindFramebuffer>(target, framebuffer);
+
+    if (ValidateBindFramebuffer(context, target, framebuffer))
+    {
+        context->bindFramebuffer(target, framebuffer);
+    }
+}
+
+void BindFramebufferNoError(Context *context, GLenum target, GLuint framebuffer)
+{
+    context->gatherParams<EntryPoint::BindFramebuffer>(target, framebuffer);
+    context->bindFramebuffer(target, framebuffer);
+}
+
+void BindRenderbufferValidated(Context *context, GLenum target, GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::BindRenderbuffer>(target, renderbuffer);
+
+    if (ValidateBindRenderbuffer(context, target, renderbuffer))
+    {
+        context->bindRenderbuffer(target, renderbuffer);
+    }
+}
+
+void BindRenderbufferNoError(Context *context, GLenum target, GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::BindRenderbuffer>(target, renderbuffer);
+    context->bindRenderbuffer(target, renderbuffer);
+}
+
+void BindTextureValidated(Context *context, GLenum target, GLuint texture)
+{
+    context->gatherParams<EntryPoint::BindTexture>(target, texture);
+
+    if (ValidateBindTexture(context, target, texture))
+    {
+        context->bindTexture(target, texture);
+    }
+}
+
+void BindTextureNoError(Context *context, GLenum target, GLuint texture)
+{
+    context->gatherParams<EntryPoint::BindTexture>(target, texture);
+    context->bindTexture(target, texture);
+}
+
+void BlendColorValidated(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    context->gatherParams<EntryPoint::BlendColor>(red, green, blue, alpha);
+
+    if (ValidateBlendColor(context, red, green, blue, alpha))
+    {
+        context->blendColor(red, green, blue, alpha);
+    }
+}
+
+void BlendColorNoError(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    context->gatherParams<EntryPoint::BlendColor>(red, green, blue, alpha);
+    context->blendColor(red, green, blue, alpha);
+}
+
+void BlendEquationValidated(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::BlendEquation>(mode);
+
+    if (ValidateBlendEquation(context, mode))
+    {
+        context->blendEquation(mode);
+    }
+}
+
+void BlendEquationNoError(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::BlendEquation>(mode);
+    context->blendEquation(mode);
+}
+
+void BlendEquationSeparateValidated(Context *context, GLenum modeRGB, GLenum modeAlpha)
+{
+    context->gatherParams<EntryPoint::BlendEquationSeparate>(modeRGB, modeAlpha);
+
+    if (ValidateBlendEquationSeparate(context, modeRGB, modeAlpha))
+    {
+        context->blendEquationSeparate(modeRGB, modeAlpha);
+    }
+}
+
+void BlendEquationSeparateNoError(Context *context, GLenum modeRGB, GLenum modeAlpha)
+{
+    context->gatherParams<EntryPoint::BlendEquationSeparate>(modeRGB, modeAlpha);
+    context->blendEquationSeparate(modeRGB, modeAlpha);
+}
+
+void BlendFuncValidated(Context *context, GLenum sfactor, GLenum dfactor)
+{
+    context->gatherParams<EntryPoint::BlendFunc>(sfactor, dfactor);
+
+    if (ValidateBlendFunc(context, sfactor, dfactor))
+    {
+        context->blendFunc(sfactor, dfactor);
+    }
+}
+
+void BlendFuncNoError(Context *context, GLenum sfactor, GLenum dfactor)
+{
+    context->gatherParams<EntryPoint::BlendFunc>(sfactor, dfactor);
+    context->blendFunc(sfactor, dfactor);
+}
+
+void BlendFuncSeparateValidated(Context *context,
+                                GLenum sfactorRGB,
+                                GLenum dfactorRGB,
+                                GLenum sfactorAlpha,
+                                GLenum dfactorAlpha)
+{
+    context->gatherParams<EntryPoint::BlendFuncSeparate>(sfactorRGB, dfactorRGB, sfactorAlpha,
+                                                         dfactorAlpha);
+
+    if (ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+    {
+        context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    }
+}
+
+void BlendFuncSeparateNoError(Context *context,
+                              GLenum sfactorRGB,
+                              GLenum dfactorRGB,
+                              GLenum sfactorAlpha,
+                              GLenum dfactorAlpha)
+{
+    context->gatherParams<EntryPoint::BlendFuncSeparate>(sfactorRGB, dfactorRGB, sfactorAlpha,
+                                                         dfactorAlpha);
+    context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+void BufferDataValidated(Context *context,
+                         GLenum target,
+                         GLsizeiptr size,
+                         const void *data,
+                         GLenum usage)
+{
+    context->gatherParams<EntryPoint::BufferData>(target, size, data, usage);
+
+    if (ValidateBufferData(context, target, size, data, usage))
+    {
+        context->bufferData(target, size, data, usage);
+    }
+}
+
+void BufferDataNoError(Context *context,
+                       GLenum target,
+                       GLsizeiptr size,
+                       const void *data,
+                       GLenum usage)
+{
+    context->gatherParams<EntryPoint::BufferData>(target, size, data, usage);
+    context->bufferData(target, size, data, usage);
+}
+
+void BufferSubDataValidated(Context *context,
+                            GLenum target,
+                            GLintptr offset,
+                            GLsizeiptr size,
+                            const void *data)
+{
+    context->gatherParams<EntryPoint::BufferSubData>(target, offset, size, data);
+
+    if (ValidateBufferSubData(context, target, offset, size, data))
+    {
+        context->bufferSubData(target, offset, size, data);
+    }
+}
+
+void BufferSubDataNoError(Context *context,
+                          GLenum target,
+                          GLintptr offset,
+                          GLsizeiptr size,
+                          const void *data)
+{
+    context->gatherParams<EntryPoint::BufferSubData>(target, offset, size, data);
+    context->bufferSubData(target, offset, size, data);
+}
+
+GLenum CheckFramebufferStatusValidated(Context *context, GLenum target)
+{
+    context->gatherParams<EntryPoint::CheckFramebufferStatus>(target);
+
+    if (ValidateCheckFramebufferStatus(context, target))
+    {
+        return context->checkFramebufferStatus(target);
+    }
+
+    return 0;
+}
+
+GLenum CheckFramebufferStatusNoError(Context *context, GLenum target)
+{
+    context->gatherParams<EntryPoint::CheckFramebufferStatus>(target);
+    return context->checkFramebufferStatus(target);
+}
+
+void ClearValidated(Context *context, GLbitfield mask)
+{
+    context->gatherParams<EntryPoint::Clear>(mask);
+
+    if (ValidateClear(context, mask))
+    {
+        context->clear(mask);
+    }
+}
+
+void ClearNoError(Context *context, GLbitfield mask)
+{
+    context->gatherParams<EntryPoint::Clear>(mask);
+    context->clear(mask);
+}
+
+void ClearColorValidated(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    context->gatherParams<EntryPoint::ClearColor>(red, green, blue, alpha);
+
+    if (ValidateClearColor(context, red, green, blue, alpha))
+    {
+        context->clearColor(red, green, blue, alpha);
+    }
+}
+
+void ClearColorNoError(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    context->gatherParams<EntryPoint::ClearColor>(red, green, blue, alpha);
+    context->clearColor(red, green, blue, alpha);
+}
+
+void ClearDepthfValidated(Context *context, GLfloat d)
+{
+    context->gatherParams<EntryPoint::ClearDepthf>(d);
+
+    if (ValidateClearDepthf(context, d))
+    {
+        context->clearDepthf(d);
+    }
+}
+
+void ClearDepthfNoError(Context *context, GLfloat d)
+{
+    context->gatherParams<EntryPoint::ClearDepthf>(d);
+    context->clearDepthf(d);
+}
+
+void ClearStencilValidated(Context *context, GLint s)
+{
+    context->gatherParams<EntryPoint::ClearStencil>(s);
+
+    if (ValidateClearStencil(context, s))
+    {
+        context->clearStencil(s);
+    }
+}
+
+void ClearStencilNoError(Context *context, GLint s)
+{
+    context->gatherParams<EntryPoint::ClearStencil>(s);
+    context->clearStencil(s);
+}
+
+void ColorMaskValidated(Context *context,
+                        GLboolean red,
+                        GLboolean green,
+                        GLboolean blue,
+                        GLboolean alpha)
+{
+    context->gatherParams<EntryPoint::ColorMask>(red, green, blue, alpha);
+
+    if (ValidateColorMask(context, red, green, blue, alpha))
+    {
+        context->colorMask(red, green, blue, alpha);
+    }
+}
+
+void ColorMaskNoError(Context *context,
+                      GLboolean red,
+                      GLboolean green,
+                      GLboolean blue,
+                      GLboolean alpha)
+{
+    context->gatherParams<EntryPoint::ColorMask>(red, green, blue, alpha);
+    context->colorMask(red, green, blue, alpha);
+}
+
+void CompileShaderValidated(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::CompileShader>(shader);
+
+    if (ValidateCompileShader(context, shader))
+    {
+        context->compileShader(shader);
+    }
+}
+
+void CompileShaderNoError(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::CompileShader>(shader);
+    context->compileShader(shader);
+}
+
+void CompressedTexImage2DValidated(Context *context,
+                                   GLenum target,
+                                   GLint level,
+                                   GLenum internalformat,
+                                   GLsizei width,
+                                   GLsizei height,
+                                   GLint border,
+                                   GLsizei imageSize,
+                                   const void *data)
+{
+    context->gatherParams<EntryPoint::CompressedTexImage2D>(target, level, internalformat, width,
+                                                            height, border, imageSize, data);
+
+    if (ValidateCompressedTexImage2D(context, target, level, internalformat, width, height, border,
+                                     imageSize, data))
+    {
+        context->compressedTexImage2D(target, level, internalformat, width, height, border,
+                                      imageSize, data);
+    }
+}
+
+void CompressedTexImage2DNoError(Context *context,
+                                 GLenum target,
+                                 GLint level,
+                                 GLenum internalformat,
+                                 GLsizei width,
+                                 GLsizei height,
+                                 GLint border,
+                                 GLsizei imageSize,
+                                 const void *data)
+{
+    context->gatherParams<EntryPoint::CompressedTexImage2D>(target, level, internalformat, width,
+                                                            height, border, imageSize, data);
+    context->compressedTexImage2D(target, level, internalformat, width, height, border, imageSize,
+                                  data);
+}
+
+void CompressedTexSubImage2DValidated(Context *context,
+                                      GLenum target,
+                                      GLint level,
+                                      GLint xoffset,
+                                      GLint yoffset,
+                                      GLsizei width,
+                                      GLsizei height,
+                                      GLenum format,
+                                      GLsizei imageSize,
+                                      const void *data)
+{
+    context->gatherParams<EntryPoint::CompressedTexSubImage2D>(target, level, xoffset, yoffset,
+                                                               width, height, format, imageSize,
+                                                               data);
+
+    if (ValidateCompressedTexSubImage2D(context, target, level, xoffset, yoffset, width, height,
+                                        format, imageSize, data))
+    {
+        context->compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
+                                         imageSize, data);
+    }
+}
+
+void CompressedTexSubImage2DNoError(Context *context,
+                                    GLenum target,
+                                    GLint level,
+                                    GLint xoffset,
+                                    GLint yoffset,
+                                    GLsizei width,
+                                    GLsizei height,
+                                    GLenum format,
+                                    GLsizei imageSize,
+                                    const void *data)
+{
+    context->gatherParams<EntryPoint::CompressedTexSubImage2D>(target, level, xoffset, yoffset,
+                                                               width, height, format, imageSize,
+                                                               data);
+    context->compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
+                                     imageSize, data);
+}
+
+void CopyTexImage2DValidated(Context *context,
+                             GLenum target,
+                             GLint level,
+                             GLenum internalformat,
+                             GLint x,
+                             GLint y,
+                             GLsizei width,
+                             GLsizei height,
+                             GLint border)
+{
+    context->gatherParams<EntryPoint::CopyTexImage2D>(target, level, internalformat, x, y, width,
+                                                      height, border);
+
+    if (ValidateCopyTexImage2D(context, target, level, internalformat, x, y, width, height, border))
+    {
+        context->copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    }
+}
+
+void CopyTexImage2DNoError(Context *context,
+                           GLenum target,
+                           GLint level,
+                           GLenum internalformat,
+                           GLint x,
+                           GLint y,
+                           GLsizei width,
+                           GLsizei height,
+                           GLint border)
+{
+    context->gatherParams<EntryPoint::CopyTexImage2D>(target, level, internalformat, x, y, width,
+                                                      height, border);
+    context->copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+void CopyTexSubImage2DValidated(Context *context,
+                                GLenum target,
+                                GLint level,
+                                GLint xoffset,
+                                GLint yoffset,
+                                GLint x,
+                                GLint y,
+                                GLsizei width,
+                                GLsizei height)
+{
+    context->gatherParams<EntryPoint::CopyTexSubImage2D>(target, level, xoffset, yoffset, x, y,
+                                                         width, height);
+
+    if (ValidateCopyTexSubImage2D(context, target, level, xoffset, yoffset, x, y, width, height))
+    {
+        context->copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    }
+}
+
+void CopyTexSubImage2DNoError(Context *context,
+                              GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLint x,
+                              GLint y,
+                              GLsizei width,
+                              GLsizei height)
+{
+    context->gatherParams<EntryPoint::CopyTexSubImage2D>(target, level, xoffset, yoffset, x, y,
+                                                         width, height);
+    context->copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+GLuint CreateProgramValidated(Context *context)
+{
+    context->gatherParams<EntryPoint::CreateProgram>();
+
+    if (ValidateCreateProgram(context))
+    {
+        return context->createProgram();
+    }
+
+    return 0;
+}
+
+GLuint CreateProgramNoError(Context *context)
+{
+    context->gatherParams<EntryPoint::CreateProgram>();
+    return context->createProgram();
+}
+
+GLuint CreateShaderValidated(Context *context, GLenum type)
+{
+    context->gatherParams<EntryPoint::CreateShader>(type);
+
+    if (ValidateCreateShader(context, type))
+    {
+        return context->createShader(type);
+    }
+
+    return 0;
+}
+
+GLuint CreateShaderNoError(Context *context, GLenum type)
+{
+    context->gatherParams<EntryPoint::CreateShader>(type);
+    return context->createShader(type);
+}
+
+void CullFaceValidated(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::CullFace>(mode);
+
+    if (ValidateCullFace(context, mode))
+    {
+        context->cullFace(mode);
+    }
+}
+
+void CullFaceNoError(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::CullFace>(mode);
+    context->cullFace(mode);
+}
+
+void DeleteBuffersValidated(Context *context, GLsizei n, const GLuint *buffers)
+{
+    context->gatherParams<EntryPoint::DeleteBuffers>(n, buffers);
+
+    if (ValidateDeleteBuffers(context, n, buffers))
+    {
+        context->deleteBuffers(n, buffers);
+    }
+}
+
+void DeleteBuffersNoError(Context *context, GLsizei n, const GLuint *buffers)
+{
+    context->gatherParams<EntryPoint::DeleteBuffers>(n, buffers);
+    context->deleteBuffers(n, buffers);
+}
+
+void DeleteFramebuffersValidated(Context *context, GLsizei n, const GLuint *framebuffers)
+{
+    context->gatherParams<EntryPoint::DeleteFramebuffers>(n, framebuffers);
+
+    if (ValidateDeleteFramebuffers(context, n, framebuffers))
+    {
+        context->deleteFramebuffers(n, framebuffers);
+    }
+}
+
+void DeleteFramebuffersNoError(Context *context, GLsizei n, const GLuint *framebuffers)
+{
+    context->gatherParams<EntryPoint::DeleteFramebuffers>(n, framebuffers);
+    context->deleteFramebuffers(n, framebuffers);
+}
+
+void DeleteProgramValidated(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::DeleteProgram>(program);
+
+    if (ValidateDeleteProgram(context, program))
+    {
+        context->deleteProgram(program);
+    }
+}
+
+void DeleteProgramNoError(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::DeleteProgram>(program);
+    context->deleteProgram(program);
+}
+
+void DeleteRenderbuffersValidated(Context *context, GLsizei n, const GLuint *renderbuffers)
+{
+    context->gatherParams<EntryPoint::DeleteRenderbuffers>(n, renderbuffers);
+
+    if (ValidateDeleteRenderbuffers(context, n, renderbuffers))
+    {
+        context->deleteRenderbuffers(n, renderbuffers);
+    }
+}
+
+void DeleteRenderbuffersNoError(Context *context, GLsizei n, const GLuint *renderbuffers)
+{
+    context->gatherParams<EntryPoint::DeleteRenderbuffers>(n, renderbuffers);
+    context->deleteRenderbuffers(n, renderbuffers);
+}
+
+void DeleteShaderValidated(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::DeleteShader>(shader);
+
+    if (ValidateDeleteShader(context, shader))
+    {
+        context->deleteShader(shader);
+    }
+}
+
+void DeleteShaderNoError(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::DeleteShader>(shader);
+    context->deleteShader(shader);
+}
+
+void DeleteTexturesValidated(Context *context, GLsizei n, const GLuint *textures)
+{
+    context->gatherParams<EntryPoint::DeleteTextures>(n, textures);
+
+    if (ValidateDeleteTextures(context, n, textures))
+    {
+        context->deleteTextures(n, textures);
+    }
+}
+
+void DeleteTexturesNoError(Context *context, GLsizei n, const GLuint *textures)
+{
+    context->gatherParams<EntryPoint::DeleteTextures>(n, textures);
+    context->deleteTextures(n, textures);
+}
+
+void DepthFuncValidated(Context *context, GLenum func)
+{
+    context->gatherParams<EntryPoint::DepthFunc>(func);
+
+    if (ValidateDepthFunc(context, func))
+    {
+        context->depthFunc(func);
+    }
+}
+
+void DepthFuncNoError(Context *context, GLenum func)
+{
+    context->gatherParams<EntryPoint::DepthFunc>(func);
+    context->depthFunc(func);
+}
+
+void DepthMaskValidated(Context *context, GLboolean flag)
+{
+    context->gatherParams<EntryPoint::DepthMask>(flag);
+
+    if (ValidateDepthMask(context, flag))
+    {
+        context->depthMask(flag);
+    }
+}
+
+void DepthMaskNoError(Context *context, GLboolean flag)
+{
+    context->gatherParams<EntryPoint::DepthMask>(flag);
+    context->depthMask(flag);
+}
+
+void DepthRangefValidated(Context *context, GLfloat n, GLfloat f)
+{
+    context->gatherParams<EntryPoint::DepthRangef>(n, f);
+
+    if (ValidateDepthRangef(context, n, f))
+    {
+        context->depthRangef(n, f);
+    }
+}
+
+void DepthRangefNoError(Context *context, GLfloat n, GLfloat f)
+{
+    context->gatherParams<EntryPoint::DepthRangef>(n, f);
+    context->depthRangef(n, f);
+}
+
+void DetachShaderValidated(Context *context, GLuint program, GLuint shader)
+{
+    context->gatherParams<EntryPoint::DetachShader>(program, shader);
+
+    if (ValidateDetachShader(context, program, shader))
+    {
+        context->detachShader(program, shader);
+    }
+}
+
+void DetachShaderNoError(Context *context, GLuint program, GLuint shader)
+{
+    context->gatherParams<EntryPoint::DetachShader>(program, shader);
+    context->detachShader(program, shader);
+}
+
+void DisableValidated(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::Disable>(cap);
+
+    if (ValidateDisable(context, cap))
+    {
+        context->disable(cap);
+    }
+}
+
+void DisableNoError(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::Disable>(cap);
+    context->disable(cap);
+}
+
+void DisableVertexAttribArrayValidated(Context *context, GLuint index)
+{
+    context->gatherParams<EntryPoint::DisableVertexAttribArray>(index);
+
+    if (ValidateDisableVertexAttribArray(context, index))
+    {
+        context->disableVertexAttribArray(index);
+    }
+}
+
+void DisableVertexAttribArrayNoError(Context *context, GLuint index)
+{
+    context->gatherParams<EntryPoint::DisableVertexAttribArray>(index);
+    context->disableVertexAttribArray(index);
+}
+
+void DrawArraysValidated(Context *context, GLenum mode, GLint first, GLsizei count)
+{
+    context->gatherParams<EntryPoint::DrawArrays>(mode, first, count);
+
+    if (ValidateDrawArrays(context, mode, first, count))
+    {
+        context->drawArrays(mode, first, count);
+    }
+}
+
+void DrawArraysNoError(Context *context, GLenum mode, GLint first, GLsizei count)
+{
+    context->gatherParams<EntryPoint::DrawArrays>(mode, first, count);
+    context->drawArrays(mode, first, count);
+}
+
+void DrawElementsValidated(Context *context,
+                           GLenum mode,
+                           GLsizei count,
+                           GLenum type,
+                           const void *indices)
+{
+    context->gatherParams<EntryPoint::DrawElements>(mode, count, type, indices);
+
+    if (ValidateDrawElements(context, mode, count, type, indices))
+    {
+        context->drawElements(mode, count, type, indices);
+    }
+}
+
+void DrawElementsNoError(Context *context,
+                         GLenum mode,
+                         GLsizei count,
+                         GLenum type,
+                         const void *indices)
+{
+    context->gatherParams<EntryPoint::DrawElements>(mode, count, type, indices);
+    context->drawElements(mode, count, type, indices);
+}
+
+void EnableValidated(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::Enable>(cap);
+
+    if (ValidateEnable(context, cap))
+    {
+        context->enable(cap);
+    }
+}
+
+void EnableNoError(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::Enable>(cap);
+    context->enable(cap);
+}
+
+void EnableVertexAttribArrayValidated(Context *context, GLuint index)
+{
+    context->gatherParams<EntryPoint::EnableVertexAttribArray>(index);
+
+    if (ValidateEnableVertexAttribArray(context, index))
+    {
+        context->enableVertexAttribArray(index);
+    }
+}
+
+void EnableVertexAttribArrayNoError(Context *context, GLuint index)
+{
+    context->gatherParams<EntryPoint::EnableVertexAttribArray>(index);
+    context->enableVertexAttribArray(index);
+}
+
+void FinishValidated(Context *context)
+{
+    context->gatherParams<EntryPoint::Finish>();
+
+    if (ValidateFinish(context))
+    {
+        context->finish();
+    }
+}
+
+void FinishNoError(Context *context)
+{
+    context->gatherParams<EntryPoint::Finish>();
+    context->finish();
+}
+
+void FlushValidated(Context *context)
+{
+    context->gatherParams<EntryPoint::Flush>();
+
+    if (ValidateFlush(context))
+    {
+        context->flush();
+    }
+}
+
+void FlushNoError(Context *context)
+{
+    context->gatherParams<EntryPoint::Flush>();
+    context->flush();
+}
+
+void FramebufferRenderbufferValidated(Context *context,
+                                      GLenum target,
+                                      GLenum attachment,
+                                      GLenum renderbuffertarget,
+                                      GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::FramebufferRenderbuffer>(target, attachment,
+                                                               renderbuffertarget, renderbuffer);
+
+    if (ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
+                                        renderbuffer))
+    {
+        context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    }
+}
+
+void FramebufferRenderbufferNoError(Context *context,
+                                    GLenum target,
+                                    GLenum attachment,
+                                    GLenum renderbuffertarget,
+                                    GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::FramebufferRenderbuffer>(target, attachment,
+                                                               renderbuffertarget, renderbuffer);
+    context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+void FramebufferTexture2DValidated(Context *context,
+                                   GLenum target,
+                                   GLenum attachment,
+                                   GLenum textarget,
+                                   GLuint texture,
+                                   GLint level)
+{
+    context->gatherParams<EntryPoint::FramebufferTexture2D>(target, attachment, textarget, texture,
+                                                            level);
+
+    if (ValidateFramebufferTexture2D(context, target, attachment, textarget, texture, level))
+    {
+        context->framebufferTexture2D(target, attachment, textarget, texture, level);
+    }
+}
+
+void FramebufferTexture2DNoError(Context *context,
+                                 GLenum target,
+                                 GLenum attachment,
+                                 GLenum textarget,
+                                 GLuint texture,
+                                 GLint level)
+{
+    context->gatherParams<EntryPoint::FramebufferTexture2D>(target, attachment, textarget, texture,
+                                                            level);
+    context->framebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+void FrontFaceValidated(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::FrontFace>(mode);
+
+    if (ValidateFrontFace(context, mode))
+    {
+        context->frontFace(mode);
+    }
+}
+
+void FrontFaceNoError(Context *context, GLenum mode)
+{
+    context->gatherParams<EntryPoint::FrontFace>(mode);
+    context->frontFace(mode);
+}
+
+void GenBuffersValidated(Context *context, GLsizei n, GLuint *buffers)
+{
+    context->gatherParams<EntryPoint::GenBuffers>(n, buffers);
+
+    if (ValidateGenBuffers(context, n, buffers))
+    {
+        context->genBuffers(n, buffers);
+    }
+}
+
+void GenBuffersNoError(Context *context, GLsizei n, GLuint *buffers)
+{
+    context->gatherParams<EntryPoint::GenBuffers>(n, buffers);
+    context->genBuffers(n, buffers);
+}
+
+void GenerateMipmapValidated(Context *context, GLenum target)
+{
+    context->gatherParams<EntryPoint::GenerateMipmap>(target);
+
+    if (ValidateGenerateMipmap(context, target))
+    {
+        context->generateMipmap(target);
+    }
+}
+
+void GenerateMipmapNoError(Context *context, GLenum target)
+{
+    context->gatherParams<EntryPoint::GenerateMipmap>(target);
+    context->generateMipmap(target);
+}
+
+void GenFramebuffersValidated(Context *context, GLsizei n, GLuint *framebuffers)
+{
+    context->gatherParams<EntryPoint::GenFramebuffers>(n, framebuffers);
+
+    if (ValidateGenFramebuffers(context, n, framebuffers))
+    {
+        context->genFramebuffers(n, framebuffers);
+    }
+}
+
+void GenFramebuffersNoError(Context *context, GLsizei n, GLuint *framebuffers)
+{
+    context->gatherParams<EntryPoint::GenFramebuffers>(n, framebuffers);
+    context->genFramebuffers(n, framebuffers);
+}
+
+void GenRenderbuffersValidated(Context *context, GLsizei n, GLuint *renderbuffers)
+{
+    context->gatherParams<EntryPoint::GenRenderbuffers>(n, renderbuffers);
+
+    if (ValidateGenRenderbuffers(context, n, renderbuffers))
+    {
+        context->genRenderbuffers(n, renderbuffers);
+    }
+}
+
+void GenRenderbuffersNoError(Context *context, GLsizei n, GLuint *renderbuffers)
+{
+    context->gatherParams<EntryPoint::GenRenderbuffers>(n, renderbuffers);
+    context->genRenderbuffers(n, renderbuffers);
+}
+
+void GenTexturesValidated(Context *context, GLsizei n, GLuint *textures)
+{
+    context->gatherParams<EntryPoint::GenTextures>(n, textures);
+
+    if (ValidateGenTextures(context, n, textures))
+    {
+        context->genTextures(n, textures);
+    }
+}
+
+void GenTexturesNoError(Context *context, GLsizei n, GLuint *textures)
+{
+    context->gatherParams<EntryPoint::GenTextures>(n, textures);
+    context->genTextures(n, textures);
+}
+
+void GetActiveAttribValidated(Context *context,
+                              GLuint program,
+                              GLuint index,
+                              GLsizei bufSize,
+                              GLsizei *length,
+                              GLint *size,
+                              GLenum *type,
+                              GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetActiveAttrib>(program, index, bufSize, length, size, type,
+                                                       name);
+
+    if (ValidateGetActiveAttrib(context, program, index, bufSize, length, size, type, name))
+    {
+        context->getActiveAttrib(program, index, bufSize, length, size, type, name);
+    }
+}
+
+void GetActiveAttribNoError(Context *context,
+                            GLuint program,
+                            GLuint index,
+                            GLsizei bufSize,
+                            GLsizei *length,
+                            GLint *size,
+                            GLenum *type,
+                            GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetActiveAttrib>(program, index, bufSize, length, size, type,
+                                                       name);
+    context->getActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+void GetActiveUniformValidated(Context *context,
+                               GLuint program,
+                               GLuint index,
+                               GLsizei bufSize,
+                               GLsizei *length,
+                               GLint *size,
+                               GLenum *type,
+                               GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetActiveUniform>(program, index, bufSize, length, size, type,
+                                                        name);
+
+    if (ValidateGetActiveUniform(context, program, index, bufSize, length, size, type, name))
+    {
+        context->getActiveUniform(program, index, bufSize, length, size, type, name);
+    }
+}
+
+void GetActiveUniformNoError(Context *context,
+                             GLuint program,
+                             GLuint index,
+                             GLsizei bufSize,
+                             GLsizei *length,
+                             GLint *size,
+                             GLenum *type,
+                             GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetActiveUniform>(program, index, bufSize, length, size, type,
+                                                        name);
+    context->getActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+void GetAttachedShadersValidated(Context *context,
+                                 GLuint program,
+                                 GLsizei maxCount,
+                                 GLsizei *count,
+                                 GLuint *shaders)
+{
+    context->gatherParams<EntryPoint::GetAttachedShaders>(program, maxCount, count, shaders);
+
+    if (ValidateGetAttachedShaders(context, program, maxCount, count, shaders))
+    {
+        context->getAttachedShaders(program, maxCount, count, shaders);
+    }
+}
+
+void GetAttachedShadersNoError(Context *context,
+                               GLuint program,
+                               GLsizei maxCount,
+                               GLsizei *count,
+                               GLuint *shaders)
+{
+    context->gatherParams<EntryPoint::GetAttachedShaders>(program, maxCount, count, shaders);
+    context->getAttachedShaders(program, maxCount, count, shaders);
+}
+
+GLint GetAttribLocationValidated(Context *context, GLuint program, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetAttribLocation>(program, name);
+
+    if (ValidateGetAttribLocation(context, program, name))
+    {
+        return context->getAttribLocation(program, name);
+    }
+
+    return 0;
+}
+
+GLint GetAttribLocationNoError(Context *context, GLuint program, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetAttribLocation>(program, name);
+    return context->getAttribLocation(program, name);
+}
+
+void GetBooleanvValidated(Context *context, GLenum pname, GLboolean *data)
+{
+    context->gatherParams<EntryPoint::GetBooleanv>(pname, data);
+
+    if (ValidateGetBooleanv(context, pname, data))
+    {
+        context->getBooleanv(pname, data);
+    }
+}
+
+void GetBooleanvNoError(Context *context, GLenum pname, GLboolean *data)
+{
+    context->gatherParams<EntryPoint::GetBooleanv>(pname, data);
+    context->getBooleanv(pname, data);
+}
+
+void GetBufferParameterivValidated(Context *context, GLenum target, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetBufferParameteriv>(target, pname, params);
+
+    if (ValidateGetBufferParameteriv(context, target, pname, params))
+    {
+        context->getBufferParameteriv(target, pname, params);
+    }
+}
+
+void GetBufferParameterivNoError(Context *context, GLenum target, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetBufferParameteriv>(target, pname, params);
+    context->getBufferParameteriv(target, pname, params);
+}
+
+GLenum GetErrorValidated(Context *context)
+{
+    context->gatherParams<EntryPoint::GetError>();
+
+    if (ValidateGetError(context))
+    {
+        return context->getError();
+    }
+
+    return 0;
+}
+
+GLenum GetErrorNoError(Context *context)
+{
+    context->gatherParams<EntryPoint::GetError>();
+    return context->getError();
+}
+
+void GetFloatvValidated(Context *context, GLenum pname, GLfloat *data)
+{
+    context->gatherParams<EntryPoint::GetFloatv>(pname, data);
+
+    if (ValidateGetFloatv(context, pname, data))
+    {
+        context->getFloatv(pname, data);
+    }
+}
+
+void GetFloatvNoError(Context *context, GLenum pname, GLfloat *data)
+{
+    context->gatherParams<EntryPoint::GetFloatv>(pname, data);
+    context->getFloatv(pname, data);
+}
+
+void GetFramebufferAttachmentParameterivValidated(Context *context,
+                                                  GLenum target,
+                                                  GLenum attachment,
+                                                  GLenum pname,
+                                                  GLint *params)
+{
+    context->gatherParams<EntryPoint::GetFramebufferAttachmentParameteriv>(target, attachment,
+                                                                           pname, params);
+
+    if (ValidateGetFramebufferAttachmentParameteriv(context, target, attachment, pname, params))
+    {
+        context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    }
+}
+
+void GetFramebufferAttachmentParameterivNoError(Context *context,
+                                                GLenum target,
+                                                GLenum attachment,
+                                                GLenum pname,
+                                                GLint *params)
+{
+    context->gatherParams<EntryPoint::GetFramebufferAttachmentParameteriv>(target, attachment,
+                                                                           pname, params);
+    context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+void GetIntegervValidated(Context *context, GLenum pname, GLint *data)
+{
+    context->gatherParams<EntryPoint::GetIntegerv>(pname, data);
+
+    if (ValidateGetIntegerv(context, pname, data))
+    {
+        context->getIntegerv(pname, data);
+    }
+}
+
+void GetIntegervNoError(Context *context, GLenum pname, GLint *data)
+{
+    context->gatherParams<EntryPoint::GetIntegerv>(pname, data);
+    context->getIntegerv(pname, data);
+}
+
+void GetProgramivValidated(Context *context, GLuint program, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetProgramiv>(program, pname, params);
+
+    if (ValidateGetProgramiv(context, program, pname, params))
+    {
+        context->getProgramiv(program, pname, params);
+    }
+}
+
+void GetProgramivNoError(Context *context, GLuint program, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetProgramiv>(program, pname, params);
+    context->getProgramiv(program, pname, params);
+}
+
+void GetProgramInfoLogValidated(Context *context,
+                                GLuint program,
+                                GLsizei bufSize,
+                                GLsizei *length,
+                                GLchar *infoLog)
+{
+    context->gatherParams<EntryPoint::GetProgramInfoLog>(program, bufSize, length, infoLog);
+
+    if (ValidateGetProgramInfoLog(context, program, bufSize, length, infoLog))
+    {
+        context->getProgramInfoLog(program, bufSize, length, infoLog);
+    }
+}
+
+void GetProgramInfoLogNoError(Context *context,
+                              GLuint program,
+                              GLsizei bufSize,
+                              GLsizei *length,
+                              GLchar *infoLog)
+{
+    context->gatherParams<EntryPoint::GetProgramInfoLog>(program, bufSize, length, infoLog);
+    context->getProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+void GetRenderbufferParameterivValidated(Context *context,
+                                         GLenum target,
+                                         GLenum pname,
+                                         GLint *params)
+{
+    context->gatherParams<EntryPoint::GetRenderbufferParameteriv>(target, pname, params);
+
+    if (ValidateGetRenderbufferParameteriv(context, target, pname, params))
+    {
+        context->getRenderbufferParameteriv(target, pname, params);
+    }
+}
+
+void GetRenderbufferParameterivNoError(Context *context, GLenum target, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetRenderbufferParameteriv>(target, pname, params);
+    context->getRenderbufferParameteriv(target, pname, params);
+}
+
+void GetShaderivValidated(Context *context, GLuint shader, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetShaderiv>(shader, pname, params);
+
+    if (ValidateGetShaderiv(context, shader, pname, params))
+    {
+        context->getShaderiv(shader, pname, params);
+    }
+}
+
+void GetShaderivNoError(Context *context, GLuint shader, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetShaderiv>(shader, pname, params);
+    context->getShaderiv(shader, pname, params);
+}
+
+void GetShaderInfoLogValidated(Context *context,
+                               GLuint shader,
+                               GLsizei bufSize,
+                               GLsizei *length,
+                               GLchar *infoLog)
+{
+    context->gatherParams<EntryPoint::GetShaderInfoLog>(shader, bufSize, length, infoLog);
+
+    if (ValidateGetShaderInfoLog(context, shader, bufSize, length, infoLog))
+    {
+        context->getShaderInfoLog(shader, bufSize, length, infoLog);
+    }
+}
+
+void GetShaderInfoLogNoError(Context *context,
+                             GLuint shader,
+                             GLsizei bufSize,
+                             GLsizei *length,
+                             GLchar *infoLog)
+{
+    context->gatherParams<EntryPoint::GetShaderInfoLog>(shader, bufSize, length, infoLog);
+    context->getShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+void GetShaderPrecisionFormatValidated(Context *context,
+                                       GLenum shadertype,
+                                       GLenum precisiontype,
+                                       GLint *range,
+                                       GLint *precision)
+{
+    context->gatherParams<EntryPoint::GetShaderPrecisionFormat>(shadertype, precisiontype, range,
+                                                                precision);
+
+    if (ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype, range, precision))
+    {
+        context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    }
+}
+
+void GetShaderPrecisionFormatNoError(Context *context,
+                                     GLenum shadertype,
+                                     GLenum precisiontype,
+                                     GLint *range,
+                                     GLint *precision)
+{
+    context->gatherParams<EntryPoint::GetShaderPrecisionFormat>(shadertype, precisiontype, range,
+                                                                precision);
+    context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+void GetShaderSourceValidated(Context *context,
+                              GLuint shader,
+                              GLsizei bufSize,
+                              GLsizei *length,
+                              GLchar *source)
+{
+    context->gatherParams<EntryPoint::GetShaderSource>(shader, bufSize, length, source);
+
+    if (ValidateGetShaderSource(context, shader, bufSize, length, source))
+    {
+        context->getShaderSource(shader, bufSize, length, source);
+    }
+}
+
+void GetShaderSourceNoError(Context *context,
+                            GLuint shader,
+                            GLsizei bufSize,
+                            GLsizei *length,
+                            GLchar *source)
+{
+    context->gatherParams<EntryPoint::GetShaderSource>(shader, bufSize, length, source);
+    context->getShaderSource(shader, bufSize, length, source);
+}
+
+const GLubyte *GetStringValidated(Context *context, GLenum name)
+{
+    context->gatherParams<EntryPoint::GetString>(name);
+
+    if (ValidateGetString(context, name))
+    {
+        return context->getString(name);
+    }
+
+    return nullptr;
+}
+
+const GLubyte *GetStringNoError(Context *context, GLenum name)
+{
+    context->gatherParams<EntryPoint::GetString>(name);
+    return context->getString(name);
+}
+
+void GetTexParameterfvValidated(Context *context, GLenum target, GLenum pname, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetTexParameterfv>(target, pname, params);
+
+    if (ValidateGetTexParameterfv(context, target, pname, params))
+    {
+        context->getTexParameterfv(target, pname, params);
+    }
+}
+
+void GetTexParameterfvNoError(Context *context, GLenum target, GLenum pname, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetTexParameterfv>(target, pname, params);
+    context->getTexParameterfv(target, pname, params);
+}
+
+void GetTexParameterivValidated(Context *context, GLenum target, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetTexParameteriv>(target, pname, params);
+
+    if (ValidateGetTexParameteriv(context, target, pname, params))
+    {
+        context->getTexParameteriv(target, pname, params);
+    }
+}
+
+void GetTexParameterivNoError(Context *context, GLenum target, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetTexParameteriv>(target, pname, params);
+    context->getTexParameteriv(target, pname, params);
+}
+
+void GetUniformfvValidated(Context *context, GLuint program, GLint location, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetUniformfv>(program, location, params);
+
+    if (ValidateGetUniformfv(context, program, location, params))
+    {
+        context->getUniformfv(program, location, params);
+    }
+}
+
+void GetUniformfvNoError(Context *context, GLuint program, GLint location, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetUniformfv>(program, location, params);
+    context->getUniformfv(program, location, params);
+}
+
+void GetUniformivValidated(Context *context, GLuint program, GLint location, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetUniformiv>(program, location, params);
+
+    if (ValidateGetUniformiv(context, program, location, params))
+    {
+        context->getUniformiv(program, location, params);
+    }
+}
+
+void GetUniformivNoError(Context *context, GLuint program, GLint location, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetUniformiv>(program, location, params);
+    context->getUniformiv(program, location, params);
+}
+
+GLint GetUniformLocationValidated(Context *context, GLuint program, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetUniformLocation>(program, name);
+
+    if (ValidateGetUniformLocation(context, program, name))
+    {
+        return context->getUniformLocation(program, name);
+    }
+
+    return 0;
+}
+
+GLint GetUniformLocationNoError(Context *context, GLuint program, const GLchar *name)
+{
+    context->gatherParams<EntryPoint::GetUniformLocation>(program, name);
+    return context->getUniformLocation(program, name);
+}
+
+void GetVertexAttribfvValidated(Context *context, GLuint index, GLenum pname, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribfv>(index, pname, params);
+
+    if (ValidateGetVertexAttribfv(context, index, pname, params))
+    {
+        context->getVertexAttribfv(index, pname, params);
+    }
+}
+
+void GetVertexAttribfvNoError(Context *context, GLuint index, GLenum pname, GLfloat *params)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribfv>(index, pname, params);
+    context->getVertexAttribfv(index, pname, params);
+}
+
+void GetVertexAttribivValidated(Context *context, GLuint index, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribiv>(index, pname, params);
+
+    if (ValidateGetVertexAttribiv(context, index, pname, params))
+    {
+        context->getVertexAttribiv(index, pname, params);
+    }
+}
+
+void GetVertexAttribivNoError(Context *context, GLuint index, GLenum pname, GLint *params)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribiv>(index, pname, params);
+    context->getVertexAttribiv(index, pname, params);
+}
+
+void GetVertexAttribPointervValidated(Context *context, GLuint index, GLenum pname, void **pointer)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribPointerv>(index, pname, pointer);
+
+    if (ValidateGetVertexAttribPointerv(context, index, pname, pointer))
+    {
+        context->getVertexAttribPointerv(index, pname, pointer);
+    }
+}
+
+void GetVertexAttribPointervNoError(Context *context, GLuint index, GLenum pname, void **pointer)
+{
+    context->gatherParams<EntryPoint::GetVertexAttribPointerv>(index, pname, pointer);
+    context->getVertexAttribPointerv(index, pname, pointer);
+}
+
+void HintValidated(Context *context, GLenum target, GLenum mode)
+{
+    context->gatherParams<EntryPoint::Hint>(target, mode);
+
+    if (ValidateHint(context, target, mode))
+    {
+        context->hint(target, mode);
+    }
+}
+
+void HintNoError(Context *context, GLenum target, GLenum mode)
+{
+    context->gatherParams<EntryPoint::Hint>(target, mode);
+    context->hint(target, mode);
+}
+
+GLboolean IsBufferValidated(Context *context, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::IsBuffer>(buffer);
+
+    if (ValidateIsBuffer(context, buffer))
+    {
+        return context->isBuffer(buffer);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsBufferNoError(Context *context, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::IsBuffer>(buffer);
+    return context->isBuffer(buffer);
+}
+
+GLboolean IsEnabledValidated(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::IsEnabled>(cap);
+
+    if (ValidateIsEnabled(context, cap))
+    {
+        return context->isEnabled(cap);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsEnabledNoError(Context *context, GLenum cap)
+{
+    context->gatherParams<EntryPoint::IsEnabled>(cap);
+    return context->isEnabled(cap);
+}
+
+GLboolean IsFramebufferValidated(Context *context, GLuint framebuffer)
+{
+    context->gatherParams<EntryPoint::IsFramebuffer>(framebuffer);
+
+    if (ValidateIsFramebuffer(context, framebuffer))
+    {
+        return context->isFramebuffer(framebuffer);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsFramebufferNoError(Context *context, GLuint framebuffer)
+{
+    context->gatherParams<EntryPoint::IsFramebuffer>(framebuffer);
+    return context->isFramebuffer(framebuffer);
+}
+
+GLboolean IsProgramValidated(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::IsProgram>(program);
+
+    if (ValidateIsProgram(context, program))
+    {
+        return context->isProgram(program);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsProgramNoError(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::IsProgram>(program);
+    return context->isProgram(program);
+}
+
+GLboolean IsRenderbufferValidated(Context *context, GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::IsRenderbuffer>(renderbuffer);
+
+    if (ValidateIsRenderbuffer(context, renderbuffer))
+    {
+        return context->isRenderbuffer(renderbuffer);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsRenderbufferNoError(Context *context, GLuint renderbuffer)
+{
+    context->gatherParams<EntryPoint::IsRenderbuffer>(renderbuffer);
+    return context->isRenderbuffer(renderbuffer);
+}
+
+GLboolean IsShaderValidated(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::IsShader>(shader);
+
+    if (ValidateIsShader(context, shader))
+    {
+        return context->isShader(shader);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsShaderNoError(Context *context, GLuint shader)
+{
+    context->gatherParams<EntryPoint::IsShader>(shader);
+    return context->isShader(shader);
+}
+
+GLboolean IsTextureValidated(Context *context, GLuint texture)
+{
+    context->gatherParams<EntryPoint::IsTexture>(texture);
+
+    if (ValidateIsTexture(context, texture))
+    {
+        return context->isTexture(texture);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean IsTextureNoError(Context *context, GLuint texture)
+{
+    context->gatherParams<EntryPoint::IsTexture>(texture);
+    return context->isTexture(texture);
+}
+
+void LineWidthValidated(Context *context, GLfloat width)
+{
+    context->gatherParams<EntryPoint::LineWidth>(width);
+
+    if (ValidateLineWidth(context, width))
+    {
+        context->lineWidth(width);
+    }
+}
+
+void LineWidthNoError(Context *context, GLfloat width)
+{
+    context->gatherParams<EntryPoint::LineWidth>(width);
+    context->lineWidth(width);
+}
+
+void LinkProgramValidated(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::LinkProgram>(program);
+
+    if (ValidateLinkProgram(context, program))
+    {
+        context->linkProgram(program);
+    }
+}
+
+void LinkProgramNoError(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::LinkProgram>(program);
+    context->linkProgram(program);
+}
+
+void PixelStoreiValidated(Context *context, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::PixelStorei>(pname, param);
+
+    if (ValidatePixelStorei(context, pname, param))
+    {
+        context->pixelStorei(pname, param);
+    }
+}
+
+void PixelStoreiNoError(Context *context, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::PixelStorei>(pname, param);
+    context->pixelStorei(pname, param);
+}
+
+void PolygonOffsetValidated(Context *context, GLfloat factor, GLfloat units)
+{
+    context->gatherParams<EntryPoint::PolygonOffset>(factor, units);
+
+    if (ValidatePolygonOffset(context, factor, units))
+    {
+        context->polygonOffset(factor, units);
+    }
+}
+
+void PolygonOffsetNoError(Context *context, GLfloat factor, GLfloat units)
+{
+    context->gatherParams<EntryPoint::PolygonOffset>(factor, units);
+    context->polygonOffset(factor, units);
+}
+
+void ReadPixelsValidated(Context *context,
+                         GLint x,
+                         GLint y,
+                         GLsizei width,
+                         GLsizei height,
+                         GLenum format,
+                         GLenum type,
+                         void *pixels)
+{
+    context->gatherParams<EntryPoint::ReadPixels>(x, y, width, height, format, type, pixels);
+
+    if (ValidateReadPixels(context, x, y, width, height, format, type, pixels))
+    {
+        context->readPixels(x, y, width, height, format, type, pixels);
+    }
+}
+
+void ReadPixelsNoError(Context *context,
+                       GLint x,
+                       GLint y,
+                       GLsizei width,
+                       GLsizei height,
+                       GLenum format,
+                       GLenum type,
+                       void *pixels)
+{
+    context->gatherParams<EntryPoint::ReadPixels>(x, y, width, height, format, type, pixels);
+    context->readPixels(x, y, width, height, format, type, pixels);
+}
+
+void ReleaseShaderCompilerValidated(Context *context)
+{
+    context->gatherParams<EntryPoint::ReleaseShaderCompiler>();
+
+    if (ValidateReleaseShaderCompiler(context))
+    {
+        context->releaseShaderCompiler();
+    }
+}
+
+void ReleaseShaderCompilerNoError(Context *context)
+{
+    context->gatherParams<EntryPoint::ReleaseShaderCompiler>();
+    context->releaseShaderCompiler();
+}
+
+void RenderbufferStorageValidated(Context *context,
+                                  GLenum target,
+                                  GLenum internalformat,
+                                  GLsizei width,
+                                  GLsizei height)
+{
+    context->gatherParams<EntryPoint::RenderbufferStorage>(target, internalformat, width, height);
+
+    if (ValidateRenderbufferStorage(context, target, internalformat, width, height))
+    {
+        context->renderbufferStorage(target, internalformat, width, height);
+    }
+}
+
+void RenderbufferStorageNoError(Context *context,
+                                GLenum target,
+                                GLenum internalformat,
+                                GLsizei width,
+                                GLsizei height)
+{
+    context->gatherParams<EntryPoint::RenderbufferStorage>(target, internalformat, width, height);
+    context->renderbufferStorage(target, internalformat, width, height);
+}
+
+void SampleCoverageValidated(Context *context, GLfloat value, GLboolean invert)
+{
+    context->gatherParams<EntryPoint::SampleCoverage>(value, invert);
+
+    if (ValidateSampleCoverage(context, value, invert))
+    {
+        context->sampleCoverage(value, invert);
+    }
+}
+
+void SampleCoverageNoError(Context *context, GLfloat value, GLboolean invert)
+{
+    context->gatherParams<EntryPoint::SampleCoverage>(value, invert);
+    context->sampleCoverage(value, invert);
+}
+
+void ScissorValidated(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    context->gatherParams<EntryPoint::Scissor>(x, y, width, height);
+
+    if (ValidateScissor(context, x, y, width, height))
+    {
+        context->scissor(x, y, width, height);
+    }
+}
+
+void ScissorNoError(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    context->gatherParams<EntryPoint::Scissor>(x, y, width, height);
+    context->scissor(x, y, width, height);
+}
+
+void ShaderBinaryValidated(Context *context,
+                           GLsizei count,
+                           const GLuint *shaders,
+                           GLenum binaryformat,
+                           const void *binary,
+                           GLsizei length)
+{
+    context->gatherParams<EntryPoint::ShaderBinary>(count, shaders, binaryformat, binary, length);
+
+    if (ValidateShaderBinary(context, count, shaders, binaryformat, binary, length))
+    {
+        context->shaderBinary(count, shaders, binaryformat, binary, length);
+    }
+}
+
+void ShaderBinaryNoError(Context *context,
+                         GLsizei count,
+                         const GLuint *shaders,
+                         GLenum binaryformat,
+                         const void *binary,
+                         GLsizei length)
+{
+    context->gatherParams<EntryPoint::ShaderBinary>(count, shaders, binaryformat, binary, length);
+    context->shaderBinary(count, shaders, binaryformat, binary, length);
+}
+
+void ShaderSourceValidated(Context *context,
+                           GLuint shader,
+                           GLsizei count,
+                           const GLchar *const *string,
+                           const GLint *length)
+{
+    context->gatherParams<EntryPoint::ShaderSource>(shader, count, string, length);
+
+    if (ValidateShaderSource(context, shader, count, string, length))
+    {
+        context->shaderSource(shader, count, string, length);
+    }
+}
+
+void ShaderSourceNoError(Context *context,
+                         GLuint shader,
+                         GLsizei count,
+                         const GLchar *const *string,
+                         const GLint *length)
+{
+    context->gatherParams<EntryPoint::ShaderSource>(shader, count, string, length);
+    context->shaderSource(shader, count, string, length);
+}
+
+void StencilFuncValidated(Context *context, GLenum func, GLint ref, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilFunc>(func, ref, mask);
+
+    if (ValidateStencilFunc(context, func, ref, mask))
+    {
+        context->stencilFunc(func, ref, mask);
+    }
+}
+
+void StencilFuncNoError(Context *context, GLenum func, GLint ref, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilFunc>(func, ref, mask);
+    context->stencilFunc(func, ref, mask);
+}
+
+void StencilFuncSeparateValidated(Context *context,
+                                  GLenum face,
+                                  GLenum func,
+                                  GLint ref,
+                                  GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilFuncSeparate>(face, func, ref, mask);
+
+    if (ValidateStencilFuncSeparate(context, face, func, ref, mask))
+    {
+        context->stencilFuncSeparate(face, func, ref, mask);
+    }
+}
+
+void StencilFuncSeparateNoError(Context *context, GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilFuncSeparate>(face, func, ref, mask);
+    context->stencilFuncSeparate(face, func, ref, mask);
+}
+
+void StencilMaskValidated(Context *context, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilMask>(mask);
+
+    if (ValidateStencilMask(context, mask))
+    {
+        context->stencilMask(mask);
+    }
+}
+
+void StencilMaskNoError(Context *context, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilMask>(mask);
+    context->stencilMask(mask);
+}
+
+void StencilMaskSeparateValidated(Context *context, GLenum face, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilMaskSeparate>(face, mask);
+
+    if (ValidateStencilMaskSeparate(context, face, mask))
+    {
+        context->stencilMaskSeparate(face, mask);
+    }
+}
+
+void StencilMaskSeparateNoError(Context *context, GLenum face, GLuint mask)
+{
+    context->gatherParams<EntryPoint::StencilMaskSeparate>(face, mask);
+    context->stencilMaskSeparate(face, mask);
+}
+
+void StencilOpValidated(Context *context, GLenum fail, GLenum zfail, GLenum zpass)
+{
+    context->gatherParams<EntryPoint::StencilOp>(fail, zfail, zpass);
+
+    if (ValidateStencilOp(context, fail, zfail, zpass))
+    {
+        context->stencilOp(fail, zfail, zpass);
+    }
+}
+
+void StencilOpNoError(Context *context, GLenum fail, GLenum zfail, GLenum zpass)
+{
+    context->gatherParams<EntryPoint::StencilOp>(fail, zfail, zpass);
+    context->stencilOp(fail, zfail, zpass);
+}
+
+void StencilOpSeparateValidated(Context *context,
+                                GLenum face,
+                                GLenum sfail,
+                                GLenum dpfail,
+                                GLenum dppass)
+{
+    context->gatherParams<EntryPoint::StencilOpSeparate>(face, sfail, dpfail, dppass);
+
+    if (ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass))
+    {
+        context->stencilOpSeparate(face, sfail, dpfail, dppass);
+    }
+}
+
+void StencilOpSeparateNoError(Context *context,
+                              GLenum face,
+                              GLenum sfail,
+                              GLenum dpfail,
+                              GLenum dppass)
+{
+    context->gatherParams<EntryPoint::StencilOpSeparate>(face, sfail, dpfail, dppass);
+    context->stencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+void TexImage2DValidated(Context *context,
+                         GLenum target,
+                         GLint level,
+                         GLint internalformat,
+                         GLsizei width,
+                         GLsizei height,
+                         GLint border,
+                         GLenum format,
+                         GLenum type,
+                         const void *pixels)
+{
+    context->gatherParams<EntryPoint::TexImage2D>(target, level, internalformat, width, height,
+                                                  border, format, type, pixels);
+
+    if (ValidateTexImage2D(context, target, level, internalformat, width, height, border, format,
+                           type, pixels))
+    {
+        context->texImage2D(target, level, internalformat, width, height, border, format, type,
+                            pixels);
+    }
+}
+
+void TexImage2DNoError(Context *context,
+                       GLenum target,
+                       GLint level,
+                       GLint internalformat,
+                       GLsizei width,
+                       GLsizei height,
+                       GLint border,
+                       GLenum format,
+                       GLenum type,
+                       const void *pixels)
+{
+    context->gatherParams<EntryPoint::TexImage2D>(target, level, internalformat, width, height,
+                                                  border, format, type, pixels);
+    context->texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+void TexParameterfValidated(Context *context, GLenum target, GLenum pname, GLfloat param)
+{
+    context->gatherParams<EntryPoint::TexParameterf>(target, pname, param);
+
+    if (ValidateTexParameterf(context, target, pname, param))
+    {
+        context->texParameterf(target, pname, param);
+    }
+}
+
+void TexParameterfNoError(Context *context, GLenum target, GLenum pname, GLfloat param)
+{
+    context->gatherParams<EntryPoint::TexParameterf>(target, pname, param);
+    context->texParameterf(target, pname, param);
+}
+
+void TexParameterfvValidated(Context *context, GLenum target, GLenum pname, const GLfloat *params)
+{
+    context->gatherParams<EntryPoint::TexParameterfv>(target, pname, params);
+
+    if (ValidateTexParameterfv(context, target, pname, params))
+    {
+        context->texParameterfv(target, pname, params);
+    }
+}
+
+void TexParameterfvNoError(Context *context, GLenum target, GLenum pname, const GLfloat *params)
+{
+    context->gatherParams<EntryPoint::TexParameterfv>(target, pname, params);
+    context->texParameterfv(target, pname, params);
+}
+
+void TexParameteriValidated(Context *context, GLenum target, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::TexParameteri>(target, pname, param);
+
+    if (ValidateTexParameteri(context, target, pname, param))
+    {
+        context->texParameteri(target, pname, param);
+    }
+}
+
+void TexParameteriNoError(Context *context, GLenum target, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::TexParameteri>(target, pname, param);
+    context->texParameteri(target, pname, param);
+}
+
+void TexParameterivValidated(Context *context, GLenum target, GLenum pname, const GLint *params)
+{
+    context->gatherParams<EntryPoint::TexParameteriv>(target, pname, params);
+
+    if (ValidateTexParameteriv(context, target, pname, params))
+    {
+        context->texParameteriv(target, pname, params);
+    }
+}
+
+void TexParameterivNoError(Context *context, GLenum target, GLenum pname, const GLint *params)
+{
+    context->gatherParams<EntryPoint::TexParameteriv>(target, pname, params);
+    context->texParameteriv(target, pname, params);
+}
+
+void TexSubImage2DValidated(Context *context,
+                            GLenum target,
+                            GLint level,
+                            GLint xoffset,
+                            GLint yoffset,
+                            GLsizei width,
+                            GLsizei height,
+                            GLenum format,
+                            GLenum type,
+                            const void *pixels)
+{
+    context->gatherParams<EntryPoint::TexSubImage2D>(target, level, xoffset, yoffset, width, height,
+                                                     format, type, pixels);
+
+    if (ValidateTexSubImage2D(context, target, level, xoffset, yoffset, width, height, format, type,
+                              pixels))
+    {
+        context->texSubImage2D(target, level, xoffset, yoffset, width, height, format, type,
+                               pixels);
+    }
+}
+
+void TexSubImage2DNoError(Context *context,
+                          GLenum target,
+                          GLint level,
+                          GLint xoffset,
+                          GLint yoffset,
+                          GLsizei width,
+                          GLsizei height,
+                          GLenum format,
+                          GLenum type,
+                          const void *pixels)
+{
+    context->gatherParams<EntryPoint::TexSubImage2D>(target, level, xoffset, yoffset, width, height,
+                                                     format, type, pixels);
+    context->texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+void Uniform1fValidated(Context *context, GLint location, GLfloat v0)
+{
+    context->gatherParams<EntryPoint::Uniform1f>(location, v0);
+
+    if (ValidateUniform1f(context, location, v0))
+    {
+        context->uniform1f(location, v0);
+    }
+}
+
+void Uniform1fNoError(Context *context, GLint location, GLfloat v0)
+{
+    context->gatherParams<EntryPoint::Uniform1f>(location, v0);
+    context->uniform1f(location, v0);
+}
+
+void Uniform1fvValidated(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform1fv>(location, count, value);
+
+    if (ValidateUniform1fv(context, location, count, value))
+    {
+        context->uniform1fv(location, count, value);
+    }
+}
+
+void Uniform1fvNoError(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform1fv>(location, count, value);
+    context->uniform1fv(location, count, value);
+}
+
+void Uniform1iValidated(Context *context, GLint location, GLint v0)
+{
+    context->gatherParams<EntryPoint::Uniform1i>(location, v0);
+
+    if (ValidateUniform1i(context, location, v0))
+    {
+        context->uniform1i(location, v0);
+    }
+}
+
+void Uniform1iNoError(Context *context, GLint location, GLint v0)
+{
+    context->gatherParams<EntryPoint::Uniform1i>(location, v0);
+    context->uniform1i(location, v0);
+}
+
+void Uniform1ivValidated(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform1iv>(location, count, value);
+
+    if (ValidateUniform1iv(context, location, count, value))
+    {
+        context->uniform1iv(location, count, value);
+    }
+}
+
+void Uniform1ivNoError(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform1iv>(location, count, value);
+    context->uniform1iv(location, count, value);
+}
+
+void Uniform2fValidated(Context *context, GLint location, GLfloat v0, GLfloat v1)
+{
+    context->gatherParams<EntryPoint::Uniform2f>(location, v0, v1);
+
+    if (ValidateUniform2f(context, location, v0, v1))
+    {
+        context->uniform2f(location, v0, v1);
+    }
+}
+
+void Uniform2fNoError(Context *context, GLint location, GLfloat v0, GLfloat v1)
+{
+    context->gatherParams<EntryPoint::Uniform2f>(location, v0, v1);
+    context->uniform2f(location, v0, v1);
+}
+
+void Uniform2fvValidated(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform2fv>(location, count, value);
+
+    if (ValidateUniform2fv(context, location, count, value))
+    {
+        context->uniform2fv(location, count, value);
+    }
+}
+
+void Uniform2fvNoError(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform2fv>(location, count, value);
+    context->uniform2fv(location, count, value);
+}
+
+void Uniform2iValidated(Context *context, GLint location, GLint v0, GLint v1)
+{
+    context->gatherParams<EntryPoint::Uniform2i>(location, v0, v1);
+
+    if (ValidateUniform2i(context, location, v0, v1))
+    {
+        context->uniform2i(location, v0, v1);
+    }
+}
+
+void Uniform2iNoError(Context *context, GLint location, GLint v0, GLint v1)
+{
+    context->gatherParams<EntryPoint::Uniform2i>(location, v0, v1);
+    context->uniform2i(location, v0, v1);
+}
+
+void Uniform2ivValidated(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform2iv>(location, count, value);
+
+    if (ValidateUniform2iv(context, location, count, value))
+    {
+        context->uniform2iv(location, count, value);
+    }
+}
+
+void Uniform2ivNoError(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform2iv>(location, count, value);
+    context->uniform2iv(location, count, value);
+}
+
+void Uniform3fValidated(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    context->gatherParams<EntryPoint::Uniform3f>(location, v0, v1, v2);
+
+    if (ValidateUniform3f(context, location, v0, v1, v2))
+    {
+        context->uniform3f(location, v0, v1, v2);
+    }
+}
+
+void Uniform3fNoError(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    context->gatherParams<EntryPoint::Uniform3f>(location, v0, v1, v2);
+    context->uniform3f(location, v0, v1, v2);
+}
+
+void Uniform3fvValidated(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform3fv>(location, count, value);
+
+    if (ValidateUniform3fv(context, location, count, value))
+    {
+        context->uniform3fv(location, count, value);
+    }
+}
+
+void Uniform3fvNoError(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform3fv>(location, count, value);
+    context->uniform3fv(location, count, value);
+}
+
+void Uniform3iValidated(Context *context, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    context->gatherParams<EntryPoint::Uniform3i>(location, v0, v1, v2);
+
+    if (ValidateUniform3i(context, location, v0, v1, v2))
+    {
+        context->uniform3i(location, v0, v1, v2);
+    }
+}
+
+void Uniform3iNoError(Context *context, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    context->gatherParams<EntryPoint::Uniform3i>(location, v0, v1, v2);
+    context->uniform3i(location, v0, v1, v2);
+}
+
+void Uniform3ivValidated(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform3iv>(location, count, value);
+
+    if (ValidateUniform3iv(context, location, count, value))
+    {
+        context->uniform3iv(location, count, value);
+    }
+}
+
+void Uniform3ivNoError(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform3iv>(location, count, value);
+    context->uniform3iv(location, count, value);
+}
+
+void Uniform4fValidated(Context *context,
+                        GLint location,
+                        GLfloat v0,
+                        GLfloat v1,
+                        GLfloat v2,
+                        GLfloat v3)
+{
+    context->gatherParams<EntryPoint::Uniform4f>(location, v0, v1, v2, v3);
+
+    if (ValidateUniform4f(context, location, v0, v1, v2, v3))
+    {
+        context->uniform4f(location, v0, v1, v2, v3);
+    }
+}
+
+void Uniform4fNoError(Context *context,
+                      GLint location,
+                      GLfloat v0,
+                      GLfloat v1,
+                      GLfloat v2,
+                      GLfloat v3)
+{
+    context->gatherParams<EntryPoint::Uniform4f>(location, v0, v1, v2, v3);
+    context->uniform4f(location, v0, v1, v2, v3);
+}
+
+void Uniform4fvValidated(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform4fv>(location, count, value);
+
+    if (ValidateUniform4fv(context, location, count, value))
+    {
+        context->uniform4fv(location, count, value);
+    }
+}
+
+void Uniform4fvNoError(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::Uniform4fv>(location, count, value);
+    context->uniform4fv(location, count, value);
+}
+
+void Uniform4iValidated(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    context->gatherParams<EntryPoint::Uniform4i>(location, v0, v1, v2, v3);
+
+    if (ValidateUniform4i(context, location, v0, v1, v2, v3))
+    {
+        context->uniform4i(location, v0, v1, v2, v3);
+    }
+}
+
+void Uniform4iNoError(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    context->gatherParams<EntryPoint::Uniform4i>(location, v0, v1, v2, v3);
+    context->uniform4i(location, v0, v1, v2, v3);
+}
+
+void Uniform4ivValidated(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform4iv>(location, count, value);
+
+    if (ValidateUniform4iv(context, location, count, value))
+    {
+        context->uniform4iv(location, count, value);
+    }
+}
+
+void Uniform4ivNoError(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    context->gatherParams<EntryPoint::Uniform4iv>(location, count, value);
+    context->uniform4iv(location, count, value);
+}
+
+void UniformMatrix2fvValidated(Context *context,
+                               GLint location,
+                               GLsizei count,
+                               GLboolean transpose,
+                               const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix2fv>(location, count, transpose, value);
+
+    if (ValidateUniformMatrix2fv(context, location, count, transpose, value))
+    {
+        context->uniformMatrix2fv(location, count, transpose, value);
+    }
+}
+
+void UniformMatrix2fvNoError(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix2fv>(location, count, transpose, value);
+    context->uniformMatrix2fv(location, count, transpose, value);
+}
+
+void UniformMatrix3fvValidated(Context *context,
+                               GLint location,
+                               GLsizei count,
+                               GLboolean transpose,
+                               const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix3fv>(location, count, transpose, value);
+
+    if (ValidateUniformMatrix3fv(context, location, count, transpose, value))
+    {
+        context->uniformMatrix3fv(location, count, transpose, value);
+    }
+}
+
+void UniformMatrix3fvNoError(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix3fv>(location, count, transpose, value);
+    context->uniformMatrix3fv(location, count, transpose, value);
+}
+
+void UniformMatrix4fvValidated(Context *context,
+                               GLint location,
+                               GLsizei count,
+                               GLboolean transpose,
+                               const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix4fv>(location, count, transpose, value);
+
+    if (ValidateUniformMatrix4fv(context, location, count, transpose, value))
+    {
+        context->uniformMatrix4fv(location, count, transpose, value);
+    }
+}
+
+void UniformMatrix4fvNoError(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value)
+{
+    context->gatherParams<EntryPoint::UniformMatrix4fv>(location, count, transpose, value);
+    context->uniformMatrix4fv(location, count, transpose, value);
+}
+
+void UseProgramValidated(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::UseProgram>(program);
+
+    if (ValidateUseProgram(context, program))
+    {
+        context->useProgram(program);
+    }
+}
+
+void UseProgramNoError(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::UseProgram>(program);
+    context->useProgram(program);
+}
+
+void ValidateProgramValidated(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::ValidateProgram>(program);
+
+    if (ValidateValidateProgram(context, program))
+    {
+        context->validateProgram(program);
+    }
+}
+
+void ValidateProgramNoError(Context *context, GLuint program)
+{
+    context->gatherParams<EntryPoint::ValidateProgram>(program);
+    context->validateProgram(program);
+}
+
+void VertexAttrib1fValidated(Context *context, GLuint index, GLfloat x)
+{
+    context->gatherParams<EntryPoint::VertexAttrib1f>(index, x);
+
+    if (ValidateVertexAttrib1f(context, index, x))
+    {
+        context->vertexAttrib1f(index, x);
+    }
+}
+
+void VertexAttrib1fNoError(Context *context, GLuint index, GLfloat x)
+{
+    context->gatherParams<EntryPoint::VertexAttrib1f>(index, x);
+    context->vertexAttrib1f(index, x);
+}
+
+void VertexAttrib1fvValidated(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib1fv>(index, v);
+
+    if (ValidateVertexAttrib1fv(context, index, v))
+    {
+        context->vertexAttrib1fv(index, v);
+    }
+}
+
+void VertexAttrib1fvNoError(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib1fv>(index, v);
+    context->vertexAttrib1fv(index, v);
+}
+
+void VertexAttrib2fValidated(Context *context, GLuint index, GLfloat x, GLfloat y)
+{
+    context->gatherParams<EntryPoint::VertexAttrib2f>(index, x, y);
+
+    if (ValidateVertexAttrib2f(context, index, x, y))
+    {
+        context->vertexAttrib2f(index, x, y);
+    }
+}
+
+void VertexAttrib2fNoError(Context *context, GLuint index, GLfloat x, GLfloat y)
+{
+    context->gatherParams<EntryPoint::VertexAttrib2f>(index, x, y);
+    context->vertexAttrib2f(index, x, y);
+}
+
+void VertexAttrib2fvValidated(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib2fv>(index, v);
+
+    if (ValidateVertexAttrib2fv(context, index, v))
+    {
+        context->vertexAttrib2fv(index, v);
+    }
+}
+
+void VertexAttrib2fvNoError(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib2fv>(index, v);
+    context->vertexAttrib2fv(index, v);
+}
+
+void VertexAttrib3fValidated(Context *context, GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    context->gatherParams<EntryPoint::VertexAttrib3f>(index, x, y, z);
+
+    if (ValidateVertexAttrib3f(context, index, x, y, z))
+    {
+        context->vertexAttrib3f(index, x, y, z);
+    }
+}
+
+void VertexAttrib3fNoError(Context *context, GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    context->gatherParams<EntryPoint::VertexAttrib3f>(index, x, y, z);
+    context->vertexAttrib3f(index, x, y, z);
+}
+
+void VertexAttrib3fvValidated(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib3fv>(index, v);
+
+    if (ValidateVertexAttrib3fv(context, index, v))
+    {
+        context->vertexAttrib3fv(index, v);
+    }
+}
+
+void VertexAttrib3fvNoError(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib3fv>(index, v);
+    context->vertexAttrib3fv(index, v);
+}
+
+void VertexAttrib4fValidated(Context *context,
+                             GLuint index,
+                             GLfloat x,
+                             GLfloat y,
+                             GLfloat z,
+                             GLfloat w)
+{
+    context->gatherParams<EntryPoint::VertexAttrib4f>(index, x, y, z, w);
+
+    if (ValidateVertexAttrib4f(context, index, x, y, z, w))
+    {
+        context->vertexAttrib4f(index, x, y, z, w);
+    }
+}
+
+void VertexAttrib4fNoError(Context *context,
+                           GLuint index,
+                           GLfloat x,
+                           GLfloat y,
+                           GLfloat z,
+                           GLfloat w)
+{
+    context->gatherParams<EntryPoint::VertexAttrib4f>(index, x, y, z, w);
+    context->vertexAttrib4f(index, x, y, z, w);
+}
+
+void VertexAttrib4fvValidated(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib4fv>(index, v);
+
+    if (ValidateVertexAttrib4fv(context, index, v))
+    {
+        context->vertexAttrib4fv(index, v);
+    }
+}
+
+void VertexAttrib4fvNoError(Context *context, GLuint index, const GLfloat *v)
+{
+    context->gatherParams<EntryPoint::VertexAttrib4fv>(index, v);
+    context->vertexAttrib4fv(index, v);
+}
+
+void VertexAttribPointerValidated(Context *context,
+                                  GLuint index,
+                                  GLint size,
+                                  GLenum type,
+                                  GLboolean normalized,
+                                  GLsizei stride,
+                                  const void *pointer)
+{
+    context->gatherParams<EntryPoint::VertexAttribPointer>(index, size, type, normalized, stride,
+                                                           pointer);
+
+    if (ValidateVertexAttribPointer(context, index, size, type, normalized, stride, pointer))
+    {
+        context->vertexAttribPointer(index, size, type, normalized, stride, pointer);
+    }
+}
+
+void VertexAttribPointerNoError(Context *context,
+                                GLuint index,
+                                GLint size,
+                                GLenum type,
+                                GLboolean normalized,
+                                GLsizei stride,
+                                const void *pointer)
+{
+    context->gatherParams<EntryPoint::VertexAttribPointer>(index, size, type, normalized, stride,
+                                                           pointer);
+    context->vertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+void ViewportValidated(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    context->gatherParams<EntryPoint::Viewport>(x, y, width, height);
+
+    if (ValidateViewport(context, x, y, width, height))
+    {
+        context->viewport(x, y, width, height);
+    }
+}
+
+void ViewportNoError(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    context->gatherParams<EntryPoint::Viewport>(x, y, width, height);
+    context->viewport(x, y, width, height);
+}
+
+void ReadBufferValidated(Context *context, GLenum src)
+{
+    context->gatherParams<EntryPoint::ReadBuffer>(src);
+
+    if (ValidateReadBuffer(context, src))
+    {
+        context->readBuffer(src);
+    }
+}
+
+void ReadBufferNoError(Context *context, GLenum src)
+{
+    context->gatherParams<EntryPoint::ReadBuffer>(src);
+    context->readBuffer(src);
+}
+
+void CopyTexSubImage3DValidated(Context *context,
+                                GLenum target,
+                                GLint level,
+                                GLint xoffset,
+                                GLint yoffset,
+                                GLint zoffset,
+                                GLint x,
+                                GLint y,
+                                GLsizei width,
+                                GLsizei height)
+{
+    context->gatherParams<EntryPoint::CopyTexSubImage3D>(target, level, xoffset, yoffset, zoffset,
+                                                         x, y, width, height);
+
+    if (ValidateCopyTexSubImage3D(context, target, level, xoffset, yoffset, zoffset, x, y, width,
+                                  height))
+    {
+        context->copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    }
+}
+
+void CopyTexSubImage3DNoError(Context *context,
+                              GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLint zoffset,
+                              GLint x,
+                              GLint y,
+                              GLsizei width,
+                              GLsizei height)
+{
+    context->gatherParams<EntryPoint::CopyTexSubImage3D>(target, level, xoffset, yoffset, zoffset,
+                                                         x, y, width, height);
+    context->copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+void BlitFramebufferValidated(Context *context,
+                              GLint srcX0,
+                              GLint srcY0,
+                              GLint srcX1,
+                              GLint srcY1,
+                              GLint dstX0,
+                              GLint dstY0,
+                              GLint dstX1,
+                              GLint dstY1,
+                              GLbitfield mask,
+                              GLenum filter)
+{
+    context->gatherParams<EntryPoint::BlitFramebuffer>(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                                                       dstX1, dstY1, mask, filter);
+
+    if (ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1,
+                                mask, filter))
+    {
+        context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
+                                 filter);
+    }
+}
+
+void BlitFramebufferNoError(Context *context,
+                            GLint srcX0,
+                            GLint srcY0,
+                            GLint srcX1,
+                            GLint srcY1,
+                            GLint dstX0,
+                            GLint dstY0,
+                            GLint dstX1,
+                            GLint dstY1,
+                            GLbitfield mask,
+                            GLenum filter)
+{
+    context->gatherParams<EntryPoint::BlitFramebuffer>(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                                                       dstX1, dstY1, mask, filter);
+    context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+void RenderbufferStorageMultisampleValidated(Context *context,
+                                             GLenum target,
+                                             GLsizei samples,
+                                             GLenum internalformat,
+                                             GLsizei width,
+                                             GLsizei height)
+{
+    context->gatherParams<EntryPoint::RenderbufferStorageMultisample>(target, samples,
+                                                                      internalformat, width,
+                                                                      height);
+
+    if (ValidateRenderbufferStorageMultisample(context, target, samples, internalformat, width,
+                                               height))
+    {
+        context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
+    }
+}
+
+void RenderbufferStorageMultisampleNoError(Context *context,
+                                           GLenum target,
+                                           GLsizei samples,
+                                           GLenum internalformat,
+                                           GLsizei width,
+                                           GLsizei height)
+{
+    context->gatherParams<EntryPoint::RenderbufferStorageMultisample>(target, samples,
+                                                                      internalformat, width,
+                                                                      height);
+    context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+void FlushMappedBufferRangeValidated(Context *context,
+                                     GLenum target,
+                                     GLintptr offset,
+                                     GLsizeiptr length)
+{
+    context->gatherParams<EntryPoint::FlushMappedBufferRange>(target, offset, length);
+
+    if (ValidateFlushMappedBufferRange(context, target, offset, length))
+    {
+        context->flushMappedBufferRange(target, offset, length);
+    }
+}
+
+void FlushMappedBufferRangeNoError(Context *context,
+                                   GLenum target,
+                                   GLintptr offset,
+                                   GLsizeiptr length)
+{
+    context->gatherParams<EntryPoint::FlushMappedBufferRange>(target, offset, length);
+    context->flushMappedBufferRange(target, offset, length);
+}
+
+void BindVertexArrayValidated(Context *context, GLuint array)
+{
+    context->gatherParams<EntryPoint::BindVertexArray>(array);
+
+    if (ValidateBindVertexArray(context, array))
+    {
+        context->bindVertexArray(array);
+    }
+}
+
+void BindVertexArrayNoError(Context *context, GLuint array)
+{
+    context->gatherParams<EntryPoint::BindVertexArray>(array);
+    context->bindVertexArray(array);
+}
+
+void BeginTransformFeedbackValidated(Context *context, GLenum primitiveMode)
+{
+    context->gatherParams<EntryPoint::BeginTransformFeedback>(primitiveMode);
+
+    if (ValidateBeginTransformFeedback(context, primitiveMode))
+    {
+        context->beginTransformFeedback(primitiveMode);
+    }
+}
+
+void BeginTransformFeedbackNoError(Context *context, GLenum primitiveMode)
+{
+    context->gatherParams<EntryPoint::BeginTransformFeedback>(primitiveMode);
+    context->beginTransformFeedback(primitiveMode);
+}
+
+void BindBufferBaseValidated(Context *context, GLenum target, GLuint index, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::BindBufferBase>(target, index, buffer);
+
+    if (ValidateBindBufferBase(context, target, index, buffer))
+    {
+        context->bindBufferBase(target, index, buffer);
+    }
+}
+
+void BindBufferBaseNoError(Context *context, GLenum target, GLuint index, GLuint buffer)
+{
+    context->gatherParams<EntryPoint::BindBufferBase>(target, index, buffer);
+    context->bindBufferBase(target, index, buffer);
+}
+
+void ClearBufferfiValidated(Context *context,
+                            GLenum buffer,
+                            GLint drawbuffer,
+                            GLfloat depth,
+                            GLint stencil)
+{
+    context->gatherParams<EntryPoint::ClearBufferfi>(buffer, drawbuffer, depth, stencil);
+
+    if (ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil))
+    {
+        context->clearBufferfi(buffer, drawbuffer, depth, stencil);
+    }
+}
+
+void ClearBufferfiNoError(Context *context,
+                          GLenum buffer,
+                          GLint drawbuffer,
+                          GLfloat depth,
+                          GLint stencil)
+{
+    context->gatherParams<EntryPoint::ClearBufferfi>(buffer, drawbuffer, depth, stencil);
+    context->clearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+void CopyBufferSubDataValidated(Context *context,
+                                GLenum readTarget,
+                                GLenum writeTarget,
+                                GLintptr readOffset,
+                                GLintptr writeOffset,
+                                GLsizeiptr size)
+{
+    context->gatherParams<EntryPoint::CopyBufferSubData>(readTarget, writeTarget, readOffset,
+                                                         writeOffset, size);
+
+    if (ValidateCopyBufferSubData(context, readTarget, writeTarget, readOffset, writeOffset, size))
+    {
+        context->copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    }
+}
+
+void CopyBufferSubDataNoError(Context *context,
+                              GLenum readTarget,
+                              GLenum writeTarget,
+                              GLintptr readOffset,
+                              GLintptr writeOffset,
+                              GLsizeiptr size)
+{
+    context->gatherParams<EntryPoint::CopyBufferSubData>(readTarget, writeTarget, readOffset,
+                                                         writeOffset, size);
+    context->copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+void DrawArraysInstancedValidated(Context *context,
+                                  GLenum mode,
+                                  GLint first,
+                                  GLsizei count,
+                                  GLsizei instancecount)
+{
+    context->gatherParams<EntryPoint::DrawArraysInstanced>(mode, first, count, instancecount);
+
+    if (ValidateDrawArraysInstanced(context, mode, first, count, instancecount))
+    {
+        context->drawArraysInstanced(mode, first, count, instancecount);
+    }
+}
+
+void DrawArraysInstancedNoError(Context *context,
+                                GLenum mode,
+                                GLint first,
+                                GLsizei count,
+                                GLsizei instancecount)
+{
+    context->gatherParams<EntryPoint::DrawArraysInstanced>(mode, first, count, instancecount);
+    context->drawArraysInstanced(mode, first, count, instancecount);
+}
+
+void SamplerParameteriValidated(Context *context, GLuint sampler, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::SamplerParameteri>(sampler, pname, param);
+
+    if (ValidateSamplerParameteri(context, sampler, pname, param))
+    {
+        context->samplerParameteri(sampler, pname, param);
+    }
+}
+
+void SamplerParameteriNoError(Context *context, GLuint sampler, GLenum pname, GLint param)
+{
+    context->gatherParams<EntryPoint::SamplerParameteri>(sampler, pname, param);
+    context->samplerParameteri(sampler, pname, param);
+}
+
+void SamplerParameterfValidated(Context *context, GLuint sampler, GLenum pname, GLfloat param)
+{
+    context->gatherParams<EntryPoint::SamplerParameterf>(sampler, pname, param);
+
+    if (ValidateSamplerParameterf(context, sampler, pname, param))
+    {
+        context->samplerParameterf(sampler, pname, param);
+    }
+}
+
+void SamplerParameterfNoError(Context *context, GLuint sampler, GLenum pname, GLfloat param)
+{
+    context->gatherParams<EntryPoint::SamplerParameterf>(sampler, pname, param);
+    context->samplerParameterf(sampler, pname, param);
+}
+
+void ProgramParameteriValidated(Context *context, GLuint program, GLenum pname, GLint value)
+{
+    context->gatherParams<EntryPoint::ProgramParameteri>(program, pname, value);
+
+    if (ValidateProgramParameteri(context, program, pname, value))
+    {
+        context->programParameteri(program, pname, value);
+    }
+}
+
+void ProgramParameteriNoError(Context *context, GLuint program, GLenum pname, GLint value)
+{
+    context->gatherParams<EntryPoint::ProgramParameteri>(program, pname, value);
+    context->programParameteri(program, pname, value);
+}
+
+}  // anonymous namespace
+
+const DispatchTable kValidatedDispatchTable = {
+    ActiveTextureValidated,
+    AttachShaderValidated,
+    BindAttribLocationValidated,
+    BindBufferValidated,
+    BindFramebufferValidated,
+    BindRenderbufferValidated,
+    BindTextureValidated,
+    BlendColorValidated,
+    BlendEquationValidated,
+    BlendEquationSeparateValidated,
+    BlendFuncValidated,
+    BlendFuncSeparateValidated,
+    BufferDataValidated,
+    BufferSubDataValidated,
+    CheckFramebufferStatusValidated,
+    ClearValidated,
+    ClearColorValidated,
+    ClearDepthfValidated,
+    ClearStencilValidated,
+    ColorMaskValidated,
+    CompileShaderValidated,
+    CompressedTexImage2DValidated,
+    CompressedTexSubImage2DValidated,
+    CopyTexImage2DValidated,
+    CopyTexSubImage2DValidated,
+    CreateProgramValidated,
+    CreateShaderValidated,
+    CullFaceValidated,
+    DeleteBuffersValidated,
+    DeleteFramebuffersValidated,
+    DeleteProgramValidated,
+    DeleteRenderbuffersValidated,
+    DeleteShaderValidated,
+    DeleteTexturesValidated,
+    DepthFuncValidated,
+    DepthMaskValidated,
+    DepthRangefValidated,
+    DetachShaderValidated,
+    DisableValidated,
+    DisableVertexAttribArrayValidated,
+    DrawArraysValidated,
+    DrawElementsValidated,
+    EnableValidated,
+    EnableVertexAttribArrayValidated,
+    FinishValidated,
+    FlushValidated,
+    FramebufferRenderbufferValidated,
+    FramebufferTexture2DValidated,
+    FrontFaceValidated,
+    GenBuffersValidated,
+    GenerateMipmapValidated,
+    GenFramebuffersValidated,
+    GenRenderbuffersValidated,
+    GenTexturesValidated,
+    GetActiveAttribValidated,
+    GetActiveUniformValidated,
+    GetAttachedShadersValidated,
+    GetAttribLocationValidated,
+    GetBooleanvValidated,
+    GetBufferParameterivValidated,
+    GetErrorValidated,
+    GetFloatvValidated,
+    GetFramebufferAttachmentParameterivValidated,
+    GetIntegervValidated,
+    GetProgramivValidated,
+    GetProgramInfoLogValidated,
+    GetRenderbufferParameterivValidated,
+    GetShaderivValidated,
+    GetShaderInfoLogValidated,
+    GetShaderPrecisionFormatValidated,
+    GetShaderSourceValidated,
+    GetStringValidated,
+    GetTexParameterfvValidated,
+    GetTexParameterivValidated,
+    GetUniformfvValidated,
+    GetUniformivValidated,
+    GetUniformLocationValidated,
+    GetVertexAttribfvValidated,
+    GetVertexAttribivValidated,
+    GetVertexAttribPointervValidated,
+    HintValidated,
+    IsBufferValidated,
+    IsEnabledValidated,
+    IsFramebufferValidated,
+    IsProgramValidated,
+    IsRenderbufferValidated,
+    IsShaderValidated,
+    IsTextureValidated,
+    LineWidthValidated,
+    LinkProgramValidated,
+    PixelStoreiValidated,
+    PolygonOffsetValidated,
+    ReadPixelsValidated,
+    ReleaseShaderCompilerValidated,
+    RenderbufferStorageValidated,
+    SampleCoverageValidated,
+    ScissorValidated,
+    ShaderBinaryValidated,
+    ShaderSourceValidated,
+    StencilFuncValidated,
+    StencilFuncSeparateValidated,
+    StencilMaskValidated,
+    StencilMaskSeparateValidated,
+    StencilOpValidated,
+    StencilOpSeparateValidated,
+    TexImage2DValidated,
+    TexParameterfValidated,
+    TexParameterfvValidated,
+    TexParameteriValidated,
+    TexParameterivValidated,
+    TexSubImage2DValidated,
+    Uniform1fValidated,
+    Uniform1fvValidated,
+    Uniform1iValidated,
+    Uniform1ivValidated,
+    Uniform2fValidated,
+    Uniform2fvValidated,
+    Uniform2iValidated,
+    Uniform2ivValidated,
+    Uniform3fValidated,
+    Uniform3fvValidated,
+    Uniform3iValidated,
+    Uniform3ivValidated,
+    Uniform4fValidated,
+    Uniform4fvValidated,
+    Uniform4iValidated,
+    Uniform4ivValidated,
+    UniformMatrix2fvValidated,
+    UniformMatrix3fvValidated,
+    UniformMatrix4fvValidated,
+    UseProgramValidated,
+    ValidateProgramValidated,
+    VertexAttrib1fValidated,
+    VertexAttrib1fvValidated,
+    VertexAttrib2fValidated,
+    VertexAttrib2fvValidated,
+    VertexAttrib3fValidated,
+    VertexAttrib3fvValidated,
+    VertexAttrib4fValidated,
+    VertexAttrib4fvValidated,
+    VertexAttribPointerValidated,
+    ViewportValidated,
+    ReadBufferValidated,
+    CopyTexSubImage3DValidated,
+    BlitFramebufferValidated,
+    RenderbufferStorageMultisampleValidated,
+    FlushMappedBufferRangeValidated,
+    BindVertexArrayValidated,
+    BeginTransformFeedbackValidated,
+    BindBufferBaseValidated,
+    ClearBufferfiValidated,
+    CopyBufferSubDataValidated,
+    DrawArraysInstancedValidated,
+    SamplerParameteriValidated,
+    SamplerParameterfValidated,
+    ProgramParameteriValidated
+};
+
+const DispatchTable kNoErrorDispatchTable = {
+    ActiveTextureNoError,
+    AttachShaderNoError,
+    BindAttribLocationNoError,
+    BindBufferNoError,
+    BindFramebufferNoError,
+    BindRenderbufferNoError,
+    BindTextureNoError,
+    BlendColorNoError,
+    BlendEquationNoError,
+    BlendEquationSeparateNoError,
+    BlendFuncNoError,
+    BlendFuncSeparateNoError,
+    BufferDataNoError,
+    BufferSubDataNoError,
+    CheckFramebufferStatusNoError,
+    ClearNoError,
+    ClearColorNoError,
+    ClearDepthfNoError,
+    ClearStencilNoError,
+    ColorMaskNoError,
+    CompileShaderNoError,
+    CompressedTexImage2DNoError,
+    CompressedTexSubImage2DNoError,
+    CopyTexImage2DNoError,
+    CopyTexSubImage2DNoError,
+    CreateProgramNoError,
+    CreateShaderNoError,
+    CullFaceNoError,
+    DeleteBuffersNoError,
+    DeleteFramebuffersNoError,
+    DeleteProgramNoError,
+    DeleteRenderbuffersNoError,
+    DeleteShaderNoError,
+    DeleteTexturesNoError,
+    DepthFuncNoError,
+    DepthMaskNoError,
+    DepthRangefNoError,
+    DetachShaderNoError,
+    DisableNoError,
+    DisableVertexAttribArrayNoError,
+    DrawArraysNoError,
+    DrawElementsNoError,
+    EnableNoError,
+    EnableVertexAttribArrayNoError,
+    FinishNoError,
+    FlushNoError,
+    FramebufferRenderbufferNoError,
+    FramebufferTexture2DNoError,
+    FrontFaceNoError,
+    GenBuffersNoError,
+    GenerateMipmapNoError,
+    GenFramebuffersNoError,
+    GenRenderbuffersNoError,
+    GenTexturesNoError,
+    GetActiveAttribNoError,
+    GetActiveUniformNoError,
+    GetAttachedShadersNoError,
+    GetAttribLocationNoError,
+    GetBooleanvNoError,
+    GetBufferParameterivNoError,
+    GetErrorNoError,
+    GetFloatvNoError,
+    GetFramebufferAttachmentParameterivNoError,
+    GetIntegervNoError,
+    GetProgramivNoError,
+    GetProgramInfoLogNoError,
+    GetRenderbufferParameterivNoError,
+    GetShaderivNoError,
+    GetShaderInfoLogNoError,
+    GetShaderPrecisionFormatNoError,
+    GetShaderSourceNoError,
+    GetStringNoError,
+    GetTexParameterfvNoError,
+    GetTexParameterivNoError,
+    GetUniformfvNoError,
+    GetUniformivNoError,
+    GetUniformLocationNoError,
+    GetVertexAttribfvNoError,
+    GetVertexAttribivNoError,
+    GetVertexAttribPointervNoError,
+    HintNoError,
+    IsBufferNoError,
+    IsEnabledNoError,
+    IsFramebufferNoError,
+    IsProgramNoError,
+    IsRenderbufferNoError,
+    IsShaderNoError,
+    IsTextureNoError,
+    LineWidthNoError,
+    LinkProgramNoError,
+    PixelStoreiNoError,
+    PolygonOffsetNoError,
+    ReadPixelsNoError,
+    ReleaseShaderCompilerNoError,
+    RenderbufferStorageNoError,
+    SampleCoverageNoError,
+    ScissorNoError,
+    ShaderBinaryNoError,
+    ShaderSourceNoError,
+    StencilFuncNoError,
+    StencilFuncSeparateNoError,
+    StencilMaskNoError,
+    StencilMaskSeparateNoError,
+    StencilOpNoError,
+    StencilOpSeparateNoError,
+    TexImage2DNoError,
+    TexParameterfNoError,
+    TexParameterfvNoError,
+    TexParameteriNoError,
+    TexParameterivNoError,
+    TexSubImage2DNoError,
+    Uniform1fNoError,
+    Uniform1fvNoError,
+    Uniform1iNoError,
+    Uniform1ivNoError,
+    Uniform2fNoError,
+    Uniform2fvNoError,
+    Uniform2iNoError,
+    Uniform2ivNoError,
+    Uniform3fNoError,
+    Uniform3fvNoError,
+    Uniform3iNoError,
+    Uniform3ivNoError,
+    Uniform4fNoError,
+    Uniform4fvNoError,
+    Uniform4iNoError,
+    Uniform4ivNoError,
+    UniformMatrix2fvNoError,
+    UniformMatrix3fvNoError,
+    UniformMatrix4fvNoError,
+    UseProgramNoError,
+    ValidateProgramNoError,
+    VertexAttrib1fNoError,
+    VertexAttrib1fvNoError,
+    VertexAttrib2fNoError,
+    VertexAttrib2fvNoError,
+    VertexAttrib3fNoError,
+    VertexAttrib3fvNoError,
+    VertexAttrib4fNoError,
+    VertexAttrib4fvNoError,
+    VertexAttribPointerNoError,
+    ViewportNoError,
+    ReadBufferNoError,
+    CopyTexSubImage3DNoError,
+    BlitFramebufferNoError,
+    RenderbufferStorageMultisampleNoError,
+    FlushMappedBufferRangeNoError,
+    BindVertexArrayNoError,
+    BeginTransformFeedbackNoError,
+    BindBufferBaseNoError,
+    ClearBufferfiNoError,
+    CopyBufferSubDataNoError,
+    DrawArraysInstancedNoError,
+    SamplerParameteriNoError,
+    SamplerParameterfNoError,
+    ProgramParameteriNoError
+};
+
+const DispatchTable kContextLostDispatchTable = {
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLuint, GLuint>,
+    ContextLost<void, GLuint, GLuint, const GLchar *>,
+    ContextLost<void, GLenum, GLuint>,
+    ContextLost<void, GLenum, GLuint>,
+    ContextLost<void, GLenum, GLuint>,
+    ContextLost<void, GLenum, GLuint>,
+    ContextLost<void, GLfloat, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLenum, GLenum>,
+    ContextLost<void, GLenum, GLenum>,
+    ContextLost<void, GLenum, GLenum, GLenum, GLenum>,
+    ContextLost<void, GLenum, GLsizeiptr, const void *, GLenum>,
+    ContextLost<void, GLenum, GLintptr, GLsizeiptr, const void *>,
+    ContextLost<GLenum, GLenum>,
+    ContextLost<void, GLbitfield>,
+    ContextLost<void, GLfloat, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLfloat>,
+    ContextLost<void, GLint>,
+    ContextLost<void, GLboolean, GLboolean, GLboolean, GLboolean>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *>,
+    ContextLost<void, GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *>,
+    ContextLost<void, GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint>,
+    ContextLost<void, GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei>,
+    ContextLost<GLuint>,
+    ContextLost<GLuint, GLenum>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLsizei, const GLuint *>,
+    ContextLost<void, GLsizei, const GLuint *>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLsizei, const GLuint *>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLsizei, const GLuint *>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLboolean>,
+    ContextLost<void, GLfloat, GLfloat>,
+    ContextLost<void, GLuint, GLuint>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLenum, GLint, GLsizei>,
+    ContextLost<void, GLenum, GLsizei, GLenum, const void *>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLuint>,
+    ContextLost<void>,
+    ContextLost<void>,
+    ContextLost<void, GLenum, GLenum, GLenum, GLuint>,
+    ContextLost<void, GLenum, GLenum, GLenum, GLuint, GLint>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLsizei, GLuint *>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLsizei, GLuint *>,
+    ContextLost<void, GLsizei, GLuint *>,
+    ContextLost<void, GLsizei, GLuint *>,
+    ContextLost<void, GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *>,
+    ContextLost<void, GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *>,
+    ContextLost<void, GLuint, GLsizei, GLsizei *, GLuint *>,
+    ContextLost<GLint, GLuint, const GLchar *>,
+    ContextLost<void, GLenum, GLboolean *>,
+    ContextLost<void, GLenum, GLenum, GLint *>,
+    GetErrorValidated,
+    ContextLost<void, GLenum, GLfloat *>,
+    ContextLost<void, GLenum, GLenum, GLenum, GLint *>,
+    ContextLost<void, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLsizei, GLsizei *, GLchar *>,
+    ContextLost<void, GLenum, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLsizei, GLsizei *, GLchar *>,
+    ContextLost<void, GLenum, GLenum, GLint *, GLint *>,
+    ContextLost<void, GLuint, GLsizei, GLsizei *, GLchar *>,
+    ContextLost<const GLubyte *, GLenum>,
+    ContextLost<void, GLenum, GLenum, GLfloat *>,
+    ContextLost<void, GLenum, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLint, GLfloat *>,
+    ContextLost<void, GLuint, GLint, GLint *>,
+    ContextLost<GLint, GLuint, const GLchar *>,
+    ContextLost<void, GLuint, GLenum, GLfloat *>,
+    ContextLost<void, GLuint, GLenum, GLint *>,
+    ContextLost<void, GLuint, GLenum, void **>,
+    ContextLost<void, GLenum, GLenum>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<GLboolean, GLenum>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<GLboolean, GLuint>,
+    ContextLost<void, GLfloat>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLenum, GLint>,
+    ContextLost<void, GLfloat, GLfloat>,
+    ContextLost<void, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *>,
+    ContextLost<void>,
+    ContextLost<void, GLenum, GLenum, GLsizei, GLsizei>,
+    ContextLost<void, GLfloat, GLboolean>,
+    ContextLost<void, GLint, GLint, GLsizei, GLsizei>,
+    ContextLost<void, GLsizei, const GLuint *, GLenum, const void *, GLsizei>,
+    ContextLost<void, GLuint, GLsizei, const GLchar *const *, const GLint *>,
+    ContextLost<void, GLenum, GLint, GLuint>,
+    ContextLost<void, GLenum, GLenum, GLint, GLuint>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLenum, GLuint>,
+    ContextLost<void, GLenum, GLenum, GLenum>,
+    ContextLost<void, GLenum, GLenum, GLenum, GLenum>,
+    ContextLost<void, GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *>,
+    ContextLost<void, GLenum, GLenum, GLfloat>,
+    ContextLost<void, GLenum, GLenum, const GLfloat *>,
+    ContextLost<void, GLenum, GLenum, GLint>,
+    ContextLost<void, GLenum, GLenum, const GLint *>,
+    ContextLost<void, GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *>,
+    ContextLost<void, GLint, GLfloat>,
+    ContextLost<void, GLint, GLsizei, const GLfloat *>,
+    ContextLost<void, GLint, GLint>,
+    ContextLost<void, GLint, GLsizei, const GLint *>,
+    ContextLost<void, GLint, GLfloat, GLfloat>,
+    ContextLost<void, GLint, GLsizei, const GLfloat *>,
+    ContextLost<void, GLint, GLint, GLint>,
+    ContextLost<void, GLint, GLsizei, const GLint *>,
+    ContextLost<void, GLint, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLint, GLsizei, const GLfloat *>,
+    ContextLost<void, GLint, GLint, GLint, GLint>,
+    ContextLost<void, GLint, GLsizei, const GLint *>,
+    ContextLost<void, GLint, GLfloat, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLint, GLsizei, const GLfloat *>,
+    ContextLost<void, GLint, GLint, GLint, GLint, GLint>,
+    ContextLost<void, GLint, GLsizei, const GLint *>,
+    ContextLost<void, GLint, GLsizei, GLboolean, const GLfloat *>,
+    ContextLost<void, GLint, GLsizei, GLboolean, const GLfloat *>,
+    ContextLost<void, GLint, GLsizei, GLboolean, const GLfloat *>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLuint, GLfloat>,
+    ContextLost<void, GLuint, const GLfloat *>,
+    ContextLost<void, GLuint, GLfloat, GLfloat>,
+    ContextLost<void, GLuint, const GLfloat *>,
+    ContextLost<void, GLuint, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLuint, const GLfloat *>,
+    ContextLost<void, GLuint, GLfloat, GLfloat, GLfloat, GLfloat>,
+    ContextLost<void, GLuint, const GLfloat *>,
+    ContextLost<void, GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>,
+    ContextLost<void, GLint, GLint, GLsizei, GLsizei>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei>,
+    ContextLost<void, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum>,
+    ContextLost<void, GLenum, GLsizei, GLenum, GLsizei, GLsizei>,
+    ContextLost<void, GLenum, GLintptr, GLsizeiptr>,
+    ContextLost<void, GLuint>,
+    ContextLost<void, GLenum>,
+    ContextLost<void, GLenum, GLuint, GLuint>,
+    ContextLost<void, GLenum, GLint, GLfloat, GLint>,
+    ContextLost<void, GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr>,
+    ContextLost<void, GLenum, GLint, GLsizei, GLsizei>,
+    ContextLost<void, GLuint, GLenum, GLint>,
+    ContextLost<void, GLuint, GLenum, GLfloat>,
+    ContextLost<void, GLuint, GLenum, GLint>
+};
+}  // namespace gl
@@ -0,0 +1,404 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml.
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// dispatch_table_autogen.h:
+//   Defines the tables of GLES entry point implementations a context dispatches calls through.
+
+#ifndef LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
+#define LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
+
+#include "angle_gl.h"
+
+namespace gl
+{
+class Context;
+
+struct DispatchTable
+{
+    void (*activeTexture)(Context *context, GLenum texture);
+    void (*attachShader)(Context *context, GLuint program, GLuint shader);
+    void (*bindAttribLocation)(Context *context, GLuint program, GLuint index, const GLchar *name);
+    void (*bindBuffer)(Context *context, GLenum target, GLuint buffer);
+    void (*bindFramebuffer)(Context *context, GLenum target, GLuint framebuffer);
+    void (*bindRenderbuffer)(Context *context, GLenum target, GLuint renderbuffer);
+    void (*bindTexture)(Context *context, GLenum target, GLuint texture);
+    void (*blendColor)(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+    void (*blendEquation)(Context *context, GLenum mode);
+    void (*blendEquationSeparate)(Context *context, GLenum modeRGB, GLenum modeAlpha);
+    void (*blendFunc)(Context *context, GLenum sfactor, GLenum dfactor);
+    void (*blendFuncSeparate)(Context *context,
+                              GLenum sfactorRGB,
+                              GLenum dfactorRGB,
+                              GLenum sfactorAlpha,
+                              GLenum dfactorAlpha);
+    void (*bufferData)(Context *context,
+                       GLenum target,
+                       GLsizeiptr size,
+                       const void *data,
+                       GLenum usage);
+    void (*bufferSubData)(Context *context,
+                          GLenum target,
+                          GLintptr offset,
+                          GLsizeiptr size,
+                          const void *data);
+    GLenum (*checkFramebufferStatus)(Context *context, GLenum target);
+    void (*clear)(Context *context, GLbitfield mask);
+    void (*clearColor)(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+    void (*clearDepthf)(Context *context, GLfloat d);
+    void (*clearStencil)(Context *context, GLint s);
+    void (*colorMask)(Context *context,
+                      GLboolean red,
+                      GLboolean green,
+                      GLboolean blue,
+                      GLboolean alpha);
+    void (*compileShader)(Context *context, GLuint shader);
+    void (*compressedTexImage2D)(Context *context,
+                                 GLenum target,
+                                 GLint level,
+                                 GLenum internalformat,
+                                 GLsizei width,
+                                 GLsizei height,
+                                 GLint border,
+                                 GLsizei imageSize,
+                                 const void *data);
+    void (*compressedTexSubImage2D)(Context *context,
+                                    GLenum target,
+                                    GLint level,
+                                    GLint xoffset,
+                                    GLint yoffset,
+                                    GLsizei width,
+                                    GLsizei height,
+                                    GLenum format,
+                                    GLsizei imageSize,
+                                    const void *data);
+    void (*copyTexImage2D)(Context *context,
+                           GLenum target,
+                           GLint level,
+                           GLenum internalformat,
+                           GLint x,
+                           GLint y,
+                           GLsizei width,
+                           GLsizei height,
+                           GLint border);
+    void (*copyTexSubImage2D)(Context *context,
+                              GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLint x,
+                              GLint y,
+                              GLsizei width,
+                              GLsizei height);
+    GLuint (*createProgram)(Context *context);
+    GLuint (*createShader)(Context *context, GLenum type);
+    void (*cullFace)(Context *context, GLenum mode);
+    void (*deleteBuffers)(Context *context, GLsizei n, const GLuint *buffers);
+    void (*deleteFramebuffers)(Context *context, GLsizei n, const GLuint *framebuffers);
+    void (*deleteProgram)(Context *context, GLuint program);
+    void (*deleteRenderbuffers)(Context *context, GLsizei n, const GLuint *renderbuffers);
+    void (*deleteShader)(Context *context, GLuint shader);
+    void (*deleteTextures)(Context *context, GLsizei n, const GLuint *textures);
+    void (*depthFunc)(Context *context, GLenum func);
+    void (*depthMask)(Context *context, GLboolean flag);
+    void (*depthRangef)(Context *context, GLfloat n, GLfloat f);
+    void (*detachShader)(Context *context, GLuint program, GLuint shader);
+    void (*disable)(Context *context, GLenum cap);
+    void (*disableVertexAttribArray)(Context *context, GLuint index);
+    void (*drawArrays)(Context *context, GLenum mode, GLint first, GLsizei count);
+    void (*drawElements)(Context *context,
+                         GLenum mode,
+                         GLsizei count,
+                         GLenum type,
+                         const void *indices);
+    void (*enable)(Context *context, GLenum cap);
+    void (*enableVertexAttribArray)(Context *context, GLuint index);
+    void (*finish)(Context *context);
+    void (*flush)(Context *context);
+    void (*framebufferRenderbuffer)(Context *context,
+                                    GLenum target,
+                                    GLenum attachment,
+                                    GLenum renderbuffertarget,
+                                    GLuint renderbuffer);
+    void (*framebufferTexture2D)(Context *context,
+                                 GLenum target,
+                                 GLenum attachment,
+                                 GLenum textarget,
+                                 GLuint texture,
+                                 GLint level);
+    void (*frontFace)(Context *context, GLenum mode);
+    void (*genBuffers)(Context *context, GLsizei n, GLuint *buffers);
+    void (*generateMipmap)(Context *context, GLenum target);
+    void (*genFramebuffers)(Context *context, GLsizei n, GLuint *framebuffers);
+    void (*genRenderbuffers)(Context *context, GLsizei n, GLuint *renderbuffers);
+    void (*genTextures)(Context *context, GLsizei n, GLuint *textures);
+    void (*getActiveAttrib)(Context *context,
+                            GLuint program,
+                            GLuint index,
+                            GLsizei bufSize,
+                            GLsizei *length,
+                            GLint *size,
+                            GLenum *type,
+                            GLchar *name);
+    void (*getActiveUniform)(Context *context,
+                             GLuint program,
+                             GLuint index,
+                             GLsizei bufSize,
+                             GLsizei *length,
+                             GLint *size,
+                             GLenum *type,
+                             GLchar *name);
+    void (*getAttachedShaders)(Context *context,
+                               GLuint program,
+                               GLsizei maxCount,
+                               GLsizei *count,
+                               GLuint *shaders);
+    GLint (*getAttribLocation)(Context *context, GLuint program, const GLchar *name);
+    void (*getBooleanv)(Context *context, GLenum pname, GLboolean *data);
+    void (*getBufferParameteriv)(Context *context, GLenum target, GLenum pname, GLint *params);
+    GLenum (*getError)(Context *context);
+    void (*getFloatv)(Context *context, GLenum pname, GLfloat *data);
+    void (*getFramebufferAttachmentParameteriv)(Context *context,
+                                                GLenum target,
+                                                GLenum attachment,
+                                                GLenum pname,
+                                                GLint *params);
+    void (*getIntegerv)(Context *context, GLenum pname, GLint *data);
+    void (*getProgramiv)(Context *context, GLuint program, GLenum pname, GLint *params);
+    void (*getProgramInfoLog)(Context *context,
+                              GLuint program,
+                              GLsizei bufSize,
+                              GLsizei *length,
+                              GLchar *infoLog);
+    void (*getRenderbufferParameteriv)(Context *context,
+                                       GLenum target,
+                                       GLenum pname,
+                                       GLint *params);
+    void (*getShaderiv)(Context *context, GLuint shader, GLenum pname, GLint *params);
+    void (*getShaderInfoLog)(Context *context,
+                             GLuint shader,
+                             GLsizei bufSize,
+                             GLsizei *length,
+                             GLchar *infoLog);
+    void (*getShaderPrecisionFormat)(Context *context,
+                                     GLenum shadertype,
+                                     GLenum precisiontype,
+                                     GLint *range,
+                                     GLint *precision);
+    void (*getShaderSource)(Context *context,
+                            GLuint shader,
+                            GLsizei bufSize,
+                            GLsizei *length,
+                            GLchar *source);
+    const GLubyte *(*getString)(Context *context, GLenum name);
+    void (*getTexParameterfv)(Context *context, GLenum target, GLenum pname, GLfloat *params);
+    void (*getTexParameteriv)(Context *context, GLenum target, GLenum pname, GLint *params);
+    void (*getUniformfv)(Context *context, GLuint program, GLint location, GLfloat *params);
+    void (*getUniformiv)(Context *context, GLuint program, GLint location, GLint *params);
+    GLint (*getUniformLocation)(Context *context, GLuint program, const GLchar *name);
+    void (*getVertexAttribfv)(Context *context, GLuint index, GLenum pname, GLfloat *params);
+    void (*getVertexAttribiv)(Context *context, GLuint index, GLenum pname, GLint *params);
+    void (*getVertexAttribPointerv)(Context *context, GLuint index, GLenum pname, void **pointer);
+    void (*hint)(Context *context, GLenum target, GLenum mode);
+    GLboolean (*isBuffer)(Context *context, GLuint buffer);
+    GLboolean (*isEnabled)(Context *context, GLenum cap);
+    GLboolean (*isFramebuffer)(Context *context, GLuint framebuffer);
+    GLboolean (*isProgram)(Context *context, GLuint program);
+    GLboolean (*isRenderbuffer)(Context *context, GLuint renderbuffer);
+    GLboolean (*isShader)(Context *context, GLuint shader);
+    GLboolean (*isTexture)(Context *context, GLuint texture);
+    void (*lineWidth)(Context *context, GLfloat width);
+    void (*linkProgram)(Context *context, GLuint program);
+    void (*pixelStorei)(Context *context, GLenum pname, GLint param);
+    void (*polygonOffset)(Context *context, GLfloat factor, GLfloat units);
+    void (*readPixels)(Context *context,
+                       GLint x,
+                       GLint y,
+                       GLsizei width,
+                       GLsizei height,
+                       GLenum format,
+                       GLenum type,
+                       void *pixels);
+    void (*releaseShaderCompiler)(Context *context);
+    void (*renderbufferStorage)(Context *context,
+                                GLenum target,
+                                GLenum internalformat,
+                                GLsizei width,
+                                GLsizei height);
+    void (*sampleCoverage)(Context *context, GLfloat value, GLboolean invert);
+    void (*scissor)(Context *context, GLint x, GLint y, GLsizei width, GLsizei height);
+    void (*shaderBinary)(Context *context,
+                         GLsizei count,
+                         const GLuint *shaders,
+                         GLenum binaryformat,
+                         const void *binary,
+                         GLsizei length);
+    void (*shaderSource)(Context *context,
+                         GLuint shader,
+                         GLsizei count,
+                         const GLchar *const *string,
+                         const GLint *length);
+    void (*stencilFunc)(Context *context, GLenum func, GLint ref, GLuint mask);
+    void (*stencilFuncSeparate)(Context *context, GLenum face, GLenum func, GLint ref, GLuint mask);
+    void (*stencilMask)(Context *context, GLuint mask);
+    void (*stencilMaskSeparate)(Context *context, GLenum face, GLuint mask);
+    void (*stencilOp)(Context *context, GLenum fail, GLenum zfail, GLenum zpass);
+    void (*stencilOpSeparate)(Context *context,
+                              GLenum face,
+                              GLenum sfail,
+                              GLenum dpfail,
+                              GLenum dppass);
+    void (*texImage2D)(Context *context,
+                       GLenum target,
+                       GLint level,
+                       GLint internalformat,
+                       GLsizei width,
+                       GLsizei height,
+                       GLint border,
+                       GLenum format,
+                       GLenum type,
+                       const void *pixels);
+    void (*texParameterf)(Context *context, GLenum target, GLenum pname, GLfloat param);
+    void (*texParameterfv)(Context *context, GLenum target, GLenum pname, const GLfloat *params);
+    void (*texParameteri)(Context *context, GLenum target, GLenum pname, GLint param);
+    void (*texParameteriv)(Context *context, GLenum target, GLenum pname, const GLint *params);
+    void (*texSubImage2D)(Context *context,
+                          GLenum target,
+                          GLint level,
+                          GLint xoffset,
+                          GLint yoffset,
+                          GLsizei width,
+                          GLsizei height,
+                          GLenum format,
+                          GLenum type,
+                          const void *pixels);
+    void (*uniform1f)(Context *context, GLint location, GLfloat v0);
+    void (*uniform1fv)(Context *context, GLint location, GLsizei count, const GLfloat *value);
+    void (*uniform1i)(Context *context, GLint location, GLint v0);
+    void (*uniform1iv)(Context *context, GLint location, GLsizei count, const GLint *value);
+    void (*uniform2f)(Context *context, GLint location, GLfloat v0, GLfloat v1);
+    void (*uniform2fv)(Context *context, GLint location, GLsizei count, const GLfloat *value);
+    void (*uniform2i)(Context *context, GLint location, GLint v0, GLint v1);
+    void (*uniform2iv)(Context *context, GLint location, GLsizei count, const GLint *value);
+    void (*uniform3f)(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+    void (*uniform3fv)(Context *context, GLint location, GLsizei count, const GLfloat *value);
+    void (*uniform3i)(Context *context, GLint location, GLint v0, GLint v1, GLint v2);
+    void (*uniform3iv)(Context *context, GLint location, GLsizei count, const GLint *value);
+    void (*uniform4f)(Context *context,
+                      GLint location,
+                      GLfloat v0,
+                      GLfloat v1,
+                      GLfloat v2,
+                      GLfloat v3);
+    void (*uniform4fv)(Context *context, GLint location, GLsizei count, const GLfloat *value);
+    void (*uniform4i)(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+    void (*uniform4iv)(Context *context, GLint location, GLsizei count, const GLint *value);
+    void (*uniformMatrix2fv)(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value);
+    void (*uniformMatrix3fv)(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value);
+    void (*uniformMatrix4fv)(Context *context,
+                             GLint location,
+                             GLsizei count,
+                             GLboolean transpose,
+                             const GLfloat *value);
+    void (*useProgram)(Context *context, GLuint program);
+    void (*validateProgram)(Context *context, GLuint program);
+    void (*vertexAttrib1f)(Context *context, GLuint index, GLfloat x);
+    void (*vertexAttrib1fv)(Context *context, GLuint index, const GLfloat *v);
+    void (*vertexAttrib2f)(Context *context, GLuint index, GLfloat x, GLfloat y);
+    void (*vertexAttrib2fv)(Context *context, GLuint index, const GLfloat *v);
+    void (*vertexAttrib3f)(Context *context, GLuint index, GLfloat x, GLfloat y, GLfloat z);
+    void (*vertexAttrib3fv)(Context *context, GLuint index, const GLfloat *v);
+    void (*vertexAttrib4f)(Context *context,
+                           GLuint index,
+                           GLfloat x,
+                           GLfloat y,
+                           GLfloat z,
+                           GLfloat w);
+    void (*vertexAttrib4fv)(Context *context, GLuint index, const GLfloat *v);
+    void (*vertexAttribPointer)(Context *context,
+                                GLuint index,
+                                GLint size,
+                                GLenum type,
+                                GLboolean normalized,
+                                GLsizei stride,
+                                const void *pointer);
+    void (*viewport)(Context *context, GLint x, GLint y, GLsizei width, GLsizei height);
+    void (*readBuffer)(Context *context, GLenum src);
+    void (*copyTexSubImage3D)(Context *context,
+                              GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLint zoffset,
+                              GLint x,
+                              GLint y,
+                              GLsizei width,
+                              GLsizei height);
+    void (*blitFramebuffer)(Context *context,
+                            GLint srcX0,
+                            GLint srcY0,
+                            GLint srcX1,
+                            GLint srcY1,
+                            GLint dstX0,
+                            GLint dstY0,
+                            GLint dstX1,
+                            GLint dstY1,
+                            GLbitfield mask,
+                            GLenum filter);
+    void (*renderbufferStorageMultisample)(Context *context,
+                                           GLenum target,
+                                           GLsizei samples,
+                                           GLenum internalformat,
+                                           GLsizei width,
+                                           GLsizei height);
+    void (*flushMappedBufferRange)(Context *context,
+                                   GLenum target,
+                                   GLintptr offset,
+                                   GLsizeiptr length);
+    void (*bindVertexArray)(Context *context, GLuint array);
+    void (*beginTransformFeedback)(Context *context, GLenum primitiveMode);
+    void (*bindBufferBase)(Context *context, GLenum target, GLuint index, GLuint buffer);
+    void (*clearBufferfi)(Context *context,
+                          GLenum buffer,
+                          GLint drawbuffer,
+                          GLfloat depth,
+                          GLint stencil);
+    void (*copyBufferSubData)(Context *context,
+                              GLenum readTarget,
+                              GLenum writeTarget,
+                              GLintptr readOffset,
+                              GLintptr writeOffset,
+                              GLsizeiptr size);
+    void (*drawArraysInstanced)(Context *context,
+                                GLenum mode,
+                                GLint first,
+                                GLsizei count,
+                                GLsizei instancecount);
+    void (*samplerParameteri)(Context *context, GLuint sampler, GLenum pname, GLint param);
+    void (*samplerParameterf)(Context *context, GLuint sampler, GLenum pname, GLfloat param);
+    void (*programParameteri)(Context *context, GLuint program, GLenum pname, GLint value);
+};
+
+// Validates the parameters of each call before executing it.
+extern const DispatchTable kValidatedDispatchTable;
+
+// Executes the calls without validating them, for contexts created with
+// EGL_CONTEXT_OPENGL_NO_ERROR_KHR.
+extern const DispatchTable kNoErrorDispatchTable;
+
+// Generates GL_OUT_OF_MEMORY for every call except GetError.
+extern const DispatchTable kContextLostDispatchTable;
+}  // namespace gl
+
+#endif  // LIBANGLE_DISPATCHTABLE_AUTOGEN_H_
@@ -158,9 +158,25 @@ enum class EntryPoint
     VertexAttrib4fv,
     VertexAttribPointer,
     Viewport,
+    ReadBuffer,
+    CopyTexSubImage3D,
+    BlitFramebuffer,
+    RenderbufferStorageMultisample,
+    FlushMappedBufferRange,
+    BindVertexArray,
+    BeginTransformFeedback,
+    BindBufferBase,
+    ClearBufferfi,
+    CopyBufferSubData,
+    DrawArraysInstanced,
+    SamplerParameteri,
+    SamplerParameterf,
+    ProgramParameteri,
     DrawElementsInstanced,
     DrawRangeElements,
-    DrawElementsInstancedANGLE
+    DrawElementsInstancedANGLE,
+    MultiDrawElementsANGLE,
+    MultiDrawElementsInstancedANGLE
 };
 }  // namespace gl
 #endif  // LIBGLESV2_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -8,6 +8,10 @@
 
 #include "libANGLE/formatutils.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Framebuffer.h"
@@ -24,8 +28,110 @@ GLenum GetSizedFormatInternal(GLenum format, GLenum type);
 
 namespace
 {
-using InternalFormatInfoMap =
-    std::unordered_map<GLenum, std::unordered_map<GLenum, InternalFormat>>;
+
+// The internal format infos, stored contiguously and sorted by internal format and then type. An
+// open addressing hash index over the internal formats finds the infos of one internal format,
+// usually with a single probe, without the node allocations and pointer chasing of nested hash
+// maps.
+class InternalFormatInfoMap final
+{
+  public:
+    InternalFormatInfoMap();
+
+    void insert(const InternalFormat &formatInfo);
+
+    // Sorts the infos and builds the index. Must be called once after all the insertions.
+    void finalize();
+
+    // Returns the infos with the given internal format, sorted by type, or nullptr if there are
+    // none.
+    const InternalFormat *find(GLenum internalFormat, size_t *countOut) const;
+
+    const std::vector<InternalFormat> &infos() const { return mInfos; }
+
+  private:
+    struct Slot
+    {
+        GLenum internalFormat;
+        uint16_t first;
+        uint16_t count;
+    };
+
+    static constexpr size_t kSlotCountLog2 = 9;
+    static constexpr size_t kSlotCount     = 1u << kSlotCountLog2;
+
+    static size_t Hash(GLenum internalFormat)
+    {
+        return (internalFormat * 0x9E3779B1u) >> (32 - kSlotCountLog2);
+    }
+
+    std::vector<InternalFormat> mInfos;
+    std::array<Slot, kSlotCount> mSlots;
+};
+
+InternalFormatInfoMap::InternalFormatInfoMap()
+{
+    mSlots.fill({GL_NONE, 0, 0});
+}
+
+void InternalFormatInfoMap::insert(const InternalFormat &formatInfo)
+{
+    mInfos.push_back(formatInfo);
+}
+
+void InternalFormatInfoMap::finalize()
+{
+    std::sort(mInfos.begin(), mInfos.end(), [](const InternalFormat &a, const InternalFormat &b) {
+        return a.internalFormat != b.internalFormat ? a.internalFormat < b.internalFormat
+                                                    : a.type < b.type;
+    });
+    ASSERT(mInfos.size() <= std::numeric_limits<uint16_t>::max());
+
+    for (size_t first = 0; first < mInfos.size();)
+    {
+        GLenum internalFormat = mInfos[first].internalFormat;
+        size_t end            = first + 1;
+        while (end < mInfos.size() && mInfos[end].internalFormat == internalFormat)
+        {
+            // Sized internal formats only have one type, and there is one info per type.
+            ASSERT(!mInfos[end].sized && !mInfos[first].sized);
+            ASSERT(mInfos[end].type != mInfos[end - 1].type);
+            ++end;
+        }
+
+        size_t slot = Hash(internalFormat);
+        while (mSlots[slot].count != 0)
+        {
+            slot = (slot + 1) & (kSlotCount - 1);
+        }
+        mSlots[slot].internalFormat = internalFormat;
+        mSlots[slot].first          = static_cast<uint16_t>(first);
+        mSlots[slot].count          = static_cast<uint16_t>(end - first);
+
+        first = end;
+    }
+
+    // Keep the load factor low so that probe sequences stay short.
+    ASSERT(std::count_if(mSlots.begin(), mSlots.end(), [](const Slot &slot) {
+               return slot.count != 0;
+           }) <= static_cast<std::ptrdiff_t>(kSlotCount / 2));
+}
+
+const InternalFormat *InternalFormatInfoMap::find(GLenum internalFormat, size_t *countOut) const
+{
+    for (size_t slot = Hash(internalFormat); mSlots[slot].count != 0;
+         slot        = (slot + 1) & (kSlotCount - 1))
+    {
+        if (mSlots[slot].internalFormat == internalFormat)
+        {
+            *countOut = mSlots[slot].count;
+            return &mInfos[mSlots[slot].first];
+        }
+    }
+
+    *countOut = 0;
+    return nullptr;
+}
 
 }  // anonymous namespace
 
@@ -380,9 +486,7 @@ bool InternalFormat::operator!=(const InternalFormat &other) const
 
 void InsertFormatInfo(InternalFormatInfoMap *map, const InternalFormat &formatInfo)
 {
-    ASSERT(!formatInfo.sized || (*map).count(formatInfo.internalFormat) == 0);
-    ASSERT((*map)[formatInfo.internalFormat].count(formatInfo.type) == 0);
-    (*map)[formatInfo.internalFormat][formatInfo.type] = formatInfo;
+    map->insert(formatInfo);
 }
 
 void AddRGBAFormat(InternalFormatInfoMap *map,
@@ -528,7 +632,7 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
     InternalFormatInfoMap map;
 
     // From ES 3.0.1 spec, table 3.12
-    map[GL_NONE][GL_NONE] = InternalFormat();
+    map.insert(InternalFormat());
 
     // clang-format off
 
@@ -788,6 +892,7 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
     AddDepthStencilFormat(&map, GL_STENCIL,              false,  0, 8,  0, GL_STENCIL,         GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, RequireES<2, 0>,                                       RequireES<2, 0>,                                       NeverSupported);
     // clang-format on
 
+    map.finalize();
     return map;
 }
 
@@ -801,18 +906,15 @@ static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
 
-    for (const auto &internalFormat : GetInternalFormatMap())
+    for (const InternalFormat &formatInfo : GetInternalFormatMap().infos())
     {
-        for (const auto &type : internalFormat.second)
+        if (formatInfo.sized)
         {
-            if (type.second.sized)
-            {
-                // TODO(jmadill): Fix this hack.
-                if (internalFormat.first == GL_BGR565_ANGLEX)
-                    continue;
+            // TODO(jmadill): Fix this hack.
+            if (formatInfo.internalFormat == GL_BGR565_ANGLEX)
+                continue;
 
-                result.insert(internalFormat.first);
-            }
+            result.insert(formatInfo.internalFormat);
         }
     }
 
@@ -878,48 +980,40 @@ const Type &GetTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
+    size_t count                     = 0;
+    const InternalFormat *formatInfo = GetInternalFormatMap().find(internalFormat, &count);
 
     // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
+    if (count != 1 || !formatInfo->sized)
     {
         return defaultInternalFormat;
     }
 
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
-    if (!internalFormatInfo.sized)
-    {
-        return defaultInternalFormat;
-    }
-
-    return internalFormatInfo;
+    return *formatInfo;
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-
-    auto internalFormatIter = formatMap.find(internalFormat);
-    if (internalFormatIter == formatMap.end())
-    {
-        return defaultInternalFormat;
-    }
+    size_t count                      = 0;
+    const InternalFormat *formatInfos = GetInternalFormatMap().find(internalFormat, &count);
 
     // If the internal format is sized, simply return it without the type check.
-    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second.sized)
+    if (count == 1 && formatInfos[0].sized)
     {
-        return internalFormatIter->second.begin()->second;
+        return formatInfos[0];
     }
 
-    auto typeIter = internalFormatIter->second.find(type);
-    if (typeIter == internalFormatIter->second.end())
+    // Unsized internal formats have a handful of types at most.
+    for (size_t i = 0; i < count; ++i)
     {
-        return defaultInternalFormat;
+        if (formatInfos[i].type == type)
+        {
+            return formatInfos[i];
+        }
     }
 
-    return typeIter->second;
+    return defaultInternalFormat;
 }
 
 GLuint InternalFormat::computePixelBytes(GLenum formatType) const
@@ -1077,6 +1171,11 @@ const FormatSet &GetAllSizedInternalFormats()
     return formatSet;
 }
 
+const std::vector<InternalFormat> &GetAllInternalFormatInfos()
+{
+    return GetInternalFormatMap().infos();
+}
+
 AttributeType GetAttributeType(GLenum enumValue)
 {
     switch (enumValue)
@@ -1978,8 +2077,8 @@ size_t GetVertexFormatTypeSize(VertexFormatType vertexFormatType)
 
 bool ValidES3InternalFormat(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    return internalFormat != GL_NONE && formatMap.find(internalFormat) != formatMap.end();
+    size_t count = 0;
+    return internalFormat != GL_NONE && GetInternalFormatMap().find(internalFormat, &count);
 }
 
 VertexFormat::VertexFormat(GLenum typeIn, GLboolean normalizedIn, GLuint componentsIn, bool pureIntegerIn)
@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <ostream>
 #include <stdint.h>
+#include <vector>
 
 #include "angle_gl.h"
 #include "libANGLE/Caps.h"
@@ -161,6 +162,9 @@ GLenum GetUnsizedFormat(GLenum internalFormat);
 typedef std::set<GLenum> FormatSet;
 const FormatSet &GetAllSizedInternalFormats();
 
+// Returns the info of every internal format and type combination, sized or not.
+const std::vector<InternalFormat> &GetAllInternalFormatInfos();
+
 // From the ESSL 3.00.4 spec:
 // Vertex shader inputs can only be float, floating-point vectors, matrices, signed and unsigned
 // integers and integer vectors. Vertex shader inputs cannot be arrays or structures.
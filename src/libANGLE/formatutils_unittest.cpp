@@ -0,0 +1,127 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// formatutils_unittest:
+//   Tests of the internal format info lookups.
+//
+
+#include <map>
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/formatutils.h"
+
+using namespace gl;
+
+namespace
+{
+
+// The internal format infos as nested maps, which is how they used to be looked up.
+using ReferenceFormatMap = std::map<GLenum, std::map<GLenum, const InternalFormat *>>;
+
+ReferenceFormatMap BuildReferenceFormatMap()
+{
+    ReferenceFormatMap formatMap;
+    for (const InternalFormat &formatInfo : GetAllInternalFormatInfos())
+    {
+        formatMap[formatInfo.internalFormat][formatInfo.type] = &formatInfo;
+    }
+    return formatMap;
+}
+
+const InternalFormat *ReferenceSizedLookup(const ReferenceFormatMap &formatMap,
+                                           GLenum internalFormat)
+{
+    auto iter = formatMap.find(internalFormat);
+    if (iter == formatMap.end() || iter->second.size() != 1 || !iter->second.begin()->second->sized)
+    {
+        return nullptr;
+    }
+    return iter->second.begin()->second;
+}
+
+const InternalFormat *ReferenceLookup(const ReferenceFormatMap &formatMap,
+                                      GLenum internalFormat,
+                                      GLenum type)
+{
+    auto internalFormatIter = formatMap.find(internalFormat);
+    if (internalFormatIter == formatMap.end())
+    {
+        return nullptr;
+    }
+
+    const auto &types = internalFormatIter->second;
+    if (types.size() == 1 && types.begin()->second->sized)
+    {
+        return types.begin()->second;
+    }
+
+    auto typeIter = types.find(type);
+    return typeIter != types.end() ? typeIter->second : nullptr;
+}
+
+// Every internal format and type pair, along with neighbouring values that aren't formats or
+// types, is resolved to the same info as a lookup in nested maps would find.
+TEST(FormatUtilsTest, LookupsMatchNestedMaps)
+{
+    ReferenceFormatMap formatMap = BuildReferenceFormatMap();
+    ASSERT_FALSE(formatMap.empty());
+
+    std::set<GLenum> internalFormats = {GL_NONE, 0xFFFFu};
+    std::set<GLenum> types           = {GL_NONE, 0xFFFFu};
+    for (const InternalFormat &formatInfo : GetAllInternalFormatInfos())
+    {
+        internalFormats.insert(formatInfo.internalFormat);
+        internalFormats.insert(formatInfo.internalFormat + 1);
+        internalFormats.insert(formatInfo.internalFormat - 1);
+        types.insert(formatInfo.type);
+    }
+
+    for (GLenum internalFormat : internalFormats)
+    {
+        const InternalFormat *expectedSized = ReferenceSizedLookup(formatMap, internalFormat);
+        const InternalFormat &sized         = GetSizedInternalFormatInfo(internalFormat);
+        if (expectedSized != nullptr)
+        {
+            EXPECT_EQ(expectedSized, &sized) << "internalFormat 0x" << std::hex << internalFormat;
+        }
+        else
+        {
+            EXPECT_EQ(static_cast<GLenum>(GL_NONE), sized.internalFormat)
+                << "internalFormat 0x" << std::hex << internalFormat;
+        }
+
+        for (GLenum type : types)
+        {
+            const InternalFormat *expected = ReferenceLookup(formatMap, internalFormat, type);
+            const InternalFormat &info     = GetInternalFormatInfo(internalFormat, type);
+            if (expected != nullptr)
+            {
+                EXPECT_EQ(expected, &info) << "internalFormat 0x" << std::hex << internalFormat
+                                           << ", type 0x" << type;
+            }
+            else
+            {
+                EXPECT_EQ(static_cast<GLenum>(GL_NONE), info.internalFormat)
+                    << "internalFormat 0x" << std::hex << internalFormat << ", type 0x" << type;
+            }
+        }
+    }
+}
+
+// No internal format and type pair is listed twice.
+TEST(FormatUtilsTest, NoDuplicateInfos)
+{
+    std::set<std::pair<GLenum, GLenum>> pairs;
+    for (const InternalFormat &formatInfo : GetAllInternalFormatInfos())
+    {
+        EXPECT_TRUE(pairs.insert(std::make_pair(formatInfo.internalFormat, formatInfo.type)).second)
+            << "internalFormat 0x" << std::hex << formatInfo.internalFormat << ", type 0x"
+            << formatInfo.type;
+    }
+}
+
+}  // anonymous namespace
@@ -12,6 +12,8 @@
 
 #include <platform/Platform.h>
 
+#include "libANGLE/HistogramStore.h"
+
 #define ANGLE_HISTOGRAM_TIMES(name, sample) ANGLE_HISTOGRAM_CUSTOM_TIMES( \
     name, sample, 1, 10000, 50)
 
@@ -41,19 +43,17 @@
 #define ANGLE_HISTOGRAM_COUNTS_10000(name, sample) \
     ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, 1, 10000, 50)
 
-#define ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, min, max, bucket_count)                       \
-    ANGLEPlatformCurrent()->histogramCustomCounts(ANGLEPlatformCurrent(), name, sample, min, max, \
-                                                  bucket_count)
+#define ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, min, max, bucket_count) \
+    ANGLE_HISTOGRAM_RECORD(name, RecordHistogramCustomCounts, sample, min, max, bucket_count)
 
 #define ANGLE_HISTOGRAM_PERCENTAGE(name, under_one_hundred) \
     ANGLE_HISTOGRAM_ENUMERATION(name, under_one_hundred, 101)
 
 #define ANGLE_HISTOGRAM_BOOLEAN(name, sample) \
-    ANGLEPlatformCurrent()->histogramBoolean(ANGLEPlatformCurrent(), name, sample)
+    ANGLE_HISTOGRAM_RECORD(name, RecordHistogramBoolean, sample)
 
-#define ANGLE_HISTOGRAM_ENUMERATION(name, sample, boundary_value)                      \
-    ANGLEPlatformCurrent()->histogramEnumeration(ANGLEPlatformCurrent(), name, sample, \
-                                                 boundary_value)
+#define ANGLE_HISTOGRAM_ENUMERATION(name, sample, boundary_value) \
+    ANGLE_HISTOGRAM_RECORD(name, RecordHistogramEnumeration, sample, boundary_value)
 
 #define ANGLE_HISTOGRAM_MEMORY_KB(name, sample) ANGLE_HISTOGRAM_CUSTOM_COUNTS( \
     name, sample, 1000, 500000, 50)
@@ -62,7 +62,20 @@
     name, sample, 1, 1000, 50)
 
 #define ANGLE_HISTOGRAM_SPARSE_SLOWLY(name, sample) \
-    ANGLEPlatformCurrent()->histogramSparse(ANGLEPlatformCurrent(), name, sample)
+    ANGLE_HISTOGRAM_RECORD(name, RecordHistogramSparse, sample)
+
+// Records the throughput of a transfer of |bytes| which took |seconds|, in KB per second.
+#define ANGLE_HISTOGRAM_THROUGHPUT(name, bytes, seconds) \
+    ANGLE_HISTOGRAM_RECORD(name, RecordHistogramThroughput, bytes, seconds)
+
+// Each call site keeps the handle of its histogram, so the name is only looked up once. The name
+// must be the same every time the call site runs.
+#define ANGLE_HISTOGRAM_RECORD(name, record_function, ...)      \
+    do                                                          \
+    {                                                           \
+        static angle::HistogramHandle histogram_handle(name);   \
+        angle::record_function(&histogram_handle, __VA_ARGS__); \
+    } while (0)
 
 // Scoped class which logs its time on this earth as a UMA statistic. This is
 // recommended for when you want a histogram which measures the time it takes
@@ -84,16 +97,10 @@
     class ScopedHistogramTimer##key                                                     \
     {                                                                                   \
       public:                                                                           \
-        ScopedHistogramTimer##key()                                                     \
-            : constructed_(ANGLEPlatformCurrent()->currentTime(ANGLEPlatformCurrent())) \
-        {                                                                               \
-        }                                                                               \
+        ScopedHistogramTimer##key() : constructed_(angle::HistogramCurrentTime()) {}    \
         ~ScopedHistogramTimer##key()                                                    \
         {                                                                               \
-            if (constructed_ == 0)                                                      \
-                return;                                                                 \
-            auto *platform = ANGLEPlatformCurrent();                                    \
-            double elapsed = platform->currentTime(platform) - constructed_;            \
+            double elapsed = angle::HistogramCurrentTime() - constructed_;              \
             int elapsedMS  = static_cast<int>(elapsed * 1000.0);                        \
             if (is_long)                                                                \
             {                                                                           \
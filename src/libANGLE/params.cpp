@@ -9,9 +9,7 @@
 
 #include "libANGLE/params.h"
 
-#include "common/utilities.h"
 #include "libANGLE/Context.h"
-#include "libANGLE/VertexArray.h"
 
 namespace gl
 {
@@ -19,6 +17,7 @@ namespace gl
 // static
 constexpr ParamTypeInfo ParamsBase::TypeInfo;
 constexpr ParamTypeInfo HasIndexRange::TypeInfo;
+constexpr ParamTypeInfo HasMultiDrawIndexRanges::TypeInfo;
 
 ParamsBase::ParamsBase(Context *context, ...)
 {
@@ -36,32 +35,50 @@ const Optional<IndexRange> &HasIndexRange::getIndexRange() const
         return mIndexRange;
     }
 
-    const State &state = mContext->getGLState();
+    IndexRange indexRange;
+    Error error = mContext->getDrawIndexRange(mType, mCount, mIndices, &indexRange);
+    if (error.isError())
+    {
+        mContext->handleError(error);
+        return mIndexRange;
+    }
 
-    const gl::VertexArray *vao     = state.getVertexArray();
-    gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
+    mIndexRange = indexRange;
+    return mIndexRange;
+}
 
-    if (elementArrayBuffer)
-    {
-        uintptr_t offset = reinterpret_cast<uintptr_t>(mIndices);
-        IndexRange indexRange;
-        Error error =
-            elementArrayBuffer->getIndexRange(mType, static_cast<size_t>(offset), mCount,
-                                              state.isPrimitiveRestartEnabled(), &indexRange);
-        if (error.isError())
-        {
-            mContext->handleError(error);
-            return mIndexRange;
-        }
+HasMultiDrawIndexRanges::HasMultiDrawIndexRanges(Context *context,
+                                                 const GLsizei *counts,
+                                                 GLenum type,
+                                                 const void *const *indices,
+                                                 GLsizei drawcount)
+    : ParamsBase(context),
+      mContext(context),
+      mCounts(counts),
+      mType(type),
+      mIndices(indices),
+      mDrawCount(drawcount)
+{
+}
 
-        mIndexRange = indexRange;
+const Optional<const IndexRange *> &HasMultiDrawIndexRanges::getIndexRanges() const
+{
+    if (mIndexRanges.valid())
+    {
+        return mIndexRanges;
     }
-    else
+
+    const IndexRange *indexRanges = nullptr;
+    Error error =
+        mContext->getMultiDrawIndexRanges(mCounts, mType, mIndices, mDrawCount, &indexRanges);
+    if (error.isError())
     {
-        mIndexRange = ComputeIndexRange(mType, mIndices, mCount, state.isPrimitiveRestartEnabled());
+        mContext->handleError(error);
+        return mIndexRanges;
     }
 
-    return mIndexRange;
+    mIndexRanges = indexRanges;
+    return mIndexRanges;
 }
 
 }  // namespace gl
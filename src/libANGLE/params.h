@@ -88,6 +88,33 @@ class HasIndexRange : public ParamsBase
     mutable Optional<IndexRange> mIndexRange;
 };
 
+// The index ranges of all the draws of a multi-draw call, computed once for validation and the
+// draw. They live in a buffer of the context, which the next multi-draw call reuses.
+class HasMultiDrawIndexRanges : public ParamsBase
+{
+  public:
+    HasMultiDrawIndexRanges(Context *context,
+                            const GLsizei *counts,
+                            GLenum type,
+                            const void *const *indices,
+                            GLsizei drawcount);
+
+    template <EntryPoint EP, typename... ArgsT>
+    static void Factory(HasMultiDrawIndexRanges *objBuffer, ArgsT... args);
+
+    const Optional<const IndexRange *> &getIndexRanges() const;
+
+    ANGLE_PARAM_TYPE_INFO(HasMultiDrawIndexRanges, ParamsBase);
+
+  private:
+    Context *mContext;
+    const GLsizei *mCounts;
+    GLenum mType;
+    const void *const *mIndices;
+    GLsizei mDrawCount;
+    mutable Optional<const IndexRange *> mIndexRanges;
+};
+
 // Entry point funcs essentially re-map different entry point parameter arrays into
 // the format the parameter type class expects. For example, for HasIndexRange, for the
 // various indexed draw calls, they drop parameters that aren't useful and re-arrange
@@ -156,6 +183,35 @@ ANGLE_ENTRY_POINT_FUNC(DrawRangeElements,
                                                               indices);
 }
 
+ANGLE_ENTRY_POINT_FUNC(MultiDrawElementsANGLE,
+                       HasMultiDrawIndexRanges,
+                       HasMultiDrawIndexRanges *objBuffer,
+                       Context *context,
+                       GLenum /*mode*/,
+                       const GLsizei *counts,
+                       GLenum type,
+                       const void *const *indices,
+                       GLsizei drawcount)
+{
+    return ParamsBase::Factory<EntryPoint::MultiDrawElementsANGLE>(objBuffer, context, counts,
+                                                                   type, indices, drawcount);
+}
+
+ANGLE_ENTRY_POINT_FUNC(MultiDrawElementsInstancedANGLE,
+                       HasMultiDrawIndexRanges,
+                       HasMultiDrawIndexRanges *objBuffer,
+                       Context *context,
+                       GLenum /*mode*/,
+                       const GLsizei *counts,
+                       GLenum type,
+                       const void *const *indices,
+                       const GLsizei * /*instanceCounts*/,
+                       GLsizei drawcount)
+{
+    return ParamsBase::Factory<EntryPoint::MultiDrawElementsInstancedANGLE>(
+        objBuffer, context, counts, type, indices, drawcount);
+}
+
 #undef ANGLE_ENTRY_POINT_FUNC
 
 template <EntryPoint EP>
@@ -20,6 +20,84 @@ ContextImpl::~ContextImpl()
 {
 }
 
+gl::Error ContextImpl::multiDrawArrays(const gl::Context *context,
+                                       GLenum mode,
+                                       const GLint *firsts,
+                                       const GLsizei *counts,
+                                       GLsizei drawcount)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] == 0)
+        {
+            continue;
+        }
+        ANGLE_TRY(drawArrays(context, mode, firsts[drawID], counts[drawID]));
+    }
+    return gl::NoError();
+}
+
+gl::Error ContextImpl::multiDrawArraysInstanced(const gl::Context *context,
+                                                GLenum mode,
+                                                const GLint *firsts,
+                                                const GLsizei *counts,
+                                                const GLsizei *instanceCounts,
+                                                GLsizei drawcount)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] == 0 || instanceCounts[drawID] == 0)
+        {
+            continue;
+        }
+        ANGLE_TRY(drawArraysInstanced(context, mode, firsts[drawID], counts[drawID],
+                                      instanceCounts[drawID]));
+    }
+    return gl::NoError();
+}
+
+gl::Error ContextImpl::multiDrawElements(const gl::Context *context,
+                                         GLenum mode,
+                                         const GLsizei *counts,
+                                         GLenum type,
+                                         const void *const *indices,
+                                         GLsizei drawcount,
+                                         const gl::IndexRange *indexRanges)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] == 0 || indexRanges[drawID].vertexIndexCount == 0)
+        {
+            continue;
+        }
+        ANGLE_TRY(drawElements(context, mode, counts[drawID], type, indices[drawID],
+                               indexRanges[drawID]));
+    }
+    return gl::NoError();
+}
+
+gl::Error ContextImpl::multiDrawElementsInstanced(const gl::Context *context,
+                                                  GLenum mode,
+                                                  const GLsizei *counts,
+                                                  GLenum type,
+                                                  const void *const *indices,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount,
+                                                  const gl::IndexRange *indexRanges)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] == 0 || instanceCounts[drawID] == 0 ||
+            indexRanges[drawID].vertexIndexCount == 0)
+        {
+            continue;
+        }
+        ANGLE_TRY(drawElementsInstanced(context, mode, counts[drawID], type, indices[drawID],
+                                        instanceCounts[drawID], indexRanges[drawID]));
+    }
+    return gl::NoError();
+}
+
 void ContextImpl::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     UNREACHABLE();
@@ -76,6 +76,35 @@ class ContextImpl : public GLImplFactory
                                            GLenum type,
                                            const void *indirect) = 0;
 
+    // ANGLE_multi_draw drawing methods. The frontend validates and syncs the state once for all
+    // the draws; by default they then go through the single draw methods one at a time.
+    virtual gl::Error multiDrawArrays(const gl::Context *context,
+                                      GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      GLsizei drawcount);
+    virtual gl::Error multiDrawArraysInstanced(const gl::Context *context,
+                                               GLenum mode,
+                                               const GLint *firsts,
+                                               const GLsizei *counts,
+                                               const GLsizei *instanceCounts,
+                                               GLsizei drawcount);
+    virtual gl::Error multiDrawElements(const gl::Context *context,
+                                        GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const void *const *indices,
+                                        GLsizei drawcount,
+                                        const gl::IndexRange *indexRanges);
+    virtual gl::Error multiDrawElementsInstanced(const gl::Context *context,
+                                                 GLenum mode,
+                                                 const GLsizei *counts,
+                                                 GLenum type,
+                                                 const void *const *indices,
+                                                 const GLsizei *instanceCounts,
+                                                 GLsizei drawcount,
+                                                 const gl::IndexRange *indexRanges);
+
     // CHROMIUM_path_rendering path drawing methods.
     virtual void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask);
     virtual void stencilStrokePath(const gl::Path *path, GLint reference, GLuint mask);
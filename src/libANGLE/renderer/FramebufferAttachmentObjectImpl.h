@@ -29,6 +29,14 @@ class FramebufferAttachmentObjectImpl : angle::NonCopyable
         UNIMPLEMENTED();
         return gl::OutOfMemory() << "getAttachmentRenderTarget not supported.";
     }
+
+    // Zero-fills an image allocated under robust resource initialization. Back-ends that create
+    // all of their storage with defined contents can keep the default no-op.
+    virtual gl::Error initializeContents(const gl::Context *context,
+                                         const gl::ImageIndex &imageIndex)
+    {
+        return gl::NoError();
+    }
 };
 
 }  // namespace rx
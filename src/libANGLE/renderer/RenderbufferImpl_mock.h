@@ -28,6 +28,8 @@ class MockRenderbufferImpl : public RenderbufferImpl
     MOCK_METHOD3(getAttachmentRenderTarget,
                  gl::Error(GLenum, const gl::ImageIndex &, FramebufferAttachmentRenderTarget **));
 
+    MOCK_METHOD2(initializeContents, gl::Error(const gl::Context *, const gl::ImageIndex &));
+
     MOCK_METHOD0(destructor, void());
 };
 
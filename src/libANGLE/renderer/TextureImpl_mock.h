@@ -107,6 +107,8 @@ class MockTextureImpl : public TextureImpl
     MOCK_METHOD3(getAttachmentRenderTarget,
                  gl::Error(GLenum, const gl::ImageIndex &, FramebufferAttachmentRenderTarget **));
 
+    MOCK_METHOD2(initializeContents, gl::Error(const gl::Context *, const gl::ImageIndex &));
+
     MOCK_METHOD6(
         setStorageMultisample,
         gl::Error(const gl::Context *, GLenum, GLsizei, GLint, const gl::Extents &, GLboolean));
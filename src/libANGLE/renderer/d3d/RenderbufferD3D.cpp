@@ -94,4 +94,12 @@ gl::Error RenderbufferD3D::getAttachmentRenderTarget(GLenum /*binding*/,
     return getRenderTarget(reinterpret_cast<RenderTargetD3D **>(rtOut));
 }
 
+gl::Error RenderbufferD3D::initializeContents(const gl::Context * /*context*/,
+                                              const gl::ImageIndex & /*imageIndex*/)
+{
+    RenderTargetD3D *renderTarget = nullptr;
+    ANGLE_TRY(getRenderTarget(&renderTarget));
+    return mRenderer->initRenderTarget(renderTarget);
+}
+
 }
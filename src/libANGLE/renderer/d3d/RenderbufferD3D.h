@@ -38,6 +38,8 @@ class RenderbufferD3D : public RenderbufferImpl
     gl::Error getAttachmentRenderTarget(GLenum binding,
                                         const gl::ImageIndex &imageIndex,
                                         FramebufferAttachmentRenderTarget **rtOut) override;
+    gl::Error initializeContents(const gl::Context *context,
+                                 const gl::ImageIndex &imageIndex) override;
 
   private:
     RendererD3D *mRenderer;
@@ -194,6 +194,10 @@ class RendererD3D : public BufferFactoryD3D
     virtual gl::Error createRenderTarget(int width, int height, GLenum format, GLsizei samples, RenderTargetD3D **outRT) = 0;
     virtual gl::Error createRenderTargetCopy(RenderTargetD3D *source, RenderTargetD3D **outRT) = 0;
 
+    // Clears a render target to zero, or its depth to one and stencil to zero, for robust resource
+    // initialization.
+    virtual gl::Error initRenderTarget(RenderTargetD3D *renderTarget) = 0;
+
     // Shader operations
     virtual gl::Error loadExecutable(const void *function,
                                      size_t length,
@@ -558,6 +558,30 @@ gl::Error TextureD3D::getAttachmentRenderTarget(GLenum /*binding*/,
     return error;
 }
 
+gl::Error TextureD3D::initializeContents(const gl::Context *context,
+                                         const gl::ImageIndex &imageIndex)
+{
+    // Array layers each have their own render target.
+    if (imageIndex.type == GL_TEXTURE_2D_ARRAY && !imageIndex.hasLayer())
+    {
+        for (GLint layer = 0; layer < getLayerCount(imageIndex.mipIndex); ++layer)
+        {
+            ANGLE_TRY(initializeContents(context, getImageIndex(imageIndex.mipIndex, layer)));
+        }
+        return gl::NoError();
+    }
+
+    // Storage for images that can't be rendered to is created with zeroed contents.
+    if (!canCreateRenderTargetForImage(imageIndex))
+    {
+        return gl::NoError();
+    }
+
+    RenderTargetD3D *renderTarget = nullptr;
+    ANGLE_TRY(getRenderTarget(imageIndex, &renderTarget));
+    return mRenderer->initRenderTarget(renderTarget);
+}
+
 void TextureD3D::setBaseLevel(GLuint baseLevel)
 {
     const int oldStorageWidth  = std::max(1, getLevelZeroWidth());
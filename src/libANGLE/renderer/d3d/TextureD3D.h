@@ -76,6 +76,8 @@ class TextureD3D : public TextureImpl
     gl::Error getAttachmentRenderTarget(GLenum binding,
                                         const gl::ImageIndex &imageIndex,
                                         FramebufferAttachmentRenderTarget **rtOut) override;
+    gl::Error initializeContents(const gl::Context *context,
+                                 const gl::ImageIndex &imageIndex) override;
 
     void setBaseLevel(GLuint baseLevel) override;
 
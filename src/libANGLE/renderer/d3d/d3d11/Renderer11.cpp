@@ -1154,12 +1154,14 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
 
 gl::Error Renderer11::flush()
 {
+    TRACE_EVENT0("gpu.angle", "Renderer11::flush");
     mDeviceContext->Flush();
     return gl::NoError();
 }
 
 gl::Error Renderer11::finish()
 {
+    TRACE_EVENT0("gpu.angle", "Renderer11::finish");
     HRESULT result;
 
     if (!mSyncQuery)
@@ -3647,6 +3649,29 @@ gl::Error Renderer11::createRenderTargetCopy(RenderTargetD3D *source, RenderTarg
     return gl::NoError();
 }
 
+gl::Error Renderer11::initRenderTarget(RenderTargetD3D *renderTarget)
+{
+    ASSERT(renderTarget != nullptr);
+    RenderTarget11 *renderTarget11 = GetAs<RenderTarget11>(renderTarget);
+
+    const d3d11::DepthStencilView &dsv = renderTarget11->getDepthStencilView();
+    if (dsv.valid())
+    {
+        const gl::InternalFormat &formatInfo =
+            gl::GetSizedInternalFormatInfo(renderTarget11->getInternalFormat());
+        UINT clearFlags = (formatInfo.depthBits > 0 ? D3D11_CLEAR_DEPTH : 0) |
+                          (formatInfo.stencilBits > 0 ? D3D11_CLEAR_STENCIL : 0);
+        mDeviceContext->ClearDepthStencilView(dsv.get(), clearFlags, 1.0f, 0);
+        return gl::NoError();
+    }
+
+    const d3d11::RenderTargetView &rtv = renderTarget11->getRenderTargetView();
+    ASSERT(rtv.valid());
+    const FLOAT zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    mDeviceContext->ClearRenderTargetView(rtv.get(), zero);
+    return gl::NoError();
+}
+
 gl::Error Renderer11::loadExecutable(const void *function,
                                      size_t length,
                                      ShaderType type,
@@ -168,97 +168,6 @@ HRESULT CreateResource(ID3D11Device *device,
     return device->CreateTexture3D(desc, initData, texture);
 }
 
-DXGI_FORMAT GetTypedDepthStencilFormat(DXGI_FORMAT dxgiFormat)
-{
-    switch (dxgiFormat)
-    {
-        case DXGI_FORMAT_R16_TYPELESS:
-            return DXGI_FORMAT_D16_UNORM;
-        case DXGI_FORMAT_R24G8_TYPELESS:
-            return DXGI_FORMAT_D24_UNORM_S8_UINT;
-        case DXGI_FORMAT_R32_TYPELESS:
-            return DXGI_FORMAT_D32_FLOAT;
-        case DXGI_FORMAT_R32G8X24_TYPELESS:
-            return DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
-        default:
-            return dxgiFormat;
-    }
-}
-
-template <typename DescT, typename ResourceT>
-gl::Error ClearResource(Renderer11 *renderer, const DescT *desc, ResourceT *texture)
-{
-    // No-op.
-    return gl::NoError();
-}
-
-template <>
-gl::Error ClearResource(Renderer11 *renderer,
-                        const D3D11_TEXTURE2D_DESC *desc,
-                        ID3D11Texture2D *texture)
-{
-    ID3D11DeviceContext *context = renderer->getDeviceContext();
-
-    if ((desc->BindFlags & D3D11_BIND_DEPTH_STENCIL) != 0)
-    {
-        D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc;
-        dsvDesc.Flags  = 0;
-        dsvDesc.Format = GetTypedDepthStencilFormat(desc->Format);
-
-        const auto &format = d3d11_angle::GetFormat(dsvDesc.Format);
-        UINT clearFlags    = (format.depthBits > 0 ? D3D11_CLEAR_DEPTH : 0) |
-                          (format.stencilBits > 0 ? D3D11_CLEAR_STENCIL : 0);
-
-        // Must process each mip level individually.
-        for (UINT mipLevel = 0; mipLevel < desc->MipLevels; ++mipLevel)
-        {
-            if (desc->SampleDesc.Count == 0)
-            {
-                dsvDesc.Texture2D.MipSlice = mipLevel;
-                dsvDesc.ViewDimension      = D3D11_DSV_DIMENSION_TEXTURE2D;
-            }
-            else
-            {
-                dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DMS;
-            }
-
-            d3d11::DepthStencilView dsv;
-            ANGLE_TRY(renderer->allocateResource(dsvDesc, texture, &dsv));
-
-            context->ClearDepthStencilView(dsv.get(), clearFlags, 1.0f, 0);
-        }
-    }
-    else
-    {
-        ASSERT((desc->BindFlags & D3D11_BIND_RENDER_TARGET) != 0);
-        d3d11::RenderTargetView rtv;
-        ANGLE_TRY(renderer->allocateResourceNoDesc(texture, &rtv));
-
-        const FLOAT zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-        context->ClearRenderTargetView(rtv.get(), zero);
-    }
-
-    return gl::NoError();
-}
-
-template <>
-gl::Error ClearResource(Renderer11 *renderer,
-                        const D3D11_TEXTURE3D_DESC *desc,
-                        ID3D11Texture3D *texture)
-{
-    ID3D11DeviceContext *context = renderer->getDeviceContext();
-
-    ASSERT((desc->BindFlags & D3D11_BIND_DEPTH_STENCIL) == 0);
-    ASSERT((desc->BindFlags & D3D11_BIND_RENDER_TARGET) != 0);
-
-    d3d11::RenderTargetView rtv;
-    ANGLE_TRY(renderer->allocateResourceNoDesc(texture, &rtv));
-
-    const FLOAT zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-    context->ClearRenderTargetView(rtv.get(), zero);
-    return gl::NoError();
-}
-
 #define ANGLE_RESOURCE_STRINGIFY_OP(NAME, RESTYPE, D3D11TYPE, DESCTYPE, INITDATATYPE) #RESTYPE
 
 constexpr std::array<const char *, NumResourceTypes> kResourceTypeNames = {
@@ -312,11 +221,6 @@ gl::Error ResourceManager11::allocate(Renderer11 *renderer,
                                  << gl::FmtHR(hr);
     }
 
-    if (!shadowInitData && renderer->isRobustResourceInitEnabled())
-    {
-        ANGLE_TRY(ClearResource(renderer, desc, resource));
-    }
-
     ASSERT(resource);
     incrResource(GetResourceTypeFromD3D11<T>(), ComputeMemoryUsage(desc));
     *resourceOut = std::move(Resource11<T>(resource, this));
@@ -289,6 +289,15 @@ EGLint SwapChain11::resetOffscreenColorBuffer(int backbufferWidth, int backbuffe
     ASSERT(!err.isError());
     mOffscreenRTView.setDebugName("Offscreen back buffer render target");
 
+    // Surfaces are initialized when they are created, unlike textures and renderbuffers. Client
+    // buffers keep the contents the app gave them.
+    const bool ownsOffscreenTexture = !mAppCreatedShareHandle && mD3DTexture == nullptr;
+    if (ownsOffscreenTexture && mRenderer->isRobustResourceInitEnabled())
+    {
+        const FLOAT zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        mRenderer->getDeviceContext()->ClearRenderTargetView(mOffscreenRTView.get(), zero);
+    }
+
     D3D11_SHADER_RESOURCE_VIEW_DESC offscreenSRVDesc;
     offscreenSRVDesc.Format                    = backbufferFormatInfo.srvFormat;
     offscreenSRVDesc.ViewDimension =
@@ -378,6 +387,15 @@ EGLint SwapChain11::resetOffscreenDepthBuffer(int backbufferWidth, int backbuffe
         ASSERT(!err.isError());
         mDepthStencilDSView.setDebugName("Offscreen depth stencil view");
 
+        if (mRenderer->isRobustResourceInitEnabled())
+        {
+            const angle::Format &depthFormat = depthBufferFormatInfo.format();
+            UINT clearFlags = (depthFormat.depthBits > 0 ? D3D11_CLEAR_DEPTH : 0) |
+                              (depthFormat.stencilBits > 0 ? D3D11_CLEAR_STENCIL : 0);
+            mRenderer->getDeviceContext()->ClearDepthStencilView(mDepthStencilDSView.get(),
+                                                                 clearFlags, 1.0f, 0);
+        }
+
         if (depthBufferFormatInfo.srvFormat != DXGI_FORMAT_UNKNOWN)
         {
             D3D11_SHADER_RESOURCE_VIEW_DESC depthStencilSRVDesc;
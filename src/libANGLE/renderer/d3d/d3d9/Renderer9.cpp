@@ -597,6 +597,7 @@ void Renderer9::endScene()
 
 gl::Error Renderer9::flush()
 {
+    TRACE_EVENT0("gpu.angle", "Renderer9::flush");
     IDirect3DQuery9 *query = nullptr;
     gl::Error error        = allocateEventQuery(&query);
     if (error.isError())
@@ -629,6 +630,7 @@ gl::Error Renderer9::flush()
 
 gl::Error Renderer9::finish()
 {
+    TRACE_EVENT0("gpu.angle", "Renderer9::finish");
     IDirect3DQuery9 *query = nullptr;
     gl::Error error        = allocateEventQuery(&query);
     if (error.isError())
@@ -2697,6 +2699,30 @@ gl::Error Renderer9::createRenderTargetCopy(RenderTargetD3D *source, RenderTarge
     return gl::NoError();
 }
 
+gl::Error Renderer9::initRenderTarget(RenderTargetD3D *renderTarget)
+{
+    ASSERT(renderTarget != nullptr);
+    RenderTarget9 *renderTarget9 = GetAs<RenderTarget9>(renderTarget);
+
+    // ColorFill only accepts color surfaces, and D3D9 can only clear a depth-stencil surface while
+    // it is bound, so depth-stencil render targets are left as allocated.
+    const gl::InternalFormat &formatInfo =
+        gl::GetSizedInternalFormatInfo(renderTarget9->getInternalFormat());
+    if (formatInfo.depthBits > 0 || formatInfo.stencilBits > 0)
+    {
+        return gl::NoError();
+    }
+
+    HRESULT result = mDevice->ColorFill(renderTarget9->getSurface(), nullptr, 0);
+    if (FAILED(result))
+    {
+        ASSERT(result == D3DERR_OUTOFVIDEOMEMORY || result == E_OUTOFMEMORY);
+        return gl::OutOfMemory() << "Failed to clear render target, " << gl::FmtHR(result);
+    }
+
+    return gl::NoError();
+}
+
 gl::Error Renderer9::loadExecutable(const void *function,
                                     size_t length,
                                     ShaderType type,
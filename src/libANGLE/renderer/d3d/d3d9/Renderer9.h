@@ -242,6 +242,7 @@ class Renderer9 : public RendererD3D
                                  GLsizei samples,
                                  RenderTargetD3D **outRT) override;
     gl::Error createRenderTargetCopy(RenderTargetD3D *source, RenderTargetD3D **outRT) override;
+    gl::Error initRenderTarget(RenderTargetD3D *renderTarget) override;
 
     // Shader operations
     gl::Error loadExecutable(const void *function,
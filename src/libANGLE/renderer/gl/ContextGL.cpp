@@ -85,7 +85,8 @@ BufferImpl *ContextGL::createBuffer(const gl::BufferState &state)
 
 VertexArrayImpl *ContextGL::createVertexArray(const gl::VertexArrayState &data)
 {
-    return new VertexArrayGL(data, getFunctions(), getStateManager());
+    return new VertexArrayGL(data, getFunctions(), getStateManager(),
+                             mRenderer->getStreamingBuffer());
 }
 
 QueryImpl *ContextGL::createQuery(GLenum type)
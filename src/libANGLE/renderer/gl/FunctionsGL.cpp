@@ -922,6 +922,9 @@ void FunctionsGL::initializeProcsDesktopGL()
     ASSIGN_WITH_EXT("GL_ARB_sync", "glIsSync", isSync);
     ASSIGN_WITH_EXT("GL_ARB_sync", "glWaitSync", waitSync);
 
+    // GL_ARB_buffer_storage
+    ASSIGN_WITH_EXT("GL_ARB_buffer_storage", "glBufferStorage", bufferStorage);
+
     // GL_EXT_framebuffer_object
     ASSIGN_WITH_EXT("GL_EXT_framebuffer_object", "glIsRenderbufferEXT", isRenderbuffer);
     ASSIGN_WITH_EXT("GL_EXT_framebuffer_object", "glBindRenderbufferEXT", bindRenderbuffer);
@@ -1860,6 +1863,9 @@ void FunctionsGL::initializeProcsGLES()
     ASSIGN_WITH_EXT("GL_OES_mapbuffer", "glMapBufferOES", mapBuffer);
     ASSIGN_WITH_EXT("GL_OES_mapbuffer", "glUnmapBufferOES", unmapBuffer);
 
+    // GL_EXT_buffer_storage
+    ASSIGN_WITH_EXT("GL_EXT_buffer_storage", "glBufferStorageEXT", bufferStorage);
+
     // GL_KHR_debug
     ASSIGN_WITH_EXT("GL_KHR_debug", "glDebugMessageControlKHR", debugMessageControl);
     ASSIGN_WITH_EXT("GL_KHR_debug", "glDebugMessageInsertKHR", debugMessageInsert);
@@ -30,11 +30,13 @@
 #include "libANGLE/renderer/gl/SamplerGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace
 {
@@ -168,6 +170,7 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
       mFunctions(functions),
       mStateManager(nullptr),
       mBlitter(nullptr),
+      mStreamingBuffer(nullptr),
       mHasDebugOutput(false),
       mSkipDrawCalls(false),
       mCapsInitialized(false)
@@ -175,7 +178,8 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
     ASSERT(mFunctions);
     nativegl_gl::GenerateWorkarounds(mFunctions, &mWorkarounds);
     mStateManager = new StateManagerGL(mFunctions, getNativeCaps());
-    mBlitter      = new BlitGL(functions, mWorkarounds, mStateManager);
+    mBlitter         = new BlitGL(functions, mWorkarounds, mStateManager);
+    mStreamingBuffer = new StreamingBufferGL(functions, mStateManager);
 
     mHasDebugOutput = mFunctions->isAtLeastGL(gl::Version(4, 3)) ||
                       mFunctions->hasGLExtension("GL_KHR_debug") ||
@@ -220,17 +224,20 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
 RendererGL::~RendererGL()
 {
     SafeDelete(mBlitter);
+    SafeDelete(mStreamingBuffer);
     SafeDelete(mStateManager);
 }
 
 gl::Error RendererGL::flush()
 {
+    TRACE_EVENT0("gpu.angle", "RendererGL::flush");
     mFunctions->flush();
     return gl::NoError();
 }
 
 gl::Error RendererGL::finish()
 {
+    TRACE_EVENT0("gpu.angle", "RendererGL::finish");
 #ifdef NDEBUG
     if (mWorkarounds.finishDoesNotCauseQueriesToBeAvailable && mHasDebugOutput)
     {
@@ -37,6 +37,7 @@ class BlitGL;
 class ContextImpl;
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class RendererGL : angle::NonCopyable
 {
@@ -160,6 +161,7 @@ class RendererGL : angle::NonCopyable
     StateManagerGL *getStateManager() const { return mStateManager; }
     const WorkaroundsGL &getWorkarounds() const { return mWorkarounds; }
     BlitGL *getBlitter() const { return mBlitter; }
+    StreamingBufferGL *getStreamingBuffer() const { return mStreamingBuffer; }
 
     const gl::Caps &getNativeCaps() const;
     const gl::TextureCapsMap &getNativeTextureCaps() const;
@@ -185,6 +187,9 @@ class RendererGL : angle::NonCopyable
 
     BlitGL *mBlitter;
 
+    // Streams the client vertex and index data of all contexts.
+    StreamingBufferGL *mStreamingBuffer;
+
     WorkaroundsGL mWorkarounds;
 
     bool mHasDebugOutput;
@@ -40,6 +40,11 @@ StateManagerGL::IndexedBufferBinding::IndexedBufferBinding() : offset(0), size(0
 {
 }
 
+StateManagerGL::AppliedTextureUnit::AppliedTextureUnit()
+    : type(GL_NONE), texture(nullptr), completenessSerial(0)
+{
+}
+
 StateManagerGL::StateManagerGL(const FunctionsGL *functions, const gl::Caps &rendererCaps)
     : mFunctions(functions),
       mProgram(0),
@@ -50,6 +55,9 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions, const gl::Caps &ren
       mTextureUnitIndex(0),
       mTextures(),
       mSamplers(rendererCaps.maxCombinedTextureImageUnits, 0),
+      mDirtyTextureUnits(),
+      mDirtyUniformBufferBindings(),
+      mAppliedTextureUnits(rendererCaps.maxCombinedTextureImageUnits),
       mTransformFeedback(0),
       mQueries(),
       mPrevDrawTransformFeedback(nullptr),
@@ -130,6 +138,7 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions, const gl::Caps &ren
       mLocalDirtyBits()
 {
     ASSERT(mFunctions);
+    ASSERT(rendererCaps.maxCombinedTextureImageUnits <= gl::IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
 
     mTextures[GL_TEXTURE_2D].resize(rendererCaps.maxCombinedTextureImageUnits);
     mTextures[GL_TEXTURE_CUBE_MAP].resize(rendererCaps.maxCombinedTextureImageUnits);
@@ -139,6 +148,9 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions, const gl::Caps &ren
 
     mIndexedBuffers[GL_UNIFORM_BUFFER].resize(rendererCaps.maxCombinedUniformBlocks);
 
+    mDirtyTextureUnits.set();
+    mDirtyUniformBufferBindings.set();
+
     for (GLenum queryType : QueryTypes)
     {
         mQueries[queryType] = 0;
@@ -361,6 +373,11 @@ void StateManagerGL::bindBufferBase(GLenum type, size_t index, GLuint buffer)
         binding.offset = static_cast<size_t>(-1);
         binding.size   = static_cast<size_t>(-1);
         mFunctions->bindBufferBase(type, static_cast<GLuint>(index), buffer);
+
+        if (type == GL_UNIFORM_BUFFER)
+        {
+            mDirtyUniformBufferBindings.set(index);
+        }
     }
 }
 
@@ -377,6 +394,11 @@ void StateManagerGL::bindBufferRange(GLenum type,
         binding.offset = offset;
         binding.size   = size;
         mFunctions->bindBufferRange(type, static_cast<GLuint>(index), buffer, offset, size);
+
+        if (type == GL_UNIFORM_BUFFER)
+        {
+            mDirtyUniformBufferBindings.set(index);
+        }
     }
 }
 
@@ -395,6 +417,7 @@ void StateManagerGL::bindTexture(GLenum type, GLuint texture)
     {
         mTextures[type][mTextureUnitIndex] = texture;
         mFunctions->bindTexture(type, texture);
+        mDirtyTextureUnits.set(mTextureUnitIndex);
     }
 }
 
@@ -404,6 +427,7 @@ void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
     {
         mSamplers[unit] = sampler;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
+        mDirtyTextureUnits.set(unit);
     }
 }
 
@@ -778,12 +802,17 @@ void StateManagerGL::setGenericShaderState(const gl::ContextState &data)
     const ProgramGL *programGL = GetImplAs<ProgramGL>(program);
     useProgram(programGL->getProgramID());
 
+    gl::UniformBufferBindingMask syncedUniformBufferBindings;
     for (size_t uniformBlockIndex = 0; uniformBlockIndex < program->getActiveUniformBlockCount();
          uniformBlockIndex++)
     {
         GLuint binding = program->getUniformBlockBinding(static_cast<GLuint>(uniformBlockIndex));
-        const auto &uniformBuffer = state.getIndexedUniformBuffer(binding);
+        if (!mDirtyUniformBufferBindings[binding])
+        {
+            continue;
+        }
 
+        const auto &uniformBuffer = state.getIndexedUniformBuffer(binding);
         if (uniformBuffer.get() != nullptr)
         {
             BufferGL *bufferGL = GetImplAs<BufferGL>(uniformBuffer.get());
@@ -798,21 +827,50 @@ void StateManagerGL::setGenericShaderState(const gl::ContextState &data)
                                 uniformBuffer.getOffset(), uniformBuffer.getSize());
             }
         }
+        syncedUniformBufferBindings.set(binding);
+    }
+    mDirtyUniformBufferBindings &= ~syncedUniformBufferBindings;
+
+    const auto &samplerBindings = program->getSamplerBindings();
+
+    // Find the units whose textures changed since they were applied. This has to finish before
+    // any unit is synced, since syncing a texture clears its dirty bits for the other units it is
+    // bound to.
+    for (const gl::SamplerBinding &samplerUniform : samplerBindings)
+    {
+        for (GLuint textureUnitIndex : samplerUniform.boundTextureUnits)
+        {
+            if (mDirtyTextureUnits[textureUnitIndex])
+            {
+                continue;
+            }
+
+            const AppliedTextureUnit &applied = mAppliedTextureUnits[textureUnitIndex];
+            if (applied.type != samplerUniform.textureType || applied.texture->hasAnyDirtyBit() ||
+                GetImplAs<TextureGL>(applied.texture)->hasAnyDirtyBit() ||
+                applied.texture->getTextureState().getCompletenessSerial() !=
+                    applied.completenessSerial)
+            {
+                mDirtyTextureUnits.set(textureUnitIndex);
+            }
+        }
     }
 
-    for (const gl::SamplerBinding &samplerUniform : program->getSamplerBindings())
+    gl::ActiveTextureMask syncedTextureUnits;
+    for (const gl::SamplerBinding &samplerUniform : samplerBindings)
     {
         GLenum textureType = samplerUniform.textureType;
         for (GLuint textureUnitIndex : samplerUniform.boundTextureUnits)
         {
+            if (!mDirtyTextureUnits[textureUnitIndex])
+            {
+                continue;
+            }
+
             gl::Texture *texture       = state.getSamplerTexture(textureUnitIndex, textureType);
             const gl::Sampler *sampler = state.getSampler(textureUnitIndex);
 
-            const gl::SamplerState &samplerState =
-                sampler ? sampler->getSamplerState() : texture->getSamplerState();
-
-            if (texture != nullptr &&
-                texture->getTextureState().isSamplerComplete(samplerState, data))
+            if (texture != nullptr && state.getCompleteActiveTextureUnits()[textureUnitIndex])
             {
                 const TextureGL *textureGL = GetImplAs<TextureGL>(texture);
 
@@ -846,8 +904,15 @@ void StateManagerGL::setGenericShaderState(const gl::ContextState &data)
             {
                 bindSampler(textureUnitIndex, 0);
             }
+
+            AppliedTextureUnit &applied = mAppliedTextureUnits[textureUnitIndex];
+            applied.type                = textureType;
+            applied.texture             = texture;
+            applied.completenessSerial  = texture->getTextureState().getCompletenessSerial();
+            syncedTextureUnits.set(textureUnitIndex);
         }
     }
+    mDirtyTextureUnits &= ~syncedTextureUnits;
 }
 
 gl::Error StateManagerGL::setGenericDrawState(const gl::ContextState &data)
@@ -1636,6 +1701,15 @@ void StateManagerGL::syncState(const gl::ContextState &data,
             case gl::State::DIRTY_BIT_PROGRAM_BINDING:
                 // TODO(jmadill): implement this
                 break;
+            case gl::State::DIRTY_BIT_TEXTURE_BINDINGS:
+                mDirtyTextureUnits |= state.getDirtyTextureBindings();
+                break;
+            case gl::State::DIRTY_BIT_SAMPLER_BINDINGS:
+                mDirtyTextureUnits |= state.getDirtySamplerBindings();
+                break;
+            case gl::State::DIRTY_BIT_UNIFORM_BUFFER_BINDINGS:
+                mDirtyUniformBufferBindings |= state.getDirtyUniformBufferBindings();
+                break;
             case gl::State::DIRTY_BIT_MULTISAMPLING:
                 setMultisamplingStateEnabled(state.isMultisamplingEnabled());
                 break;
@@ -196,6 +196,23 @@ class StateManagerGL final : angle::NonCopyable
     std::map<GLenum, std::vector<GLuint>> mTextures;
     std::vector<GLuint> mSamplers;
 
+    // Texture units and uniform buffer binding points that may not match the front-end state.
+    // Draws only visit the ones the current program uses and that are marked here.
+    gl::ActiveTextureMask mDirtyTextureUnits;
+    gl::UniformBufferBindingMask mDirtyUniformBufferBindings;
+
+    // What the last sync of each texture unit applied. A bound texture can change its parameters
+    // or completeness without a binding change, so these are checked again before each draw.
+    struct AppliedTextureUnit
+    {
+        AppliedTextureUnit();
+
+        GLenum type;
+        const gl::Texture *texture;
+        unsigned int completenessSerial;
+    };
+    std::vector<AppliedTextureUnit> mAppliedTextureUnits;
+
     GLuint mTransformFeedback;
 
     std::map<GLenum, GLuint> mQueries;
@@ -0,0 +1,196 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StateManagerGL_unittest.cpp:
+//   Tests that the GL back-end only makes native texture, sampler and uniform buffer binding calls
+//   for the state that changed between draws. Runs a Context on the GL back-end over a
+//   RecordingFunctionsGL and counts the native calls of each draw.
+//
+
+#include "gtest/gtest.h"
+
+#include "tests/test_utils/ContextGLTest.h"
+
+namespace
+{
+
+constexpr char kVertexShader[] =
+    "#version 300 es\n"
+    "in vec4 position;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = position;\n"
+    "}\n";
+
+constexpr char kFragmentShader[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "uniform sampler2D tex0;\n"
+    "uniform sampler2D tex1;\n"
+    "uniform Block\n"
+    "{\n"
+    "    vec4 color;\n"
+    "};\n"
+    "out vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragColor = texture(tex0, vec2(0)) + texture(tex1, vec2(0)) + color;\n"
+    "}\n";
+
+class StateManagerGLTest : public angle::ContextGLTest
+{
+  protected:
+    void SetUp() override
+    {
+        angle::ContextGLTest::SetUp();
+
+        GLuint program = angle::CompileProgram(mContext, kVertexShader, kFragmentShader);
+        mContext->useProgram(program);
+        mContext->uniform1i(mContext->getUniformLocation(program, "tex0"), 0);
+        mContext->uniform1i(mContext->getUniformLocation(program, "tex1"), 1);
+
+        mTextures[0] = createTexture(0);
+        mTextures[1] = createTexture(1);
+
+        GLuint buffer = mContext->createBuffer();
+        mContext->bindBuffer(GL_UNIFORM_BUFFER, buffer);
+        mContext->bufferData(GL_UNIFORM_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+        mContext->bindBufferBase(GL_UNIFORM_BUFFER, 0, buffer);
+        ASSERT_EQ(static_cast<GLenum>(GL_NO_ERROR), mContext->getError());
+
+        // Apply everything once, so each test starts from a synced state.
+        draw();
+    }
+
+    GLuint createTexture(GLenum unit)
+    {
+        GLuint texture = mContext->createTexture();
+        mContext->activeTexture(GL_TEXTURE0 + unit);
+        mContext->bindTexture(GL_TEXTURE_2D, texture);
+        mContext->texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                             nullptr);
+        mContext->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        return texture;
+    }
+
+    // Draws and returns the number of native texture, sampler and uniform buffer binding calls.
+    size_t draw()
+    {
+        mFunctions.resetCallCounts();
+        mContext->drawArrays(GL_TRIANGLES, 0, 3);
+        EXPECT_EQ(1u, mFunctions.getCallCount("drawArrays"));
+
+        return mFunctions.getCallCount("activeTexture") + mFunctions.getCallCount("bindTexture") +
+               mFunctions.getCallCount("bindSampler") +
+               mFunctions.getCallCount("bindBufferBase") +
+               mFunctions.getCallCount("bindBufferRange");
+    }
+
+    GLuint mTextures[2];
+};
+
+// A draw that changes nothing makes no binding calls.
+TEST_F(StateManagerGLTest, RedundantDrawMakesNoBindingCalls)
+{
+    EXPECT_EQ(0u, draw());
+    EXPECT_EQ(0u, draw());
+}
+
+// Rebinding the texture that is already bound is filtered as well.
+TEST_F(StateManagerGLTest, RebindingSameTextureMakesNoBindingCalls)
+{
+    mContext->activeTexture(GL_TEXTURE1);
+    mContext->bindTexture(GL_TEXTURE_2D, mTextures[1]);
+    EXPECT_EQ(0u, draw());
+}
+
+// Binding a new texture only re-applies its unit.
+TEST_F(StateManagerGLTest, ChangedTextureOnlySyncsItsUnit)
+{
+    mContext->activeTexture(GL_TEXTURE1);
+    mContext->bindTexture(GL_TEXTURE_2D, mTextures[0]);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindTexture"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("bindSampler"));
+
+    EXPECT_EQ(0u, draw());
+}
+
+// A texture parameter change re-applies the texture once.
+TEST_F(StateManagerGLTest, TextureParameterChangeSyncsTexture)
+{
+    mContext->activeTexture(GL_TEXTURE0);
+    mContext->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("texParameteri") +
+                      mFunctions.getCallCount("texParameterf"));
+
+    EXPECT_EQ(0u, draw());
+}
+
+// Binding a sampler object and changing its parameters re-applies only that sampler.
+TEST_F(StateManagerGLTest, SamplerChangesSyncSampler)
+{
+    GLuint sampler = mContext->createSampler();
+    mContext->bindSampler(0, sampler);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindSampler"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("bindTexture"));
+    EXPECT_EQ(0u, draw());
+
+    mContext->samplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    EXPECT_EQ(0u, draw());
+    EXPECT_EQ(1u, mFunctions.getCallCount("samplerParameterf"));
+}
+
+// A texture that becomes incomplete is unbound, and bound again once it is complete.
+TEST_F(StateManagerGLTest, TextureCompletenessChangesSyncTexture)
+{
+    mContext->activeTexture(GL_TEXTURE0);
+    mContext->texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    mContext->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    EXPECT_NE(0u, draw());
+    EXPECT_EQ(0u, draw());
+
+    mContext->texImage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_NE(0u, draw());
+    EXPECT_EQ(0u, draw());
+}
+
+// Sampler object parameters that change the completeness of the texture are picked up as well.
+TEST_F(StateManagerGLTest, SamplerCompletenessChangesSyncTexture)
+{
+    mContext->activeTexture(GL_TEXTURE0);
+    mContext->texImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    GLuint sampler = mContext->createSampler();
+    mContext->samplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    mContext->bindSampler(0, sampler);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindSampler"));
+    EXPECT_EQ(0u, draw());
+
+    mContext->samplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindTexture"));
+
+    mContext->samplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    draw();
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindTexture"));
+}
+
+// Changing a uniform buffer binding only re-applies that binding.
+TEST_F(StateManagerGLTest, ChangedUniformBufferOnlySyncsItsBinding)
+{
+    GLuint buffer = mContext->createBuffer();
+    mContext->bindBuffer(GL_UNIFORM_BUFFER, buffer);
+    mContext->bufferData(GL_UNIFORM_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+    mContext->bindBufferBase(GL_UNIFORM_BUFFER, 0, buffer);
+
+    EXPECT_EQ(1u, draw());
+    EXPECT_EQ(1u, mFunctions.getCallCount("bindBufferBase"));
+    EXPECT_EQ(0u, draw());
+}
+
+}  // anonymous namespace
@@ -0,0 +1,294 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the class methods for StreamingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+
+namespace rx
+{
+
+namespace
+{
+constexpr size_t kInitialSize = 1024 * 1024;
+
+// How long a single wait for the GPU to release a segment lasts, and how many times it is retried
+// before giving up.
+constexpr GLuint64 kSegmentWaitTimeoutNs = 1000000000;
+constexpr size_t kSegmentWaitAttempts    = 5;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL(const FunctionsGL *functions, StateManagerGL *stateManager)
+    : mFunctions(functions),
+      mStateManager(stateManager),
+      mMode(Mode::SubData),
+      mBufferID(0),
+      mSerial(0),
+      mSize(0),
+      mHead(0),
+      mPersistentPointer(nullptr),
+      mCurrentSegment(0),
+      mFirstUnfencedSegment(0),
+      mSegmentFences(),
+      mMappedOffset(0),
+      mMappedSize(0)
+{
+    ASSERT(mFunctions);
+    ASSERT(mStateManager);
+
+    // bufferStorage is only loaded on GL 4.4 or with GL_ARB_buffer_storage/GL_EXT_buffer_storage.
+    if (mFunctions->bufferStorage != nullptr && mFunctions->mapBufferRange != nullptr &&
+        mFunctions->fenceSync != nullptr)
+    {
+        mMode = Mode::Persistent;
+    }
+    else if (mFunctions->mapBufferRange != nullptr)
+    {
+        mMode = Mode::MapUnsynchronized;
+    }
+
+    mSegmentFences.fill(nullptr);
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    releaseFences();
+
+    // Deleting the buffer also releases a persistent mapping.
+    mStateManager->deleteBuffer(mBufferID);
+    mBufferID          = 0;
+    mPersistentPointer = nullptr;
+}
+
+gl::Error StreamingBufferGL::map(size_t size,
+                                 size_t alignment,
+                                 uint8_t **outPointer,
+                                 size_t *outOffset)
+{
+    ASSERT(size > 0 && alignment > 0);
+
+    // The draw that used the previous region has been submitted by now, so the segments that
+    // writing moved past can be fenced.
+    if (mMode == Mode::Persistent)
+    {
+        for (; mFirstUnfencedSegment < mCurrentSegment; mFirstUnfencedSegment++)
+        {
+            fenceSegment(mFirstUnfencedSegment);
+        }
+    }
+
+    size_t offset = roundUp(mHead, alignment);
+    if (mBufferID == 0 || size > mSize)
+    {
+        ANGLE_TRY(allocate(size));
+        offset = 0;
+    }
+    else if (offset + size > mSize)
+    {
+        // Wrap around to the start of the buffer.
+        if (mMode == Mode::Persistent)
+        {
+            fenceSegment(mCurrentSegment);
+            mCurrentSegment       = 0;
+            mFirstUnfencedSegment = 0;
+            ANGLE_TRY(waitForSegment(mCurrentSegment));
+        }
+        else
+        {
+            orphan();
+        }
+        offset = 0;
+    }
+
+    if (mMode == Mode::Persistent)
+    {
+        // Make sure the GPU is done with the segments that are entered. The segments that are left
+        // behind still hold part of this region, they are fenced on the next map().
+        size_t lastSegment = (offset + size - 1) / getSegmentSize();
+        while (mCurrentSegment < lastSegment)
+        {
+            mCurrentSegment++;
+            ANGLE_TRY(waitForSegment(mCurrentSegment));
+        }
+    }
+
+    mHead         = offset + size;
+    mMappedOffset = offset;
+    mMappedSize   = size;
+
+    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mBufferID);
+
+    switch (mMode)
+    {
+        case Mode::Persistent:
+            *outPointer = mPersistentPointer + offset;
+            break;
+
+        case Mode::MapUnsynchronized:
+            *outPointer = reinterpret_cast<uint8_t *>(mFunctions->mapBufferRange(
+                GL_ARRAY_BUFFER, offset, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+            if (*outPointer == nullptr)
+            {
+                return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+            }
+            break;
+
+        case Mode::SubData:
+            if (mStagingData.size() < size)
+            {
+                mStagingData.resize(size);
+            }
+            *outPointer = mStagingData.data();
+            break;
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    *outOffset = offset;
+    return gl::NoError();
+}
+
+bool StreamingBufferGL::unmap()
+{
+    switch (mMode)
+    {
+        case Mode::Persistent:
+            // The mapping is coherent, the writes are visible to the GPU as they are.
+            return true;
+
+        case Mode::MapUnsynchronized:
+            mStateManager->bindBuffer(GL_ARRAY_BUFFER, mBufferID);
+            return mFunctions->unmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+
+        case Mode::SubData:
+            mStateManager->bindBuffer(GL_ARRAY_BUFFER, mBufferID);
+            mFunctions->bufferSubData(GL_ARRAY_BUFFER, mMappedOffset, mMappedSize,
+                                      mStagingData.data());
+            return true;
+
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+gl::Error StreamingBufferGL::allocate(size_t minimumSize)
+{
+    size_t size = std::max(kInitialSize, mSize * 2);
+    while (size < minimumSize)
+    {
+        size *= 2;
+    }
+
+    // The GPU may still be reading from the old buffer, but it stays alive until it is done. The
+    // new buffer is created first so that it never reuses the old name.
+    GLuint oldBufferID = mBufferID;
+    mFunctions->genBuffers(1, &mBufferID);
+    releaseFences();
+    mStateManager->deleteBuffer(oldBufferID);
+    mPersistentPointer = nullptr;
+    mSerial++;
+
+    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mBufferID);
+    mSize                 = size;
+    mHead                 = 0;
+    mCurrentSegment       = 0;
+    mFirstUnfencedSegment = 0;
+
+    if (mMode == Mode::Persistent)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        mFunctions->bufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+        mPersistentPointer = reinterpret_cast<uint8_t *>(
+            mFunctions->mapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+        if (mPersistentPointer == nullptr)
+        {
+            // The next map() allocates again rather than handing out regions of this buffer.
+            mSize = 0;
+            return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+        }
+    }
+    else
+    {
+        mFunctions->bufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    }
+
+    return gl::NoError();
+}
+
+void StreamingBufferGL::orphan()
+{
+    ASSERT(mMode != Mode::Persistent);
+    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mBufferID);
+    mFunctions->bufferData(GL_ARRAY_BUFFER, mSize, nullptr, GL_STREAM_DRAW);
+    mHead = 0;
+}
+
+void StreamingBufferGL::fenceSegment(size_t segment)
+{
+    GLsync &fence = mSegmentFences[segment];
+    if (fence != nullptr)
+    {
+        mFunctions->deleteSync(fence);
+    }
+    fence = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+gl::Error StreamingBufferGL::waitForSegment(size_t segment)
+{
+    GLsync &fence = mSegmentFences[segment];
+    if (fence == nullptr)
+    {
+        return gl::NoError();
+    }
+
+    GLenum result = GL_TIMEOUT_EXPIRED;
+    for (size_t attempt = 0; attempt < kSegmentWaitAttempts && result == GL_TIMEOUT_EXPIRED;
+         attempt++)
+    {
+        result =
+            mFunctions->clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kSegmentWaitTimeoutNs);
+    }
+
+    // The fence is kept if the wait failed, it is waited on again the next time the segment is
+    // entered.
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        return gl::OutOfMemory() << "Timed out waiting for the client data streaming buffer.";
+    }
+    if (result == GL_WAIT_FAILED)
+    {
+        return gl::OutOfMemory() << "Failed to wait for the client data streaming buffer.";
+    }
+
+    mFunctions->deleteSync(fence);
+    fence = nullptr;
+    return gl::NoError();
+}
+
+void StreamingBufferGL::releaseFences()
+{
+    for (GLsync &fence : mSegmentFences)
+    {
+        if (fence != nullptr)
+        {
+            mFunctions->deleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+}  // namespace rx
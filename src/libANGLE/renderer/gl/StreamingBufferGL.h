@@ -0,0 +1,94 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the class interface for StreamingBufferGL, a ring buffer that
+// client vertex and index data is streamed through before drawing.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <array>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/angletypes.h"
+
+namespace rx
+{
+
+class FunctionsGL;
+class StateManagerGL;
+
+// Hands out consecutive regions of one native buffer, wrapping around when the end is reached.
+// Depending on what the driver supports, the buffer is:
+//  - Mapped once with a persistent, coherent mapping. The buffer is split into segments and a
+//    fence is inserted once the draws using a segment have been submitted, so that wrapping
+//    around only waits for the GPU to finish reading the segment that is about to be overwritten.
+//  - Orphaned when wrapping around, with each region mapped unsynchronized.
+//  - Written with glBufferSubData from a staging copy, orphaning when wrapping around.
+class StreamingBufferGL : angle::NonCopyable
+{
+  public:
+    StreamingBufferGL(const FunctionsGL *functions, StateManagerGL *stateManager);
+    ~StreamingBufferGL();
+
+    // Reserves size bytes starting at an offset that is a multiple of alignment, returning a
+    // pointer to write the data to and the offset of the data in the buffer. The buffer is bound
+    // to GL_ARRAY_BUFFER. Has to be followed by unmap() before the data is used, and the draw that
+    // uses the data has to be submitted before the next map().
+    gl::Error map(size_t size, size_t alignment, uint8_t **outPointer, size_t *outOffset);
+
+    // Returns false if the driver lost the written data, in which case it has to be written again
+    // to a new region.
+    bool unmap();
+
+    GLuint getBufferID() const { return mBufferID; }
+
+    // Changes whenever the buffer is replaced by a larger one.
+    unsigned int getSerial() const { return mSerial; }
+
+  private:
+    enum class Mode
+    {
+        Persistent,
+        MapUnsynchronized,
+        SubData,
+    };
+
+    static constexpr size_t kSegmentCount = 4;
+
+    gl::Error allocate(size_t minimumSize);
+    void orphan();
+    size_t getSegmentSize() const { return mSize / kSegmentCount; }
+    void fenceSegment(size_t segment);
+    gl::Error waitForSegment(size_t segment);
+    void releaseFences();
+
+    const FunctionsGL *mFunctions;
+    StateManagerGL *mStateManager;
+    Mode mMode;
+
+    GLuint mBufferID;
+    unsigned int mSerial;
+    size_t mSize;
+    size_t mHead;
+
+    // Persistent mode only.
+    uint8_t *mPersistentPointer;
+    size_t mCurrentSegment;
+    size_t mFirstUnfencedSegment;
+    std::array<GLsync, kSegmentCount> mSegmentFences;
+
+    // The region returned by the last map().
+    size_t mMappedOffset;
+    size_t mMappedSize;
+    std::vector<uint8_t> mStagingData;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
@@ -0,0 +1,220 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StreamingBufferGL_unittest.cpp:
+//   Tests of the ring buffer the GL back-end streams client vertex and index data through, and
+//   of the native calls VertexArrayGL makes when drawing from client data.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+#include "tests/test_utils/ContextGLTest.h"
+
+namespace
+{
+
+constexpr size_t kBufferSize  = 1024 * 1024;
+constexpr size_t kSegmentSize = kBufferSize / 4;
+
+class StreamingBufferGLTest : public testing::Test
+{
+  protected:
+    StreamingBufferGLTest() : mStateManager(&mFunctions, gl::Caps()) {}
+
+    size_t map(rx::StreamingBufferGL *buffer, size_t size)
+    {
+        uint8_t *pointer = nullptr;
+        size_t offset    = 0;
+        EXPECT_FALSE(buffer->map(size, 16, &pointer, &offset).isError());
+        EXPECT_NE(nullptr, pointer);
+        memset(pointer, 0xFF, size);
+        EXPECT_TRUE(buffer->unmap());
+        return offset;
+    }
+
+    rx::RecordingFunctionsGL mFunctions;
+    rx::StateManagerGL mStateManager;
+};
+
+void *INTERNAL_GL_APIENTRY FailingMapBufferRange(GLenum target,
+                                                 GLintptr offset,
+                                                 GLsizeiptr length,
+                                                 GLbitfield access)
+{
+    return nullptr;
+}
+
+// With buffer storage, the buffer is mapped once and regions are handed out consecutively.
+TEST_F(StreamingBufferGLTest, PersistentMapsOnce)
+{
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+
+    EXPECT_EQ(0u, map(&buffer, 100));
+    EXPECT_EQ(112u, map(&buffer, 100));
+    EXPECT_EQ(224u, map(&buffer, 16));
+
+    EXPECT_EQ(1u, mFunctions.getCallCount("bufferStorage"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("mapBufferRange"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("unmapBuffer"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("bufferData"));
+}
+
+// A segment that writing moved past is fenced by the next map, once the draw using it was
+// submitted, and wrapping around waits for the fence of the first segment.
+TEST_F(StreamingBufferGLTest, PersistentFencesRetiredSegments)
+{
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+
+    for (size_t segment = 0; segment < 4; segment++)
+    {
+        EXPECT_EQ(segment * kSegmentSize, map(&buffer, kSegmentSize));
+    }
+    EXPECT_EQ(2u, mFunctions.getCallCount("fenceSync"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("clientWaitSync"));
+
+    EXPECT_EQ(0u, map(&buffer, kSegmentSize));
+    EXPECT_EQ(4u, mFunctions.getCallCount("fenceSync"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("clientWaitSync"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("mapBufferRange"));
+}
+
+// An allocation larger than the buffer replaces it with a larger one.
+TEST_F(StreamingBufferGLTest, GrowsForLargeAllocations)
+{
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+    map(&buffer, 16);
+    GLuint firstBuffer       = buffer.getBufferID();
+    unsigned int firstSerial = buffer.getSerial();
+
+    EXPECT_EQ(0u, map(&buffer, 3 * kBufferSize));
+    EXPECT_NE(firstBuffer, buffer.getBufferID());
+    EXPECT_NE(firstSerial, buffer.getSerial());
+    EXPECT_EQ(1u, mFunctions.getCallCount("deleteBuffers"));
+    EXPECT_EQ(2u, mFunctions.getCallCount("mapBufferRange"));
+}
+
+// A buffer whose persistent mapping failed is replaced by the next map instead of being written
+// through a null mapping.
+TEST_F(StreamingBufferGLTest, PersistentMapFailureReallocates)
+{
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+    PFNGLMAPBUFFERRANGEPROC mapBufferRange = mFunctions.mapBufferRange;
+
+    mFunctions.mapBufferRange = &FailingMapBufferRange;
+    uint8_t *pointer          = nullptr;
+    size_t offset             = 0;
+    EXPECT_TRUE(buffer.map(16, 16, &pointer, &offset).isError());
+
+    mFunctions.mapBufferRange = mapBufferRange;
+    EXPECT_EQ(0u, map(&buffer, 16));
+    EXPECT_EQ(2u, mFunctions.getCallCount("bufferStorage"));
+}
+
+// Without buffer storage, every region is mapped unsynchronized and the buffer is orphaned when
+// wrapping around.
+TEST_F(StreamingBufferGLTest, MapUnsynchronizedOrphansOnWrap)
+{
+    mFunctions.bufferStorage = nullptr;
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+
+    map(&buffer, kBufferSize / 2);
+    map(&buffer, kBufferSize / 2);
+    EXPECT_EQ(2u, mFunctions.getCallCount("mapBufferRange"));
+    EXPECT_EQ(2u, mFunctions.getCallCount("unmapBuffer"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("bufferData"));
+
+    EXPECT_EQ(0u, map(&buffer, 16));
+    EXPECT_EQ(2u, mFunctions.getCallCount("bufferData"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("fenceSync"));
+}
+
+// Without any way to map, the data is uploaded with glBufferSubData.
+TEST_F(StreamingBufferGLTest, SubDataFallback)
+{
+    mFunctions.bufferStorage  = nullptr;
+    mFunctions.mapBufferRange = nullptr;
+    rx::StreamingBufferGL buffer(&mFunctions, &mStateManager);
+
+    EXPECT_EQ(0u, map(&buffer, 100));
+    EXPECT_EQ(112u, map(&buffer, 100));
+    EXPECT_EQ(2u, mFunctions.getCallCount("bufferSubData"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("bufferData"));
+}
+
+constexpr char kVertexShader[] =
+    "#version 300 es\n"
+    "layout(location = 0) in vec4 position;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = position;\n"
+    "}\n";
+
+constexpr char kFragmentShader[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "out vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragColor = vec4(1.0);\n"
+    "}\n";
+
+class ClientDataStreamingTest : public angle::ContextGLTest
+{
+  protected:
+    void SetUp() override
+    {
+        angle::ContextGLTest::SetUp();
+        mContext->useProgram(angle::CompileProgram(mContext, kVertexShader, kFragmentShader));
+
+        mPositions.resize(4 * 64, 0.5f);
+        mContext->vertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, mPositions.data());
+        mContext->enableVertexAttribArray(0);
+        ASSERT_EQ(static_cast<GLenum>(GL_NO_ERROR), mContext->getError());
+    }
+
+    // Like the entry point, gathers the parameters the draw reads back from validation.
+    void drawElements(GLsizei count, GLenum type, const void *indices)
+    {
+        const GLenum mode = GL_TRIANGLES;
+        mContext->gatherParams<gl::EntryPoint::DrawElements>(mode, count, type, indices);
+        mContext->drawElements(mode, count, type, indices);
+    }
+
+    std::vector<GLfloat> mPositions;
+};
+
+// Draws from client arrays share one persistently mapped buffer.
+TEST_F(ClientDataStreamingTest, ClientArraysShareOneMapping)
+{
+    for (int draw = 0; draw < 10; draw++)
+    {
+        mContext->drawArrays(GL_TRIANGLES, draw, 3);
+    }
+
+    EXPECT_EQ(10u, mFunctions.getCallCount("drawArrays"));
+    EXPECT_EQ(10u, mFunctions.getCallCount("vertexAttribPointer"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("mapBufferRange"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("unmapBuffer"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("bufferSubData"));
+}
+
+// Client indices are streamed through the same buffer as the client attributes.
+TEST_F(ClientDataStreamingTest, ClientIndicesShareTheBuffer)
+{
+    const GLushort indices[] = {0, 1, 2, 2, 1, 3};
+    drawElements(6, GL_UNSIGNED_SHORT, indices);
+    size_t bindBufferCalls = mFunctions.getCallCount("bindBuffer");
+
+    // The second draw only has to point the attribute at its new data.
+    drawElements(6, GL_UNSIGNED_SHORT, indices);
+    EXPECT_EQ(bindBufferCalls, mFunctions.getCallCount("bindBuffer"));
+    EXPECT_EQ(2u, mFunctions.getCallCount("drawElements"));
+    EXPECT_EQ(1u, mFunctions.getCallCount("mapBufferRange"));
+    EXPECT_EQ(0u, mFunctions.getCallCount("bufferData"));
+}
+
+}  // anonymous namespace
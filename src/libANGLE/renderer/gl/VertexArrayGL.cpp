@@ -18,6 +18,7 @@
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
 using namespace gl;
@@ -26,6 +27,10 @@ namespace rx
 {
 namespace
 {
+// Alignment of the region reserved for the client data of a draw, and of the attribute data
+// following the indices in it.
+constexpr size_t kStreamingDataAlignment = 16;
+
 // Warning: you should ensure binding really matches attrib.bindingIndex before using this function.
 bool AttributeNeedsStreaming(const VertexAttribute &attrib, const VertexBinding &binding)
 {
@@ -51,20 +56,21 @@ bool IsVertexAttribPointerSupported(size_t attribIndex, const VertexAttribute &a
 
 VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
                              const FunctionsGL *functions,
-                             StateManagerGL *stateManager)
+                             StateManagerGL *stateManager,
+                             StreamingBufferGL *streamingBuffer)
     : VertexArrayImpl(state),
       mFunctions(functions),
       mStateManager(stateManager),
+      mStreamingBuffer(streamingBuffer),
       mVertexArrayID(0),
       mAppliedElementArrayBuffer(),
       mAppliedBindings(state.getMaxBindings()),
-      mStreamingElementArrayBufferSize(0),
       mStreamingElementArrayBuffer(0),
-      mStreamingArrayBufferSize(0),
-      mStreamingArrayBuffer(0)
+      mStreamingElementArrayBufferSerial(0)
 {
     ASSERT(mFunctions);
     ASSERT(mStateManager);
+    ASSERT(mStreamingBuffer);
     mFunctions->genVertexArrays(1, &mVertexArrayID);
 
     // Set the cached vertex attribute array and vertex attribute binding array size
@@ -80,14 +86,6 @@ VertexArrayGL::~VertexArrayGL()
     mStateManager->deleteVertexArray(mVertexArrayID);
     mVertexArrayID = 0;
 
-    mStateManager->deleteBuffer(mStreamingElementArrayBuffer);
-    mStreamingElementArrayBufferSize = 0;
-    mStreamingElementArrayBuffer     = 0;
-
-    mStateManager->deleteBuffer(mStreamingArrayBuffer);
-    mStreamingArrayBufferSize = 0;
-    mStreamingArrayBuffer     = 0;
-
     mAppliedElementArrayBuffer.set(nullptr);
     for (auto &binding : mAppliedBindings)
     {
@@ -125,6 +123,7 @@ gl::Error VertexArrayGL::syncElementArrayState() const
         const BufferGL *bufferGL = GetImplAs<BufferGL>(elementArrayBuffer);
         mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferGL->getBufferID());
         mAppliedElementArrayBuffer.set(elementArrayBuffer);
+        mStreamingElementArrayBuffer = 0;
     }
 
     return gl::NoError();
@@ -141,9 +140,20 @@ gl::Error VertexArrayGL::syncDrawState(const gl::AttributesMask &activeAttribute
 {
     mStateManager->bindVertexArray(mVertexArrayID, getAppliedElementArrayBufferID());
 
+    // If the streaming buffer was replaced since it was bound as the element array buffer, the
+    // vertex array still holds the old buffer. Unbind it so the applied state is known again.
+    if (mStreamingElementArrayBuffer != 0 &&
+        mStreamingElementArrayBufferSerial != mStreamingBuffer->getSerial())
+    {
+        mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        mStreamingElementArrayBuffer = 0;
+    }
+
     // Check if any attributes need to be streamed, determines if the index range needs to be
     // computed
     bool attributesNeedStreaming = mAttributesNeedStreaming.any();
+    bool indicesNeedStreaming =
+        (type != GL_NONE && mData.getElementArrayBuffer().get() == nullptr);
 
     // Determine if an index buffer needs to be streamed and the range of vertices that need to be
     // copied
@@ -164,13 +174,10 @@ gl::Error VertexArrayGL::syncDrawState(const gl::AttributesMask &activeAttribute
         indexRange.end   = first + count - 1;
     }
 
-    if (attributesNeedStreaming)
+    if (attributesNeedStreaming || indicesNeedStreaming)
     {
-        Error error = streamAttributes(activeAttributesMask, instanceCount, indexRange);
-        if (error.isError())
-        {
-            return error;
-        }
+        ANGLE_TRY(streamClientData(activeAttributesMask, instanceCount, indexRange, count,
+                                   indicesNeedStreaming ? type : GL_NONE, indices, outIndices));
     }
 
     return NoError();
@@ -196,6 +203,7 @@ gl::Error VertexArrayGL::syncIndexData(GLsizei count,
             const BufferGL *bufferGL = GetImplAs<BufferGL>(elementArrayBuffer);
             mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferGL->getBufferID());
             mAppliedElementArrayBuffer.set(elementArrayBuffer);
+            mStreamingElementArrayBuffer = 0;
         }
 
         // Only compute the index range if the attributes also need to be streamed
@@ -216,7 +224,7 @@ gl::Error VertexArrayGL::syncIndexData(GLsizei count,
     }
     else
     {
-        // Need to stream the index buffer
+        // The indices are streamed along with the attributes.
         // TODO: if GLES, nothing needs to be streamed
 
         // Only compute the index range if the attributes also need to be streamed
@@ -225,35 +233,7 @@ gl::Error VertexArrayGL::syncIndexData(GLsizei count,
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
 
-        // Allocate the streaming element array buffer
-        if (mStreamingElementArrayBuffer == 0)
-        {
-            mFunctions->genBuffers(1, &mStreamingElementArrayBuffer);
-            mStreamingElementArrayBufferSize = 0;
-        }
-
-        mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mStreamingElementArrayBuffer);
-        mAppliedElementArrayBuffer.set(nullptr);
-
-        // Make sure the element array buffer is large enough
-        const Type &indexTypeInfo          = GetTypeInfo(type);
-        size_t requiredStreamingBufferSize = indexTypeInfo.bytes * count;
-        if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
-        {
-            // Copy the indices in while resizing the buffer
-            mFunctions->bufferData(GL_ELEMENT_ARRAY_BUFFER, requiredStreamingBufferSize, indices,
-                                   GL_DYNAMIC_DRAW);
-            mStreamingElementArrayBufferSize = requiredStreamingBufferSize;
-        }
-        else
-        {
-            // Put the indices at the beginning of the buffer
-            mFunctions->bufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, requiredStreamingBufferSize,
-                                      indices);
-        }
-
-        // Set the index offset for the draw call to zero since the supplied index pointer is to
-        // client data
+        // Replaced by the offset of the streamed indices
         *outIndices = nullptr;
     }
 
@@ -292,55 +272,71 @@ void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &act
     }
 }
 
-gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttributesMask,
+gl::Error VertexArrayGL::streamClientData(const gl::AttributesMask &activeAttributesMask,
                                           GLsizei instanceCount,
-                                          const gl::IndexRange &indexRange) const
+                                          const gl::IndexRange &indexRange,
+                                          GLsizei indexCount,
+                                          GLenum indexType,
+                                          const void *indices,
+                                          const void **outIndices) const
 {
+    // The indices go first, followed by the attributes.
+    size_t indexDataSize = 0;
+    if (indexType != GL_NONE)
+    {
+        indexDataSize = GetTypeInfo(indexType).bytes * indexCount;
+    }
+
     // Sync the vertex attribute state and track what data needs to be streamed
-    size_t streamingDataSize    = 0;
+    size_t attributeDataSize    = 0;
     size_t maxAttributeDataSize = 0;
-
-    computeStreamingAttributeSizes(activeAttributesMask, instanceCount, indexRange,
-                                   &streamingDataSize, &maxAttributeDataSize);
-
-    if (streamingDataSize == 0)
+    if (mAttributesNeedStreaming.any())
     {
-        return gl::NoError();
+        computeStreamingAttributeSizes(activeAttributesMask, instanceCount, indexRange,
+                                       &attributeDataSize, &maxAttributeDataSize);
     }
 
-    if (mStreamingArrayBuffer == 0)
+    // If first is greater than zero, a slack space needs to be left before the attribute data so
+    // that the same 'first' argument can be passed into the draw call.
+    size_t requiredSize       = indexDataSize;
+    size_t attributeDataStart = 0;
+    if (attributeDataSize > 0)
     {
-        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
-        mStreamingArrayBufferSize = 0;
+        attributeDataStart = roundUp(indexDataSize, kStreamingDataAlignment) +
+                             maxAttributeDataSize * indexRange.start;
+        requiredSize = attributeDataStart + attributeDataSize;
     }
 
-    // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
-    // so that the same 'first' argument can be passed into the draw call.
-    const size_t bufferEmptySpace   = maxAttributeDataSize * indexRange.start;
-    const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
-
-    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
+    if (requiredSize == 0)
     {
-        mFunctions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr, GL_DYNAMIC_DRAW);
-        mStreamingArrayBufferSize = requiredBufferSize;
+        return gl::NoError();
     }
 
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
     // somehow (such as by a screen change), retry writing the data a few times and return
     // OUT_OF_MEMORY if that fails.
-    GLboolean unmapResult     = GL_FALSE;
+    bool unmapResult          = false;
     size_t unmapRetryAttempts = 5;
-    while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
+    size_t regionOffset       = 0;
+    while (!unmapResult && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
-        size_t curBufferOffset = bufferEmptySpace;
+        uint8_t *bufferPointer = nullptr;
+        ANGLE_TRY(mStreamingBuffer->map(requiredSize, kStreamingDataAlignment, &bufferPointer,
+                                        &regionOffset));
+
+        if (indexDataSize > 0)
+        {
+            memcpy(bufferPointer, indices, indexDataSize);
+        }
+
+        size_t curBufferOffset = attributeDataStart;
 
         const auto &attribs  = mData.getVertexAttributes();
         const auto &bindings = mData.getVertexBindings();
 
-        gl::AttributesMask attribsToStream = (mAttributesNeedStreaming & activeAttributesMask);
+        gl::AttributesMask attribsToStream =
+            (attributeDataSize > 0) ? (mAttributesNeedStreaming & activeAttributesMask)
+                                    : gl::AttributesMask();
 
         for (auto idx : attribsToStream)
         {
@@ -382,7 +378,8 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             }
 
             // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (firstIndex * destStride);
+            const size_t vertexStartOffset =
+                regionOffset + curBufferOffset - (firstIndex * destStride);
 
             callVertexAttribPointer(static_cast<GLuint>(idx), attrib,
                                     static_cast<GLsizei>(destStride),
@@ -391,14 +388,25 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             curBufferOffset += destStride * streamedVertexCount;
         }
 
-        unmapResult = mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+        unmapResult = mStreamingBuffer->unmap();
     }
 
-    if (unmapResult != GL_TRUE)
+    if (!unmapResult)
     {
         return Error(GL_OUT_OF_MEMORY, "Failed to unmap the client data streaming buffer.");
     }
 
+    if (indexDataSize > 0)
+    {
+        mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mStreamingBuffer->getBufferID());
+        mAppliedElementArrayBuffer.set(nullptr);
+        mStreamingElementArrayBuffer       = mStreamingBuffer->getBufferID();
+        mStreamingElementArrayBufferSerial = mStreamingBuffer->getSerial();
+
+        // The indices are at the start of the region.
+        *outIndices = reinterpret_cast<const void *>(regionOffset);
+    }
+
     return NoError();
 }
 
@@ -16,13 +16,15 @@ namespace rx
 
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class VertexArrayGL : public VertexArrayImpl
 {
   public:
     VertexArrayGL(const gl::VertexArrayState &data,
                   const FunctionsGL *functions,
-                  StateManagerGL *stateManager);
+                  StateManagerGL *stateManager,
+                  StreamingBufferGL *streamingBuffer);
     ~VertexArrayGL() override;
 
     gl::Error syncDrawArraysState(const gl::AttributesMask &activeAttributesMask,
@@ -54,7 +56,8 @@ class VertexArrayGL : public VertexArrayImpl
                             bool primitiveRestartEnabled,
                             const void **outIndices) const;
 
-    // Apply index data, only sets outIndexRange if attributesNeedStreaming is true
+    // Apply index data, only sets outIndexRange if attributesNeedStreaming is true. Client index
+    // data is left to streamClientData.
     gl::Error syncIndexData(GLsizei count,
                             GLenum type,
                             const void *indices,
@@ -71,10 +74,15 @@ class VertexArrayGL : public VertexArrayImpl
                                         size_t *outStreamingDataSize,
                                         size_t *outMaxAttributeDataSize) const;
 
-    // Stream attributes that have client data
-    gl::Error streamAttributes(const gl::AttributesMask &activeAttributesMask,
+    // Stream the client index data, if indexType is not GL_NONE, and the attributes that have
+    // client data through one region of the streaming buffer.
+    gl::Error streamClientData(const gl::AttributesMask &activeAttributesMask,
                                GLsizei instanceCount,
-                               const gl::IndexRange &indexRange) const;
+                               const gl::IndexRange &indexRange,
+                               GLsizei indexCount,
+                               GLenum indexType,
+                               const void *indices,
+                               const void **outIndices) const;
 
     void updateNeedsStreaming(size_t attribIndex);
     void updateAttribEnabled(size_t attribIndex);
@@ -88,6 +96,7 @@ class VertexArrayGL : public VertexArrayImpl
 
     const FunctionsGL *mFunctions;
     StateManagerGL *mStateManager;
+    StreamingBufferGL *mStreamingBuffer;
 
     GLuint mVertexArrayID;
 
@@ -96,11 +105,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable std::vector<gl::VertexAttribute> mAppliedAttributes;
     mutable std::vector<gl::VertexBinding> mAppliedBindings;
 
-    mutable size_t mStreamingElementArrayBufferSize;
+    // The streaming buffer, if it is bound as the element array buffer of this vertex array,
+    // and its serial at that time.
     mutable GLuint mStreamingElementArrayBuffer;
-
-    mutable size_t mStreamingArrayBufferSize;
-    mutable GLuint mStreamingArrayBuffer;
+    mutable unsigned int mStreamingElementArrayBufferSerial;
 
     gl::AttributesMask mAttributesNeedStreaming;
 };
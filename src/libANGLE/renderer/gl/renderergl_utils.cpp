@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "common/mathutil.h"
@@ -483,7 +484,9 @@ void GenerateCaps(const FunctionsGL *functions,
     if (functions->isAtLeastGL(gl::Version(3, 1)) || functions->hasGLExtension("GL_ARB_uniform_buffer_object") ||
         functions->isAtLeastGLES(gl::Version(3, 0)))
     {
-        caps->maxUniformBufferBindings = QuerySingleGLInt(functions, GL_MAX_UNIFORM_BUFFER_BINDINGS);
+        caps->maxUniformBufferBindings =
+            std::min(QuerySingleGLInt(functions, GL_MAX_UNIFORM_BUFFER_BINDINGS),
+                     static_cast<GLint>(gl::IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS));
         caps->maxUniformBlockSize = QuerySingleGLInt64(functions, GL_MAX_UNIFORM_BLOCK_SIZE);
         caps->uniformBufferOffsetAlignment = QuerySingleGLInt(functions, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT);
         caps->maxCombinedUniformBlocks = caps->maxVertexUniformBlocks + caps->maxFragmentInputComponents;
@@ -525,7 +528,9 @@ void GenerateCaps(const FunctionsGL *functions,
 
     // Determine the max combined texture image units by adding the vertex and fragment limits.  If
     // the real cap is queried, it would contain the limits for shader types that are not available to ES.
-    caps->maxCombinedTextureImageUnits = caps->maxVertexTextureImageUnits + caps->maxTextureImageUnits;
+    caps->maxCombinedTextureImageUnits =
+        std::min(caps->maxVertexTextureImageUnits + caps->maxTextureImageUnits,
+                 static_cast<GLuint>(gl::IMPLEMENTATION_MAX_ACTIVE_TEXTURES));
 
     // Table 6.34, implementation dependent transform feedback limits
     if (functions->isAtLeastGL(gl::Version(4, 0)) ||
@@ -157,6 +157,48 @@ gl::Error ContextNULL::drawElementsIndirect(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error ContextNULL::multiDrawArrays(const gl::Context *context,
+                                       GLenum mode,
+                                       const GLint *firsts,
+                                       const GLsizei *counts,
+                                       GLsizei drawcount)
+{
+    return gl::NoError();
+}
+
+gl::Error ContextNULL::multiDrawArraysInstanced(const gl::Context *context,
+                                                GLenum mode,
+                                                const GLint *firsts,
+                                                const GLsizei *counts,
+                                                const GLsizei *instanceCounts,
+                                                GLsizei drawcount)
+{
+    return gl::NoError();
+}
+
+gl::Error ContextNULL::multiDrawElements(const gl::Context *context,
+                                         GLenum mode,
+                                         const GLsizei *counts,
+                                         GLenum type,
+                                         const void *const *indices,
+                                         GLsizei drawcount,
+                                         const gl::IndexRange *indexRanges)
+{
+    return gl::NoError();
+}
+
+gl::Error ContextNULL::multiDrawElementsInstanced(const gl::Context *context,
+                                                  GLenum mode,
+                                                  const GLsizei *counts,
+                                                  GLenum type,
+                                                  const void *const *indices,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount,
+                                                  const gl::IndexRange *indexRanges)
+{
+    return gl::NoError();
+}
+
 void ContextNULL::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
 }
@@ -81,6 +81,32 @@ class ContextNULL : public ContextImpl
                                    GLenum mode,
                                    GLenum type,
                                    const void *indirect) override;
+    gl::Error multiDrawArrays(const gl::Context *context,
+                              GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              GLsizei drawcount) override;
+    gl::Error multiDrawArraysInstanced(const gl::Context *context,
+                                       GLenum mode,
+                                       const GLint *firsts,
+                                       const GLsizei *counts,
+                                       const GLsizei *instanceCounts,
+                                       GLsizei drawcount) override;
+    gl::Error multiDrawElements(const gl::Context *context,
+                                GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const void *const *indices,
+                                GLsizei drawcount,
+                                const gl::IndexRange *indexRanges) override;
+    gl::Error multiDrawElementsInstanced(const gl::Context *context,
+                                         GLenum mode,
+                                         const GLsizei *counts,
+                                         GLenum type,
+                                         const void *const *indices,
+                                         const GLsizei *instanceCounts,
+                                         GLsizei drawcount,
+                                         const gl::IndexRange *indexRanges) override;
 
     // CHROMIUM_path_rendering path drawing methods.
     void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask) override;
@@ -203,6 +203,10 @@ void DisplayNULL::generateExtensions(egl::DisplayExtensions *outExtensions) cons
     outExtensions->createContextWebGLCompatibility    = true;
     outExtensions->createContextBindGeneratesResource = true;
     outExtensions->swapBuffersWithDamage              = true;
+
+    // The other back-ends drive one native device context per display, so two threads can't
+    // make calls into them at once.
+    outExtensions->createContextMultithreadedShareGroup = true;
 }
 
 void DisplayNULL::generateCaps(egl::Caps *outCaps) const
@@ -56,9 +56,6 @@ gl::Error BufferVk::setData(const gl::Context *context,
     vk::Buffer newBuffer;
     ANGLE_TRY(newBuffer.init(device, createInfo));
 
-    // Find a compatible memory pool index. If the index doesn't change, we could cache it.
-    // Not finding a valid memory pool means an out-of-spec driver, or internal error.
-    // TODO(jmadill): More efficient memory allocation.
     VkMemoryRequirements memoryRequirements;
     vkGetBufferMemoryRequirements(device, newBuffer.getHandle(), &memoryRequirements);
 
@@ -66,22 +63,10 @@ gl::Error BufferVk::setData(const gl::Context *context,
     ASSERT(memoryRequirements.size >= size);
     mRequiredSize = static_cast<size_t>(memoryRequirements.size);
 
-    VkPhysicalDeviceMemoryProperties memoryProperties;
-    vkGetPhysicalDeviceMemoryProperties(contextVk->getRenderer()->getPhysicalDevice(),
-                                        &memoryProperties);
-
-    auto memoryTypeIndex =
-        FindMemoryType(memoryProperties, memoryRequirements,
-                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    ANGLE_VK_CHECK(memoryTypeIndex.valid(), VK_ERROR_INCOMPATIBLE_DRIVER);
-
-    VkMemoryAllocateInfo allocInfo;
-    allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.pNext           = nullptr;
-    allocInfo.memoryTypeIndex = memoryTypeIndex.value();
-    allocInfo.allocationSize  = memoryRequirements.size;
-
-    ANGLE_TRY(newBuffer.getMemory().allocate(device, allocInfo));
+    ANGLE_TRY(contextVk->getRenderer()->getMemoryAllocator()->allocate(
+        device, memoryRequirements,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        MemoryAllocatorVk::Tiling::Linear, &newBuffer.getMemory()));
     ANGLE_TRY(newBuffer.bindMemory(device));
 
     mBuffer.retain(device, std::move(newBuffer));
@@ -101,7 +86,7 @@ gl::Error BufferVk::setSubData(const gl::Context *context,
                                size_t offset)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBuffer.getMemory().getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBuffer.getMemory().valid());
 
     VkDevice device = GetImplAs<ContextVk>(context)->getDevice();
 
@@ -123,11 +108,11 @@ gl::Error BufferVk::copySubData(const gl::Context *context,
 gl::Error BufferVk::map(const gl::Context *context, GLenum access, void **mapPtr)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBuffer.getMemory().getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBuffer.getMemory().valid());
 
     VkDevice device = GetImplAs<ContextVk>(context)->getDevice();
 
-    ANGLE_TRY(mBuffer.getMemory().map(device, 0, mState.getSize(), 0,
+    ANGLE_TRY(mBuffer.getMemory().map(device, 0, mState.getSize(),
                                       reinterpret_cast<uint8_t **>(mapPtr)));
 
     return gl::NoError();
@@ -140,12 +125,12 @@ gl::Error BufferVk::mapRange(const gl::Context *context,
                              void **mapPtr)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBuffer.getMemory().getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBuffer.getMemory().valid());
 
     VkDevice device = GetImplAs<ContextVk>(context)->getDevice();
 
     ANGLE_TRY(
-        mBuffer.getMemory().map(device, offset, length, 0, reinterpret_cast<uint8_t **>(mapPtr)));
+        mBuffer.getMemory().map(device, offset, length, reinterpret_cast<uint8_t **>(mapPtr)));
 
     return gl::NoError();
 }
@@ -153,11 +138,11 @@ gl::Error BufferVk::mapRange(const gl::Context *context,
 gl::Error BufferVk::unmap(const gl::Context *context, GLboolean *result)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBuffer.getMemory().getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBuffer.getMemory().valid());
 
     VkDevice device = GetImplAs<ContextVk>(context)->getDevice();
 
-    mBuffer.getMemory().unmap(device);
+    ANGLE_TRY(mBuffer.getMemory().unmap(device));
 
     return gl::NoError();
 }
@@ -175,12 +160,12 @@ gl::Error BufferVk::getIndexRange(GLenum type,
 vk::Error BufferVk::setDataImpl(VkDevice device, const uint8_t *data, size_t size, size_t offset)
 {
     uint8_t *mapPointer = nullptr;
-    ANGLE_TRY(mBuffer.getMemory().map(device, offset, size, 0, &mapPointer));
+    ANGLE_TRY(mBuffer.getMemory().map(device, offset, size, &mapPointer));
     ASSERT(mapPointer);
 
     memcpy(mapPointer, data, size);
 
-    mBuffer.getMemory().unmap(device);
+    ANGLE_TRY(mBuffer.getMemory().unmap(device));
 
     return vk::NoError();
 }
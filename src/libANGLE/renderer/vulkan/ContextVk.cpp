@@ -20,6 +20,7 @@
 #include "libANGLE/renderer/vulkan/FenceSyncVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/ImageVk.h"
+#include "libANGLE/renderer/vulkan/PipelineCacheVk.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
 #include "libANGLE/renderer/vulkan/QueryVk.h"
 #include "libANGLE/renderer/vulkan/RenderbufferVk.h"
@@ -35,13 +36,16 @@ namespace rx
 {
 
 ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
-    : ContextImpl(state), mRenderer(renderer), mCurrentDrawMode(GL_NONE)
+    : ContextImpl(state),
+      mRenderer(renderer),
+      mCurrentPipeline(nullptr),
+      mCurrentPipelineProgramSerial(),
+      mCurrentDrawMode(GL_NONE)
 {
 }
 
 ContextVk::~ContextVk()
 {
-    invalidateCurrentPipeline();
 }
 
 gl::Error ContextVk::initialize()
@@ -63,65 +67,30 @@ gl::Error ContextVk::finish()
 
 gl::Error ContextVk::initPipeline()
 {
-    ASSERT(!mCurrentPipeline.valid());
+    ASSERT(mCurrentPipeline == nullptr);
 
     VkDevice device       = mRenderer->getDevice();
     const auto &state     = mState.getState();
     const auto &programGL = state.getProgram();
     const auto &vao       = state.getVertexArray();
-    const auto &attribs   = vao->getVertexAttributes();
-    const auto &bindings  = vao->getVertexBindings();
     const auto &programVk = GetImplAs<ProgramVk>(programGL);
     const auto *drawFBO   = state.getDrawFramebuffer();
     FramebufferVk *vkFBO  = GetImplAs<FramebufferVk>(drawFBO);
+    VertexArrayVk *vkVAO  = GetImplAs<VertexArrayVk>(vao);
+
+    mCurrentPipelineProgramSerial = programVk->getProgramSerial();
 
-    // { vertex, fragment }
-    VkPipelineShaderStageCreateInfo shaderStages[2];
-
-    shaderStages[0].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    shaderStages[0].pNext               = nullptr;
-    shaderStages[0].flags               = 0;
-    shaderStages[0].stage               = VK_SHADER_STAGE_VERTEX_BIT;
-    shaderStages[0].module              = programVk->getLinkedVertexModule().getHandle();
-    shaderStages[0].pName               = "main";
-    shaderStages[0].pSpecializationInfo = nullptr;
-
-    shaderStages[1].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    shaderStages[1].pNext               = nullptr;
-    shaderStages[1].flags               = 0;
-    shaderStages[1].stage               = VK_SHADER_STAGE_FRAGMENT_BIT;
-    shaderStages[1].module              = programVk->getLinkedFragmentModule().getHandle();
-    shaderStages[1].pName               = "main";
-    shaderStages[1].pSpecializationInfo = nullptr;
-
-    // Process vertex attributes
-    // TODO(jmadill): Caching with dirty bits.
-    std::vector<VkVertexInputBindingDescription> vertexBindings;
-    std::vector<VkVertexInputAttributeDescription> vertexAttribs;
+    vk::PipelineDesc pipelineDesc;
+    pipelineDesc.updateProgram(mCurrentPipelineProgramSerial);
 
+    // Process vertex attributes. The vertex array keeps their descriptions up to date.
+    const auto &attribs            = vao->getVertexAttributes();
+    const auto &vertexInputAttribs = vkVAO->getVertexInputAttribs();
     for (auto attribIndex : programGL->getActiveAttribLocationsMask())
     {
-        const auto &attrib  = attribs[attribIndex];
-        const auto &binding = bindings[attrib.bindingIndex];
-        if (attrib.enabled)
+        if (attribs[attribIndex].enabled)
         {
-            VkVertexInputBindingDescription bindingDesc;
-            bindingDesc.binding = static_cast<uint32_t>(vertexBindings.size());
-            bindingDesc.stride  = static_cast<uint32_t>(gl::ComputeVertexAttributeTypeSize(attrib));
-            bindingDesc.inputRate =
-                (binding.divisor > 0 ? VK_VERTEX_INPUT_RATE_INSTANCE : VK_VERTEX_INPUT_RATE_VERTEX);
-
-            gl::VertexFormatType vertexFormatType = gl::GetVertexFormatType(attrib);
-
-            VkVertexInputAttributeDescription attribDesc;
-            attribDesc.binding  = bindingDesc.binding;
-            attribDesc.format   = vk::GetNativeVertexFormat(vertexFormatType);
-            attribDesc.location = static_cast<uint32_t>(attribIndex);
-            attribDesc.offset =
-                static_cast<uint32_t>(ComputeVertexAttributeOffset(attrib, binding));
-
-            vertexBindings.push_back(bindingDesc);
-            vertexAttribs.push_back(attribDesc);
+            pipelineDesc.updateVertexInputAttribute(attribIndex, vertexInputAttribs[attribIndex]);
         }
         else
         {
@@ -129,104 +98,10 @@ gl::Error ContextVk::initPipeline()
         }
     }
 
-    // TODO(jmadill): Validate with ASSERT against physical device limits/caps?
-    VkPipelineVertexInputStateCreateInfo vertexInputState;
-    vertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputState.pNext = nullptr;
-    vertexInputState.flags = 0;
-    vertexInputState.vertexBindingDescriptionCount   = static_cast<uint32_t>(vertexBindings.size());
-    vertexInputState.pVertexBindingDescriptions      = vertexBindings.data();
-    vertexInputState.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexAttribs.size());
-    vertexInputState.pVertexAttributeDescriptions    = vertexAttribs.data();
-
-    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
-    inputAssemblyState.sType    = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssemblyState.pNext    = nullptr;
-    inputAssemblyState.flags    = 0;
-    inputAssemblyState.topology = gl_vk::GetPrimitiveTopology(mCurrentDrawMode);
-    inputAssemblyState.primitiveRestartEnable = VK_FALSE;
-
-    const gl::Rectangle &viewportGL = state.getViewport();
-    VkViewport viewportVk;
-    viewportVk.x        = static_cast<float>(viewportGL.x);
-    viewportVk.y        = static_cast<float>(viewportGL.y);
-    viewportVk.width    = static_cast<float>(viewportGL.width);
-    viewportVk.height   = static_cast<float>(viewportGL.height);
-    viewportVk.minDepth = state.getNearPlane();
-    viewportVk.maxDepth = state.getFarPlane();
-
-    // TODO(jmadill): Scissor.
-    VkRect2D scissorVk;
-    scissorVk.offset.x      = viewportGL.x;
-    scissorVk.offset.y      = viewportGL.y;
-    scissorVk.extent.width  = viewportGL.width;
-    scissorVk.extent.height = viewportGL.height;
+    pipelineDesc.updateTopology(gl_vk::GetPrimitiveTopology(mCurrentDrawMode));
+    pipelineDesc.updateRasterizerState(state.getRasterizerState(), state.getLineWidth());
+    ANGLE_TRY(vkFBO->updatePipelineDesc(&pipelineDesc));
 
-    VkPipelineViewportStateCreateInfo viewportState;
-    viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.pNext         = nullptr;
-    viewportState.flags         = 0;
-    viewportState.viewportCount = 1;
-    viewportState.pViewports    = &viewportVk;
-    viewportState.scissorCount  = 1;
-    viewportState.pScissors     = &scissorVk;
-
-    // TODO(jmadill): Extra rasterizer state features.
-    VkPipelineRasterizationStateCreateInfo rasterState;
-    rasterState.sType            = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterState.pNext            = nullptr;
-    rasterState.flags            = 0;
-    rasterState.depthClampEnable = VK_FALSE;
-    rasterState.rasterizerDiscardEnable = VK_FALSE;
-    rasterState.polygonMode             = VK_POLYGON_MODE_FILL;
-    rasterState.cullMode                = gl_vk::GetCullMode(state.getRasterizerState());
-    rasterState.frontFace               = gl_vk::GetFrontFace(state.getRasterizerState().frontFace);
-    rasterState.depthBiasEnable         = VK_FALSE;
-    rasterState.depthBiasConstantFactor = 0.0f;
-    rasterState.depthBiasClamp          = 0.0f;
-    rasterState.depthBiasSlopeFactor    = 0.0f;
-    rasterState.lineWidth               = state.getLineWidth();
-
-    // TODO(jmadill): Multisample state.
-    VkPipelineMultisampleStateCreateInfo multisampleState;
-    multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampleState.pNext = nullptr;
-    multisampleState.flags = 0;
-    multisampleState.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    multisampleState.sampleShadingEnable  = VK_FALSE;
-    multisampleState.minSampleShading     = 0.0f;
-    multisampleState.pSampleMask          = nullptr;
-    multisampleState.alphaToCoverageEnable = VK_FALSE;
-    multisampleState.alphaToOneEnable      = VK_FALSE;
-
-    // TODO(jmadill): Depth/stencil state.
-
-    // TODO(jmadill): Blend state/MRT.
-    VkPipelineColorBlendAttachmentState blendAttachmentState;
-    blendAttachmentState.blendEnable         = VK_FALSE;
-    blendAttachmentState.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
-    blendAttachmentState.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
-    blendAttachmentState.colorBlendOp        = VK_BLEND_OP_ADD;
-    blendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    blendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    blendAttachmentState.alphaBlendOp        = VK_BLEND_OP_ADD;
-    blendAttachmentState.colorWriteMask = (VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                                           VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT);
-
-    VkPipelineColorBlendStateCreateInfo blendState;
-    blendState.sType             = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    blendState.pNext             = 0;
-    blendState.flags             = 0;
-    blendState.logicOpEnable     = VK_FALSE;
-    blendState.logicOp           = VK_LOGIC_OP_CLEAR;
-    blendState.attachmentCount   = 1;
-    blendState.pAttachments      = &blendAttachmentState;
-    blendState.blendConstants[0] = 0.0f;
-    blendState.blendConstants[1] = 0.0f;
-    blendState.blendConstants[2] = 0.0f;
-    blendState.blendConstants[3] = 0.0f;
-
-    // TODO(jmadill): Dynamic state.
     vk::RenderPass *renderPass = nullptr;
     ANGLE_TRY_RESULT(vkFBO->getRenderPass(device), renderPass);
     ASSERT(renderPass && renderPass->valid());
@@ -235,47 +110,26 @@ gl::Error ContextVk::initPipeline()
     ANGLE_TRY_RESULT(programVk->getPipelineLayout(device), pipelineLayout);
     ASSERT(pipelineLayout && pipelineLayout->valid());
 
-    VkGraphicsPipelineCreateInfo pipelineInfo;
-    pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.pNext               = nullptr;
-    pipelineInfo.flags               = 0;
-    pipelineInfo.stageCount          = 2;
-    pipelineInfo.pStages             = shaderStages;
-    pipelineInfo.pVertexInputState   = &vertexInputState;
-    pipelineInfo.pInputAssemblyState = &inputAssemblyState;
-    pipelineInfo.pTessellationState  = nullptr;
-    pipelineInfo.pViewportState      = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterState;
-    pipelineInfo.pMultisampleState   = &multisampleState;
-    pipelineInfo.pDepthStencilState  = nullptr;
-    pipelineInfo.pColorBlendState    = &blendState;
-    pipelineInfo.pDynamicState       = nullptr;
-    pipelineInfo.layout              = pipelineLayout->getHandle();
-    pipelineInfo.renderPass          = renderPass->getHandle();
-    pipelineInfo.subpass             = 0;
-    pipelineInfo.basePipelineHandle  = VK_NULL_HANDLE;
-    pipelineInfo.basePipelineIndex   = 0;
-
-    vk::Pipeline newPipeline;
-    ANGLE_TRY(newPipeline.initGraphics(device, pipelineInfo));
-
-    mCurrentPipeline.retain(device, std::move(newPipeline));
+    ANGLE_TRY(mRenderer->getPipelineCache()->getPipeline(
+        device, pipelineDesc, *renderPass, *pipelineLayout, programVk->getLinkedVertexModule(),
+        programVk->getLinkedFragmentModule(), &mCurrentPipeline));
 
     return gl::NoError();
 }
 
 gl::Error ContextVk::drawArrays(const gl::Context *context, GLenum mode, GLint first, GLsizei count)
 {
-    if (mode != mCurrentDrawMode)
+    const auto &programVk = GetImplAs<ProgramVk>(mState.getState().getProgram());
+    if (mode != mCurrentDrawMode || programVk->getProgramSerial() != mCurrentPipelineProgramSerial)
     {
         invalidateCurrentPipeline();
         mCurrentDrawMode = mode;
     }
 
-    if (!mCurrentPipeline.valid())
+    if (mCurrentPipeline == nullptr)
     {
         ANGLE_TRY(initPipeline());
-        ASSERT(mCurrentPipeline.valid());
+        ASSERT(mCurrentPipeline && mCurrentPipeline->valid());
     }
 
     VkDevice device       = mRenderer->getDevice();
@@ -283,28 +137,24 @@ gl::Error ContextVk::drawArrays(const gl::Context *context, GLenum mode, GLint f
     const auto &programGL = state.getProgram();
     const auto &vao       = state.getVertexArray();
     const auto &attribs   = vao->getVertexAttributes();
-    const auto &bindings  = vao->getVertexBindings();
     const auto *drawFBO   = state.getDrawFramebuffer();
     FramebufferVk *vkFBO  = GetImplAs<FramebufferVk>(drawFBO);
+    VertexArrayVk *vkVAO  = GetImplAs<VertexArrayVk>(vao);
     Serial queueSerial    = mRenderer->getCurrentQueueSerial();
 
-    // Process vertex attributes
-    // TODO(jmadill): Caching with dirty bits.
-    std::vector<VkBuffer> vertexHandles;
-    std::vector<VkDeviceSize> vertexOffsets;
+    // Process vertex attributes. Each location has its own binding, see PipelineDesc. The buffer
+    // handles are read at draw time since BufferVk recreates its buffer on respecification.
+    const gl::AttributesMask &activeAttribs = programGL->getActiveAttribLocationsMask();
+    const auto &arrayBuffers                = vkVAO->getCurrentArrayBuffers();
+    std::array<VkBuffer, gl::MAX_VERTEX_ATTRIBS> vertexHandles;
 
-    for (auto attribIndex : programGL->getActiveAttribLocationsMask())
+    for (auto attribIndex : activeAttribs)
     {
-        const auto &attrib  = attribs[attribIndex];
-        const auto &binding = bindings[attrib.bindingIndex];
-        if (attrib.enabled)
+        if (attribs[attribIndex].enabled)
         {
-            // TODO(jmadill): Offset handling.
-            gl::Buffer *bufferGL = binding.buffer.get();
-            ASSERT(bufferGL);
-            BufferVk *bufferVk = GetImplAs<BufferVk>(bufferGL);
-            vertexHandles.push_back(bufferVk->getVkBuffer().getHandle());
-            vertexOffsets.push_back(0);
+            BufferVk *bufferVk = arrayBuffers[attribIndex];
+            ASSERT(bufferVk);
+            vertexHandles[attribIndex] = bufferVk->getVkBuffer().getHandle();
 
             bufferVk->setQueueSerial(queueSerial);
         }
@@ -318,8 +168,28 @@ gl::Error ContextVk::drawArrays(const gl::Context *context, GLenum mode, GLint f
     ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
     ANGLE_TRY(vkFBO->beginRenderPass(device, commandBuffer, queueSerial, state));
 
-    commandBuffer->bindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mCurrentPipeline);
-    commandBuffer->bindVertexBuffers(0, vertexHandles, vertexOffsets);
+    // The viewport and scissor are dynamic state, so changing them doesn't need a new pipeline.
+    const gl::Rectangle &viewportGL = state.getViewport();
+    VkViewport viewportVk;
+    viewportVk.x        = static_cast<float>(viewportGL.x);
+    viewportVk.y        = static_cast<float>(viewportGL.y);
+    viewportVk.width    = static_cast<float>(viewportGL.width);
+    viewportVk.height   = static_cast<float>(viewportGL.height);
+    viewportVk.minDepth = state.getNearPlane();
+    viewportVk.maxDepth = state.getFarPlane();
+
+    // TODO(jmadill): Scissor.
+    VkRect2D scissorVk;
+    scissorVk.offset.x      = viewportGL.x;
+    scissorVk.offset.y      = viewportGL.y;
+    scissorVk.extent.width  = viewportGL.width;
+    scissorVk.extent.height = viewportGL.height;
+
+    commandBuffer->bindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *mCurrentPipeline);
+    commandBuffer->setViewport(viewportVk);
+    commandBuffer->setScissor(scissorVk);
+    commandBuffer->bindVertexBuffers(activeAttribs, vertexHandles.data(),
+                                     vkVAO->getCurrentArrayBufferOffsets().data());
     commandBuffer->draw(count, 1, first, 0);
     commandBuffer->endRenderPass();
 
@@ -556,7 +426,8 @@ std::vector<PathImpl *> ContextVk::createPaths(GLsizei)
 // TODO(jmadill): Use pipeline cache.
 void ContextVk::invalidateCurrentPipeline()
 {
-    mRenderer->enqueueGarbageOrDeleteNow(*this, mCurrentPipeline);
+    // The pipeline stays in the renderer's cache, so the next draw only has to look it up again.
+    mCurrentPipeline = nullptr;
 }
 
 gl::Error ContextVk::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ)
@@ -140,7 +140,6 @@ class ContextVk : public ContextImpl, public ResourceVk
 
     RendererVk *getRenderer() { return mRenderer; }
 
-    // TODO(jmadill): Use pipeline cache.
     void invalidateCurrentPipeline();
 
     gl::Error dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ) override;
@@ -149,7 +148,10 @@ class ContextVk : public ContextImpl, public ResourceVk
     gl::Error initPipeline();
 
     RendererVk *mRenderer;
-    vk::Pipeline mCurrentPipeline;
+    // Owned by the renderer's pipeline cache. The program serial detects a relink in another
+    // context, which releases the pipelines of the previous link.
+    vk::Pipeline *mCurrentPipeline;
+    Serial mCurrentPipelineProgramSerial;
     GLenum mCurrentDrawMode;
 };
 
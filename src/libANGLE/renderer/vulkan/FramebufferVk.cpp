@@ -20,6 +20,7 @@
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
+#include "libANGLE/renderer/vulkan/PipelineCacheVk.h"
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
@@ -293,7 +294,7 @@ gl::Error FramebufferVk::readPixels(const gl::Context *context,
     // TODO(jmadill): parameters
     uint8_t *mapPointer = nullptr;
     ANGLE_TRY(
-        stagingImage.getDeviceMemory().map(device, 0, stagingImage.getSize(), 0, &mapPointer));
+        stagingImage.getDeviceMemory().map(device, 0, stagingImage.getSize(), &mapPointer));
 
     const auto &angleFormat = renderTarget->format->format();
 
@@ -310,7 +311,7 @@ gl::Error FramebufferVk::readPixels(const gl::Context *context,
 
     PackPixels(params, angleFormat, inputPitch, mapPointer, reinterpret_cast<uint8_t *>(pixels));
 
-    stagingImage.getDeviceMemory().unmap(device);
+    ANGLE_TRY(stagingImage.getDeviceMemory().unmap(device));
     renderer->enqueueGarbage(renderer->getCurrentQueueSerial(), std::move(stagingImage));
 
     stagingImage.getImage().destroy(renderer->getDevice());
@@ -347,10 +348,36 @@ void FramebufferVk::syncState(const gl::Context *context,
     mRenderPass.destroy(contextVk->getDevice());
     mFramebuffer.destroy(contextVk->getDevice());
 
-    // TODO(jmadill): Use pipeline cache.
     contextVk->invalidateCurrentPipeline();
 }
 
+gl::Error FramebufferVk::updatePipelineDesc(vk::PipelineDesc *pipelineDesc)
+{
+    const auto &colorAttachments = mState.getColorAttachments();
+    for (size_t attachmentIndex = 0; attachmentIndex < colorAttachments.size(); ++attachmentIndex)
+    {
+        const auto &colorAttachment = colorAttachments[attachmentIndex];
+        if (colorAttachment.isAttached())
+        {
+            RenderTargetVk *renderTarget = nullptr;
+            ANGLE_TRY(colorAttachment.getRenderTarget(&renderTarget));
+            pipelineDesc->updateColorAttachment(attachmentIndex, renderTarget->format->native,
+                                                ConvertSamples(colorAttachment.getSamples()));
+        }
+    }
+
+    const auto *depthStencilAttachment = mState.getDepthStencilAttachment();
+    if (depthStencilAttachment && depthStencilAttachment->isAttached())
+    {
+        RenderTargetVk *renderTarget = nullptr;
+        ANGLE_TRY(depthStencilAttachment->getRenderTarget(&renderTarget));
+        pipelineDesc->updateDepthStencilAttachment(
+            renderTarget->format->native, ConvertSamples(depthStencilAttachment->getSamples()));
+    }
+
+    return gl::NoError();
+}
+
 gl::ErrorOrResult<vk::RenderPass *> FramebufferVk::getRenderPass(VkDevice device)
 {
     if (mRenderPass.valid())
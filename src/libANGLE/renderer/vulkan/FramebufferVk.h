@@ -18,6 +18,11 @@ namespace rx
 class RenderTargetVk;
 class WindowSurfaceVk;
 
+namespace vk
+{
+class PipelineDesc;
+}
+
 class FramebufferVk : public FramebufferImpl, public ResourceVk
 {
   public:
@@ -87,6 +92,10 @@ class FramebufferVk : public FramebufferImpl, public ResourceVk
 
     gl::ErrorOrResult<vk::RenderPass *> getRenderPass(VkDevice device);
 
+    // Records the attachment formats and sample counts, which is all render pass compatibility
+    // depends on.
+    gl::Error updatePipelineDesc(vk::PipelineDesc *pipelineDesc);
+
   private:
     FramebufferVk(const gl::FramebufferState &state);
     FramebufferVk(const gl::FramebufferState &state, WindowSurfaceVk *backbuffer);
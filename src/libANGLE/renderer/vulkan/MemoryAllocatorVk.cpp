@@ -0,0 +1,392 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAllocatorVk.cpp:
+//    Implements the class methods for MemoryAllocatorVk.
+//
+
+#include "libANGLE/renderer/vulkan/MemoryAllocatorVk.h"
+
+#include <cstring>
+
+#include "common/BuddyAllocator.h"
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+// Blocks are this large unless the heap is small. Resources larger than half a block get a
+// dedicated allocation, so they don't waste most of a block.
+constexpr VkDeviceSize kDefaultBlockSize = 32 * 1024 * 1024;
+constexpr VkDeviceSize kMinBlockSize     = 1024 * 1024;
+
+// Suballocations are rounded up to powers of two of at least this size.
+constexpr VkDeviceSize kMinAllocationSize = 256;
+
+VkDeviceSize FloorPow2(VkDeviceSize value)
+{
+    VkDeviceSize pow2 = 1;
+    while (pow2 <= value / 2)
+    {
+        pow2 *= 2;
+    }
+    return pow2;
+}
+
+}  // anonymous namespace
+
+namespace vk
+{
+
+struct MemoryBlock final : angle::NonCopyable
+{
+    DeviceMemory memory;
+    uint32_t memoryTypeIndex;
+    VkDeviceSize size;
+    uint8_t *mappedPointer;
+
+    // The tiling of the resources in the block. An empty block can take either.
+    MemoryAllocatorVk::Tiling tiling;
+
+    // Null for dedicated allocations.
+    std::unique_ptr<angle::BuddyAllocator> suballocator;
+};
+
+}  // namespace vk
+
+MemoryAllocatorVk::MemoryAllocatorVk()
+    : mNonCoherentAtomSize(1), mMaxBlockCount(0), mBlockCount(0)
+{
+    memset(&mMemoryProperties, 0, sizeof(mMemoryProperties));
+    mHeapBudgets.fill(0);
+    mHeapUsage.fill(0);
+}
+
+MemoryAllocatorVk::~MemoryAllocatorVk()
+{
+    ASSERT(mBlockCount == 0);
+}
+
+void MemoryAllocatorVk::initialize(const VkPhysicalDeviceMemoryProperties &memoryProperties,
+                                   const VkPhysicalDeviceLimits &limits)
+{
+    mMemoryProperties    = memoryProperties;
+    mNonCoherentAtomSize = std::max<VkDeviceSize>(limits.nonCoherentAtomSize, 1);
+    mMaxBlockCount       = limits.maxMemoryAllocationCount;
+
+    for (uint32_t heapIndex = 0; heapIndex < mMemoryProperties.memoryHeapCount; ++heapIndex)
+    {
+        mHeapBudgets[heapIndex] = mMemoryProperties.memoryHeaps[heapIndex].size;
+    }
+}
+
+void MemoryAllocatorVk::destroy(VkDevice device)
+{
+    for (auto &blocks : mBlocks)
+    {
+        for (auto &block : blocks)
+        {
+            ASSERT(!block->suballocator || block->suballocator->empty());
+            block->memory.destroy(device);
+            mBlockCount--;
+        }
+        blocks.clear();
+    }
+
+    mHeapUsage.fill(0);
+    ASSERT(mBlockCount == 0);
+}
+
+vk::Error MemoryAllocatorVk::allocate(VkDevice device,
+                                      const VkMemoryRequirements &requirements,
+                                      VkMemoryPropertyFlags propertyFlags,
+                                      Tiling tiling,
+                                      vk::Allocation *allocationOut)
+{
+    ASSERT(!allocationOut->valid());
+
+    // Not finding a valid memory type means an out-of-spec driver, or internal error.
+    auto memoryTypeIndex = FindMemoryType(mMemoryProperties, requirements, propertyFlags);
+    ANGLE_VK_CHECK(memoryTypeIndex.valid(), VK_ERROR_INCOMPATIBLE_DRIVER);
+    uint32_t typeIndex = memoryTypeIndex.value();
+
+    VkDeviceSize blockSize = getBlockSize(typeIndex);
+    if (requirements.size > blockSize / 2)
+    {
+        vk::MemoryBlock *block = nullptr;
+        ANGLE_TRY(allocateBlock(device, typeIndex, requirements.size, true, tiling, &block));
+        bool success = suballocate(block, requirements.size, 1, allocationOut);
+        ASSERT(success);
+        UNUSED_VARIABLE(success);
+        return vk::NoError();
+    }
+
+    for (auto &block : mBlocks[typeIndex])
+    {
+        if (!block->suballocator)
+        {
+            continue;
+        }
+
+        if (block->tiling != tiling)
+        {
+            if (!block->suballocator->empty())
+            {
+                continue;
+            }
+            block->tiling = tiling;
+        }
+
+        if (suballocate(block.get(), requirements.size, requirements.alignment, allocationOut))
+        {
+            return vk::NoError();
+        }
+    }
+
+    vk::MemoryBlock *block = nullptr;
+    ANGLE_TRY(allocateBlock(device, typeIndex, blockSize, false, tiling, &block));
+    bool success = suballocate(block, requirements.size, requirements.alignment, allocationOut);
+    ASSERT(success);
+    UNUSED_VARIABLE(success);
+
+    return vk::NoError();
+}
+
+void MemoryAllocatorVk::free(VkDevice device, vk::Allocation *allocation)
+{
+    ASSERT(allocation->valid() && allocation->mAllocator == this);
+    vk::MemoryBlock *block = allocation->mBlock;
+
+    if (!block->suballocator)
+    {
+        destroyBlock(device, block);
+    }
+    else
+    {
+        block->suballocator->free(allocation->mOffset);
+
+        // Keep one empty block per memory type around, so that a resource that is recreated
+        // over and over doesn't allocate and free a block every time.
+        if (block->suballocator->empty())
+        {
+            for (const auto &otherBlock : mBlocks[block->memoryTypeIndex])
+            {
+                if (otherBlock.get() != block && otherBlock->suballocator &&
+                    otherBlock->suballocator->empty())
+                {
+                    destroyBlock(device, block);
+                    break;
+                }
+            }
+        }
+    }
+
+    allocation->mAllocator     = nullptr;
+    allocation->mBlock         = nullptr;
+    allocation->mMemoryHandle  = VK_NULL_HANDLE;
+    allocation->mOffset        = 0;
+    allocation->mSize          = 0;
+    allocation->mMappedPointer = nullptr;
+    allocation->mMappedOffset  = 0;
+    allocation->mMappedSize    = 0;
+}
+
+void MemoryAllocatorVk::trim(VkDevice device)
+{
+    for (auto &blocks : mBlocks)
+    {
+        std::vector<vk::MemoryBlock *> emptyBlocks;
+        for (const auto &block : blocks)
+        {
+            if (block->suballocator && block->suballocator->empty())
+            {
+                emptyBlocks.push_back(block.get());
+            }
+        }
+
+        for (vk::MemoryBlock *block : emptyBlocks)
+        {
+            destroyBlock(device, block);
+        }
+    }
+}
+
+void MemoryAllocatorVk::setHeapBudget(uint32_t heapIndex, VkDeviceSize budget)
+{
+    ASSERT(heapIndex < mMemoryProperties.memoryHeapCount);
+    mHeapBudgets[heapIndex] = budget;
+}
+
+MemoryAllocatorVk::HeapStats MemoryAllocatorVk::getHeapStats(uint32_t heapIndex) const
+{
+    ASSERT(heapIndex < mMemoryProperties.memoryHeapCount);
+
+    HeapStats stats;
+    stats.budget              = mHeapBudgets[heapIndex];
+    stats.blockSize           = 0;
+    stats.allocatedSize       = 0;
+    stats.blockCount          = 0;
+    stats.dedicatedBlockCount = 0;
+    stats.allocationCount     = 0;
+
+    for (uint32_t typeIndex = 0; typeIndex < mMemoryProperties.memoryTypeCount; ++typeIndex)
+    {
+        if (mMemoryProperties.memoryTypes[typeIndex].heapIndex != heapIndex)
+        {
+            continue;
+        }
+
+        for (const auto &block : mBlocks[typeIndex])
+        {
+            stats.blockSize += block->size;
+            stats.blockCount++;
+
+            if (block->suballocator)
+            {
+                stats.allocatedSize += block->suballocator->getAllocatedSize();
+                stats.allocationCount += block->suballocator->getAllocationCount();
+            }
+            else
+            {
+                stats.allocatedSize += block->size;
+                stats.allocationCount++;
+                stats.dedicatedBlockCount++;
+            }
+        }
+    }
+
+    ASSERT(stats.blockSize == mHeapUsage[heapIndex]);
+    return stats;
+}
+
+vk::Error MemoryAllocatorVk::allocateBlock(VkDevice device,
+                                           uint32_t memoryTypeIndex,
+                                           VkDeviceSize size,
+                                           bool dedicated,
+                                           Tiling tiling,
+                                           vk::MemoryBlock **blockOut)
+{
+    const VkMemoryType &memoryType = mMemoryProperties.memoryTypes[memoryTypeIndex];
+    uint32_t heapIndex             = memoryType.heapIndex;
+
+    // Empty blocks are the only memory that can be given back without help from the front-end.
+    if (mHeapUsage[heapIndex] + size > mHeapBudgets[heapIndex] || mBlockCount >= mMaxBlockCount)
+    {
+        trim(device);
+    }
+    ANGLE_VK_CHECK(mHeapUsage[heapIndex] + size <= mHeapBudgets[heapIndex],
+                   VK_ERROR_OUT_OF_DEVICE_MEMORY);
+    ANGLE_VK_CHECK(mBlockCount < mMaxBlockCount, VK_ERROR_TOO_MANY_OBJECTS);
+
+    VkMemoryAllocateInfo allocInfo;
+    allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext           = nullptr;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+    allocInfo.allocationSize  = size;
+
+    std::unique_ptr<vk::MemoryBlock> block(new vk::MemoryBlock());
+    vk::Error error = block->memory.allocate(device, allocInfo);
+    if (error.isError())
+    {
+        // The budget can be larger than what the driver is willing to give.
+        trim(device);
+        ANGLE_TRY(block->memory.allocate(device, allocInfo));
+    }
+
+    block->memoryTypeIndex = memoryTypeIndex;
+    block->size            = size;
+    block->mappedPointer   = nullptr;
+    block->tiling          = tiling;
+
+    // Host-visible blocks are mapped once, since memory can't be mapped twice at the same time.
+    if ((memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
+    {
+        error = block->memory.map(device, 0, size, 0, &block->mappedPointer);
+        if (error.isError())
+        {
+            block->memory.destroy(device);
+            return error;
+        }
+    }
+
+    if (!dedicated)
+    {
+        block->suballocator.reset(new angle::BuddyAllocator(size, kMinAllocationSize));
+    }
+
+    mHeapUsage[heapIndex] += size;
+    mBlockCount++;
+
+    *blockOut = block.get();
+    mBlocks[memoryTypeIndex].push_back(std::move(block));
+    return vk::NoError();
+}
+
+void MemoryAllocatorVk::destroyBlock(VkDevice device, vk::MemoryBlock *block)
+{
+    auto &blocks = mBlocks[block->memoryTypeIndex];
+    for (auto iter = blocks.begin(); iter != blocks.end(); ++iter)
+    {
+        if (iter->get() == block)
+        {
+            uint32_t heapIndex = mMemoryProperties.memoryTypes[block->memoryTypeIndex].heapIndex;
+            mHeapUsage[heapIndex] -= block->size;
+            mBlockCount--;
+
+            // Freeing the memory also unmaps it.
+            block->memory.destroy(device);
+            blocks.erase(iter);
+            return;
+        }
+    }
+
+    UNREACHABLE();
+}
+
+VkDeviceSize MemoryAllocatorVk::getBlockSize(uint32_t memoryTypeIndex) const
+{
+    uint32_t heapIndex = mMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+
+    // Don't let a single block take more than an eighth of a small heap.
+    VkDeviceSize heapSize = mMemoryProperties.memoryHeaps[heapIndex].size;
+    return std::max(std::min(kDefaultBlockSize, FloorPow2(heapSize / 8)), kMinBlockSize);
+}
+
+bool MemoryAllocatorVk::suballocate(vk::MemoryBlock *block,
+                                    VkDeviceSize size,
+                                    VkDeviceSize alignment,
+                                    vk::Allocation *allocationOut)
+{
+    VkDeviceSize offset    = 0;
+    VkDeviceSize rangeSize = block->size;
+
+    if (block->suballocator)
+    {
+        uint64_t allocatedOffset = 0;
+        if (!block->suballocator->allocate(size, alignment, &allocatedOffset))
+        {
+            return false;
+        }
+        offset    = allocatedOffset;
+        rangeSize = block->suballocator->getAllocationSize(allocatedOffset);
+    }
+
+    const VkMemoryType &memoryType = mMemoryProperties.memoryTypes[block->memoryTypeIndex];
+    bool coherent = (memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+    allocationOut->mAllocator     = this;
+    allocationOut->mBlock         = block;
+    allocationOut->mMemoryHandle  = block->memory.getHandle();
+    allocationOut->mOffset        = offset;
+    allocationOut->mSize          = rangeSize;
+    allocationOut->mMappedPointer = (block->mappedPointer ? block->mappedPointer + offset : nullptr);
+    allocationOut->mNonCoherentAtomSize = (coherent ? 0 : mNonCoherentAtomSize);
+    return true;
+}
+
+}  // namespace rx
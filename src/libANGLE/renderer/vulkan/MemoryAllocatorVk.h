@@ -0,0 +1,103 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAllocatorVk.h:
+//    Defines MemoryAllocatorVk, which suballocates buffer and image memory from large device
+//    memory blocks instead of making one vkAllocateMemory call per resource.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_MEMORYALLOCATORVK_H_
+#define LIBANGLE_RENDERER_VULKAN_MEMORYALLOCATORVK_H_
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "libANGLE/renderer/vulkan/renderervk_utils.h"
+
+namespace rx
+{
+
+class MemoryAllocatorVk final : angle::NonCopyable
+{
+  public:
+    // Buffers and linearly tiled images never share a block with optimally tiled images, so their
+    // suballocations don't have to be kept bufferImageGranularity apart.
+    enum class Tiling
+    {
+        Linear,
+        Optimal,
+    };
+
+    struct HeapStats
+    {
+        VkDeviceSize budget;
+
+        // Device memory allocated from the heap, and how much of it is handed out.
+        VkDeviceSize blockSize;
+        VkDeviceSize allocatedSize;
+
+        // The number of vkAllocateMemory allocations, including the dedicated ones.
+        size_t blockCount;
+        size_t dedicatedBlockCount;
+        size_t allocationCount;
+    };
+
+    MemoryAllocatorVk();
+    ~MemoryAllocatorVk();
+
+    void initialize(const VkPhysicalDeviceMemoryProperties &memoryProperties,
+                    const VkPhysicalDeviceLimits &limits);
+    void destroy(VkDevice device);
+
+    // Finds a memory type with all the requested properties that the resource can use.
+    // Resources that take up a large part of a block get a dedicated allocation.
+    vk::Error allocate(VkDevice device,
+                       const VkMemoryRequirements &requirements,
+                       VkMemoryPropertyFlags propertyFlags,
+                       Tiling tiling,
+                       vk::Allocation *allocationOut);
+    void free(VkDevice device, vk::Allocation *allocation);
+
+    // Frees the blocks nothing is allocated from. This happens by itself when an allocation would
+    // exceed a budget or the driver runs out of memory, but can be called on memory pressure.
+    void trim(VkDevice device);
+
+    // Heaps start with a budget of their full size. Allocations that would make the blocks of a
+    // heap exceed its budget fail with VK_ERROR_OUT_OF_DEVICE_MEMORY.
+    void setHeapBudget(uint32_t heapIndex, VkDeviceSize budget);
+
+    uint32_t getHeapCount() const { return mMemoryProperties.memoryHeapCount; }
+    HeapStats getHeapStats(uint32_t heapIndex) const;
+
+  private:
+    vk::Error allocateBlock(VkDevice device,
+                            uint32_t memoryTypeIndex,
+                            VkDeviceSize size,
+                            bool dedicated,
+                            Tiling tiling,
+                            vk::MemoryBlock **blockOut);
+    void destroyBlock(VkDevice device, vk::MemoryBlock *block);
+    VkDeviceSize getBlockSize(uint32_t memoryTypeIndex) const;
+    bool suballocate(vk::MemoryBlock *block,
+                     VkDeviceSize size,
+                     VkDeviceSize alignment,
+                     vk::Allocation *allocationOut);
+
+    VkPhysicalDeviceMemoryProperties mMemoryProperties;
+    VkDeviceSize mNonCoherentAtomSize;
+    uint32_t mMaxBlockCount;
+
+    std::array<std::vector<std::unique_ptr<vk::MemoryBlock>>, VK_MAX_MEMORY_TYPES> mBlocks;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> mHeapBudgets;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> mHeapUsage;
+    uint32_t mBlockCount;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_MEMORYALLOCATORVK_H_
@@ -0,0 +1,455 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PipelineCacheVk.cpp:
+//    Implements PipelineDesc and PipelineCacheVk.
+//
+
+#include "libANGLE/renderer/vulkan/PipelineCacheVk.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "common/debug.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/histogram_macros.h"
+#include "third_party/murmurhash/MurmurHash3.h"
+
+namespace rx
+{
+
+namespace
+{
+
+// The header every VkPipelineCache blob starts with, see the description of
+// vkGetPipelineCacheData in the Vulkan specification.
+constexpr size_t kPipelineCacheHeaderSize = 16 + VK_UUID_SIZE;
+
+uint32_t ReadUint32(const std::vector<uint8_t> &data, size_t offset)
+{
+    uint32_t value = 0;
+    memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+// Drivers are supposed to ignore cache data of another driver or device, but not all of them do.
+bool IsPipelineCacheDataCompatible(const std::vector<uint8_t> &data,
+                                   const VkPhysicalDeviceProperties &physicalDeviceProperties)
+{
+    if (data.size() < kPipelineCacheHeaderSize)
+    {
+        return false;
+    }
+
+    return ReadUint32(data, 0) >= kPipelineCacheHeaderSize &&
+           ReadUint32(data, 4) == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           ReadUint32(data, 8) == physicalDeviceProperties.vendorID &&
+           ReadUint32(data, 12) == physicalDeviceProperties.deviceID &&
+           memcmp(data.data() + 16, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) ==
+               0;
+}
+
+bool ReadCacheFile(const std::string &path, std::vector<uint8_t> *dataOut)
+{
+    std::ifstream inFile(path.c_str(), std::ios::binary);
+    if (inFile.fail())
+    {
+        return false;
+    }
+
+    dataOut->assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    return !inFile.bad();
+}
+
+// Writes to a temporary file first and renames it over the old file, so that a run that is killed
+// or a second process writing at the same time never leaves a truncated cache behind.
+bool WriteCacheFile(const std::string &path, const std::vector<uint8_t> &data)
+{
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream outFile(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+        if (outFile.fail())
+        {
+            return false;
+        }
+
+        outFile.write(reinterpret_cast<const char *>(data.data()), data.size());
+        outFile.close();
+        if (outFile.fail())
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    // Renaming over an existing file fails on Windows.
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(path.c_str());
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // anonymous namespace
+
+namespace vk
+{
+
+static_assert(std::is_trivially_copyable<PipelineDesc>::value,
+              "PipelineDesc is hashed and compared bitwise.");
+
+// PipelineDesc implementation.
+PipelineDesc::PipelineDesc()
+{
+    memset(this, 0, sizeof(PipelineDesc));
+}
+
+size_t PipelineDesc::hash() const
+{
+    static const uint32_t seed = 0xABCDEF98;
+
+    uint32_t hash = 0;
+    MurmurHash3_x86_32(this, sizeof(PipelineDesc), seed, &hash);
+    return hash;
+}
+
+bool PipelineDesc::operator==(const PipelineDesc &other) const
+{
+    return memcmp(this, &other, sizeof(PipelineDesc)) == 0;
+}
+
+void PipelineDesc::updateProgram(Serial programSerial)
+{
+    mProgramSerial = programSerial.getValue();
+}
+
+void PipelineDesc::updateVertexInputAttribute(size_t attribIndex,
+                                              VkFormat format,
+                                              uint32_t offset,
+                                              uint32_t stride,
+                                              VkVertexInputRate inputRate)
+{
+    ASSERT(attribIndex < gl::MAX_VERTEX_ATTRIBS);
+    ASSERT(stride <= std::numeric_limits<uint16_t>::max());
+
+    PackedVertexInputAttributeDesc &packedAttrib = mVertexInputAttribs[attribIndex];
+    packedAttrib.format                          = static_cast<uint32_t>(format);
+    packedAttrib.offset                          = offset;
+    packedAttrib.stride                          = static_cast<uint16_t>(stride);
+    packedAttrib.inputRate                       = static_cast<uint16_t>(inputRate);
+
+    mActiveAttribLocationsMask |= (1u << attribIndex);
+}
+
+void PipelineDesc::updateVertexInputAttribute(size_t attribIndex,
+                                              const PackedVertexInputAttributeDesc &packedAttrib)
+{
+    ASSERT(attribIndex < gl::MAX_VERTEX_ATTRIBS);
+
+    mVertexInputAttribs[attribIndex] = packedAttrib;
+    mActiveAttribLocationsMask |= (1u << attribIndex);
+}
+
+void PipelineDesc::updateTopology(VkPrimitiveTopology topology)
+{
+    mTopology = static_cast<uint32_t>(topology);
+}
+
+void PipelineDesc::updateRasterizerState(const gl::RasterizerState &rasterState, float lineWidth)
+{
+    mCullMode  = static_cast<uint32_t>(gl_vk::GetCullMode(rasterState));
+    mFrontFace = static_cast<uint32_t>(gl_vk::GetFrontFace(rasterState.frontFace));
+    mLineWidth = lineWidth;
+}
+
+void PipelineDesc::updateColorAttachment(size_t colorIndex,
+                                         VkFormat format,
+                                         VkSampleCountFlagBits samples)
+{
+    ASSERT(colorIndex < gl::IMPLEMENTATION_MAX_DRAW_BUFFERS);
+    mColorAttachmentFormats[colorIndex] = static_cast<uint32_t>(format);
+    mSamples                            = static_cast<uint32_t>(samples);
+}
+
+void PipelineDesc::updateDepthStencilAttachment(VkFormat format, VkSampleCountFlagBits samples)
+{
+    mDepthStencilAttachmentFormat = static_cast<uint32_t>(format);
+    mSamples                      = static_cast<uint32_t>(samples);
+}
+
+Error PipelineDesc::initializePipeline(VkDevice device,
+                                       const PipelineCache &pipelineCache,
+                                       const RenderPass &compatibleRenderPass,
+                                       const PipelineLayout &pipelineLayout,
+                                       const ShaderModule &vertexModule,
+                                       const ShaderModule &fragmentModule,
+                                       Pipeline *pipelineOut) const
+{
+    // { vertex, fragment }
+    VkPipelineShaderStageCreateInfo shaderStages[2];
+
+    shaderStages[0].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].pNext               = nullptr;
+    shaderStages[0].flags               = 0;
+    shaderStages[0].stage               = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module              = vertexModule.getHandle();
+    shaderStages[0].pName               = "main";
+    shaderStages[0].pSpecializationInfo = nullptr;
+
+    shaderStages[1].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].pNext               = nullptr;
+    shaderStages[1].flags               = 0;
+    shaderStages[1].stage               = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module              = fragmentModule.getHandle();
+    shaderStages[1].pName               = "main";
+    shaderStages[1].pSpecializationInfo = nullptr;
+
+    // Each active attribute gets its own binding, numbered like its location, so the vertex buffers
+    // of a location can be rebound without knowing the other active attributes.
+    VkVertexInputBindingDescription vertexBindings[gl::MAX_VERTEX_ATTRIBS];
+    VkVertexInputAttributeDescription vertexAttribs[gl::MAX_VERTEX_ATTRIBS];
+    uint32_t vertexAttribCount = 0;
+
+    for (uint32_t attribIndex = 0; attribIndex < gl::MAX_VERTEX_ATTRIBS; ++attribIndex)
+    {
+        if ((mActiveAttribLocationsMask & (1u << attribIndex)) == 0)
+        {
+            continue;
+        }
+
+        const PackedVertexInputAttributeDesc &packedAttrib = mVertexInputAttribs[attribIndex];
+
+        VkVertexInputBindingDescription &bindingDesc = vertexBindings[vertexAttribCount];
+        bindingDesc.binding                          = attribIndex;
+        bindingDesc.stride                           = packedAttrib.stride;
+        bindingDesc.inputRate = static_cast<VkVertexInputRate>(packedAttrib.inputRate);
+
+        VkVertexInputAttributeDescription &attribDesc = vertexAttribs[vertexAttribCount];
+        attribDesc.binding                            = attribIndex;
+        attribDesc.format                             = static_cast<VkFormat>(packedAttrib.format);
+        attribDesc.location                           = attribIndex;
+        attribDesc.offset                             = packedAttrib.offset;
+
+        vertexAttribCount++;
+    }
+
+    // TODO(jmadill): Validate with ASSERT against physical device limits/caps?
+    VkPipelineVertexInputStateCreateInfo vertexInputState;
+    vertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputState.pNext = nullptr;
+    vertexInputState.flags = 0;
+    vertexInputState.vertexBindingDescriptionCount   = vertexAttribCount;
+    vertexInputState.pVertexBindingDescriptions      = vertexBindings;
+    vertexInputState.vertexAttributeDescriptionCount = vertexAttribCount;
+    vertexInputState.pVertexAttributeDescriptions    = vertexAttribs;
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
+    inputAssemblyState.sType    = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssemblyState.pNext    = nullptr;
+    inputAssemblyState.flags    = 0;
+    inputAssemblyState.topology = static_cast<VkPrimitiveTopology>(mTopology);
+    inputAssemblyState.primitiveRestartEnable = VK_FALSE;
+
+    // The viewport and scissor are set in the command buffer for every draw.
+    VkPipelineViewportStateCreateInfo viewportState;
+    viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.pNext         = nullptr;
+    viewportState.flags         = 0;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports    = nullptr;
+    viewportState.scissorCount  = 1;
+    viewportState.pScissors     = nullptr;
+
+    // TODO(jmadill): Extra rasterizer state features.
+    VkPipelineRasterizationStateCreateInfo rasterState;
+    rasterState.sType            = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterState.pNext            = nullptr;
+    rasterState.flags            = 0;
+    rasterState.depthClampEnable = VK_FALSE;
+    rasterState.rasterizerDiscardEnable = VK_FALSE;
+    rasterState.polygonMode             = VK_POLYGON_MODE_FILL;
+    rasterState.cullMode                = static_cast<VkCullModeFlags>(mCullMode);
+    rasterState.frontFace               = static_cast<VkFrontFace>(mFrontFace);
+    rasterState.depthBiasEnable         = VK_FALSE;
+    rasterState.depthBiasConstantFactor = 0.0f;
+    rasterState.depthBiasClamp          = 0.0f;
+    rasterState.depthBiasSlopeFactor    = 0.0f;
+    rasterState.lineWidth               = mLineWidth;
+
+    // TODO(jmadill): Multisample state.
+    VkPipelineMultisampleStateCreateInfo multisampleState;
+    multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampleState.pNext = nullptr;
+    multisampleState.flags = 0;
+    multisampleState.rasterizationSamples =
+        (mSamples != 0 ? static_cast<VkSampleCountFlagBits>(mSamples) : VK_SAMPLE_COUNT_1_BIT);
+    multisampleState.sampleShadingEnable   = VK_FALSE;
+    multisampleState.minSampleShading      = 0.0f;
+    multisampleState.pSampleMask           = nullptr;
+    multisampleState.alphaToCoverageEnable = VK_FALSE;
+    multisampleState.alphaToOneEnable      = VK_FALSE;
+
+    // TODO(jmadill): Depth/stencil state.
+
+    // TODO(jmadill): Blend state/MRT.
+    VkPipelineColorBlendAttachmentState blendAttachmentState;
+    blendAttachmentState.blendEnable         = VK_FALSE;
+    blendAttachmentState.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    blendAttachmentState.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    blendAttachmentState.colorBlendOp        = VK_BLEND_OP_ADD;
+    blendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    blendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    blendAttachmentState.alphaBlendOp        = VK_BLEND_OP_ADD;
+    blendAttachmentState.colorWriteMask = (VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                           VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT);
+
+    VkPipelineColorBlendStateCreateInfo blendState;
+    blendState.sType             = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blendState.pNext             = 0;
+    blendState.flags             = 0;
+    blendState.logicOpEnable     = VK_FALSE;
+    blendState.logicOp           = VK_LOGIC_OP_CLEAR;
+    blendState.attachmentCount   = 1;
+    blendState.pAttachments      = &blendAttachmentState;
+    blendState.blendConstants[0] = 0.0f;
+    blendState.blendConstants[1] = 0.0f;
+    blendState.blendConstants[2] = 0.0f;
+    blendState.blendConstants[3] = 0.0f;
+
+    const VkDynamicState dynamicStates[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+
+    VkPipelineDynamicStateCreateInfo dynamicState;
+    dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.pNext             = nullptr;
+    dynamicState.flags             = 0;
+    dynamicState.dynamicStateCount = static_cast<uint32_t>(ArraySize(dynamicStates));
+    dynamicState.pDynamicStates    = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo;
+    pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.pNext               = nullptr;
+    pipelineInfo.flags               = 0;
+    pipelineInfo.stageCount          = 2;
+    pipelineInfo.pStages             = shaderStages;
+    pipelineInfo.pVertexInputState   = &vertexInputState;
+    pipelineInfo.pInputAssemblyState = &inputAssemblyState;
+    pipelineInfo.pTessellationState  = nullptr;
+    pipelineInfo.pViewportState      = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterState;
+    pipelineInfo.pMultisampleState   = &multisampleState;
+    pipelineInfo.pDepthStencilState  = nullptr;
+    pipelineInfo.pColorBlendState    = &blendState;
+    pipelineInfo.pDynamicState       = &dynamicState;
+    pipelineInfo.layout              = pipelineLayout.getHandle();
+    pipelineInfo.renderPass          = compatibleRenderPass.getHandle();
+    pipelineInfo.subpass             = 0;
+    pipelineInfo.basePipelineHandle  = VK_NULL_HANDLE;
+    pipelineInfo.basePipelineIndex   = 0;
+
+    ANGLE_TRY(pipelineOut->initGraphics(device, pipelineInfo, pipelineCache));
+    return NoError();
+}
+
+}  // namespace vk
+
+// PipelineCacheVk implementation.
+PipelineCacheVk::PipelineCacheVk() : mCacheDirty(false)
+{
+}
+
+PipelineCacheVk::~PipelineCacheVk()
+{
+    ASSERT(mPipelines.empty());
+}
+
+vk::Error PipelineCacheVk::initialize(VkDevice device,
+                                      const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                      const std::string &cacheFilePath)
+{
+    mCacheFilePath = cacheFilePath;
+
+    std::vector<uint8_t> initialData;
+    if (mCacheFilePath.empty() || !ReadCacheFile(mCacheFilePath, &initialData) ||
+        !IsPipelineCacheDataCompatible(initialData, physicalDeviceProperties))
+    {
+        initialData.clear();
+    }
+
+    VkPipelineCacheCreateInfo createInfo;
+    createInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.pNext           = nullptr;
+    createInfo.flags           = 0;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData    = initialData.empty() ? nullptr : initialData.data();
+
+    ANGLE_TRY(mPipelineCache.init(device, createInfo));
+    return vk::NoError();
+}
+
+void PipelineCacheVk::destroy(VkDevice device)
+{
+    for (auto &pipeline : mPipelines)
+    {
+        pipeline.second.destroy(device);
+    }
+    mPipelines.clear();
+
+    if (!mPipelineCache.valid())
+    {
+        return;
+    }
+
+    if (mCacheDirty && !mCacheFilePath.empty())
+    {
+        std::vector<uint8_t> cacheData;
+        vk::Error error = mPipelineCache.getCacheData(device, &cacheData);
+        if (error.isError())
+        {
+            WARN() << "Error getting the Vulkan pipeline cache data: " << error;
+        }
+        else if (!WriteCacheFile(mCacheFilePath, cacheData))
+        {
+            WARN() << "Error writing the Vulkan pipeline cache to " << mCacheFilePath;
+        }
+    }
+
+    mPipelineCache.destroy(device);
+}
+
+vk::Error PipelineCacheVk::getPipeline(VkDevice device,
+                                       const vk::PipelineDesc &desc,
+                                       const vk::RenderPass &compatibleRenderPass,
+                                       const vk::PipelineLayout &pipelineLayout,
+                                       const vk::ShaderModule &vertexModule,
+                                       const vk::ShaderModule &fragmentModule,
+                                       vk::Pipeline **pipelineOut)
+{
+    auto iter = mPipelines.find(desc);
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.VulkanPipelineCacheHit", iter != mPipelines.end());
+    if (iter != mPipelines.end())
+    {
+        *pipelineOut = &iter->second;
+        return vk::NoError();
+    }
+
+    vk::Pipeline newPipeline;
+    ANGLE_TRY(desc.initializePipeline(device, mPipelineCache, compatibleRenderPass, pipelineLayout,
+                                      vertexModule, fragmentModule, &newPipeline));
+    mCacheDirty = true;
+
+    auto insertion = mPipelines.emplace(desc, std::move(newPipeline));
+    *pipelineOut   = &insertion.first->second;
+    return vk::NoError();
+}
+
+}  // namespace rx
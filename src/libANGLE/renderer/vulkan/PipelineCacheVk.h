@@ -0,0 +1,160 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PipelineCacheVk.h:
+//    Defines PipelineDesc, the packed state a graphics pipeline is built from, and
+//    PipelineCacheVk, which reuses the pipelines built for each description and persists the
+//    driver's VkPipelineCache between runs.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_PIPELINECACHEVK_H_
+#define LIBANGLE_RENDERER_VULKAN_PIPELINECACHEVK_H_
+
+#include <unordered_map>
+
+#include <vulkan/vulkan.h>
+
+#include "libANGLE/Constants.h"
+#include "libANGLE/renderer/vulkan/renderervk_utils.h"
+
+namespace gl
+{
+struct RasterizerState;
+class State;
+}
+
+namespace rx
+{
+namespace vk
+{
+
+struct PackedVertexInputAttributeDesc final
+{
+    uint32_t format;
+    uint32_t offset;
+    uint16_t stride;
+    uint16_t inputRate;
+};
+
+// Everything a graphics pipeline depends on besides the viewport and scissor, which are dynamic
+// state. Descriptions are compared and hashed bitwise, so the constructor zeroes the padding and
+// every member has to be a plain value.
+class PipelineDesc final
+{
+  public:
+    PipelineDesc();
+
+    size_t hash() const;
+    bool operator==(const PipelineDesc &other) const;
+
+    void updateProgram(Serial programSerial);
+    void updateVertexInputAttribute(size_t attribIndex,
+                                    VkFormat format,
+                                    uint32_t offset,
+                                    uint32_t stride,
+                                    VkVertexInputRate inputRate);
+    void updateVertexInputAttribute(size_t attribIndex,
+                                    const PackedVertexInputAttributeDesc &packedAttrib);
+    void updateTopology(VkPrimitiveTopology topology);
+    void updateRasterizerState(const gl::RasterizerState &rasterState, float lineWidth);
+    void updateColorAttachment(size_t colorIndex, VkFormat format, VkSampleCountFlagBits samples);
+    void updateDepthStencilAttachment(VkFormat format, VkSampleCountFlagBits samples);
+
+    uint64_t getProgramSerial() const { return mProgramSerial; }
+
+    Error initializePipeline(VkDevice device,
+                             const PipelineCache &pipelineCache,
+                             const RenderPass &compatibleRenderPass,
+                             const PipelineLayout &pipelineLayout,
+                             const ShaderModule &vertexModule,
+                             const ShaderModule &fragmentModule,
+                             Pipeline *pipelineOut) const;
+
+  private:
+    uint64_t mProgramSerial;
+    uint32_t mActiveAttribLocationsMask;
+    PackedVertexInputAttributeDesc mVertexInputAttribs[gl::MAX_VERTEX_ATTRIBS];
+    uint32_t mTopology;
+    uint32_t mCullMode;
+    uint32_t mFrontFace;
+    float mLineWidth;
+
+    // Render pass compatibility: only the formats and sample counts of the attachments matter.
+    uint32_t mColorAttachmentFormats[gl::IMPLEMENTATION_MAX_DRAW_BUFFERS];
+    uint32_t mDepthStencilAttachmentFormat;
+    uint32_t mSamples;
+};
+
+}  // namespace vk
+}  // namespace rx
+
+namespace std
+{
+template <>
+struct hash<rx::vk::PipelineDesc>
+{
+    size_t operator()(const rx::vk::PipelineDesc &key) const { return key.hash(); }
+};
+}  // namespace std
+
+namespace rx
+{
+
+class PipelineCacheVk final : angle::NonCopyable
+{
+  public:
+    PipelineCacheVk();
+    ~PipelineCacheVk();
+
+    // Seeds the driver cache with the data saved to cacheFilePath by a previous run, if it was
+    // written by the same driver and device. The cache isn't persisted if cacheFilePath is empty.
+    vk::Error initialize(VkDevice device,
+                         const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                         const std::string &cacheFilePath);
+
+    // Saves the driver cache back to disk if pipelines were built, then destroys every pipeline.
+    void destroy(VkDevice device);
+
+    // Returns the pipeline built for desc, building it with the given objects on a miss. The
+    // returned pointer stays valid until the pipelines of the program are released.
+    vk::Error getPipeline(VkDevice device,
+                          const vk::PipelineDesc &desc,
+                          const vk::RenderPass &compatibleRenderPass,
+                          const vk::PipelineLayout &pipelineLayout,
+                          const vk::ShaderModule &vertexModule,
+                          const vk::ShaderModule &fragmentModule,
+                          vk::Pipeline **pipelineOut);
+
+    // Hands the pipelines built for a program that was relinked or deleted to the garbage list.
+    template <typename GarbageFuncT>
+    void releaseProgramPipelines(Serial programSerial, GarbageFuncT &&releaseFunc)
+    {
+        for (auto iter = mPipelines.begin(); iter != mPipelines.end();)
+        {
+            if (iter->first.getProgramSerial() == programSerial.getValue())
+            {
+                releaseFunc(std::move(iter->second));
+                iter = mPipelines.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    size_t getPipelineCount() const { return mPipelines.size(); }
+
+  private:
+    vk::PipelineCache mPipelineCache;
+    std::string mCacheFilePath;
+    bool mCacheDirty;
+
+    std::unordered_map<vk::PipelineDesc, vk::Pipeline> mPipelines;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_PIPELINECACHEVK_H_
@@ -28,7 +28,10 @@ ProgramVk::~ProgramVk()
 
 void ProgramVk::destroy(const gl::Context *contextImpl)
 {
-    VkDevice device = GetImplAs<ContextVk>(contextImpl)->getDevice();
+    RendererVk *renderer = GetImplAs<ContextVk>(contextImpl)->getRenderer();
+    VkDevice device      = renderer->getDevice();
+
+    releasePipelines(renderer);
 
     mLinkedFragmentModule.destroy(device);
     mLinkedVertexModule.destroy(device);
@@ -109,7 +112,9 @@ LinkResult ProgramVk::link(const gl::Context *glContext,
     mLinkedVertexModule.retain(device, std::move(vertexModule));
     mLinkedFragmentModule.retain(device, std::move(fragmentModule));
 
-    // TODO(jmadill): Use pipeline cache.
+    // Pipelines built from the previous link can't be used anymore.
+    releasePipelines(renderer);
+    mProgramSerial = renderer->issueProgramSerial();
     context->invalidateCurrentPipeline();
 
     return true;
@@ -293,6 +298,11 @@ const vk::ShaderModule &ProgramVk::getLinkedFragmentModule() const
 
 gl::ErrorOrResult<vk::PipelineLayout *> ProgramVk::getPipelineLayout(VkDevice device)
 {
+    if (mPipelineLayout.valid())
+    {
+        return &mPipelineLayout;
+    }
+
     vk::PipelineLayout newLayout;
 
     // TODO(jmadill): Descriptor sets.
@@ -311,4 +321,20 @@ gl::ErrorOrResult<vk::PipelineLayout *> ProgramVk::getPipelineLayout(VkDevice de
     return &mPipelineLayout;
 }
 
+void ProgramVk::releasePipelines(RendererVk *renderer)
+{
+    if (mProgramSerial == Serial())
+    {
+        return;
+    }
+
+    // The pipelines may still be referenced by commands that haven't been submitted.
+    Serial queueSerial = renderer->getCurrentQueueSerial();
+    renderer->getPipelineCache()->releaseProgramPipelines(
+        mProgramSerial, [renderer, queueSerial](vk::Pipeline &&pipeline) {
+            renderer->enqueueGarbage(queueSerial, std::move(pipeline));
+        });
+    mProgramSerial = Serial();
+}
+
 }  // namespace rx
@@ -15,6 +15,7 @@
 
 namespace rx
 {
+class RendererVk;
 
 class ProgramVk : public ProgramImpl
 {
@@ -105,10 +106,16 @@ class ProgramVk : public ProgramImpl
     const vk::ShaderModule &getLinkedFragmentModule() const;
     gl::ErrorOrResult<vk::PipelineLayout *> getPipelineLayout(VkDevice device);
 
+    // Identifies the current link in the pipeline cache.
+    Serial getProgramSerial() const { return mProgramSerial; }
+
   private:
+    void releasePipelines(RendererVk *renderer);
+
     vk::ShaderModule mLinkedVertexModule;
     vk::ShaderModule mLinkedFragmentModule;
     vk::PipelineLayout mPipelineLayout;
+    Serial mProgramSerial;
 };
 
 }  // namespace rx
@@ -24,6 +24,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/formatutilsvk.h"
 #include "platform/Platform.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace rx
 {
@@ -31,6 +32,10 @@ namespace rx
 namespace
 {
 
+// Persisting the pipeline cache is opt-in: the variable holds the path of the file the cache is
+// loaded from and saved to.
+constexpr char kPipelineCacheFileVariable[] = "ANGLE_VULKAN_PIPELINE_CACHE_FILE";
+
 VkResult VerifyExtensionsPresent(const std::vector<VkExtensionProperties> &extensionProps,
                                  const std::vector<const char *> &enabledExtensionNames)
 {
@@ -93,11 +98,11 @@ RendererVk::RendererVk()
       mQueue(VK_NULL_HANDLE),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
       mDevice(VK_NULL_HANDLE),
-      mHostVisibleMemoryIndex(std::numeric_limits<uint32_t>::max()),
       mGlslangWrapper(nullptr),
       mCurrentQueueSerial(),
       mLastCompletedQueueSerial(),
-      mInFlightCommands()
+      mInFlightCommands(),
+      mLastProgramSerial()
 {
     ++mCurrentQueueSerial;
 }
@@ -119,6 +124,9 @@ RendererVk::~RendererVk()
         mGlslangWrapper = nullptr;
     }
 
+    mPipelineCache.destroy(mDevice);
+    mMemoryAllocator.destroy(mDevice);
+
     if (mCommandBuffer.valid())
     {
         mCommandBuffer.destroy(mDevice);
@@ -337,18 +345,21 @@ vk::Error RendererVk::initialize(const egl::AttributeMap &attribs, const char *w
     VkPhysicalDeviceMemoryProperties memoryProperties;
     vkGetPhysicalDeviceMemoryProperties(mPhysicalDevice, &memoryProperties);
 
+    // Staging images are read back from host-visible memory.
+    bool hasHostVisibleMemory = false;
     for (uint32_t memoryIndex = 0; memoryIndex < memoryProperties.memoryTypeCount; ++memoryIndex)
     {
         if ((memoryProperties.memoryTypes[memoryIndex].propertyFlags &
              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
         {
-            mHostVisibleMemoryIndex = memoryIndex;
+            hasHostVisibleMemory = true;
             break;
         }
     }
 
-    ANGLE_VK_CHECK(mHostVisibleMemoryIndex < std::numeric_limits<uint32_t>::max(),
-                   VK_ERROR_INITIALIZATION_FAILED);
+    ANGLE_VK_CHECK(hasHostVisibleMemory, VK_ERROR_INITIALIZATION_FAILED);
+
+    mMemoryAllocator.initialize(memoryProperties, mPhysicalDeviceProperties.limits);
 
     mGlslangWrapper = GlslangWrapper::GetReference();
 
@@ -437,6 +448,11 @@ vk::Error RendererVk::initializeDevice(uint32_t queueFamilyIndex)
 
     mCommandBuffer.setCommandPool(&mCommandPool);
 
+    // Seed the pipeline cache with the data a previous run saved, if persisting it is enabled.
+    Optional<std::string> cacheFilePath = angle::GetEnvironmentVar(kPipelineCacheFileVariable);
+    ANGLE_TRY(mPipelineCache.initialize(mDevice, mPhysicalDeviceProperties,
+                                        cacheFilePath.valid() ? cacheFilePath.value() : ""));
+
     return vk::NoError();
 }
 
@@ -635,6 +651,7 @@ vk::Error RendererVk::submitCommandsWithSync(vk::CommandBuffer *commandBuffer,
 
 vk::Error RendererVk::finish()
 {
+    TRACE_EVENT0("gpu.angle", "RendererVk::finish");
     ASSERT(mQueue != VK_NULL_HANDLE);
     ANGLE_VK_TRY(vkQueueWaitIdle(mQueue));
     freeAllInFlightResources();
@@ -723,6 +740,7 @@ vk::Error RendererVk::checkInFlightCommands()
 
 vk::Error RendererVk::submit(const VkSubmitInfo &submitInfo)
 {
+    TRACE_EVENT0("gpu.angle", "RendererVk::submit");
     ANGLE_VK_TRY(vkQueueSubmit(mQueue, 1, &submitInfo, VK_NULL_HANDLE));
 
     // Store this command buffer in the in-flight list.
@@ -739,6 +757,7 @@ vk::Error RendererVk::submit(const VkSubmitInfo &submitInfo)
 
 vk::Error RendererVk::submitFrame(const VkSubmitInfo &submitInfo)
 {
+    TRACE_EVENT0("gpu.angle", "RendererVk::submitFrame");
     VkFenceCreateInfo createInfo;
     createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     createInfo.pNext = nullptr;
@@ -769,9 +788,7 @@ vk::Error RendererVk::createStagingImage(TextureDimension dimension,
                                          const gl::Extents &extent,
                                          vk::StagingImage *imageOut)
 {
-    ASSERT(mHostVisibleMemoryIndex != std::numeric_limits<uint32_t>::max());
-
-    ANGLE_TRY(imageOut->init(mDevice, mCurrentQueueFamilyIndex, mHostVisibleMemoryIndex, dimension,
+    ANGLE_TRY(imageOut->init(mDevice, &mMemoryAllocator, mCurrentQueueFamilyIndex, dimension,
                              format.native, extent));
 
     return vk::NoError();
@@ -787,4 +804,12 @@ Serial RendererVk::getCurrentQueueSerial() const
     return mCurrentQueueSerial;
 }
 
+Serial RendererVk::issueProgramSerial()
+{
+    bool success = ++mLastProgramSerial;
+    ASSERT(success);
+    UNUSED_VARIABLE(success);
+    return mLastProgramSerial;
+}
+
 }  // namespace rx
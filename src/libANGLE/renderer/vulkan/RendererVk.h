@@ -15,6 +15,8 @@
 
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/renderer/vulkan/MemoryAllocatorVk.h"
+#include "libANGLE/renderer/vulkan/PipelineCacheVk.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
 
 namespace egl
@@ -72,6 +74,12 @@ class RendererVk : angle::NonCopyable
 
     Serial getCurrentQueueSerial() const;
 
+    MemoryAllocatorVk *getMemoryAllocator() { return &mMemoryAllocator; }
+    PipelineCacheVk *getPipelineCache() { return &mPipelineCache; }
+
+    // Identifies a program link in the pipeline cache. Every link gets a new serial.
+    Serial issueProgramSerial();
+
     template <typename T>
     void enqueueGarbage(Serial serial, T &&object)
     {
@@ -122,13 +130,15 @@ class RendererVk : angle::NonCopyable
     VkDevice mDevice;
     vk::CommandPool mCommandPool;
     vk::CommandBuffer mCommandBuffer;
-    uint32_t mHostVisibleMemoryIndex;
     GlslangWrapper *mGlslangWrapper;
     Serial mCurrentQueueSerial;
     Serial mLastCompletedQueueSerial;
     std::vector<vk::CommandBufferAndSerial> mInFlightCommands;
     std::vector<vk::FenceAndSerial> mInFlightFences;
     std::vector<std::unique_ptr<vk::IGarbageObject>> mGarbage;
+    MemoryAllocatorVk mMemoryAllocator;
+    PipelineCacheVk mPipelineCache;
+    Serial mLastProgramSerial;
 };
 
 }  // namespace rx
@@ -9,16 +9,23 @@
 
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
+#include <cstring>
+
 #include "common/debug.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/formatutilsvk.h"
 
 namespace rx
 {
 
 VertexArrayVk::VertexArrayVk(const gl::VertexArrayState &data) : VertexArrayImpl(data)
 {
+    memset(mVertexInputAttribs.data(), 0, sizeof(mVertexInputAttribs));
+    mCurrentArrayBuffers.fill(nullptr);
+    mCurrentArrayBufferOffsets.fill(0);
 }
 
 VertexArrayVk::~VertexArrayVk()
@@ -30,9 +37,86 @@ void VertexArrayVk::syncState(const gl::Context *context,
 {
     ASSERT(dirtyBits.any());
 
-    // TODO(jmadill): Use pipeline cache.
-    auto contextVk = GetImplAs<ContextVk>(context);
-    contextVk->invalidateCurrentPipeline();
+    const auto &attribs = mData.getVertexAttributes();
+
+    // Binding changes apply to every attribute that uses the binding.
+    gl::AttributesMask dirtyAttribs;
+    for (size_t dirtyBit : dirtyBits)
+    {
+        // TODO(jmadill): Element array buffers.
+        if (dirtyBit == gl::VertexArray::DIRTY_BIT_ELEMENT_ARRAY_BUFFER)
+        {
+            continue;
+        }
+
+        size_t index = gl::VertexArray::GetAttribIndex(dirtyBit);
+        if (dirtyBit < gl::VertexArray::DIRTY_BIT_BINDING_0_BUFFER)
+        {
+            dirtyAttribs.set(index);
+            continue;
+        }
+
+        for (size_t attribIndex = 0; attribIndex < attribs.size(); ++attribIndex)
+        {
+            if (attribs[attribIndex].bindingIndex == index)
+            {
+                dirtyAttribs.set(attribIndex);
+            }
+        }
+    }
+
+    bool pipelineChanged = false;
+    for (size_t attribIndex : dirtyAttribs)
+    {
+        pipelineChanged = updateAttrib(attribIndex) || pipelineChanged;
+    }
+
+    if (pipelineChanged)
+    {
+        auto contextVk = GetImplAs<ContextVk>(context);
+        contextVk->invalidateCurrentPipeline();
+    }
+}
+
+bool VertexArrayVk::updateAttrib(size_t attribIndex)
+{
+    const gl::VertexAttribute &attrib = mData.getVertexAttributes()[attribIndex];
+    const gl::VertexBinding &binding  = mData.getVertexBindings()[attrib.bindingIndex];
+
+    vk::PackedVertexInputAttributeDesc inputAttrib;
+    memset(&inputAttrib, 0, sizeof(inputAttrib));
+
+    if (attrib.enabled)
+    {
+        // The binding offset goes into vkCmdBindVertexBuffers, so that only the relative offset
+        // is part of the pipeline.
+        gl::VertexFormatType vertexFormatType = gl::GetVertexFormatType(attrib);
+
+        inputAttrib.format    = static_cast<uint32_t>(vk::GetNativeVertexFormat(vertexFormatType));
+        inputAttrib.offset    = static_cast<uint32_t>(attrib.relativeOffset);
+        inputAttrib.stride    = static_cast<uint16_t>(gl::ComputeVertexAttributeTypeSize(attrib));
+        inputAttrib.inputRate = static_cast<uint16_t>(
+            binding.divisor > 0 ? VK_VERTEX_INPUT_RATE_INSTANCE : VK_VERTEX_INPUT_RATE_VERTEX);
+
+        gl::Buffer *bufferGL = binding.buffer.get();
+        mCurrentArrayBuffers[attribIndex] =
+            (bufferGL ? GetImplAs<BufferVk>(bufferGL) : nullptr);
+        mCurrentArrayBufferOffsets[attribIndex] = static_cast<VkDeviceSize>(binding.offset);
+    }
+    else
+    {
+        mCurrentArrayBuffers[attribIndex]       = nullptr;
+        mCurrentArrayBufferOffsets[attribIndex] = 0;
+    }
+
+    vk::PackedVertexInputAttributeDesc &cachedAttrib = mVertexInputAttribs[attribIndex];
+    if (memcmp(&cachedAttrib, &inputAttrib, sizeof(inputAttrib)) == 0)
+    {
+        return false;
+    }
+
+    cachedAttrib = inputAttrib;
+    return true;
 }
 
 }  // namespace rx
@@ -10,10 +10,14 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VERTEXARRAYVK_H_
 #define LIBANGLE_RENDERER_VULKAN_VERTEXARRAYVK_H_
 
+#include <array>
+
 #include "libANGLE/renderer/VertexArrayImpl.h"
+#include "libANGLE/renderer/vulkan/PipelineCacheVk.h"
 
 namespace rx
 {
+class BufferVk;
 
 class VertexArrayVk : public VertexArrayImpl
 {
@@ -23,6 +27,30 @@ class VertexArrayVk : public VertexArrayImpl
 
     void syncState(const gl::Context *context,
                    const gl::VertexArray::DirtyBits &dirtyBits) override;
+
+    // Cached from the dirty bits and indexed by attribute location. Disabled attributes have no
+    // buffer and a zeroed input description.
+    const std::array<vk::PackedVertexInputAttributeDesc, gl::MAX_VERTEX_ATTRIBS>
+        &getVertexInputAttribs() const
+    {
+        return mVertexInputAttribs;
+    }
+    const std::array<BufferVk *, gl::MAX_VERTEX_ATTRIBS> &getCurrentArrayBuffers() const
+    {
+        return mCurrentArrayBuffers;
+    }
+    const std::array<VkDeviceSize, gl::MAX_VERTEX_ATTRIBS> &getCurrentArrayBufferOffsets() const
+    {
+        return mCurrentArrayBufferOffsets;
+    }
+
+  private:
+    // Returns true if the change affects the pipeline, and not only the bound buffer.
+    bool updateAttrib(size_t attribIndex);
+
+    std::array<vk::PackedVertexInputAttributeDesc, gl::MAX_VERTEX_ATTRIBS> mVertexInputAttribs;
+    std::array<BufferVk *, gl::MAX_VERTEX_ATTRIBS> mCurrentArrayBuffers;
+    std::array<VkDeviceSize, gl::MAX_VERTEX_ATTRIBS> mCurrentArrayBufferOffsets;
 };
 
 }  // namespace rx
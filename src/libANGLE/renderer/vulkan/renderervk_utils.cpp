@@ -9,6 +9,8 @@
 
 #include "renderervk_utils.h"
 
+#include "common/mathutil.h"
+#include "libANGLE/renderer/vulkan/MemoryAllocatorVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 
 namespace rx
@@ -240,6 +242,8 @@ Error CommandPool::init(VkDevice device, const VkCommandPoolCreateInfo &createIn
 // CommandBuffer implementation.
 CommandBuffer::CommandBuffer() : mStarted(false), mCommandPool(nullptr)
 {
+    mBoundVertexBuffers.fill(VK_NULL_HANDLE);
+    mBoundVertexBufferOffsets.fill(0);
 }
 
 void CommandBuffer::setCommandPool(CommandPool *commandPool)
@@ -273,6 +277,10 @@ Error CommandBuffer::begin(VkDevice device)
 
     mStarted = true;
 
+    // A new recording starts without any bound vertex buffers.
+    mBoundVertexBuffers.fill(VK_NULL_HANDLE);
+    mBoundVertexBufferOffsets.fill(0);
+
     VkCommandBufferBeginInfo beginInfo;
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.pNext = nullptr;
@@ -418,13 +426,59 @@ void CommandBuffer::bindPipeline(VkPipelineBindPoint pipelineBindPoint,
     vkCmdBindPipeline(mHandle, pipelineBindPoint, pipeline.getHandle());
 }
 
-void CommandBuffer::bindVertexBuffers(uint32_t firstBinding,
-                                      const std::vector<VkBuffer> &buffers,
-                                      const std::vector<VkDeviceSize> &offsets)
+void CommandBuffer::setViewport(const VkViewport &viewport)
+{
+    ASSERT(valid());
+    vkCmdSetViewport(mHandle, 0, 1, &viewport);
+}
+
+void CommandBuffer::setScissor(const VkRect2D &scissor)
+{
+    ASSERT(valid());
+    vkCmdSetScissor(mHandle, 0, 1, &scissor);
+}
+
+void CommandBuffer::bindVertexBuffers(const gl::AttributesMask &bindingMask,
+                                      const VkBuffer *buffers,
+                                      const VkDeviceSize *offsets)
 {
-    ASSERT(valid() && buffers.size() == offsets.size());
-    vkCmdBindVertexBuffers(mHandle, firstBinding, static_cast<uint32_t>(buffers.size()),
-                           buffers.data(), offsets.data());
+    ASSERT(valid());
+
+    // Changed bindings next to each other are bound with a single call.
+    uint32_t firstBinding = 0;
+    uint32_t bindingCount = 0;
+
+    for (size_t binding : bindingMask)
+    {
+        bool changed = (mBoundVertexBuffers[binding] != buffers[binding] ||
+                        mBoundVertexBufferOffsets[binding] != offsets[binding]);
+        bool adjacent = (bindingCount > 0 && firstBinding + bindingCount == binding);
+
+        if (bindingCount > 0 && (!changed || !adjacent))
+        {
+            vkCmdBindVertexBuffers(mHandle, firstBinding, bindingCount, &buffers[firstBinding],
+                                   &offsets[firstBinding]);
+            bindingCount = 0;
+        }
+
+        if (changed)
+        {
+            if (bindingCount == 0)
+            {
+                firstBinding = static_cast<uint32_t>(binding);
+            }
+            bindingCount++;
+
+            mBoundVertexBuffers[binding]       = buffers[binding];
+            mBoundVertexBufferOffsets[binding] = offsets[binding];
+        }
+    }
+
+    if (bindingCount > 0)
+    {
+        vkCmdBindVertexBuffers(mHandle, firstBinding, bindingCount, &buffers[firstBinding],
+                               &offsets[firstBinding]);
+    }
 }
 
 // Image implementation.
@@ -534,10 +588,11 @@ void Image::getMemoryRequirements(VkDevice device, VkMemoryRequirements *require
     vkGetImageMemoryRequirements(device, mHandle, requirementsOut);
 }
 
-Error Image::bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory)
+Error Image::bindMemory(VkDevice device, const Allocation &allocation)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    ANGLE_VK_TRY(vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), 0));
+    ASSERT(valid() && allocation.valid());
+    ANGLE_VK_TRY(vkBindImageMemory(device, mHandle, allocation.getMemoryHandle(),
+                                   allocation.getOffset()));
     return NoError();
 }
 
@@ -649,6 +704,102 @@ void DeviceMemory::unmap(VkDevice device)
     vkUnmapMemory(device, mHandle);
 }
 
+// Allocation implementation.
+Allocation::Allocation()
+    : mAllocator(nullptr),
+      mBlock(nullptr),
+      mMemoryHandle(VK_NULL_HANDLE),
+      mOffset(0),
+      mSize(0),
+      mMappedPointer(nullptr),
+      mNonCoherentAtomSize(0),
+      mMappedOffset(0),
+      mMappedSize(0)
+{
+}
+
+Allocation::Allocation(Allocation &&other) : Allocation()
+{
+    retain(VK_NULL_HANDLE, std::move(other));
+}
+
+Allocation::~Allocation()
+{
+    ASSERT(!valid());
+}
+
+void Allocation::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        mAllocator->free(device, this);
+        ASSERT(!valid());
+    }
+}
+
+void Allocation::retain(VkDevice device, Allocation &&other)
+{
+    destroy(device);
+
+    std::swap(mAllocator, other.mAllocator);
+    std::swap(mBlock, other.mBlock);
+    std::swap(mMemoryHandle, other.mMemoryHandle);
+    std::swap(mOffset, other.mOffset);
+    std::swap(mSize, other.mSize);
+    std::swap(mMappedPointer, other.mMappedPointer);
+    std::swap(mNonCoherentAtomSize, other.mNonCoherentAtomSize);
+    std::swap(mMappedOffset, other.mMappedOffset);
+    std::swap(mMappedSize, other.mMappedSize);
+}
+
+Error Allocation::map(VkDevice device, VkDeviceSize offset, VkDeviceSize size, uint8_t **mapPointer)
+{
+    ASSERT(valid() && mMappedPointer != nullptr);
+    ASSERT(offset + size <= mSize);
+
+    if (mNonCoherentAtomSize != 0)
+    {
+        VkMappedMemoryRange range = getMappedRange(offset, size);
+        ANGLE_VK_TRY(vkInvalidateMappedMemoryRanges(device, 1, &range));
+    }
+
+    mMappedOffset = offset;
+    mMappedSize   = size;
+    *mapPointer   = mMappedPointer + offset;
+    return NoError();
+}
+
+Error Allocation::unmap(VkDevice device)
+{
+    ASSERT(valid() && mMappedPointer != nullptr);
+
+    if (mNonCoherentAtomSize != 0 && mMappedSize != 0)
+    {
+        VkMappedMemoryRange range = getMappedRange(mMappedOffset, mMappedSize);
+        ANGLE_VK_TRY(vkFlushMappedMemoryRanges(device, 1, &range));
+    }
+
+    mMappedOffset = 0;
+    mMappedSize   = 0;
+    return NoError();
+}
+
+VkMappedMemoryRange Allocation::getMappedRange(VkDeviceSize offset, VkDeviceSize size) const
+{
+    // Ranges have to start and end on multiples of the atom size, or end with the memory.
+    VkDeviceSize start = mOffset + offset;
+    start -= start % mNonCoherentAtomSize;
+    VkDeviceSize end = roundUp(mOffset + offset + size, mNonCoherentAtomSize);
+
+    VkMappedMemoryRange range;
+    range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.pNext  = nullptr;
+    range.memory = mMemoryHandle;
+    range.offset = start;
+    range.size   = (end <= mOffset + mSize ? end - start : VK_WHOLE_SIZE);
+    return range;
+}
+
 // RenderPass implementation.
 RenderPass::RenderPass()
 {
@@ -697,8 +848,8 @@ void StagingImage::retain(VkDevice device, StagingImage &&other)
 }
 
 Error StagingImage::init(VkDevice device,
+                         MemoryAllocatorVk *memoryAllocator,
                          uint32_t queueFamilyIndex,
-                         uint32_t hostVisibleMemoryIndex,
                          TextureDimension dimension,
                          VkFormat format,
                          const gl::Extents &extent)
@@ -729,16 +880,9 @@ Error StagingImage::init(VkDevice device,
     mImage.getMemoryRequirements(device, &memoryRequirements);
 
     // Ensure we can read this memory.
-    ANGLE_VK_CHECK((memoryRequirements.memoryTypeBits & (1 << hostVisibleMemoryIndex)) != 0,
-                   VK_ERROR_VALIDATION_FAILED_EXT);
-
-    VkMemoryAllocateInfo allocateInfo;
-    allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocateInfo.pNext           = nullptr;
-    allocateInfo.allocationSize  = memoryRequirements.size;
-    allocateInfo.memoryTypeIndex = hostVisibleMemoryIndex;
-
-    ANGLE_TRY(mDeviceMemory.allocate(device, allocateInfo));
+    ANGLE_TRY(memoryAllocator->allocate(device, memoryRequirements,
+                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                        MemoryAllocatorVk::Tiling::Linear, &mDeviceMemory));
     ANGLE_TRY(mImage.bindMemory(device, mDeviceMemory));
 
     mSize = memoryRequirements.size;
@@ -778,7 +922,8 @@ Error Buffer::init(VkDevice device, const VkBufferCreateInfo &createInfo)
 Error Buffer::bindMemory(VkDevice device)
 {
     ASSERT(valid() && mMemory.valid());
-    ANGLE_VK_TRY(vkBindBufferMemory(device, mHandle, mMemory.getHandle(), 0));
+    ANGLE_VK_TRY(
+        vkBindBufferMemory(device, mHandle, mMemory.getMemoryHandle(), mMemory.getOffset()));
     return NoError();
 }
 
@@ -803,6 +948,44 @@ Error ShaderModule::init(VkDevice device, const VkShaderModuleCreateInfo &create
     return NoError();
 }
 
+// PipelineCache implementation.
+PipelineCache::PipelineCache()
+{
+}
+
+void PipelineCache::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyPipelineCache(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+Error PipelineCache::init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(vkCreatePipelineCache(device, &createInfo, nullptr, &mHandle));
+    return NoError();
+}
+
+Error PipelineCache::getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const
+{
+    ASSERT(valid());
+
+    size_t cacheSize = 0;
+    ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, nullptr));
+
+    cacheDataOut->resize(cacheSize);
+    if (cacheSize > 0)
+    {
+        ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, cacheDataOut->data()));
+        cacheDataOut->resize(cacheSize);
+    }
+
+    return NoError();
+}
+
 // Pipeline implementation.
 Pipeline::Pipeline()
 {
@@ -817,11 +1000,13 @@ void Pipeline::destroy(VkDevice device)
     }
 }
 
-Error Pipeline::initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo)
+Error Pipeline::initGraphics(VkDevice device,
+                             const VkGraphicsPipelineCreateInfo &createInfo,
+                             const PipelineCache &pipelineCache)
 {
     ASSERT(!valid());
-    ANGLE_VK_TRY(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &mHandle));
+    ANGLE_VK_TRY(vkCreateGraphicsPipelines(device, pipelineCache.getHandle(), 1, &createInfo,
+                                           nullptr, &mHandle));
     return NoError();
 }
 
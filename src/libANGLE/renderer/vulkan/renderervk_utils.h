@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_UTILS_H_
 
+#include <array>
 #include <limits>
 
 #include <vulkan/vulkan.h>
@@ -17,6 +18,7 @@
 #include "common/debug.h"
 #include "common/Optional.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/angletypes.h"
 
 namespace gl
 {
@@ -28,6 +30,8 @@ struct Rectangle;
 
 namespace rx
 {
+class MemoryAllocatorVk;
+
 const char *VulkanResultString(VkResult result);
 bool HasStandardValidationLayer(const std::vector<VkLayerProperties> &layerProps);
 
@@ -60,9 +64,13 @@ class Serial final
         mValue = other.mValue;
         return *this;
     }
+    bool operator==(Serial other) const { return mValue == other.mValue; }
+    bool operator!=(Serial other) const { return mValue != other.mValue; }
     bool operator>=(Serial other) const { return mValue >= other.mValue; }
     bool operator>(Serial other) const { return mValue > other.mValue; }
 
+    uint64_t getValue() const { return mValue; }
+
     // This function fails if we're at the limits of our counting.
     bool operator++()
     {
@@ -110,6 +118,7 @@ class ResourceVk
 
 namespace vk
 {
+class Allocation;
 class DeviceMemory;
 class Framebuffer;
 class Image;
@@ -245,13 +254,22 @@ class CommandBuffer final : public WrappedObject<CommandBuffer, VkCommandBuffer>
               uint32_t firstInstance);
 
     void bindPipeline(VkPipelineBindPoint pipelineBindPoint, const vk::Pipeline &pipeline);
-    void bindVertexBuffers(uint32_t firstBinding,
-                           const std::vector<VkBuffer> &buffers,
-                           const std::vector<VkDeviceSize> &offsets);
+    void setViewport(const VkViewport &viewport);
+    void setScissor(const VkRect2D &scissor);
+
+    // Binds the vertex buffers of the bindings in the mask, indexed by binding. Bindings that
+    // already have the same buffer and offset since begin() are skipped.
+    void bindVertexBuffers(const gl::AttributesMask &bindingMask,
+                           const VkBuffer *buffers,
+                           const VkDeviceSize *offsets);
 
   private:
     bool mStarted;
     CommandPool *mCommandPool;
+
+    // The vertex buffers bound to the command buffer, by binding.
+    std::array<VkBuffer, gl::MAX_VERTEX_ATTRIBS> mBoundVertexBuffers;
+    std::array<VkDeviceSize, gl::MAX_VERTEX_ATTRIBS> mBoundVertexBufferOffsets;
 };
 
 class Image final : public WrappedObject<Image, VkImage>
@@ -282,7 +300,7 @@ class Image final : public WrappedObject<Image, VkImage>
                                 CommandBuffer *commandBuffer);
 
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *requirementsOut) const;
-    Error bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory);
+    Error bindMemory(VkDevice device, const Allocation &allocation);
 
     VkImageLayout getCurrentLayout() const { return mCurrentLayout; }
     void updateLayout(VkImageLayout layout) { mCurrentLayout = layout; }
@@ -337,6 +355,51 @@ class DeviceMemory final : public WrappedObject<DeviceMemory, VkDeviceMemory>
     void unmap(VkDevice device);
 };
 
+struct MemoryBlock;
+
+// A range of a device memory block, handed out by MemoryAllocatorVk. Host-visible blocks stay
+// mapped while they exist, so map and unmap only have to keep non-coherent memory in sync.
+class Allocation final : angle::NonCopyable
+{
+  public:
+    Allocation();
+    Allocation(Allocation &&other);
+    ~Allocation();
+
+    // Returns the range to the allocator.
+    void destroy(VkDevice device);
+    void retain(VkDevice device, Allocation &&other);
+
+    bool valid() const { return mBlock != nullptr; }
+    VkDeviceMemory getMemoryHandle() const { return mMemoryHandle; }
+    VkDeviceSize getOffset() const { return mOffset; }
+    VkDeviceSize getSize() const { return mSize; }
+
+    Error map(VkDevice device, VkDeviceSize offset, VkDeviceSize size, uint8_t **mapPointer);
+    Error unmap(VkDevice device);
+
+  private:
+    friend class rx::MemoryAllocatorVk;
+
+    VkMappedMemoryRange getMappedRange(VkDeviceSize offset, VkDeviceSize size) const;
+
+    MemoryAllocatorVk *mAllocator;
+    MemoryBlock *mBlock;
+    VkDeviceMemory mMemoryHandle;
+    VkDeviceSize mOffset;
+    VkDeviceSize mSize;
+
+    // Null unless the block is host-visible.
+    uint8_t *mMappedPointer;
+
+    // Zero for coherent memory, which needs no flushes or invalidations.
+    VkDeviceSize mNonCoherentAtomSize;
+
+    // The mapped range, recorded for the flush in unmap.
+    VkDeviceSize mMappedOffset;
+    VkDeviceSize mMappedSize;
+};
+
 class RenderPass final : public WrappedObject<RenderPass, VkRenderPass>
 {
   public:
@@ -356,21 +419,21 @@ class StagingImage final : angle::NonCopyable
     void retain(VkDevice device, StagingImage &&other);
 
     vk::Error init(VkDevice device,
+                   MemoryAllocatorVk *memoryAllocator,
                    uint32_t queueFamilyIndex,
-                   uint32_t hostVisibleMemoryIndex,
                    TextureDimension dimension,
                    VkFormat format,
                    const gl::Extents &extent);
 
     Image &getImage() { return mImage; }
     const Image &getImage() const { return mImage; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    Allocation &getDeviceMemory() { return mDeviceMemory; }
+    const Allocation &getDeviceMemory() const { return mDeviceMemory; }
     VkDeviceSize getSize() const { return mSize; }
 
   private:
     Image mImage;
-    DeviceMemory mDeviceMemory;
+    Allocation mDeviceMemory;
     VkDeviceSize mSize;
 };
 
@@ -384,11 +447,11 @@ class Buffer final : public WrappedObject<Buffer, VkBuffer>
     Error init(VkDevice device, const VkBufferCreateInfo &createInfo);
     Error bindMemory(VkDevice device);
 
-    DeviceMemory &getMemory() { return mMemory; }
-    const DeviceMemory &getMemory() const { return mMemory; }
+    Allocation &getMemory() { return mMemory; }
+    const Allocation &getMemory() const { return mMemory; }
 
   private:
-    DeviceMemory mMemory;
+    Allocation mMemory;
 };
 
 class ShaderModule final : public WrappedObject<ShaderModule, VkShaderModule>
@@ -401,6 +464,16 @@ class ShaderModule final : public WrappedObject<ShaderModule, VkShaderModule>
     Error init(VkDevice device, const VkShaderModuleCreateInfo &createInfo);
 };
 
+class PipelineCache final : public WrappedObject<PipelineCache, VkPipelineCache>
+{
+  public:
+    PipelineCache();
+    void destroy(VkDevice device);
+
+    Error init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo);
+    Error getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const;
+};
+
 class Pipeline final : public WrappedObject<Pipeline, VkPipeline>
 {
   public:
@@ -408,7 +481,9 @@ class Pipeline final : public WrappedObject<Pipeline, VkPipeline>
     void destroy(VkDevice device);
     using WrappedObject::retain;
 
-    Error initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo);
+    Error initGraphics(VkDevice device,
+                       const VkGraphicsPipelineCreateInfo &createInfo,
+                       const PipelineCache &pipelineCache);
 };
 
 class PipelineLayout final : public WrappedObject<PipelineLayout, VkPipelineLayout>
@@ -419,6 +419,21 @@ Error ValidateGetPlatformDisplayCommon(EGLenum platform,
                     }
                     break;
 
+                case EGL_DISPLAY_TRACE_RECORDER_ANGLE:
+                    if (!clientExtensions.displayTraceRecorder)
+                    {
+                        return Error(EGL_BAD_ATTRIBUTE,
+                                     "Attribute EGL_DISPLAY_TRACE_RECORDER_ANGLE requires "
+                                     "EGL_ANGLE_display_trace_recorder.");
+                    }
+                    if (value != EGL_TRUE && value != EGL_FALSE)
+                    {
+                        return Error(EGL_BAD_ATTRIBUTE,
+                                     "EGL_DISPLAY_TRACE_RECORDER_ANGLE must be either EGL_TRUE or "
+                                     "EGL_FALSE.");
+                    }
+                    break;
+
                 default:
                     break;
             }
@@ -727,6 +742,35 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
               }
               break;
 
+          case EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE:
+              if (!display->getExtensions().createContextMemoryBudget)
+              {
+                  return Error(EGL_BAD_ATTRIBUTE,
+                               "Attribute EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE requires "
+                               "EGL_ANGLE_create_context_memory_budget.");
+              }
+              if (value < 0)
+              {
+                  return Error(EGL_BAD_ATTRIBUTE,
+                               "EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE must not be negative.");
+              }
+              break;
+
+          case EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE:
+              if (!display->getExtensions().createContextMultithreadedShareGroup)
+              {
+                  return Error(EGL_BAD_ATTRIBUTE,
+                               "Attribute EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE requires "
+                               "EGL_ANGLE_create_context_multithreaded_share_group.");
+              }
+              if (value != EGL_TRUE && value != EGL_FALSE)
+              {
+                  return Error(EGL_BAD_ATTRIBUTE,
+                               "EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE must be EGL_TRUE or "
+                               "EGL_FALSE.");
+              }
+              break;
+
           default:
               return Error(EGL_BAD_ATTRIBUTE, "Unknown attribute.");
         }
@@ -769,6 +813,15 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
         return Error(EGL_BAD_ATTRIBUTE);
     }
 
+    bool multithreadedShareGroup =
+        attributes.get(EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, EGL_FALSE) == EGL_TRUE;
+    if (multithreadedShareGroup &&
+        attributes.get(EGL_DISPLAY_TEXTURE_SHARE_GROUP_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        return Error(EGL_BAD_MATCH,
+                     "A multithreaded share group can't use the display texture share group.");
+    }
+
     if (shareContext)
     {
         // Shared context is invalid or is owned by another display
@@ -777,6 +830,13 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
             return Error(EGL_BAD_MATCH);
         }
 
+        if (shareContext->usingMultithreadedShareGroup() != multithreadedShareGroup)
+        {
+            return Error(EGL_BAD_MATCH,
+                         "All contexts within a share group must be created with the same "
+                         "value of EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE.");
+        }
+
         if (shareContext->isResetNotificationEnabled() != resetNotification)
         {
             return Error(EGL_BAD_MATCH);
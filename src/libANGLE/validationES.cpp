@@ -10,6 +10,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/ErrorStrings.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Image.h"
@@ -30,7 +31,7 @@ using namespace angle;
 
 namespace gl
 {
-const char *g_ExceedsMaxElementErrorMessage = "Element value exceeds maximum element index.";
+const char *g_ExceedsMaxElementErrorMessage = kErrorExceedsMaxElement.text;
 
 namespace
 {
@@ -69,16 +70,14 @@ bool ValidateDrawAttribs(ValidationContext *context,
                 // no buffer is bound to that attribute via bindBuffer and vertexAttribPointer,
                 // then calls to drawArrays or drawElements will generate an INVALID_OPERATION
                 // error.
-                context->handleError(
-                    Error(GL_INVALID_OPERATION, "An enabled vertex array has no buffer."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexArrayNoBuffer));
                 return false;
             }
             else if (attrib.pointer == nullptr)
             {
                 // This is an application error that would normally result in a crash,
                 // but we catch it and return an error
-                context->handleError(Error(
-                    GL_INVALID_OPERATION, "An enabled vertex array has no buffer and no pointer."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexArrayNoBufferPointer));
                 return false;
             }
             continue;
@@ -125,7 +124,7 @@ bool ValidateDrawAttribs(ValidationContext *context,
         uint64_t attribOffset = ComputeVertexAttributeOffset(attrib, binding);
         if (attribDataSizeNoOffset > kUint64Max - attribOffset)
         {
-            context->handleError(Error(GL_INVALID_OPERATION, "Integer overflow."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorIntegerOverflow));
             return false;
         }
         uint64_t attribDataSizeWithOffset = attribDataSizeNoOffset + attribOffset;
@@ -135,8 +134,102 @@ bool ValidateDrawAttribs(ValidationContext *context,
         // enough backing data.
         if (attribDataSizeWithOffset > static_cast<uint64_t>(buffer->getSize()))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Vertex buffer is not big enough for the draw call"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexBufferTooSmall));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Checks that the indices of one element draw can be read from the element array buffer or from
+// client memory.
+bool ValidateDrawElementsIndices(ValidationContext *context,
+                                 GLsizei count,
+                                 GLenum type,
+                                 const void *indices)
+{
+    const State &state = context->getGLState();
+
+    const gl::VertexArray *vao     = state.getVertexArray();
+    gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
+
+    GLuint typeBytes = gl::GetTypeInfo(type).bytes;
+
+    if (context->getExtensions().webglCompatibility)
+    {
+        ASSERT(isPow2(typeBytes) && typeBytes > 0);
+        if ((reinterpret_cast<uintptr_t>(indices) & static_cast<uintptr_t>(typeBytes - 1)) != 0)
+        {
+            // [WebGL 1.0] Section 6.4 Buffer Offset and Stride Requirements
+            // The offset arguments to drawElements and [...], must be a multiple of the size of the
+            // data type passed to the call, or an INVALID_OPERATION error is generated.
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorMisalignedIndices));
+            return false;
+        }
+
+        // [WebGL 1.0] Section 6.4 Buffer Offset and Stride Requirements
+        // In addition the offset argument to drawElements must be non-negative or an INVALID_VALUE
+        // error is generated.
+        if (reinterpret_cast<intptr_t>(indices) < 0)
+        {
+            context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeIndicesOffset));
+            return false;
+        }
+    }
+
+    if (context->getExtensions().webglCompatibility ||
+        !context->getGLState().areClientArraysEnabled())
+    {
+        if (!elementArrayBuffer && count > 0)
+        {
+            // [WebGL 1.0] Section 6.2 No Client Side Arrays
+            // If drawElements is called with a count greater than zero, and no WebGLBuffer is bound
+            // to the ELEMENT_ARRAY_BUFFER binding point, an INVALID_OPERATION error is generated.
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorNoElementArrayBuffer));
+            return false;
+        }
+    }
+
+    if (count > 0)
+    {
+        if (elementArrayBuffer)
+        {
+            // The max possible type size is 8 and count is on 32 bits so doing the multiplication
+            // in a 64 bit integer is safe. Also we are guaranteed that here count > 0.
+            static_assert(std::is_same<int, GLsizei>::value, "GLsizei isn't the expected type");
+            constexpr uint64_t kMaxTypeSize = 8;
+            constexpr uint64_t kIntMax      = std::numeric_limits<int>::max();
+            constexpr uint64_t kUint64Max   = std::numeric_limits<uint64_t>::max();
+            static_assert(kIntMax < kUint64Max / kMaxTypeSize, "");
+
+            uint64_t typeSize     = typeBytes;
+            uint64_t elementCount = static_cast<uint64_t>(count);
+            ASSERT(elementCount > 0 && typeSize <= kMaxTypeSize);
+
+            // Doing the multiplication here is overflow-safe
+            uint64_t elementDataSizeNoOffset = typeSize * elementCount;
+
+            // The offset can be any value, check for overflows
+            uint64_t offset = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(indices));
+            if (elementDataSizeNoOffset > kUint64Max - offset)
+            {
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorIntegerOverflow));
+                return false;
+            }
+
+            uint64_t elementDataSizeWithOffset = elementDataSizeNoOffset + offset;
+            if (elementDataSizeWithOffset > static_cast<uint64_t>(elementArrayBuffer->getSize()))
+            {
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorIndexBufferTooSmall));
+                return false;
+            }
+        }
+        else if (!indices)
+        {
+            // This is an application error that would normally result in a crash,
+            // but we catch it and return an error
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorNoElementArrayBufferOrPointer));
             return false;
         }
     }
@@ -144,6 +237,214 @@ bool ValidateDrawAttribs(ValidationContext *context,
     return true;
 }
 
+bool ValidateMultiDrawBase(Context *context, GLsizei drawcount)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
+        return false;
+    }
+
+    if (drawcount < 0)
+    {
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeDrawCount));
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateMultiDrawInstanced(Context *context)
+{
+    if (context->getClientMajorVersion() < 3 && !context->getExtensions().instancedArrays)
+    {
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
+        return false;
+    }
+
+    return true;
+}
+
+// Validates all the draws of a multi-draw call at once: the parameters of every draw are checked
+// first, then the state is checked once and the vertex attributes are checked for the largest
+// vertex and instance any of the draws reads. instanceCounts is null for non-instanced draws.
+bool ValidateMultiDrawArraysCommon(Context *context,
+                                   GLenum mode,
+                                   const GLint *firsts,
+                                   const GLsizei *counts,
+                                   const GLsizei *instanceCounts,
+                                   GLsizei drawcount)
+{
+    if (!ValidateMultiDrawBase(context, drawcount))
+    {
+        return false;
+    }
+
+    GLsizei maxCount         = 0;
+    GLsizei maxInstanceCount = 0;
+    int64_t maxVertex        = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        GLsizei instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        if (firsts[drawID] < 0 || counts[drawID] < 0)
+        {
+            context->handleError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+
+        if (instanceCount < 0)
+        {
+            context->handleError(Error(GL_INVALID_VALUE, kErrorNegativePrimcount));
+            return false;
+        }
+
+        if (counts[drawID] == 0)
+        {
+            continue;
+        }
+
+        // first >= 0 and count > 0, so the last vertex can only overflow GLint on the high end.
+        int64_t drawMaxVertex =
+            static_cast<int64_t>(firsts[drawID]) + static_cast<int64_t>(counts[drawID]) - 1;
+        if (drawMaxVertex > static_cast<int64_t>(std::numeric_limits<GLint>::max()))
+        {
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorIntegerOverflow));
+            return false;
+        }
+
+        if (instanceCount > 0)
+        {
+            maxCount         = std::max(maxCount, counts[drawID]);
+            maxInstanceCount = std::max(maxInstanceCount, instanceCount);
+            maxVertex        = std::max(maxVertex, drawMaxVertex);
+        }
+    }
+
+    // Transform feedback would have to capture the vertices of every draw, which its buffers may
+    // not have room for, so the extension doesn't allow multi-draws while it is active.
+    const State &state                          = context->getGLState();
+    gl::TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
+    if (curTransformFeedback && curTransformFeedback->isActive() &&
+        !curTransformFeedback->isPaused())
+    {
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMultiDrawDuringTransformFeedback));
+        return false;
+    }
+
+    // No-op if no draw has both vertices and instances.
+    if (!ValidateDrawBase(context, mode, maxCount))
+    {
+        return false;
+    }
+
+    return ValidateDrawAttribs(context, maxInstanceCount, static_cast<GLint>(maxVertex),
+                               maxCount);
+}
+
+bool ValidateMultiDrawElementsCommon(Context *context,
+                                     GLenum mode,
+                                     const GLsizei *counts,
+                                     GLenum type,
+                                     const void *const *indices,
+                                     const GLsizei *instanceCounts,
+                                     GLsizei drawcount)
+{
+    if (!ValidateMultiDrawBase(context, drawcount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawElementsBase(context, type))
+    {
+        return false;
+    }
+
+    GLsizei maxCount = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] < 0)
+        {
+            context->handleError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+
+        if (instanceCounts && instanceCounts[drawID] < 0)
+        {
+            context->handleError(Error(GL_INVALID_VALUE, kErrorNegativePrimcount));
+            return false;
+        }
+
+        maxCount = std::max(maxCount, counts[drawID]);
+    }
+
+    if (!ValidateDrawBase(context, mode, maxCount))
+    {
+        return false;
+    }
+
+    // Check for mapped buffers
+    if (context->getGLState().hasMappedBuffer(GL_ELEMENT_ARRAY_BUFFER))
+    {
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIndexBufferMapped));
+        return false;
+    }
+
+    // The indices of every draw are checked before any of them is read to compute index ranges.
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] != 0 &&
+            !ValidateDrawElementsIndices(context, counts[drawID], type, indices[drawID]))
+        {
+            return false;
+        }
+    }
+
+    // The draw reuses the ranges computed here.
+    const auto &indexRanges = context->getParams<HasMultiDrawIndexRanges>().getIndexRanges();
+    if (!indexRanges.valid())
+    {
+        return false;
+    }
+
+    GLsizei maxInstanceCount = 0;
+    size_t maxIndex          = 0;
+    size_t maxVertexCount    = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] == 0)
+        {
+            continue;
+        }
+
+        const IndexRange &indexRange = indexRanges.value()[drawID];
+
+        // If we use an index greater than our maximum supported index range, return an error.
+        if (static_cast<GLuint64>(indexRange.end) >= context->getCaps().maxElementIndex)
+        {
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorExceedsMaxElement));
+            return false;
+        }
+
+        // Draws whose indices are all primitive restart draw nothing.
+        GLsizei instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        if (indexRange.vertexIndexCount > 0 && instanceCount > 0)
+        {
+            maxInstanceCount = std::max(maxInstanceCount, instanceCount);
+            maxIndex         = std::max(maxIndex, indexRange.end);
+            maxVertexCount   = std::max(maxVertexCount, indexRange.vertexCount());
+        }
+    }
+
+    // No-op if no draw has both indices and instances.
+    if (maxInstanceCount == 0)
+    {
+        return false;
+    }
+
+    return ValidateDrawAttribs(context, maxInstanceCount, static_cast<GLint>(maxIndex),
+                               static_cast<GLint>(maxVertexCount));
+}
+
 bool ValidReadPixelsFormatType(ValidationContext *context,
                                GLenum framebufferComponentType,
                                GLenum format,
@@ -189,14 +490,13 @@ bool ValidateTextureWrapModeValue(Context *context, ParamType *params, bool isEx
             if (isExternalTextureTarget)
             {
                 // OES_EGL_image_external specifies this error.
-                context->handleError(Error(
-                    GL_INVALID_ENUM, "external textures only support CLAMP_TO_EDGE wrap mode"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorExternalTextureWrapMode));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -221,15 +521,13 @@ bool ValidateTextureMinFilterValue(Context *context,
             if (isExternalTextureTarget)
             {
                 // OES_EGL_image_external specifies this error.
-                context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "external textures only support NEAREST and LINEAR filtering"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorExternalTextureFilter));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -246,7 +544,7 @@ bool ValidateTextureMagFilterValue(Context *context, ParamType *params)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -264,7 +562,7 @@ bool ValidateTextureCompareModeValue(Context *context, ParamType *params)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -288,7 +586,7 @@ bool ValidateTextureCompareFuncValue(Context *context, ParamType *params)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -300,7 +598,7 @@ bool ValidateTextureSRGBDecodeValue(Context *context, ParamType *params)
 {
     if (!context->getExtensions().textureSRGBDecode)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "GL_EXT_texture_sRGB_decode is not enabled."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorTextureSRGBDecodeNotEnabled));
         return false;
     }
 
@@ -311,7 +609,7 @@ bool ValidateTextureSRGBDecodeValue(Context *context, ParamType *params)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
             return false;
     }
 
@@ -327,14 +625,13 @@ bool ValidateSamplerParameterBase(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Context does not support OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
         return false;
     }
 
     if (!context->isSampler(sampler))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Sampler is not valid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidSampler));
         return false;
     }
 
@@ -398,7 +695,7 @@ bool ValidateSamplerParameterBase(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -417,14 +714,13 @@ bool ValidateGetSamplerParameterBase(Context *context,
 
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Context does not support OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
         return false;
     }
 
     if (!context->isSampler(sampler))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Sampler is not valid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidSampler));
         return false;
     }
 
@@ -444,14 +740,13 @@ bool ValidateGetSamplerParameterBase(Context *context,
         case GL_TEXTURE_SRGB_DECODE_EXT:
             if (!context->getExtensions().textureSRGBDecode)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_EXT_texture_sRGB_decode is not enabled."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTextureSRGBDecodeNotEnabled));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -475,8 +770,7 @@ bool ValidateGetActiveUniformBlockivBase(Context *context,
 
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Context does not support OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
         return false;
     }
 
@@ -488,8 +782,7 @@ bool ValidateGetActiveUniformBlockivBase(Context *context,
 
     if (uniformBlockIndex >= programObject->getActiveUniformBlockCount())
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "uniformBlockIndex exceeds active uniform block count."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorIndexExceedsActiveUniformBlockCount));
         return false;
     }
 
@@ -505,7 +798,7 @@ bool ValidateGetActiveUniformBlockivBase(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -540,15 +833,14 @@ bool ValidateGetInternalFormativBase(Context *context,
 
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Context does not support OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
         return false;
     }
 
     const TextureCaps &formatCaps = context->getTextureCaps().get(internalformat);
     if (!formatCaps.renderable)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Internal format is not renderable."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInternalFormatNotRenderable));
         return false;
     }
 
@@ -560,20 +852,19 @@ bool ValidateGetInternalFormativBase(Context *context,
         case GL_TEXTURE_2D_MULTISAMPLE:
             if (context->getClientVersion() < ES_3_1)
             {
-                context->handleError(
-                    Error(GL_INVALID_OPERATION, "Texture target requires at least OpenGL ES 3.1."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorTextureTargetRequiresES31));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid target."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTarget));
             return false;
     }
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
@@ -589,7 +880,7 @@ bool ValidateGetInternalFormativBase(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -606,7 +897,7 @@ bool ValidateUniformCommonBase(ValidationContext *context,
                                gl::Program *program,
                                GLint location,
                                GLsizei count,
-                               const LinkedUniform **uniformOut)
+                               const UniformLocationRecord **recordOut)
 {
     // TODO(Jiajia): Add image uniform check in future.
     if (count < 0)
@@ -627,54 +918,65 @@ bool ValidateUniformCommonBase(ValidationContext *context,
         return false;
     }
 
-    const auto &uniformLocations = program->getUniformLocations();
-    size_t castedLocation        = static_cast<size_t>(location);
-    if (castedLocation >= uniformLocations.size())
+    const auto &uniformLocationRecords = program->getUniformLocationRecords();
+    size_t castedLocation              = static_cast<size_t>(location);
+    if (castedLocation >= uniformLocationRecords.size())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Invalid uniform location"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidUniformLocation));
         return false;
     }
 
-    const auto &uniformLocation = uniformLocations[castedLocation];
-    if (uniformLocation.ignored)
+    const UniformLocationRecord &record = uniformLocationRecords[castedLocation];
+    if (record.ignored)
     {
         // Silently ignore the uniform command
         return false;
     }
 
-    if (!uniformLocation.used)
+    if (!record.used)
     {
         context->handleError(Error(GL_INVALID_OPERATION));
         return false;
     }
 
-    const auto &uniform = program->getUniformByIndex(uniformLocation.index);
-
     // attempting to write an array to a non-array uniform is an INVALID_OPERATION
-    if (!uniform.isArray() && count > 1)
+    if (!record.isArray && count > 1)
     {
         context->handleError(Error(GL_INVALID_OPERATION));
         return false;
     }
 
-    *uniformOut = &uniform;
+    *recordOut = &record;
     return true;
 }
 
+bool ValidateUniformValue(ValidationContext *context,
+                          GLenum valueType,
+                          const UniformLocationRecord &record)
+{
+    // Check that the value type is compatible with uniform type.
+    if ((record.valueTypeMask & UniformValueTypeBit(valueType)) != 0)
+    {
+        return true;
+    }
+
+    context->handleError(Error(GL_INVALID_OPERATION, kErrorUniformTypeMismatch));
+    return false;
+}
+
 bool ValidateUniform1ivValue(ValidationContext *context,
-                             GLenum uniformType,
+                             const UniformLocationRecord &record,
                              GLsizei count,
                              const GLint *value)
 {
     // Value type is GL_INT, because we only get here from glUniform1i{v}.
-    // It is compatible with INT or BOOL.
-    // Do these cheap tests first, for a little extra speed.
-    if (GL_INT == uniformType || GL_BOOL == uniformType)
+    // It is compatible with INT, BOOL and the sampler types.
+    if (!ValidateUniformValue(context, GL_INT, record))
     {
-        return true;
+        return false;
     }
 
-    if (IsSamplerType(uniformType))
+    if (record.isSampler)
     {
         // Check that the values are in range.
         const GLint max = context->getCaps().maxCombinedTextureImageUnits;
@@ -682,40 +984,13 @@ bool ValidateUniform1ivValue(ValidationContext *context,
         {
             if (value[i] < 0 || value[i] >= max)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "sampler uniform value out of range"));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorSamplerUniformValueOutOfRange));
                 return false;
             }
         }
-        return true;
     }
 
-    context->handleError(Error(GL_INVALID_OPERATION, "wrong type of value for uniform"));
-    return false;
-}
-
-bool ValidateUniformValue(ValidationContext *context, GLenum valueType, GLenum uniformType)
-{
-    // Check that the value type is compatible with uniform type.
-    // Do the cheaper test first, for a little extra speed.
-    if (valueType == uniformType || VariableBoolVectorType(valueType) == uniformType)
-    {
-        return true;
-    }
-
-    context->handleError(Error(GL_INVALID_OPERATION, "wrong type of value for uniform"));
-    return false;
-}
-
-bool ValidateUniformMatrixValue(ValidationContext *context, GLenum valueType, GLenum uniformType)
-{
-    // Check that the value type is compatible with uniform type.
-    if (valueType == uniformType)
-    {
-        return true;
-    }
-
-    context->handleError(Error(GL_INVALID_OPERATION, "wrong type of value for uniform"));
-    return false;
+    return true;
 }
 
 bool ValidateFragmentShaderColorBufferTypeMatch(ValidationContext *context)
@@ -730,9 +1005,7 @@ bool ValidateFragmentShaderColorBufferTypeMatch(ValidationContext *context)
         GLenum inputType  = framebuffer->getDrawbufferWriteType(drawBufferIdx);
         if (outputType != GL_NONE && inputType != GL_NONE && inputType != outputType)
         {
-            context->handleError(Error(GL_INVALID_OPERATION,
-                                       "Fragment shader output type does not match the bound "
-                                       "framebuffer attachment type."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorFragmentOutputTypeMismatch));
             return false;
         }
     }
@@ -756,9 +1029,7 @@ bool ValidateVertexShaderAttributeTypeMatch(ValidationContext *context)
 
         if (shaderInputType != GL_NONE && vertexType != GL_NONE && shaderInputType != vertexType)
         {
-            context->handleError(Error(
-                GL_INVALID_OPERATION,
-                "Vertex shader input type does not match the type of the bound vertex attribute."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexInputTypeMismatch));
             return false;
         }
     }
@@ -853,7 +1124,7 @@ bool ValidateDrawElementsInstancedBase(ValidationContext *context,
 {
     if (primcount < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "primcount cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativePrimcount));
         return false;
     }
 
@@ -874,7 +1145,7 @@ bool ValidateDrawArraysInstancedBase(Context *context,
 {
     if (primcount < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "primcount cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativePrimcount));
         return false;
     }
 
@@ -906,8 +1177,7 @@ bool ValidateDrawInstancedANGLEAndWebGL(ValidationContext *context)
         }
     }
 
-    context->handleError(
-        Error(GL_INVALID_OPERATION, "At least one attribute must have a divisor of zero."));
+    context->handleError(Error(GL_INVALID_OPERATION, kErrorNoZeroDivisor));
     return false;
 }
 
@@ -1219,8 +1489,7 @@ bool ValidImageDataSize(ValidationContext *context,
         ASSERT(imageSize >= 0);
         if (pixels == nullptr && imageSize != 0)
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "imageSize must be 0 if no texture data is provided."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorNonZeroImageSizeWithoutData));
             return false;
         }
 
@@ -1274,8 +1543,7 @@ bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
     constexpr GLsizei kMaxWebGLStride = 255;
     if (stride > kMaxWebGLStride)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Stride is over the maximum stride allowed by WebGL."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorStrideExceedsWebGLLimit));
         return false;
     }
 
@@ -1290,15 +1558,13 @@ bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
     size_t sizeMask = (typeSize - 1);
     if ((reinterpret_cast<intptr_t>(ptr) & sizeMask) != 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Offset is not a multiple of the type size."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMisalignedOffset));
         return false;
     }
 
     if ((stride & sizeMask) != 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Stride is not a multiple of the type size."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMisalignedStride));
         return false;
     }
 
@@ -1318,12 +1584,11 @@ Program *GetValidProgram(ValidationContext *context, GLuint id)
     {
         if (context->getShader(id))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Expected a program name, but found a shader name"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorExpectedProgramName));
         }
         else
         {
-            context->handleError(Error(GL_INVALID_VALUE, "Program name is not valid"));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorProgramDoesNotExist));
         }
     }
 
@@ -1340,12 +1605,11 @@ Shader *GetValidShader(ValidationContext *context, GLuint id)
     {
         if (context->getProgram(id))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Expected a shader name, but found a program name"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorExpectedShaderName));
         }
         else
         {
-            context->handleError(Error(GL_INVALID_VALUE, "Shader name is invalid"));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorShaderDoesNotExist));
         }
     }
 
@@ -1465,8 +1729,7 @@ bool ValidateFramebufferRenderbufferParameters(gl::Context *context,
     ASSERT(framebuffer);
     if (framebuffer->id() == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Cannot change default FBO's attachments"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultFramebufferAttachment));
         return false;
     }
 
@@ -1611,18 +1874,15 @@ bool ValidateBlitFramebufferParameters(ValidationContext *context,
 
                         if (readFixedOrFloat != drawFixedOrFloat)
                         {
-                            context->handleError(Error(GL_INVALID_OPERATION,
-                                                       "If the read buffer contains fixed-point or "
-                                                       "floating-point values, the draw buffer "
-                                                       "must as well."));
+                            context->handleError(
+                                Error(GL_INVALID_OPERATION, kErrorBlitMixedFixedAndFloat));
                             return false;
                         }
                     }
                     else if (readFixedPoint != drawFixedPoint)
                     {
-                        context->handleError(Error(GL_INVALID_OPERATION,
-                                                   "If the read buffer contains fixed-point "
-                                                   "values, the draw buffer must as well."));
+                        context->handleError(
+                            Error(GL_INVALID_OPERATION, kErrorBlitMixedFixedPoint));
                         return false;
                     }
 
@@ -1649,9 +1909,7 @@ bool ValidateBlitFramebufferParameters(ValidationContext *context,
                     if (context->getExtensions().webglCompatibility &&
                         *readColorBuffer == *attachment)
                     {
-                        context->handleError(
-                            Error(GL_INVALID_OPERATION,
-                                  "Read and write color attachments cannot be the same image."));
+                        context->handleError(Error(GL_INVALID_OPERATION, kErrorBlitSameColorImage));
                         return false;
                     }
                 }
@@ -1671,9 +1929,7 @@ bool ValidateBlitFramebufferParameters(ValidationContext *context,
         // situation is an application error that would lead to a crash in ANGLE.
         else if (drawFramebuffer->hasEnabledDrawBuffer())
         {
-            context->handleError(Error(
-                GL_INVALID_OPERATION,
-                "Attempt to read from a missing color attachment of a complete framebuffer."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorMissingReadColorAttachment));
             return false;
         }
     }
@@ -1705,18 +1961,16 @@ bool ValidateBlitFramebufferParameters(ValidationContext *context,
 
                 if (context->getExtensions().webglCompatibility && *readBuffer == *drawBuffer)
                 {
-                    context->handleError(Error(
-                        GL_INVALID_OPERATION,
-                        "Read and write depth stencil attachments cannot be the same image."));
+                    context->handleError(
+                        Error(GL_INVALID_OPERATION, kErrorBlitSameDepthStencilImage));
                     return false;
                 }
             }
             // WebGL 2.0 BlitFramebuffer when blitting from a missing attachment
             else if (drawBuffer)
             {
-                context->handleError(Error(GL_INVALID_OPERATION,
-                                           "Attempt to read from a missing depth/stencil "
-                                           "attachment of a complete framebuffer."));
+                context->handleError(
+                    Error(GL_INVALID_OPERATION, kErrorMissingReadDepthStencilAttachment));
                 return false;
             }
         }
@@ -1769,7 +2023,7 @@ bool ValidateReadnPixelsEXT(Context *context,
 {
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize must be a positive number"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNonPositiveBufSize));
         return false;
     }
 
@@ -1814,7 +2068,7 @@ bool ValidateGenQueriesEXT(gl::Context *context, GLsizei n)
     if (!context->getExtensions().occlusionQueryBoolean &&
         !context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -1826,7 +2080,7 @@ bool ValidateDeleteQueriesEXT(gl::Context *context, GLsizei n)
     if (!context->getExtensions().occlusionQueryBoolean &&
         !context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -1837,13 +2091,13 @@ bool ValidateBeginQueryBase(gl::Context *context, GLenum target, GLuint id)
 {
     if (!ValidQueryType(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid query target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryTarget));
         return false;
     }
 
     if (id == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query id is 0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryIdZero));
         return false;
     }
 
@@ -1865,7 +2119,7 @@ bool ValidateBeginQueryBase(gl::Context *context, GLenum target, GLuint id)
 
     if (context->getGLState().isQueryActive(target))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Other query is active"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOtherQueryIsActive));
         return false;
     }
 
@@ -1874,14 +2128,14 @@ bool ValidateBeginQueryBase(gl::Context *context, GLenum target, GLuint id)
     // check that name was obtained with glGenQueries
     if (!queryObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Invalid query id"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidQueryId));
         return false;
     }
 
     // check for type mismatch
     if (queryObject->getType() != target)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query type does not match target"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryTypeMismatch));
         return false;
     }
 
@@ -1893,7 +2147,7 @@ bool ValidateBeginQueryEXT(gl::Context *context, GLenum target, GLuint id)
     if (!context->getExtensions().occlusionQueryBoolean &&
         !context->getExtensions().disjointTimerQuery && !context->getExtensions().syncQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -1904,7 +2158,7 @@ bool ValidateEndQueryBase(gl::Context *context, GLenum target)
 {
     if (!ValidQueryType(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid query target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryTarget));
         return false;
     }
 
@@ -1912,7 +2166,7 @@ bool ValidateEndQueryBase(gl::Context *context, GLenum target)
 
     if (queryObject == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query target not active"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryTargetNotActive));
         return false;
     }
 
@@ -1924,7 +2178,7 @@ bool ValidateEndQueryEXT(gl::Context *context, GLenum target)
     if (!context->getExtensions().occlusionQueryBoolean &&
         !context->getExtensions().disjointTimerQuery && !context->getExtensions().syncQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -1935,26 +2189,26 @@ bool ValidateQueryCounterEXT(Context *context, GLuint id, GLenum target)
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Disjoint timer query not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDisjointTimerQueryNotEnabled));
         return false;
     }
 
     if (target != GL_TIMESTAMP_EXT)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid query target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryTarget));
         return false;
     }
 
     Query *queryObject = context->getQuery(id, true, target);
     if (queryObject == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Invalid query id"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidQueryId));
         return false;
     }
 
     if (context->getGLState().isQueryActive(queryObject))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query is active"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryActive));
         return false;
     }
 
@@ -1970,7 +2224,7 @@ bool ValidateGetQueryivBase(Context *context, GLenum target, GLenum pname, GLsiz
 
     if (!ValidQueryType(context, target) && target != GL_TIMESTAMP_EXT)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid query type"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryType));
         return false;
     }
 
@@ -1979,8 +2233,7 @@ bool ValidateGetQueryivBase(Context *context, GLenum target, GLenum pname, GLsiz
         case GL_CURRENT_QUERY_EXT:
             if (target == GL_TIMESTAMP_EXT)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "Cannot use current query for timestamp"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTimestampQueryCurrent));
                 return false;
             }
             break;
@@ -1988,12 +2241,12 @@ bool ValidateGetQueryivBase(Context *context, GLenum target, GLenum pname, GLsiz
             if (!context->getExtensions().disjointTimerQuery ||
                 (target != GL_TIMESTAMP_EXT && target != GL_TIME_ELAPSED_EXT))
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Invalid pname"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryPname));
                 return false;
             }
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid pname"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidQueryPname));
             return false;
     }
 
@@ -2011,7 +2264,7 @@ bool ValidateGetQueryivEXT(Context *context, GLenum target, GLenum pname, GLint
     if (!context->getExtensions().occlusionQueryBoolean &&
         !context->getExtensions().disjointTimerQuery && !context->getExtensions().syncQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -2054,13 +2307,13 @@ bool ValidateGetQueryObjectValueBase(Context *context, GLuint id, GLenum pname,
 
     if (!queryObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query does not exist"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryDoesNotExist));
         return false;
     }
 
     if (context->getGLState().isQueryActive(queryObject))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query currently active"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryObjectActive));
         return false;
     }
 
@@ -2071,7 +2324,7 @@ bool ValidateGetQueryObjectValueBase(Context *context, GLuint id, GLenum pname,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid pname enum"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPnameEnum));
             return false;
     }
 
@@ -2087,7 +2340,7 @@ bool ValidateGetQueryObjectivEXT(Context *context, GLuint id, GLenum pname, GLin
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
     return ValidateGetQueryObjectValueBase(context, id, pname, nullptr);
@@ -2102,7 +2355,7 @@ bool ValidateGetQueryObjectivRobustANGLE(Context *context,
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
 
@@ -2129,7 +2382,7 @@ bool ValidateGetQueryObjectuivEXT(Context *context, GLuint id, GLenum pname, GLu
     if (!context->getExtensions().disjointTimerQuery &&
         !context->getExtensions().occlusionQueryBoolean && !context->getExtensions().syncQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
     return ValidateGetQueryObjectValueBase(context, id, pname, nullptr);
@@ -2145,7 +2398,7 @@ bool ValidateGetQueryObjectuivRobustANGLE(Context *context,
     if (!context->getExtensions().disjointTimerQuery &&
         !context->getExtensions().occlusionQueryBoolean && !context->getExtensions().syncQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryExtensionNotEnabled));
         return false;
     }
 
@@ -2171,7 +2424,7 @@ bool ValidateGetQueryObjecti64vEXT(Context *context, GLuint id, GLenum pname, GL
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
     return ValidateGetQueryObjectValueBase(context, id, pname, nullptr);
@@ -2186,7 +2439,7 @@ bool ValidateGetQueryObjecti64vRobustANGLE(Context *context,
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
 
@@ -2212,7 +2465,7 @@ bool ValidateGetQueryObjectui64vEXT(Context *context, GLuint id, GLenum pname, G
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
     return ValidateGetQueryObjectValueBase(context, id, pname, nullptr);
@@ -2227,7 +2480,7 @@ bool ValidateGetQueryObjectui64vRobustANGLE(Context *context,
 {
     if (!context->getExtensions().disjointTimerQuery)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Timer query extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTimerQueryNotEnabled));
         return false;
     }
 
@@ -2262,10 +2515,10 @@ bool ValidateProgramUniform(gl::Context *context,
         return false;
     }
 
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = GetValidProgram(context, program);
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniformValue(context, valueType, uniform->type);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = GetValidProgram(context, program);
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniformValue(context, valueType, *record);
 }
 
 bool ValidateProgramUniform1iv(gl::Context *context,
@@ -2281,10 +2534,10 @@ bool ValidateProgramUniform1iv(gl::Context *context,
         return false;
     }
 
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = GetValidProgram(context, program);
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniform1ivValue(context, uniform->type, count, value);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = GetValidProgram(context, program);
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniform1ivValue(context, *record, count, value);
 }
 
 bool ValidateProgramUniformMatrix(gl::Context *context,
@@ -2301,10 +2554,10 @@ bool ValidateProgramUniformMatrix(gl::Context *context,
         return false;
     }
 
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = GetValidProgram(context, program);
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniformMatrixValue(context, valueType, uniform->type);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = GetValidProgram(context, program);
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniformValue(context, valueType, *record);
 }
 
 bool ValidateUniform(ValidationContext *context, GLenum valueType, GLint location, GLsizei count)
@@ -2316,10 +2569,10 @@ bool ValidateUniform(ValidationContext *context, GLenum valueType, GLint locatio
         return false;
     }
 
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = context->getGLState().getProgram();
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniformValue(context, valueType, uniform->type);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = context->getGLState().getProgram();
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniformValue(context, valueType, *record);
 }
 
 bool ValidateUniform1iv(ValidationContext *context,
@@ -2327,10 +2580,10 @@ bool ValidateUniform1iv(ValidationContext *context,
                         GLsizei count,
                         const GLint *value)
 {
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = context->getGLState().getProgram();
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniform1ivValue(context, uniform->type, count, value);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = context->getGLState().getProgram();
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniform1ivValue(context, *record, count, value);
 }
 
 bool ValidateUniformMatrix(ValidationContext *context,
@@ -2354,10 +2607,10 @@ bool ValidateUniformMatrix(ValidationContext *context,
         return false;
     }
 
-    const LinkedUniform *uniform = nullptr;
-    gl::Program *programObject   = context->getGLState().getProgram();
-    return ValidateUniformCommonBase(context, programObject, location, count, &uniform) &&
-           ValidateUniformMatrixValue(context, valueType, uniform->type);
+    const UniformLocationRecord *record = nullptr;
+    gl::Program *programObject          = context->getGLState().getProgram();
+    return ValidateUniformCommonBase(context, programObject, location, count, &record) &&
+           ValidateUniformValue(context, valueType, *record);
 }
 
 bool ValidateStateQuery(ValidationContext *context,
@@ -2395,9 +2648,7 @@ bool ValidateStateQuery(ValidationContext *context,
             if (!context->getExtensions().eglStreamConsumerExternal &&
                 !context->getExtensions().eglImageExternal)
             {
-                context->handleError(Error(GL_INVALID_ENUM,
-                                           "Neither NV_EGL_stream_consumer_external nor "
-                                           "GL_OES_EGL_image_external extensions enabled"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorExternalTextureNotEnabled));
                 return false;
             }
             break;
@@ -2417,7 +2668,7 @@ bool ValidateStateQuery(ValidationContext *context,
 
             if (framebuffer->getReadBufferState() == GL_NONE)
             {
-                context->handleError(Error(GL_INVALID_OPERATION, "Read buffer is GL_NONE"));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorReadBufferNone));
                 return false;
             }
 
@@ -2523,7 +2774,7 @@ bool ValidateCopyTexImageParametersBase(ValidationContext *context,
 
     if (readFramebuffer->getReadBufferState() == GL_NONE)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Read buffer is GL_NONE"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorReadBufferNone));
         return false;
     }
 
@@ -2533,7 +2784,7 @@ bool ValidateCopyTexImageParametersBase(ValidationContext *context,
     // situation is an application error that would lead to a crash in ANGLE.
     if (readFramebuffer->getReadColorbuffer() == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Missing read attachment"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMissingReadAttachment));
         return false;
     }
 
@@ -2634,9 +2885,7 @@ bool ValidateCopyTexImageParametersBase(ValidationContext *context,
     {
         if (readFramebuffer->formsCopyingFeedbackLoopWith(texture->id(), level, zoffset))
         {
-            context->handleError(Error(GL_INVALID_OPERATION,
-                                       "Texture copying feedback loop formed between Framebuffer "
-                                       "and specified Texture level."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyFeedbackLoop));
             return false;
         }
     }
@@ -2738,9 +2987,7 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         if (uniformBuffer.get() == nullptr)
         {
             // undefined behaviour
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "It is undefined behaviour to have a used but unbound uniform buffer."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorUniformBufferUnbound));
             return false;
         }
 
@@ -2754,9 +3001,7 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         if (uniformBufferSize < uniformBlock.dataSize)
         {
             // undefined behaviour
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "It is undefined behaviour to use a uniform buffer that is too small."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorUniformBufferTooSmall));
             return false;
         }
     }
@@ -2767,9 +3012,7 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         // Detect rendering feedback loops for WebGL.
         if (framebuffer->formsRenderingFeedbackLoopWith(state))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "Rendering feedback loop formed between Framebuffer and active Texture."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorFeedbackLoop));
             return false;
         }
 
@@ -2828,7 +3071,7 @@ bool ValidateDrawArraysCommon(ValidationContext *context,
     int64_t maxVertex = static_cast<int64_t>(first) + static_cast<int64_t>(count) - 1;
     if (maxVertex > static_cast<int64_t>(std::numeric_limits<GLint>::max()))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Integer overflow."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIntegerOverflow));
         return false;
     }
 
@@ -2846,6 +3089,12 @@ bool ValidateDrawArraysInstanced(Context *context,
                                  GLsizei count,
                                  GLsizei primcount)
 {
+    if (context->getClientMajorVersion() < 3)
+    {
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
+        return false;
+    }
+
     if (!ValidateDrawArraysInstancedBase(context, mode, first, count, primcount))
     {
         return false;
@@ -2924,95 +3173,13 @@ bool ValidateDrawElementsCommon(ValidationContext *context,
     // Check for mapped buffers
     if (state.hasMappedBuffer(GL_ELEMENT_ARRAY_BUFFER))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Index buffer is mapped."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIndexBufferMapped));
         return false;
     }
 
-    const gl::VertexArray *vao     = state.getVertexArray();
-    gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
-
-    GLuint typeBytes = gl::GetTypeInfo(type).bytes;
-
-    if (context->getExtensions().webglCompatibility)
+    if (!ValidateDrawElementsIndices(context, count, type, indices))
     {
-        ASSERT(isPow2(typeBytes) && typeBytes > 0);
-        if ((reinterpret_cast<uintptr_t>(indices) & static_cast<uintptr_t>(typeBytes - 1)) != 0)
-        {
-            // [WebGL 1.0] Section 6.4 Buffer Offset and Stride Requirements
-            // The offset arguments to drawElements and [...], must be a multiple of the size of the
-            // data type passed to the call, or an INVALID_OPERATION error is generated.
-            context->handleError(Error(GL_INVALID_OPERATION,
-                                       "indices must be a multiple of the element type size."));
-            return false;
-        }
-
-        // [WebGL 1.0] Section 6.4 Buffer Offset and Stride Requirements
-        // In addition the offset argument to drawElements must be non-negative or an INVALID_VALUE
-        // error is generated.
-        if (reinterpret_cast<intptr_t>(indices) < 0)
-        {
-            context->handleError(Error(GL_INVALID_VALUE, "Offset < 0."));
-            return false;
-        }
-    }
-
-    if (context->getExtensions().webglCompatibility ||
-        !context->getGLState().areClientArraysEnabled())
-    {
-        if (!elementArrayBuffer && count > 0)
-        {
-            // [WebGL 1.0] Section 6.2 No Client Side Arrays
-            // If drawElements is called with a count greater than zero, and no WebGLBuffer is bound
-            // to the ELEMENT_ARRAY_BUFFER binding point, an INVALID_OPERATION error is generated.
-            context->handleError(Error(GL_INVALID_OPERATION,
-                                       "There is no element array buffer bound and count > 0."));
-            return false;
-        }
-    }
-
-    if (count > 0)
-    {
-        if (elementArrayBuffer)
-        {
-            // The max possible type size is 8 and count is on 32 bits so doing the multiplication
-            // in a 64 bit integer is safe. Also we are guaranteed that here count > 0.
-            static_assert(std::is_same<int, GLsizei>::value, "GLsizei isn't the expected type");
-            constexpr uint64_t kMaxTypeSize = 8;
-            constexpr uint64_t kIntMax      = std::numeric_limits<int>::max();
-            constexpr uint64_t kUint64Max   = std::numeric_limits<uint64_t>::max();
-            static_assert(kIntMax < kUint64Max / kMaxTypeSize, "");
-
-            uint64_t typeSize     = typeBytes;
-            uint64_t elementCount = static_cast<uint64_t>(count);
-            ASSERT(elementCount > 0 && typeSize <= kMaxTypeSize);
-
-            // Doing the multiplication here is overflow-safe
-            uint64_t elementDataSizeNoOffset = typeSize * elementCount;
-
-            // The offset can be any value, check for overflows
-            uint64_t offset = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(indices));
-            if (elementDataSizeNoOffset > kUint64Max - offset)
-            {
-                context->handleError(Error(GL_INVALID_OPERATION, "Integer overflow."));
-                return false;
-            }
-
-            uint64_t elementDataSizeWithOffset = elementDataSizeNoOffset + offset;
-            if (elementDataSizeWithOffset > static_cast<uint64_t>(elementArrayBuffer->getSize()))
-            {
-                context->handleError(
-                    Error(GL_INVALID_OPERATION, "Index buffer is not big enough for the draw."));
-                return false;
-            }
-        }
-        else if (!indices)
-        {
-            // This is an application error that would normally result in a crash,
-            // but we catch it and return an error
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "No element array buffer and no pointer."));
-            return false;
-        }
+        return false;
     }
 
     // Use the parameter buffer to retrieve and cache the index range.
@@ -3031,7 +3198,7 @@ bool ValidateDrawElementsCommon(ValidationContext *context,
     // return an error if possible here.
     if (static_cast<GLuint64>(indexRangeOpt.value().end) >= context->getCaps().maxElementIndex)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, g_ExceedsMaxElementErrorMessage));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExceedsMaxElement));
         return false;
     }
 
@@ -3076,6 +3243,64 @@ bool ValidateDrawElementsInstancedANGLE(Context *context,
     return ValidateDrawInstancedANGLEAndWebGL(context);
 }
 
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount)
+{
+    return ValidateMultiDrawArraysCommon(context, mode, firsts, counts, nullptr, drawcount);
+}
+
+bool ValidateMultiDrawArraysInstancedANGLE(Context *context,
+                                           GLenum mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount)
+{
+    if (!ValidateMultiDrawInstanced(context) ||
+        !ValidateMultiDrawArraysCommon(context, mode, firsts, counts, instanceCounts, drawcount))
+    {
+        return false;
+    }
+
+    return (context->getClientMajorVersion() >= 3 &&
+            !context->getExtensions().webglCompatibility) ||
+           ValidateDrawInstancedANGLEAndWebGL(context);
+}
+
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const void *const *indices,
+                                    GLsizei drawcount)
+{
+    return ValidateMultiDrawElementsCommon(context, mode, counts, type, indices, nullptr,
+                                           drawcount);
+}
+
+bool ValidateMultiDrawElementsInstancedANGLE(Context *context,
+                                             GLenum mode,
+                                             const GLsizei *counts,
+                                             GLenum type,
+                                             const void *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount)
+{
+    if (!ValidateMultiDrawInstanced(context) ||
+        !ValidateMultiDrawElementsCommon(context, mode, counts, type, indices, instanceCounts,
+                                         drawcount))
+    {
+        return false;
+    }
+
+    return (context->getClientMajorVersion() >= 3 &&
+            !context->getExtensions().webglCompatibility) ||
+           ValidateDrawInstancedANGLEAndWebGL(context);
+}
+
 bool ValidateFramebufferTextureBase(Context *context,
                                     GLenum target,
                                     GLenum attachment,
@@ -3115,8 +3340,7 @@ bool ValidateFramebufferTextureBase(Context *context,
 
     if (framebuffer->id() == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Cannot change default FBO's attachments"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultFramebufferAttachment));
         return false;
     }
 
@@ -3170,7 +3394,7 @@ static bool ValidateSizedGetUniform(Context *context,
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
@@ -3259,8 +3483,7 @@ bool ValidateGetUniformuivRobustANGLE(Context *context,
 
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Entry point requires at least OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorEntryPointRequiresES3));
         return false;
     }
 
@@ -3276,7 +3499,7 @@ bool ValidateDiscardFramebufferBase(Context *context,
 {
     if (numAttachments < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "numAttachments must not be less than zero"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeNumAttachments));
         return false;
     }
 
@@ -3286,16 +3509,15 @@ bool ValidateDiscardFramebufferBase(Context *context,
         {
             if (defaultFramebuffer)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM, "Invalid attachment when the default framebuffer is bound"));
+                context->handleError(
+                    Error(GL_INVALID_ENUM, kErrorInvalidDefaultFramebufferAttachment));
                 return false;
             }
 
             if (attachments[i] >= GL_COLOR_ATTACHMENT0 + context->getCaps().maxColorAttachments)
             {
-                context->handleError(Error(GL_INVALID_OPERATION,
-                                           "Requested color attachment is greater than the maximum "
-                                           "supported color attachments"));
+                context->handleError(
+                    Error(GL_INVALID_OPERATION, kErrorColorAttachmentIndexTooLarge));
                 return false;
             }
         }
@@ -3309,8 +3531,7 @@ bool ValidateDiscardFramebufferBase(Context *context,
                     if (defaultFramebuffer)
                     {
                         context->handleError(
-                            Error(GL_INVALID_ENUM,
-                                  "Invalid attachment when the default framebuffer is bound"));
+                            Error(GL_INVALID_ENUM, kErrorInvalidDefaultFramebufferAttachment));
                         return false;
                     }
                     break;
@@ -3320,13 +3541,12 @@ bool ValidateDiscardFramebufferBase(Context *context,
                     if (!defaultFramebuffer)
                     {
                         context->handleError(
-                            Error(GL_INVALID_ENUM,
-                                  "Invalid attachment when the default framebuffer is not bound"));
+                            Error(GL_INVALID_ENUM, kErrorInvalidUserFramebufferAttachment));
                         return false;
                     }
                     break;
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Invalid attachment"));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidAttachment));
                     return false;
             }
         }
@@ -3385,35 +3605,32 @@ bool ValidateEGLImageTargetTexture2DOES(Context *context,
         case GL_TEXTURE_2D:
             if (!context->getExtensions().eglImage)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM, "GL_TEXTURE_2D texture target requires GL_OES_EGL_image."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorEGLImage2DTargetNotEnabled));
             }
             break;
 
         case GL_TEXTURE_EXTERNAL_OES:
             if (!context->getExtensions().eglImageExternal)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM,
-                    "GL_TEXTURE_EXTERNAL_OES texture target requires GL_OES_EGL_image_external."));
+                context->handleError(
+                    Error(GL_INVALID_ENUM, kErrorEGLImageExternalTargetNotEnabled));
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid texture target."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidEGLImageTextureTarget));
             return false;
     }
 
     if (!display->isValidImage(image))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "EGL image is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidEGLImage));
         return false;
     }
 
     if (image->getSamples() > 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION,
-                                   "cannot create a 2D texture from a multisampled EGL image."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorEGLImageMultisampledTexture));
         return false;
     }
 
@@ -3421,8 +3638,7 @@ bool ValidateEGLImageTargetTexture2DOES(Context *context,
         context->getTextureCaps().get(image->getFormat().info->sizedInternalFormat);
     if (!textureCaps.texturable)
     {
-        context->handleError(Error(GL_INVALID_OPERATION,
-                                   "EGL image internal format is not supported as a texture."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorEGLImageNotTexturable));
         return false;
     }
 
@@ -3446,13 +3662,13 @@ bool ValidateEGLImageTargetRenderbufferStorageOES(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid renderbuffer target."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidEGLImageRenderbufferTarget));
             return false;
     }
 
     if (!display->isValidImage(image))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "EGL image is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidEGLImage));
         return false;
     }
 
@@ -3460,8 +3676,7 @@ bool ValidateEGLImageTargetRenderbufferStorageOES(Context *context,
         context->getTextureCaps().get(image->getFormat().info->sizedInternalFormat);
     if (!textureCaps.renderable)
     {
-        context->handleError(Error(
-            GL_INVALID_OPERATION, "EGL image internal format is not supported as a renderbuffer."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorEGLImageNotRenderable));
         return false;
     }
 
@@ -3497,16 +3712,15 @@ bool ValidateProgramBinaryBase(Context *context,
     if (std::find(programBinaryFormats.begin(), programBinaryFormats.end(), binaryFormat) ==
         programBinaryFormats.end())
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Program binary format is not valid."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidProgramBinaryFormat));
         return false;
     }
 
     if (context->hasActiveTransformFeedback(program))
     {
         // ES 3.0.4 section 2.15 page 91
-        context->handleError(Error(GL_INVALID_OPERATION,
-                                   "Cannot change program binary while program is associated with "
-                                   "an active transform feedback object."));
+        context->handleError(
+            Error(GL_INVALID_OPERATION, kErrorProgramBinaryDuringTransformFeedback));
         return false;
     }
 
@@ -3528,13 +3742,13 @@ bool ValidateGetProgramBinaryBase(Context *context,
 
     if (!programObject->isLinked())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Program is not linked."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorProgramIsNotLinked));
         return false;
     }
 
     if (context->getCaps().programBinaryFormats.empty())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No program binary formats supported."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoProgramBinaryFormats));
         return false;
     }
 
@@ -3546,8 +3760,7 @@ bool ValidateDrawBuffersBase(ValidationContext *context, GLsizei n, const GLenum
     // INVALID_VALUE is generated if n is negative or greater than value of MAX_DRAW_BUFFERS
     if (n < 0 || static_cast<GLuint>(n) > context->getCaps().maxDrawBuffers)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "n must be non-negative and no greater than MAX_DRAW_BUFFERS"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDrawBufferCountOutOfRange));
         return false;
     }
 
@@ -3571,13 +3784,12 @@ bool ValidateDrawBuffersBase(ValidationContext *context, GLsizei n, const GLenum
             // was changed to GL_INVALID_ENUM in 3.1, which dEQP also expects.
             // 3.1 is still a bit ambiguous about the error, but future specs are
             // expected to clarify that GL_INVALID_ENUM is the correct error.
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer value"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferValue));
             return false;
         }
         else if (bufs[colorAttachment] >= maxColorAttachment)
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Buffer value is greater than MAX_DRAW_BUFFERS"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorDrawBufferIndexExceedsMax));
             return false;
         }
         else if (bufs[colorAttachment] != GL_NONE && bufs[colorAttachment] != attachment &&
@@ -3585,8 +3797,7 @@ bool ValidateDrawBuffersBase(ValidationContext *context, GLsizei n, const GLenum
         {
             // INVALID_OPERATION-GL is bound to buffer and ith argument
             // is not COLOR_ATTACHMENTi or NONE
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Ith value does not match COLOR_ATTACHMENTi or NONE"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidDrawBuffer));
             return false;
         }
     }
@@ -3597,16 +3808,15 @@ bool ValidateDrawBuffersBase(ValidationContext *context, GLsizei n, const GLenum
     {
         if (n != 1)
         {
-            context->handleError(Error(GL_INVALID_OPERATION,
-                                       "n must be 1 when GL is bound to the default framebuffer"));
+            context->handleError(
+                Error(GL_INVALID_OPERATION, kErrorDefaultFramebufferDrawBufferCount));
             return false;
         }
 
         if (bufs[0] != GL_NONE && bufs[0] != GL_BACK)
         {
-            context->handleError(Error(
-                GL_INVALID_OPERATION,
-                "Only NONE or BACK are valid values when drawing to the default framebuffer"));
+            context->handleError(
+                Error(GL_INVALID_OPERATION, kErrorInvalidDefaultFramebufferDrawBuffer));
             return false;
         }
     }
@@ -3627,9 +3837,7 @@ bool ValidateGetBufferPointervBase(Context *context,
 
     if (context->getClientMajorVersion() < 3 && !context->getExtensions().mapBuffer)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Context does not support OpenGL ES 3.0 or GL_OES_mapbuffer is not enabled."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferRequiresES3OrOES));
         return false;
     }
 
@@ -3645,7 +3853,7 @@ bool ValidateGetBufferPointervBase(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -3654,8 +3862,7 @@ bool ValidateGetBufferPointervBase(Context *context,
     // GLES 3.1 section 6.6 explicitly specifies this error.
     if (context->getGLState().getTargetBuffer(target) == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Can not get pointer for reserved buffer name zero."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferZeroPointer));
         return false;
     }
 
@@ -3671,7 +3878,7 @@ bool ValidateUnmapBufferBase(Context *context, GLenum target)
 {
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferTarget));
         return false;
     }
 
@@ -3679,7 +3886,7 @@ bool ValidateUnmapBufferBase(Context *context, GLenum target)
 
     if (buffer == nullptr || !buffer->isMapped())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer not mapped."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferNotMapped));
         return false;
     }
 
@@ -3694,13 +3901,13 @@ bool ValidateMapBufferRangeBase(Context *context,
 {
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferTarget));
         return false;
     }
 
     if (offset < 0 || length < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid offset or length."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidMapRange));
         return false;
     }
 
@@ -3708,7 +3915,7 @@ bool ValidateMapBufferRangeBase(Context *context,
 
     if (!buffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Attempted to map buffer object zero."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferZero));
         return false;
     }
 
@@ -3718,8 +3925,7 @@ bool ValidateMapBufferRangeBase(Context *context,
 
     if (!checkedSize.IsValid() || checkedSize.ValueOrDie() > static_cast<size_t>(buffer->getSize()))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Mapped range does not fit into buffer dimensions."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorMapRangeOutsideBuffer));
         return false;
     }
 
@@ -3736,21 +3942,20 @@ bool ValidateMapBufferRangeBase(Context *context,
 
     if (length == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer mapping length is zero."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferMappingLengthIsZero));
         return false;
     }
 
     if (buffer->isMapped())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer is already mapped."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferAlreadyMapped));
         return false;
     }
 
     // Check for invalid bit combinations
     if ((access & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Need to map buffer for either reading or writing."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferAccessUnspecified));
         return false;
     }
 
@@ -3767,9 +3972,7 @@ bool ValidateMapBufferRangeBase(Context *context,
 
     if ((access & GL_MAP_WRITE_BIT) == 0 && (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0)
     {
-        context->handleError(Error(
-            GL_INVALID_OPERATION,
-            "The explicit flushing bit may only be set if the buffer is mapped for writing."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExplicitFlushWithoutWrite));
         return false;
     }
     return true;
@@ -3782,13 +3985,13 @@ bool ValidateFlushMappedBufferRangeBase(Context *context,
 {
     if (offset < 0 || length < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid offset/length parameters."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidFlushRange));
         return false;
     }
 
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferTarget));
         return false;
     }
 
@@ -3796,14 +3999,13 @@ bool ValidateFlushMappedBufferRangeBase(Context *context,
 
     if (buffer == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Attempted to flush buffer object zero."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorFlushBufferZero));
         return false;
     }
 
     if (!buffer->isMapped() || (buffer->getAccessFlags() & GL_MAP_FLUSH_EXPLICIT_BIT) == 0)
     {
-        context->handleError(Error(
-            GL_INVALID_OPERATION, "Attempted to flush a buffer not mapped for explicit flushing."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorFlushNotExplicitlyMapped));
         return false;
     }
 
@@ -3814,8 +4016,7 @@ bool ValidateFlushMappedBufferRangeBase(Context *context,
     if (!checkedSize.IsValid() ||
         checkedSize.ValueOrDie() > static_cast<size_t>(buffer->getMapLength()))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Flushed range does not fit into buffer mapping dimensions."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorFlushRangeOutsideMapping));
         return false;
     }
 
@@ -3826,7 +4027,7 @@ bool ValidateGenOrDelete(Context *context, GLint n)
 {
     if (n < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "n < 0"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeCount));
         return false;
     }
     return true;
@@ -3836,14 +4037,13 @@ bool ValidateRobustEntryPoint(ValidationContext *context, GLsizei bufSize)
 {
     if (!context->getExtensions().robustClientMemory)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_ANGLE_robust_client_memory is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRobustClientMemoryNotAvailable));
         return false;
     }
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
@@ -4210,9 +4410,7 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         case GL_PROGRAM_BINARY_LENGTH:
             if (context->getClientMajorVersion() < 3 && !context->getExtensions().getProgramBinary)
             {
-                context->handleError(Error(GL_INVALID_ENUM,
-                                           "Querying GL_PROGRAM_BINARY_LENGTH requires "
-                                           "GL_OES_get_program_binary or ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorProgramBinaryLengthQuery));
                 return false;
             }
             break;
@@ -4225,7 +4423,7 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         case GL_PROGRAM_BINARY_RETRIEVABLE_HINT:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Querying requires at least ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorQueryingRequiresES3));
                 return false;
             }
             break;
@@ -4233,13 +4431,13 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         case GL_PROGRAM_SEPARABLE:
             if (context->getClientVersion() < Version(3, 1))
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Querying requires at least ES 3.1."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorQueryingRequiresES31));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown parameter name."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParameterName));
             return false;
     }
 
@@ -4725,14 +4923,13 @@ bool ValidateVertexFormatBase(ValidationContext *context,
     const Caps &caps = context->getCaps();
     if (attribIndex >= caps.maxVertexAttributes)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "attribindex must be smaller than MAX_VERTEX_ATTRIBS."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorAttribIndexExceedsMaxVertexAttribs));
         return false;
     }
 
     if (size < 1 || size > 4)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "size must be between one and four."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidAttribSize));
     }
 
     switch (type)
@@ -4747,8 +4944,7 @@ bool ValidateVertexFormatBase(ValidationContext *context,
         case GL_UNSIGNED_INT:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "Vertex type not supported before OpenGL ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorVertexTypeRequiresES3));
                 return false;
             }
             break;
@@ -4757,7 +4953,7 @@ bool ValidateVertexFormatBase(ValidationContext *context,
         case GL_FLOAT:
             if (pureInteger)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Type is not integer."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTypeNotInteger));
                 return false;
             }
             break;
@@ -4765,13 +4961,12 @@ bool ValidateVertexFormatBase(ValidationContext *context,
         case GL_HALF_FLOAT:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "Vertex type not supported before OpenGL ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorVertexTypeRequiresES3));
                 return false;
             }
             if (pureInteger)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Type is not integer."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTypeNotInteger));
                 return false;
             }
             break;
@@ -4780,26 +4975,23 @@ bool ValidateVertexFormatBase(ValidationContext *context,
         case GL_UNSIGNED_INT_2_10_10_10_REV:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "Vertex type not supported before OpenGL ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorVertexTypeRequiresES3));
                 return false;
             }
             if (pureInteger)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Type is not integer."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTypeNotInteger));
                 return false;
             }
             if (size != 4)
             {
-                context->handleError(Error(GL_INVALID_OPERATION,
-                                           "Type is INT_2_10_10_10_REV or "
-                                           "UNSIGNED_INT_2_10_10_10_REV and size is not 4."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidPackedAttribSize));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid vertex type."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidVertexType));
             return false;
     }
 
@@ -4823,9 +5015,7 @@ bool ValidateWebGLFramebufferAttachmentClearType(ValidationContext *context,
         const GLenum *end    = validComponentTypes + validComponentTypeCount;
         if (std::find(validComponentTypes, end, componentType) == end)
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "No defined conversion between clear value and attachment format."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorClearTypeMismatch));
             return false;
         }
     }
@@ -4867,7 +5057,7 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
 
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferTarget));
         return false;
     }
 
@@ -4875,7 +5065,7 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
     if (!buffer)
     {
         // A null buffer means that "0" is bound to the requested buffer target
-        context->handleError(Error(GL_INVALID_OPERATION, "No buffer bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoBufferBound));
         return false;
     }
 
@@ -4890,8 +5080,7 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
         case GL_BUFFER_ACCESS_OES:
             if (!extensions.mapBuffer)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "pname requires OpenGL ES 3.0 or GL_OES_mapbuffer."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorPnameRequiresES3OrMapBufferOES));
                 return false;
             }
             break;
@@ -4901,9 +5090,7 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
             if (context->getClientMajorVersion() < 3 && !extensions.mapBuffer &&
                 !extensions.mapBufferRange)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM,
-                    "pname requires OpenGL ES 3.0, GL_OES_mapbuffer or GL_EXT_map_buffer_range."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorPnameRequiresES3OrMapBuffer));
                 return false;
             }
             break;
@@ -4911,9 +5098,7 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
         case GL_BUFFER_MAP_POINTER:
             if (!pointerVersion)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "GL_BUFFER_MAP_POINTER can only be queried with GetBufferPointerv."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorBufferMapPointerQuery));
                 return false;
             }
             break;
@@ -4923,14 +5108,14 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
         case GL_BUFFER_MAP_LENGTH:
             if (context->getClientMajorVersion() < 3 && !extensions.mapBufferRange)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM, "pname requires OpenGL ES 3.0 or GL_EXT_map_buffer_range."));
+                context->handleError(
+                    Error(GL_INVALID_ENUM, kErrorPnameRequiresES3OrMapBufferRange));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -4955,14 +5140,14 @@ bool ValidateGetRenderbufferParameterivBase(Context *context,
 
     if (target != GL_RENDERBUFFER)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTarget));
         return false;
     }
 
     Renderbuffer *renderbuffer = context->getGLState().getCurrentRenderbuffer();
     if (renderbuffer == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No renderbuffer bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoRenderbufferBound));
         return false;
     }
 
@@ -4983,13 +5168,13 @@ bool ValidateGetRenderbufferParameterivBase(Context *context,
             if (!context->getExtensions().framebufferMultisample)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_ANGLE_framebuffer_multisample is not enabled."));
+                    Error(GL_INVALID_ENUM, kErrorFramebufferMultisampleNotEnabled));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -5025,13 +5210,13 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
             if (!context->getExtensions().translatedShaderSource)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_ANGLE_translated_shader_source is not enabled."));
+                    Error(GL_INVALID_ENUM, kErrorTranslatedShaderSourceNotEnabled));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -5051,14 +5236,14 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
 
     if (!ValidTextureTarget(context, target) && !ValidTextureExternalTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid texture target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTextureTarget));
         return false;
     }
 
     if (context->getTargetTexture(target) == nullptr)
     {
         // Should only be possible for external textures
-        context->handleError(Error(GL_INVALID_ENUM, "No texture bound."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorNoTextureBound));
         return false;
     }
 
@@ -5073,8 +5258,7 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
         case GL_TEXTURE_USAGE_ANGLE:
             if (!context->getExtensions().textureUsage)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_ANGLE_texture_usage is not enabled."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTextureUsageNotEnabled));
                 return false;
             }
             break;
@@ -5083,7 +5267,7 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
             if (!context->getExtensions().textureFilterAnisotropic)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_EXT_texture_filter_anisotropic is not enabled."));
+                    Error(GL_INVALID_ENUM, kErrorTextureFilterAnisotropicNotEnabled));
                 return false;
             }
             break;
@@ -5091,8 +5275,7 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
         case GL_TEXTURE_IMMUTABLE_FORMAT:
             if (context->getClientMajorVersion() < 3 && !context->getExtensions().textureStorage)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_EXT_texture_storage is not enabled."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTextureStorageNotEnabled));
                 return false;
             }
             break;
@@ -5111,7 +5294,7 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
         case GL_TEXTURE_COMPARE_FUNC:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "pname requires OpenGL ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorPnameRequiresES3));
                 return false;
             }
             break;
@@ -5119,14 +5302,13 @@ bool ValidateGetTexParameterBase(Context *context, GLenum target, GLenum pname,
         case GL_TEXTURE_SRGB_DECODE_EXT:
             if (!context->getExtensions().textureSRGBDecode)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_EXT_texture_sRGB_decode is not enabled."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTextureSRGBDecodeNotEnabled));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -5151,15 +5333,13 @@ bool ValidateGetVertexAttribBase(Context *context,
 
     if (pureIntegerEntryPoint && context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Context does not support OpenGL ES 3.0."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOpenGLES30Required));
         return false;
     }
 
     if (index >= context->getCaps().maxVertexAttributes)
     {
-        context->handleError(Error(
-            GL_INVALID_VALUE, "index must be less than the value of GL_MAX_VERTEX_ATTRIBUTES."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxVertexAttributes));
         return false;
     }
 
@@ -5167,7 +5347,7 @@ bool ValidateGetVertexAttribBase(Context *context,
     {
         if (pname != GL_VERTEX_ATTRIB_ARRAY_POINTER)
         {
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
         }
     }
@@ -5191,9 +5371,8 @@ bool ValidateGetVertexAttribBase(Context *context,
                 if (context->getClientMajorVersion() < 3 &&
                     !context->getExtensions().instancedArrays)
                 {
-                    context->handleError(Error(GL_INVALID_ENUM,
-                                               "GL_VERTEX_ATTRIB_ARRAY_DIVISOR requires OpenGL ES "
-                                               "3.0 or GL_ANGLE_instanced_arrays."));
+                    context->handleError(
+                        Error(GL_INVALID_ENUM, kErrorVertexAttribDivisorQueryNotSupported));
                     return false;
                 }
                 break;
@@ -5201,8 +5380,8 @@ bool ValidateGetVertexAttribBase(Context *context,
             case GL_VERTEX_ATTRIB_ARRAY_INTEGER:
                 if (context->getClientMajorVersion() < 3)
                 {
-                    context->handleError(Error(
-                        GL_INVALID_ENUM, "GL_VERTEX_ATTRIB_ARRAY_INTEGER requires OpenGL ES 3.0."));
+                    context->handleError(
+                        Error(GL_INVALID_ENUM, kErrorVertexAttribIntegerQueryRequiresES3));
                     return false;
                 }
                 break;
@@ -5212,13 +5391,13 @@ bool ValidateGetVertexAttribBase(Context *context,
                 if (context->getClientVersion() < ES_3_1)
                 {
                     context->handleError(
-                        Error(GL_INVALID_ENUM, "Vertex Attrib Bindings require OpenGL ES 3.1."));
+                        Error(GL_INVALID_ENUM, kErrorVertexAttribBindingsRequireES31));
                     return false;
                 }
                 break;
 
             default:
-                context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
                 return false;
         }
     }
@@ -5266,7 +5445,7 @@ bool ValidateReadPixelsBase(ValidationContext *context,
 
     if (width < 0 || height < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "width and height must be positive"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeReadPixelsSize));
         return false;
     }
 
@@ -5289,7 +5468,7 @@ bool ValidateReadPixelsBase(ValidationContext *context,
 
     if (framebuffer->getReadBufferState() == GL_NONE)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Read buffer is GL_NONE"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorReadBufferNone));
         return false;
     }
 
@@ -5300,7 +5479,7 @@ bool ValidateReadPixelsBase(ValidationContext *context,
     // situation is an application error that would lead to a crash in ANGLE.
     if (readBuffer == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Missing read attachment"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMissingReadAttachment));
         return false;
     }
 
@@ -5322,7 +5501,7 @@ bool ValidateReadPixelsBase(ValidationContext *context,
     if (pixelPackBuffer != nullptr && pixelPackBuffer->isMapped())
     {
         // ...the buffer object's data store is currently mapped.
-        context->handleError(Error(GL_INVALID_OPERATION, "Pixel pack buffer is mapped."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPixelPackBufferMapped));
         return false;
     }
 
@@ -5359,8 +5538,7 @@ bool ValidateReadPixelsBase(ValidationContext *context,
         if (checkedEndByte.ValueOrDie() > static_cast<size_t>(pixelPackBuffer->getSize()))
         {
             // Overflow past the end of the buffer
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Writes would overflow the pixel pack buffer."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorPixelPackBufferOverflow));
             return false;
         }
     }
@@ -5422,14 +5600,14 @@ bool ValidateTexParameterBase(Context *context,
 {
     if (!ValidTextureTarget(context, target) && !ValidTextureExternalTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid texture target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTextureTarget));
         return false;
     }
 
     if (context->getTargetTexture(target) == nullptr)
     {
         // Should only be possible for external textures
-        context->handleError(Error(GL_INVALID_ENUM, "No texture bound."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorNoTextureBound));
         return false;
     }
 
@@ -5456,15 +5634,13 @@ bool ValidateTexParameterBase(Context *context,
         case GL_TEXTURE_MAX_LOD:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "pname requires OpenGL ES 3.0."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorPnameRequiresES3));
                 return false;
             }
             if (target == GL_TEXTURE_EXTERNAL_OES &&
                 !context->getExtensions().eglImageExternalEssl3)
             {
-                context->handleError(Error(GL_INVALID_ENUM,
-                                           "ES3 texture parameters are not available without "
-                                           "GL_OES_EGL_image_external_essl3."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorExternalTextureES3Parameters));
                 return false;
             }
             break;
@@ -5506,7 +5682,7 @@ bool ValidateTexParameterBase(Context *context,
                     break;
 
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
                     return false;
             }
             break;
@@ -5514,15 +5690,14 @@ bool ValidateTexParameterBase(Context *context,
         case GL_TEXTURE_MAX_ANISOTROPY_EXT:
             if (!context->getExtensions().textureFilterAnisotropic)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_EXT_texture_anisotropic is not enabled."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorTextureAnisotropicNotEnabled));
                 return false;
             }
 
             // we assume the parameter passed to this validation method is truncated, not rounded
             if (params[0] < 1)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Max anisotropy must be at least 1."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorMaxAnisotropyTooSmall));
                 return false;
             }
             break;
@@ -5561,7 +5736,7 @@ bool ValidateTexParameterBase(Context *context,
                     break;
 
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
                     return false;
             }
             break;
@@ -5569,13 +5744,12 @@ bool ValidateTexParameterBase(Context *context,
         case GL_TEXTURE_BASE_LEVEL:
             if (params[0] < 0)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Base level must be at least 0."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBaseLevel));
                 return false;
             }
             if (target == GL_TEXTURE_EXTERNAL_OES && static_cast<GLuint>(params[0]) != 0)
             {
-                context->handleError(
-                    Error(GL_INVALID_OPERATION, "Base level must be 0 for external textures."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorExternalTextureBaseLevel));
                 return false;
             }
             break;
@@ -5583,7 +5757,7 @@ bool ValidateTexParameterBase(Context *context,
         case GL_TEXTURE_MAX_LEVEL:
             if (params[0] < 0)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Max level must be at least 0."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeMaxLevel));
                 return false;
             }
             break;
@@ -5591,7 +5765,7 @@ bool ValidateTexParameterBase(Context *context,
         case GL_DEPTH_STENCIL_TEXTURE_MODE:
             if (context->getClientVersion() < Version(3, 1))
             {
-                context->handleError(Error(GL_INVALID_ENUM, "pname requires OpenGL ES 3.1."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorPnameRequiresES31));
                 return false;
             }
             switch (ConvertToGLenum(params[0]))
@@ -5601,7 +5775,7 @@ bool ValidateTexParameterBase(Context *context,
                     break;
 
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Unknown param value."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownParamValue));
                     return false;
             }
             break;
@@ -5614,7 +5788,7 @@ bool ValidateTexParameterBase(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
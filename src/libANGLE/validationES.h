@@ -296,6 +296,31 @@ bool ValidateDrawElementsInstancedANGLE(Context *context,
                                         const void *indices,
                                         GLsizei primcount);
 
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount);
+bool ValidateMultiDrawArraysInstancedANGLE(Context *context,
+                                           GLenum mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount);
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const void *const *indices,
+                                    GLsizei drawcount);
+bool ValidateMultiDrawElementsInstancedANGLE(Context *context,
+                                             GLenum mode,
+                                             const GLsizei *counts,
+                                             GLenum type,
+                                             const void *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount);
+
 bool ValidateFramebufferTextureBase(Context *context,
                                     GLenum target,
                                     GLenum attachment,
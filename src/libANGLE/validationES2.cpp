@@ -14,6 +14,7 @@
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Renderbuffer.h"
@@ -75,7 +76,7 @@ bool ValidatePathInstances(gl::Context *context,
         const GLuint pathName = array[i] + pathBase;
         if (context->hasPath(pathName) && !context->hasPathData(pathName))
         {
-            context->handleError(gl::Error(GL_INVALID_OPERATION, "No such path object."));
+            context->handleError(gl::Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
             return false;
         }
     }
@@ -92,26 +93,25 @@ bool ValidateInstancedPathParameters(gl::Context *context,
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            gl::Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(gl::Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
     if (paths == nullptr)
     {
-        context->handleError(gl::Error(GL_INVALID_VALUE, "No path name array."));
+        context->handleError(gl::Error(GL_INVALID_VALUE, kErrorNoPathNameArray));
         return false;
     }
 
     if (numPaths < 0)
     {
-        context->handleError(gl::Error(GL_INVALID_VALUE, "Invalid (negative) numPaths."));
+        context->handleError(gl::Error(GL_INVALID_VALUE, kErrorNegativeNumPaths));
         return false;
     }
 
     if (!angle::IsValueInRangeForNumericType<std::uint32_t>(numPaths))
     {
-        context->handleError(gl::Error(GL_INVALID_OPERATION, "Overflow in numPaths."));
+        context->handleError(gl::Error(GL_INVALID_OPERATION, kErrorNumPathsOverflow));
         return false;
     }
 
@@ -157,7 +157,7 @@ bool ValidateInstancedPathParameters(gl::Context *context,
             break;
 
         default:
-            context->handleError(gl::Error(GL_INVALID_ENUM, "Invalid path name type."));
+            context->handleError(gl::Error(GL_INVALID_ENUM, kErrorInvalidPathNameType));
             return false;
     }
 
@@ -185,12 +185,12 @@ bool ValidateInstancedPathParameters(gl::Context *context,
             componentCount = 12;
             break;
         default:
-            context->handleError(gl::Error(GL_INVALID_ENUM, "Invalid transformation."));
+            context->handleError(gl::Error(GL_INVALID_ENUM, kErrorInvalidTransformation));
             return false;
     }
     if (componentCount != 0 && transformValues == nullptr)
     {
-        context->handleError(gl::Error(GL_INVALID_VALUE, "No transform array given."));
+        context->handleError(gl::Error(GL_INVALID_VALUE, kErrorNoTransformArrayGiven));
         return false;
     }
 
@@ -199,7 +199,7 @@ bool ValidateInstancedPathParameters(gl::Context *context,
     checkedSize += (numPaths * sizeof(GLfloat) * componentCount);
     if (!checkedSize.IsValid())
     {
-        context->handleError(gl::Error(GL_INVALID_OPERATION, "Overflow in num paths."));
+        context->handleError(gl::Error(GL_INVALID_OPERATION, kErrorPathDataSizeOverflow));
         return false;
     }
 
@@ -455,13 +455,13 @@ bool ValidateES2CopyTexImageParameters(ValidationContext *context,
 {
     if (!ValidTexture2DDestinationTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid texture target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTextureTarget));
         return false;
     }
 
     if (!ValidImageSizeParameters(context, target, level, width, height, 1, isSubImage))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid texture dimensions."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidTextureDimensions));
         return false;
     }
 
@@ -697,14 +697,13 @@ bool ValidateES2CopyTexImageParameters(ValidationContext *context,
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "ETC lossy decode formats can't be copied to."));
+                    context->handleError(
+                        Error(GL_INVALID_OPERATION, kErrorLossyETCDecodeCopyDestination));
                     return false;
                 }
                 else
                 {
-                    context->handleError(Error(
-                        GL_INVALID_ENUM, "ANGLE_lossy_etc_decode extension is not supported."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorLossyETCDecodeNotSupported));
                     return false;
                 }
                 break;
@@ -894,7 +893,7 @@ bool ValidateES2TexImageParameters(Context *context,
         const InternalFormat &textureInternalFormat = *texture->getFormat(target, level).info;
         if (textureInternalFormat.internalFormat == GL_NONE)
         {
-            context->handleError(Error(GL_INVALID_OPERATION, "Texture level does not exist."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorTextureLevelUndefined));
             return false;
         }
 
@@ -984,15 +983,13 @@ bool ValidateES2TexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
                 if (!context->getExtensions().lossyETCDecode)
                 {
-                    context->handleError(Error(
-                        GL_INVALID_ENUM, "ANGLE_lossy_etc_decode extension is not supported"));
+                    context->handleError(
+                        Error(GL_INVALID_ENUM, kErrorLossyETCDecodeCompressedNotSupported));
                     return false;
                 }
                 break;
             default:
-                context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "internalformat is not a supported compressed internal format"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorUnsupportedES2CompressedFormat));
                 return false;
         }
 
@@ -1003,14 +1000,13 @@ bool ValidateES2TexImageParameters(Context *context,
                                              texture->getHeight(target, level)))
             {
                 context->handleError(
-                    Error(GL_INVALID_OPERATION, "Invalid compressed format dimension."));
+                    Error(GL_INVALID_OPERATION, kErrorInvalidCompressedFormatDimension));
                 return false;
             }
 
             if (format != actualInternalFormat)
             {
-                context->handleError(Error(
-                    GL_INVALID_OPERATION, "Format must match the internal format of the texture."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorFormatMismatch));
                 return false;
             }
         }
@@ -1019,7 +1015,7 @@ bool ValidateES2TexImageParameters(Context *context,
             if (!ValidCompressedImageSize(context, actualInternalFormat, level, width, height))
             {
                 context->handleError(
-                    Error(GL_INVALID_OPERATION, "Invalid compressed format dimension."));
+                    Error(GL_INVALID_OPERATION, kErrorInvalidCompressedFormatDimension));
                 return false;
             }
         }
@@ -1224,15 +1220,12 @@ bool ValidateES2TexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
-                    context->handleError(
-                        Error(GL_INVALID_OPERATION,
-                              "ETC lossy decode formats can't work with this type."));
+                    context->handleError(Error(GL_INVALID_OPERATION, kErrorLossyETCDecodeType));
                     return false;
                 }
                 else
                 {
-                    context->handleError(Error(
-                        GL_INVALID_ENUM, "ANGLE_lossy_etc_decode extension is not supported."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorLossyETCDecodeNotSupported));
                     return false;
                 }
                 break;
@@ -1397,8 +1390,7 @@ bool ValidateES2TexStorageParameters(Context *context,
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             if (!context->getExtensions().lossyETCDecode)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "ANGLE_lossy_etc_decode extension is not supported."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorLossyETCDecodeNotSupported));
                 return false;
             }
             break;
@@ -1495,7 +1487,7 @@ bool ValidateDiscardFramebufferEXT(Context *context,
 {
     if (!context->getExtensions().discardFramebuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1508,7 +1500,7 @@ bool ValidateDiscardFramebufferEXT(Context *context,
                 (context->getGLState().getTargetFramebuffer(GL_FRAMEBUFFER)->id() == 0);
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid framebuffer target"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDiscardFramebufferTarget));
             return false;
     }
 
@@ -1520,7 +1512,7 @@ bool ValidateBindVertexArrayOES(Context *context, GLuint array)
 {
     if (!context->getExtensions().vertexArrayObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1531,7 +1523,7 @@ bool ValidateDeleteVertexArraysOES(Context *context, GLsizei n)
 {
     if (!context->getExtensions().vertexArrayObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1542,7 +1534,7 @@ bool ValidateGenVertexArraysOES(Context *context, GLsizei n)
 {
     if (!context->getExtensions().vertexArrayObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1553,7 +1545,7 @@ bool ValidateIsVertexArrayOES(Context *context)
 {
     if (!context->getExtensions().vertexArrayObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1568,7 +1560,7 @@ bool ValidateProgramBinaryOES(Context *context,
 {
     if (!context->getExtensions().getProgramBinary)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1584,7 +1576,7 @@ bool ValidateGetProgramBinaryOES(Context *context,
 {
     if (!context->getExtensions().getProgramBinary)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1656,25 +1648,25 @@ bool ValidateDebugMessageControlKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     if (!ValidDebugSource(source, false) && source != GL_DONT_CARE)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug source."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugSource));
         return false;
     }
 
     if (!ValidDebugType(type) && type != GL_DONT_CARE)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug type."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugType));
         return false;
     }
 
     if (!ValidDebugSeverity(severity) && severity != GL_DONT_CARE)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug severity."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugSeverity));
         return false;
     }
 
@@ -1682,17 +1674,14 @@ bool ValidateDebugMessageControlKHR(Context *context,
     {
         if (source == GL_DONT_CARE || type == GL_DONT_CARE)
         {
-            context->handleError(Error(
-                GL_INVALID_OPERATION,
-                "If count is greater than zero, source and severity cannot be GL_DONT_CARE."));
+            context->handleError(
+                Error(GL_INVALID_OPERATION, kErrorDebugMessageControlSourceAndType));
             return false;
         }
 
         if (severity != GL_DONT_CARE)
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "If count is greater than zero, severity must be GL_DONT_CARE."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorDebugMessageControlSeverity));
             return false;
         }
     }
@@ -1710,7 +1699,7 @@ bool ValidateDebugMessageInsertKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1723,27 +1712,26 @@ bool ValidateDebugMessageInsertKHR(Context *context,
 
     if (!ValidDebugSeverity(severity))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug severity."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugSeverity));
         return false;
     }
 
     if (!ValidDebugType(type))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug type."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugType));
         return false;
     }
 
     if (!ValidDebugSource(source, true))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug source."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugSource));
         return false;
     }
 
     size_t messageLength = (length < 0) ? strlen(buf) : length;
     if (messageLength > context->getExtensions().maxDebugMessageLength)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Message length is larger than GL_MAX_DEBUG_MESSAGE_LENGTH."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDebugMessageTooLong));
         return false;
     }
 
@@ -1756,7 +1744,7 @@ bool ValidateDebugMessageCallbackKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1775,14 +1763,13 @@ bool ValidateGetDebugMessageLogKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     if (bufSize < 0 && messageLog != nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "bufSize must be positive if messageLog is not null."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNonPositiveMessageLogBufSize));
         return false;
     }
 
@@ -1797,30 +1784,27 @@ bool ValidatePushDebugGroupKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     if (!ValidDebugSource(source, true))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid debug source."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDebugSource));
         return false;
     }
 
     size_t messageLength = (length < 0) ? strlen(message) : length;
     if (messageLength > context->getExtensions().maxDebugMessageLength)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Message length is larger than GL_MAX_DEBUG_MESSAGE_LENGTH."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDebugMessageTooLong));
         return false;
     }
 
     size_t currentStackSize = context->getGLState().getDebug().getGroupStackDepth();
     if (currentStackSize >= context->getExtensions().maxDebugGroupStackDepth)
     {
-        context->handleError(
-            Error(GL_STACK_OVERFLOW,
-                  "Cannot push more than GL_MAX_DEBUG_GROUP_STACK_DEPTH debug groups."));
+        context->handleError(Error(GL_STACK_OVERFLOW, kErrorDebugGroupStackOverflow));
         return false;
     }
 
@@ -1831,14 +1815,14 @@ bool ValidatePopDebugGroupKHR(Context *context)
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     size_t currentStackSize = context->getGLState().getDebug().getGroupStackDepth();
     if (currentStackSize <= 1)
     {
-        context->handleError(Error(GL_STACK_UNDERFLOW, "Cannot pop the default debug group."));
+        context->handleError(Error(GL_STACK_UNDERFLOW, kErrorPopDefaultDebugGroup));
         return false;
     }
 
@@ -1852,7 +1836,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_BUFFER:
             if (context->getBuffer(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid buffer."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidBufferName));
                 return false;
             }
             return true;
@@ -1860,7 +1844,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_SHADER:
             if (context->getShader(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid shader."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidShaderName));
                 return false;
             }
             return true;
@@ -1868,7 +1852,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_PROGRAM:
             if (context->getProgram(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid program."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidProgramName));
                 return false;
             }
             return true;
@@ -1876,7 +1860,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_VERTEX_ARRAY:
             if (context->getVertexArray(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid vertex array."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidVertexArrayName));
                 return false;
             }
             return true;
@@ -1884,7 +1868,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_QUERY:
             if (context->getQuery(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid query."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidQueryName));
                 return false;
             }
             return true;
@@ -1892,8 +1876,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_TRANSFORM_FEEDBACK:
             if (context->getTransformFeedback(name) == nullptr)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE, "name is not a valid transform feedback."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidTransformFeedbackName));
                 return false;
             }
             return true;
@@ -1901,7 +1884,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_SAMPLER:
             if (context->getSampler(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid sampler."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSamplerName));
                 return false;
             }
             return true;
@@ -1909,7 +1892,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_TEXTURE:
             if (context->getTexture(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid texture."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidTextureName));
                 return false;
             }
             return true;
@@ -1917,7 +1900,7 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_RENDERBUFFER:
             if (context->getRenderbuffer(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid renderbuffer."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidRenderbufferName));
                 return false;
             }
             return true;
@@ -1925,13 +1908,13 @@ static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier,
         case GL_FRAMEBUFFER:
             if (context->getFramebuffer(name) == nullptr)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "name is not a valid framebuffer."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidFramebufferName));
                 return false;
             }
             return true;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid identifier."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidIdentifier));
             return false;
     }
 }
@@ -1954,8 +1937,7 @@ static bool ValidateLabelLength(Context *context, GLsizei length, const GLchar *
 
     if (labelLength > context->getExtensions().maxLabelLength)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Label length is larger than GL_MAX_LABEL_LENGTH."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorLabelTooLong));
         return false;
     }
 
@@ -1970,7 +1952,7 @@ bool ValidateObjectLabelKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -1996,13 +1978,13 @@ bool ValidateGetObjectLabelKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
@@ -2018,7 +2000,7 @@ static bool ValidateObjectPtrName(Context *context, const void *ptr)
 {
     if (context->getFenceSync(reinterpret_cast<GLsync>(const_cast<void *>(ptr))) == nullptr)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "name is not a valid sync."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSyncName));
         return false;
     }
 
@@ -2032,7 +2014,7 @@ bool ValidateObjectPtrLabelKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -2057,13 +2039,13 @@ bool ValidateGetObjectPtrLabelKHR(Context *context,
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
@@ -2079,7 +2061,7 @@ bool ValidateGetPointervKHR(Context *context, GLenum pname, void **params)
 {
     if (!context->getExtensions().debug)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not enabled"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotEnabled));
         return false;
     }
 
@@ -2091,7 +2073,7 @@ bool ValidateGetPointervKHR(Context *context, GLenum pname, void **params)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPname));
             return false;
     }
 
@@ -2112,22 +2094,20 @@ bool ValidateBlitFramebufferANGLE(Context *context,
 {
     if (!context->getExtensions().framebufferBlit)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Blit extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBlitExtensionNotAvailable));
         return false;
     }
 
     if (srcX1 - srcX0 != dstX1 - dstX0 || srcY1 - srcY0 != dstY1 - dstY0)
     {
         // TODO(jmadill): Determine if this should be available on other implementations.
-        context->handleError(Error(
-            GL_INVALID_OPERATION,
-            "Scaling and flipping in BlitFramebufferANGLE not supported by this implementation."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBlitScaleOrFlip));
         return false;
     }
 
     if (filter == GL_LINEAR)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Linear blit not supported in this extension"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorLinearBlitNotSupported));
         return false;
     }
 
@@ -2203,9 +2183,8 @@ bool ValidateBlitFramebufferANGLE(Context *context,
                                   dstX0, dstY0, dstX1, dstY1))
                 {
                     // only whole-buffer copies are permitted
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "Only whole-buffer depth and stencil blits are "
-                                               "supported by this extension."));
+                    context->handleError(
+                        Error(GL_INVALID_OPERATION, kErrorPartialDepthStencilBlit));
                     return false;
                 }
 
@@ -2260,7 +2239,7 @@ bool ValidateDrawBuffersEXT(ValidationContext *context, GLsizei n, const GLenum
 {
     if (!context->getExtensions().drawBuffers)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Extension not supported."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorExtensionNotSupported));
         return false;
     }
 
@@ -2518,13 +2497,13 @@ bool ValidateMapBufferOES(Context *context, GLenum target, GLenum access)
 {
     if (!context->getExtensions().mapBuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Map buffer extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferNotAvailable));
         return false;
     }
 
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBufferTarget));
         return false;
     }
 
@@ -2532,19 +2511,19 @@ bool ValidateMapBufferOES(Context *context, GLenum target, GLenum access)
 
     if (buffer == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Attempted to map buffer object zero."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferZero));
         return false;
     }
 
     if (access != GL_WRITE_ONLY_OES)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Non-write buffer mapping not supported."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorNonWriteMapNotSupported));
         return false;
     }
 
     if (buffer->isMapped())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer is already mapped."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferAlreadyMapped));
         return false;
     }
 
@@ -2555,7 +2534,7 @@ bool ValidateUnmapBufferOES(Context *context, GLenum target)
 {
     if (!context->getExtensions().mapBuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Map buffer extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferNotAvailable));
         return false;
     }
 
@@ -2570,8 +2549,7 @@ bool ValidateMapBufferRangeEXT(Context *context,
 {
     if (!context->getExtensions().mapBufferRange)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Map buffer range extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferRangeNotAvailable));
         return false;
     }
 
@@ -2585,8 +2563,7 @@ bool ValidateFlushMappedBufferRangeEXT(Context *context,
 {
     if (!context->getExtensions().mapBufferRange)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Map buffer range extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorMapBufferRangeNotAvailable));
         return false;
     }
 
@@ -2598,14 +2575,14 @@ bool ValidateBindTexture(Context *context, GLenum target, GLuint texture)
     Texture *textureObject = context->getTexture(texture);
     if (textureObject && textureObject->getTarget() != target && texture != 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Invalid texture"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidTexture));
         return false;
     }
 
     if (!context->getGLState().isBindGeneratesResourceEnabled() &&
         !context->isTextureGenerated(texture))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Texture was not generated"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTextureNotGenerated));
         return false;
     }
 
@@ -2619,7 +2596,7 @@ bool ValidateBindTexture(Context *context, GLenum target, GLuint texture)
         case GL_TEXTURE_2D_ARRAY:
             if (context->getClientMajorVersion() < 3)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "GLES 3.0 disabled"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorES3Disabled));
                 return false;
             }
             break;
@@ -2627,7 +2604,7 @@ bool ValidateBindTexture(Context *context, GLenum target, GLuint texture)
         case GL_TEXTURE_2D_MULTISAMPLE:
             if (context->getClientVersion() < Version(3, 1))
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Context does not support GLES3.1"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorES31NotSupported));
                 return false;
             }
             break;
@@ -2637,12 +2614,12 @@ bool ValidateBindTexture(Context *context, GLenum target, GLuint texture)
                 !context->getExtensions().eglStreamConsumerExternal)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM, "External texture extension not enabled"));
+                    Error(GL_INVALID_ENUM, kErrorExternalTextureExtensionNotEnabled));
                 return false;
             }
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid target"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBindTextureTarget));
             return false;
     }
 
@@ -2656,8 +2633,7 @@ bool ValidateBindUniformLocationCHROMIUM(Context *context,
 {
     if (!context->getExtensions().bindUniformLocation)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_bind_uniform_location is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBindUniformLocationNotAvailable));
         return false;
     }
 
@@ -2669,7 +2645,7 @@ bool ValidateBindUniformLocationCHROMIUM(Context *context,
 
     if (location < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Location cannot be less than 0."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeLocation));
         return false;
     }
 
@@ -2677,9 +2653,7 @@ bool ValidateBindUniformLocationCHROMIUM(Context *context,
     if (static_cast<size_t>(location) >=
         (caps.maxVertexUniformVectors + caps.maxFragmentUniformVectors) * 4)
     {
-        context->handleError(Error(GL_INVALID_VALUE,
-                                   "Location must be less than (MAX_VERTEX_UNIFORM_VECTORS + "
-                                   "MAX_FRAGMENT_UNIFORM_VECTORS) * 4"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorLocationExceedsMaxUniforms));
         return false;
     }
 
@@ -2687,14 +2661,13 @@ bool ValidateBindUniformLocationCHROMIUM(Context *context,
     // shader-related entry points
     if (context->getExtensions().webglCompatibility && !IsValidESSLString(name, strlen(name)))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Uniform name contains invalid characters"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidUniformNameCharacters));
         return false;
     }
 
     if (strncmp(name, "gl_", 3) == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Name cannot start with the reserved \"gl_\" prefix."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorReservedGLPrefix));
         return false;
     }
 
@@ -2706,7 +2679,7 @@ bool ValidateCoverageModulationCHROMIUM(Context *context, GLenum components)
     if (!context->getExtensions().framebufferMixedSamples)
     {
         context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_framebuffer_mixed_samples is not available."));
+            Error(GL_INVALID_OPERATION, kErrorFramebufferMixedSamplesNotAvailable));
         return false;
     }
     switch (components)
@@ -2717,9 +2690,7 @@ bool ValidateCoverageModulationCHROMIUM(Context *context, GLenum components)
         case GL_NONE:
             break;
         default:
-            context->handleError(
-                Error(GL_INVALID_ENUM,
-                      "GLenum components is not one of GL_RGB, GL_RGBA, GL_ALPHA or GL_NONE."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPathFragmentInputComponents));
             return false;
     }
 
@@ -2732,18 +2703,17 @@ bool ValidateMatrix(Context *context, GLenum matrixMode, const GLfloat *matrix)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (matrixMode != GL_PATH_MODELVIEW_CHROMIUM && matrixMode != GL_PATH_PROJECTION_CHROMIUM)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid matrix mode."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidMatrixMode));
         return false;
     }
     if (matrix == nullptr)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Invalid matrix."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidMatrix));
         return false;
     }
     return true;
@@ -2753,13 +2723,12 @@ bool ValidateMatrixMode(Context *context, GLenum matrixMode)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (matrixMode != GL_PATH_MODELVIEW_CHROMIUM && matrixMode != GL_PATH_PROJECTION_CHROMIUM)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid matrix mode."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidMatrixMode));
         return false;
     }
     return true;
@@ -2769,8 +2738,7 @@ bool ValidateGenPaths(Context *context, GLsizei range)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
@@ -2778,13 +2746,13 @@ bool ValidateGenPaths(Context *context, GLsizei range)
     // we add stricter semantic check here and require a non zero positive range.
     if (range <= 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid range."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidRange));
         return false;
     }
 
     if (!angle::IsValueInRangeForNumericType<std::uint32_t>(range))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Range overflow."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRangeOverflow));
         return false;
     }
 
@@ -2795,8 +2763,7 @@ bool ValidateDeletePaths(Context *context, GLuint path, GLsizei range)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
@@ -2804,7 +2771,7 @@ bool ValidateDeletePaths(Context *context, GLuint path, GLsizei range)
     // we add stricter semantic check here and require a non zero positive range.
     if (range <= 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid range."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidRange));
         return false;
     }
 
@@ -2813,7 +2780,7 @@ bool ValidateDeletePaths(Context *context, GLuint path, GLsizei range)
 
     if (!angle::IsValueInRangeForNumericType<std::uint32_t>(range) || !checkedRange.IsValid())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Range overflow."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRangeOverflow));
         return false;
     }
     return true;
@@ -2829,40 +2796,39 @@ bool ValidatePathCommands(Context *context,
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (!context->hasPath(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
         return false;
     }
 
     if (numCommands < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid number of commands."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidNumberOfCommands));
         return false;
     }
     else if (numCommands > 0)
     {
         if (!commands)
         {
-            context->handleError(Error(GL_INVALID_VALUE, "No commands array given."));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorNoCommandsArrayGiven));
             return false;
         }
     }
 
     if (numCoords < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid number of coordinates."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidNumberOfCoordinates));
         return false;
     }
     else if (numCoords > 0)
     {
         if (!coords)
         {
-            context->handleError(Error(GL_INVALID_VALUE, "No coordinate array given."));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorNoCoordinateArrayGiven));
             return false;
         }
     }
@@ -2891,7 +2857,7 @@ bool ValidatePathCommands(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid coordinate type."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoordinateType));
             return false;
     }
 
@@ -2899,7 +2865,7 @@ bool ValidatePathCommands(Context *context,
     checkedSize += (coordTypeSize * numCoords);
     if (!checkedSize.IsValid())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Coord size overflow."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCoordSizeOverflow));
         return false;
     }
 
@@ -2928,13 +2894,13 @@ bool ValidatePathCommands(Context *context,
                 expectedNumCoords += 5;
                 break;
             default:
-                context->handleError(Error(GL_INVALID_ENUM, "Invalid command."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCommand));
                 return false;
         }
     }
     if (expectedNumCoords != numCoords)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid number of coordinates."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidNumberOfCoordinates));
         return false;
     }
 
@@ -2945,13 +2911,12 @@ bool ValidateSetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (!context->hasPath(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
         return false;
     }
 
@@ -2960,7 +2925,7 @@ bool ValidateSetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
         case GL_PATH_STROKE_WIDTH_CHROMIUM:
             if (value < 0.0f)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Invalid stroke width."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidStrokeWidth));
                 return false;
             }
             break;
@@ -2972,7 +2937,7 @@ bool ValidateSetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
                 case GL_ROUND_CHROMIUM:
                     break;
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Invalid end caps."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidEndCaps));
                     return false;
             }
             break;
@@ -2984,13 +2949,13 @@ bool ValidateSetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
                 case GL_ROUND_CHROMIUM:
                     break;
                 default:
-                    context->handleError(Error(GL_INVALID_ENUM, "Invalid join style."));
+                    context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidJoinStyle));
                     return false;
             }
         case GL_PATH_MITER_LIMIT_CHROMIUM:
             if (value < 0.0f)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Invalid miter limit."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidMiterLimit));
                 return false;
             }
             break;
@@ -3000,7 +2965,7 @@ bool ValidateSetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid path parameter."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPathParameter));
             return false;
     }
     return true;
@@ -3010,19 +2975,18 @@ bool ValidateGetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
     if (!context->hasPath(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
         return false;
     }
     if (!value)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "No value array."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNoValueArray));
         return false;
     }
 
@@ -3036,7 +3000,7 @@ bool ValidateGetPathParameter(Context *context, GLuint path, GLenum pname, GLflo
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid path parameter."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPathParameter));
             return false;
     }
 
@@ -3047,8 +3011,7 @@ bool ValidatePathStencilFunc(Context *context, GLenum func, GLint ref, GLuint ma
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
@@ -3064,7 +3027,7 @@ bool ValidatePathStencilFunc(Context *context, GLenum func, GLint ref, GLuint ma
         case GL_NOTEQUAL:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil function."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFunction));
             return false;
     }
 
@@ -3081,13 +3044,12 @@ bool ValidateStencilFillPath(Context *context, GLuint path, GLenum fillMode, GLu
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (context->hasPath(path) && !context->hasPathData(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
         return false;
     }
 
@@ -3097,13 +3059,13 @@ bool ValidateStencilFillPath(Context *context, GLuint path, GLenum fillMode, GLu
         case GL_COUNT_DOWN_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid fill mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFillMode));
             return false;
     }
 
     if (!isPow2(mask + 1))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid stencil bit mask."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidStencilBitMask));
         return false;
     }
 
@@ -3114,13 +3076,12 @@ bool ValidateStencilStrokePath(Context *context, GLuint path, GLint reference, G
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (context->hasPath(path) && !context->hasPathData(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path or path has no data."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoPathOrPathData));
         return false;
     }
 
@@ -3131,13 +3092,12 @@ bool ValidateCoverPath(Context *context, GLuint path, GLenum coverMode)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     if (context->hasPath(path) && !context->hasPathData(path))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such path object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchPathObject));
         return false;
     }
 
@@ -3147,7 +3107,7 @@ bool ValidateCoverPath(Context *context, GLuint path, GLenum coverMode)
         case GL_BOUNDING_BOX_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cover mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoverMode));
             return false;
     }
     return true;
@@ -3177,8 +3137,7 @@ bool ValidateIsPath(Context *context)
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
     return true;
@@ -3204,7 +3163,7 @@ bool ValidateCoverFillPathInstanced(Context *context,
         case GL_BOUNDING_BOX_OF_BOUNDING_BOXES_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cover mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoverMode));
             return false;
     }
 
@@ -3231,7 +3190,7 @@ bool ValidateCoverStrokePathInstanced(Context *context,
         case GL_BOUNDING_BOX_OF_BOUNDING_BOXES_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cover mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoverMode));
             return false;
     }
 
@@ -3259,12 +3218,12 @@ bool ValidateStencilFillPathInstanced(Context *context,
         case GL_COUNT_DOWN_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid fill mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFillMode));
             return false;
     }
     if (!isPow2(mask + 1))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid stencil bit mask."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidStencilBitMask));
         return false;
     }
     return true;
@@ -3311,7 +3270,7 @@ bool ValidateStencilThenCoverFillPathInstanced(Context *context,
         case GL_BOUNDING_BOX_OF_BOUNDING_BOXES_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cover mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoverMode));
             return false;
     }
 
@@ -3321,12 +3280,12 @@ bool ValidateStencilThenCoverFillPathInstanced(Context *context,
         case GL_COUNT_DOWN_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid fill mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFillMode));
             return false;
     }
     if (!isPow2(mask + 1))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid stencil bit mask."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidStencilBitMask));
         return false;
     }
 
@@ -3355,7 +3314,7 @@ bool ValidateStencilThenCoverStrokePathInstanced(Context *context,
         case GL_BOUNDING_BOX_OF_BOUNDING_BOXES_CHROMIUM:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cover mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCoverMode));
             return false;
     }
 
@@ -3369,34 +3328,33 @@ bool ValidateBindFragmentInputLocation(Context *context,
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
     const GLint MaxLocation = context->getCaps().maxVaryingVectors * 4;
     if (location >= MaxLocation)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Location exceeds max varying."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorLocationExceedsMaxVarying));
         return false;
     }
 
     const auto *programObject = context->getProgram(program);
     if (!programObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such program."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchProgram));
         return false;
     }
 
     if (!name)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "No name given."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNoNameGiven));
         return false;
     }
 
     if (angle::BeginsWith(name, "gl_"))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Cannot bind a built-in variable."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBindBuiltInVariable));
         return false;
     }
 
@@ -3412,21 +3370,20 @@ bool ValidateProgramPathFragmentInputGen(Context *context,
 {
     if (!context->getExtensions().pathRendering)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_path_rendering is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorPathRenderingNotAvailable));
         return false;
     }
 
     const auto *programObject = context->getProgram(program);
     if (!programObject || programObject->isFlaggedForDeletion())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such program."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchProgram));
         return false;
     }
 
     if (!programObject->isLinked())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Program is not linked."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorProgramIsNotLinked));
         return false;
     }
 
@@ -3435,7 +3392,7 @@ bool ValidateProgramPathFragmentInputGen(Context *context,
         case GL_NONE:
             if (components != 0)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Invalid components."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidComponents));
                 return false;
             }
             break;
@@ -3445,18 +3402,18 @@ bool ValidateProgramPathFragmentInputGen(Context *context,
         case GL_CONSTANT_CHROMIUM:
             if (components < 1 || components > 4)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Invalid components."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidComponents));
                 return false;
             }
             if (!coeffs)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "No coefficients array given."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorNoCoefficientsArrayGiven));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid gen mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidGenMode));
             return false;
     }
 
@@ -3469,7 +3426,7 @@ bool ValidateProgramPathFragmentInputGen(Context *context,
 
     if (!binding.valid)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No such binding."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoSuchBinding));
         return false;
     }
 
@@ -3491,14 +3448,12 @@ bool ValidateProgramPathFragmentInputGen(Context *context,
                 expectedComponents = 4;
                 break;
             default:
-                context->handleError(
-                    Error(GL_INVALID_OPERATION,
-                          "Fragment input type is not a floating point scalar or vector."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorFragmentInputTypeNotFloat));
                 return false;
         }
         if (expectedComponents != components && genMode != GL_NONE)
         {
-            context->handleError(Error(GL_INVALID_OPERATION, "Unexpected number of components"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorUnexpectedNumberOfComponents));
             return false;
         }
     }
@@ -3519,22 +3474,20 @@ bool ValidateCopyTextureCHROMIUM(Context *context,
 {
     if (!context->getExtensions().copyTexture)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_copy_texture extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyTextureNotAvailable));
         return false;
     }
 
     const Texture *source = context->getTexture(sourceId);
     if (source == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Source texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTexture));
         return false;
     }
 
     if (!IsValidCopyTextureSourceTarget(context, source->getTarget()))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Source texture a valid texture type."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTextureType));
         return false;
     }
 
@@ -3543,7 +3496,7 @@ bool ValidateCopyTextureCHROMIUM(Context *context,
 
     if (!IsValidCopyTextureSourceLevel(context, source->getTarget(), sourceLevel))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Source texture level is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTextureLevel));
         return false;
     }
 
@@ -3551,58 +3504,52 @@ bool ValidateCopyTextureCHROMIUM(Context *context,
     GLsizei sourceHeight = static_cast<GLsizei>(source->getHeight(sourceTarget, sourceLevel));
     if (sourceWidth == 0 || sourceHeight == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "The source level of the source texture must be defined."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSourceLevelUndefined));
         return false;
     }
 
     const InternalFormat &sourceFormat = *source->getFormat(sourceTarget, sourceLevel).info;
     if (!IsValidCopyTextureSourceInternalFormatEnum(sourceFormat.internalFormat))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Source texture internal format is invalid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidSourceTextureFormat));
         return false;
     }
 
     const Texture *dest = context->getTexture(destId);
     if (dest == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Destination texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTexture));
         return false;
     }
 
     if (!IsValidCopyTextureDestinationTarget(context, dest->getTarget(), destTarget))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Destination texture a valid texture type."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTextureType));
         return false;
     }
 
     if (!IsValidCopyTextureDestinationLevel(context, destTarget, destLevel, sourceWidth,
                                             sourceHeight))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Destination texture level is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTextureLevel));
         return false;
     }
 
     if (!IsValidCopyTextureDestinationFormatType(context, internalFormat, destType))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Destination internal format and type combination is not valid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidDestinationFormatAndType));
         return false;
     }
 
     if (IsCubeMapTextureTarget(destTarget) && sourceWidth != sourceHeight)
     {
-        context->handleError(Error(
-            GL_INVALID_VALUE, "Destination width and height must be equal for cube map textures."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorCubeMapDestinationNotSquare));
         return false;
     }
 
     if (dest->getImmutableFormat())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Destination texture is immutable."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDestinationTextureImmutable));
         return false;
     }
 
@@ -3627,22 +3574,20 @@ bool ValidateCopySubTextureCHROMIUM(Context *context,
 {
     if (!context->getExtensions().copyTexture)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_CHROMIUM_copy_texture extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyTextureNotAvailable));
         return false;
     }
 
     const Texture *source = context->getTexture(sourceId);
     if (source == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Source texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTexture));
         return false;
     }
 
     if (!IsValidCopyTextureSourceTarget(context, source->getTarget()))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Source texture a valid texture type."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTextureType));
         return false;
     }
 
@@ -3651,93 +3596,85 @@ bool ValidateCopySubTextureCHROMIUM(Context *context,
 
     if (!IsValidCopyTextureSourceLevel(context, source->getTarget(), sourceLevel))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Source texture level is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTextureLevel));
         return false;
     }
 
     if (source->getWidth(sourceTarget, sourceLevel) == 0 ||
         source->getHeight(sourceTarget, sourceLevel) == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "The source level of the source texture must be defined."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSourceLevelUndefined));
         return false;
     }
 
     if (x < 0 || y < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "x and y cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeXY));
         return false;
     }
 
     if (width < 0 || height < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "width and height cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeSize));
         return false;
     }
 
     if (static_cast<size_t>(x + width) > source->getWidth(sourceTarget, sourceLevel) ||
         static_cast<size_t>(y + height) > source->getHeight(sourceTarget, sourceLevel))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Source texture not large enough to copy from."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSourceTextureTooSmall));
         return false;
     }
 
     const Format &sourceFormat = source->getFormat(sourceTarget, sourceLevel);
     if (!IsValidCopySubTextureSourceInternalFormat(sourceFormat.info->internalFormat))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Source texture internal format is invalid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidSourceTextureFormat));
         return false;
     }
 
     const Texture *dest = context->getTexture(destId);
     if (dest == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Destination texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTexture));
         return false;
     }
 
     if (!IsValidCopyTextureDestinationTarget(context, dest->getTarget(), destTarget))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Destination texture a valid texture type."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTextureType));
         return false;
     }
 
     if (!IsValidCopyTextureDestinationLevel(context, destTarget, destLevel, width, height))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Destination texture level is not valid."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTextureLevel));
         return false;
     }
 
     if (dest->getWidth(destTarget, destLevel) == 0 || dest->getHeight(destTarget, destLevel) == 0)
     {
-        context->handleError(Error(
-            GL_INVALID_VALUE, "The destination level of the destination texture must be defined."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDestinationLevelUndefined));
         return false;
     }
 
     const InternalFormat &destFormat = *dest->getFormat(destTarget, destLevel).info;
     if (!IsValidCopySubTextureDestionationInternalFormat(destFormat.internalFormat))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Destination internal format and type combination is not valid."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidDestinationFormatAndType));
         return false;
     }
 
     if (xoffset < 0 || yoffset < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "xoffset and yoffset cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeXYOffset));
         return false;
     }
 
     if (static_cast<size_t>(xoffset + width) > dest->getWidth(destTarget, destLevel) ||
         static_cast<size_t>(yoffset + height) > dest->getHeight(destTarget, destLevel))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Destination texture not large enough to copy to."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDestinationTextureTooSmall));
         return false;
     }
 
@@ -3748,58 +3685,52 @@ bool ValidateCompressedCopyTextureCHROMIUM(Context *context, GLuint sourceId, GL
 {
     if (!context->getExtensions().copyCompressedTexture)
     {
-        context->handleError(Error(GL_INVALID_OPERATION,
-                                   "GL_CHROMIUM_copy_compressed_texture extension not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyCompressedTextureNotAvailable));
         return false;
     }
 
     const gl::Texture *source = context->getTexture(sourceId);
     if (source == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Source texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSourceTexture));
         return false;
     }
 
     if (source->getTarget() != GL_TEXTURE_2D)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Source texture must be of type GL_TEXTURE_2D."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSourceTextureNot2D));
         return false;
     }
 
     if (source->getWidth(GL_TEXTURE_2D, 0) == 0 || source->getHeight(GL_TEXTURE_2D, 0) == 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Source texture must level 0 defined."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSourceTextureLevelZeroUndefined));
         return false;
     }
 
     const gl::Format &sourceFormat = source->getFormat(GL_TEXTURE_2D, 0);
     if (!sourceFormat.info->compressed)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Source texture must have a compressed internal format."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorSourceTextureNotCompressed));
         return false;
     }
 
     const gl::Texture *dest = context->getTexture(destId);
     if (dest == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Destination texture is not a valid texture object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidDestinationTexture));
         return false;
     }
 
     if (dest->getTarget() != GL_TEXTURE_2D)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Destination texture must be of type GL_TEXTURE_2D."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorDestinationTextureNot2D));
         return false;
     }
 
     if (dest->getImmutableFormat())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Destination cannot be immutable."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDestinationImmutable));
         return false;
     }
 
@@ -3817,14 +3748,13 @@ bool ValidateCreateShader(Context *context, GLenum type)
         case GL_COMPUTE_SHADER:
             if (context->getClientVersion() < Version(3, 1))
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "GL_COMPUTE_SHADER requires OpenGL ES 3.1."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorComputeShaderRequiresES31));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown shader type."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownShaderType));
             return false;
     }
 
@@ -3939,8 +3869,7 @@ bool ValidateRequestExtensionANGLE(ValidationContext *context, const GLchar *nam
 {
     if (!context->getExtensions().requestExtension)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_ANGLE_request_extension is not available."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRequestExtensionNotAvailable));
         return false;
     }
 
@@ -4025,13 +3954,13 @@ bool ValidateBindAttribLocation(ValidationContext *context,
 {
     if (index >= MAX_VERTEX_ATTRIBS)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Index exceeds MAX_VERTEX_ATTRIBS"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxVertexAttribs));
         return false;
     }
 
     if (strncmp(name, "gl_", 3) == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Cannot Bind built-in attributes"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBindBuiltInAttribute));
         return false;
     }
 
@@ -4039,7 +3968,7 @@ bool ValidateBindAttribLocation(ValidationContext *context,
     // shader-related entry points
     if (context->getExtensions().webglCompatibility && !IsValidESSLString(name, strlen(name)))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Attribute name contains invalid characters"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidAttributeNameCharacters));
         return false;
     }
 
@@ -4050,14 +3979,14 @@ bool ValidateBindBuffer(ValidationContext *context, GLenum target, GLuint buffer
 {
     if (!ValidBufferTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid Buffer target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBindBufferTarget));
         return false;
     }
 
     if (!context->getGLState().isBindGeneratesResourceEnabled() &&
         !context->isBufferGenerated(buffer))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer was not generated"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBindBufferNotGenerated));
         return false;
     }
 
@@ -4068,14 +3997,14 @@ bool ValidateBindFramebuffer(ValidationContext *context, GLenum target, GLuint f
 {
     if (!ValidFramebufferTarget(target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid Framebuffer target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBindFramebufferTarget));
         return false;
     }
 
     if (!context->getGLState().isBindGeneratesResourceEnabled() &&
         !context->isFramebufferGenerated(framebuffer))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Framebuffer was not generated"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorFramebufferNotGenerated));
         return false;
     }
 
@@ -4086,14 +4015,14 @@ bool ValidateBindRenderbuffer(ValidationContext *context, GLenum target, GLuint
 {
     if (target != GL_RENDERBUFFER)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid Renderbuffer target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidRenderbufferTarget));
         return false;
     }
 
     if (!context->getGLState().isBindGeneratesResourceEnabled() &&
         !context->isRenderbufferGenerated(renderbuffer))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Renderbuffer was not generated"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRenderbufferNotGenerated));
         return false;
     }
 
@@ -4129,7 +4058,7 @@ bool ValidateBlendEquation(ValidationContext *context, GLenum mode)
 {
     if (!ValidBlendEquationMode(mode))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid blend equation"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBlendEquation));
         return false;
     }
 
@@ -4140,13 +4069,13 @@ bool ValidateBlendEquationSeparate(ValidationContext *context, GLenum modeRGB, G
 {
     if (!ValidBlendEquationMode(modeRGB))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid RGB blend equation"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidRGBBlendEquation));
         return false;
     }
 
     if (!ValidBlendEquationMode(modeAlpha))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid alpha blend equation"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidAlphaBlendEquation));
         return false;
     }
 
@@ -4220,25 +4149,25 @@ bool ValidateBlendFuncSeparate(ValidationContext *context,
 {
     if (!ValidSrcBlendFunc(srcRGB))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid blend function"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBlendFunction));
         return false;
     }
 
     if (!ValidDstBlendFunc(dstRGB, context->getClientMajorVersion()))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid blend function"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBlendFunction));
         return false;
     }
 
     if (!ValidSrcBlendFunc(srcAlpha))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid blend function"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBlendFunction));
         return false;
     }
 
     if (!ValidDstBlendFunc(dstAlpha, context->getClientMajorVersion()))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid blend function"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBlendFunction));
         return false;
     }
 
@@ -4292,13 +4221,13 @@ bool ValidateGetString(Context *context, GLenum name)
         case GL_REQUESTABLE_EXTENSIONS_ANGLE:
             if (!context->getExtensions().requestExtension)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Invalid name."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidName));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid name."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidName));
             return false;
     }
 
@@ -4309,7 +4238,7 @@ bool ValidateLineWidth(ValidationContext *context, GLfloat width)
 {
     if (width <= 0.0f || isNaN(width))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid width value."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidWidthValue));
         return false;
     }
 
@@ -4331,7 +4260,7 @@ bool ValidateVertexAttribPointer(ValidationContext *context,
 
     if (stride < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "stride cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeStride));
         return false;
     }
 
@@ -4340,15 +4269,14 @@ bool ValidateVertexAttribPointer(ValidationContext *context,
     {
         if (stride > caps.maxVertexAttribStride)
         {
-            context->handleError(
-                Error(GL_INVALID_VALUE, "stride cannot be greater than MAX_VERTEX_ATTRIB_STRIDE."));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorStrideExceedsMaxVertexAttribStride));
             return false;
         }
 
         if (index >= caps.maxVertexAttribBindings)
         {
             context->handleError(
-                Error(GL_INVALID_VALUE, "index must be smaller than MAX_VERTEX_ATTRIB_BINDINGS."));
+                Error(GL_INVALID_VALUE, kErrorVertexAttribIndexExceedsMaxBindings));
             return false;
         }
     }
@@ -4361,9 +4289,7 @@ bool ValidateVertexAttribPointer(ValidationContext *context,
                              context->getGLState().getVertexArray()->id() == 0;
     if (!nullBufferAllowed && context->getGLState().getArrayBufferId() == 0 && ptr != nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Client data cannot be used with a non-default vertex array object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorClientDataWithVertexArrayObject));
         return false;
     }
 
@@ -4373,7 +4299,7 @@ bool ValidateVertexAttribPointer(ValidationContext *context,
         // The WebGL API does not support the GL_FIXED data type.
         if (type == GL_FIXED)
         {
-            context->handleError(Error(GL_INVALID_ENUM, "GL_FIXED is not supported in WebGL."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorFixedNotSupportedInWebGL));
             return false;
         }
 
@@ -4390,7 +4316,7 @@ bool ValidateDepthRangef(ValidationContext *context, GLfloat zNear, GLfloat zFar
 {
     if (context->getExtensions().webglCompatibility && zNear > zFar)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Depth near > far."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDepthRangeInverted));
         return false;
     }
 
@@ -4416,8 +4342,7 @@ bool ValidateRenderbufferStorageMultisampleANGLE(ValidationContext *context,
 {
     if (!context->getExtensions().framebufferMultisample)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GL_ANGLE_framebuffer_multisample not available"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorFramebufferMultisampleNotAvailable));
         return false;
     }
 
@@ -4452,7 +4377,7 @@ bool ValidateCheckFramebufferStatus(ValidationContext *context, GLenum target)
 {
     if (!ValidFramebufferTarget(target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid Framebuffer target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidBindFramebufferTarget));
         return false;
     }
 
@@ -4507,7 +4432,7 @@ bool ValidateCullFace(ValidationContext *context, GLenum mode)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid cull face parameter"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCullFaceParameter));
             return false;
     }
 
@@ -4525,13 +4450,12 @@ bool ValidateDeleteProgram(ValidationContext *context, GLuint program)
     {
         if (context->getShader(program))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Shader handle passed to DeleteProgram"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorDeleteProgramWithShader));
             return false;
         }
         else
         {
-            context->handleError(Error(GL_INVALID_VALUE, "Invalid program handle"));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidProgramHandle));
             return false;
         }
     }
@@ -4550,13 +4474,12 @@ bool ValidateDeleteShader(ValidationContext *context, GLuint shader)
     {
         if (context->getProgram(shader))
         {
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Program handle passed to DeleteShader"));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorDeleteShaderWithProgram));
             return false;
         }
         else
         {
-            context->handleError(Error(GL_INVALID_VALUE, "Invalid shader handle"));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidShaderHandle));
             return false;
         }
     }
@@ -4579,7 +4502,7 @@ bool ValidateDepthFunc(ValidationContext *context, GLenum func)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid depth function"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDepthFunction));
             return false;
     }
 
@@ -4631,7 +4554,7 @@ bool ValidateDetachShader(ValidationContext *context, GLuint program, GLuint sha
 
     if (attachedShader != shaderObject)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Cannot detach non-attached shader."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDetachNonAttachedShader));
         return false;
     }
 
@@ -4642,7 +4565,7 @@ bool ValidateDisableVertexAttribArray(ValidationContext *context, GLuint index)
 {
     if (index >= MAX_VERTEX_ATTRIBS)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Attrib array index out of range"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorAttribArrayIndexOutOfRange));
         return false;
     }
 
@@ -4653,7 +4576,7 @@ bool ValidateEnableVertexAttribArray(ValidationContext *context, GLuint index)
 {
     if (index >= MAX_VERTEX_ATTRIBS)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Attrib array index out of range"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorAttribArrayIndexOutOfRange));
         return false;
     }
 
@@ -4678,7 +4601,7 @@ bool ValidateFrontFace(ValidationContext *context, GLenum mode)
         case GL_CCW:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid mode for FrontFace"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFrontFaceMode));
             return false;
     }
 
@@ -4696,7 +4619,7 @@ bool ValidateGetActiveAttrib(ValidationContext *context,
 {
     if (bufsize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufsize must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufsize));
         return false;
     }
 
@@ -4709,8 +4632,7 @@ bool ValidateGetActiveAttrib(ValidationContext *context,
 
     if (index >= static_cast<GLuint>(programObject->getActiveAttributeCount()))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "index exeeds program active attribute count."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorIndexExceedsActiveAttributeCount));
         return false;
     }
 
@@ -4728,7 +4650,7 @@ bool ValidateGetActiveUniform(ValidationContext *context,
 {
     if (bufsize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufsize must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufsize));
         return false;
     }
 
@@ -4741,8 +4663,7 @@ bool ValidateGetActiveUniform(ValidationContext *context,
 
     if (index >= static_cast<GLuint>(programObject->getActiveUniformCount()))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "index exceeds program active uniform count."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorIndexExceedsActiveUniformCount));
         return false;
     }
 
@@ -4757,7 +4678,7 @@ bool ValidateGetAttachedShaders(ValidationContext *context,
 {
     if (maxcount < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "max count must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeMaxCount));
         return false;
     }
 
@@ -4777,7 +4698,7 @@ bool ValidateGetAttribLocation(ValidationContext *context, GLuint program, const
     // shader-related entry points
     if (context->getExtensions().webglCompatibility && !IsValidESSLString(name, strlen(name)))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Attribute name contains invalid characters"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidAttributeNameCharacters));
         return false;
     }
 
@@ -4790,7 +4711,7 @@ bool ValidateGetAttribLocation(ValidationContext *context, GLuint program, const
 
     if (!programObject->isLinked())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "program not linked."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorAttribLocationProgramNotLinked));
         return false;
     }
 
@@ -4831,7 +4752,7 @@ bool ValidateGetProgramInfoLog(ValidationContext *context,
 {
     if (bufsize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufsize must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufsize));
         return false;
     }
 
@@ -4852,7 +4773,7 @@ bool ValidateGetShaderInfoLog(ValidationContext *context,
 {
     if (bufsize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufsize must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufsize));
         return false;
     }
 
@@ -4877,11 +4798,10 @@ bool ValidateGetShaderPrecisionFormat(ValidationContext *context,
         case GL_FRAGMENT_SHADER:
             break;
         case GL_COMPUTE_SHADER:
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "compute shader precision not yet implemented."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorComputeShaderPrecision));
             return false;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid shader type."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidShaderType));
             return false;
     }
 
@@ -4896,7 +4816,7 @@ bool ValidateGetShaderPrecisionFormat(ValidationContext *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid precision type."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPrecisionType));
             return false;
     }
 
@@ -4911,7 +4831,7 @@ bool ValidateGetShaderSource(ValidationContext *context,
 {
     if (bufsize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufsize must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufsize));
         return false;
     }
 
@@ -4935,7 +4855,7 @@ bool ValidateGetUniformLocation(ValidationContext *context, GLuint program, cons
     // shader-related entry points
     if (context->getExtensions().webglCompatibility && !IsValidESSLString(name, strlen(name)))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Uniform name contains invalid characters"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidUniformNameCharacters));
         return false;
     }
 
@@ -4948,7 +4868,7 @@ bool ValidateGetUniformLocation(ValidationContext *context, GLuint program, cons
 
     if (!programObject->isLinked())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "program is not linked."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorUniformLocationProgramNotLinked));
         return false;
     }
 
@@ -4965,7 +4885,7 @@ bool ValidateHint(ValidationContext *context, GLenum target, GLenum mode)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid hint mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidHintMode));
             return false;
     }
 
@@ -4978,13 +4898,13 @@ bool ValidateHint(ValidationContext *context, GLenum target, GLenum mode)
             if (!context->getExtensions().standardDerivatives)
             {
                 context->handleError(
-                    Error(GL_INVALID_OPERATION, "hint requires OES_standard_derivatives."));
+                    Error(GL_INVALID_OPERATION, kErrorHintRequiresStandardDerivatives));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "invalid hint target."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidHintTarget));
             return false;
     }
 
@@ -5056,7 +4976,7 @@ bool ValidatePixelStorei(ValidationContext *context, GLenum pname, GLint param)
 
     if (param < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Cannot use negative values in PixelStorei"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativePixelStoreValue));
         return false;
     }
 
@@ -5116,8 +5036,7 @@ bool ValidateScissor(ValidationContext *context, GLint x, GLint y, GLsizei width
 {
     if (width < 0 || height < 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Scissor width and height must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeScissorSize));
         return false;
     }
 
@@ -5135,7 +5054,7 @@ bool ValidateShaderBinary(ValidationContext *context,
     if (std::find(shaderBinaryFormats.begin(), shaderBinaryFormats.end(), binaryformat) ==
         shaderBinaryFormats.end())
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid shader binary format."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidShaderBinaryFormat));
         return false;
     }
 
@@ -5150,7 +5069,7 @@ bool ValidateShaderSource(ValidationContext *context,
 {
     if (count < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Count must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeShaderSourceCount));
         return false;
     }
 
@@ -5163,8 +5082,7 @@ bool ValidateShaderSource(ValidationContext *context,
             size_t len = length ? static_cast<size_t>(length[i]) : strlen(string[i]);
             if (!IsValidESSLString(string[i], len))
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE, "Shader source contains invalid characters"));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidShaderSourceCharacters));
                 return false;
             }
         }
@@ -5183,7 +5101,7 @@ bool ValidateStencilFunc(ValidationContext *context, GLenum func, GLint ref, GLu
 {
     if (!IsValidStencilFunc(func))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil function."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFunction));
         return false;
     }
 
@@ -5198,13 +5116,13 @@ bool ValidateStencilFuncSeparate(ValidationContext *context,
 {
     if (!IsValidStencilFace(face))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil face."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFace));
         return false;
     }
 
     if (!IsValidStencilFunc(func))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil function."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFunction));
         return false;
     }
 
@@ -5220,7 +5138,7 @@ bool ValidateStencilMaskSeparate(ValidationContext *context, GLenum face, GLuint
 {
     if (!IsValidStencilFace(face))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil face."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFace));
         return false;
     }
 
@@ -5231,19 +5149,19 @@ bool ValidateStencilOp(ValidationContext *context, GLenum fail, GLenum zfail, GL
 {
     if (!IsValidStencilOp(fail))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil fail op."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFailOp));
         return false;
     }
 
     if (!IsValidStencilOp(zfail))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil z fail op."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilZFailOp));
         return false;
     }
 
     if (!IsValidStencilOp(zpass))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil z pass op."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilZPassOp));
         return false;
     }
 
@@ -5258,7 +5176,7 @@ bool ValidateStencilOpSeparate(ValidationContext *context,
 {
     if (!IsValidStencilFace(face))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid stencil face."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidStencilFace));
         return false;
     }
 
@@ -5393,7 +5311,7 @@ bool ValidateVertexAttribIndex(ValidationContext *context, GLuint index)
 {
     if (index >= MAX_VERTEX_ATTRIBS)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Vertex attrib index out of range."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorVertexAttribIndexOutOfRange));
         return false;
     }
 
@@ -5453,8 +5371,7 @@ bool ValidateViewport(ValidationContext *context, GLint x, GLint y, GLsizei widt
 {
     if (width < 0 || height < 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Viewport width and height must be non-negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeViewportSize));
         return false;
     }
 
@@ -5555,7 +5472,7 @@ bool ValidateDisable(Context *context, GLenum cap)
 {
     if (!ValidCap(context, cap, false))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid cap."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCap));
         return false;
     }
 
@@ -5566,7 +5483,7 @@ bool ValidateEnable(Context *context, GLenum cap)
 {
     if (!ValidCap(context, cap, false))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid cap."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCap));
         return false;
     }
 
@@ -5641,8 +5558,7 @@ bool ValidateFramebufferTexture2D(Context *context,
                 }
                 if (tex->getTarget() != GL_TEXTURE_2D)
                 {
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "Textarget must match the texture target type."));
+                    context->handleError(Error(GL_INVALID_OPERATION, kErrorTextargetMismatch));
                     return false;
                 }
             }
@@ -5662,8 +5578,7 @@ bool ValidateFramebufferTexture2D(Context *context,
                 }
                 if (tex->getTarget() != GL_TEXTURE_CUBE_MAP)
                 {
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "Textarget must match the texture target type."));
+                    context->handleError(Error(GL_INVALID_OPERATION, kErrorTextargetMismatch));
                     return false;
                 }
             }
@@ -5673,21 +5588,19 @@ bool ValidateFramebufferTexture2D(Context *context,
             {
                 if (context->getClientVersion() < ES_3_1)
                 {
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "Texture target requires at least OpenGL ES 3.1."));
+                    context->handleError(
+                        Error(GL_INVALID_OPERATION, kErrorTextureTargetRequiresES31));
                     return false;
                 }
 
                 if (level != 0)
                 {
-                    context->handleError(
-                        Error(GL_INVALID_VALUE, "Level must be 0 for TEXTURE_2D_MULTISAMPLE."));
+                    context->handleError(Error(GL_INVALID_VALUE, kErrorMultisampleTextureLevel));
                     return false;
                 }
                 if (tex->getTarget() != GL_TEXTURE_2D_MULTISAMPLE)
                 {
-                    context->handleError(Error(GL_INVALID_OPERATION,
-                                               "Textarget must match the texture target type."));
+                    context->handleError(Error(GL_INVALID_OPERATION, kErrorTextargetMismatch));
                     return false;
                 }
             }
@@ -5779,8 +5692,7 @@ bool ValidateGenerateMipmap(Context *context, GLenum target)
         context->getClientVersion() >= ES_3_0 || context->getExtensions().webglCompatibility;
     if (!supportsSRGBMipmapGeneration && format.info->colorEncoding == GL_SRGB)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Mipmap generation of sRGB textures is not allowed."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorGenerateMipmapSRGB));
         return false;
     }
 
@@ -5864,7 +5776,7 @@ bool ValidateIsEnabled(Context *context, GLenum cap)
 {
     if (!ValidCap(context, cap, true))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid cap."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCap));
         return false;
     }
 
@@ -5876,9 +5788,7 @@ bool ValidateLinkProgram(Context *context, GLuint program)
     if (context->hasActiveTransformFeedback(program))
     {
         // ES 3.0.4 section 2.15 page 91
-        context->handleError(Error(GL_INVALID_OPERATION,
-                                   "Cannot link program while program is associated with an active "
-                                   "transform feedback object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorLinkProgramDuringTransformFeedback));
         return false;
     }
 
@@ -5934,29 +5844,25 @@ bool ValidateUseProgram(Context *context, GLuint program)
             // ES 3.1.0 section 7.3 page 72
             if (context->getShader(program))
             {
-                context->handleError(
-                    Error(GL_INVALID_OPERATION,
-                          "Attempted to use a single shader instead of a shader program."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorShaderInsteadOfProgram));
                 return false;
             }
             else
             {
-                context->handleError(Error(GL_INVALID_VALUE, "Program invalid."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorProgramInvalid));
                 return false;
             }
         }
         if (!programObject->isLinked())
         {
-            context->handleError(Error(GL_INVALID_OPERATION, "Program not linked."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorProgramNotLinked));
             return false;
         }
     }
     if (context->getGLState().isTransformFeedbackActiveUnpaused())
     {
         // ES 3.0.4 section 2.15 page 91
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Cannot change active program while transform feedback is unpaused."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorUseProgramDuringTransformFeedback));
         return false;
     }
 
@@ -12,6 +12,7 @@
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/Renderbuffer.h"
@@ -34,13 +35,13 @@ static bool ValidateTexImageFormatCombination(gl::Context *context,
     // The type and format are valid if any supported internal format has that type and format
     if (!ValidES3Format(format))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid format."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFormat));
         return false;
     }
 
     if (!ValidES3Type(type))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid type."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidType));
         return false;
     }
 
@@ -50,7 +51,7 @@ static bool ValidateTexImageFormatCombination(gl::Context *context,
     // the validation codepaths for glTexImage2D/3D, we record a GL_INVALID_VALUE error.
     if (!ValidES3InternalFormat(internalFormat))
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid internalFormat."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidInternalFormat));
         return false;
     }
 
@@ -61,24 +62,21 @@ static bool ValidateTexImageFormatCombination(gl::Context *context,
     // INVALID_OPERATION error.
     if (target == GL_TEXTURE_3D && (format == GL_DEPTH_COMPONENT || format == GL_DEPTH_STENCIL))
     {
-        context->handleError(Error(
-            GL_INVALID_OPERATION,
-            "Format cannot be GL_DEPTH_COMPONENT or GL_DEPTH_STENCIL if target is GL_TEXTURE_3D"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDepthFormat3DTexture));
         return false;
     }
 
     // Check if this is a valid format combination to load texture data
     if (!ValidES3FormatCombination(format, type, internalFormat))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Invalid combination of format, type and internalFormat."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorInvalidFormatCombination));
         return false;
     }
 
     const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalFormat, type);
     if (!formatInfo.textureSupport(context->getClientVersion(), context->getExtensions()))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Unsupported internal format."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorUnsupportedInternalFormat));
         return false;
     }
 
@@ -202,7 +200,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
         isSubImage ? texture->getFormat(target, level).info->internalFormat : internalformat;
     if (isSubImage && actualInternalFormat == GL_NONE)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Texture level does not exist."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTextureLevelUndefined));
         return false;
     }
 
@@ -213,8 +211,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
     {
         if (!actualFormatInfo.compressed)
         {
-            context->handleError(Error(
-                GL_INVALID_ENUM, "internalformat is not a supported compressed internal format."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnsupportedCompressedFormat));
             return false;
         }
 
@@ -225,14 +222,13 @@ bool ValidateES3TexImageParametersBase(Context *context,
                     texture->getWidth(target, level), texture->getHeight(target, level)))
             {
                 context->handleError(
-                    Error(GL_INVALID_OPERATION, "Invalid compressed format dimension."));
+                    Error(GL_INVALID_OPERATION, kErrorInvalidCompressedFormatDimension));
                 return false;
             }
 
             if (format != actualInternalFormat)
             {
-                context->handleError(Error(
-                    GL_INVALID_OPERATION, "Format must match the internal format of the texture."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorFormatMismatch));
                 return false;
             }
         }
@@ -241,7 +237,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
             if (!ValidCompressedImageSize(context, actualInternalFormat, level, width, height))
             {
                 context->handleError(
-                    Error(GL_INVALID_OPERATION, "Invalid compressed format dimension."));
+                    Error(GL_INVALID_OPERATION, kErrorInvalidCompressedFormatDimension));
                 return false;
             }
         }
@@ -318,8 +314,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
 
             if ((offset % dataBytesPerPixel) != 0)
             {
-                context->handleError(
-                    Error(GL_INVALID_OPERATION, "Reads would overflow the pixel unpack buffer."));
+                context->handleError(Error(GL_INVALID_OPERATION, kErrorPixelUnpackBufferOverflow));
                 return false;
             }
         }
@@ -327,7 +322,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
         // ...the buffer object's data store is currently mapped.
         if (pixelUnpackBuffer->isMapped())
         {
-            context->handleError(Error(GL_INVALID_OPERATION, "Pixel unpack buffer is mapped."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorPixelUnpackBufferMapped));
             return false;
         }
     }
@@ -906,7 +901,7 @@ bool ValidateBeginQuery(gl::Context *context, GLenum target, GLuint id)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "GLES version < 3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryRequiresES3));
         return false;
     }
 
@@ -917,7 +912,7 @@ bool ValidateEndQuery(gl::Context *context, GLenum target)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "GLES version < 3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryRequiresES3));
         return false;
     }
 
@@ -928,7 +923,7 @@ bool ValidateGetQueryiv(Context *context, GLenum target, GLenum pname, GLint *pa
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "GLES version < 3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryRequiresES3));
         return false;
     }
 
@@ -939,7 +934,7 @@ bool ValidateGetQueryObjectuiv(Context *context, GLuint id, GLenum pname, GLuint
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "GLES version < 3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorQueryRequiresES3));
         return false;
     }
 
@@ -1033,8 +1028,7 @@ bool ValidateInvalidateFramebuffer(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Operation only supported on ES 3.0 and above"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorOperationRequiresES3));
         return false;
     }
 
@@ -1050,7 +1044,7 @@ bool ValidateInvalidateFramebuffer(Context *context,
             defaultFramebuffer = context->getGLState().getReadFramebuffer()->id() == 0;
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid framebuffer target"));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidDiscardFramebufferTarget));
             return false;
     }
 
@@ -1085,13 +1079,13 @@ bool ValidateDrawRangeElements(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
 
     if (end < start)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "end < start"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvertedElementRange));
         return false;
     }
 
@@ -1112,8 +1106,7 @@ bool ValidateDrawRangeElements(Context *context,
     if (indexRangeOpt.value().end > end || indexRangeOpt.value().start < start)
     {
         // GL spec says that behavior in this case is undefined - generating an error is fine.
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Indices are out of the start, end range."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIndicesOutsideElementRange));
         return false;
     }
     return true;
@@ -1142,7 +1135,7 @@ bool ValidateReadBuffer(Context *context, GLenum src)
 
     if (readFBO == nullptr)
     {
-        context->handleError(gl::Error(GL_INVALID_OPERATION, "No active read framebuffer."));
+        context->handleError(gl::Error(GL_INVALID_OPERATION, kErrorNoReadFramebuffer));
         return false;
     }
 
@@ -1153,7 +1146,7 @@ bool ValidateReadBuffer(Context *context, GLenum src)
 
     if (src != GL_BACK && (src < GL_COLOR_ATTACHMENT0 || src > GL_COLOR_ATTACHMENT31))
     {
-        context->handleError(gl::Error(GL_INVALID_ENUM, "Unknown enum for 'src' in ReadBuffer"));
+        context->handleError(gl::Error(GL_INVALID_ENUM, kErrorInvalidReadBufferSource));
         return false;
     }
 
@@ -1215,7 +1208,7 @@ bool ValidateCompressedTexImage3D(Context *context,
     const InternalFormat &formatInfo = GetSizedInternalFormatInfo(internalformat);
     if (!formatInfo.compressed)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Not a valid compressed texture format"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCompressedFormat));
         return false;
     }
 
@@ -1235,8 +1228,7 @@ bool ValidateCompressedTexImage3D(Context *context,
     // 3D texture target validation
     if (target != GL_TEXTURE_3D && target != GL_TEXTURE_2D_ARRAY)
     {
-        context->handleError(
-            Error(GL_INVALID_ENUM, "Must specify a valid 3D texture destination target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalid3DTextureTarget));
         return false;
     }
 
@@ -1309,14 +1301,14 @@ static bool ValidateBindBufferCommon(Context *context,
 
     if (buffer != 0 && offset < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "buffer is non-zero and offset is negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBindBufferOffset));
         return false;
     }
 
     if (!context->getGLState().isBindGeneratesResourceEnabled() &&
         !context->isBufferGenerated(buffer))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer was not generated."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorBufferNotGenerated));
         return false;
     }
 
@@ -1327,15 +1319,14 @@ static bool ValidateBindBufferCommon(Context *context,
         {
             if (index >= caps.maxTransformFeedbackSeparateAttributes)
             {
-                context->handleError(Error(GL_INVALID_VALUE,
-                                           "index is greater than or equal to the number of "
-                                           "TRANSFORM_FEEDBACK_BUFFER indexed binding points."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxTransformFeedbackBufferBindings));
                 return false;
             }
             if (buffer != 0 && ((offset % 4) != 0 || (size % 4) != 0))
             {
                 context->handleError(
-                    Error(GL_INVALID_VALUE, "offset and size must be multiple of 4."));
+                    Error(GL_INVALID_VALUE, kErrorMisalignedAtomicCounterBufferRange));
                 return false;
             }
 
@@ -1343,9 +1334,8 @@ static bool ValidateBindBufferCommon(Context *context,
                 context->getGLState().getCurrentTransformFeedback();
             if (curTransformFeedback && curTransformFeedback->isActive())
             {
-                context->handleError(Error(GL_INVALID_OPERATION,
-                                           "target is TRANSFORM_FEEDBACK_BUFFER and transform "
-                                           "feedback is currently active."));
+                context->handleError(
+                    Error(GL_INVALID_OPERATION, kErrorTransformFeedbackBufferActive));
                 return false;
             }
             break;
@@ -1354,17 +1344,14 @@ static bool ValidateBindBufferCommon(Context *context,
         {
             if (index >= caps.maxUniformBufferBindings)
             {
-                context->handleError(Error(GL_INVALID_VALUE,
-                                           "index is greater than or equal to the number of "
-                                           "UNIFORM_BUFFER indexed binding points."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxUniformBufferBindings));
                 return false;
             }
 
             if (buffer != 0 && (offset % caps.uniformBufferOffsetAlignment) != 0)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "offset must be multiple of value of UNIFORM_BUFFER_OFFSET_ALIGNMENT."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorMisalignedUniformBufferOffset));
                 return false;
             }
             break;
@@ -1373,20 +1360,19 @@ static bool ValidateBindBufferCommon(Context *context,
         {
             if (context->getClientVersion() < ES_3_1)
             {
-                context->handleError(Error(
-                    GL_INVALID_ENUM, "ATOMIC_COUNTER_BUFFER is not supported before GLES 3.1"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorAtomicCounterBufferRequiresES31));
                 return false;
             }
             if (index >= caps.maxAtomicCounterBufferBindings)
             {
-                context->handleError(Error(GL_INVALID_VALUE,
-                                           "index is greater than or equal to the number of "
-                                           "ATOMIC_COUNTER_BUFFER indexed binding points."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxAtomicCounterBufferBindings));
                 return false;
             }
             if (buffer != 0 && (offset % 4) != 0)
             {
-                context->handleError(Error(GL_INVALID_VALUE, "offset must be a multiple of 4."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorMisalignedAtomicCounterBufferOffset));
                 return false;
             }
             break;
@@ -1395,28 +1381,25 @@ static bool ValidateBindBufferCommon(Context *context,
         {
             if (context->getClientVersion() < ES_3_1)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "SHADER_STORAGE_BUFFER is not supported in GLES3."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorShaderStorageBufferRequiresES31));
                 return false;
             }
             if (index >= caps.maxShaderStorageBufferBindings)
             {
-                context->handleError(Error(GL_INVALID_VALUE,
-                                           "index is greater than or equal to the number of "
-                                           "SHADER_STORAGE_BUFFER indexed binding points."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorIndexExceedsMaxShaderStorageBufferBindings));
                 return false;
             }
             if (buffer != 0 && (offset % caps.shaderStorageBufferOffsetAlignment) != 0)
             {
-                context->handleError(Error(
-                    GL_INVALID_VALUE,
-                    "offset must be multiple of value of SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT."));
+                context->handleError(
+                    Error(GL_INVALID_VALUE, kErrorMisalignedShaderStorageBufferOffset));
                 return false;
             }
             break;
         }
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "the target is not supported."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorTargetNotSupported));
             return false;
     }
 
@@ -1437,8 +1420,7 @@ bool ValidateBindBufferRange(Context *context,
 {
     if (buffer != 0 && size <= 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "buffer is non-zero and size is less than or equal to zero."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNonPositiveBindBufferSize));
         return false;
     }
     return ValidateBindBufferCommon(context, target, index, buffer, offset, size);
@@ -1479,7 +1461,7 @@ bool ValidateProgramParameteri(Context *context, GLuint program, GLenum pname, G
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
 
@@ -1502,8 +1484,7 @@ bool ValidateProgramParameteri(Context *context, GLuint program, GLenum pname, G
         case GL_PROGRAM_SEPARABLE:
             if (context->getClientVersion() < ES_3_1)
             {
-                context->handleError(
-                    Error(GL_INVALID_ENUM, "PROGRAM_SEPARABLE is not supported before GLES 3.1"));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorProgramSeparableRequiresES31));
                 return false;
             }
 
@@ -1689,7 +1670,7 @@ bool ValidateDrawBuffers(ValidationContext *context, GLsizei n, const GLenum *bu
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
 
@@ -1845,7 +1826,7 @@ bool ValidateCompressedTexSubImage3D(Context *context,
     const InternalFormat &formatInfo = GetSizedInternalFormatInfo(format);
     if (!formatInfo.compressed)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Not a valid compressed texture format"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCompressedFormat));
         return false;
     }
 
@@ -1931,8 +1912,7 @@ bool ValidateDeleteTransformFeedbacks(Context *context, GLint n, const GLuint *i
         if (transformFeedback != nullptr && transformFeedback->isActive())
         {
             // ES 3.0.4 section 2.15.1 page 86
-            context->handleError(
-                Error(GL_INVALID_OPERATION, "Attempt to delete active transform feedback."));
+            context->handleError(Error(GL_INVALID_OPERATION, kErrorDeleteActiveTransformFeedback));
             return false;
         }
     }
@@ -1953,7 +1933,7 @@ bool ValidateGenOrDeleteES3(Context *context, GLint n)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
     return ValidateGenOrDelete(context, n);
@@ -1963,12 +1943,12 @@ bool ValidateGenOrDeleteCountES3(Context *context, GLint count)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
     if (count < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "count < 0"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeGenOrDeleteCount));
         return false;
     }
     return true;
@@ -1978,7 +1958,7 @@ bool ValidateBeginTransformFeedback(Context *context, GLenum primitiveMode)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
     switch (primitiveMode)
@@ -1989,7 +1969,7 @@ bool ValidateBeginTransformFeedback(Context *context, GLenum primitiveMode)
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid primitive mode."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPrimitiveMode));
             return false;
     }
 
@@ -1998,7 +1978,7 @@ bool ValidateBeginTransformFeedback(Context *context, GLenum primitiveMode)
 
     if (transformFeedback->isActive())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Transform feedback is already active."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTransformFeedbackAlreadyActive));
         return false;
     }
     return true;
@@ -2053,7 +2033,7 @@ bool ValidateMapBufferRange(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
 
@@ -2067,7 +2047,7 @@ bool ValidateFlushMappedBufferRange(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES3Required));
         return false;
     }
 
@@ -2130,15 +2110,13 @@ bool ValidateIndexedStateQuery(ValidationContext *context,
             if (context->getClientVersion() < ES_3_1)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "Atomic Counter buffers are not supported in this version of GL"));
+                    Error(GL_INVALID_ENUM, kErrorAtomicCounterBuffersNotSupported));
                 return false;
             }
             if (index >= caps.maxAtomicCounterBufferBindings)
             {
                 context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "index is outside the valid range for GL_ATOMIC_COUNTER_BUFFER_BINDING"));
+                    Error(GL_INVALID_VALUE, kErrorAtomicCounterBufferBindingOutOfRange));
                 return false;
             }
             break;
@@ -2149,15 +2127,13 @@ bool ValidateIndexedStateQuery(ValidationContext *context,
             if (context->getClientVersion() < ES_3_1)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "Shader storage buffers are not supported in this version of GL"));
+                    Error(GL_INVALID_ENUM, kErrorShaderStorageBuffersNotSupported));
                 return false;
             }
             if (index >= caps.maxShaderStorageBufferBindings)
             {
                 context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "index is outside the valid range for GL_SHADER_STORAGE_BUFFER_BINDING"));
+                    Error(GL_INVALID_VALUE, kErrorShaderStorageBufferBindingOutOfRange));
                 return false;
             }
             break;
@@ -2169,15 +2145,12 @@ bool ValidateIndexedStateQuery(ValidationContext *context,
             if (context->getClientVersion() < ES_3_1)
             {
                 context->handleError(
-                    Error(GL_INVALID_ENUM,
-                          "Vertex Attrib Bindings are not supported in this version of GL"));
+                    Error(GL_INVALID_ENUM, kErrorVertexAttribBindingsNotSupported));
                 return false;
             }
             if (index >= caps.maxVertexAttribBindings)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorBindingIndexExceedsMaxBindings));
                 return false;
             }
             break;
@@ -2198,7 +2171,7 @@ bool ValidateGetIntegeri_v(ValidationContext *context, GLenum target, GLuint ind
 {
     if (context->getClientVersion() < ES_3_0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES30Required));
         return false;
     }
     return ValidateIndexedStateQuery(context, target, index, nullptr);
@@ -2213,7 +2186,7 @@ bool ValidateGetIntegeri_vRobustANGLE(ValidationContext *context,
 {
     if (context->getClientVersion() < ES_3_0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES30Required));
         return false;
     }
 
@@ -2239,7 +2212,7 @@ bool ValidateGetInteger64i_v(ValidationContext *context, GLenum target, GLuint i
 {
     if (context->getClientVersion() < ES_3_0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES30Required));
         return false;
     }
     return ValidateIndexedStateQuery(context, target, index, nullptr);
@@ -2254,7 +2227,7 @@ bool ValidateGetInteger64i_vRobustANGLE(ValidationContext *context,
 {
     if (context->getClientVersion() < ES_3_0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.0"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES30Required));
         return false;
     }
 
@@ -2285,14 +2258,13 @@ bool ValidateCopyBufferSubData(ValidationContext *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "CopyBufferSubData requires ES 3 or greater"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyBufferSubDataRequiresES3));
         return false;
     }
 
     if (!ValidBufferTarget(context, readTarget) || !ValidBufferTarget(context, writeTarget))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid buffer target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidCopyBufferTarget));
         return false;
     }
 
@@ -2301,15 +2273,14 @@ bool ValidateCopyBufferSubData(ValidationContext *context,
 
     if (!readBuffer || !writeBuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "No buffer bound to target"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoBufferBoundToTarget));
         return false;
     }
 
     // Verify that readBuffer and writeBuffer are not currently mapped
     if (readBuffer->isMapped() || writeBuffer->isMapped())
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Cannot call CopyBufferSubData on a mapped buffer"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorCopyBufferMapped));
         return false;
     }
 
@@ -2324,23 +2295,20 @@ bool ValidateCopyBufferSubData(ValidationContext *context,
         !IsValueInRangeForNumericType<GLintptr>(readBuffer->getSize()) ||
         !IsValueInRangeForNumericType<GLintptr>(writeBuffer->getSize()))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Integer overflow when validating copy offsets."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorCopyOffsetOverflow));
         return false;
     }
 
     if (readOffset < 0 || writeOffset < 0 || size < 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "readOffset, writeOffset and size must all be non-negative"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeCopyBufferRange));
         return false;
     }
 
     if (checkedReadSum.ValueOrDie() > readBuffer->getSize() ||
         checkedWriteSum.ValueOrDie() > writeBuffer->getSize())
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Buffer offset overflow in CopyBufferSubData"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorCopyBufferOffsetOverflow));
         return false;
     }
 
@@ -2351,8 +2319,7 @@ bool ValidateCopyBufferSubData(ValidationContext *context,
         {
             // This shold not be possible.
             UNREACHABLE();
-            context->handleError(
-                Error(GL_INVALID_VALUE, "Integer overflow when validating same buffer copy."));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorSameBufferCopyOverflow));
             return false;
         }
 
@@ -2370,8 +2337,7 @@ bool ValidateGetStringi(Context *context, GLenum name, GLuint index)
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "glGetStringi requires OpenGL ES 3.0 or higher."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorGetStringiRequiresES3));
         return false;
     }
 
@@ -2380,8 +2346,7 @@ bool ValidateGetStringi(Context *context, GLenum name, GLuint index)
         case GL_EXTENSIONS:
             if (index >= context->getExtensionStringCount())
             {
-                context->handleError(Error(
-                    GL_INVALID_VALUE, "index must be less than the number of extension strings."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorExtensionStringIndexOutOfRange));
                 return false;
             }
             break;
@@ -2389,20 +2354,19 @@ bool ValidateGetStringi(Context *context, GLenum name, GLuint index)
         case GL_REQUESTABLE_EXTENSIONS_ANGLE:
             if (!context->getExtensions().requestExtension)
             {
-                context->handleError(Error(GL_INVALID_ENUM, "Invalid name."));
+                context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidName));
                 return false;
             }
             if (index >= context->getRequestableExtensionStringCount())
             {
                 context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "index must be less than the number of requestable extension strings."));
+                    Error(GL_INVALID_VALUE, kErrorRequestableExtensionStringIndexOutOfRange));
                 return false;
             }
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid name."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidName));
             return false;
     }
 
@@ -2442,9 +2406,7 @@ bool ValidateRenderbufferStorageMultisample(ValidationContext *context,
     const TextureCaps &formatCaps = context->getTextureCaps().get(internalformat);
     if (static_cast<GLuint>(samples) > formatCaps.getMaxSamples())
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Samples must not be greater than maximum supported value for the format."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorSamplesOutOfRange));
         return false;
     }
 
@@ -2460,8 +2422,7 @@ bool ValidateVertexAttribIPointer(ValidationContext *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "VertexAttribIPointer requires OpenGL ES 3.0 or higher."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexAttribIPointerRequiresES3));
         return false;
     }
 
@@ -2472,7 +2433,7 @@ bool ValidateVertexAttribIPointer(ValidationContext *context,
 
     if (stride < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "stride cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeStride));
         return false;
     }
 
@@ -2481,8 +2442,7 @@ bool ValidateVertexAttribIPointer(ValidationContext *context,
     {
         if (stride > caps.maxVertexAttribStride)
         {
-            context->handleError(
-                Error(GL_INVALID_VALUE, "stride cannot be greater than MAX_VERTEX_ATTRIB_STRIDE."));
+            context->handleError(Error(GL_INVALID_VALUE, kErrorStrideExceedsMaxVertexAttribStride));
             return false;
         }
 
@@ -2492,7 +2452,7 @@ bool ValidateVertexAttribIPointer(ValidationContext *context,
         if (index >= caps.maxVertexAttribBindings)
         {
             context->handleError(
-                Error(GL_INVALID_VALUE, "index must be smaller than MAX_VERTEX_ATTRIB_BINDINGS."));
+                Error(GL_INVALID_VALUE, kErrorVertexAttribIndexExceedsMaxBindings));
             return false;
         }
     }
@@ -2504,9 +2464,7 @@ bool ValidateVertexAttribIPointer(ValidationContext *context,
     if (context->getGLState().getVertexArrayId() != 0 &&
         context->getGLState().getArrayBufferId() == 0 && pointer != nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Client data cannot be used with a non-default vertex array object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorClientDataWithVertexArrayObject));
         return false;
     }
 
@@ -2530,21 +2488,20 @@ bool ValidateGetSynciv(Context *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "GetSynciv requires OpenGL ES 3.0 or higher."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorGetSyncivRequiresES3));
         return false;
     }
 
     if (bufSize < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "bufSize cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeBufSize));
         return false;
     }
 
     FenceSync *fenceSync = context->getFenceSync(sync);
     if (!fenceSync)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Invalid sync object."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorInvalidSyncObject));
         return false;
     }
 
@@ -2557,7 +2514,7 @@ bool ValidateGetSynciv(Context *context,
             break;
 
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Invalid pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidPname));
             return false;
     }
 
@@ -2573,7 +2530,7 @@ bool ValidateDrawElementsInstanced(ValidationContext *context,
 {
     if (context->getClientMajorVersion() < 3)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Requires a GLES 3.0 or higher context."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorRequiresES3));
         return false;
     }
 
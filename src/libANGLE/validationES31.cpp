@@ -9,6 +9,7 @@
 #include "libANGLE/validationES31.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/VertexArray.h"
 #include "libANGLE/validationES.h"
@@ -74,7 +75,7 @@ bool ValidateGetBooleani_v(Context *context, GLenum target, GLuint index, GLbool
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31NotSupported));
         return false;
     }
 
@@ -95,7 +96,7 @@ bool ValidateGetBooleani_vRobustANGLE(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31NotSupported));
         return false;
     }
 
@@ -121,7 +122,7 @@ bool ValidateDrawIndirectBase(Context *context, GLenum mode, const void *indirec
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31NotSupported));
         return false;
     }
 
@@ -137,14 +138,14 @@ bool ValidateDrawIndirectBase(Context *context, GLenum mode, const void *indirec
     // DRAW_INDIRECT_BUFFER or to any enabled vertex array.
     if (!state.getVertexArrayId())
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "zero is bound to VERTEX_ARRAY_BINDING"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoVertexArrayForIndirect));
         return false;
     }
 
     gl::Buffer *drawIndirectBuffer = state.getDrawIndirectBuffer();
     if (!drawIndirectBuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "zero is bound to DRAW_INDIRECT_BUFFER"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoDrawIndirectBuffer));
         return false;
     }
 
@@ -153,9 +154,7 @@ bool ValidateDrawIndirectBase(Context *context, GLenum mode, const void *indirec
     GLint64 offset = reinterpret_cast<GLint64>(indirect);
     if ((static_cast<GLuint>(offset) % sizeof(GLuint)) != 0)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE,
-                  "indirect is not a multiple of the size, in basic machine units, of uint"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorMisalignedIndirect));
         return false;
     }
 
@@ -170,8 +169,7 @@ bool ValidateDrawArraysIndirect(Context *context, GLenum mode, const void *indir
         !curTransformFeedback->isPaused())
     {
         // An INVALID_OPERATION error is generated if transform feedback is active and not paused.
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "transform feedback is active and not paused."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTransformFeedbackNotPaused));
         return false;
     }
 
@@ -186,9 +184,7 @@ bool ValidateDrawArraysIndirect(Context *context, GLenum mode, const void *indir
     if (!checkedSum.IsValid() ||
         checkedSum.ValueOrDie() > static_cast<size_t>(drawIndirectBuffer->getSize()))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "the  command  would source data beyond the end of the buffer object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIndirectBufferTooSmall));
         return false;
     }
 
@@ -205,7 +201,7 @@ bool ValidateDrawElementsIndirect(Context *context, GLenum mode, GLenum type, co
     gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
     if (!elementArrayBuffer)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "zero is bound to ELEMENT_ARRAY_BUFFER"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoElementArrayBufferForIndirect));
         return false;
     }
 
@@ -220,9 +216,7 @@ bool ValidateDrawElementsIndirect(Context *context, GLenum mode, GLenum type, co
     if (!checkedSum.IsValid() ||
         checkedSum.ValueOrDie() > static_cast<size_t>(drawIndirectBuffer->getSize()))
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "the  command  would source data beyond the end of the buffer object."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorIndirectBufferTooSmall));
         return false;
     }
 
@@ -237,7 +231,7 @@ bool ValidateGetTexLevelParameterBase(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1"));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31NotSupported));
         return false;
     }
 
@@ -248,14 +242,14 @@ bool ValidateGetTexLevelParameterBase(Context *context,
 
     if (!ValidTexLevelDestinationTarget(context, target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid texture target"));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidTextureTarget));
         return false;
     }
 
     if (context->getTargetTexture(IsCubeMapTextureTarget(target) ? GL_TEXTURE_CUBE_MAP : target) ==
         nullptr)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "No texture bound."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorNoTextureBound));
         return false;
     }
 
@@ -292,7 +286,7 @@ bool ValidateGetTexLevelParameterBase(Context *context,
         case GL_TEXTURE_COMPRESSED:
             break;
         default:
-            context->handleError(Error(GL_INVALID_ENUM, "Unknown pname."));
+            context->handleError(Error(GL_INVALID_ENUM, kErrorUnknownPname));
             return false;
     }
 
@@ -331,19 +325,19 @@ bool ValidateTexStorage2DMultiSample(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     if (target != GL_TEXTURE_2D_MULTISAMPLE)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Target must be TEXTURE_2D_MULTISAMPLE."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidMultisampleTextureTarget));
         return false;
     }
 
     if (width < 1 || height < 1)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Width and height must be positive."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNonPositiveSize));
         return false;
     }
 
@@ -351,25 +345,20 @@ bool ValidateTexStorage2DMultiSample(Context *context,
     if (static_cast<GLuint>(width) > caps.max2DTextureSize ||
         static_cast<GLuint>(height) > caps.max2DTextureSize)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE,
-                  "Width and height must be less than or equal to GL_MAX_TEXTURE_SIZE."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSizeExceedsMaxTextureSize));
         return false;
     }
 
     if (samples == 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "Samples may not be zero."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorZeroSamples));
         return false;
     }
 
     const TextureCaps &formatCaps = context->getTextureCaps().get(internalFormat);
     if (!formatCaps.renderable)
     {
-        context->handleError(
-            Error(GL_INVALID_ENUM,
-                  "SizedInternalformat must be color-renderable, depth-renderable, "
-                  "or stencil-renderable."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorSizedFormatNotRenderable));
         return false;
     }
 
@@ -378,33 +367,26 @@ bool ValidateTexStorage2DMultiSample(Context *context,
     const InternalFormat &formatInfo = GetSizedInternalFormatInfo(internalFormat);
     if (formatInfo.internalFormat == GL_NONE)
     {
-        context->handleError(
-            Error(GL_INVALID_ENUM,
-                  "Internalformat is one of the unsupported unsized base internalformats."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorUnsizedInternalFormatUnsupported));
         return false;
     }
 
     if (static_cast<GLuint>(samples) > formatCaps.getMaxSamples())
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "Samples must not be greater than maximum supported value for the format."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorSamplesOutOfRange));
         return false;
     }
 
     Texture *texture = context->getTargetTexture(target);
     if (!texture || texture->id() == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Zero is bound to target."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoTextureBoundToTarget));
         return false;
     }
 
     if (texture->getImmutableFormat())
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION,
-                  "The value of TEXTURE_IMMUTABLE_FORMAT for the texture "
-                  "currently bound to target on the active texture unit is true."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorTextureImmutable));
         return false;
     }
 
@@ -415,21 +397,20 @@ bool ValidateGetMultisamplefv(Context *context, GLenum pname, GLuint index, GLfl
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     if (pname != GL_SAMPLE_POSITION)
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Pname must be SAMPLE_POSITION."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidMultisamplePname));
         return false;
     }
 
     GLint maxSamples = context->getCaps().maxSamples;
     if (index >= static_cast<GLuint>(maxSamples))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "Index must be less than the value of SAMPLES."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorSampleIndexOutOfRange));
         return false;
     }
 
@@ -440,13 +421,13 @@ bool ValidationFramebufferParameteri(Context *context, GLenum target, GLenum pna
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     if (!ValidFramebufferTarget(target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid framebuffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFramebufferTarget));
         return false;
     }
 
@@ -457,9 +438,7 @@ bool ValidationFramebufferParameteri(Context *context, GLenum target, GLenum pna
             GLint maxWidth = context->getCaps().maxFramebufferWidth;
             if (param < 0 || param > maxWidth)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_WIDTH."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorFramebufferWidthOutOfRange));
                 return false;
             }
             break;
@@ -469,9 +448,7 @@ bool ValidationFramebufferParameteri(Context *context, GLenum target, GLenum pna
             GLint maxHeight = context->getCaps().maxFramebufferHeight;
             if (param < 0 || param > maxHeight)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_HEIGHT."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorFramebufferHeightOutOfRange));
                 return false;
             }
             break;
@@ -481,9 +458,7 @@ bool ValidationFramebufferParameteri(Context *context, GLenum target, GLenum pna
             GLint maxSamples = context->getCaps().maxFramebufferSamples;
             if (param < 0 || param > maxSamples)
             {
-                context->handleError(
-                    Error(GL_INVALID_VALUE,
-                          "Params less than 0 or greater than GL_MAX_FRAMEBUFFER_SAMPLES."));
+                context->handleError(Error(GL_INVALID_VALUE, kErrorFramebufferSamplesOutOfRange));
                 return false;
             }
             break;
@@ -503,8 +478,7 @@ bool ValidationFramebufferParameteri(Context *context, GLenum target, GLenum pna
     ASSERT(framebuffer);
     if (framebuffer->id() == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Default framebuffer is bound to target."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultFramebufferBound));
         return false;
     }
     return true;
@@ -517,13 +491,13 @@ bool ValidationGetFramebufferParameteri(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     if (!ValidFramebufferTarget(target))
     {
-        context->handleError(Error(GL_INVALID_ENUM, "Invalid framebuffer target."));
+        context->handleError(Error(GL_INVALID_ENUM, kErrorInvalidFramebufferTarget));
         return false;
     }
 
@@ -544,8 +518,7 @@ bool ValidationGetFramebufferParameteri(Context *context,
 
     if (framebuffer->id() == 0)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "Default framebuffer is bound to target."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultFramebufferBound));
         return false;
     }
     return true;
@@ -558,7 +531,7 @@ bool ValidateGetProgramResourceIndex(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES 3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorProgramResourceRequiresES31));
         return false;
     }
 
@@ -586,34 +559,32 @@ bool ValidateBindVertexBuffer(ValidationContext *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     if (!context->isBufferGenerated(buffer))
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Buffer is not generated."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorVertexBufferNotGenerated));
         return false;
     }
 
     const Caps &caps = context->getCaps();
     if (bindingIndex >= caps.maxVertexAttribBindings)
     {
-        context->handleError(Error(
-            GL_INVALID_VALUE, "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorBindingIndexExceedsMaxBindings));
         return false;
     }
 
     if (offset < 0)
     {
-        context->handleError(Error(GL_INVALID_VALUE, "offset cannot be negative."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorNegativeVertexBufferOffset));
         return false;
     }
 
     if (stride < 0 || stride > caps.maxVertexAttribStride)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "stride must be between 0 and MAX_VERTEX_ATTRIB_STRIDE."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorStrideOutOfRange));
         return false;
     }
 
@@ -621,7 +592,7 @@ bool ValidateBindVertexBuffer(ValidationContext *context,
     // An INVALID_OPERATION error is generated if the default vertex array object is bound.
     if (context->getGLState().getVertexArrayId() == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Default vertex array buffer is bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultVertexArrayBufferBound));
         return false;
     }
 
@@ -632,15 +603,14 @@ bool ValidateVertexBindingDivisor(ValidationContext *context, GLuint bindingInde
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     const Caps &caps = context->getCaps();
     if (bindingIndex >= caps.maxVertexAttribBindings)
     {
-        context->handleError(Error(
-            GL_INVALID_VALUE, "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorBindingIndexExceedsMaxBindings));
         return false;
     }
 
@@ -648,7 +618,7 @@ bool ValidateVertexBindingDivisor(ValidationContext *context, GLuint bindingInde
     // An INVALID_OPERATION error is generated if the default vertex array object is bound.
     if (context->getGLState().getVertexArrayId() == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Default vertex array object is bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultVertexArrayBound));
         return false;
     }
 
@@ -664,16 +634,14 @@ bool ValidateVertexAttribFormat(ValidationContext *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
     const Caps &caps = context->getCaps();
     if (relativeOffset > static_cast<GLuint>(caps.maxVertexAttribRelativeOffset))
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE,
-                  "relativeOffset cannot be greater than MAX_VERTEX_ATTRIB_RELATIVE_OFFSET."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorRelativeOffsetTooLarge));
         return false;
     }
 
@@ -681,7 +649,7 @@ bool ValidateVertexAttribFormat(ValidationContext *context,
     // An INVALID_OPERATION error is generated if the default vertex array object is bound.
     if (context->getGLState().getVertexArrayId() == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Default vertex array object is bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultVertexArrayBound));
         return false;
     }
 
@@ -694,7 +662,7 @@ bool ValidateVertexAttribBinding(ValidationContext *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
@@ -702,22 +670,20 @@ bool ValidateVertexAttribBinding(ValidationContext *context,
     // An INVALID_OPERATION error is generated if the default vertex array object is bound.
     if (context->getGLState().getVertexArrayId() == 0)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Default vertex array object is bound."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorDefaultVertexArrayBound));
         return false;
     }
 
     const Caps &caps = context->getCaps();
     if (attribIndex >= caps.maxVertexAttributes)
     {
-        context->handleError(
-            Error(GL_INVALID_VALUE, "attribindex must be smaller than MAX_VERTEX_ATTRIBS."));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorAttribIndexExceedsMaxVertexAttribs));
         return false;
     }
 
     if (bindingIndex >= caps.maxVertexAttribBindings)
     {
-        context->handleError(Error(GL_INVALID_VALUE,
-                                   "bindingindex must be smaller than MAX_VERTEX_ATTRIB_BINDINGS"));
+        context->handleError(Error(GL_INVALID_VALUE, kErrorAttribBindingIndexOutOfRange));
         return false;
     }
 
@@ -734,7 +700,7 @@ bool ValidateGetProgramResourceName(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
@@ -773,7 +739,7 @@ bool ValidateDispatchCompute(Context *context,
 {
     if (context->getClientVersion() < ES_3_1)
     {
-        context->handleError(Error(GL_INVALID_OPERATION, "Context does not support GLES3.1."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorES31Required));
         return false;
     }
 
@@ -782,16 +748,13 @@ bool ValidateDispatchCompute(Context *context,
 
     if (program == nullptr)
     {
-        context->handleError(
-            Error(GL_INVALID_OPERATION, "No active program object for the compute shader stage."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoActiveComputeProgram));
         return false;
     }
 
     if (program->isLinked() == false || program->getAttachedComputeShader() == nullptr)
     {
-        context->handleError(Error(
-            GL_INVALID_OPERATION,
-            "Program has not been successfully linked, or program contains no compute shaders."));
+        context->handleError(Error(GL_INVALID_OPERATION, kErrorNoComputeShaderInProgram));
         return false;
     }
 
@@ -11,6 +11,7 @@
 #include "libGLESv2/entry_points_gles_2_0_autogen.h"
 #include "libGLESv2/entry_points_gles_2_0_ext.h"
 #include "libGLESv2/entry_points_gles_3_0.h"
+#include "libGLESv2/entry_points_gles_3_0_autogen.h"
 #include "libGLESv2/entry_points_gles_3_1.h"
 #include "libGLESv2/global_state.h"
 
@@ -68,6 +69,7 @@ EGLint EGLAPIENTRY GetError(void)
 EGLDisplay EGLAPIENTRY GetDisplay(EGLNativeDisplayType display_id)
 {
     EVENT("(EGLNativeDisplayType display_id = 0x%0.8p)", display_id);
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     return Display::GetDisplayFromNativeDisplay(display_id, AttributeMap());
 }
@@ -77,6 +79,7 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint *major = 0x%0.8p, EGLint *minor = 0x%0.8p)", dpy,
           major, minor);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
     if (dpy == EGL_NO_DISPLAY || !Display::isValidDisplay(display))
@@ -105,6 +108,7 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p)", dpy);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
     if (dpy == EGL_NO_DISPLAY || !Display::isValidDisplay(display))
@@ -128,6 +132,7 @@ const char *EGLAPIENTRY QueryString(EGLDisplay dpy, EGLint name)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint name = %d)", dpy, name);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
     if (!(display == EGL_NO_DISPLAY && name == EGL_EXTENSIONS))
@@ -181,6 +186,7 @@ EGLBoolean EGLAPIENTRY GetConfigs(EGLDisplay dpy,
         "EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, configs, config_size, num_config);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
 
@@ -208,6 +214,7 @@ EGLBoolean EGLAPIENTRY ChooseConfig(EGLDisplay dpy,
         "EGLConfig *configs = 0x%0.8p, EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, attrib_list, configs, config_size, num_config);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display       = static_cast<Display *>(dpy);
     AttributeMap attribMap = AttributeMap::CreateFromIntArray(attrib_list);
@@ -235,6 +242,7 @@ EGLBoolean EGLAPIENTRY GetConfigAttrib(EGLDisplay dpy,
         "*value = 0x%0.8p)",
         dpy, config, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display      = static_cast<Display *>(dpy);
     Config *configuration = static_cast<Config *>(config);
@@ -262,6 +270,7 @@ EGLSurface EGLAPIENTRY CreateWindowSurface(EGLDisplay dpy,
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, win, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Config *configuration   = static_cast<Config *>(config);
@@ -294,6 +303,7 @@ EGLSurface EGLAPIENTRY CreatePbufferSurface(EGLDisplay dpy,
         "0x%0.8p)",
         dpy, config, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Config *configuration   = static_cast<Config *>(config);
@@ -328,6 +338,7 @@ EGLSurface EGLAPIENTRY CreatePixmapSurface(EGLDisplay dpy,
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, pixmap, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display      = static_cast<Display *>(dpy);
     Config *configuration = static_cast<Config *>(config);
@@ -349,6 +360,7 @@ EGLBoolean EGLAPIENTRY DestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -382,6 +394,7 @@ EGLBoolean EGLAPIENTRY QuerySurface(EGLDisplay dpy,
         "*value = 0x%0.8p)",
         dpy, surface, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = (Surface *)surface;
@@ -516,6 +529,7 @@ EGLContext EGLAPIENTRY CreateContext(EGLDisplay dpy,
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, share_context, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display             = static_cast<Display *>(dpy);
     Config *configuration        = static_cast<Config *>(config);
@@ -545,6 +559,7 @@ EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p)", dpy, ctx);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -580,6 +595,7 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
         "EGLContext ctx = 0x%0.8p)",
         dpy, draw, read, ctx);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -654,6 +670,7 @@ EGLBoolean EGLAPIENTRY QueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attri
         "= 0x%0.8p)",
         dpy, ctx, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -692,6 +709,7 @@ EGLBoolean EGLAPIENTRY WaitGL(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = thread->getDisplay();
 
@@ -719,6 +737,7 @@ EGLBoolean EGLAPIENTRY WaitNative(EGLint engine)
 {
     EVENT("(EGLint engine = %d)", engine);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = thread->getDisplay();
 
@@ -750,6 +769,7 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = (Surface *)surface;
@@ -791,6 +811,7 @@ EGLBoolean EGLAPIENTRY CopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNative
         "0x%0.8p)",
         dpy, surface, target);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -820,6 +841,7 @@ EGLBoolean EGLAPIENTRY BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint b
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -889,6 +911,7 @@ EGLBoolean EGLAPIENTRY SurfaceAttrib(EGLDisplay dpy,
         "value = %d)",
         dpy, surface, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -911,6 +934,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -960,6 +984,7 @@ EGLBoolean EGLAPIENTRY SwapInterval(EGLDisplay dpy, EGLint interval)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint interval = %d)", dpy, interval);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
 
@@ -1035,6 +1060,7 @@ EGLSurface EGLAPIENTRY CreatePbufferFromClientBuffer(EGLDisplay dpy,
         "EGLConfig config = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p)",
         dpy, buftype, buffer, config, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Config *configuration   = static_cast<Config *>(config);
@@ -1064,6 +1090,7 @@ EGLBoolean EGLAPIENTRY ReleaseThread(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     MakeCurrent(EGL_NO_DISPLAY, EGL_NO_CONTEXT, EGL_NO_SURFACE, EGL_NO_SURFACE);
 
@@ -1075,6 +1102,7 @@ EGLBoolean EGLAPIENTRY WaitClient(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = thread->getDisplay();
 
@@ -1114,6 +1142,7 @@ EGLSync EGLAPIENTRY CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *at
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLenum type = 0x%X, const EGLint* attrib_list = 0x%0.8p)",
           dpy, type, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglCreateSync unimplemented."));
@@ -1124,6 +1153,7 @@ EGLBoolean EGLAPIENTRY DestroySync(EGLDisplay dpy, EGLSync sync)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p)", dpy, sync);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglDestroySync unimplemented."));
@@ -1137,6 +1167,7 @@ EGLint EGLAPIENTRY ClientWaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags, EG
         "%d)",
         dpy, sync, flags, timeout);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglClientWaitSync unimplemented."));
@@ -1153,6 +1184,7 @@ EGLBoolean EGLAPIENTRY GetSyncAttrib(EGLDisplay dpy,
         "*value = 0x%0.8p)",
         dpy, sync, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglSyncAttrib unimplemented."));
@@ -1170,6 +1202,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglCreateImage unimplemented."));
@@ -1180,6 +1213,7 @@ EGLBoolean EGLAPIENTRY DestroyImage(EGLDisplay dpy, EGLImage image)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLImage image = 0x%0.8p)", dpy, image);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglDestroyImage unimplemented."));
@@ -1195,6 +1229,7 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplay(EGLenum platform,
         "0x%0.8p)",
         platform, native_display, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Error err = ValidateGetPlatformDisplay(platform, native_display, attrib_list);
     thread->setError(err);
@@ -1231,6 +1266,7 @@ EGLSurface EGLAPIENTRY CreatePlatformWindowSurface(EGLDisplay dpy,
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_window, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglCreatePlatformWindowSurface unimplemented."));
@@ -1247,6 +1283,7 @@ EGLSurface EGLAPIENTRY CreatePlatformPixmapSurface(EGLDisplay dpy,
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_pixmap, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglCraetePlatformPixmaSurface unimplemented."));
@@ -1258,6 +1295,7 @@ EGLBoolean EGLAPIENTRY WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint flags = 0x%X)", dpy, sync,
           flags);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     UNIMPLEMENTED();
     thread->setError(Error(EGL_BAD_DISPLAY, "eglWaitSync unimplemented."));
@@ -1268,6 +1306,7 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
 {
     EVENT("(const char *procname = \"%s\")", procname);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     typedef std::map<std::string, __eglMustCastToProperFunctionPointerType> ProcAddressMap;
     auto generateProcAddressMap = []() {
@@ -1538,6 +1577,12 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         // GL_ANGLE_request_extension
         INSERT_PROC_ADDRESS(gl, RequestExtensionANGLE);
 
+        // GL_ANGLE_multi_draw
+        INSERT_PROC_ADDRESS(gl, MultiDrawArraysANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawArraysInstancedANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawElementsANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawElementsInstancedANGLE);
+
         // GL_ANGLE_robust_client_memory
         INSERT_PROC_ADDRESS(gl, GetBooleanvRobustANGLE);
         INSERT_PROC_ADDRESS(gl, GetBufferParameterivRobustANGLE);
@@ -1885,6 +1930,8 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         // angle::Platform related entry points
         INSERT_PROC_ADDRESS_NO_NS("ANGLEGetDisplayPlatform", ANGLEGetDisplayPlatform);
         INSERT_PROC_ADDRESS_NO_NS("ANGLEResetDisplayPlatform", ANGLEResetDisplayPlatform);
+        INSERT_PROC_ADDRESS_NO_NS("ANGLEFlushTraceRecorder", ANGLEFlushTraceRecorder);
+        INSERT_PROC_ADDRESS_NO_NS("ANGLEGetHistogramsJSON", ANGLEGetHistogramsJSON);
 
 #undef INSERT_PROC_ADDRESS
 #undef INSERT_PROC_ADDRESS_NO_NS
@@ -28,6 +28,7 @@ EGLBoolean EGLAPIENTRY QuerySurfacePointerANGLE(EGLDisplay dpy, EGLSurface surfa
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, void **value = 0x%0.8p)",
           dpy, surface, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display*>(dpy);
     Surface *eglSurface = static_cast<Surface*>(surface);
@@ -84,6 +85,7 @@ EGLBoolean EGLAPIENTRY PostSubBufferNV(EGLDisplay dpy, EGLSurface surface, EGLin
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint x = %d, EGLint y = %d, EGLint width = %d, EGLint height = %d)", dpy, surface, x, y, width, height);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     if (x < 0 || y < 0 || width < 0 || height < 0)
     {
@@ -137,6 +139,7 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplayEXT(EGLenum platform, void *native_disp
     EVENT("(EGLenum platform = %d, void* native_display = 0x%0.8p, const EGLint* attrib_list = 0x%0.8p)",
           platform, native_display, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Error err = ValidateGetPlatformDisplayEXT(platform, native_display, attrib_list);
     thread->setError(err);
@@ -169,6 +172,7 @@ EGLBoolean EGLAPIENTRY QueryDeviceAttribEXT(EGLDeviceEXT device, EGLint attribut
     EVENT("(EGLDeviceEXT device = 0x%0.8p, EGLint attribute = %d, EGLAttrib *value = 0x%0.8p)",
           device, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Device *dev = static_cast<Device*>(device);
     if (dev == EGL_NO_DEVICE_EXT || !Device::IsValidDevice(dev))
@@ -217,6 +221,7 @@ const char * EGLAPIENTRY QueryDeviceStringEXT(EGLDeviceEXT device, EGLint name)
     EVENT("(EGLDeviceEXT device = 0x%0.8p, EGLint name = %d)",
           device, name);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Device *dev = static_cast<Device*>(device);
     if (dev == EGL_NO_DEVICE_EXT || !Device::IsValidDevice(dev))
@@ -246,6 +251,7 @@ EGLBoolean EGLAPIENTRY QueryDisplayAttribEXT(EGLDisplay dpy, EGLint attribute, E
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint attribute = %d, EGLAttrib *value = 0x%0.8p)",
           dpy, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display*>(dpy);
 
@@ -289,6 +295,7 @@ ANGLE_EXPORT EGLImageKHR EGLAPIENTRY CreateImageKHR(EGLDisplay dpy,
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -316,6 +323,7 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY DestroyImageKHR(EGLDisplay dpy, EGLImageKHR
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLImage image = 0x%0.8p)", dpy, image);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
     Image *img       = static_cast<Image *>(image);
@@ -341,6 +349,7 @@ ANGLE_EXPORT EGLDeviceEXT EGLAPIENTRY CreateDeviceANGLE(EGLint device_type,
         "0x%0.8p)",
         device_type, native_device, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Error error = ValidateCreateDeviceANGLE(device_type, native_device, attrib_list);
     if (error.isError())
@@ -365,6 +374,7 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY ReleaseDeviceANGLE(EGLDeviceEXT device)
 {
     EVENT("(EGLDeviceEXT device = 0x%0.8p)", device);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Device *dev = static_cast<Device *>(device);
 
@@ -385,6 +395,7 @@ EGLStreamKHR EGLAPIENTRY CreateStreamKHR(EGLDisplay dpy, const EGLint *attrib_li
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, const EGLAttrib* attrib_list = 0x%0.8p)", dpy, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display = static_cast<Display *>(dpy);
     AttributeMap attributes = AttributeMap::CreateFromIntArray(attrib_list);
@@ -412,6 +423,7 @@ EGLBoolean EGLAPIENTRY DestroyStreamKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -438,6 +450,7 @@ EGLBoolean EGLAPIENTRY StreamAttribKHR(EGLDisplay dpy,
         "EGLint value = 0x%X)",
         dpy, stream, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -475,6 +488,7 @@ EGLBoolean EGLAPIENTRY QueryStreamKHR(EGLDisplay dpy,
         "EGLint value = 0x%0.8p)",
         dpy, stream, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -515,6 +529,7 @@ EGLBoolean EGLAPIENTRY QueryStreamu64KHR(EGLDisplay dpy,
         "EGLuint64KHR value = 0x%0.8p)",
         dpy, stream, attribute, value);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -546,6 +561,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EGLStr
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -573,6 +589,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR str
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -600,6 +617,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerReleaseKHR(EGLDisplay dpy, EGLStreamKHR str
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -631,6 +649,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerGLTextureExternalAttribsNV(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR stream = 0x%0.8p, EGLAttrib attrib_list = 0x%0.8p",
         dpy, stream, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Stream *streamObject    = static_cast<Stream *>(stream);
@@ -664,6 +683,7 @@ EGLBoolean EGLAPIENTRY CreateStreamProducerD3DTextureNV12ANGLE(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR stream = 0x%0.8p, EGLAttrib attrib_list = 0x%0.8p",
         dpy, stream, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Stream *streamObject    = static_cast<Stream *>(stream);
@@ -698,6 +718,7 @@ EGLBoolean EGLAPIENTRY StreamPostD3DTextureNV12ANGLE(EGLDisplay dpy,
         "EGLAttrib attrib_list = 0x%0.8p",
         dpy, stream, texture, attrib_list);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display        = static_cast<Display *>(dpy);
     Stream *streamObject    = static_cast<Stream *>(stream);
@@ -732,6 +753,7 @@ EGLBoolean EGLAPIENTRY GetSyncValuesCHROMIUM(EGLDisplay dpy,
         "EGLuint64KHR* msc = 0x%0.8p, EGLuint64KHR* sbc = 0x%0.8p",
         dpy, surface, ust, msc, sbc);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -764,6 +786,7 @@ ANGLE_EXPORT EGLBoolean SwapBuffersWithDamageEXT(EGLDisplay dpy,
         "n_rects = %d)",
         dpy, surface, rects, n_rects);
     Thread *thread = GetCurrentThread();
+    std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
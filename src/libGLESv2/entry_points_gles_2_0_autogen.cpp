@@ -12,7 +12,7 @@
 
 #include "common/debug.h"
 #include "libANGLE/Context.h"
-#include "libANGLE/validationES2.h"
+#include "libANGLE/dispatch_table_autogen.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -21,15 +21,10 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ActiveTexture>(texture);
-
-        if (context->skipValidation() || ValidateActiveTexture(context, texture))
-        {
-            context->activeTexture(texture);
-        }
+        context->getDispatchTable()->activeTexture(context, texture);
     }
 }
 
@@ -37,15 +32,10 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %d, GLuint shader = %d)", program, shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::AttachShader>(program, shader);
-
-        if (context->skipValidation() || ValidateAttachShader(context, program, shader))
-        {
-            context->attachShader(program, shader);
-        }
+        context->getDispatchTable()->attachShader(context, program, shader);
     }
 }
 
@@ -54,15 +44,10 @@ void GL_APIENTRY BindAttribLocation(GLuint program, GLuint index, const GLchar *
     EVENT("(GLuint program = %d, GLuint index = %d, const GLchar *name = 0x%0.8p)", program, index,
           name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BindAttribLocation>(program, index, name);
-
-        if (context->skipValidation() || ValidateBindAttribLocation(context, program, index, name))
-        {
-            context->bindAttribLocation(program, index, name);
-        }
+        context->getDispatchTable()->bindAttribLocation(context, program, index, name);
     }
 }
 
@@ -70,15 +55,10 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint buffer = %d)", target, buffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BindBuffer>(target, buffer);
-
-        if (context->skipValidation() || ValidateBindBuffer(context, target, buffer))
-        {
-            context->bindBuffer(target, buffer);
-        }
+        context->getDispatchTable()->bindBuffer(context, target, buffer);
     }
 }
 
@@ -86,15 +66,10 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %d)", target, framebuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BindFramebuffer>(target, framebuffer);
-
-        if (context->skipValidation() || ValidateBindFramebuffer(context, target, framebuffer))
-        {
-            context->bindFramebuffer(target, framebuffer);
-        }
+        context->getDispatchTable()->bindFramebuffer(context, target, framebuffer);
     }
 }
 
@@ -102,15 +77,10 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %d)", target, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BindRenderbuffer>(target, renderbuffer);
-
-        if (context->skipValidation() || ValidateBindRenderbuffer(context, target, renderbuffer))
-        {
-            context->bindRenderbuffer(target, renderbuffer);
-        }
+        context->getDispatchTable()->bindRenderbuffer(context, target, renderbuffer);
     }
 }
 
@@ -118,15 +88,10 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 {
     EVENT("(GLenum target = 0x%X, GLuint texture = %d)", target, texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BindTexture>(target, texture);
-
-        if (context->skipValidation() || ValidateBindTexture(context, target, texture))
-        {
-            context->bindTexture(target, texture);
-        }
+        context->getDispatchTable()->bindTexture(context, target, texture);
     }
 }
 
@@ -135,15 +100,10 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BlendColor>(red, green, blue, alpha);
-
-        if (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha))
-        {
-            context->blendColor(red, green, blue, alpha);
-        }
+        context->getDispatchTable()->blendColor(context, red, green, blue, alpha);
     }
 }
 
@@ -151,15 +111,10 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BlendEquation>(mode);
-
-        if (context->skipValidation() || ValidateBlendEquation(context, mode))
-        {
-            context->blendEquation(mode);
-        }
+        context->getDispatchTable()->blendEquation(context, mode);
     }
 }
 
@@ -167,15 +122,10 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     EVENT("(GLenum modeRGB = 0x%X, GLenum modeAlpha = 0x%X)", modeRGB, modeAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BlendEquationSeparate>(modeRGB, modeAlpha);
-
-        if (context->skipValidation() || ValidateBlendEquationSeparate(context, modeRGB, modeAlpha))
-        {
-            context->blendEquationSeparate(modeRGB, modeAlpha);
-        }
+        context->getDispatchTable()->blendEquationSeparate(context, modeRGB, modeAlpha);
     }
 }
 
@@ -183,15 +133,10 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     EVENT("(GLenum sfactor = 0x%X, GLenum dfactor = 0x%X)", sfactor, dfactor);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BlendFunc>(sfactor, dfactor);
-
-        if (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor))
-        {
-            context->blendFunc(sfactor, dfactor);
-        }
+        context->getDispatchTable()->blendFunc(context, sfactor, dfactor);
     }
 }
 
@@ -205,17 +150,11 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
         "dfactorAlpha = 0x%X)",
         sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BlendFuncSeparate>(sfactorRGB, dfactorRGB, sfactorAlpha,
-                                                             dfactorAlpha);
-
-        if (context->skipValidation() ||
-            ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
-        {
-            context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
-        }
+        context->getDispatchTable()->blendFuncSeparate(context, sfactorRGB, dfactorRGB,
+                                                       sfactorAlpha, dfactorAlpha);
     }
 }
 
@@ -226,15 +165,10 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
         "0x%X)",
         target, size, data, usage);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BufferData>(target, size, data, usage);
-
-        if (context->skipValidation() || ValidateBufferData(context, target, size, data, usage))
-        {
-            context->bufferData(target, size, data, usage);
-        }
+        context->getDispatchTable()->bufferData(context, target, size, data, usage);
     }
 }
 
@@ -245,15 +179,10 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
         "0x%0.8p)",
         target, offset, size, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::BufferSubData>(target, offset, size, data);
-
-        if (context->skipValidation() || ValidateBufferSubData(context, target, offset, size, data))
-        {
-            context->bufferSubData(target, offset, size, data);
-        }
+        context->getDispatchTable()->bufferSubData(context, target, offset, size, data);
     }
 }
 
@@ -261,15 +190,10 @@ GLenum GL_APIENTRY CheckFramebufferStatus(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CheckFramebufferStatus>(target);
-
-        if (context->skipValidation() || ValidateCheckFramebufferStatus(context, target))
-        {
-            return context->checkFramebufferStatus(target);
-        }
+        return context->getDispatchTable()->checkFramebufferStatus(context, target);
     }
 
     return 0;
@@ -279,15 +203,10 @@ void GL_APIENTRY Clear(GLbitfield mask)
 {
     EVENT("(GLbitfield mask = 0x%X)", mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Clear>(mask);
-
-        if (context->skipValidation() || ValidateClear(context, mask))
-        {
-            context->clear(mask);
-        }
+        context->getDispatchTable()->clear(context, mask);
     }
 }
 
@@ -296,15 +215,10 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ClearColor>(red, green, blue, alpha);
-
-        if (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha))
-        {
-            context->clearColor(red, green, blue, alpha);
-        }
+        context->getDispatchTable()->clearColor(context, red, green, blue, alpha);
     }
 }
 
@@ -312,15 +226,10 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 {
     EVENT("(GLfloat d = %f)", d);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ClearDepthf>(d);
-
-        if (context->skipValidation() || ValidateClearDepthf(context, d))
-        {
-            context->clearDepthf(d);
-        }
+        context->getDispatchTable()->clearDepthf(context, d);
     }
 }
 
@@ -328,15 +237,10 @@ void GL_APIENTRY ClearStencil(GLint s)
 {
     EVENT("(GLint s = %d)", s);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ClearStencil>(s);
-
-        if (context->skipValidation() || ValidateClearStencil(context, s))
-        {
-            context->clearStencil(s);
-        }
+        context->getDispatchTable()->clearStencil(context, s);
     }
 }
 
@@ -345,15 +249,10 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     EVENT("(GLboolean red = %u, GLboolean green = %u, GLboolean blue = %u, GLboolean alpha = %u)",
           red, green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ColorMask>(red, green, blue, alpha);
-
-        if (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha))
-        {
-            context->colorMask(red, green, blue, alpha);
-        }
+        context->getDispatchTable()->colorMask(context, red, green, blue, alpha);
     }
 }
 
@@ -361,15 +260,10 @@ void GL_APIENTRY CompileShader(GLuint shader)
 {
     EVENT("(GLuint shader = %d)", shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CompileShader>(shader);
-
-        if (context->skipValidation() || ValidateCompileShader(context, shader))
-        {
-            context->compileShader(shader);
-        }
+        context->getDispatchTable()->compileShader(context, shader);
     }
 }
 
@@ -388,19 +282,11 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target,
         "0x%0.8p)",
         target, level, internalformat, width, height, border, imageSize, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CompressedTexImage2D>(
-            target, level, internalformat, width, height, border, imageSize, data);
-
-        if (context->skipValidation() ||
-            ValidateCompressedTexImage2D(context, target, level, internalformat, width, height,
-                                         border, imageSize, data))
-        {
-            context->compressedTexImage2D(target, level, internalformat, width, height, border,
-                                          imageSize, data);
-        }
+        context->getDispatchTable()->compressedTexImage2D(context, target, level, internalformat,
+                                                          width, height, border, imageSize, data);
     }
 }
 
@@ -420,19 +306,12 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target,
         "*data = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, imageSize, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CompressedTexSubImage2D>(
-            target, level, xoffset, yoffset, width, height, format, imageSize, data);
-
-        if (context->skipValidation() ||
-            ValidateCompressedTexSubImage2D(context, target, level, xoffset, yoffset, width, height,
-                                            format, imageSize, data))
-        {
-            context->compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
-                                             imageSize, data);
-        }
+        context->getDispatchTable()->compressedTexSubImage2D(context, target, level, xoffset,
+                                                             yoffset, width, height, format,
+                                                             imageSize, data);
     }
 }
 
@@ -450,18 +329,11 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
         "GLint y = %d, GLsizei width = %d, GLsizei height = %d, GLint border = %d)",
         target, level, internalformat, x, y, width, height, border);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CopyTexImage2D>(target, level, internalformat, x, y,
-                                                          width, height, border);
-
-        if (context->skipValidation() ||
-            ValidateCopyTexImage2D(context, target, level, internalformat, x, y, width, height,
-                                   border))
-        {
-            context->copyTexImage2D(target, level, internalformat, x, y, width, height, border);
-        }
+        context->getDispatchTable()->copyTexImage2D(context, target, level, internalformat, x, y,
+                                                    width, height, border);
     }
 }
 
@@ -479,17 +351,11 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
         "= %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, x, y, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CopyTexSubImage2D>(target, level, xoffset, yoffset, x, y,
-                                                             width, height);
-
-        if (context->skipValidation() || ValidateCopyTexSubImage2D(context, target, level, xoffset,
-                                                                   yoffset, x, y, width, height))
-        {
-            context->copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
-        }
+        context->getDispatchTable()->copyTexSubImage2D(context, target, level, xoffset, yoffset, x,
+                                                       y, width, height);
     }
 }
 
@@ -497,15 +363,10 @@ GLuint GL_APIENTRY CreateProgram()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CreateProgram>();
-
-        if (context->skipValidation() || ValidateCreateProgram(context))
-        {
-            return context->createProgram();
-        }
+        return context->getDispatchTable()->createProgram(context);
     }
 
     return 0;
@@ -515,15 +376,10 @@ GLuint GL_APIENTRY CreateShader(GLenum type)
 {
     EVENT("(GLenum type = 0x%X)", type);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CreateShader>(type);
-
-        if (context->skipValidation() || ValidateCreateShader(context, type))
-        {
-            return context->createShader(type);
-        }
+        return context->getDispatchTable()->createShader(context, type);
     }
 
     return 0;
@@ -533,15 +389,10 @@ void GL_APIENTRY CullFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::CullFace>(mode);
-
-        if (context->skipValidation() || ValidateCullFace(context, mode))
-        {
-            context->cullFace(mode);
-        }
+        context->getDispatchTable()->cullFace(context, mode);
     }
 }
 
@@ -549,15 +400,10 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *buffers = 0x%0.8p)", n, buffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteBuffers>(n, buffers);
-
-        if (context->skipValidation() || ValidateDeleteBuffers(context, n, buffers))
-        {
-            context->deleteBuffers(n, buffers);
-        }
+        context->getDispatchTable()->deleteBuffers(context, n, buffers);
     }
 }
 
@@ -565,15 +411,10 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteFramebuffers>(n, framebuffers);
-
-        if (context->skipValidation() || ValidateDeleteFramebuffers(context, n, framebuffers))
-        {
-            context->deleteFramebuffers(n, framebuffers);
-        }
+        context->getDispatchTable()->deleteFramebuffers(context, n, framebuffers);
     }
 }
 
@@ -581,15 +422,10 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 {
     EVENT("(GLuint program = %d)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteProgram>(program);
-
-        if (context->skipValidation() || ValidateDeleteProgram(context, program))
-        {
-            context->deleteProgram(program);
-        }
+        context->getDispatchTable()->deleteProgram(context, program);
     }
 }
 
@@ -597,15 +433,10 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteRenderbuffers>(n, renderbuffers);
-
-        if (context->skipValidation() || ValidateDeleteRenderbuffers(context, n, renderbuffers))
-        {
-            context->deleteRenderbuffers(n, renderbuffers);
-        }
+        context->getDispatchTable()->deleteRenderbuffers(context, n, renderbuffers);
     }
 }
 
@@ -613,15 +444,10 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 {
     EVENT("(GLuint shader = %d)", shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteShader>(shader);
-
-        if (context->skipValidation() || ValidateDeleteShader(context, shader))
-        {
-            context->deleteShader(shader);
-        }
+        context->getDispatchTable()->deleteShader(context, shader);
     }
 }
 
@@ -629,15 +455,10 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint *textures)
 {
     EVENT("(GLsizei n = %d, const GLuint *textures = 0x%0.8p)", n, textures);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DeleteTextures>(n, textures);
-
-        if (context->skipValidation() || ValidateDeleteTextures(context, n, textures))
-        {
-            context->deleteTextures(n, textures);
-        }
+        context->getDispatchTable()->deleteTextures(context, n, textures);
     }
 }
 
@@ -645,15 +466,10 @@ void GL_APIENTRY DepthFunc(GLenum func)
 {
     EVENT("(GLenum func = 0x%X)", func);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DepthFunc>(func);
-
-        if (context->skipValidation() || ValidateDepthFunc(context, func))
-        {
-            context->depthFunc(func);
-        }
+        context->getDispatchTable()->depthFunc(context, func);
     }
 }
 
@@ -661,15 +477,10 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 {
     EVENT("(GLboolean flag = %u)", flag);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DepthMask>(flag);
-
-        if (context->skipValidation() || ValidateDepthMask(context, flag))
-        {
-            context->depthMask(flag);
-        }
+        context->getDispatchTable()->depthMask(context, flag);
     }
 }
 
@@ -677,15 +488,10 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 {
     EVENT("(GLfloat n = %f, GLfloat f = %f)", n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DepthRangef>(n, f);
-
-        if (context->skipValidation() || ValidateDepthRangef(context, n, f))
-        {
-            context->depthRangef(n, f);
-        }
+        context->getDispatchTable()->depthRangef(context, n, f);
     }
 }
 
@@ -693,15 +499,10 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %d, GLuint shader = %d)", program, shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DetachShader>(program, shader);
-
-        if (context->skipValidation() || ValidateDetachShader(context, program, shader))
-        {
-            context->detachShader(program, shader);
-        }
+        context->getDispatchTable()->detachShader(context, program, shader);
     }
 }
 
@@ -709,15 +510,10 @@ void GL_APIENTRY Disable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Disable>(cap);
-
-        if (context->skipValidation() || ValidateDisable(context, cap))
-        {
-            context->disable(cap);
-        }
+        context->getDispatchTable()->disable(context, cap);
     }
 }
 
@@ -725,15 +521,10 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %d)", index);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DisableVertexAttribArray>(index);
-
-        if (context->skipValidation() || ValidateDisableVertexAttribArray(context, index))
-        {
-            context->disableVertexAttribArray(index);
-        }
+        context->getDispatchTable()->disableVertexAttribArray(context, index);
     }
 }
 
@@ -741,15 +532,10 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d)", mode, first, count);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DrawArrays>(mode, first, count);
-
-        if (context->skipValidation() || ValidateDrawArrays(context, mode, first, count))
-        {
-            context->drawArrays(mode, first, count);
-        }
+        context->getDispatchTable()->drawArrays(context, mode, first, count);
     }
 }
 
@@ -760,15 +546,10 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
         "0x%0.8p)",
         mode, count, type, indices);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::DrawElements>(mode, count, type, indices);
-
-        if (context->skipValidation() || ValidateDrawElements(context, mode, count, type, indices))
-        {
-            context->drawElements(mode, count, type, indices);
-        }
+        context->getDispatchTable()->drawElements(context, mode, count, type, indices);
     }
 }
 
@@ -776,15 +557,10 @@ void GL_APIENTRY Enable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Enable>(cap);
-
-        if (context->skipValidation() || ValidateEnable(context, cap))
-        {
-            context->enable(cap);
-        }
+        context->getDispatchTable()->enable(context, cap);
     }
 }
 
@@ -792,15 +568,10 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %d)", index);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::EnableVertexAttribArray>(index);
-
-        if (context->skipValidation() || ValidateEnableVertexAttribArray(context, index))
-        {
-            context->enableVertexAttribArray(index);
-        }
+        context->getDispatchTable()->enableVertexAttribArray(context, index);
     }
 }
 
@@ -808,15 +579,10 @@ void GL_APIENTRY Finish()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Finish>();
-
-        if (context->skipValidation() || ValidateFinish(context))
-        {
-            context->finish();
-        }
+        context->getDispatchTable()->finish(context);
     }
 }
 
@@ -824,15 +590,10 @@ void GL_APIENTRY Flush()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Flush>();
-
-        if (context->skipValidation() || ValidateFlush(context))
-        {
-            context->flush();
-        }
+        context->getDispatchTable()->flush(context);
     }
 }
 
@@ -846,18 +607,11 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
         "renderbuffer = %d)",
         target, attachment, renderbuffertarget, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::FramebufferRenderbuffer>(
-            target, attachment, renderbuffertarget, renderbuffer);
-
-        if (context->skipValidation() ||
-            ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
-                                            renderbuffer))
-        {
-            context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
-        }
+        context->getDispatchTable()->framebufferRenderbuffer(context, target, attachment,
+                                                             renderbuffertarget, renderbuffer);
     }
 }
 
@@ -872,17 +626,11 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
         "= %d, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::FramebufferTexture2D>(target, attachment, textarget,
-                                                                texture, level);
-
-        if (context->skipValidation() ||
-            ValidateFramebufferTexture2D(context, target, attachment, textarget, texture, level))
-        {
-            context->framebufferTexture2D(target, attachment, textarget, texture, level);
-        }
+        context->getDispatchTable()->framebufferTexture2D(context, target, attachment, textarget,
+                                                          texture, level);
     }
 }
 
@@ -890,15 +638,10 @@ void GL_APIENTRY FrontFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::FrontFace>(mode);
-
-        if (context->skipValidation() || ValidateFrontFace(context, mode))
-        {
-            context->frontFace(mode);
-        }
+        context->getDispatchTable()->frontFace(context, mode);
     }
 }
 
@@ -906,15 +649,10 @@ void GL_APIENTRY GenBuffers(GLsizei n, GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, GLuint *buffers = 0x%0.8p)", n, buffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GenBuffers>(n, buffers);
-
-        if (context->skipValidation() || ValidateGenBuffers(context, n, buffers))
-        {
-            context->genBuffers(n, buffers);
-        }
+        context->getDispatchTable()->genBuffers(context, n, buffers);
     }
 }
 
@@ -922,15 +660,10 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GenerateMipmap>(target);
-
-        if (context->skipValidation() || ValidateGenerateMipmap(context, target))
-        {
-            context->generateMipmap(target);
-        }
+        context->getDispatchTable()->generateMipmap(context, target);
     }
 }
 
@@ -938,15 +671,10 @@ void GL_APIENTRY GenFramebuffers(GLsizei n, GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GenFramebuffers>(n, framebuffers);
-
-        if (context->skipValidation() || ValidateGenFramebuffers(context, n, framebuffers))
-        {
-            context->genFramebuffers(n, framebuffers);
-        }
+        context->getDispatchTable()->genFramebuffers(context, n, framebuffers);
     }
 }
 
@@ -954,15 +682,10 @@ void GL_APIENTRY GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GenRenderbuffers>(n, renderbuffers);
-
-        if (context->skipValidation() || ValidateGenRenderbuffers(context, n, renderbuffers))
-        {
-            context->genRenderbuffers(n, renderbuffers);
-        }
+        context->getDispatchTable()->genRenderbuffers(context, n, renderbuffers);
     }
 }
 
@@ -970,15 +693,10 @@ void GL_APIENTRY GenTextures(GLsizei n, GLuint *textures)
 {
     EVENT("(GLsizei n = %d, GLuint *textures = 0x%0.8p)", n, textures);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GenTextures>(n, textures);
-
-        if (context->skipValidation() || ValidateGenTextures(context, n, textures))
-        {
-            context->genTextures(n, textures);
-        }
+        context->getDispatchTable()->genTextures(context, n, textures);
     }
 }
 
@@ -995,17 +713,11 @@ void GL_APIENTRY GetActiveAttrib(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetActiveAttrib>(program, index, bufSize, length, size,
-                                                           type, name);
-
-        if (context->skipValidation() ||
-            ValidateGetActiveAttrib(context, program, index, bufSize, length, size, type, name))
-        {
-            context->getActiveAttrib(program, index, bufSize, length, size, type, name);
-        }
+        context->getDispatchTable()->getActiveAttrib(context, program, index, bufSize, length, size,
+                                                     type, name);
     }
 }
 
@@ -1022,17 +734,11 @@ void GL_APIENTRY GetActiveUniform(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetActiveUniform>(program, index, bufSize, length, size,
-                                                            type, name);
-
-        if (context->skipValidation() ||
-            ValidateGetActiveUniform(context, program, index, bufSize, length, size, type, name))
-        {
-            context->getActiveUniform(program, index, bufSize, length, size, type, name);
-        }
+        context->getDispatchTable()->getActiveUniform(context, program, index, bufSize, length,
+                                                      size, type, name);
     }
 }
 
@@ -1046,16 +752,10 @@ void GL_APIENTRY GetAttachedShaders(GLuint program,
         "0x%0.8p)",
         program, maxCount, count, shaders);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetAttachedShaders>(program, maxCount, count, shaders);
-
-        if (context->skipValidation() ||
-            ValidateGetAttachedShaders(context, program, maxCount, count, shaders))
-        {
-            context->getAttachedShaders(program, maxCount, count, shaders);
-        }
+        context->getDispatchTable()->getAttachedShaders(context, program, maxCount, count, shaders);
     }
 }
 
@@ -1063,15 +763,10 @@ GLint GL_APIENTRY GetAttribLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %d, const GLchar *name = 0x%0.8p)", program, name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetAttribLocation>(program, name);
-
-        if (context->skipValidation() || ValidateGetAttribLocation(context, program, name))
-        {
-            return context->getAttribLocation(program, name);
-        }
+        return context->getDispatchTable()->getAttribLocation(context, program, name);
     }
 
     return 0;
@@ -1081,15 +776,10 @@ void GL_APIENTRY GetBooleanv(GLenum pname, GLboolean *data)
 {
     EVENT("(GLenum pname = 0x%X, GLboolean *data = 0x%0.8p)", pname, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetBooleanv>(pname, data);
-
-        if (context->skipValidation() || ValidateGetBooleanv(context, pname, data))
-        {
-            context->getBooleanv(pname, data);
-        }
+        context->getDispatchTable()->getBooleanv(context, pname, data);
     }
 }
 
@@ -1098,16 +788,10 @@ void GL_APIENTRY GetBufferParameteriv(GLenum target, GLenum pname, GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetBufferParameteriv>(target, pname, params);
-
-        if (context->skipValidation() ||
-            ValidateGetBufferParameteriv(context, target, pname, params))
-        {
-            context->getBufferParameteriv(target, pname, params);
-        }
+        context->getDispatchTable()->getBufferParameteriv(context, target, pname, params);
     }
 }
 
@@ -1115,15 +799,10 @@ GLenum GL_APIENTRY GetError()
 {
     EVENT("()");
 
-    Context *context = GetGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetError>();
-
-        if (context->skipValidation() || ValidateGetError(context))
-        {
-            return context->getError();
-        }
+        return context->getDispatchTable()->getError(context);
     }
 
     return 0;
@@ -1133,15 +812,10 @@ void GL_APIENTRY GetFloatv(GLenum pname, GLfloat *data)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat *data = 0x%0.8p)", pname, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetFloatv>(pname, data);
-
-        if (context->skipValidation() || ValidateGetFloatv(context, pname, data))
-        {
-            context->getFloatv(pname, data);
-        }
+        context->getDispatchTable()->getFloatv(context, pname, data);
     }
 }
 
@@ -1155,17 +829,11 @@ void GL_APIENTRY GetFramebufferAttachmentParameteriv(GLenum target,
         "0x%0.8p)",
         target, attachment, pname, params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetFramebufferAttachmentParameteriv>(target, attachment,
-                                                                               pname, params);
-
-        if (context->skipValidation() ||
-            ValidateGetFramebufferAttachmentParameteriv(context, target, attachment, pname, params))
-        {
-            context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
-        }
+        context->getDispatchTable()->getFramebufferAttachmentParameteriv(context, target,
+                                                                         attachment, pname, params);
     }
 }
 
@@ -1173,15 +841,10 @@ void GL_APIENTRY GetIntegerv(GLenum pname, GLint *data)
 {
     EVENT("(GLenum pname = 0x%X, GLint *data = 0x%0.8p)", pname, data);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetIntegerv>(pname, data);
-
-        if (context->skipValidation() || ValidateGetIntegerv(context, pname, data))
-        {
-            context->getIntegerv(pname, data);
-        }
+        context->getDispatchTable()->getIntegerv(context, pname, data);
     }
 }
 
@@ -1190,15 +853,10 @@ void GL_APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint *params)
     EVENT("(GLuint program = %d, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", program, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetProgramiv>(program, pname, params);
-
-        if (context->skipValidation() || ValidateGetProgramiv(context, program, pname, params))
-        {
-            context->getProgramiv(program, pname, params);
-        }
+        context->getDispatchTable()->getProgramiv(context, program, pname, params);
     }
 }
 
@@ -1212,16 +870,10 @@ void GL_APIENTRY GetProgramInfoLog(GLuint program,
         "0x%0.8p)",
         program, bufSize, length, infoLog);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetProgramInfoLog>(program, bufSize, length, infoLog);
-
-        if (context->skipValidation() ||
-            ValidateGetProgramInfoLog(context, program, bufSize, length, infoLog))
-        {
-            context->getProgramInfoLog(program, bufSize, length, infoLog);
-        }
+        context->getDispatchTable()->getProgramInfoLog(context, program, bufSize, length, infoLog);
     }
 }
 
@@ -1230,16 +882,10 @@ void GL_APIENTRY GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetRenderbufferParameteriv>(target, pname, params);
-
-        if (context->skipValidation() ||
-            ValidateGetRenderbufferParameteriv(context, target, pname, params))
-        {
-            context->getRenderbufferParameteriv(target, pname, params);
-        }
+        context->getDispatchTable()->getRenderbufferParameteriv(context, target, pname, params);
     }
 }
 
@@ -1248,15 +894,10 @@ void GL_APIENTRY GetShaderiv(GLuint shader, GLenum pname, GLint *params)
     EVENT("(GLuint shader = %d, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", shader, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetShaderiv>(shader, pname, params);
-
-        if (context->skipValidation() || ValidateGetShaderiv(context, shader, pname, params))
-        {
-            context->getShaderiv(shader, pname, params);
-        }
+        context->getDispatchTable()->getShaderiv(context, shader, pname, params);
     }
 }
 
@@ -1267,16 +908,10 @@ void GL_APIENTRY GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *lengt
         "0x%0.8p)",
         shader, bufSize, length, infoLog);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetShaderInfoLog>(shader, bufSize, length, infoLog);
-
-        if (context->skipValidation() ||
-            ValidateGetShaderInfoLog(context, shader, bufSize, length, infoLog))
-        {
-            context->getShaderInfoLog(shader, bufSize, length, infoLog);
-        }
+        context->getDispatchTable()->getShaderInfoLog(context, shader, bufSize, length, infoLog);
     }
 }
 
@@ -1290,17 +925,11 @@ void GL_APIENTRY GetShaderPrecisionFormat(GLenum shadertype,
         "*precision = 0x%0.8p)",
         shadertype, precisiontype, range, precision);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetShaderPrecisionFormat>(shadertype, precisiontype,
-                                                                    range, precision);
-
-        if (context->skipValidation() ||
-            ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype, range, precision))
-        {
-            context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
-        }
+        context->getDispatchTable()->getShaderPrecisionFormat(context, shadertype, precisiontype,
+                                                              range, precision);
     }
 }
 
@@ -1311,16 +940,10 @@ void GL_APIENTRY GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length
         "0x%0.8p)",
         shader, bufSize, length, source);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetShaderSource>(shader, bufSize, length, source);
-
-        if (context->skipValidation() ||
-            ValidateGetShaderSource(context, shader, bufSize, length, source))
-        {
-            context->getShaderSource(shader, bufSize, length, source);
-        }
+        context->getDispatchTable()->getShaderSource(context, shader, bufSize, length, source);
     }
 }
 
@@ -1328,15 +951,10 @@ const GLubyte *GL_APIENTRY GetString(GLenum name)
 {
     EVENT("(GLenum name = 0x%X)", name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetString>(name);
-
-        if (context->skipValidation() || ValidateGetString(context, name))
-        {
-            return context->getString(name);
-        }
+        return context->getDispatchTable()->getString(context, name);
     }
 
     return nullptr;
@@ -1347,15 +965,10 @@ void GL_APIENTRY GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", target, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetTexParameterfv>(target, pname, params);
-
-        if (context->skipValidation() || ValidateGetTexParameterfv(context, target, pname, params))
-        {
-            context->getTexParameterfv(target, pname, params);
-        }
+        context->getDispatchTable()->getTexParameterfv(context, target, pname, params);
     }
 }
 
@@ -1364,15 +977,10 @@ void GL_APIENTRY GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetTexParameteriv>(target, pname, params);
-
-        if (context->skipValidation() || ValidateGetTexParameteriv(context, target, pname, params))
-        {
-            context->getTexParameteriv(target, pname, params);
-        }
+        context->getDispatchTable()->getTexParameteriv(context, target, pname, params);
     }
 }
 
@@ -1381,15 +989,10 @@ void GL_APIENTRY GetUniformfv(GLuint program, GLint location, GLfloat *params)
     EVENT("(GLuint program = %d, GLint location = %d, GLfloat *params = 0x%0.8p)", program,
           location, params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetUniformfv>(program, location, params);
-
-        if (context->skipValidation() || ValidateGetUniformfv(context, program, location, params))
-        {
-            context->getUniformfv(program, location, params);
-        }
+        context->getDispatchTable()->getUniformfv(context, program, location, params);
     }
 }
 
@@ -1398,15 +1001,10 @@ void GL_APIENTRY GetUniformiv(GLuint program, GLint location, GLint *params)
     EVENT("(GLuint program = %d, GLint location = %d, GLint *params = 0x%0.8p)", program, location,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetUniformiv>(program, location, params);
-
-        if (context->skipValidation() || ValidateGetUniformiv(context, program, location, params))
-        {
-            context->getUniformiv(program, location, params);
-        }
+        context->getDispatchTable()->getUniformiv(context, program, location, params);
     }
 }
 
@@ -1414,15 +1012,10 @@ GLint GL_APIENTRY GetUniformLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %d, const GLchar *name = 0x%0.8p)", program, name);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetUniformLocation>(program, name);
-
-        if (context->skipValidation() || ValidateGetUniformLocation(context, program, name))
-        {
-            return context->getUniformLocation(program, name);
-        }
+        return context->getDispatchTable()->getUniformLocation(context, program, name);
     }
 
     return 0;
@@ -1433,15 +1026,10 @@ void GL_APIENTRY GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
     EVENT("(GLuint index = %d, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", index, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetVertexAttribfv>(index, pname, params);
-
-        if (context->skipValidation() || ValidateGetVertexAttribfv(context, index, pname, params))
-        {
-            context->getVertexAttribfv(index, pname, params);
-        }
+        context->getDispatchTable()->getVertexAttribfv(context, index, pname, params);
     }
 }
 
@@ -1450,15 +1038,10 @@ void GL_APIENTRY GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
     EVENT("(GLuint index = %d, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", index, pname,
           params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetVertexAttribiv>(index, pname, params);
-
-        if (context->skipValidation() || ValidateGetVertexAttribiv(context, index, pname, params))
-        {
-            context->getVertexAttribiv(index, pname, params);
-        }
+        context->getDispatchTable()->getVertexAttribiv(context, index, pname, params);
     }
 }
 
@@ -1467,16 +1050,10 @@ void GL_APIENTRY GetVertexAttribPointerv(GLuint index, GLenum pname, void **poin
     EVENT("(GLuint index = %d, GLenum pname = 0x%X, void **pointer = 0x%0.8p)", index, pname,
           pointer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::GetVertexAttribPointerv>(index, pname, pointer);
-
-        if (context->skipValidation() ||
-            ValidateGetVertexAttribPointerv(context, index, pname, pointer))
-        {
-            context->getVertexAttribPointerv(index, pname, pointer);
-        }
+        context->getDispatchTable()->getVertexAttribPointerv(context, index, pname, pointer);
     }
 }
 
@@ -1484,15 +1061,10 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 {
     EVENT("(GLenum target = 0x%X, GLenum mode = 0x%X)", target, mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Hint>(target, mode);
-
-        if (context->skipValidation() || ValidateHint(context, target, mode))
-        {
-            context->hint(target, mode);
-        }
+        context->getDispatchTable()->hint(context, target, mode);
     }
 }
 
@@ -1500,15 +1072,10 @@ GLboolean GL_APIENTRY IsBuffer(GLuint buffer)
 {
     EVENT("(GLuint buffer = %d)", buffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsBuffer>(buffer);
-
-        if (context->skipValidation() || ValidateIsBuffer(context, buffer))
-        {
-            return context->isBuffer(buffer);
-        }
+        return context->getDispatchTable()->isBuffer(context, buffer);
     }
 
     return GL_FALSE;
@@ -1518,15 +1085,10 @@ GLboolean GL_APIENTRY IsEnabled(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsEnabled>(cap);
-
-        if (context->skipValidation() || ValidateIsEnabled(context, cap))
-        {
-            return context->isEnabled(cap);
-        }
+        return context->getDispatchTable()->isEnabled(context, cap);
     }
 
     return GL_FALSE;
@@ -1536,15 +1098,10 @@ GLboolean GL_APIENTRY IsFramebuffer(GLuint framebuffer)
 {
     EVENT("(GLuint framebuffer = %d)", framebuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsFramebuffer>(framebuffer);
-
-        if (context->skipValidation() || ValidateIsFramebuffer(context, framebuffer))
-        {
-            return context->isFramebuffer(framebuffer);
-        }
+        return context->getDispatchTable()->isFramebuffer(context, framebuffer);
     }
 
     return GL_FALSE;
@@ -1554,15 +1111,10 @@ GLboolean GL_APIENTRY IsProgram(GLuint program)
 {
     EVENT("(GLuint program = %d)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsProgram>(program);
-
-        if (context->skipValidation() || ValidateIsProgram(context, program))
-        {
-            return context->isProgram(program);
-        }
+        return context->getDispatchTable()->isProgram(context, program);
     }
 
     return GL_FALSE;
@@ -1572,15 +1124,10 @@ GLboolean GL_APIENTRY IsRenderbuffer(GLuint renderbuffer)
 {
     EVENT("(GLuint renderbuffer = %d)", renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsRenderbuffer>(renderbuffer);
-
-        if (context->skipValidation() || ValidateIsRenderbuffer(context, renderbuffer))
-        {
-            return context->isRenderbuffer(renderbuffer);
-        }
+        return context->getDispatchTable()->isRenderbuffer(context, renderbuffer);
     }
 
     return GL_FALSE;
@@ -1590,15 +1137,10 @@ GLboolean GL_APIENTRY IsShader(GLuint shader)
 {
     EVENT("(GLuint shader = %d)", shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsShader>(shader);
-
-        if (context->skipValidation() || ValidateIsShader(context, shader))
-        {
-            return context->isShader(shader);
-        }
+        return context->getDispatchTable()->isShader(context, shader);
     }
 
     return GL_FALSE;
@@ -1608,15 +1150,10 @@ GLboolean GL_APIENTRY IsTexture(GLuint texture)
 {
     EVENT("(GLuint texture = %d)", texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::IsTexture>(texture);
-
-        if (context->skipValidation() || ValidateIsTexture(context, texture))
-        {
-            return context->isTexture(texture);
-        }
+        return context->getDispatchTable()->isTexture(context, texture);
     }
 
     return GL_FALSE;
@@ -1626,15 +1163,10 @@ void GL_APIENTRY LineWidth(GLfloat width)
 {
     EVENT("(GLfloat width = %f)", width);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::LineWidth>(width);
-
-        if (context->skipValidation() || ValidateLineWidth(context, width))
-        {
-            context->lineWidth(width);
-        }
+        context->getDispatchTable()->lineWidth(context, width);
     }
 }
 
@@ -1642,15 +1174,10 @@ void GL_APIENTRY LinkProgram(GLuint program)
 {
     EVENT("(GLuint program = %d)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::LinkProgram>(program);
-
-        if (context->skipValidation() || ValidateLinkProgram(context, program))
-        {
-            context->linkProgram(program);
-        }
+        context->getDispatchTable()->linkProgram(context, program);
     }
 }
 
@@ -1658,15 +1185,10 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 {
     EVENT("(GLenum pname = 0x%X, GLint param = %d)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::PixelStorei>(pname, param);
-
-        if (context->skipValidation() || ValidatePixelStorei(context, pname, param))
-        {
-            context->pixelStorei(pname, param);
-        }
+        context->getDispatchTable()->pixelStorei(context, pname, param);
     }
 }
 
@@ -1674,15 +1196,10 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 {
     EVENT("(GLfloat factor = %f, GLfloat units = %f)", factor, units);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::PolygonOffset>(factor, units);
-
-        if (context->skipValidation() || ValidatePolygonOffset(context, factor, units))
-        {
-            context->polygonOffset(factor, units);
-        }
+        context->getDispatchTable()->polygonOffset(context, factor, units);
     }
 }
 
@@ -1699,16 +1216,10 @@ void GL_APIENTRY ReadPixels(GLint x,
         "0x%X, GLenum type = 0x%X, void *pixels = 0x%0.8p)",
         x, y, width, height, format, type, pixels);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ReadPixels>(x, y, width, height, format, type, pixels);
-
-        if (context->skipValidation() ||
-            ValidateReadPixels(context, x, y, width, height, format, type, pixels))
-        {
-            context->readPixels(x, y, width, height, format, type, pixels);
-        }
+        context->getDispatchTable()->readPixels(context, x, y, width, height, format, type, pixels);
     }
 }
 
@@ -1716,15 +1227,10 @@ void GL_APIENTRY ReleaseShaderCompiler()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ReleaseShaderCompiler>();
-
-        if (context->skipValidation() || ValidateReleaseShaderCompiler(context))
-        {
-            context->releaseShaderCompiler();
-        }
+        context->getDispatchTable()->releaseShaderCompiler(context);
     }
 }
 
@@ -1738,17 +1244,11 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::RenderbufferStorage>(target, internalformat, width,
-                                                               height);
-
-        if (context->skipValidation() ||
-            ValidateRenderbufferStorage(context, target, internalformat, width, height))
-        {
-            context->renderbufferStorage(target, internalformat, width, height);
-        }
+        context->getDispatchTable()->renderbufferStorage(context, target, internalformat, width,
+                                                         height);
     }
 }
 
@@ -1756,15 +1256,10 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 {
     EVENT("(GLfloat value = %f, GLboolean invert = %u)", value, invert);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::SampleCoverage>(value, invert);
-
-        if (context->skipValidation() || ValidateSampleCoverage(context, value, invert))
-        {
-            context->sampleCoverage(value, invert);
-        }
+        context->getDispatchTable()->sampleCoverage(context, value, invert);
     }
 }
 
@@ -1773,15 +1268,10 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Scissor>(x, y, width, height);
-
-        if (context->skipValidation() || ValidateScissor(context, x, y, width, height))
-        {
-            context->scissor(x, y, width, height);
-        }
+        context->getDispatchTable()->scissor(context, x, y, width, height);
     }
 }
 
@@ -1796,17 +1286,11 @@ void GL_APIENTRY ShaderBinary(GLsizei count,
         "void *binary = 0x%0.8p, GLsizei length = %d)",
         count, shaders, binaryformat, binary, length);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ShaderBinary>(count, shaders, binaryformat, binary,
-                                                        length);
-
-        if (context->skipValidation() ||
-            ValidateShaderBinary(context, count, shaders, binaryformat, binary, length))
-        {
-            context->shaderBinary(count, shaders, binaryformat, binary, length);
-        }
+        context->getDispatchTable()->shaderBinary(context, count, shaders, binaryformat, binary,
+                                                  length);
     }
 }
 
@@ -1820,16 +1304,10 @@ void GL_APIENTRY ShaderSource(GLuint shader,
         "GLint *length = 0x%0.8p)",
         shader, count, string, length);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ShaderSource>(shader, count, string, length);
-
-        if (context->skipValidation() ||
-            ValidateShaderSource(context, shader, count, string, length))
-        {
-            context->shaderSource(shader, count, string, length);
-        }
+        context->getDispatchTable()->shaderSource(context, shader, count, string, length);
     }
 }
 
@@ -1837,15 +1315,10 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %d)", func, ref, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilFunc>(func, ref, mask);
-
-        if (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask))
-        {
-            context->stencilFunc(func, ref, mask);
-        }
+        context->getDispatchTable()->stencilFunc(context, func, ref, mask);
     }
 }
 
@@ -1854,16 +1327,10 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
     EVENT("(GLenum face = 0x%X, GLenum func = 0x%X, GLint ref = %d, GLuint mask = %d)", face, func,
           ref, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilFuncSeparate>(face, func, ref, mask);
-
-        if (context->skipValidation() ||
-            ValidateStencilFuncSeparate(context, face, func, ref, mask))
-        {
-            context->stencilFuncSeparate(face, func, ref, mask);
-        }
+        context->getDispatchTable()->stencilFuncSeparate(context, face, func, ref, mask);
     }
 }
 
@@ -1871,15 +1338,10 @@ void GL_APIENTRY StencilMask(GLuint mask)
 {
     EVENT("(GLuint mask = %d)", mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilMask>(mask);
-
-        if (context->skipValidation() || ValidateStencilMask(context, mask))
-        {
-            context->stencilMask(mask);
-        }
+        context->getDispatchTable()->stencilMask(context, mask);
     }
 }
 
@@ -1887,15 +1349,10 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 {
     EVENT("(GLenum face = 0x%X, GLuint mask = %d)", face, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilMaskSeparate>(face, mask);
-
-        if (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask))
-        {
-            context->stencilMaskSeparate(face, mask);
-        }
+        context->getDispatchTable()->stencilMaskSeparate(context, face, mask);
     }
 }
 
@@ -1903,15 +1360,10 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     EVENT("(GLenum fail = 0x%X, GLenum zfail = 0x%X, GLenum zpass = 0x%X)", fail, zfail, zpass);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilOp>(fail, zfail, zpass);
-
-        if (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass))
-        {
-            context->stencilOp(fail, zfail, zpass);
-        }
+        context->getDispatchTable()->stencilOp(context, fail, zfail, zpass);
     }
 }
 
@@ -1920,16 +1372,10 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
     EVENT("(GLenum face = 0x%X, GLenum sfail = 0x%X, GLenum dpfail = 0x%X, GLenum dppass = 0x%X)",
           face, sfail, dpfail, dppass);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::StencilOpSeparate>(face, sfail, dpfail, dppass);
-
-        if (context->skipValidation() ||
-            ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass))
-        {
-            context->stencilOpSeparate(face, sfail, dpfail, dppass);
-        }
+        context->getDispatchTable()->stencilOpSeparate(context, face, sfail, dpfail, dppass);
     }
 }
 
@@ -1949,19 +1395,11 @@ void GL_APIENTRY TexImage2D(GLenum target,
         "void *pixels = 0x%0.8p)",
         target, level, internalformat, width, height, border, format, type, pixels);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexImage2D>(target, level, internalformat, width, height,
-                                                      border, format, type, pixels);
-
-        if (context->skipValidation() ||
-            ValidateTexImage2D(context, target, level, internalformat, width, height, border,
-                               format, type, pixels))
-        {
-            context->texImage2D(target, level, internalformat, width, height, border, format, type,
-                                pixels);
-        }
+        context->getDispatchTable()->texImage2D(context, target, level, internalformat, width,
+                                                height, border, format, type, pixels);
     }
 }
 
@@ -1969,15 +1407,10 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexParameterf>(target, pname, param);
-
-        if (context->skipValidation() || ValidateTexParameterf(context, target, pname, param))
-        {
-            context->texParameterf(target, pname, param);
-        }
+        context->getDispatchTable()->texParameterf(context, target, pname, param);
     }
 }
 
@@ -1986,15 +1419,10 @@ void GL_APIENTRY TexParameterfv(GLenum target, GLenum pname, const GLfloat *para
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", target,
           pname, params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexParameterfv>(target, pname, params);
-
-        if (context->skipValidation() || ValidateTexParameterfv(context, target, pname, params))
-        {
-            context->texParameterfv(target, pname, params);
-        }
+        context->getDispatchTable()->texParameterfv(context, target, pname, params);
     }
 }
 
@@ -2002,15 +1430,10 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexParameteri>(target, pname, param);
-
-        if (context->skipValidation() || ValidateTexParameteri(context, target, pname, param))
-        {
-            context->texParameteri(target, pname, param);
-        }
+        context->getDispatchTable()->texParameteri(context, target, pname, param);
     }
 }
 
@@ -2019,15 +1442,10 @@ void GL_APIENTRY TexParameteriv(GLenum target, GLenum pname, const GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLint *params = 0x%0.8p)", target,
           pname, params);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexParameteriv>(target, pname, params);
-
-        if (context->skipValidation() || ValidateTexParameteriv(context, target, pname, params))
-        {
-            context->texParameteriv(target, pname, params);
-        }
+        context->getDispatchTable()->texParameteriv(context, target, pname, params);
     }
 }
 
@@ -2047,19 +1465,11 @@ void GL_APIENTRY TexSubImage2D(GLenum target,
         "*pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, type, pixels);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::TexSubImage2D>(target, level, xoffset, yoffset, width,
-                                                         height, format, type, pixels);
-
-        if (context->skipValidation() ||
-            ValidateTexSubImage2D(context, target, level, xoffset, yoffset, width, height, format,
-                                  type, pixels))
-        {
-            context->texSubImage2D(target, level, xoffset, yoffset, width, height, format, type,
-                                   pixels);
-        }
+        context->getDispatchTable()->texSubImage2D(context, target, level, xoffset, yoffset, width,
+                                                   height, format, type, pixels);
     }
 }
 
@@ -2067,15 +1477,10 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f)", location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform1f>(location, v0);
-
-        if (context->skipValidation() || ValidateUniform1f(context, location, v0))
-        {
-            context->uniform1f(location, v0);
-        }
+        context->getDispatchTable()->uniform1f(context, location, v0);
     }
 }
 
@@ -2084,15 +1489,10 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform1fv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform1fv(context, location, count, value))
-        {
-            context->uniform1fv(location, count, value);
-        }
+        context->getDispatchTable()->uniform1fv(context, location, count, value);
     }
 }
 
@@ -2100,15 +1500,10 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 {
     EVENT("(GLint location = %d, GLint v0 = %d)", location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform1i>(location, v0);
-
-        if (context->skipValidation() || ValidateUniform1i(context, location, v0))
-        {
-            context->uniform1i(location, v0);
-        }
+        context->getDispatchTable()->uniform1i(context, location, v0);
     }
 }
 
@@ -2117,15 +1512,10 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform1iv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform1iv(context, location, count, value))
-        {
-            context->uniform1iv(location, count, value);
-        }
+        context->getDispatchTable()->uniform1iv(context, location, count, value);
     }
 }
 
@@ -2133,15 +1523,10 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform2f>(location, v0, v1);
-
-        if (context->skipValidation() || ValidateUniform2f(context, location, v0, v1))
-        {
-            context->uniform2f(location, v0, v1);
-        }
+        context->getDispatchTable()->uniform2f(context, location, v0, v1);
     }
 }
 
@@ -2150,15 +1535,10 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform2fv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform2fv(context, location, count, value))
-        {
-            context->uniform2fv(location, count, value);
-        }
+        context->getDispatchTable()->uniform2fv(context, location, count, value);
     }
 }
 
@@ -2166,15 +1546,10 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 {
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d)", location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform2i>(location, v0, v1);
-
-        if (context->skipValidation() || ValidateUniform2i(context, location, v0, v1))
-        {
-            context->uniform2i(location, v0, v1);
-        }
+        context->getDispatchTable()->uniform2i(context, location, v0, v1);
     }
 }
 
@@ -2183,15 +1558,10 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform2iv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform2iv(context, location, count, value))
-        {
-            context->uniform2iv(location, count, value);
-        }
+        context->getDispatchTable()->uniform2iv(context, location, count, value);
     }
 }
 
@@ -2200,15 +1570,10 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f)", location, v0,
           v1, v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform3f>(location, v0, v1, v2);
-
-        if (context->skipValidation() || ValidateUniform3f(context, location, v0, v1, v2))
-        {
-            context->uniform3f(location, v0, v1, v2);
-        }
+        context->getDispatchTable()->uniform3f(context, location, v0, v1, v2);
     }
 }
 
@@ -2217,15 +1582,10 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform3fv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform3fv(context, location, count, value))
-        {
-            context->uniform3fv(location, count, value);
-        }
+        context->getDispatchTable()->uniform3fv(context, location, count, value);
     }
 }
 
@@ -2234,15 +1594,10 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)", location, v0, v1,
           v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform3i>(location, v0, v1, v2);
-
-        if (context->skipValidation() || ValidateUniform3i(context, location, v0, v1, v2))
-        {
-            context->uniform3i(location, v0, v1, v2);
-        }
+        context->getDispatchTable()->uniform3i(context, location, v0, v1, v2);
     }
 }
 
@@ -2251,15 +1606,10 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform3iv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform3iv(context, location, count, value))
-        {
-            context->uniform3iv(location, count, value);
-        }
+        context->getDispatchTable()->uniform3iv(context, location, count, value);
     }
 }
 
@@ -2269,15 +1619,10 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
         "(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f, GLfloat v3 = %f)",
         location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform4f>(location, v0, v1, v2, v3);
-
-        if (context->skipValidation() || ValidateUniform4f(context, location, v0, v1, v2, v3))
-        {
-            context->uniform4f(location, v0, v1, v2, v3);
-        }
+        context->getDispatchTable()->uniform4f(context, location, v0, v1, v2, v3);
     }
 }
 
@@ -2286,15 +1631,10 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform4fv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform4fv(context, location, count, value))
-        {
-            context->uniform4fv(location, count, value);
-        }
+        context->getDispatchTable()->uniform4fv(context, location, count, value);
     }
 }
 
@@ -2303,15 +1643,10 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d, GLint v3 = %d)",
           location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform4i>(location, v0, v1, v2, v3);
-
-        if (context->skipValidation() || ValidateUniform4i(context, location, v0, v1, v2, v3))
-        {
-            context->uniform4i(location, v0, v1, v2, v3);
-        }
+        context->getDispatchTable()->uniform4i(context, location, v0, v1, v2, v3);
     }
 }
 
@@ -2320,15 +1655,10 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Uniform4iv>(location, count, value);
-
-        if (context->skipValidation() || ValidateUniform4iv(context, location, count, value))
-        {
-            context->uniform4iv(location, count, value);
-        }
+        context->getDispatchTable()->uniform4iv(context, location, count, value);
     }
 }
 
@@ -2342,16 +1672,10 @@ void GL_APIENTRY UniformMatrix2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::UniformMatrix2fv>(location, count, transpose, value);
-
-        if (context->skipValidation() ||
-            ValidateUniformMatrix2fv(context, location, count, transpose, value))
-        {
-            context->uniformMatrix2fv(location, count, transpose, value);
-        }
+        context->getDispatchTable()->uniformMatrix2fv(context, location, count, transpose, value);
     }
 }
 
@@ -2365,16 +1689,10 @@ void GL_APIENTRY UniformMatrix3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::UniformMatrix3fv>(location, count, transpose, value);
-
-        if (context->skipValidation() ||
-            ValidateUniformMatrix3fv(context, location, count, transpose, value))
-        {
-            context->uniformMatrix3fv(location, count, transpose, value);
-        }
+        context->getDispatchTable()->uniformMatrix3fv(context, location, count, transpose, value);
     }
 }
 
@@ -2388,16 +1706,10 @@ void GL_APIENTRY UniformMatrix4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::UniformMatrix4fv>(location, count, transpose, value);
-
-        if (context->skipValidation() ||
-            ValidateUniformMatrix4fv(context, location, count, transpose, value))
-        {
-            context->uniformMatrix4fv(location, count, transpose, value);
-        }
+        context->getDispatchTable()->uniformMatrix4fv(context, location, count, transpose, value);
     }
 }
 
@@ -2405,15 +1717,10 @@ void GL_APIENTRY UseProgram(GLuint program)
 {
     EVENT("(GLuint program = %d)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::UseProgram>(program);
-
-        if (context->skipValidation() || ValidateUseProgram(context, program))
-        {
-            context->useProgram(program);
-        }
+        context->getDispatchTable()->useProgram(context, program);
     }
 }
 
@@ -2421,15 +1728,10 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 {
     EVENT("(GLuint program = %d)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::ValidateProgram>(program);
-
-        if (context->skipValidation() || ValidateValidateProgram(context, program))
-        {
-            context->validateProgram(program);
-        }
+        context->getDispatchTable()->validateProgram(context, program);
     }
 }
 
@@ -2437,15 +1739,10 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 {
     EVENT("(GLuint index = %d, GLfloat x = %f)", index, x);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib1f>(index, x);
-
-        if (context->skipValidation() || ValidateVertexAttrib1f(context, index, x))
-        {
-            context->vertexAttrib1f(index, x);
-        }
+        context->getDispatchTable()->vertexAttrib1f(context, index, x);
     }
 }
 
@@ -2453,15 +1750,10 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %d, const GLfloat *v = 0x%0.8p)", index, v);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib1fv>(index, v);
-
-        if (context->skipValidation() || ValidateVertexAttrib1fv(context, index, v))
-        {
-            context->vertexAttrib1fv(index, v);
-        }
+        context->getDispatchTable()->vertexAttrib1fv(context, index, v);
     }
 }
 
@@ -2469,15 +1761,10 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
     EVENT("(GLuint index = %d, GLfloat x = %f, GLfloat y = %f)", index, x, y);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib2f>(index, x, y);
-
-        if (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y))
-        {
-            context->vertexAttrib2f(index, x, y);
-        }
+        context->getDispatchTable()->vertexAttrib2f(context, index, x, y);
     }
 }
 
@@ -2485,15 +1772,10 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %d, const GLfloat *v = 0x%0.8p)", index, v);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib2fv>(index, v);
-
-        if (context->skipValidation() || ValidateVertexAttrib2fv(context, index, v))
-        {
-            context->vertexAttrib2fv(index, v);
-        }
+        context->getDispatchTable()->vertexAttrib2fv(context, index, v);
     }
 }
 
@@ -2501,15 +1783,10 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLuint index = %d, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", index, x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib3f>(index, x, y, z);
-
-        if (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z))
-        {
-            context->vertexAttrib3f(index, x, y, z);
-        }
+        context->getDispatchTable()->vertexAttrib3f(context, index, x, y, z);
     }
 }
 
@@ -2517,15 +1794,10 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %d, const GLfloat *v = 0x%0.8p)", index, v);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib3fv>(index, v);
-
-        if (context->skipValidation() || ValidateVertexAttrib3fv(context, index, v))
-        {
-            context->vertexAttrib3fv(index, v);
-        }
+        context->getDispatchTable()->vertexAttrib3fv(context, index, v);
     }
 }
 
@@ -2534,15 +1806,10 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
     EVENT("(GLuint index = %d, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat w = %f)",
           index, x, y, z, w);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib4f>(index, x, y, z, w);
-
-        if (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w))
-        {
-            context->vertexAttrib4f(index, x, y, z, w);
-        }
+        context->getDispatchTable()->vertexAttrib4f(context, index, x, y, z, w);
     }
 }
 
@@ -2550,15 +1817,10 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %d, const GLfloat *v = 0x%0.8p)", index, v);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttrib4fv>(index, v);
-
-        if (context->skipValidation() || ValidateVertexAttrib4fv(context, index, v))
-        {
-            context->vertexAttrib4fv(index, v);
-        }
+        context->getDispatchTable()->vertexAttrib4fv(context, index, v);
     }
 }
 
@@ -2574,17 +1836,11 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
         "GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         index, size, type, normalized, stride, pointer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::VertexAttribPointer>(index, size, type, normalized,
-                                                               stride, pointer);
-
-        if (context->skipValidation() ||
-            ValidateVertexAttribPointer(context, index, size, type, normalized, stride, pointer))
-        {
-            context->vertexAttribPointer(index, size, type, normalized, stride, pointer);
-        }
+        context->getDispatchTable()->vertexAttribPointer(context, index, size, type, normalized,
+                                                         stride, pointer);
     }
 }
 
@@ -2593,15 +1849,10 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetCurrentContext();
     if (context)
     {
-        context->gatherParams<EntryPoint::Viewport>(x, y, width, height);
-
-        if (context->skipValidation() || ValidateViewport(context, x, y, width, height))
-        {
-            context->viewport(x, y, width, height);
-        }
+        context->getDispatchTable()->viewport(context, x, y, width, height);
     }
 }
 }  // namespace gl
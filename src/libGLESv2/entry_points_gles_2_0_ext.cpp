@@ -3539,4 +3539,110 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjectui64vRobustANGLE(GLuint id,
     }
 }
 
+void GL_APIENTRY MultiDrawArraysANGLE(GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLint *firsts = 0x%0.8p, const GLsizei *counts = 0x%0.8p, "
+        "GLsizei drawcount = %d)",
+        mode, firsts, counts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawArraysANGLE(context, mode, firsts, counts, drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawArrays(mode, firsts, counts, drawcount);
+    }
+}
+
+void GL_APIENTRY MultiDrawArraysInstancedANGLE(GLenum mode,
+                                               const GLint *firsts,
+                                               const GLsizei *counts,
+                                               const GLsizei *instanceCounts,
+                                               GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLint *firsts = 0x%0.8p, const GLsizei *counts = 0x%0.8p, "
+        "const GLsizei *instanceCounts = 0x%0.8p, GLsizei drawcount = %d)",
+        mode, firsts, counts, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawArraysInstancedANGLE(context, mode, firsts, counts, instanceCounts,
+                                                   drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawArraysInstanced(mode, firsts, counts, instanceCounts, drawcount);
+    }
+}
+
+void GL_APIENTRY MultiDrawElementsANGLE(GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const void *const *indices,
+                                        GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLsizei *counts = 0x%0.8p, GLenum type = 0x%X, "
+        "const void *const *indices = 0x%0.8p, GLsizei drawcount = %d)",
+        mode, counts, type, indices, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        context->gatherParams<EntryPoint::MultiDrawElementsANGLE>(mode, counts, type, indices,
+                                                                  drawcount);
+
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawElementsANGLE(context, mode, counts, type, indices, drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawElements(mode, counts, type, indices, drawcount);
+    }
+}
+
+void GL_APIENTRY MultiDrawElementsInstancedANGLE(GLenum mode,
+                                                 const GLsizei *counts,
+                                                 GLenum type,
+                                                 const void *const *indices,
+                                                 const GLsizei *instanceCounts,
+                                                 GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLsizei *counts = 0x%0.8p, GLenum type = 0x%X, "
+        "const void *const *indices = 0x%0.8p, const GLsizei *instanceCounts = 0x%0.8p, "
+        "GLsizei drawcount = %d)",
+        mode, counts, type, indices, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        context->gatherParams<EntryPoint::MultiDrawElementsInstancedANGLE>(
+            mode, counts, type, indices, instanceCounts, drawcount);
+
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawElementsInstancedANGLE(context, mode, counts, type, indices,
+                                                     instanceCounts, drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawElementsInstanced(mode, counts, type, indices, instanceCounts,
+                                            drawcount);
+    }
+}
+
 }  // gl
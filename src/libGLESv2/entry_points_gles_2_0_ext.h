@@ -698,6 +698,28 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjectui64vRobustANGLE(GLuint id,
                                                              GLsizei *length,
                                                              GLuint64 *params);
 
+// GL_ANGLE_multi_draw
+ANGLE_EXPORT void GL_APIENTRY MultiDrawArraysANGLE(GLenum mode,
+                                                   const GLint *firsts,
+                                                   const GLsizei *counts,
+                                                   GLsizei drawcount);
+ANGLE_EXPORT void GL_APIENTRY MultiDrawArraysInstancedANGLE(GLenum mode,
+                                                            const GLint *firsts,
+                                                            const GLsizei *counts,
+                                                            const GLsizei *instanceCounts,
+                                                            GLsizei drawcount);
+ANGLE_EXPORT void GL_APIENTRY MultiDrawElementsANGLE(GLenum mode,
+                                                     const GLsizei *counts,
+                                                     GLenum type,
+                                                     const void *const *indices,
+                                                     GLsizei drawcount);
+ANGLE_EXPORT void GL_APIENTRY MultiDrawElementsInstancedANGLE(GLenum mode,
+                                                              const GLsizei *counts,
+                                                              GLenum type,
+                                                              const void *const *indices,
+                                                              const GLsizei *instanceCounts,
+                                                              GLsizei drawcount);
+
 }  // namespace gl
 
 #endif  // LIBGLESV2_ENTRYPOINTGLES20EXT_H_
@@ -29,22 +29,6 @@
 namespace gl
 {
 
-void GL_APIENTRY ReadBuffer(GLenum mode)
-{
-    EVENT("(GLenum mode = 0x%X)", mode);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() && !ValidateReadBuffer(context, mode))
-        {
-            return;
-        }
-
-        context->readBuffer(mode);
-    }
-}
-
 void GL_APIENTRY DrawRangeElements(GLenum mode,
                                    GLuint start,
                                    GLuint end,
@@ -139,35 +123,6 @@ void GL_APIENTRY TexSubImage3D(GLenum target,
     }
 }
 
-void GL_APIENTRY CopyTexSubImage3D(GLenum target,
-                                   GLint level,
-                                   GLint xoffset,
-                                   GLint yoffset,
-                                   GLint zoffset,
-                                   GLint x,
-                                   GLint y,
-                                   GLsizei width,
-                                   GLsizei height)
-{
-    EVENT(
-        "(GLenum target = 0x%X, GLint level = %d, GLint xoffset = %d, GLint yoffset = %d, "
-        "GLint zoffset = %d, GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
-        target, level, xoffset, yoffset, zoffset, x, y, width, height);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateCopyTexSubImage3D(context, target, level, xoffset, yoffset, zoffset, x, y,
-                                       width, height))
-        {
-            return;
-        }
-
-        context->copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
-    }
-}
-
 void GL_APIENTRY CompressedTexImage3D(GLenum target,
                                       GLint level,
                                       GLenum internalformat,
@@ -553,64 +508,6 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location,
     }
 }
 
-void GL_APIENTRY BlitFramebuffer(GLint srcX0,
-                                 GLint srcY0,
-                                 GLint srcX1,
-                                 GLint srcY1,
-                                 GLint dstX0,
-                                 GLint dstY0,
-                                 GLint dstX1,
-                                 GLint dstY1,
-                                 GLbitfield mask,
-                                 GLenum filter)
-{
-    EVENT(
-        "(GLint srcX0 = %d, GLint srcY0 = %d, GLint srcX1 = %d, GLint srcY1 = %d, GLint dstX0 = "
-        "%d, "
-        "GLint dstY0 = %d, GLint dstX1 = %d, GLint dstY1 = %d, GLbitfield mask = 0x%X, GLenum "
-        "filter = 0x%X)",
-        srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
-                                     dstY1, mask, filter))
-        {
-            return;
-        }
-
-        context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
-                                 filter);
-    }
-}
-
-void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
-                                                GLsizei samples,
-                                                GLenum internalformat,
-                                                GLsizei width,
-                                                GLsizei height)
-{
-    EVENT(
-        "(GLenum target = 0x%X, GLsizei samples = %d, GLenum internalformat = 0x%X, GLsizei width "
-        "= %d, GLsizei height = %d)",
-        target, samples, internalformat, width, height);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateRenderbufferStorageMultisample(context, target, samples, internalformat, width,
-                                                    height))
-        {
-            return;
-        }
-
-        context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
-    }
-}
-
 void GL_APIENTRY
 FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
@@ -657,40 +554,6 @@ void *GL_APIENTRY MapBufferRange(GLenum target,
     return nullptr;
 }
 
-void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
-{
-    EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
-          length);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateFlushMappedBufferRange(context, target, offset, length))
-        {
-            return;
-        }
-
-        context->flushMappedBufferRange(target, offset, length);
-    }
-}
-
-void GL_APIENTRY BindVertexArray(GLuint array)
-{
-    EVENT("(GLuint array = %u)", array);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!ValidateBindVertexArray(context, array))
-        {
-            return;
-        }
-
-        context->bindVertexArray(array);
-    }
-}
-
 void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, const GLuint* arrays = 0x%0.8p)", n, arrays);
@@ -772,22 +635,6 @@ void GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint *data)
     }
 }
 
-void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
-{
-    EVENT("(GLenum primitiveMode = 0x%X)", primitiveMode);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() && !ValidateBeginTransformFeedback(context, primitiveMode))
-        {
-            return;
-        }
-
-        context->beginTransformFeedback(primitiveMode);
-    }
-}
-
 void GL_APIENTRY EndTransformFeedback(void)
 {
     EVENT("(void)");
@@ -834,21 +681,6 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
     }
 }
 
-void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
-{
-    EVENT("(GLenum target = 0x%X, GLuint index = %u, GLuint buffer = %u)", target, index, buffer);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() && !ValidateBindBufferBase(context, target, index, buffer))
-        {
-            return;
-        }
-        context->bindBufferBase(target, index, buffer);
-    }
-}
-
 void GL_APIENTRY TransformFeedbackVaryings(GLuint program,
                                            GLsizei count,
                                            const GLchar *const *varyings,
@@ -1297,24 +1129,6 @@ void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *v
     }
 }
 
-void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
-{
-    EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, GLfloat depth, GLint stencil = %d)",
-          buffer, drawbuffer, depth, stencil);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil))
-        {
-            return;
-        }
-
-        context->clearBufferfi(buffer, drawbuffer, depth, stencil);
-    }
-}
-
 const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index)
 {
     EVENT("(GLenum name = 0x%X, GLuint index = %u)", name, index);
@@ -1333,31 +1147,6 @@ const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index)
     return nullptr;
 }
 
-void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
-                                   GLenum writeTarget,
-                                   GLintptr readOffset,
-                                   GLintptr writeOffset,
-                                   GLsizeiptr size)
-{
-    EVENT(
-        "(GLenum readTarget = 0x%X, GLenum writeTarget = 0x%X, GLintptr readOffset = %d, GLintptr "
-        "writeOffset = %d, GLsizeiptr size = %d)",
-        readTarget, writeTarget, readOffset, writeOffset, size);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateCopyBufferSubData(context, readTarget, writeTarget, readOffset, writeOffset,
-                                       size))
-        {
-            return;
-        }
-
-        context->copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
-    }
-}
-
 void GL_APIENTRY GetUniformIndices(GLuint program,
                                    GLsizei uniformCount,
                                    const GLchar *const *uniformNames,
@@ -1610,29 +1399,6 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
     }
 }
 
-void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
-{
-    EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei instanceCount = %d)",
-          mode, first, count, instanceCount);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (context->getClientMajorVersion() < 3)
-        {
-            context->handleError(Error(GL_INVALID_OPERATION));
-            return;
-        }
-
-        if (!ValidateDrawArraysInstanced(context, mode, first, count, instanceCount))
-        {
-            return;
-        }
-
-        context->drawArraysInstanced(mode, first, count, instanceCount);
-    }
-}
-
 void GL_APIENTRY DrawElementsInstanced(GLenum mode,
                                        GLsizei count,
                                        GLenum type,
@@ -2001,23 +1767,6 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
     }
 }
 
-void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
-{
-    EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint param = %d)", sampler, pname, param);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateSamplerParameteri(context, sampler, pname, param))
-        {
-            return;
-        }
-
-        context->samplerParameteri(sampler, pname, param);
-    }
-}
-
 void GL_APIENTRY SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLint* params = 0x%0.8p)", sampler,
@@ -2036,23 +1785,6 @@ void GL_APIENTRY SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *p
     }
 }
 
-void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
-{
-    EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat param = %g)", sampler, pname, param);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateSamplerParameterf(context, sampler, pname, param))
-        {
-            return;
-        }
-
-        context->samplerParameterf(sampler, pname, param);
-    }
-}
-
 void GL_APIENTRY SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLfloat* params = 0x%0.8p)", sampler,
@@ -2359,23 +2091,6 @@ void GL_APIENTRY ProgramBinary(GLuint program,
     }
 }
 
-void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
-{
-    EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint value = %d)", program, pname, value);
-
-    Context *context = GetValidGlobalContext();
-    if (context)
-    {
-        if (!context->skipValidation() &&
-            !ValidateProgramParameteri(context, program, pname, value))
-        {
-            return;
-        }
-
-        context->programParameteri(program, pname, value);
-    }
-}
-
 void GL_APIENTRY InvalidateFramebuffer(GLenum target,
                                        GLsizei numAttachments,
                                        const GLenum *attachments)
@@ -15,7 +15,6 @@
 namespace gl
 {
 
-ANGLE_EXPORT void GL_APIENTRY ReadBuffer(GLenum mode);
 ANGLE_EXPORT void GL_APIENTRY DrawRangeElements(GLenum mode,
                                                 GLuint start,
                                                 GLuint end,
@@ -43,15 +42,6 @@ ANGLE_EXPORT void GL_APIENTRY TexSubImage3D(GLenum target,
                                             GLenum format,
                                             GLenum type,
                                             const void *pixels);
-ANGLE_EXPORT void GL_APIENTRY CopyTexSubImage3D(GLenum target,
-                                                GLint level,
-                                                GLint xoffset,
-                                                GLint yoffset,
-                                                GLint zoffset,
-                                                GLint x,
-                                                GLint y,
-                                                GLsizei width,
-                                                GLsizei height);
 ANGLE_EXPORT void GL_APIENTRY CompressedTexImage3D(GLenum target,
                                                    GLint level,
                                                    GLenum internalformat,
@@ -106,40 +96,19 @@ ANGLE_EXPORT void GL_APIENTRY UniformMatrix4x3fv(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value);
-ANGLE_EXPORT void GL_APIENTRY BlitFramebuffer(GLint srcX0,
-                                              GLint srcY0,
-                                              GLint srcX1,
-                                              GLint srcY1,
-                                              GLint dstX0,
-                                              GLint dstY0,
-                                              GLint dstX1,
-                                              GLint dstY1,
-                                              GLbitfield mask,
-                                              GLenum filter);
-ANGLE_EXPORT void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
-                                                             GLsizei samples,
-                                                             GLenum internalformat,
-                                                             GLsizei width,
-                                                             GLsizei height);
 ANGLE_EXPORT void GL_APIENTRY
 FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
 ANGLE_EXPORT void *GL_APIENTRY MapBufferRange(GLenum target,
                                               GLintptr offset,
                                               GLsizeiptr length,
                                               GLbitfield access);
-ANGLE_EXPORT void GL_APIENTRY FlushMappedBufferRange(GLenum target,
-                                                     GLintptr offset,
-                                                     GLsizeiptr length);
-ANGLE_EXPORT void GL_APIENTRY BindVertexArray(GLuint array);
 ANGLE_EXPORT void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint *arrays);
 ANGLE_EXPORT void GL_APIENTRY GenVertexArrays(GLsizei n, GLuint *arrays);
 ANGLE_EXPORT GLboolean GL_APIENTRY IsVertexArray(GLuint array);
 ANGLE_EXPORT void GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint *data);
-ANGLE_EXPORT void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode);
 ANGLE_EXPORT void GL_APIENTRY EndTransformFeedback(void);
 ANGLE_EXPORT void GL_APIENTRY
 BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
-ANGLE_EXPORT void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer);
 ANGLE_EXPORT void GL_APIENTRY TransformFeedbackVaryings(GLuint program,
                                                         GLsizei count,
                                                         const GLchar *const *varyings,
@@ -174,16 +143,7 @@ ANGLE_EXPORT void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const G
 ANGLE_EXPORT void GL_APIENTRY ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value);
 ANGLE_EXPORT void GL_APIENTRY ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value);
 ANGLE_EXPORT void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value);
-ANGLE_EXPORT void GL_APIENTRY ClearBufferfi(GLenum buffer,
-                                            GLint drawbuffer,
-                                            GLfloat depth,
-                                            GLint stencil);
 ANGLE_EXPORT const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index);
-ANGLE_EXPORT void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
-                                                GLenum writeTarget,
-                                                GLintptr readOffset,
-                                                GLintptr writeOffset,
-                                                GLsizeiptr size);
 ANGLE_EXPORT void GL_APIENTRY GetUniformIndices(GLuint program,
                                                 GLsizei uniformCount,
                                                 const GLchar *const *uniformNames,
@@ -207,10 +167,6 @@ ANGLE_EXPORT void GL_APIENTRY GetActiveUniformBlockName(GLuint program,
 ANGLE_EXPORT void GL_APIENTRY UniformBlockBinding(GLuint program,
                                                   GLuint uniformBlockIndex,
                                                   GLuint uniformBlockBinding);
-ANGLE_EXPORT void GL_APIENTRY DrawArraysInstanced(GLenum mode,
-                                                  GLint first,
-                                                  GLsizei count,
-                                                  GLsizei instanceCount);
 ANGLE_EXPORT void GL_APIENTRY DrawElementsInstanced(GLenum mode,
                                                     GLsizei count,
                                                     GLenum type,
@@ -230,9 +186,7 @@ ANGLE_EXPORT void GL_APIENTRY GenSamplers(GLsizei count, GLuint *samplers);
 ANGLE_EXPORT void GL_APIENTRY DeleteSamplers(GLsizei count, const GLuint *samplers);
 ANGLE_EXPORT GLboolean GL_APIENTRY IsSampler(GLuint sampler);
 ANGLE_EXPORT void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler);
-ANGLE_EXPORT void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param);
 ANGLE_EXPORT void GL_APIENTRY SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param);
-ANGLE_EXPORT void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param);
 ANGLE_EXPORT void GL_APIENTRY SamplerParameterfv(GLuint sampler,
                                                  GLenum pname,
                                                  const GLfloat *param);
@@ -254,7 +208,6 @@ ANGLE_EXPORT void GL_APIENTRY ProgramBinary(GLuint program,
                                             GLenum binaryFormat,
                                             const void *binary,
                                             GLsizei length);
-ANGLE_EXPORT void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value);
 ANGLE_EXPORT void GL_APIENTRY InvalidateFramebuffer(GLenum target,
                                                     GLsizei numAttachments,
                                                     const GLenum *attachments);
@@ -0,0 +1,219 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml.
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_points_gles_3_0_autogen.cpp:
+//   Defines the GLES 3.0 entry points.
+
+#include "libGLESv2/entry_points_gles_3_0_autogen.h"
+
+#include "common/debug.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/dispatch_table_autogen.h"
+#include "libGLESv2/global_state.h"
+
+namespace gl
+{
+void GL_APIENTRY ReadBuffer(GLenum src)
+{
+    EVENT("(GLenum src = 0x%X)", src);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->readBuffer(context, src);
+    }
+}
+
+void GL_APIENTRY CopyTexSubImage3D(GLenum target,
+                                   GLint level,
+                                   GLint xoffset,
+                                   GLint yoffset,
+                                   GLint zoffset,
+                                   GLint x,
+                                   GLint y,
+                                   GLsizei width,
+                                   GLsizei height)
+{
+    EVENT(
+        "(GLenum target = 0x%X, GLint level = %d, GLint xoffset = %d, GLint yoffset = %d, GLint "
+        "zoffset = %d, GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
+        target, level, xoffset, yoffset, zoffset, x, y, width, height);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->copyTexSubImage3D(context, target, level, xoffset, yoffset,
+                                                       zoffset, x, y, width, height);
+    }
+}
+
+void GL_APIENTRY BlitFramebuffer(GLint srcX0,
+                                 GLint srcY0,
+                                 GLint srcX1,
+                                 GLint srcY1,
+                                 GLint dstX0,
+                                 GLint dstY0,
+                                 GLint dstX1,
+                                 GLint dstY1,
+                                 GLbitfield mask,
+                                 GLenum filter)
+{
+    EVENT(
+        "(GLint srcX0 = %d, GLint srcY0 = %d, GLint srcX1 = %d, GLint srcY1 = %d, GLint dstX0 = "
+        "%d, GLint dstY0 = %d, GLint dstX1 = %d, GLint dstY1 = %d, GLbitfield mask = 0x%X, GLenum "
+        "filter = 0x%X)",
+        srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->blitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
+                                                     dstY0, dstX1, dstY1, mask, filter);
+    }
+}
+
+void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
+                                                GLsizei samples,
+                                                GLenum internalformat,
+                                                GLsizei width,
+                                                GLsizei height)
+{
+    EVENT(
+        "(GLenum target = 0x%X, GLsizei samples = %d, GLenum internalformat = 0x%X, GLsizei width "
+        "= %d, GLsizei height = %d)",
+        target, samples, internalformat, width, height);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->renderbufferStorageMultisample(context, target, samples,
+                                                                    internalformat, width, height);
+    }
+}
+
+void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
+          length);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->flushMappedBufferRange(context, target, offset, length);
+    }
+}
+
+void GL_APIENTRY BindVertexArray(GLuint array)
+{
+    EVENT("(GLuint array = %d)", array);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->bindVertexArray(context, array);
+    }
+}
+
+void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
+{
+    EVENT("(GLenum primitiveMode = 0x%X)", primitiveMode);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->beginTransformFeedback(context, primitiveMode);
+    }
+}
+
+void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    EVENT("(GLenum target = 0x%X, GLuint index = %d, GLuint buffer = %d)", target, index, buffer);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->bindBufferBase(context, target, index, buffer);
+    }
+}
+
+void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, GLfloat depth = %f, GLint stencil = %d)",
+          buffer, drawbuffer, depth, stencil);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->clearBufferfi(context, buffer, drawbuffer, depth, stencil);
+    }
+}
+
+void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
+                                   GLenum writeTarget,
+                                   GLintptr readOffset,
+                                   GLintptr writeOffset,
+                                   GLsizeiptr size)
+{
+    EVENT(
+        "(GLenum readTarget = 0x%X, GLenum writeTarget = 0x%X, GLintptr readOffset = %d, GLintptr "
+        "writeOffset = %d, GLsizeiptr size = %d)",
+        readTarget, writeTarget, readOffset, writeOffset, size);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->copyBufferSubData(context, readTarget, writeTarget, readOffset,
+                                                       writeOffset, size);
+    }
+}
+
+void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei instancecount = %d)",
+          mode, first, count, instancecount);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->drawArraysInstanced(context, mode, first, count,
+                                                         instancecount);
+    }
+}
+
+void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    EVENT("(GLuint sampler = %d, GLenum pname = 0x%X, GLint param = %d)", sampler, pname, param);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->samplerParameteri(context, sampler, pname, param);
+    }
+}
+
+void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    EVENT("(GLuint sampler = %d, GLenum pname = 0x%X, GLfloat param = %f)", sampler, pname, param);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->samplerParameterf(context, sampler, pname, param);
+    }
+}
+
+void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+    EVENT("(GLuint program = %d, GLenum pname = 0x%X, GLint value = %d)", program, pname, value);
+
+    Context *context = GetCurrentContext();
+    if (context)
+    {
+        context->getDispatchTable()->programParameteri(context, program, pname, value);
+    }
+}
+}  // namespace gl
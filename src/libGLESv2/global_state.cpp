@@ -8,6 +8,8 @@
 
 #include "libGLESv2/global_state.h"
 
+#include <atomic>
+
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/tls.h"
@@ -37,7 +39,7 @@ namespace egl
 namespace
 {
 
-static TLSIndex threadTLS = TLS_INVALID_INDEX;
+static std::atomic<TLSIndex> threadTLS(TLS_INVALID_INDEX);
 
 Thread *AllocateCurrentThread()
 {
@@ -62,18 +64,31 @@ Thread *AllocateCurrentThread()
 Thread *GetCurrentThread()
 {
     // Create a TLS index if one has not been created for this DLL
-    if (threadTLS == TLS_INVALID_INDEX)
+    TLSIndex tlsIndex = threadTLS.load(std::memory_order_acquire);
+    if (tlsIndex == TLS_INVALID_INDEX)
     {
-        threadTLS = CreateTLSIndex();
+        std::lock_guard<std::recursive_mutex> globalLock(GetGlobalMutex());
+        tlsIndex = threadTLS.load(std::memory_order_relaxed);
+        if (tlsIndex == TLS_INVALID_INDEX)
+        {
+            tlsIndex = CreateTLSIndex();
+            threadTLS.store(tlsIndex, std::memory_order_release);
+        }
     }
 
-    Thread *current = static_cast<Thread *>(GetTLSValue(threadTLS));
+    Thread *current = static_cast<Thread *>(GetTLSValue(tlsIndex));
 
     // ANGLE issue 488: when the dll is loaded after thread initialization,
     // thread local storage (current) might not exist yet.
     return (current ? current : AllocateCurrentThread());
 }
 
+std::recursive_mutex &GetGlobalMutex()
+{
+    static std::recursive_mutex globalMutex;
+    return globalMutex;
+}
+
 }  // namespace egl
 
 #ifdef ANGLE_PLATFORM_WINDOWS
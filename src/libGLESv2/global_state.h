@@ -9,6 +9,10 @@
 #ifndef LIBGLESV2_GLOBALSTATE_H_
 #define LIBGLESV2_GLOBALSTATE_H_
 
+#include <mutex>
+
+#include "libANGLE/Thread.h"
+
 namespace gl
 {
 class Context;
@@ -16,6 +20,13 @@ class Context;
 Context *GetGlobalContext();
 Context *GetValidGlobalContext();
 
+// Doesn't check for context loss, for the generated entry points: the dispatch table of the context
+// does.
+inline Context *GetCurrentContext()
+{
+    return gCurrentContext;
+}
+
 }  // namespace gl
 
 namespace egl
@@ -24,6 +35,14 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// Serializes the EGL calls, which create, destroy and make current the objects all threads see.
+// GL calls don't take it: they only use the current context and the locks of its share group.
+// Nothing serializes the calls they make into the back-end, which the native back-ends need. The
+// contexts of a share group may only be used from several threads at once when created with
+// EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, which only the NULL back-end supports.
+// It is recursive because some EGL entry points call others.
+std::recursive_mutex &GetGlobalMutex();
+
 }  // namespace egl
 
 #endif // LIBGLESV2_GLOBALSTATE_H_
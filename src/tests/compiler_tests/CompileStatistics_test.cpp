@@ -0,0 +1,143 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileStatistics_test.cpp:
+//   Tests for the per-stage statistics recorded with SH_COLLECT_COMPILE_STATISTICS.
+//
+
+#include <cstring>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+const char kShader[] =
+    "precision mediump float;\n"
+    "uniform vec4 u;\n"
+    "vec4 f(vec4 v) { return v * 2.0; }\n"
+    "void main() {\n"
+    "    gl_FragColor = f(u);\n"
+    "}\n";
+
+class CompileStatisticsTest : public testing::Test
+{
+  public:
+    CompileStatisticsTest() : mCompiler(nullptr) {}
+
+  protected:
+    void SetUp() override
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC,
+                                          SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+        ASSERT_TRUE(mCompiler != nullptr) << "Compiler could not be constructed.";
+    }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    bool compile(ShCompileOptions compileOptions)
+    {
+        const char *shaderStrings[] = {kShader};
+        return sh::Compile(mCompiler, shaderStrings, 1, compileOptions);
+    }
+
+    const ShCompileStageStatistics *findStage(const char *name) const
+    {
+        for (const ShCompileStageStatistics &stage : sh::GetCompileStatistics(mCompiler))
+        {
+            if (strcmp(stage.name, name) == 0)
+            {
+                return &stage;
+            }
+        }
+        return nullptr;
+    }
+
+    ShHandle mCompiler;
+};
+
+// Test that no statistics are recorded unless requested.
+TEST_F(CompileStatisticsTest, DisabledByDefault)
+{
+    ASSERT_TRUE(compile(SH_OBJECT_CODE | SH_VARIABLES));
+    EXPECT_TRUE(sh::GetCompileStatistics(mCompiler).empty());
+}
+
+// Test that the main stages are recorded and that the whole compile is reported last.
+TEST_F(CompileStatisticsTest, StagesAreRecorded)
+{
+    ASSERT_TRUE(compile(SH_OBJECT_CODE | SH_VARIABLES | SH_COLLECT_COMPILE_STATISTICS));
+
+    const std::vector<ShCompileStageStatistics> &statistics = sh::GetCompileStatistics(mCompiler);
+    ASSERT_FALSE(statistics.empty());
+    EXPECT_STREQ("Total", statistics.back().name);
+
+    const ShCompileStageStatistics *parse = findStage("Parse");
+    ASSERT_NE(nullptr, parse);
+    EXPECT_GT(parse->poolBytes, 0u);
+    EXPECT_GT(parse->poolAllocations, 0u);
+
+    EXPECT_NE(nullptr, findStage("InitCallDag"));
+    EXPECT_NE(nullptr, findStage("CollectVariables"));
+    EXPECT_NE(nullptr, findStage("Translate"));
+
+    size_t stageBytes = 0;
+    for (size_t i = 0; i + 1 < statistics.size(); ++i)
+    {
+        EXPECT_GE(statistics[i].seconds, 0.0);
+        EXPECT_LE(statistics[i].seconds, statistics.back().seconds);
+        stageBytes += statistics[i].poolBytes;
+    }
+    EXPECT_LE(stageBytes, statistics.back().poolBytes);
+}
+
+// Test that every stage lies within the whole compile, so stages can be drawn as spans nested in
+// it.
+TEST_F(CompileStatisticsTest, StagesLieWithinCompile)
+{
+    ASSERT_TRUE(compile(SH_OBJECT_CODE | SH_VARIABLES | SH_COLLECT_COMPILE_STATISTICS));
+
+    const std::vector<ShCompileStageStatistics> &statistics = sh::GetCompileStatistics(mCompiler);
+    ASSERT_FALSE(statistics.empty());
+    const ShCompileStageStatistics &total = statistics.back();
+
+    const ShCompileStageStatistics *parse     = findStage("Parse");
+    const ShCompileStageStatistics *translate = findStage("Translate");
+    ASSERT_NE(nullptr, parse);
+    ASSERT_NE(nullptr, translate);
+    EXPECT_LE(parse->startSeconds + parse->seconds, translate->startSeconds);
+
+    for (const ShCompileStageStatistics &stage : statistics)
+    {
+        EXPECT_GE(stage.startSeconds, total.startSeconds);
+        EXPECT_LE(stage.startSeconds + stage.seconds, total.startSeconds + total.seconds);
+    }
+}
+
+// Test that the statistics only describe the last compile.
+TEST_F(CompileStatisticsTest, ResetBetweenCompiles)
+{
+    ASSERT_TRUE(compile(SH_OBJECT_CODE | SH_COLLECT_COMPILE_STATISTICS));
+    size_t stageCount = sh::GetCompileStatistics(mCompiler).size();
+
+    ASSERT_TRUE(compile(SH_OBJECT_CODE | SH_COLLECT_COMPILE_STATISTICS));
+    EXPECT_EQ(stageCount, sh::GetCompileStatistics(mCompiler).size());
+
+    ASSERT_TRUE(compile(SH_OBJECT_CODE));
+    EXPECT_TRUE(sh::GetCompileStatistics(mCompiler).empty());
+}
+
+}  // anonymous namespace
@@ -35,3 +35,30 @@ TEST_F(HLSLOutputTest, DynamicIndexingOfVectorOnRightSideOfLogicalOr)
         "}\n";
     compile(shaderString);
 }
+
+// Test that the helper functions added for dynamic indexing inside a function other than main are
+// in the call graph used for HLSL output, and that pruned functions are not.
+TEST_F(HLSLOutputTest, DynamicIndexingHelpersInCallGraph)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "out vec4 my_FragColor;\n"
+        "uniform int u1;\n"
+        "vec4 unused(vec4 v) {\n"
+        "   v[u1] = 0.0;\n"
+        "   return v;\n"
+        "}\n"
+        "float read(vec4 v) {\n"
+        "   return v[u1];\n"
+        "}\n"
+        "void main() {\n"
+        "   vec4 v = vec4(1.0);\n"
+        "   v[u1 + 1] = read(v);\n"
+        "   my_FragColor = v;\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("dyn_index_vec4"));
+    EXPECT_TRUE(foundInCode("dyn_index_write_vec4"));
+    EXPECT_TRUE(notFoundInCode("unused"));
+}
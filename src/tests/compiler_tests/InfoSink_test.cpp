@@ -0,0 +1,74 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InfoSink_test.cpp:
+//   Tests for number formatting in TInfoSinkBase, which is used to emit translated code.
+//
+
+#include <limits>
+
+#include "compiler/translator/InfoSink.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+template <typename T>
+std::string Format(T value)
+{
+    TInfoSinkBase sink;
+    sink << value;
+    return sink.str();
+}
+
+// Test that integers of all widths are written in decimal.
+TEST(InfoSinkTest, Integers)
+{
+    EXPECT_EQ("0", Format(0));
+    EXPECT_EQ("-17", Format(-17));
+    EXPECT_EQ("4294967295", Format(std::numeric_limits<unsigned int>::max()));
+    EXPECT_EQ("-2147483648", Format(std::numeric_limits<int>::min()));
+    EXPECT_EQ("18446744073709551615", Format(std::numeric_limits<unsigned long long>::max()));
+    EXPECT_EQ("-9223372036854775808", Format(std::numeric_limits<long long>::min()));
+    EXPECT_EQ("42", Format(static_cast<size_t>(42)));
+}
+
+// Test that floats without a fractional part keep a decimal point so they aren't read back as
+// integers.
+TEST(InfoSinkTest, IntegralFloats)
+{
+    EXPECT_EQ("0.0", Format(0.0f));
+    EXPECT_EQ("-2.0", Format(-2.0f));
+    EXPECT_EQ("100000000.0", Format(1e8f));
+}
+
+// Test that floats are written with eight significant digits, or nine when eight don't read back
+// as the same value.
+TEST(InfoSinkTest, RoundTripFloats)
+{
+    EXPECT_EQ("0.5", Format(0.5f));
+    EXPECT_EQ("0.1", Format(0.1f));
+    EXPECT_EQ("0.30000001", Format(0.3f));
+    EXPECT_EQ("9.9999997e-06", Format(1e-5f));
+
+    const float values[] = {3.14159274f, 1.0f / 3.0f, 16777215.5f / 65536.0f,
+                            std::numeric_limits<float>::min(), -1.17549435e-38f, 2.5e-40f};
+    for (float value : values)
+    {
+        EXPECT_EQ(value, strtof(Format(value).c_str(), nullptr)) << Format(value);
+    }
+}
+
+// Test that mixing numbers and strings appends in order.
+TEST(InfoSinkTest, MixedInsertion)
+{
+    TInfoSinkBase sink;
+    sink << "vec2(" << 1.5f << ", " << 2 << "u" << ')';
+    EXPECT_EQ("vec2(1.5, 2u)", sink.str());
+}
+
+}  // anonymous namespace
@@ -43,7 +43,7 @@ class IntermNodeTest : public testing::Test
         TIntermSymbol *node = new TIntermSymbol(0, symbolName, type);
         node->setLine(createUniqueSourceLoc());
         node->setInternal(true);
-        node->getTypePointer()->setQualifier(EvqTemporary);
+        node->setQualifier(EvqTemporary);
         return node;
     }
 
@@ -68,6 +68,7 @@ class IntermNodeTest : public testing::Test
         ASSERT_NE(nullptr, copy);
         ASSERT_NE(nullptr, original);
         ASSERT_NE(original, copy);
+        ASSERT_EQ(original->getKind(), copy->getKind());
         ASSERT_EQ(original->getId(), copy->getId());
         ASSERT_EQ(original->getName().getString(), copy->getName().getString());
         ASSERT_EQ(original->getName().isInternal(), copy->getName().isInternal());
@@ -230,3 +231,67 @@ TEST_F(IntermNodeTest, DeepCopyTernaryNode)
     checkSymbolCopy(original->getFalseExpression(), copy->getFalseExpression());
 }
 
+// Check that every node reports the kind of its class, so that traversal can dispatch on it.
+TEST_F(IntermNodeTest, NodeKinds)
+{
+    TIntermSymbol *symbol = createTestSymbol();
+    EXPECT_EQ(EIntermSymbol, symbol->getKind());
+
+    TIntermBinary *binary = new TIntermBinary(EOpAdd, createTestSymbol(), createTestSymbol());
+    EXPECT_EQ(EIntermBinary, binary->getKind());
+    EXPECT_EQ(EIntermBinary, binary->deepCopy()->getKind());
+
+    TIntermUnary *unary = new TIntermUnary(EOpNegative, createTestSymbol());
+    EXPECT_EQ(EIntermUnary, unary->getKind());
+
+    TIntermBlock *block = new TIntermBlock();
+    block->appendStatement(binary);
+    EXPECT_EQ(EIntermBlock, block->getKind());
+
+    TIntermBranch *branch = new TIntermBranch(EOpReturn, nullptr);
+    EXPECT_EQ(EIntermBranch, branch->getKind());
+
+    TIntermLoop *loop = new TIntermLoop(ELoopWhile, nullptr, createTestSymbol(TType(EbtBool)),
+                                        nullptr, block);
+    EXPECT_EQ(EIntermLoop, loop->getKind());
+}
+
+// Check that the mangled name of a type is shared by its copies and rebuilt when the type changes.
+TEST_F(IntermNodeTest, TypeMangledName)
+{
+    TType type(EbtFloat, EbpHigh, EvqTemporary, 4);
+    const char *mangledName = type.getMangledName();
+    EXPECT_STREQ("vf4;", mangledName);
+
+    TType copy(type);
+    EXPECT_EQ(mangledName, copy.getMangledName());
+
+    copy.setArraySize(3u);
+    EXPECT_STREQ("vf4[3];", copy.getMangledName());
+    EXPECT_STREQ("vf4;", type.getMangledName());
+}
+
+// Check that nodes of a common type point to the same interned type, and that changing the
+// qualifier or precision of one node doesn't affect the others.
+TEST_F(IntermNodeTest, SharedCommonTypes)
+{
+    TType type(EbtFloat, EbpHigh, EvqTemporary, 4);
+    TIntermSymbol *first  = createTestSymbol(type);
+    TIntermSymbol *second = createTestSymbol(type);
+    EXPECT_EQ(&first->getType(), &second->getType());
+
+    first->setQualifier(EvqConst);
+    EXPECT_EQ(EvqConst, first->getQualifier());
+    EXPECT_EQ(EvqTemporary, second->getQualifier());
+
+    second->setPrecision(EbpMedium);
+    EXPECT_EQ(EbpHigh, first->getPrecision());
+    EXPECT_EQ(EbpMedium, second->getPrecision());
+
+    TType arrayType(type);
+    arrayType.setArraySize(2u);
+    TIntermSymbol *array = createTestSymbol(arrayType);
+    array->setPrecision(EbpLow);
+    EXPECT_EQ(2u, array->getArraySize());
+    EXPECT_EQ(EbpLow, array->getPrecision());
+}
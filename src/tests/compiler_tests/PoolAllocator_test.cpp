@@ -0,0 +1,191 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PoolAllocator_test.cpp:
+//   Tests for the pool allocator statistics and recycling options exposed through the compiler
+//   API.
+//
+
+#include <list>
+#include <sstream>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/Common.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace
+{
+
+// Builds a shader with enough helper functions to span many pool pages.
+std::string MakeShader()
+{
+    std::stringstream shader;
+    shader << "precision mediump float;\n"
+              "uniform vec4 u[16];\n";
+    for (int i = 0; i < 64; ++i)
+    {
+        shader << "vec4 f" << i << "(int i) { return u[i] * " << i << ".0 + vec4(float(i)); }\n";
+    }
+    shader << "void main() {\n"
+              "    vec4 sum = vec4(0.0);\n"
+              "    for (int i = 0; i < 16; ++i) {\n";
+    for (int i = 0; i < 64; ++i)
+    {
+        shader << "        sum += f" << i << "(i);\n";
+    }
+    shader << "    }\n"
+              "    gl_FragColor = sum;\n"
+              "}\n";
+    return shader.str();
+}
+
+class PoolAllocatorTest : public testing::Test
+{
+  public:
+    PoolAllocatorTest() : mShader(MakeShader()), mCompiler(nullptr) {}
+
+  protected:
+    void SetUp() override
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                          SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+        ASSERT_TRUE(mCompiler != nullptr) << "Compiler could not be constructed.";
+    }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    void compile()
+    {
+        const char *shaderStrings[] = {mShader.c_str()};
+        ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES))
+            << sh::GetInfoLog(mCompiler);
+    }
+
+    std::string mShader;
+    ShHandle mCompiler;
+};
+
+// Test that compiling accounts allocations and that the pages used by a compile are handed back
+// to the pool when the compile finishes.
+TEST_F(PoolAllocatorTest, CompileIsAccounted)
+{
+    ShPoolAllocatorStatistics before = sh::GetPoolAllocatorStatistics(mCompiler);
+    compile();
+    ShPoolAllocatorStatistics after = sh::GetPoolAllocatorStatistics(mCompiler);
+
+    EXPECT_GT(after.numAllocations, before.numAllocations);
+    EXPECT_GT(after.bytesAllocated, before.bytesAllocated);
+    EXPECT_GT(after.bytesAbandoned, before.bytesAbandoned);
+    EXPECT_GT(after.highWaterMark, 0u);
+    EXPECT_LE(after.highWaterMark, after.bytesAllocated - before.bytesAllocated);
+    EXPECT_EQ(before.pagesInUse, after.pagesInUse);
+    EXPECT_GT(after.pagesFree, 0u);
+}
+
+// Test that adaptive page sizing grows the page size and that repeated compiles of the same shader
+// then don't allocate from the system anymore.
+TEST_F(PoolAllocatorTest, AdaptivePageSizeReachesSteadyState)
+{
+    ShPoolAllocatorOptions options;
+    options.adaptivePageSize = true;
+    sh::SetPoolAllocatorOptions(mCompiler, options);
+
+    size_t initialPageSize = sh::GetPoolAllocatorStatistics(mCompiler).pageSize;
+
+    // Warm up: the first compiles establish the high-water mark.
+    compile();
+    compile();
+
+    ShPoolAllocatorStatistics warm = sh::GetPoolAllocatorStatistics(mCompiler);
+    EXPECT_GT(warm.pageSize, initialPageSize);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        compile();
+    }
+
+    ShPoolAllocatorStatistics steady = sh::GetPoolAllocatorStatistics(mCompiler);
+    EXPECT_EQ(warm.systemAllocations, steady.systemAllocations);
+    EXPECT_EQ(warm.pageSize, steady.pageSize);
+}
+
+// Test that the number of free pages kept between compiles can be capped.
+TEST_F(PoolAllocatorTest, RetainedPageLimit)
+{
+    compile();
+    ASSERT_GT(sh::GetPoolAllocatorStatistics(mCompiler).pagesFree, 2u);
+
+    ShPoolAllocatorOptions options;
+    options.maxRetainedPages = 2;
+    sh::SetPoolAllocatorOptions(mCompiler, options);
+    EXPECT_EQ(2u, sh::GetPoolAllocatorStatistics(mCompiler).pagesFree);
+
+    compile();
+    EXPECT_EQ(2u, sh::GetPoolAllocatorStatistics(mCompiler).pagesFree);
+}
+
+// Test that the buffers abandoned by growing containers are accounted to the pool that served them,
+// even when another pool is current by the time they are abandoned.
+TEST(PoolAllocatorAbandonedBytesTest, ContainerGrowth)
+{
+    TPoolAllocator pool;
+    TPoolAllocator otherPool;
+    pool.push();
+    otherPool.push();
+    SetGlobalPoolAllocator(&pool);
+
+    sh::TVector<int> vector;
+    vector.push_back(0);
+    size_t firstCapacity = vector.capacity();
+
+    sh::TString string("a string that is too long for the small string optimization");
+    size_t stringCapacity = string.capacity();
+
+    SetGlobalPoolAllocator(&otherPool);
+
+    while (vector.capacity() == firstCapacity)
+    {
+        vector.push_back(0);
+    }
+    string.append(stringCapacity, 'x');
+
+    EXPECT_GE(pool.getStatistics().bytesAbandoned, firstCapacity * sizeof(int) + stringCapacity);
+    EXPECT_EQ(0u, otherPool.getStatistics().bytesAbandoned);
+    EXPECT_EQ(0u, otherPool.getStatistics().numAllocations);
+
+    SetGlobalPoolAllocator(nullptr);
+    otherPool.pop();
+    pool.pop();
+}
+
+// Nodes spliced into a list whose allocator never allocated are released without a pool.
+TEST(PoolAllocatorAbandonedBytesTest, SpliceIntoUnboundList)
+{
+    TPoolAllocator pool;
+    pool.push();
+    SetGlobalPoolAllocator(&pool);
+
+    std::list<int, pool_allocator<int>> source(4, 0);
+    std::list<int, pool_allocator<int>> destination;
+    destination.splice(destination.begin(), source);
+    destination.clear();
+    EXPECT_TRUE(destination.empty());
+
+    SetGlobalPoolAllocator(nullptr);
+    pool.pop();
+}
+
+}  // anonymous namespace
@@ -90,4 +90,71 @@ TEST_F(PruneUnusedFunctionsTest, UsedFunction)
     EXPECT_TRUE(foundInCode("main(", 1));
 }
 
+// Check that functions only reachable from unused functions are removed, while the whole call
+// chain starting from main is kept
+TEST_F(PruneUnusedFunctionsTest, TransitivelyUnusedFunctions)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "float leafUsed(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "float leafUnused(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "float middleUsed(float a) {\n"
+        "    return leafUsed(a);\n"
+        "}\n"
+        "float middleUnused(float a) {\n"
+        "    return leafUnused(a) + leafUsed(a);\n"
+        "}\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(middleUsed(1.0));\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("leafUsed(", 2));
+    EXPECT_TRUE(foundInCode("middleUsed(", 2));
+    EXPECT_TRUE(notFoundInCode("leafUnused("));
+    EXPECT_TRUE(notFoundInCode("middleUnused("));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("leafUsed(", 3));
+    EXPECT_TRUE(foundInCode("leafUnused(", 2));
+    EXPECT_TRUE(foundInCode("middleUnused(", 1));
+}
+
+// Check that calls which are folded away with a constant condition don't keep their callees alive
+TEST_F(PruneUnusedFunctionsTest, CallsInFoldedBranches)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "float undefinedFunction(float a);\n"
+        "float keptIf(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "float droppedIf(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "float keptTernary(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "float droppedTernary(float a) {\n"
+        "    return a;\n"
+        "}\n"
+        "void main() {\n"
+        "    if (false) {\n"
+        "        gl_FragColor = vec4(droppedIf(1.0) + undefinedFunction(1.0));\n"
+        "    } else {\n"
+        "        gl_FragColor = vec4(keptIf(1.0));\n"
+        "    }\n"
+        "    gl_FragColor += vec4(true ? keptTernary(1.0) : droppedTernary(1.0));\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("keptIf(", 2));
+    EXPECT_TRUE(foundInCode("keptTernary(", 2));
+    EXPECT_TRUE(notFoundInCode("droppedIf("));
+    EXPECT_TRUE(notFoundInCode("droppedTernary("));
+    EXPECT_TRUE(notFoundInCode("undefinedFunction("));
+}
+
 }
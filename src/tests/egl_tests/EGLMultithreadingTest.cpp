@@ -0,0 +1,275 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLMultithreadingTest.cpp:
+//   Tests using the contexts of one share group from several threads at once.
+
+#include <gtest/gtest.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <thread>
+#include <vector>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class EGLMultithreadingTest : public ANGLETest
+{
+  protected:
+    EGLMultithreadingTest() { setMultithreadedShareGroup(true); }
+
+    // Runs on its own thread with a new context of the share group. Returns false on any error,
+    // since gtest assertions can't be used off the main thread on every platform.
+    bool createBindAndDeleteObjects(GLuint sharedTexture, GLuint sharedBuffer, size_t iterations)
+    {
+        EGLWindow *window  = getEGLWindow();
+        EGLDisplay display = window->getDisplay();
+        EGLConfig config   = window->getConfig();
+
+        const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                         window->getClientMajorVersion(),
+                                         EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, EGL_TRUE,
+                                         EGL_NONE};
+
+        EGLSurface surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        EGLContext context =
+            eglCreateContext(display, config, window->getContext(), contextAttribs);
+
+        bool success = (surface != EGL_NO_SURFACE && context != EGL_NO_CONTEXT &&
+                        eglMakeCurrent(display, surface, surface, context) == EGL_TRUE);
+
+        const GLColor color = GLColor::green;
+        for (size_t iteration = 0; success && iteration < iterations; ++iteration)
+        {
+            GLuint texture = 0;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &color);
+            glBindTexture(GL_TEXTURE_2D, sharedTexture);
+
+            GLuint buffer = 0;
+            glGenBuffers(1, &buffer);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(color), &color, GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, sharedBuffer);
+
+            glDeleteTextures(1, &texture);
+            glDeleteBuffers(1, &buffer);
+
+            success = (glIsTexture(sharedTexture) == GL_TRUE && glGetError() == GL_NO_ERROR);
+        }
+
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(display, context);
+        }
+        if (surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(display, surface);
+        }
+
+        return success;
+    }
+
+    // Runs on its own thread with a new context of the share group, and fills the shared
+    // textures and buffers that the main thread isn't using. Returns false on any error.
+    bool uploadObjects(const std::vector<GLuint> &textures, const std::vector<GLuint> &buffers)
+    {
+        EGLWindow *window  = getEGLWindow();
+        EGLDisplay display = window->getDisplay();
+        EGLConfig config   = window->getConfig();
+
+        const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                         window->getClientMajorVersion(),
+                                         EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, EGL_TRUE,
+                                         EGL_NONE};
+
+        EGLSurface surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        EGLContext context =
+            eglCreateContext(display, config, window->getContext(), contextAttribs);
+
+        bool success = (surface != EGL_NO_SURFACE && context != EGL_NO_CONTEXT &&
+                        eglMakeCurrent(display, surface, surface, context) == EGL_TRUE);
+
+        const std::vector<GLColor> pixels(kUploadSize * kUploadSize, GLColor::green);
+        for (size_t index = 0; success && index < textures.size(); ++index)
+        {
+            glBindTexture(GL_TEXTURE_2D, textures[index]);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kUploadSize, kUploadSize, 0, GL_RGBA,
+                         GL_UNSIGNED_BYTE, pixels.data());
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kUploadSize, kUploadSize / 2, GL_RGBA,
+                            GL_UNSIGNED_BYTE, pixels.data());
+
+            glBindBuffer(GL_ARRAY_BUFFER, buffers[index]);
+            glBufferData(GL_ARRAY_BUFFER, pixels.size() * sizeof(GLColor), pixels.data(),
+                         GL_STATIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLColor), pixels.data());
+
+            success = (glGetError() == GL_NO_ERROR);
+        }
+
+        // The uploads have to be finished before the main thread uses the objects.
+        glFinish();
+
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(display, context);
+        }
+        if (surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(display, surface);
+        }
+
+        return success;
+    }
+
+    static constexpr GLsizei kUploadSize = 16;
+};
+
+constexpr GLsizei EGLMultithreadingTest::kUploadSize;
+
+// Creates, binds and deletes objects of one share group from an increasing number of threads,
+// while they all bind the same shared texture and buffer.
+TEST_P(EGLMultithreadingTest, ShareGroupObjectsFromManyThreads)
+{
+    constexpr size_t kIterations = 500;
+
+    GLTexture sharedTexture;
+    glBindTexture(GL_TEXTURE_2D, sharedTexture.get());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLBuffer sharedBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, sharedBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    for (size_t threadCount : {1u, 2u, 4u, 8u})
+    {
+        std::vector<char> successes(threadCount, 0);
+        std::vector<std::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([this, &successes, &sharedTexture, &sharedBuffer, threadIndex]() {
+                successes[threadIndex] = createBindAndDeleteObjects(
+                    sharedTexture.get(), sharedBuffer.get(), kIterations);
+            });
+        }
+
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        for (char success : successes)
+        {
+            EXPECT_TRUE(success != 0) << "with " << threadCount << " threads";
+        }
+    }
+
+    EXPECT_GL_TRUE(glIsTexture(sharedTexture.get()));
+    EXPECT_GL_NO_ERROR();
+}
+
+// Uploads textures and buffers from a loader thread while the main thread keeps drawing with other
+// objects of the share group, then draws with the uploaded objects. Shared objects aren't
+// synchronized by ANGLE, so the threads never use the same object at once; run under
+// ThreadSanitizer, this checks that the share group state they both touch is.
+TEST_P(EGLMultithreadingTest, UploadFromSecondContext)
+{
+    constexpr size_t kObjectCount = 64;
+
+    const std::string &vertexShader =
+        "attribute vec4 position;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = position;\n"
+        "    texCoord = position.xy * 0.5 + 0.5;\n"
+        "}";
+    const std::string &fragmentShader =
+        "precision mediump float;\n"
+        "uniform sampler2D tex;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(tex, texCoord);\n"
+        "}";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+
+    GLTexture drawTexture;
+    glBindTexture(GL_TEXTURE_2D, drawTexture.get());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    std::vector<GLuint> textures(kObjectCount, 0);
+    std::vector<GLuint> buffers(kObjectCount, 0);
+    glGenTextures(static_cast<GLsizei>(kObjectCount), textures.data());
+    glGenBuffers(static_cast<GLsizei>(kObjectCount), buffers.data());
+    ASSERT_GL_NO_ERROR();
+
+    bool uploadSuccess = false;
+    std::thread loader([this, &textures, &buffers, &uploadSuccess]() {
+        uploadSuccess = uploadObjects(textures, buffers);
+    });
+
+    for (size_t iteration = 0; iteration < kObjectCount; ++iteration)
+    {
+        glBindTexture(GL_TEXTURE_2D, drawTexture.get());
+        drawQuad(program.get(), "position", 0.5f);
+    }
+
+    loader.join();
+    ASSERT_TRUE(uploadSuccess);
+    ASSERT_GL_NO_ERROR();
+
+    for (size_t index = 0; index < kObjectCount; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        drawQuad(program.get(), "position", 0.5f);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[index]);
+        GLint bufferSize = 0;
+        glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &bufferSize);
+        EXPECT_EQ(static_cast<GLint>(kUploadSize * kUploadSize * sizeof(GLColor)), bufferSize);
+    }
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteTextures(static_cast<GLsizei>(kObjectCount), textures.data());
+    glDeleteBuffers(static_cast<GLsizei>(kObjectCount), buffers.data());
+}
+
+// Checks that all the contexts of a share group have to opt in to the multithreaded mode.
+TEST_P(EGLMultithreadingTest, ShareGroupAttributeMustMatch)
+{
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, window->getClientMajorVersion(),
+                                     EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE, EGL_FALSE,
+                                     EGL_NONE};
+    EGLContext context =
+        eglCreateContext(display, window->getConfig(), window->getContext(), contextAttribs);
+    EXPECT_EQ(EGL_NO_CONTEXT, context);
+    EXPECT_EGL_ERROR(EGL_BAD_MATCH);
+}
+
+}  // anonymous namespace
+
+// Only the NULL back-end supports EGL_ANGLE_create_context_multithreaded_share_group; the native
+// back-ends share a single device context and don't serialize the calls into it.
+ANGLE_INSTANTIATE_TEST(EGLMultithreadingTest, ES2_NULL(), ES3_NULL());
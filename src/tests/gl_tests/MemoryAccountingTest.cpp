@@ -0,0 +1,399 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAccountingTest:
+//   Tests for GL_ANGLE_memory_accounting and EGL_ANGLE_create_context_memory_budget, which report
+//   the memory of the buffers, textures and renderbuffers of a context and of its share group.
+//
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr GLenum kContextQueries[] = {
+    GL_CONTEXT_BUFFER_MEMORY_ANGLE, GL_CONTEXT_TEXTURE_MEMORY_ANGLE,
+    GL_CONTEXT_RENDERBUFFER_MEMORY_ANGLE,
+};
+constexpr GLenum kShareGroupQueries[] = {
+    GL_SHARE_GROUP_BUFFER_MEMORY_ANGLE, GL_SHARE_GROUP_TEXTURE_MEMORY_ANGLE,
+    GL_SHARE_GROUP_RENDERBUFFER_MEMORY_ANGLE,
+};
+constexpr size_t kCategoryCount = ArraySize(kContextQueries);
+
+struct Message
+{
+    GLenum source;
+    GLenum type;
+    GLenum severity;
+};
+
+void GL_APIENTRY Callback(GLenum source,
+                          GLenum type,
+                          GLuint id,
+                          GLenum severity,
+                          GLsizei length,
+                          const GLchar *message,
+                          const void *userParam)
+{
+    std::vector<Message> *messages =
+        static_cast<std::vector<Message> *>(const_cast<void *>(userParam));
+    messages->push_back({source, type, severity});
+}
+
+// The messages sent when a context goes over its budget.
+size_t CountBudgetMessages(const std::vector<Message> &messages)
+{
+    size_t count = 0;
+    for (const Message &message : messages)
+    {
+        if (message.source == GL_DEBUG_SOURCE_API && message.type == GL_DEBUG_TYPE_PERFORMANCE &&
+            message.severity == GL_DEBUG_SEVERITY_HIGH)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+class MemoryAccountingTest : public ANGLETest
+{
+  protected:
+    MemoryAccountingTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        if (extensionEnabled("GL_ANGLE_memory_accounting"))
+        {
+            for (size_t category = 0; category < kCategoryCount; ++category)
+            {
+                mContextBaseline[category]    = getMemory(kContextQueries[category]);
+                mShareGroupBaseline[category] = getMemory(kShareGroupQueries[category]);
+            }
+            ASSERT_GL_NO_ERROR();
+        }
+    }
+
+    // The queries return 64-bit values, which ES2 contexts can only read with glGetIntegerv.
+    GLint64 getMemory(GLenum pname) const
+    {
+        GLint64 value = -1;
+        if (getClientMajorVersion() >= 3)
+        {
+            glGetInteger64v(pname, &value);
+        }
+        else
+        {
+            GLint intValue = -1;
+            glGetIntegerv(pname, &intValue);
+            value = intValue;
+        }
+        return value;
+    }
+
+    // Checks the memory charged to the current context, and to its share group, since SetUp.
+    void expectMemory(GLint64 contextBuffer,
+                      GLint64 contextTexture,
+                      GLint64 contextRenderbuffer,
+                      GLint64 shareGroupBuffer,
+                      GLint64 shareGroupTexture,
+                      GLint64 shareGroupRenderbuffer) const
+    {
+        const GLint64 contextSizes[]    = {contextBuffer, contextTexture, contextRenderbuffer};
+        const GLint64 shareGroupSizes[] = {shareGroupBuffer, shareGroupTexture,
+                                           shareGroupRenderbuffer};
+        for (size_t category = 0; category < kCategoryCount; ++category)
+        {
+            EXPECT_EQ(mContextBaseline[category] + contextSizes[category],
+                      getMemory(kContextQueries[category]))
+                << "pname 0x" << std::hex << kContextQueries[category];
+            EXPECT_EQ(mShareGroupBaseline[category] + shareGroupSizes[category],
+                      getMemory(kShareGroupQueries[category]))
+                << "pname 0x" << std::hex << kShareGroupQueries[category];
+        }
+        EXPECT_GL_NO_ERROR();
+    }
+
+    // For tests that only use the window's context, which is alone in its share group.
+    void expectMemory(GLint64 buffer, GLint64 texture, GLint64 renderbuffer) const
+    {
+        expectMemory(buffer, texture, renderbuffer, buffer, texture, renderbuffer);
+    }
+
+    EGLContext createContext(EGLContext shareContext, EGLint memoryBudgetKB)
+    {
+        EGLWindow *window = getEGLWindow();
+
+        std::vector<EGLint> contextAttributes = {
+            EGL_CONTEXT_MAJOR_VERSION_KHR, GetParam().majorVersion,
+            EGL_CONTEXT_MINOR_VERSION_KHR, GetParam().minorVersion,
+        };
+        if (memoryBudgetKB != 0)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_OPENGL_DEBUG);
+            contextAttributes.push_back(EGL_TRUE);
+            contextAttributes.push_back(EGL_CONTEXT_MEMORY_BUDGET_KB_ANGLE);
+            contextAttributes.push_back(memoryBudgetKB);
+        }
+        contextAttributes.push_back(EGL_NONE);
+
+        return eglCreateContext(window->getDisplay(), window->getConfig(), shareContext,
+                                contextAttributes.data());
+    }
+
+    void makeCurrent(EGLContext context)
+    {
+        EGLWindow *window = getEGLWindow();
+        eglMakeCurrent(window->getDisplay(), window->getSurface(), window->getSurface(), context);
+        ASSERT_EGL_SUCCESS();
+    }
+
+    GLint64 mContextBaseline[kCategoryCount]    = {};
+    GLint64 mShareGroupBaseline[kCategoryCount] = {};
+};
+
+// Buffers are charged the size of their data store until they are deleted.
+TEST_P(MemoryAccountingTest, Buffers)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+
+    GLBuffer first;
+    glBindBuffer(GL_ARRAY_BUFFER, first);
+    glBufferData(GL_ARRAY_BUFFER, 100, nullptr, GL_STATIC_DRAW);
+    expectMemory(100, 0, 0);
+
+    // Reallocating replaces the old size, updating the data doesn't change it.
+    glBufferData(GL_ARRAY_BUFFER, 40, nullptr, GL_STATIC_DRAW);
+    const GLubyte data[16] = {};
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(data), data);
+    expectMemory(40, 0, 0);
+
+    GLuint second = 0;
+    glGenBuffers(1, &second);
+    glBindBuffer(GL_ARRAY_BUFFER, second);
+    glBufferData(GL_ARRAY_BUFFER, 60, nullptr, GL_DYNAMIC_DRAW);
+    expectMemory(100, 0, 0);
+
+    glDeleteBuffers(1, &second);
+    expectMemory(40, 0, 0);
+}
+
+// Textures are charged all the images specified with glTexImage2D and glGenerateMipmap.
+TEST_P(MemoryAccountingTest, TextureImages)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    expectMemory(0, 16 * 16 * 4, 0);
+
+    glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, 8, 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    expectMemory(0, (16 * 16 + 8 * 8) * 4, 0);
+
+    // Respecifying a level only replaces that level.
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 32, 32, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    expectMemory(0, (32 * 32 + 8 * 8) * 4, 0);
+
+    glGenerateMipmap(GL_TEXTURE_2D);
+    expectMemory(0, (32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1) * 4, 0);
+
+    glDeleteTextures(1, &texture);
+    expectMemory(0, 0, 0);
+}
+
+// Immutable textures are charged all their levels up front.
+TEST_P(MemoryAccountingTest, TextureStorage)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+    ANGLE_SKIP_TEST_IF(getClientMajorVersion() < 3 && !extensionEnabled("GL_EXT_texture_storage"));
+
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if (getClientMajorVersion() >= 3)
+    {
+        glTexStorage2D(GL_TEXTURE_2D, 3, GL_RGBA8, 16, 16);
+    }
+    else
+    {
+        glTexStorage2DEXT(GL_TEXTURE_2D, 3, GL_RGBA8_OES, 16, 16);
+    }
+    expectMemory(0, (16 * 16 + 8 * 8 + 4 * 4) * 4, 0);
+
+    if (getClientMajorVersion() >= 3)
+    {
+        GLTexture arrayTexture;
+        glBindTexture(GL_TEXTURE_2D_ARRAY, arrayTexture);
+        glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, 4, 4, 3);
+        expectMemory(0, (16 * 16 + 8 * 8 + 4 * 4 + 4 * 4 * 3) * 4, 0);
+    }
+
+    glDeleteTextures(1, &texture);
+    expectMemory(0, 0, 0);
+}
+
+// Renderbuffers are charged the size of their image, times its samples.
+TEST_P(MemoryAccountingTest, Renderbuffers)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+
+    GLuint renderbuffer = 0;
+    glGenRenderbuffers(1, &renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, 16, 16);
+    expectMemory(0, 0, 16 * 16 * 2);
+
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, 32, 32);
+    expectMemory(0, 0, 32 * 32 * 2);
+
+    if (getClientMajorVersion() >= 3)
+    {
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGBA8, 16, 16);
+        GLint samples = 0;
+        glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_SAMPLES, &samples);
+        EXPECT_GE(samples, 4);
+        expectMemory(0, 0, 16 * 16 * 4 * samples);
+    }
+
+    glDeleteRenderbuffers(1, &renderbuffer);
+    expectMemory(0, 0, 0);
+}
+
+// Objects are charged to the context that last specified them, and stay charged to the share
+// group after that context is destroyed.
+TEST_P(MemoryAccountingTest, ShareGroup)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+
+    EGLContext windowContext = getEGLWindow()->getContext();
+    EGLContext sharedContext = createContext(windowContext, 0);
+    ASSERT_NE(EGL_NO_CONTEXT, sharedContext);
+
+    makeCurrent(sharedContext);
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, 100, nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(windowContext);
+    expectMemory(0, 0, 0, 100, 16 * 16 * 4, 0);
+
+    // Specifying the buffer again moves its charge to this context.
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, 40, nullptr, GL_STATIC_DRAW);
+    expectMemory(40, 0, 0, 40, 16 * 16 * 4, 0);
+
+    // The texture is still charged to the destroyed context's share group.
+    eglDestroyContext(getEGLWindow()->getDisplay(), sharedContext);
+    ASSERT_EGL_SUCCESS();
+    expectMemory(40, 0, 0, 40, 16 * 16 * 4, 0);
+
+    glDeleteTextures(1, &texture);
+    expectMemory(40, 0, 0, 40, 0, 0);
+
+    glDeleteBuffers(1, &buffer);
+    expectMemory(0, 0, 0);
+}
+
+// A context reports through KHR_debug when its allocations take it over its budget.
+TEST_P(MemoryAccountingTest, Budget)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_memory_accounting"));
+    ANGLE_SKIP_TEST_IF(!eglDisplayExtensionEnabled(getEGLWindow()->getDisplay(),
+                                                   "EGL_ANGLE_create_context_memory_budget"));
+
+    EXPECT_EQ(0, getMemory(GL_CONTEXT_MEMORY_BUDGET_ANGLE));
+
+    EGLContext windowContext   = getEGLWindow()->getContext();
+    EGLContext budgetedContext = createContext(EGL_NO_CONTEXT, 1);
+    ASSERT_NE(EGL_NO_CONTEXT, budgetedContext);
+    makeCurrent(budgetedContext);
+
+    if (extensionEnabled("GL_KHR_debug"))
+    {
+        EXPECT_EQ(1024, getMemory(GL_CONTEXT_MEMORY_BUDGET_ANGLE));
+
+        std::vector<Message> messages;
+        glEnable(GL_DEBUG_OUTPUT);
+        glDebugMessageCallbackKHR(Callback, &messages);
+
+        GLBuffer first;
+        glBindBuffer(GL_ARRAY_BUFFER, first);
+        glBufferData(GL_ARRAY_BUFFER, 512, nullptr, GL_STATIC_DRAW);
+        EXPECT_EQ(0u, CountBudgetMessages(messages));
+
+        GLuint second = 0;
+        glGenBuffers(1, &second);
+        glBindBuffer(GL_ARRAY_BUFFER, second);
+        glBufferData(GL_ARRAY_BUFFER, 1024, nullptr, GL_STATIC_DRAW);
+        EXPECT_EQ(1u, CountBudgetMessages(messages));
+
+        // Allocating more while over the budget isn't reported again.
+        GLRenderbuffer renderbuffer;
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, 8, 8);
+        EXPECT_EQ(1u, CountBudgetMessages(messages));
+
+        // Going back under the budget and crossing it again is.
+        glDeleteBuffers(1, &second);
+        glGenBuffers(1, &second);
+        glBindBuffer(GL_ARRAY_BUFFER, second);
+        glBufferData(GL_ARRAY_BUFFER, 256, nullptr, GL_STATIC_DRAW);
+        EXPECT_EQ(1u, CountBudgetMessages(messages));
+
+        GLTexture texture;
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 8, 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        EXPECT_EQ(2u, CountBudgetMessages(messages));
+
+        // The budget never fails allocations.
+        EXPECT_EQ(512 + 256, getMemory(GL_CONTEXT_BUFFER_MEMORY_ANGLE));
+        EXPECT_EQ(8 * 8 * 4, getMemory(GL_CONTEXT_TEXTURE_MEMORY_ANGLE));
+        EXPECT_EQ(8 * 8 * 2, getMemory(GL_CONTEXT_RENDERBUFFER_MEMORY_ANGLE));
+        EXPECT_GL_NO_ERROR();
+
+        glDeleteBuffers(1, &second);
+        glDebugMessageCallbackKHR(nullptr, nullptr);
+    }
+
+    makeCurrent(windowContext);
+    eglDestroyContext(getEGLWindow()->getDisplay(), budgetedContext);
+    ASSERT_EGL_SUCCESS();
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(MemoryAccountingTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
@@ -0,0 +1,186 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiDrawTest:
+//   Tests for GL_ANGLE_multi_draw, which submits several draws with a single call.
+//
+
+#include "test_utils/ANGLETest.h"
+
+using namespace angle;
+
+namespace
+{
+
+class MultiDrawTest : public ANGLETest
+{
+  protected:
+    MultiDrawTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        const std::string &vertexShader =
+            "attribute vec2 position;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_Position = vec4(position, 0.0, 1.0);\n"
+            "}\n";
+        const std::string &fragmentShader =
+            "void main()\n"
+            "{\n"
+            "    gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);\n"
+            "}\n";
+        mProgram = CompileProgram(vertexShader, fragmentShader);
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+
+        // Two quads of two triangles each, covering the left and the right half of the window.
+        const GLfloat positions[] = {
+            -1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 1.0f,
+            0.0f,  -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 0.0f,  -1.0f, 1.0f, 1.0f, 0.0f,  1.0f,
+        };
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(positions), positions, GL_STATIC_DRAW);
+
+        GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, positionLocation);
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+
+        const GLushort indices[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void TearDown() override
+    {
+        glDeleteBuffers(1, &mIndexBuffer);
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    bool supportsInstancing() const
+    {
+        return getClientMajorVersion() >= 3 || extensionEnabled("GL_ANGLE_instanced_arrays");
+    }
+
+    void checkHalves(const GLColor &left, const GLColor &right)
+    {
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 4, getWindowHeight() / 2, left);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() * 3 / 4, getWindowHeight() / 2, right);
+    }
+
+    GLuint mProgram      = 0;
+    GLuint mVertexBuffer = 0;
+    GLuint mIndexBuffer  = 0;
+};
+
+// Both draws of glMultiDrawArraysANGLE render.
+TEST_P(MultiDrawTest, MultiDrawArrays)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    const GLint firsts[]   = {0, 6};
+    const GLsizei counts[] = {6, 6};
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 2);
+    ASSERT_GL_NO_ERROR();
+
+    checkHalves(GLColor::green, GLColor::green);
+}
+
+// Both draws of glMultiDrawElementsANGLE render, each with its own offset in the index buffer.
+TEST_P(MultiDrawTest, MultiDrawElements)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    const GLsizei counts[]      = {6, 6};
+    const void *const indices[] = {reinterpret_cast<const void *>(0),
+                                   reinterpret_cast<const void *>(6 * sizeof(GLushort))};
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, indices, 2);
+    ASSERT_GL_NO_ERROR();
+
+    checkHalves(GLColor::green, GLColor::green);
+}
+
+// Draws with no instances or no vertices are skipped, the other draws still render.
+TEST_P(MultiDrawTest, EmptyDrawsAreSkipped)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw") || !supportsInstancing());
+
+    const GLint firsts[]           = {0, 6, 6};
+    const GLsizei counts[]         = {6, 6, 0};
+    const GLsizei instanceCounts[] = {1, 0, 1};
+    glMultiDrawArraysInstancedANGLE(GL_TRIANGLES, firsts, counts, instanceCounts, 3);
+    ASSERT_GL_NO_ERROR();
+
+    checkHalves(GLColor::green, GLColor::red);
+}
+
+// Errors in any of the draws fail the whole call.
+TEST_P(MultiDrawTest, Errors)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    const GLint firsts[]   = {0, 6};
+    const GLsizei counts[] = {6, 6};
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 0);
+    EXPECT_GL_NO_ERROR();
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    const GLint negativeFirsts[] = {0, -1};
+    glMultiDrawArraysANGLE(GL_TRIANGLES, negativeFirsts, counts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    const GLsizei negativeCounts[] = {6, -6};
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, negativeCounts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // The second draw reads past the end of the vertex buffer.
+    const GLint farFirsts[] = {0, 12};
+    glMultiDrawArraysANGLE(GL_TRIANGLES, farFirsts, counts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // The second draw reads past the end of the index buffer.
+    const void *const indices[] = {reinterpret_cast<const void *>(0),
+                                   reinterpret_cast<const void *>(12 * sizeof(GLushort))};
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, indices, 2);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_FLOAT, indices, 2);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    checkHalves(GLColor::red, GLColor::red);
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(MultiDrawTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
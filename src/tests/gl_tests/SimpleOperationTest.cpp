@@ -21,7 +21,7 @@ namespace
 class SimpleOperationTest : public ANGLETest
 {
   protected:
-    SimpleOperationTest()
+    SimpleOperationTest() : mPipelineCacheMisses(0)
     {
         setWindowWidth(128);
         setWindowHeight(128);
@@ -31,7 +31,18 @@ class SimpleOperationTest : public ANGLETest
         setConfigAlphaBits(8);
     }
 
+    void onHistogramBoolean(const char *name, bool sample) override
+    {
+        if (strcmp(name, "GPU.ANGLE.VulkanPipelineCacheHit") == 0 && !sample)
+        {
+            mPipelineCacheMisses++;
+        }
+    }
+
     void verifyBuffer(const std::vector<uint8_t> &data, GLenum binding);
+
+    // The number of pipelines the Vulkan back-end built.
+    int mPipelineCacheMisses;
 };
 
 void SimpleOperationTest::verifyBuffer(const std::vector<uint8_t> &data, GLenum binding)
@@ -212,6 +223,30 @@ TEST_P(SimpleOperationTest, BufferDataWithNoData)
     EXPECT_GL_NO_ERROR();
 }
 
+// More small buffers than drivers usually allow separate device memory allocations for.
+TEST_P(SimpleOperationTest, ManySmallBuffers)
+{
+    constexpr size_t kBufferCount = 5000;
+
+    std::vector<GLuint> buffers(kBufferCount);
+    glGenBuffers(static_cast<GLsizei>(kBufferCount), buffers.data());
+
+    std::vector<uint8_t> data(1024);
+    for (size_t bufferIndex = 0; bufferIndex < kBufferCount; ++bufferIndex)
+    {
+        FillVectorWithRandomUBytes(&data);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[bufferIndex]);
+        glBufferData(GL_ARRAY_BUFFER, data.size(), data.data(), GL_STATIC_DRAW);
+    }
+    EXPECT_GL_NO_ERROR();
+
+    // The last buffer still holds its own data.
+    verifyBuffer(data, GL_ARRAY_BUFFER);
+
+    glDeleteBuffers(static_cast<GLsizei>(kBufferCount), buffers.data());
+    EXPECT_GL_NO_ERROR();
+}
+
 TEST_P(SimpleOperationTest, BufferSubData)
 {
     GLBuffer buffer;
@@ -285,6 +320,109 @@ TEST_P(SimpleOperationTest, DrawQuadAndSwap)
     EXPECT_GL_NO_ERROR();
 }
 
+// Switching between programs and viewports reuses the pipelines built for earlier draws.
+TEST_P(SimpleOperationTest, DrawQuadsAlternatingProgramsAndViewports)
+{
+    const std::string &vertexShader =
+        "attribute vec3 position;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(position, 1);\n"
+        "}";
+    const std::string &greenFragmentShader =
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = vec4(0, 1, 0, 1);\n"
+        "}";
+    const std::string &redFragmentShader =
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = vec4(1, 0, 0, 1);\n"
+        "}";
+    ANGLE_GL_PROGRAM(greenProgram, vertexShader, greenFragmentShader);
+    ANGLE_GL_PROGRAM(redProgram, vertexShader, redFragmentShader);
+
+    const int width  = getWindowWidth();
+    const int height = getWindowHeight();
+
+    int firstIterationMisses = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        glViewport(0, 0, width, height);
+        drawQuad(greenProgram.get(), "position", 0.5f, 1.0f, true);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        glViewport(0, 0, width / 2, height);
+        drawQuad(redProgram.get(), "position", 0.5f, 1.0f, true);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+        if (i == 0)
+        {
+            firstIterationMisses = mPipelineCacheMisses;
+        }
+    }
+
+    // One pipeline per program is built by the first iteration, the viewport is dynamic state.
+    if (getPlatformRenderer() == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE)
+    {
+        EXPECT_EQ(2, firstIterationMisses);
+    }
+    EXPECT_EQ(firstIterationMisses, mPipelineCacheMisses);
+}
+
+// Draws from different ranges of a vertex buffer with the same vertex format, which only changes the
+// bound vertex buffer offset.
+TEST_P(SimpleOperationTest, DrawQuadsFromVertexBufferOffsets)
+{
+    const std::string &vertexShader =
+        "attribute vec3 position;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(position, 1);\n"
+        "}";
+    const std::string &fragmentShader =
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = vec4(0, 1, 0, 1);\n"
+        "}";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    // A quad covering the left half of the window, followed by one covering all of it.
+    const GLfloat vertices[] = {
+        -1.0f, 1.0f,  0.5f, -1.0f, -1.0f, 0.5f, 0.0f, -1.0f, 0.5f,
+        -1.0f, 1.0f,  0.5f, 0.0f,  -1.0f, 0.5f, 0.0f, 1.0f,  0.5f,
+        -1.0f, 1.0f,  0.5f, -1.0f, -1.0f, 0.5f, 1.0f, -1.0f, 0.5f,
+        -1.0f, 1.0f,  0.5f, 1.0f,  -1.0f, 0.5f, 1.0f, 1.0f,  0.5f,
+    };
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.get());
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(program.get(), "position");
+    ASSERT_NE(-1, positionLocation);
+    glEnableVertexAttribArray(positionLocation);
+
+    const int width = getWindowWidth();
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(width - 1, 0, GLColor::black);
+
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0,
+                          reinterpret_cast<const void *>(sizeof(GLfloat) * 18));
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(width - 1, 0, GLColor::green);
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_INSTANTIATE_TEST(SimpleOperationTest,
                        ES2_D3D9(),
@@ -74,10 +74,15 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 
 struct RenderTestParams : public angle::PlatformParameters
 {
+    RenderTestParams() : noError(false) {}
+
     virtual std::string suffix() const;
 
     EGLint windowWidth;
     EGLint windowHeight;
+
+    // Creates the context with EGL_CONTEXT_OPENGL_NO_ERROR_KHR.
+    bool noError;
 };
 
 class ANGLERenderTest : public ANGLEPerfTest
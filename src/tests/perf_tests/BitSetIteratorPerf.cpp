@@ -48,11 +48,19 @@ void BitSetIteratorPerfTest<T>::step()
     mBits.reset();
 }
 
-// These type names unfortunately don't get printed correctly in Gtest.
+// These type names unfortunately don't get printed correctly in Gtest. The 128-bit sets cover
+// masks wider than a word, like the State dirty bits.
 #if defined(ANGLE_X64_CPU)
-using TestTypes = Types<angle::IterableBitSet<32>, angle::BitSet32<32>, angle::BitSet64<32>>;
+using TestTypes = Types<angle::IterableBitSet<32>,
+                        angle::BitSet32<32>,
+                        angle::BitSet64<32>,
+                        angle::IterableBitSet<128>,
+                        angle::BitSetArray<128>>;
 #else
-using TestTypes = Types<angle::IterableBitSet<32>, angle::BitSet32<32>>;
+using TestTypes = Types<angle::IterableBitSet<32>,
+                        angle::BitSet32<32>,
+                        angle::IterableBitSet<128>,
+                        angle::BitSetArray<128>>;
 #endif  // defined(ANGLE_X64_CPU)
 TYPED_TEST_CASE(BitSetIteratorPerfTest, TestTypes);
 
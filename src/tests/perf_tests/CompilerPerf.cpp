@@ -0,0 +1,158 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerPerf:
+//   Performance test for repeatedly translating a shader corpus on one compiler handle. Reports
+//   the system allocations the translator's pool allocator makes per compile once warmed up.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "angle_gl.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+// Builds a fragment shader with a library of helper functions, most of them unused.
+std::string MakeLibraryShader(int numFunctions)
+{
+    std::stringstream shader;
+    shader << "precision mediump float;\n"
+              "uniform vec4 u[16];\n"
+              "varying vec2 v;\n";
+    for (int i = 0; i < numFunctions; ++i)
+    {
+        shader << "vec4 helper" << i << "(vec4 a, int i)\n"
+               << "{\n"
+               << "    vec4 b = a * u[i] + vec4(" << i << ".0, 0.5, 0.25, 1.0);\n"
+               << "    return normalize(b) * dot(a, b) + sin(b) * cos(a);\n"
+               << "}\n";
+    }
+    shader << "void main()\n"
+              "{\n"
+              "    vec4 sum = vec4(v, 0.0, 1.0);\n"
+              "    for (int i = 0; i < 16; ++i)\n"
+              "    {\n";
+    for (int i = 0; i < numFunctions; i += 4)
+    {
+        shader << "        sum = helper" << i << "(sum, i);\n";
+    }
+    shader << "    }\n"
+              "    gl_FragColor = sum;\n"
+              "}\n";
+    return shader.str();
+}
+
+class CompilerPerfTest : public ANGLEPerfTest
+{
+  public:
+    CompilerPerfTest(const std::string &suffix, bool adaptivePageSize);
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    bool mAdaptivePageSize;
+    ShHandle mCompiler;
+    std::vector<std::string> mCorpus;
+    ShPoolAllocatorStatistics mWarmStatistics;
+};
+
+CompilerPerfTest::CompilerPerfTest(const std::string &suffix, bool adaptivePageSize)
+    : ANGLEPerfTest("CompilerPerf", suffix),
+      mAdaptivePageSize(adaptivePageSize),
+      mCompiler(nullptr),
+      mWarmStatistics()
+{
+    mCorpus.push_back(MakeLibraryShader(4));
+    mCorpus.push_back(MakeLibraryShader(64));
+    mCorpus.push_back(MakeLibraryShader(256));
+}
+
+void CompilerPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_TRUE(sh::Initialize());
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                      SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    ASSERT_NE(nullptr, mCompiler);
+
+    ShPoolAllocatorOptions options;
+    options.adaptivePageSize = mAdaptivePageSize;
+    sh::SetPoolAllocatorOptions(mCompiler, options);
+
+    // Warm up the pool so that only the steady state is measured.
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        step();
+    }
+    mWarmStatistics = sh::GetPoolAllocatorStatistics(mCompiler);
+}
+
+void CompilerPerfTest::TearDown()
+{
+    ShPoolAllocatorStatistics statistics = sh::GetPoolAllocatorStatistics(mCompiler);
+    size_t compiles = getNumStepsPerformed() * mCorpus.size();
+    if (compiles > 0)
+    {
+        size_t systemAllocations = statistics.systemAllocations - mWarmStatistics.systemAllocations;
+        size_t systemBytes       = statistics.systemBytes - mWarmStatistics.systemBytes;
+        printResult("system_allocations_per_compile",
+                    static_cast<double>(systemAllocations) / compiles, "allocations", true);
+        printResult("system_bytes_per_compile", static_cast<double>(systemBytes) / compiles,
+                    "bytes", false);
+    }
+    printResult("pool_page_size", statistics.pageSize, "bytes", false);
+    printResult("pool_high_water_mark", statistics.highWaterMark, "bytes", false);
+
+    sh::Destruct(mCompiler);
+    mCompiler = nullptr;
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerPerfTest::step()
+{
+    for (const std::string &source : mCorpus)
+    {
+        const char *shaderStrings[] = {source.c_str()};
+        if (!sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES))
+        {
+            FAIL() << sh::GetInfoLog(mCompiler);
+        }
+    }
+}
+
+class CompilerFixedPageSizePerfTest : public CompilerPerfTest
+{
+  public:
+    CompilerFixedPageSizePerfTest() : CompilerPerfTest("_fixed_page_size", false) {}
+};
+
+class CompilerAdaptivePageSizePerfTest : public CompilerPerfTest
+{
+  public:
+    CompilerAdaptivePageSizePerfTest() : CompilerPerfTest("_adaptive_page_size", true) {}
+};
+
+TEST_F(CompilerFixedPageSizePerfTest, Run)
+{
+    run();
+}
+
+TEST_F(CompilerAdaptivePageSizePerfTest, Run)
+{
+    run();
+}
+
+}  // anonymous namespace
@@ -7,6 +7,8 @@
 //   Performance tests for ANGLE draw call overhead.
 //
 
+#include <vector>
+
 #include "ANGLEPerfTest.h"
 #include "DrawCallPerfParams.h"
 #include "test_utils/draw_call_perf_utils.h"
@@ -30,6 +32,10 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     GLuint mFBO     = 0;
     GLuint mTexture = 0;
     int mNumTris    = GetParam().numTris;
+
+    // Parameters of the draws of each glMultiDrawArraysANGLE call.
+    std::vector<GLint> mFirsts;
+    std::vector<GLsizei> mCounts;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
@@ -61,6 +67,13 @@ void DrawCallPerfBenchmark::initializeBenchmark()
         CreateColorFBO(getWindow()->getWidth(), getWindow()->getHeight(), &mTexture, &mFBO);
     }
 
+    // The same draws as the glDrawArrays loop, submitted with a single call.
+    if (params.useMultiDraw)
+    {
+        mFirsts.assign(params.iterations, 0);
+        mCounts.assign(params.iterations, static_cast<GLsizei>(3 * mNumTris));
+    }
+
     ASSERT_GL_NO_ERROR();
 }
 
@@ -87,9 +100,17 @@ void DrawCallPerfBenchmark::drawBenchmark()
 
     const auto &params = GetParam();
 
-    for (unsigned int it = 0; it < params.iterations; it++)
+    if (params.useMultiDraw)
+    {
+        glMultiDrawArraysANGLE(GL_TRIANGLES, mFirsts.data(), mCounts.data(),
+                               static_cast<GLsizei>(params.iterations));
+    }
+    else
     {
-        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(3 * mNumTris));
+        for (unsigned int it = 0; it < params.iterations; it++)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(3 * mNumTris));
+        }
     }
 
     ASSERT_GL_NO_ERROR();
@@ -110,6 +131,8 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawCallPerfOpenGLParams(true, false),
                        DrawCallPerfOpenGLParams(true, true),
                        DrawCallPerfValidationOnly(),
-                       DrawCallPerfVulkanParams(false));
+                       DrawCallPerfVulkanParams(false),
+                       DrawCallPerfNULLParams(false),
+                       DrawCallPerfNULLParams(true));
 
 } // namespace
@@ -31,6 +31,7 @@ struct DrawCallPerfParams final : public RenderTestParams
     double runTimeSeconds   = 10.0;
     int numTris             = 1;
     bool useFBO             = false;
+    bool useMultiDraw       = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const DrawCallPerfParams &params);
@@ -45,4 +46,6 @@ DrawCallPerfParams DrawCallPerfValidationOnly();
 
 DrawCallPerfParams DrawCallPerfVulkanParams(bool renderToTexture);
 
+DrawCallPerfParams DrawCallPerfNULLParams(bool useMultiDraw);
+
 #endif  // TESTS_PERF_TESTS_DRAW_CALL_PERF_PARAMS_H_
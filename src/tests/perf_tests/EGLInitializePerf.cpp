@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // EGLInitializePerfTest:
-//   Performance test for device creation.
+//   Performance test for device and context creation.
 //
 
 #include "ANGLEPerfTest.h"
@@ -57,6 +57,37 @@ void CapturePlatform_histogramCustomCounts(angle::PlatformMethods *platformMetho
     }
 }
 
+EGLDisplay GetPlatformDisplay(OSWindow *osWindow, const EGLPlatformParameters &platform)
+{
+    std::vector<EGLint> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+
+    if (platform.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE ||
+        platform.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
+    {
+        displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+        displayAttributes.push_back(platform.deviceType);
+    }
+    displayAttributes.push_back(EGL_NONE);
+
+    auto eglGetPlatformDisplayEXT =
+        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglGetPlatformDisplayEXT == nullptr)
+    {
+        std::cerr << "Error getting platform display!" << std::endl;
+        return EGL_NO_DISPLAY;
+    }
+
+    return eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
+                                    reinterpret_cast<void *>(osWindow->getNativeDisplay()),
+                                    &displayAttributes[0]);
+}
+
 class EGLInitializePerfTest : public ANGLEPerfTest,
                               public WithParamInterface<angle::PlatformParameters>
 {
@@ -79,38 +110,10 @@ EGLInitializePerfTest::EGLInitializePerfTest()
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY)
 {
-    auto platform = GetParam().eglParameters;
-
-    std::vector<EGLint> displayAttributes;
-    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
-    displayAttributes.push_back(platform.renderer);
-    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
-    displayAttributes.push_back(platform.majorVersion);
-    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
-    displayAttributes.push_back(platform.minorVersion);
-
-    if (platform.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE ||
-        platform.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
-    {
-        displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
-        displayAttributes.push_back(platform.deviceType);
-    }
-    displayAttributes.push_back(EGL_NONE);
-
     mOSWindow = CreateOSWindow();
     mOSWindow->initialize("EGLInitialize Test", 64, 64);
 
-    auto eglGetPlatformDisplayEXT =
-        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
-    if (eglGetPlatformDisplayEXT == nullptr)
-    {
-        std::cerr << "Error getting platform display!" << std::endl;
-        return;
-    }
-
-    mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
-                                        reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
-                                        &displayAttributes[0]);
+    mDisplay = GetPlatformDisplay(mOSWindow, GetParam().eglParameters);
 }
 
 void EGLInitializePerfTest::SetUp()
@@ -156,4 +159,99 @@ TEST_P(EGLInitializePerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11());
 
+// Measures creating, binding and destroying a context on an already initialized display. On the
+// NULL back-end this is dominated by the front-end work done for each new context.
+class EGLCreateContextPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<angle::PlatformParameters>
+{
+  public:
+    EGLCreateContextPerfTest();
+    ~EGLCreateContextPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLConfig mConfig;
+    EGLSurface mSurface;
+};
+
+EGLCreateContextPerfTest::EGLCreateContextPerfTest()
+    : ANGLEPerfTest("EGLCreateContext", "_run"),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mConfig(nullptr),
+      mSurface(EGL_NO_SURFACE)
+{
+    mOSWindow = CreateOSWindow();
+    mOSWindow->initialize("EGLCreateContext Test", 64, 64);
+
+    mDisplay = GetPlatformDisplay(mOSWindow, GetParam().eglParameters);
+}
+
+EGLCreateContextPerfTest::~EGLCreateContextPerfTest()
+{
+    SafeDelete(mOSWindow);
+}
+
+void EGLCreateContextPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+
+    EGLint majorVersion, minorVersion;
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    const EGLint configAttributes[] = {EGL_RED_SIZE,     8, EGL_GREEN_SIZE,   8,
+                                       EGL_BLUE_SIZE,    8, EGL_ALPHA_SIZE,   8,
+                                       EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_NONE};
+    EGLint configCount = 0;
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglChooseConfig(mDisplay, configAttributes, &mConfig, 1, &configCount));
+    ASSERT_EQ(1, configCount);
+
+    const EGLint surfaceAttributes[] = {EGL_WIDTH, 64, EGL_HEIGHT, 64, EGL_NONE};
+    mSurface = eglCreatePbufferSurface(mDisplay, mConfig, surfaceAttributes);
+    ASSERT_NE(EGL_NO_SURFACE, mSurface);
+}
+
+void EGLCreateContextPerfTest::step()
+{
+    const EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, GetParam().majorVersion,
+                                        EGL_CONTEXT_MINOR_VERSION_KHR, GetParam().minorVersion,
+                                        EGL_NONE};
+
+    EGLContext context = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, context);
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglMakeCurrent(mDisplay, mSurface, mSurface, context));
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE), eglDestroyContext(mDisplay, context));
+}
+
+void EGLCreateContextPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    if (mSurface != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(mDisplay, mSurface);
+        mSurface = EGL_NO_SURFACE;
+    }
+    eglTerminate(mDisplay);
+}
+
+TEST_P(EGLCreateContextPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EGLCreateContextPerfTest, angle::ES2_NULL(), angle::ES3_NULL());
+
 } // namespace
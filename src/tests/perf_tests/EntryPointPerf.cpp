@@ -0,0 +1,104 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointPerf:
+//   Performance test for the cost of a GL call that does almost nothing, which is mostly the cost
+//   of finding the current context and dispatching to it. Measured on the NULL back-end, with and
+//   without validation.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+namespace angle
+{
+
+struct EntryPointParams final : public RenderTestParams
+{
+    EntryPointParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+        iterations   = 100000;
+    }
+
+    std::string suffix() const override;
+
+    size_t iterations;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string EntryPointParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
+    return strstr.str();
+}
+
+class EntryPointBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<EntryPointParams>
+{
+  public:
+    EntryPointBenchmark();
+
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+};
+
+EntryPointBenchmark::EntryPointBenchmark() : ANGLERenderTest("EntryPoint", GetParam())
+{
+}
+
+void EntryPointBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+    ASSERT_GT(params.iterations, 0u);
+}
+
+void EntryPointBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Only changes one bit of state, which the NULL back-end doesn't even look at.
+    for (size_t it = 0; it < params.iterations; ++it)
+    {
+        glDepthMask((it & 1) != 0 ? GL_TRUE : GL_FALSE);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+EntryPointParams EntryPointNullParams(bool noError)
+{
+    EntryPointParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.noError       = noError;
+    return params;
+}
+
+TEST_P(EntryPointBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EntryPointBenchmark,
+                       EntryPointNullParams(false),
+                       EntryPointNullParams(true));
+
+}  // namespace angle
@@ -0,0 +1,80 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FormatUtilsPerf:
+//   Performance test for the internal format info lookups done by validation and pixel packing.
+//   Also reports how long the first lookup takes, which builds the format table. That is only
+//   meaningful when the test runs first in its process, e.g. with --gtest_filter.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <chrono>
+#include <vector>
+
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+class FormatUtilsPerfTest : public ANGLEPerfTest
+{
+  public:
+    FormatUtilsPerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<GLenum> mSizedFormats;
+    std::vector<gl::FormatType> mUnsizedFormats;
+
+    // Accumulates the lookup results so that they can't be optimized away.
+    GLuint mChecksum;
+};
+
+FormatUtilsPerfTest::FormatUtilsPerfTest()
+    : ANGLEPerfTest("FormatUtilsPerf", "_run"), mChecksum(0)
+{
+    auto start = std::chrono::steady_clock::now();
+    gl::GetSizedInternalFormatInfo(GL_RGBA8);
+    std::chrono::duration<double, std::micro> firstLookup = std::chrono::steady_clock::now() - start;
+    printResult("first_lookup", firstLookup.count(), "us", false);
+
+    const gl::FormatSet &sizedFormats = gl::GetAllSizedInternalFormats();
+    mSizedFormats.assign(sizedFormats.begin(), sizedFormats.end());
+
+    // The unsized formats validation sees for ES2 style TexImage calls.
+    mUnsizedFormats = {
+        gl::FormatType(GL_RGBA, GL_UNSIGNED_BYTE),
+        gl::FormatType(GL_RGB, GL_UNSIGNED_BYTE),
+        gl::FormatType(GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4),
+        gl::FormatType(GL_RGB, GL_UNSIGNED_SHORT_5_6_5),
+        gl::FormatType(GL_LUMINANCE, GL_UNSIGNED_BYTE),
+        gl::FormatType(GL_ALPHA, GL_UNSIGNED_BYTE),
+        gl::FormatType(GL_LUMINANCE_ALPHA, GL_FLOAT),
+        gl::FormatType(GL_DEPTH_COMPONENT, GL_UNSIGNED_INT),
+        gl::FormatType(GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8),
+        gl::FormatType(GL_RGBA, GL_HALF_FLOAT_OES),
+    };
+}
+
+void FormatUtilsPerfTest::step()
+{
+    for (GLenum internalFormat : mSizedFormats)
+    {
+        mChecksum += gl::GetSizedInternalFormatInfo(internalFormat).pixelBytes;
+    }
+    for (const gl::FormatType &formatType : mUnsizedFormats)
+    {
+        mChecksum += gl::GetInternalFormatInfo(formatType.format, formatType.type).pixelBytes;
+    }
+}
+
+TEST_F(FormatUtilsPerfTest, Run)
+{
+    run();
+}
+
+}  // anonymous namespace
@@ -334,6 +334,13 @@ UniformsParams MatrixUniforms(const EGLPlatformParameters &egl, DataMode dataMod
     return params;
 }
 
+// The NULL back-end does nothing with the uniform data, which leaves the cost of validating and
+// storing it.
+EGLPlatformParameters NullPlatform()
+{
+    return EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+}
+
 }  // anonymous namespace
 
 TEST_P(UniformsBenchmark, Run)
@@ -350,4 +357,6 @@ ANGLE_INSTANTIATE_TEST(UniformsBenchmark,
                        MatrixUniforms(D3D11(), DataMode::REPEAT),
                        MatrixUniforms(D3D11(), DataMode::UPDATE),
                        MatrixUniforms(OPENGL(), DataMode::REPEAT),
-                       MatrixUniforms(OPENGL(), DataMode::UPDATE));
+                       MatrixUniforms(OPENGL(), DataMode::UPDATE),
+                       VectorUniforms(NullPlatform(), DataMode::UPDATE),
+                       MatrixUniforms(NullPlatform(), DataMode::UPDATE));
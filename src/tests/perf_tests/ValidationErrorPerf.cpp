@@ -0,0 +1,164 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ValidationErrorPerf:
+//   Performance test for a stream of GL calls that all fail validation, as produced by fuzzers or
+//   buggy WebGL content. Measured with and without a debug message callback installed.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+namespace angle
+{
+
+struct ValidationErrorParams final : public RenderTestParams
+{
+    ValidationErrorParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+        iterations   = 1000;
+        debugOutput  = false;
+    }
+
+    std::string suffix() const override;
+
+    size_t iterations;
+    bool debugOutput;
+};
+
+std::ostream &operator<<(std::ostream &os, const ValidationErrorParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string ValidationErrorParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+    if (debugOutput)
+    {
+        strstr << "_debug_output";
+    }
+
+    return strstr.str();
+}
+
+void GL_APIENTRY CountingDebugCallback(GLenum source,
+                                       GLenum type,
+                                       GLuint id,
+                                       GLenum severity,
+                                       GLsizei length,
+                                       const GLchar *message,
+                                       const void *userParam)
+{
+    size_t *messageCount = static_cast<size_t *>(const_cast<void *>(userParam));
+    (*messageCount)++;
+}
+
+class ValidationErrorBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<ValidationErrorParams>
+{
+  public:
+    ValidationErrorBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture;
+    size_t mMessageCount;
+};
+
+ValidationErrorBenchmark::ValidationErrorBenchmark()
+    : ANGLERenderTest("ValidationError", GetParam()), mTexture(0), mMessageCount(0)
+{
+}
+
+void ValidationErrorBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+    ASSERT_GT(params.iterations, 0u);
+
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    if (params.debugOutput)
+    {
+        glDebugMessageCallbackKHR(CountingDebugCallback, &mMessageCount);
+        glEnable(GL_DEBUG_OUTPUT_KHR);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ValidationErrorBenchmark::destroyBenchmark()
+{
+    const auto &params = GetParam();
+    if (params.debugOutput)
+    {
+        glDisable(GL_DEBUG_OUTPUT_KHR);
+        glDebugMessageCallbackKHR(nullptr, nullptr);
+        printResult("debug_messages", mMessageCount, "messages", false);
+    }
+
+    glDeleteTextures(1, &mTexture);
+}
+
+void ValidationErrorBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (size_t it = 0; it < params.iterations; ++it)
+    {
+        glBindBuffer(GL_TEXTURE_2D, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_RGBA);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glDrawArrays(GL_TRIANGLES, 0, -1);
+        glUseProgram(mTexture + 1);
+        glViewport(0, 0, -1, -1);
+
+        // Drain the pending errors the way a polling application would.
+        while (glGetError() != GL_NO_ERROR)
+        {
+        }
+    }
+}
+
+ValidationErrorParams ValidationErrorD3D11Params(bool debugOutput)
+{
+    ValidationErrorParams params;
+    params.eglParameters = egl_platform::D3D11_NULL();
+    params.debugOutput   = debugOutput;
+    return params;
+}
+
+ValidationErrorParams ValidationErrorOpenGLParams(bool debugOutput)
+{
+    ValidationErrorParams params;
+    params.eglParameters = egl_platform::OPENGL_NULL();
+    params.debugOutput   = debugOutput;
+    return params;
+}
+
+TEST_P(ValidationErrorBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ValidationErrorBenchmark,
+                       ValidationErrorD3D11Params(false),
+                       ValidationErrorD3D11Params(true),
+                       ValidationErrorOpenGLParams(false),
+                       ValidationErrorOpenGLParams(true));
+
+}  // namespace angle
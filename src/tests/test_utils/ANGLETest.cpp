@@ -79,6 +79,15 @@ void TestPlatform_overrideWorkaroundsD3D(angle::PlatformMethods *platform,
     }
 }
 
+void TestPlatform_histogramBoolean(angle::PlatformMethods *platform, const char *name, bool sample)
+{
+    auto *testPlatformContext = static_cast<TestPlatformContext *>(platform->context);
+    if (testPlatformContext->currentTest)
+    {
+        testPlatformContext->currentTest->onHistogramBoolean(name, sample);
+    }
+}
+
 std::array<angle::Vector3, 4> GetIndexedQuadVertices()
 {
     std::array<angle::Vector3, 4> vertices;
@@ -259,6 +268,7 @@ void ANGLETest::SetUp()
     }
 
     mPlatformMethods.overrideWorkaroundsD3D = angle::TestPlatform_overrideWorkaroundsD3D;
+    mPlatformMethods.histogramBoolean       = angle::TestPlatform_histogramBoolean;
     mPlatformMethods.logError               = angle::TestPlatform_logError;
     mPlatformMethods.logWarning             = angle::TestPlatform_logWarning;
     mPlatformMethods.logInfo                = angle::TestPlatform_logInfo;
@@ -710,6 +720,11 @@ void ANGLETest::setClientArraysEnabled(bool enabled)
     mEGLWindow->setClientArraysEnabled(enabled);
 }
 
+void ANGLETest::setMultithreadedShareGroup(bool enabled)
+{
+    mEGLWindow->setMultithreadedShareGroup(enabled);
+}
+
 void ANGLETest::setRobustResourceInit(bool enabled)
 {
     mEGLWindow->setRobustResourceInit(enabled);
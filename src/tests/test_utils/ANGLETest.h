@@ -222,6 +222,7 @@ class ANGLETest : public ::testing::TestWithParam<angle::PlatformParameters>
     static bool eglDisplayExtensionEnabled(EGLDisplay display, const std::string &extName);
 
     virtual void overrideWorkaroundsD3D(angle::WorkaroundsD3D *workaroundsD3D) {}
+    virtual void onHistogramBoolean(const char *name, bool sample) {}
 
   protected:
     virtual void SetUp();
@@ -274,6 +275,7 @@ class ANGLETest : public ::testing::TestWithParam<angle::PlatformParameters>
     void setBindGeneratesResource(bool bindGeneratesResource);
     void setVulkanLayersEnabled(bool enabled);
     void setClientArraysEnabled(bool enabled);
+    void setMultithreadedShareGroup(bool enabled);
     void setRobustResourceInit(bool enabled);
 
     // Some EGL extension tests would like to defer the Context init until the test body.
@@ -0,0 +1,36 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ContextGLTest.cpp:
+//   Test fixture that runs an ES 3.0 gl::Context on the GL back-end over a RecordingFunctionsGL,
+//   for tests that assert on the native calls the back-end makes.
+//
+
+#include "tests/test_utils/ContextGLTest.h"
+
+#include "libANGLE/renderer/gl/ContextGL.h"
+
+namespace angle
+{
+
+ContextGLTest::ContextGLTest()
+    : mRenderer(&mFunctions, egl::AttributeMap()),
+      mContextFactory([this](const gl::ContextState &state) {
+          return new rx::ContextGL(state, &mRenderer);
+      }),
+      mContext(nullptr)
+{
+}
+
+ContextGLTest::~ContextGLTest()
+{
+}
+
+void ContextGLTest::SetUp()
+{
+    mContext = mContextFactory.createContext(3);
+}
+
+}  // namespace angle
@@ -0,0 +1,39 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ContextGLTest.h:
+//   Test fixture that runs an ES 3.0 gl::Context on the GL back-end over a RecordingFunctionsGL,
+//   for tests that assert on the native calls the back-end makes.
+//
+
+#ifndef TESTS_TEST_UTILS_CONTEXTGLTEST_H_
+#define TESTS_TEST_UTILS_CONTEXTGLTEST_H_
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/gl/RendererGL.h"
+#include "tests/test_utils/RecordingFunctionsGL.h"
+#include "tests/test_utils/TestContextFactory.h"
+
+namespace angle
+{
+
+class ContextGLTest : public testing::Test
+{
+  protected:
+    ContextGLTest();
+    ~ContextGLTest() override;
+
+    void SetUp() override;
+
+    rx::RecordingFunctionsGL mFunctions;
+    rx::RendererGL mRenderer;
+    TestContextFactory mContextFactory;
+    gl::Context *mContext;
+};
+
+}  // namespace angle
+
+#endif  // TESTS_TEST_UTILS_CONTEXTGLTEST_H_
@@ -0,0 +1,506 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RecordingFunctionsGL.cpp:
+//   Implements the call counting FunctionsGL used by the GL back-end unit tests.
+//
+
+#include "tests/test_utils/RecordingFunctionsGL.h"
+
+namespace rx
+{
+
+namespace
+{
+
+RecordingFunctionsGL *gCurrentRecorder = nullptr;
+
+// An entry point that only records its call. Every instantiation is a distinct function, keyed by
+// the counter value of the line that binds it, so it knows the name it was bound under.
+template <typename FuncT, int Index>
+struct RecordingEntryPoint;
+
+template <typename R, typename... Args, int Index>
+struct RecordingEntryPoint<R(INTERNAL_GL_APIENTRY *)(Args...), Index>
+{
+    static R INTERNAL_GL_APIENTRY Call(Args...)
+    {
+        RecordingFunctionsGL::Record(sName);
+        return R();
+    }
+
+    static R(INTERNAL_GL_APIENTRY *Bind(const char *name))(Args...)
+    {
+        sName = name;
+        return &Call;
+    }
+
+    static const char *sName;
+};
+
+template <typename R, typename... Args, int Index>
+const char *RecordingEntryPoint<R(INTERNAL_GL_APIENTRY *)(Args...), Index>::sName = nullptr;
+
+#define ANGLE_RECORD_ENTRY_POINT(NAME) \
+    NAME = RecordingEntryPoint<decltype(NAME), __COUNTER__>::Bind(#NAME)
+
+size_t GetQueryValueCount(GLenum pname)
+{
+    switch (pname)
+    {
+        case GL_ALIASED_LINE_WIDTH_RANGE:
+        case GL_ALIASED_POINT_SIZE_RANGE:
+        case GL_DEPTH_RANGE:
+        case GL_MAX_VIEWPORT_DIMS:
+        case GL_POINT_SIZE_RANGE:
+        case GL_SMOOTH_LINE_WIDTH_RANGE:
+            return 2;
+        case GL_COLOR_CLEAR_VALUE:
+        case GL_COLOR_WRITEMASK:
+        case GL_SCISSOR_BOX:
+        case GL_VIEWPORT:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+GLint64 GetQueryValue(GLenum pname)
+{
+    switch (pname)
+    {
+        case GL_NUM_EXTENSIONS:
+        case GL_NUM_COMPRESSED_TEXTURE_FORMATS:
+        case GL_NUM_PROGRAM_BINARY_FORMATS:
+        case GL_NUM_SHADER_BINARY_FORMATS:
+            return 0;
+        case GL_MAJOR_VERSION:
+            return 4;
+        case GL_MINOR_VERSION:
+            return 5;
+        case GL_CONTEXT_PROFILE_MASK:
+            return GL_CONTEXT_CORE_PROFILE_BIT;
+        case GL_MIN_PROGRAM_TEXEL_OFFSET:
+        case GL_MIN_PROGRAM_TEXTURE_GATHER_OFFSET:
+            return -8;
+        default:
+            return 16;
+    }
+}
+
+template <typename T>
+void FillQuery(const char *entryPoint, GLenum pname, T *params)
+{
+    RecordingFunctionsGL::Record(entryPoint);
+    for (size_t i = 0; i < GetQueryValueCount(pname); i++)
+    {
+        params[i] = static_cast<T>(GetQueryValue(pname));
+    }
+}
+
+void INTERNAL_GL_APIENTRY GetIntegerv(GLenum pname, GLint *params)
+{
+    FillQuery("getIntegerv", pname, params);
+}
+
+void INTERNAL_GL_APIENTRY GetInteger64v(GLenum pname, GLint64 *params)
+{
+    FillQuery("getInteger64v", pname, params);
+}
+
+void INTERNAL_GL_APIENTRY GetFloatv(GLenum pname, GLfloat *params)
+{
+    FillQuery("getFloatv", pname, params);
+}
+
+void INTERNAL_GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+    FillQuery("getIntegeri_v", target, data);
+}
+
+const GLubyte *INTERNAL_GL_APIENTRY GetString(GLenum name)
+{
+    RecordingFunctionsGL::Record("getString");
+    switch (name)
+    {
+        case GL_VERSION:
+            return reinterpret_cast<const GLubyte *>("4.5.0");
+        case GL_SHADING_LANGUAGE_VERSION:
+            return reinterpret_cast<const GLubyte *>("4.50");
+        case GL_EXTENSIONS:
+            return reinterpret_cast<const GLubyte *>("");
+        default:
+            return reinterpret_cast<const GLubyte *>("Recording");
+    }
+}
+
+// Like RecordingEntryPoint, for the glGen* entry points. Hands out new names.
+template <int Index>
+struct RecordingGenEntryPoint
+{
+    static void INTERNAL_GL_APIENTRY Call(GLsizei n, GLuint *names)
+    {
+        RecordingFunctionsGL::Record(sName);
+        for (GLsizei i = 0; i < n; i++)
+        {
+            names[i] = RecordingFunctionsGL::GenerateName();
+        }
+    }
+
+    static void(INTERNAL_GL_APIENTRY *Bind(const char *name))(GLsizei, GLuint *)
+    {
+        sName = name;
+        return &Call;
+    }
+
+    static const char *sName;
+};
+
+template <int Index>
+const char *RecordingGenEntryPoint<Index>::sName = nullptr;
+
+#define ANGLE_RECORD_GEN_ENTRY_POINT(NAME) NAME = RecordingGenEntryPoint<__COUNTER__>::Bind(#NAME)
+
+GLuint INTERNAL_GL_APIENTRY CreateProgram()
+{
+    RecordingFunctionsGL::Record("createProgram");
+    return RecordingFunctionsGL::GenerateName();
+}
+
+GLuint INTERNAL_GL_APIENTRY CreateShader(GLenum type)
+{
+    RecordingFunctionsGL::Record("createShader");
+    return RecordingFunctionsGL::GenerateName();
+}
+
+// Compiles and links always succeed and produce no info log.
+void INTERNAL_GL_APIENTRY GetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    RecordingFunctionsGL::Record("getShaderiv");
+    *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+void INTERNAL_GL_APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    RecordingFunctionsGL::Record("getProgramiv");
+    *params = (pname == GL_LINK_STATUS) ? GL_TRUE : 0;
+}
+
+GLenum INTERNAL_GL_APIENTRY CheckFramebufferStatus(GLenum target)
+{
+    RecordingFunctionsGL::Record("checkFramebufferStatus");
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+// Maps return fresh memory that stays valid as long as the recorder. Unmaps always succeed.
+void *INTERNAL_GL_APIENTRY MapBufferRange(GLenum target,
+                                          GLintptr offset,
+                                          GLsizeiptr length,
+                                          GLbitfield access)
+{
+    RecordingFunctionsGL::Record("mapBufferRange");
+    return RecordingFunctionsGL::AllocateMapping(static_cast<size_t>(length));
+}
+
+GLboolean INTERNAL_GL_APIENTRY UnmapBuffer(GLenum target)
+{
+    RecordingFunctionsGL::Record("unmapBuffer");
+    return GL_TRUE;
+}
+
+// Fences are signaled as soon as they are created.
+GLsync INTERNAL_GL_APIENTRY FenceSync(GLenum condition, GLbitfield flags)
+{
+    RecordingFunctionsGL::Record("fenceSync");
+    return reinterpret_cast<GLsync>(static_cast<uintptr_t>(RecordingFunctionsGL::GenerateName()));
+}
+
+GLenum INTERNAL_GL_APIENTRY ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    RecordingFunctionsGL::Record("clientWaitSync");
+    return GL_ALREADY_SIGNALED;
+}
+
+}  // anonymous namespace
+
+RecordingFunctionsGL::RecordingFunctionsGL() : mNextName(1)
+{
+    ASSERT(gCurrentRecorder == nullptr);
+    gCurrentRecorder = this;
+
+    version  = gl::Version(4, 5);
+    standard = STANDARD_GL_DESKTOP;
+    profile  = GL_CONTEXT_CORE_PROFILE_BIT;
+
+    getIntegerv            = &GetIntegerv;
+    getInteger64v          = &GetInteger64v;
+    getFloatv              = &GetFloatv;
+    getIntegeri_v          = &GetIntegeri_v;
+    getString              = &GetString;
+    createProgram          = &CreateProgram;
+    createShader           = &CreateShader;
+    getShaderiv            = &GetShaderiv;
+    getProgramiv           = &GetProgramiv;
+    checkFramebufferStatus = &CheckFramebufferStatus;
+    mapBufferRange         = &MapBufferRange;
+    unmapBuffer            = &UnmapBuffer;
+    fenceSync              = &FenceSync;
+    clientWaitSync         = &ClientWaitSync;
+
+    ANGLE_RECORD_GEN_ENTRY_POINT(genBuffers);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genFramebuffers);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genQueries);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genRenderbuffers);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genSamplers);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genTextures);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genTransformFeedbacks);
+    ANGLE_RECORD_GEN_ENTRY_POINT(genVertexArrays);
+
+    // The remaining entry points the back-end uses on a desktop context. Entry points that are
+    // only loaded for extensions or for GLES stay null, so the back-end does not take those paths.
+    ANGLE_RECORD_ENTRY_POINT(activeTexture);
+    ANGLE_RECORD_ENTRY_POINT(attachShader);
+    ANGLE_RECORD_ENTRY_POINT(beginQuery);
+    ANGLE_RECORD_ENTRY_POINT(beginTransformFeedback);
+    ANGLE_RECORD_ENTRY_POINT(bindAttribLocation);
+    ANGLE_RECORD_ENTRY_POINT(bindBuffer);
+    ANGLE_RECORD_ENTRY_POINT(bindBufferBase);
+    ANGLE_RECORD_ENTRY_POINT(bindBufferRange);
+    ANGLE_RECORD_ENTRY_POINT(bindFramebuffer);
+    ANGLE_RECORD_ENTRY_POINT(bindRenderbuffer);
+    ANGLE_RECORD_ENTRY_POINT(bindSampler);
+    ANGLE_RECORD_ENTRY_POINT(bindTexture);
+    ANGLE_RECORD_ENTRY_POINT(bindTransformFeedback);
+    ANGLE_RECORD_ENTRY_POINT(bindVertexArray);
+    ANGLE_RECORD_ENTRY_POINT(blendColor);
+    ANGLE_RECORD_ENTRY_POINT(blendEquationSeparate);
+    ANGLE_RECORD_ENTRY_POINT(blendFuncSeparate);
+    ANGLE_RECORD_ENTRY_POINT(blitFramebuffer);
+    ANGLE_RECORD_ENTRY_POINT(bufferData);
+    ANGLE_RECORD_ENTRY_POINT(bufferStorage);
+    ANGLE_RECORD_ENTRY_POINT(bufferSubData);
+    ANGLE_RECORD_ENTRY_POINT(clear);
+    ANGLE_RECORD_ENTRY_POINT(clearBufferfi);
+    ANGLE_RECORD_ENTRY_POINT(clearBufferfv);
+    ANGLE_RECORD_ENTRY_POINT(clearBufferiv);
+    ANGLE_RECORD_ENTRY_POINT(clearBufferuiv);
+    ANGLE_RECORD_ENTRY_POINT(clearColor);
+    ANGLE_RECORD_ENTRY_POINT(clearDepth);
+    ANGLE_RECORD_ENTRY_POINT(clearStencil);
+    ANGLE_RECORD_ENTRY_POINT(colorMask);
+    ANGLE_RECORD_ENTRY_POINT(compileShader);
+    ANGLE_RECORD_ENTRY_POINT(compressedTexImage2D);
+    ANGLE_RECORD_ENTRY_POINT(compressedTexImage3D);
+    ANGLE_RECORD_ENTRY_POINT(compressedTexSubImage2D);
+    ANGLE_RECORD_ENTRY_POINT(compressedTexSubImage3D);
+    ANGLE_RECORD_ENTRY_POINT(copyBufferSubData);
+    ANGLE_RECORD_ENTRY_POINT(copyTexImage2D);
+    ANGLE_RECORD_ENTRY_POINT(copyTexSubImage2D);
+    ANGLE_RECORD_ENTRY_POINT(copyTexSubImage3D);
+    ANGLE_RECORD_ENTRY_POINT(cullFace);
+    ANGLE_RECORD_ENTRY_POINT(debugMessageCallback);
+    ANGLE_RECORD_ENTRY_POINT(debugMessageControl);
+    ANGLE_RECORD_ENTRY_POINT(debugMessageInsert);
+    ANGLE_RECORD_ENTRY_POINT(deleteBuffers);
+    ANGLE_RECORD_ENTRY_POINT(deleteFramebuffers);
+    ANGLE_RECORD_ENTRY_POINT(deleteProgram);
+    ANGLE_RECORD_ENTRY_POINT(deleteQueries);
+    ANGLE_RECORD_ENTRY_POINT(deleteRenderbuffers);
+    ANGLE_RECORD_ENTRY_POINT(deleteSamplers);
+    ANGLE_RECORD_ENTRY_POINT(deleteShader);
+    ANGLE_RECORD_ENTRY_POINT(deleteSync);
+    ANGLE_RECORD_ENTRY_POINT(deleteTextures);
+    ANGLE_RECORD_ENTRY_POINT(deleteTransformFeedbacks);
+    ANGLE_RECORD_ENTRY_POINT(deleteVertexArrays);
+    ANGLE_RECORD_ENTRY_POINT(depthFunc);
+    ANGLE_RECORD_ENTRY_POINT(depthMask);
+    ANGLE_RECORD_ENTRY_POINT(depthRange);
+    ANGLE_RECORD_ENTRY_POINT(detachShader);
+    ANGLE_RECORD_ENTRY_POINT(disable);
+    ANGLE_RECORD_ENTRY_POINT(disableVertexAttribArray);
+    ANGLE_RECORD_ENTRY_POINT(dispatchCompute);
+    ANGLE_RECORD_ENTRY_POINT(drawArrays);
+    ANGLE_RECORD_ENTRY_POINT(drawArraysIndirect);
+    ANGLE_RECORD_ENTRY_POINT(drawArraysInstanced);
+    ANGLE_RECORD_ENTRY_POINT(drawBuffers);
+    ANGLE_RECORD_ENTRY_POINT(drawElements);
+    ANGLE_RECORD_ENTRY_POINT(drawElementsIndirect);
+    ANGLE_RECORD_ENTRY_POINT(drawElementsInstanced);
+    ANGLE_RECORD_ENTRY_POINT(drawRangeElements);
+    ANGLE_RECORD_ENTRY_POINT(enable);
+    ANGLE_RECORD_ENTRY_POINT(enableVertexAttribArray);
+    ANGLE_RECORD_ENTRY_POINT(endQuery);
+    ANGLE_RECORD_ENTRY_POINT(endTransformFeedback);
+    ANGLE_RECORD_ENTRY_POINT(finish);
+    ANGLE_RECORD_ENTRY_POINT(flush);
+    ANGLE_RECORD_ENTRY_POINT(flushMappedBufferRange);
+    ANGLE_RECORD_ENTRY_POINT(framebufferParameteri);
+    ANGLE_RECORD_ENTRY_POINT(framebufferRenderbuffer);
+    ANGLE_RECORD_ENTRY_POINT(framebufferTexture2D);
+    ANGLE_RECORD_ENTRY_POINT(framebufferTextureLayer);
+    ANGLE_RECORD_ENTRY_POINT(frontFace);
+    ANGLE_RECORD_ENTRY_POINT(generateMipmap);
+    ANGLE_RECORD_ENTRY_POINT(getActiveUniformBlockiv);
+    ANGLE_RECORD_ENTRY_POINT(getActiveUniformsiv);
+    ANGLE_RECORD_ENTRY_POINT(getAttribLocation);
+    ANGLE_RECORD_ENTRY_POINT(getError);
+    ANGLE_RECORD_ENTRY_POINT(getInternalformativ);
+    ANGLE_RECORD_ENTRY_POINT(getMultisamplefv);
+    ANGLE_RECORD_ENTRY_POINT(getProgramBinary);
+    ANGLE_RECORD_ENTRY_POINT(getProgramInfoLog);
+    ANGLE_RECORD_ENTRY_POINT(getProgramInterfaceiv);
+    ANGLE_RECORD_ENTRY_POINT(getProgramResourceName);
+    ANGLE_RECORD_ENTRY_POINT(getProgramResourceiv);
+    ANGLE_RECORD_ENTRY_POINT(getQueryObjectiv);
+    ANGLE_RECORD_ENTRY_POINT(getQueryObjectui64v);
+    ANGLE_RECORD_ENTRY_POINT(getQueryObjectuiv);
+    ANGLE_RECORD_ENTRY_POINT(getQueryiv);
+    ANGLE_RECORD_ENTRY_POINT(getShaderInfoLog);
+    ANGLE_RECORD_ENTRY_POINT(getShaderPrecisionFormat);
+    ANGLE_RECORD_ENTRY_POINT(getSynciv);
+    ANGLE_RECORD_ENTRY_POINT(getUniformBlockIndex);
+    ANGLE_RECORD_ENTRY_POINT(getUniformIndices);
+    ANGLE_RECORD_ENTRY_POINT(getUniformLocation);
+    ANGLE_RECORD_ENTRY_POINT(invalidateFramebuffer);
+    ANGLE_RECORD_ENTRY_POINT(invalidateSubFramebuffer);
+    ANGLE_RECORD_ENTRY_POINT(lineWidth);
+    ANGLE_RECORD_ENTRY_POINT(linkProgram);
+    ANGLE_RECORD_ENTRY_POINT(pauseTransformFeedback);
+    ANGLE_RECORD_ENTRY_POINT(pixelStorei);
+    ANGLE_RECORD_ENTRY_POINT(polygonOffset);
+    ANGLE_RECORD_ENTRY_POINT(popDebugGroup);
+    ANGLE_RECORD_ENTRY_POINT(programBinary);
+    ANGLE_RECORD_ENTRY_POINT(programParameteri);
+    ANGLE_RECORD_ENTRY_POINT(programUniform1fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform1iv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform1uiv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform2fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform2iv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform2uiv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform3fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform3iv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform3uiv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform4fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform4iv);
+    ANGLE_RECORD_ENTRY_POINT(programUniform4uiv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix2fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix2x3fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix2x4fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix3fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix3x2fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix3x4fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix4fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix4x2fv);
+    ANGLE_RECORD_ENTRY_POINT(programUniformMatrix4x3fv);
+    ANGLE_RECORD_ENTRY_POINT(pushDebugGroup);
+    ANGLE_RECORD_ENTRY_POINT(queryCounter);
+    ANGLE_RECORD_ENTRY_POINT(readBuffer);
+    ANGLE_RECORD_ENTRY_POINT(readPixels);
+    ANGLE_RECORD_ENTRY_POINT(renderbufferStorage);
+    ANGLE_RECORD_ENTRY_POINT(renderbufferStorageMultisample);
+    ANGLE_RECORD_ENTRY_POINT(resumeTransformFeedback);
+    ANGLE_RECORD_ENTRY_POINT(sampleCoverage);
+    ANGLE_RECORD_ENTRY_POINT(samplerParameterf);
+    ANGLE_RECORD_ENTRY_POINT(samplerParameterfv);
+    ANGLE_RECORD_ENTRY_POINT(samplerParameteri);
+    ANGLE_RECORD_ENTRY_POINT(samplerParameteriv);
+    ANGLE_RECORD_ENTRY_POINT(scissor);
+    ANGLE_RECORD_ENTRY_POINT(shaderSource);
+    ANGLE_RECORD_ENTRY_POINT(stencilFuncSeparate);
+    ANGLE_RECORD_ENTRY_POINT(stencilMaskSeparate);
+    ANGLE_RECORD_ENTRY_POINT(stencilOpSeparate);
+    ANGLE_RECORD_ENTRY_POINT(texImage2D);
+    ANGLE_RECORD_ENTRY_POINT(texImage3D);
+    ANGLE_RECORD_ENTRY_POINT(texParameterf);
+    ANGLE_RECORD_ENTRY_POINT(texParameteri);
+    ANGLE_RECORD_ENTRY_POINT(texParameteriv);
+    ANGLE_RECORD_ENTRY_POINT(texStorage2D);
+    ANGLE_RECORD_ENTRY_POINT(texStorage2DMultisample);
+    ANGLE_RECORD_ENTRY_POINT(texStorage3D);
+    ANGLE_RECORD_ENTRY_POINT(texSubImage2D);
+    ANGLE_RECORD_ENTRY_POINT(texSubImage3D);
+    ANGLE_RECORD_ENTRY_POINT(transformFeedbackVaryings);
+    ANGLE_RECORD_ENTRY_POINT(uniform1fv);
+    ANGLE_RECORD_ENTRY_POINT(uniform1i);
+    ANGLE_RECORD_ENTRY_POINT(uniform1iv);
+    ANGLE_RECORD_ENTRY_POINT(uniform1uiv);
+    ANGLE_RECORD_ENTRY_POINT(uniform2f);
+    ANGLE_RECORD_ENTRY_POINT(uniform2fv);
+    ANGLE_RECORD_ENTRY_POINT(uniform2iv);
+    ANGLE_RECORD_ENTRY_POINT(uniform2uiv);
+    ANGLE_RECORD_ENTRY_POINT(uniform3fv);
+    ANGLE_RECORD_ENTRY_POINT(uniform3iv);
+    ANGLE_RECORD_ENTRY_POINT(uniform3uiv);
+    ANGLE_RECORD_ENTRY_POINT(uniform4fv);
+    ANGLE_RECORD_ENTRY_POINT(uniform4iv);
+    ANGLE_RECORD_ENTRY_POINT(uniform4uiv);
+    ANGLE_RECORD_ENTRY_POINT(uniformBlockBinding);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix2fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix2x3fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix2x4fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix3fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix3x2fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix3x4fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix4fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix4x2fv);
+    ANGLE_RECORD_ENTRY_POINT(uniformMatrix4x3fv);
+    ANGLE_RECORD_ENTRY_POINT(useProgram);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttrib4f);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttrib4fv);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttribDivisor);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttribI4iv);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttribI4uiv);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttribIPointer);
+    ANGLE_RECORD_ENTRY_POINT(vertexAttribPointer);
+    ANGLE_RECORD_ENTRY_POINT(viewport);
+    ANGLE_RECORD_ENTRY_POINT(waitSync);
+}
+
+RecordingFunctionsGL::~RecordingFunctionsGL()
+{
+    ASSERT(gCurrentRecorder == this);
+    gCurrentRecorder = nullptr;
+}
+
+size_t RecordingFunctionsGL::getCallCount(const std::string &entryPoint) const
+{
+    auto iter = mCallCounts.find(entryPoint);
+    return (iter != mCallCounts.end()) ? iter->second : 0;
+}
+
+void RecordingFunctionsGL::resetCallCounts()
+{
+    mCallCounts.clear();
+}
+
+void *RecordingFunctionsGL::loadProcAddress(const std::string &function)
+{
+    // The entry points are all assigned by the constructor.
+    return nullptr;
+}
+
+// static
+void RecordingFunctionsGL::Record(const char *entryPoint)
+{
+    ASSERT(gCurrentRecorder);
+    gCurrentRecorder->mCallCounts[entryPoint]++;
+}
+
+// static
+void *RecordingFunctionsGL::AllocateMapping(size_t size)
+{
+    ASSERT(gCurrentRecorder);
+    gCurrentRecorder->mMappings.emplace_back(size);
+    return gCurrentRecorder->mMappings.back().data();
+}
+
+// static
+GLuint RecordingFunctionsGL::GenerateName()
+{
+    ASSERT(gCurrentRecorder);
+    return gCurrentRecorder->mNextName++;
+}
+
+}  // namespace rx
@@ -0,0 +1,50 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RecordingFunctionsGL.h:
+//   A FunctionsGL whose entry points do nothing but count how often they are called. Lets unit
+//   tests run the GL back-end without a native context and assert on the GL calls it makes.
+//
+
+#ifndef TESTS_TEST_UTILS_RECORDINGFUNCTIONSGL_H_
+#define TESTS_TEST_UTILS_RECORDINGFUNCTIONSGL_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+
+namespace rx
+{
+
+// Presents itself as a desktop GL 4.5 core profile without extensions. Queries return small
+// non-zero limits, object creation hands out increasing names and compiles and links succeed.
+// Only one instance may exist at a time.
+class RecordingFunctionsGL : public FunctionsGL
+{
+  public:
+    RecordingFunctionsGL();
+    ~RecordingFunctionsGL() override;
+
+    size_t getCallCount(const std::string &entryPoint) const;
+    void resetCallCounts();
+
+    void *loadProcAddress(const std::string &function) override;
+
+    // Called by the entry points.
+    static void Record(const char *entryPoint);
+    static GLuint GenerateName();
+    static void *AllocateMapping(size_t size);
+
+  private:
+    std::map<std::string, size_t> mCallCounts;
+    GLuint mNextName;
+    std::vector<std::vector<uint8_t>> mMappings;
+};
+
+}  // namespace rx
+
+#endif  // TESTS_TEST_UTILS_RECORDINGFUNCTIONSGL_H_
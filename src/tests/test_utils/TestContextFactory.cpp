@@ -0,0 +1,75 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TestContextFactory.cpp:
+//   Creates gl::Contexts without a display for unit tests that run the frontend on top of a
+//   back-end's ContextImpl.
+//
+
+#include "tests/test_utils/TestContextFactory.h"
+
+#include <algorithm>
+
+namespace angle
+{
+
+TestContextFactory::TestContextFactory(CreateImplFunction createImpl)
+{
+    ON_CALL(mEGLFactory, createContext(testing::_)).WillByDefault(testing::Invoke(createImpl));
+}
+
+TestContextFactory::~TestContextFactory()
+{
+    while (!mContexts.empty())
+    {
+        destroyContext(mContexts.back());
+    }
+}
+
+gl::Context *TestContextFactory::createContext(EGLint clientVersion)
+{
+    egl::AttributeMap attribs;
+    attribs.insert(EGL_CONTEXT_CLIENT_VERSION, clientVersion);
+    return createContext(attribs, nullptr, false);
+}
+
+gl::Context *TestContextFactory::createContext(const egl::AttributeMap &attribs,
+                                               gl::CapsSnapshotCache *capsCache,
+                                               bool robustResourceInit)
+{
+    gl::Context *context = new gl::Context(&mEGLFactory, nullptr, nullptr, nullptr, capsCache,
+                                           attribs, egl::DisplayExtensions(), robustResourceInit);
+    context->makeCurrent(nullptr, nullptr);
+    mContexts.push_back(context);
+    return context;
+}
+
+void TestContextFactory::destroyContext(gl::Context *context)
+{
+    auto iter = std::find(mContexts.begin(), mContexts.end(), context);
+    ASSERT(iter != mContexts.end());
+    mContexts.erase(iter);
+
+    context->destroy(nullptr);
+    SafeDelete(context);
+}
+
+GLuint CompileProgram(gl::Context *context, const char *vertexShader, const char *fragmentShader)
+{
+    GLuint program = context->createProgram();
+    for (const auto &shader : {std::make_pair(GL_VERTEX_SHADER, vertexShader),
+                               std::make_pair(GL_FRAGMENT_SHADER, fragmentShader)})
+    {
+        GLuint shaderHandle = context->createShader(shader.first);
+        const char *source  = shader.second;
+        context->shaderSource(shaderHandle, 1, &source, nullptr);
+        context->compileShader(shaderHandle);
+        context->attachShader(program, shaderHandle);
+    }
+    context->linkProgram(program);
+    return program;
+}
+
+}  // namespace angle
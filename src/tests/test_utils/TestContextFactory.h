@@ -0,0 +1,53 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TestContextFactory.h:
+//   Creates gl::Contexts without a display for unit tests that run the frontend on top of a
+//   back-end's ContextImpl.
+//
+
+#ifndef TESTS_TEST_UTILS_TESTCONTEXTFACTORY_H_
+#define TESTS_TEST_UTILS_TESTCONTEXTFACTORY_H_
+
+#include <functional>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "libANGLE/Context.h"
+#include "tests/angle_unittests_utils.h"
+
+namespace angle
+{
+
+// Every context gets its implementation from the function passed to the constructor. Contexts
+// that are still alive when the factory is destroyed are destroyed with it.
+class TestContextFactory : angle::NonCopyable
+{
+  public:
+    using CreateImplFunction = std::function<rx::ContextImpl *(const gl::ContextState &)>;
+
+    explicit TestContextFactory(CreateImplFunction createImpl);
+    ~TestContextFactory();
+
+    // Creates a context and makes it current.
+    gl::Context *createContext(EGLint clientVersion);
+    gl::Context *createContext(const egl::AttributeMap &attribs,
+                               gl::CapsSnapshotCache *capsCache,
+                               bool robustResourceInit);
+
+    void destroyContext(gl::Context *context);
+
+  private:
+    testing::NiceMock<rx::MockEGLFactory> mEGLFactory;
+    std::vector<gl::Context *> mContexts;
+};
+
+// Compiles the shaders and links them into a new program. Returns the program's handle.
+GLuint CompileProgram(gl::Context *context, const char *vertexShader, const char *fragmentShader);
+
+}  // namespace angle
+
+#endif  // TESTS_TEST_UTILS_TESTCONTEXTFACTORY_H_
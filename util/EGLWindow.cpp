@@ -119,6 +119,7 @@ EGLWindow::EGLWindow(EGLint glesMajorVersion,
       mWebGLCompatibility(false),
       mBindGeneratesResource(true),
       mClientArraysEnabled(true),
+      mMultithreadedShareGroup(false),
       mRobustResourceInit(),
       mSwapInterval(-1),
       mSamples(-1),
@@ -338,6 +339,14 @@ bool EGLWindow::initializeContext()
         return false;
     }
 
+    bool hasMultithreadedShareGroup =
+        strstr(displayExtensions, "EGL_ANGLE_create_context_multithreaded_share_group") != nullptr;
+    if (mMultithreadedShareGroup && !hasMultithreadedShareGroup)
+    {
+        destroyGL();
+        return false;
+    }
+
     eglBindAPI(EGL_OPENGL_ES_API);
     if (eglGetError() != EGL_SUCCESS)
     {
@@ -381,6 +390,12 @@ bool EGLWindow::initializeContext()
             contextAttributes.push_back(EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE);
             contextAttributes.push_back(mClientArraysEnabled ? EGL_TRUE : EGL_FALSE);
         }
+
+        if (mMultithreadedShareGroup)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_MULTITHREADED_SHARE_GROUP_ANGLE);
+            contextAttributes.push_back(EGL_TRUE);
+        }
     }
     contextAttributes.push_back(EGL_NONE);
 
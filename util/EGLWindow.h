@@ -86,6 +86,7 @@ class ANGLE_EXPORT EGLWindow : angle::NonCopyable
     }
     void setVulkanLayersEnabled(bool enabled) { mVulkanLayersEnabled = enabled; }
     void setClientArraysEnabled(bool enabled) { mClientArraysEnabled = enabled; }
+    void setMultithreadedShareGroup(bool enabled) { mMultithreadedShareGroup = enabled; }
     void setRobustResourceInit(bool enabled) { mRobustResourceInit = enabled; }
     void setSwapInterval(EGLint swapInterval) { mSwapInterval = swapInterval; }
     void setPlatformMethods(angle::PlatformMethods *platformMethods)
@@ -153,6 +154,7 @@ class ANGLE_EXPORT EGLWindow : angle::NonCopyable
     bool mWebGLCompatibility;
     bool mBindGeneratesResource;
     bool mClientArraysEnabled;
+    bool mMultithreadedShareGroup;
     Optional<bool> mRobustResourceInit;
     EGLint mSwapInterval;
     EGLint mSamples;